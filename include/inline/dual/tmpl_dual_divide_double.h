@@ -0,0 +1,85 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                          tmpl_dual_divide_double                           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Contains the source code for dual number division.                    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_DualDouble_Divide                                                *
+ *  Purpose:                                                                  *
+ *      Divides two dual numbers.                                             *
+ *                                                                            *
+ *          x / y = (a + b e) / (c + d e)                                     *
+ *                = a / c + ((b c - a d) / c^2) e                             *
+ *                                                                            *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *      y (const tmpl_DualDouble):                                            *
+ *          Another dual number.                                              *
+ *  Output:                                                                   *
+ *      quot (tmpl_DualDouble):                                               *
+ *          The quotient x / y.                                               *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Notes:                                                                    *
+ *      1.) No checks for NaN or infinity are made.                           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Contains the TMPL_INLINE_DECL macro.                              *
+ *  2.) tmpl_dual_double.h:                                                   *
+ *          Header providing double precision dual numbers.                   *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_DUAL_DIVIDE_DOUBLE_H
+#define TMPL_DUAL_DIVIDE_DOUBLE_H
+
+/*  TMPL_INLINE_DECL found here.                                              */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Dual numbers provided here.                                               */
+#include <libtmpl/include/types/tmpl_dual_double.h>
+
+/*  Divides two dual numbers.                                                 */
+TMPL_INLINE_DECL
+tmpl_DualDouble
+tmpl_DualDouble_Divide(const tmpl_DualDouble x, const tmpl_DualDouble y)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_DualDouble quot;
+
+    /*  With q = a / c, the dual part (b c - a d) / c^2 is (b - q d) / c.     *
+     *  This saves a multiplication and avoids overflow in c^2.               */
+    quot.dat[0] = x.dat[0] / y.dat[0];
+    quot.dat[1] = (x.dat[1] - quot.dat[0]*y.dat[1]) / y.dat[0];
+    return quot;
+}
+/*  End of tmpl_DualDouble_Divide.                                            */
+
+#endif
+/*  End of include guard.                                                     */
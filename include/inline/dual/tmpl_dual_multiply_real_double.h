@@ -0,0 +1,84 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                       tmpl_dual_multiply_real_double                       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Contains the source code for multiplying real and dual numbers.       *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_DualDouble_Multiply_Real                                         *
+ *  Purpose:                                                                  *
+ *      Multiplies a dual number by a real number.                            *
+ *                                                                            *
+ *          r x = r (a + b e)                                                 *
+ *              = ra + rb e                                                   *
+ *                                                                            *
+ *  Arguments:                                                                *
+ *      r (double):                                                           *
+ *          A real number.                                                    *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      prod (tmpl_DualDouble):                                               *
+ *          The product r x.                                                  *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Notes:                                                                    *
+ *      1.) No checks for NaN or infinity are made.                           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Contains the TMPL_INLINE_DECL macro.                              *
+ *  2.) tmpl_dual_double.h:                                                   *
+ *          Header providing double precision dual numbers.                   *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_DUAL_MULTIPLY_REAL_DOUBLE_H
+#define TMPL_DUAL_MULTIPLY_REAL_DOUBLE_H
+
+/*  TMPL_INLINE_DECL found here.                                              */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Dual numbers provided here.                                               */
+#include <libtmpl/include/types/tmpl_dual_double.h>
+
+/*  Multiplies a dual number by a real number.                                */
+TMPL_INLINE_DECL
+tmpl_DualDouble
+tmpl_DualDouble_Multiply_Real(double r, const tmpl_DualDouble x)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_DualDouble prod;
+
+    /*  Scale both components.                                                */
+    prod.dat[0] = r*x.dat[0];
+    prod.dat[1] = r*x.dat[1];
+    return prod;
+}
+/*  End of tmpl_DualDouble_Multiply_Real.                                     */
+
+#endif
+/*  End of include guard.                                                     */
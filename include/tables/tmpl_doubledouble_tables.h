@@ -0,0 +1,51 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                          tmpl_doubledouble_tables                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides lookup tables for the double-double elementary functions.    *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_doubledouble_double.h:                                           *
+ *          Contains the double-double typedef.                               *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_TABLES_DOUBLEDOUBLE_TABLES_H
+#define TMPL_TABLES_DOUBLEDOUBLE_TABLES_H
+
+/*  tmpl_DoubleDouble typedef provided here.                                  */
+#include <libtmpl/include/types/tmpl_doubledouble_double.h>
+
+/*  The values 1 / n! for n = 0, 1, ..., 17, as double-doubles.               */
+extern const tmpl_DoubleDouble tmpl_doubledouble_rcpr_factorial_table[18];
+
+/*  The values sin(pi * k / 16) and cos(pi * k / 16) for k = 0, 1, ..., 4.    */
+extern const tmpl_DoubleDouble tmpl_doubledouble_sinpi16_table[5];
+extern const tmpl_DoubleDouble tmpl_doubledouble_cospi16_table[5];
+
+/*  The first 1280 bits of 2 / pi, in 16-bit pieces, for Payne-Hanek.         */
+extern const unsigned int tmpl_doubledouble_two_by_pi_table[80];
+
+#endif
+/*  End of include guard.                                                     */
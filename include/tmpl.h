@@ -42,11 +42,13 @@
 #include <libtmpl/include/types/tmpl_cubic_double.h>
 #include <libtmpl/include/types/tmpl_cubic_float.h>
 #include <libtmpl/include/types/tmpl_cubic_ldouble.h>
+#include <libtmpl/include/types/tmpl_cubic_spline_double.h>
 #include <libtmpl/include/types/tmpl_cyl_fresnel_geometry_double.h>
 #include <libtmpl/include/types/tmpl_cyl_fresnel_geometry_float.h>
 #include <libtmpl/include/types/tmpl_cyl_fresnel_geometry_ldouble.h>
 #include <libtmpl/include/types/tmpl_doubledouble_double.h>
 #include <libtmpl/include/types/tmpl_doubledouble_ldouble.h>
+#include <libtmpl/include/types/tmpl_dual_double.h>
 #include <libtmpl/include/types/tmpl_floatint_double.h>
 #include <libtmpl/include/types/tmpl_floatint_float.h>
 #include <libtmpl/include/types/tmpl_floatint_ldouble.h>
@@ -63,11 +65,17 @@
 #include <libtmpl/include/types/tmpl_line2_double.h>
 #include <libtmpl/include/types/tmpl_line2_float.h>
 #include <libtmpl/include/types/tmpl_line2_ldouble.h>
+#include <libtmpl/include/types/tmpl_linear_interp_plan_double.h>
+#include <libtmpl/include/types/tmpl_linear_interp_plan_float.h>
+#include <libtmpl/include/types/tmpl_linear_interp_plan_ldouble.h>
 #include <libtmpl/include/types/tmpl_mat3x3_double.h>
 #include <libtmpl/include/types/tmpl_mat3x3_float.h>
 #include <libtmpl/include/types/tmpl_mat3x3_ldouble.h>
 #include <libtmpl/include/types/tmpl_pen_type.h>
+#include <libtmpl/include/types/tmpl_polynomial_arena_int.h>
+#include <libtmpl/include/types/tmpl_polynomial_buffer_int.h>
 #include <libtmpl/include/types/tmpl_polynomial_int.h>
+#include <libtmpl/include/types/tmpl_quadruple.h>
 #include <libtmpl/include/types/tmpl_rgb.h>
 #include <libtmpl/include/types/tmpl_rgb24.h>
 #include <libtmpl/include/types/tmpl_rgb30.h>
@@ -76,6 +84,8 @@
 #include <libtmpl/include/types/tmpl_rgba24.h>
 #include <libtmpl/include/types/tmpl_rgba30.h>
 #include <libtmpl/include/types/tmpl_rgba48.h>
+#include <libtmpl/include/types/tmpl_split_complex_double.h>
+#include <libtmpl/include/types/tmpl_split_complex_float.h>
 #include <libtmpl/include/types/tmpl_svg_canvas.h>
 #include <libtmpl/include/types/tmpl_svg_type.h>
 #include <libtmpl/include/types/tmpl_vec2_double.h>
@@ -90,6 +100,8 @@
 #include <libtmpl/include/types/tmpl_vec3_vector_field_double.h>
 #include <libtmpl/include/types/tmpl_vec3_vector_field_float.h>
 #include <libtmpl/include/types/tmpl_vec3_vector_field_ldouble.h>
+#include <libtmpl/include/types/tmpl_where_indices.h>
+#include <libtmpl/include/types/tmpl_where_mask.h>
 #include <libtmpl/include/types/tmpl_window_function_double.h>
 #include <libtmpl/include/types/tmpl_window_function_float.h>
 #include <libtmpl/include/types/tmpl_window_function_ldouble.h>
@@ -110,6 +122,7 @@
 #include <libtmpl/include/tmpl_array_integer.h>
 #include <libtmpl/include/tmpl_astro.h>
 #include <libtmpl/include/tmpl_attributes.h>
+#include <libtmpl/include/tmpl_bigint.h>
 #include <libtmpl/include/tmpl_bool.h>
 #include <libtmpl/include/tmpl_bytes.h>
 #include <libtmpl/include/tmpl_calendar.h>
@@ -120,6 +133,7 @@
 #include <libtmpl/include/tmpl_cyl_fresnel_optics.h>
 #include <libtmpl/include/tmpl_differentiation_real.h>
 #include <libtmpl/include/tmpl_doubledouble.h>
+#include <libtmpl/include/tmpl_dual.h>
 #include <libtmpl/include/tmpl_fft.h>
 #include <libtmpl/include/tmpl_float.h>
 #include <libtmpl/include/tmpl_fraunhofer_diffraction.h>
@@ -155,6 +169,7 @@
 #include <libtmpl/include/tmpl_special_functions_real.h>
 #include <libtmpl/include/tmpl_spherical_geometry.h>
 #include <libtmpl/include/tmpl_split.h>
+#include <libtmpl/include/tmpl_split_complex.h>
 #include <libtmpl/include/tmpl_string.h>
 #include <libtmpl/include/tmpl_svg.h>
 #include <libtmpl/include/tmpl_two_diff.h>
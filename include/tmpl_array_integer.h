@@ -30,6 +30,11 @@
  ******************************************************************************
  *  Author:     Ryan Maguire                                                  *
  *  Date:       March 6, 2024                                                 *
+ ******************************************************************************
+ *                              Revision History                              *
+ ******************************************************************************
+ *  2026/10/18: Ryan Maguire                                                  *
+ *      Added GCD, LCM, and elementwise GCD functions.                        *
  ******************************************************************************/
 
 /*  Include guard to prevent including this file twice.                       */
@@ -48,6 +53,12 @@
 extern "C" {
 #endif
 
+/*  Arrays with at least this many elements have their GCD, LCM, and          *
+ *  elementwise GCD computed in parallel, if OpenMP support is enabled.       */
+#ifndef TMPL_ARRAY_GCD_PARALLEL_MIN_LENGTH
+#define TMPL_ARRAY_GCD_PARALLEL_MIN_LENGTH (65536)
+#endif
+
 /******************************************************************************
  *  Function:                                                                 *
  *      tmpl_Int_Array_Double_Average                                         *
@@ -942,8 +953,145 @@ tmpl_ULLong_Array_Sum(const unsigned long long int * const arr, size_t len);
 #endif
 /*  End of #if TMPL_HAS_LONGLONG == 1.                                        */
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_UInt_Array_GCD                                                   *
+ *  Purpose:                                                                  *
+ *      Computes the greatest common divisor of the elements of an array.     *
+ *  Arguments:                                                                *
+ *      arr (const unsigned int * const):                                     *
+ *          An array of unsigned ints.                                        *
+ *      len (size_t):                                                         *
+ *          The number of elements in the array.                              *
+ *  Output:                                                                   *
+ *      gcd (unsigned int):                                                   *
+ *          The GCD of the elements of arr. Zero for NULL or empty arrays.    *
+ *  Notes:                                                                    *
+ *      1.) unsigned char, short, and long versions are provided as well.     *
+ *          Long long is provided if support is available.                    *
+ *                                                                            *
+ *      2.) The computation stops as soon as the GCD is one. Long arrays are  *
+ *          split among threads if OpenMP support is enabled.                 *
+ ******************************************************************************/
+extern unsigned char
+tmpl_UChar_Array_GCD(const unsigned char * const arr, size_t len);
+
+extern unsigned short int
+tmpl_UShort_Array_GCD(const unsigned short int * const arr, size_t len);
+
+extern unsigned int
+tmpl_UInt_Array_GCD(const unsigned int * const arr, size_t len);
+
+extern unsigned long int
+tmpl_ULong_Array_GCD(const unsigned long int * const arr, size_t len);
+
+/*  Long long functions if support is available.                              */
+#if TMPL_HAS_LONGLONG == 1
+
+extern unsigned long long int
+tmpl_ULLong_Array_GCD(const unsigned long long int * const arr, size_t len);
+
+#endif
+/*  End of #if TMPL_HAS_LONGLONG == 1.                                        */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_UInt_Array_LCM                                                   *
+ *  Purpose:                                                                  *
+ *      Computes the least common multiple of the elements of an array.       *
+ *  Arguments:                                                                *
+ *      arr (const unsigned int * const):                                     *
+ *          An array of unsigned ints.                                        *
+ *      len (size_t):                                                         *
+ *          The number of elements in the array.                              *
+ *  Output:                                                                   *
+ *      lcm (unsigned int):                                                   *
+ *          The LCM of the elements of arr. One for NULL or empty arrays.     *
+ *  Notes:                                                                    *
+ *      1.) unsigned char, short, and long versions are provided as well.     *
+ *          Long long is provided if support is available.                    *
+ *                                                                            *
+ *      2.) If the LCM does not fit in the type, zero is returned. The        *
+ *          computation stops as soon as the LCM is zero.                     *
+ ******************************************************************************/
+extern unsigned char
+tmpl_UChar_Array_LCM(const unsigned char * const arr, size_t len);
+
+extern unsigned short int
+tmpl_UShort_Array_LCM(const unsigned short int * const arr, size_t len);
+
+extern unsigned int
+tmpl_UInt_Array_LCM(const unsigned int * const arr, size_t len);
+
+extern unsigned long int
+tmpl_ULong_Array_LCM(const unsigned long int * const arr, size_t len);
+
+/*  Long long functions if support is available.                              */
+#if TMPL_HAS_LONGLONG == 1
+
+extern unsigned long long int
+tmpl_ULLong_Array_LCM(const unsigned long long int * const arr, size_t len);
+
+#endif
+/*  End of #if TMPL_HAS_LONGLONG == 1.                                        */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_UInt_Array_Elementwise_GCD                                       *
+ *  Purpose:                                                                  *
+ *      Computes out[n] = GCD(a[n], b[n]) for each index n.                   *
+ *  Arguments:                                                                *
+ *      a (const unsigned int * const):                                       *
+ *          The first array.                                                  *
+ *      b (const unsigned int * const):                                       *
+ *          The second array.                                                 *
+ *      out (unsigned int * const):                                           *
+ *          The output array. It may be the same as a or b.                   *
+ *      len (size_t):                                                         *
+ *          The number of elements in the arrays.                             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      unsigned char, short, and long versions are provided as well. Long    *
+ *      long is provided if support is available.                             *
+ ******************************************************************************/
+extern void
+tmpl_UChar_Array_Elementwise_GCD(const unsigned char * const a,
+                                 const unsigned char * const b,
+                                 unsigned char * const out,
+                                 size_t len);
+
+extern void
+tmpl_UShort_Array_Elementwise_GCD(const unsigned short int * const a,
+                                  const unsigned short int * const b,
+                                  unsigned short int * const out,
+                                  size_t len);
+
+extern void
+tmpl_UInt_Array_Elementwise_GCD(const unsigned int * const a,
+                                const unsigned int * const b,
+                                unsigned int * const out,
+                                size_t len);
+
+extern void
+tmpl_ULong_Array_Elementwise_GCD(const unsigned long int * const a,
+                                 const unsigned long int * const b,
+                                 unsigned long int * const out,
+                                 size_t len);
+
+/*  Long long functions if support is available.                              */
+#if TMPL_HAS_LONGLONG == 1
+
+extern void
+tmpl_ULLong_Array_Elementwise_GCD(const unsigned long long int * const a,
+                                  const unsigned long long int * const b,
+                                  unsigned long long int * const out,
+                                  size_t len);
+
+#endif
+/*  End of #if TMPL_HAS_LONGLONG == 1.                                        */
+
 /*  TODO:
- *      GCD
  *      RMS
  *      Swap elements
  *      Pop (delete element)
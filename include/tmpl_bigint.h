@@ -0,0 +1,289 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                                tmpl_bigint                                 *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provide arbitrary-precision integers.                                 *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file containing Booleans.                                  *
+ *  2.) tmpl_bigint.h (types):                                                *
+ *          Header file with the tmpl_BigInt typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_BIGINT_H
+#define TMPL_BIGINT_H
+
+/*  If using with C++ (and not C) we need to wrap the entire header file in   *
+ *  an extern "C" statement. Check if C++ is being used with __cplusplus.     */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*  Booleans located here.                                                    */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  tmpl_BigInt typedef provided here.                                        */
+#include <libtmpl/include/types/tmpl_bigint.h>
+
+/*  Products where both factors have at least this many limbs use Karatsuba's *
+ *  method. Below this the O(n^2) schoolbook method is faster.                */
+#ifndef TMPL_BIGINT_KARATSUBA_THRESHOLD
+#define TMPL_BIGINT_KARATSUBA_THRESHOLD (32)
+#endif
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_BigInt_Init                                                      *
+ *  Purpose:                                                                  *
+ *      Initializes a number to zero. This does not allocate memory.          *
+ *  Arguments:                                                                *
+ *      x (tmpl_BigInt *):                                                    *
+ *          The number to be initialized.                                     *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Source Code:                                                              *
+ *      libtmpl/src/bigint/tmpl_init_bigint.c                                 *
+ ******************************************************************************/
+extern void tmpl_BigInt_Init(tmpl_BigInt *x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_BigInt_Destroy                                                   *
+ *  Purpose:                                                                  *
+ *      Frees the memory in a number and resets it to zero.                   *
+ *  Arguments:                                                                *
+ *      x (tmpl_BigInt *):                                                    *
+ *          An initialized number.                                            *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Source Code:                                                              *
+ *      libtmpl/src/bigint/tmpl_destroy_bigint.c                              *
+ ******************************************************************************/
+extern void tmpl_BigInt_Destroy(tmpl_BigInt *x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_BigInt_Set_Long                                                  *
+ *  Purpose:                                                                  *
+ *      Sets a number to the value of a signed long. A similar function is    *
+ *      provided for unsigned long.                                           *
+ *  Arguments:                                                                *
+ *      x (tmpl_BigInt *):                                                    *
+ *          An initialized number.                                            *
+ *      val (signed long int):                                                *
+ *          The new value of x.                                               *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Source Code:                                                              *
+ *      libtmpl/src/bigint/tmpl_set_long_bigint.c                             *
+ ******************************************************************************/
+extern void tmpl_BigInt_Set_Long(tmpl_BigInt *x, signed long int val);
+extern void tmpl_BigInt_Set_ULong(tmpl_BigInt *x, unsigned long int val);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_BigInt_To_Long                                                   *
+ *  Purpose:                                                                  *
+ *      Converts a number to a signed long, if it fits.                       *
+ *  Arguments:                                                                *
+ *      x (const tmpl_BigInt *):                                              *
+ *          A number.                                                         *
+ *      val (signed long int *):                                              *
+ *          The value of x. Not modified if x does not fit.                   *
+ *  Output:                                                                   *
+ *      fits (tmpl_Bool):                                                     *
+ *          True if x is valid and fits in a signed long.                     *
+ *  Source Code:                                                              *
+ *      libtmpl/src/bigint/tmpl_to_long_bigint.c                              *
+ ******************************************************************************/
+extern tmpl_Bool
+tmpl_BigInt_To_Long(const tmpl_BigInt *x, signed long int *val);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_BigInt_To_String                                                 *
+ *  Purpose:                                                                  *
+ *      Converts a number to a string of decimal digits.                      *
+ *  Arguments:                                                                *
+ *      x (const tmpl_BigInt *):                                              *
+ *          A number.                                                         *
+ *  Output:                                                                   *
+ *      str (char *):                                                         *
+ *          The decimal representation of x, with a minus sign if x is        *
+ *          negative. NULL if x is invalid or malloc fails. The caller must   *
+ *          free this.                                                        *
+ *  Source Code:                                                              *
+ *      libtmpl/src/bigint/tmpl_to_string_bigint.c                            *
+ ******************************************************************************/
+extern char *tmpl_BigInt_To_String(const tmpl_BigInt *x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_BigInt_Copy                                                      *
+ *  Purpose:                                                                  *
+ *      Copies one number into another.                                       *
+ *  Arguments:                                                                *
+ *      dest (tmpl_BigInt *):                                                 *
+ *          An initialized number, the copy.                                  *
+ *      src (const tmpl_BigInt *):                                            *
+ *          The number being copied.                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Source Code:                                                              *
+ *      libtmpl/src/bigint/tmpl_copy_bigint.c                                 *
+ ******************************************************************************/
+extern void tmpl_BigInt_Copy(tmpl_BigInt *dest, const tmpl_BigInt *src);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_BigInt_Compare                                                   *
+ *  Purpose:                                                                  *
+ *      Compares two numbers.                                                 *
+ *  Arguments:                                                                *
+ *      x (const tmpl_BigInt *):                                              *
+ *          A number.                                                         *
+ *      y (const tmpl_BigInt *):                                              *
+ *          Another number.                                                   *
+ *  Output:                                                                   *
+ *      cmp (int):                                                            *
+ *          -1 if x < y, 0 if x = y, and 1 if x > y.                          *
+ *  Source Code:                                                              *
+ *      libtmpl/src/bigint/tmpl_compare_bigint.c                              *
+ ******************************************************************************/
+extern int tmpl_BigInt_Compare(const tmpl_BigInt *x, const tmpl_BigInt *y);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_BigInt_Add                                                       *
+ *  Purpose:                                                                  *
+ *      Adds two numbers. A similar function is provided for subtraction.     *
+ *  Arguments:                                                                *
+ *      sum (tmpl_BigInt *):                                                  *
+ *          An initialized number, the sum of x and y.                        *
+ *      x (const tmpl_BigInt *):                                              *
+ *          A number.                                                         *
+ *      y (const tmpl_BigInt *):                                              *
+ *          Another number.                                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      sum may be the same as x or y.                                        *
+ *  Source Code:                                                              *
+ *      libtmpl/src/bigint/tmpl_add_bigint.c                                  *
+ ******************************************************************************/
+extern void
+tmpl_BigInt_Add(tmpl_BigInt *sum, const tmpl_BigInt *x, const tmpl_BigInt *y);
+
+extern void
+tmpl_BigInt_Subtract(tmpl_BigInt *diff,
+                     const tmpl_BigInt *x,
+                     const tmpl_BigInt *y);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_BigInt_Multiply                                                  *
+ *  Purpose:                                                                  *
+ *      Multiplies two numbers using the schoolbook method for small inputs   *
+ *      and Karatsuba's method for large ones.                                *
+ *  Arguments:                                                                *
+ *      prod (tmpl_BigInt *):                                                 *
+ *          An initialized number, the product of x and y.                    *
+ *      x (const tmpl_BigInt *):                                              *
+ *          A number.                                                         *
+ *      y (const tmpl_BigInt *):                                              *
+ *          Another number.                                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      prod may be the same as x or y.                                       *
+ *  Source Code:                                                              *
+ *      libtmpl/src/bigint/tmpl_multiply_bigint.c                             *
+ ******************************************************************************/
+extern void
+tmpl_BigInt_Multiply(tmpl_BigInt *prod,
+                     const tmpl_BigInt *x,
+                     const tmpl_BigInt *y);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_BigInt_DivRem                                                    *
+ *  Purpose:                                                                  *
+ *      Computes the quotient and remainder of two numbers. The quotient is   *
+ *      rounded towards zero and the remainder has the sign of x, as with     *
+ *      the / and % operators of C99.                                         *
+ *  Arguments:                                                                *
+ *      quot (tmpl_BigInt *):                                                 *
+ *          An initialized number, the quotient x / y. May be NULL.           *
+ *      rem (tmpl_BigInt *):                                                  *
+ *          An initialized number, the remainder x mod y. May be NULL.        *
+ *      x (const tmpl_BigInt *):                                              *
+ *          The dividend.                                                     *
+ *      y (const tmpl_BigInt *):                                              *
+ *          The divisor.                                                      *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Division by zero sets the error_occurred Boolean of the outputs.      *
+ *      quot and rem may be the same as x or y, but not each other.           *
+ *  Source Code:                                                              *
+ *      libtmpl/src/bigint/tmpl_divrem_bigint.c                               *
+ ******************************************************************************/
+extern void
+tmpl_BigInt_DivRem(tmpl_BigInt *quot,
+                   tmpl_BigInt *rem,
+                   const tmpl_BigInt *x,
+                   const tmpl_BigInt *y);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_BigInt_GCD                                                       *
+ *  Purpose:                                                                  *
+ *      Computes the greatest common divisor of two numbers using Lehmer's    *
+ *      algorithm.                                                            *
+ *  Arguments:                                                                *
+ *      gcd (tmpl_BigInt *):                                                  *
+ *          An initialized number, the non-negative GCD of x and y.           *
+ *      x (const tmpl_BigInt *):                                              *
+ *          A number.                                                         *
+ *      y (const tmpl_BigInt *):                                              *
+ *          Another number.                                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      gcd may be the same as x or y. GCD(0, 0) = 0.                         *
+ *  Source Code:                                                              *
+ *      libtmpl/src/bigint/tmpl_gcd_bigint.c                                  *
+ ******************************************************************************/
+extern void
+tmpl_BigInt_GCD(tmpl_BigInt *gcd, const tmpl_BigInt *x, const tmpl_BigInt *y);
+
+/*  End of extern "C" statement allowing C++ compatibility.                   */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/*  End of include guard.                                                     */
@@ -83,6 +83,12 @@
 #include <libtmpl/include/types/tmpl_complex_float.h>
 #include <libtmpl/include/types/tmpl_complex_ldouble.h>
 
+/*  With OpenMP support, the array functions split arrays with at least this  *
+ *  many elements across threads.                                             */
+#ifndef TMPL_COMPLEX_ARRAY_PARALLEL_MIN_LENGTH
+#define TMPL_COMPLEX_ARRAY_PARALLEL_MIN_LENGTH ((size_t)4096)
+#endif
+
 #if TMPL_USE_INLINE == 1
 
 #ifdef TMPL_INLINE_FILE
@@ -554,6 +560,40 @@ extern tmpl_ComplexFloat tmpl_CFloat_Cos(tmpl_ComplexFloat z);
 extern tmpl_ComplexDouble tmpl_CDouble_Cos(tmpl_ComplexDouble z);
 extern tmpl_ComplexLongDouble tmpl_CLDouble_Cos(tmpl_ComplexLongDouble z);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CDouble_Cos_Array                                                *
+ *  Purpose:                                                                  *
+ *      Computes w[n] = cos(z[n]) for each n.                                 *
+ *  Arguments:                                                                *
+ *      z (const tmpl_ComplexDouble * const):                                 *
+ *          An array of complex numbers.                                      *
+ *      w (tmpl_ComplexDouble * const):                                       *
+ *          The output array. This may be the same as the input.              *
+ *      len (size_t):                                                         *
+ *          The number of elements.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Equivalent to calling tmpl_CDouble_Cos on each element, without a     *
+ *      call through a function pointer. With OpenMP support, arrays with at  *
+ *      least TMPL_COMPLEX_ARRAY_PARALLEL_MIN_LENGTH elements are split       *
+ *      across threads.                                                       *
+ *  Source Code:                                                              *
+ *      libtmpl/src/complex/                                                  *
+ *          tmpl_complex_cos_array_double.c                                   *
+ *          tmpl_complex_cos_array_float.c                                    *
+ ******************************************************************************/
+extern void
+tmpl_CFloat_Cos_Array(const tmpl_ComplexFloat * const z,
+                      tmpl_ComplexFloat * const w,
+                      size_t len);
+
+extern void
+tmpl_CDouble_Cos_Array(const tmpl_ComplexDouble * const z,
+                       tmpl_ComplexDouble * const w,
+                       size_t len);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      tmpl_CDouble_Cosh                                                     *
@@ -768,6 +808,40 @@ extern tmpl_ComplexFloat tmpl_CFloat_Erf(tmpl_ComplexFloat z);
 extern tmpl_ComplexDouble tmpl_CDouble_Erf(tmpl_ComplexDouble z);
 extern tmpl_ComplexLongDouble tmpl_CLDouble_Erf(tmpl_ComplexLongDouble z);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CDouble_Erf_Array                                                *
+ *  Purpose:                                                                  *
+ *      Computes w[n] = erf(z[n]) for each n.                                 *
+ *  Arguments:                                                                *
+ *      z (const tmpl_ComplexDouble * const):                                 *
+ *          An array of complex numbers.                                      *
+ *      w (tmpl_ComplexDouble * const):                                       *
+ *          The output array. This may be the same as the input.              *
+ *      len (size_t):                                                         *
+ *          The number of elements.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Equivalent to calling tmpl_CDouble_Erf on each element, without a     *
+ *      call through a function pointer. With OpenMP support, arrays with at  *
+ *      least TMPL_COMPLEX_ARRAY_PARALLEL_MIN_LENGTH elements are split       *
+ *      across threads.                                                       *
+ *  Source Code:                                                              *
+ *      libtmpl/src/complex/                                                  *
+ *          tmpl_complex_erf_array_double.c                                   *
+ *          tmpl_complex_erf_array_float.c                                    *
+ ******************************************************************************/
+extern void
+tmpl_CFloat_Erf_Array(const tmpl_ComplexFloat * const z,
+                      tmpl_ComplexFloat * const w,
+                      size_t len);
+
+extern void
+tmpl_CDouble_Erf_Array(const tmpl_ComplexDouble * const z,
+                       tmpl_ComplexDouble * const w,
+                       size_t len);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      tmpl_CDouble_Erfc                                                     *
@@ -811,6 +885,40 @@ extern tmpl_ComplexFloat tmpl_CFloat_Exp(tmpl_ComplexFloat z);
 extern tmpl_ComplexDouble tmpl_CDouble_Exp(tmpl_ComplexDouble z);
 extern tmpl_ComplexLongDouble tmpl_CLDouble_Exp(tmpl_ComplexLongDouble z);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CDouble_Exp_Array                                                *
+ *  Purpose:                                                                  *
+ *      Computes w[n] = exp(z[n]) for each n.                                 *
+ *  Arguments:                                                                *
+ *      z (const tmpl_ComplexDouble * const):                                 *
+ *          An array of complex numbers.                                      *
+ *      w (tmpl_ComplexDouble * const):                                       *
+ *          The output array. This may be the same as the input.              *
+ *      len (size_t):                                                         *
+ *          The number of elements.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Equivalent to calling tmpl_CDouble_Exp on each element, without a     *
+ *      call through a function pointer. With OpenMP support, arrays with at  *
+ *      least TMPL_COMPLEX_ARRAY_PARALLEL_MIN_LENGTH elements are split       *
+ *      across threads.                                                       *
+ *  Source Code:                                                              *
+ *      libtmpl/src/complex/                                                  *
+ *          tmpl_complex_exp_array_double.c                                   *
+ *          tmpl_complex_exp_array_float.c                                    *
+ ******************************************************************************/
+extern void
+tmpl_CFloat_Exp_Array(const tmpl_ComplexFloat * const z,
+                      tmpl_ComplexFloat * const w,
+                      size_t len);
+
+extern void
+tmpl_CDouble_Exp_Array(const tmpl_ComplexDouble * const z,
+                       tmpl_ComplexDouble * const w,
+                       size_t len);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      tmpl_CDouble_Expi                                                     *
@@ -837,6 +945,40 @@ extern tmpl_ComplexLongDouble tmpl_CLDouble_Expi(long double t);
 
 #endif
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CDouble_Expi_Array                                               *
+ *  Purpose:                                                                  *
+ *      Computes w[n] = exp(i theta[n]) for each n.                           *
+ *  Arguments:                                                                *
+ *      theta (const double * const):                                         *
+ *          An array of angles.                                               *
+ *      w (tmpl_ComplexDouble * const):                                       *
+ *          The output array. This may be the same as the input.              *
+ *      len (size_t):                                                         *
+ *          The number of elements.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Equivalent to calling tmpl_CDouble_Expi on each element, without a    *
+ *      call through a function pointer. With OpenMP support, arrays with at  *
+ *      least TMPL_COMPLEX_ARRAY_PARALLEL_MIN_LENGTH elements are split       *
+ *      across threads.                                                       *
+ *  Source Code:                                                              *
+ *      libtmpl/src/complex/                                                  *
+ *          tmpl_complex_expi_array_double.c                                  *
+ *          tmpl_complex_expi_array_float.c                                   *
+ ******************************************************************************/
+extern void
+tmpl_CFloat_Expi_Array(const float * const theta,
+                       tmpl_ComplexFloat * const w,
+                       size_t len);
+
+extern void
+tmpl_CDouble_Expi_Array(const double * const theta,
+                        tmpl_ComplexDouble * const w,
+                        size_t len);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      tmpl_CDouble_Expid                                                    *
@@ -985,6 +1127,40 @@ extern tmpl_ComplexFloat tmpl_CFloat_Log(tmpl_ComplexFloat z);
 extern tmpl_ComplexDouble tmpl_CDouble_Log(tmpl_ComplexDouble z);
 extern tmpl_ComplexLongDouble tmpl_CLDouble_Log(tmpl_ComplexLongDouble z);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CDouble_Log_Array                                                *
+ *  Purpose:                                                                  *
+ *      Computes w[n] = log(z[n]) for each n.                                 *
+ *  Arguments:                                                                *
+ *      z (const tmpl_ComplexDouble * const):                                 *
+ *          An array of complex numbers.                                      *
+ *      w (tmpl_ComplexDouble * const):                                       *
+ *          The output array. This may be the same as the input.              *
+ *      len (size_t):                                                         *
+ *          The number of elements.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Equivalent to calling tmpl_CDouble_Log on each element, without a     *
+ *      call through a function pointer. With OpenMP support, arrays with at  *
+ *      least TMPL_COMPLEX_ARRAY_PARALLEL_MIN_LENGTH elements are split       *
+ *      across threads.                                                       *
+ *  Source Code:                                                              *
+ *      libtmpl/src/complex/                                                  *
+ *          tmpl_complex_log_array_double.c                                   *
+ *          tmpl_complex_log_array_float.c                                    *
+ ******************************************************************************/
+extern void
+tmpl_CFloat_Log_Array(const tmpl_ComplexFloat * const z,
+                      tmpl_ComplexFloat * const w,
+                      size_t len);
+
+extern void
+tmpl_CDouble_Log_Array(const tmpl_ComplexDouble * const z,
+                       tmpl_ComplexDouble * const w,
+                       size_t len);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      tmpl_CDouble_Log_Abs                                                  *
@@ -1559,6 +1735,44 @@ tmpl_CDouble_Pow(tmpl_ComplexDouble z0, tmpl_ComplexDouble z1);
 extern tmpl_ComplexLongDouble
 tmpl_CLDouble_Pow(tmpl_ComplexLongDouble z0, tmpl_ComplexLongDouble z1);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CDouble_Pow_Array                                                *
+ *  Purpose:                                                                  *
+ *      Computes w[n] = z[n]^p for each n.                                    *
+ *  Arguments:                                                                *
+ *      z (const tmpl_ComplexDouble * const):                                 *
+ *          An array of complex numbers.                                      *
+ *      p (tmpl_ComplexDouble):                                               *
+ *          The power, the same for every element.                            *
+ *      w (tmpl_ComplexDouble * const):                                       *
+ *          The output array. This may be the same as the input.              *
+ *      len (size_t):                                                         *
+ *          The number of elements.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Equivalent to calling tmpl_CDouble_Pow on each element, without a     *
+ *      call through a function pointer. With OpenMP support, arrays with at  *
+ *      least TMPL_COMPLEX_ARRAY_PARALLEL_MIN_LENGTH elements are split       *
+ *      across threads.                                                       *
+ *  Source Code:                                                              *
+ *      libtmpl/src/complex/                                                  *
+ *          tmpl_complex_pow_array_double.c                                   *
+ *          tmpl_complex_pow_array_float.c                                    *
+ ******************************************************************************/
+extern void
+tmpl_CFloat_Pow_Array(const tmpl_ComplexFloat * const z,
+                      tmpl_ComplexFloat p,
+                      tmpl_ComplexFloat * const w,
+                      size_t len);
+
+extern void
+tmpl_CDouble_Pow_Array(const tmpl_ComplexDouble * const z,
+                       tmpl_ComplexDouble p,
+                       tmpl_ComplexDouble * const w,
+                       size_t len);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      tmpl_CDouble_Pow_Real                                                 *
@@ -1799,6 +2013,43 @@ extern tmpl_ComplexFloat tmpl_CFloat_Sin(tmpl_ComplexFloat z);
 extern tmpl_ComplexDouble tmpl_CDouble_Sin(tmpl_ComplexDouble z);
 extern tmpl_ComplexLongDouble tmpl_CLDouble_Sin(tmpl_ComplexLongDouble z);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CDouble_Sin_Array                                                *
+ *  Purpose:                                                                  *
+ *      Computes w[n] = sin(z[n]) for each n.                                 *
+ *  Arguments:                                                                *
+ *      z (const tmpl_ComplexDouble * const):                                 *
+ *          An array of complex numbers.                                      *
+ *      w (tmpl_ComplexDouble * const):                                       *
+ *          The output array. This may be the same as the input.              *
+ *      len (size_t):                                                         *
+ *          The number of elements.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Equivalent to calling tmpl_CDouble_Sin on each element, without a     *
+ *      call through a function pointer. With OpenMP support, arrays with at  *
+ *      least TMPL_COMPLEX_ARRAY_PARALLEL_MIN_LENGTH elements are split       *
+ *      across threads.                                                       *
+ *                                                                            *
+ *      The sine and cosine of the real part, and the hyperbolic sine and     *
+ *      cosine of the imaginary part, are each computed with one call.        *
+ *  Source Code:                                                              *
+ *      libtmpl/src/complex/                                                  *
+ *          tmpl_complex_sin_array_double.c                                   *
+ *          tmpl_complex_sin_array_float.c                                    *
+ ******************************************************************************/
+extern void
+tmpl_CFloat_Sin_Array(const tmpl_ComplexFloat * const z,
+                      tmpl_ComplexFloat * const w,
+                      size_t len);
+
+extern void
+tmpl_CDouble_Sin_Array(const tmpl_ComplexDouble * const z,
+                       tmpl_ComplexDouble * const w,
+                       size_t len);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      tmpl_CDouble_Sinh                                                     *
@@ -1840,6 +2091,42 @@ extern tmpl_ComplexFloat tmpl_CFloat_Sqrt(tmpl_ComplexFloat z);
 extern tmpl_ComplexDouble tmpl_CDouble_Sqrt(tmpl_ComplexDouble z);
 extern tmpl_ComplexLongDouble tmpl_CLDouble_Sqrt(tmpl_ComplexLongDouble z);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CDouble_Sqrt_Array                                               *
+ *  Purpose:                                                                  *
+ *      Computes w[n] = sqrt(z[n]) for each n.                                *
+ *  Arguments:                                                                *
+ *      z (const tmpl_ComplexDouble * const):                                 *
+ *          An array of complex numbers.                                      *
+ *      w (tmpl_ComplexDouble * const):                                       *
+ *          The output array. This may be the same as the input.              *
+ *      len (size_t):                                                         *
+ *          The number of elements.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The value is that of tmpl_CDouble_Sqrt, with the same branch cut,     *
+ *      but is computed with the half-angle formulas. This needs only a       *
+ *      hypotenuse and a real square root, and not a trig function. With      *
+ *      OpenMP support, arrays with at least                                  *
+ *      TMPL_COMPLEX_ARRAY_PARALLEL_MIN_LENGTH elements are split across      *
+ *      threads.                                                              *
+ *  Source Code:                                                              *
+ *      libtmpl/src/complex/                                                  *
+ *          tmpl_complex_sqrt_array_double.c                                  *
+ *          tmpl_complex_sqrt_array_float.c                                   *
+ ******************************************************************************/
+extern void
+tmpl_CFloat_Sqrt_Array(const tmpl_ComplexFloat * const z,
+                       tmpl_ComplexFloat * const w,
+                       size_t len);
+
+extern void
+tmpl_CDouble_Sqrt_Array(const tmpl_ComplexDouble * const z,
+                        tmpl_ComplexDouble * const w,
+                        size_t len);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      tmpl_CDouble_Sqrt_Real                                                *
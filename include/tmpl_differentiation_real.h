@@ -23,7 +23,10 @@
  ******************************************************************************
  *                                DEPENDENCIES                                *
  ******************************************************************************
- *  None.                                                                     *
+ *  1.) tmpl_dual_double.h:                                                   *
+ *          Header file with the tmpl_DualDouble typedef.                     *
+ *  2.) stddef.h:                                                             *
+ *          Standard library header file with the size_t typedef.             *
  ******************************************************************************
  *  Author:     Ryan Maguire                                                  *
  *  Date:       April 08, 2021                                                *
@@ -33,12 +36,34 @@
  *  2024/01/19: Ryan Maguire                                                  *
  *      Changed name from "numerical" to "differentiation_real". Moved        *
  *      complex-valued functions to their own folder.                         *
+ *  2026/10/18: Ryan Maguire                                                  *
+ *      Added derivatives computed with dual numbers.                         *
+ *  2026/10/18: Ryan Maguire                                                  *
+ *      Added derivatives of sampled data, with finite difference stencils    *
+ *      of any order and with Savitzky-Golay filters.                         *
  ******************************************************************************/
 
 /*  Include guard for this file to prevent including this twice.              */
 #ifndef TMPL_DIFFERENTIATION_REAL_H
 #define TMPL_DIFFERENTIATION_REAL_H
 
+/*  Dual number typedef provided here.                                        */
+#include <libtmpl/include/types/tmpl_dual_double.h>
+
+/*  size_t typedef given here.                                                */
+#include <stddef.h>
+
+/*  Largest stencil used by the array derivatives. The weights for a stencil  *
+ *  are computed on the stack, so this bounds deriv + order.                  */
+#define TMPL_ARRAY_DERIVATIVE_MAX_POINTS (16)
+
+/*  Largest window half-width and polynomial degree for Savitzky-Golay.       */
+#define TMPL_SAVITZKY_GOLAY_MAX_HALF_WIDTH (64)
+#define TMPL_SAVITZKY_GOLAY_MAX_DEGREE (10)
+
+/*  Array derivatives with at least this many samples use OpenMP.             */
+#define TMPL_DIFFERENTIATION_REAL_PARALLEL_MIN_LENGTH ((size_t)65536)
+
 /*  If using with C++ (and not C), wrap the entire header file in an extern   *
  *  "C" statement. Check if C++ is being used with __cplusplus.               */
 #ifdef __cplusplus
@@ -323,6 +348,174 @@ extern long double
 tmpl_LDouble_Symmetric_Second_Derivative(long double (*f)(long double),
                                          long double x, long double h);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Double_Dual_Derivative                                           *
+ *  Purpose:                                                                  *
+ *      Computes derivatives exactly using dual numbers.                      *
+ *  Arguments:                                                                *
+ *      f (function):                                                         *
+ *          A function that takes in and returns a tmpl_DualDouble, written   *
+ *          with the routines from tmpl_dual.h.                               *
+ *      x (double):                                                           *
+ *          The point where the derivative is to be computed.                 *
+ *  Output:                                                                   *
+ *      f_prime (double):                                                     *
+ *          The derivative f'(x).                                             *
+ *  Notes:                                                                    *
+ *      1.)                                                                   *
+ *          Evaluates f(x + e) = f(x) + f'(x) e with e^2 = 0. There is no     *
+ *          step size, and the result is exact up to rounding. The stencil    *
+ *          methods lose about half of the significant digits.                *
+ *      2.)                                                                   *
+ *          f is called once, and costs about twice as much as the real       *
+ *          version of f. The stencil methods need two to four calls.         *
+ *  Source:                                                                   *
+ *      libtmpl/src/differention_real/                                        *
+ *          tmpl_dual_derivative_double.c                                     *
+ ******************************************************************************/
+extern double
+tmpl_Double_Dual_Derivative(tmpl_DualDouble (*f)(tmpl_DualDouble), double x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Double_Array_Derivative                                          *
+ *  Purpose:                                                                  *
+ *      Computes derivatives of data sampled on a uniform grid.               *
+ *  Arguments:                                                                *
+ *      y (const double * const):                                             *
+ *          The samples y[n] = f(x_0 + n h).                                  *
+ *      dy (double * const):                                                  *
+ *          The output array. It must have len elements and not overlap y.    *
+ *      len (size_t):                                                         *
+ *          The number of samples.                                            *
+ *      h (double):                                                           *
+ *          The grid spacing.                                                 *
+ *      deriv (unsigned int):                                                 *
+ *          The order of the derivative, at least one.                        *
+ *      order (unsigned int):                                                 *
+ *          The order of accuracy. This must be even and positive.            *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      1.)                                                                   *
+ *          The interior uses centered stencils, and the points near the ends *
+ *          use one-sided stencils with the same order of accuracy. The       *
+ *          error is O(h^order) everywhere.                                   *
+ *      2.)                                                                   *
+ *          The stencils have deriv + order points, at most                   *
+ *          TMPL_ARRAY_DERIVATIVE_MAX_POINTS. If the parameters are invalid,  *
+ *          or len is smaller than the stencil, dy is set to NaN.             *
+ *      3.)                                                                   *
+ *          If y or dy is NULL, nothing is done.                              *
+ *  Source:                                                                   *
+ *      libtmpl/src/differention_real/                                        *
+ *          tmpl_array_derivative_double.c                                    *
+ ******************************************************************************/
+extern void
+tmpl_Double_Array_Derivative(const double * const y,
+                             double * const dy,
+                             size_t len,
+                             double h,
+                             unsigned int deriv,
+                             unsigned int order);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Double_Array_Derivative_Nonuniform                               *
+ *  Purpose:                                                                  *
+ *      Computes derivatives of data sampled on a non-uniform grid.           *
+ *  Arguments:                                                                *
+ *      x (const double * const):                                             *
+ *          The grid points. They must be strictly increasing.                *
+ *      y (const double * const):                                             *
+ *          The samples y[n] = f(x[n]).                                       *
+ *      dy (double * const):                                                  *
+ *          The output array. It must have len elements and not overlap y.    *
+ *      len (size_t):                                                         *
+ *          The number of samples.                                            *
+ *      deriv (unsigned int):                                                 *
+ *          The order of the derivative, at least one.                        *
+ *      order (unsigned int):                                                 *
+ *          The order of accuracy, at least one.                              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      1.)                                                                   *
+ *          Each point uses the deriv + order nearest grid points, centered   *
+ *          where possible. The weights are computed for every point, so this *
+ *          is slower than the uniform version.                               *
+ *      2.)                                                                   *
+ *          The common case of deriv = 1 and order = 2 uses a closed form for *
+ *          the three point stencil in the interior.                          *
+ *      3.)                                                                   *
+ *          Invalid parameters, or too few samples, set dy to NaN. If x, y,   *
+ *          or dy is NULL, nothing is done.                                   *
+ *  Source:                                                                   *
+ *      libtmpl/src/differention_real/                                        *
+ *          tmpl_array_derivative_nonuniform_double.c                         *
+ ******************************************************************************/
+extern void
+tmpl_Double_Array_Derivative_Nonuniform(const double * const x,
+                                        const double * const y,
+                                        double * const dy,
+                                        size_t len,
+                                        unsigned int deriv,
+                                        unsigned int order);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Double_Array_Savitzky_Golay_Derivative                           *
+ *  Purpose:                                                                  *
+ *      Smooths or differentiates noisy uniformly sampled data.               *
+ *  Arguments:                                                                *
+ *      y (const double * const):                                             *
+ *          The samples y[n] = f(x_0 + n h).                                  *
+ *      out (double * const):                                                 *
+ *          The output array. It must have len elements and not overlap y.    *
+ *      len (size_t):                                                         *
+ *          The number of samples.                                            *
+ *      h (double):                                                           *
+ *          The grid spacing. It is not used if deriv is zero.                *
+ *      half_width (size_t):                                                  *
+ *          The window has 2 half_width + 1 points.                           *
+ *      degree (unsigned int):                                                *
+ *          The degree of the fitted polynomial, less than 2 half_width + 1.  *
+ *      deriv (unsigned int):                                                 *
+ *          The order of the derivative, at most degree. Zero smooths y.      *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      1.)                                                                   *
+ *          A polynomial is fitted by least squares to each window, and its   *
+ *          derivative is evaluated at the center. In the interior this is a  *
+ *          convolution with fixed weights.                                   *
+ *      2.)                                                                   *
+ *          The first and last half_width points use the fits over the first  *
+ *          and last windows, evaluated at the point itself. There is no      *
+ *          padding of the data.                                              *
+ *      3.)                                                                   *
+ *          half_width and degree are bounded by                              *
+ *          TMPL_SAVITZKY_GOLAY_MAX_HALF_WIDTH and                            *
+ *          TMPL_SAVITZKY_GOLAY_MAX_DEGREE. Invalid parameters, or too few    *
+ *          samples, set out to NaN. If y or out is NULL, nothing is done.    *
+ *  References:                                                               *
+ *      1.) Savitzky, A., Golay, M. (1964)                                    *
+ *          "Smoothing and Differentiation of Data by Simplified Least        *
+ *           Squares Procedures", Analytical Chemistry, Vol. 36, No. 8.       *
+ *  Source:                                                                   *
+ *      libtmpl/src/differention_real/                                        *
+ *          tmpl_array_savitzky_golay_double.c                                *
+ ******************************************************************************/
+extern void
+tmpl_Double_Array_Savitzky_Golay_Derivative(const double * const y,
+                                            double * const out,
+                                            size_t len,
+                                            double h,
+                                            size_t half_width,
+                                            unsigned int degree,
+                                            unsigned int deriv);
+
 /*  End of extern "C" statement allowing C++ compatibility.                   */
 #ifdef __cplusplus
 }
@@ -29,9 +29,18 @@
  *          Contains the double-double typedef.                               *
  *  3.) tmpl_doubledouble_ldouble.h:                                          *
  *          Contains the long-double-double typedef.                          *
+ *  4.) stddef.h:                                                             *
+ *          Standard library header with the size_t typedef.                  *
  ******************************************************************************
  *  Author:     Ryan Maguire                                                  *
  *  Date:       March 27, 2024                                                *
+ ******************************************************************************
+ *                              Revision History                              *
+ ******************************************************************************
+ *  2026/10/18: Ryan Maguire                                                  *
+ *      Added division, square roots, and elementary functions.               *
+ *  2026/10/18: Ryan Maguire                                                  *
+ *      Added compensated array kernels (Dot2, Horner, and axpy).             *
  ******************************************************************************/
 
 /*  Include guard to prevent including this file twice.                       */
@@ -45,6 +54,9 @@
 #include <libtmpl/include/types/tmpl_doubledouble_double.h>
 #include <libtmpl/include/types/tmpl_doubledouble_ldouble.h>
 
+/*  size_t typedef is here.                                                   */
+#include <stddef.h>
+
 /*  If using with C++ (and not C), wrap the entire header file in an extern   *
  *  "C" statement. Check if C++ is being used with __cplusplus.               */
 #ifdef __cplusplus
@@ -195,6 +207,261 @@ tmpl_LDoubleDouble_Multiply_Scalar(const long double x,
                                    const tmpl_LongDoubleDouble * const y)
 TMPL_UNSEQUENCED;
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DoubleDouble_Divide                                              *
+ *  Purpose:                                                                  *
+ *      Performs the quotient of two double-doubles.                          *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DoubleDouble * const):                                  *
+ *          A double-double, the numerator.                                   *
+ *      y (const tmpl_DoubleDouble * const):                                  *
+ *          Another double-double, the denominator.                           *
+ *  Output:                                                                   *
+ *      quot (tmpl_DoubleDouble):                                             *
+ *          The double-double quotient x / y.                                 *
+ *  Notes:                                                                    *
+ *      1.) long double-double version is also provided.                      *
+ ******************************************************************************/
+TMPL_PURE_FUNC
+extern tmpl_DoubleDouble
+tmpl_DoubleDouble_Divide(const tmpl_DoubleDouble * const x,
+                         const tmpl_DoubleDouble * const y)
+TMPL_UNSEQUENCED;
+
+TMPL_PURE_FUNC
+extern tmpl_LongDoubleDouble
+tmpl_LDoubleDouble_Divide(const tmpl_LongDoubleDouble * const x,
+                          const tmpl_LongDoubleDouble * const y)
+TMPL_UNSEQUENCED;
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DoubleDouble_Sqrt                                                *
+ *  Purpose:                                                                  *
+ *      Computes the square root of a double-double.                          *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DoubleDouble * const):                                  *
+ *          A double-double.                                                  *
+ *  Output:                                                                   *
+ *      sqrt_x (tmpl_DoubleDouble):                                           *
+ *          The double-double square root of x.                               *
+ *  Notes:                                                                    *
+ *      1.) Negative inputs return NaN.                                       *
+ *                                                                            *
+ *      2.) long double-double version is also provided.                      *
+ ******************************************************************************/
+TMPL_PURE_FUNC
+extern tmpl_DoubleDouble
+tmpl_DoubleDouble_Sqrt(const tmpl_DoubleDouble * const x)
+TMPL_UNSEQUENCED;
+
+TMPL_PURE_FUNC
+extern tmpl_LongDoubleDouble
+tmpl_LDoubleDouble_Sqrt(const tmpl_LongDoubleDouble * const x)
+TMPL_UNSEQUENCED;
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DoubleDouble_Exp                                                 *
+ *  Purpose:                                                                  *
+ *      Computes the exponential of a double-double.                          *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DoubleDouble * const):                                  *
+ *          A double-double.                                                  *
+ *  Output:                                                                   *
+ *      exp_x (tmpl_DoubleDouble):                                            *
+ *          The double-double exponential of x.                               *
+ *  Notes:                                                                    *
+ *      1.) Only the double-double version is provided. The elementary        *
+ *          functions need constants and series tailored to the precision.    *
+ ******************************************************************************/
+TMPL_PURE_FUNC
+extern tmpl_DoubleDouble
+tmpl_DoubleDouble_Exp(const tmpl_DoubleDouble * const x)
+TMPL_UNSEQUENCED;
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DoubleDouble_Log                                                 *
+ *  Purpose:                                                                  *
+ *      Computes the natural logarithm of a double-double.                    *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DoubleDouble * const):                                  *
+ *          A double-double.                                                  *
+ *  Output:                                                                   *
+ *      log_x (tmpl_DoubleDouble):                                            *
+ *          The double-double natural logarithm of x.                         *
+ *  Notes:                                                                    *
+ *      1.) Negative inputs return NaN, and zero returns -infinity.           *
+ ******************************************************************************/
+TMPL_PURE_FUNC
+extern tmpl_DoubleDouble
+tmpl_DoubleDouble_Log(const tmpl_DoubleDouble * const x)
+TMPL_UNSEQUENCED;
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DoubleDouble_Sin                                                 *
+ *  Purpose:                                                                  *
+ *      Computes the sine of a double-double.                                 *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DoubleDouble * const):                                  *
+ *          A double-double.                                                  *
+ *  Output:                                                                   *
+ *      sin_x (tmpl_DoubleDouble):                                            *
+ *          The double-double sine of x.                                      *
+ *  Notes:                                                                    *
+ *      1.) Accurate for all finite x. See tmpl_DoubleDouble_SinCos for       *
+ *          details.                                                          *
+ ******************************************************************************/
+TMPL_PURE_FUNC
+extern tmpl_DoubleDouble
+tmpl_DoubleDouble_Sin(const tmpl_DoubleDouble * const x)
+TMPL_UNSEQUENCED;
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DoubleDouble_Cos                                                 *
+ *  Purpose:                                                                  *
+ *      Computes the cosine of a double-double.                               *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DoubleDouble * const):                                  *
+ *          A double-double.                                                  *
+ *  Output:                                                                   *
+ *      cos_x (tmpl_DoubleDouble):                                            *
+ *          The double-double cosine of x.                                    *
+ *  Notes:                                                                    *
+ *      1.) Accurate for all finite x. See tmpl_DoubleDouble_SinCos for       *
+ *          details.                                                          *
+ ******************************************************************************/
+TMPL_PURE_FUNC
+extern tmpl_DoubleDouble
+tmpl_DoubleDouble_Cos(const tmpl_DoubleDouble * const x)
+TMPL_UNSEQUENCED;
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DoubleDouble_SinCos                                              *
+ *  Purpose:                                                                  *
+ *      Computes sine and cosine of a double-double simultaneously.           *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DoubleDouble * const):                                  *
+ *          A double-double.                                                  *
+ *      sin_x (tmpl_DoubleDouble * const):                                    *
+ *          The sine of x is stored here.                                     *
+ *      cos_x (tmpl_DoubleDouble * const):                                    *
+ *          The cosine of x is stored here.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      1.) For |x| < 2^30 the argument is reduced with pi / 2 stored to      *
+ *          about 160 bits. For |x| >= 2^30 the high and low words are        *
+ *          each reduced with Payne-Hanek reduction, using the bits of        *
+ *          2 / pi, so the reduced argument is accurate well past             *
+ *          double-double precision. The outputs have an absolute error of    *
+ *          a few units of 2^-106 for all finite x.                           *
+ *                                                                            *
+ *      2.) Infinity and NaN give NaN for both outputs.                       *
+ ******************************************************************************/
+extern void
+tmpl_DoubleDouble_SinCos(const tmpl_DoubleDouble * const x,
+                         tmpl_DoubleDouble * const sin_x,
+                         tmpl_DoubleDouble * const cos_x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Double_Dot2_Array                                                *
+ *  Purpose:                                                                  *
+ *      Computes the dot product of two arrays in twice the working precision *
+ *      using the compensated Dot2 algorithm of Ogita, Rump, and Oishi.       *
+ *  Arguments:                                                                *
+ *      x (const double * const):                                             *
+ *          An array of real numbers.                                         *
+ *      y (const double * const):                                             *
+ *          Another array of real numbers.                                    *
+ *      len (size_t):                                                         *
+ *          The number of elements in x and y.                                *
+ *  Output:                                                                   *
+ *      dot (tmpl_DoubleDouble):                                              *
+ *          The dot product of x and y.                                       *
+ *  Notes:                                                                    *
+ *      1.) The relative error is about u + cond * u^2, u = 2^-53, where cond *
+ *          is the condition number of the dot product.                       *
+ *                                                                            *
+ *      2.) NULL arrays are treated as empty, and zero is returned.           *
+ ******************************************************************************/
+extern tmpl_DoubleDouble
+tmpl_Double_Dot2_Array(const double * const x,
+                       const double * const y,
+                       size_t len);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Double_Poly_Eval_Compensated_Array                               *
+ *  Purpose:                                                                  *
+ *      Evaluates a polynomial at every element of an array using the         *
+ *      compensated Horner scheme of Graillat, Langlois, and Louvet.          *
+ *  Arguments:                                                                *
+ *      coeffs (const double * const):                                        *
+ *          The coefficients array for the polynomial, constant term first.   *
+ *      degree (size_t):                                                      *
+ *          The degree of the polynomial.                                     *
+ *      x (const double * const):                                             *
+ *          The points where the polynomial is evaluated.                     *
+ *      y (double * const):                                                   *
+ *          The values of the polynomial at the points x.                     *
+ *      len (size_t):                                                         *
+ *          The number of elements in x and y.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      1.) The result is as accurate as Horner's method done in twice the    *
+ *          working precision, and then rounded to double.                    *
+ *                                                                            *
+ *      2.) y may be the same array as x.                                     *
+ ******************************************************************************/
+extern void
+tmpl_Double_Poly_Eval_Compensated_Array(const double * const coeffs,
+                                        size_t degree,
+                                        const double * const x,
+                                        double * const y,
+                                        size_t len);
+
+/*  With OpenMP support, double-double array routines split arrays with at    *
+ *  least this many elements across threads.                                  */
+#ifndef TMPL_DOUBLEDOUBLE_PARALLEL_MIN_LENGTH
+#define TMPL_DOUBLEDOUBLE_PARALLEL_MIN_LENGTH ((size_t)16384)
+#endif
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DoubleDouble_Axpy_Array                                          *
+ *  Purpose:                                                                  *
+ *      Computes y = a x + y for arrays of double-doubles.                    *
+ *  Arguments:                                                                *
+ *      a (const tmpl_DoubleDouble * const):                                  *
+ *          The scale factor.                                                 *
+ *      x (const tmpl_DoubleDouble * const):                                  *
+ *          An array of double-doubles.                                       *
+ *      y (tmpl_DoubleDouble * const):                                        *
+ *          Another array of double-doubles, overwritten with the result.     *
+ *      len (size_t):                                                         *
+ *          The number of elements in x and y.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      1.) The error bound is that of tmpl_DoubleDouble_Multiply followed    *
+ *          by tmpl_DoubleDouble_Add.                                         *
+ *                                                                            *
+ *      2.) x may be the same array as y.                                     *
+ ******************************************************************************/
+extern void
+tmpl_DoubleDouble_Axpy_Array(const tmpl_DoubleDouble * const a,
+                             const tmpl_DoubleDouble * const x,
+                             tmpl_DoubleDouble * const y,
+                             size_t len);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      tmpl_DoubleDouble_Create                                              *
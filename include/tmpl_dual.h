@@ -0,0 +1,538 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                                 tmpl_dual                                  *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides dual numbers a + b e, with e^2 = 0, for forward-mode         *
+ *      automatic differentiation. If f is built from the functions here,     *
+ *      then f(x + e) = f(x) + f'(x) e. The derivative is exact up to         *
+ *      rounding, unlike finite differences, and costs about as much as       *
+ *      one more evaluation of f.                                             *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file with the TMPL_USE_INLINE macro.                       *
+ *  2.) tmpl_dual_double.h:                                                   *
+ *          Header file with the tmpl_DualDouble typedef.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_DUAL_H
+#define TMPL_DUAL_H
+
+/*  The macro TMPL_USE_INLINE is found here.                                  */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Dual number typedef provided here.                                        */
+#include <libtmpl/include/types/tmpl_dual_double.h>
+
+#if TMPL_USE_INLINE == 1
+
+#ifdef TMPL_INLINE_FILE
+#undef TMPL_INLINE_FILE
+#endif
+
+#define TMPL_INLINE_FILE(file) <libtmpl/include/inline/dual/file>
+
+#endif
+
+/*  If using with C++ (and not C) we need to wrap the entire header file in   *
+ *  an extern "C" statement. Check if C++ is being used with __cplusplus.     */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Create                                                *
+ *  Purpose:                                                                  *
+ *      Creates a dual number from its real and dual parts.                   *
+ *  Arguments:                                                                *
+ *      a (double):                                                           *
+ *          The real part.                                                    *
+ *      b (double):                                                           *
+ *          The dual part.                                                    *
+ *  Output:                                                                   *
+ *      x (tmpl_DualDouble):                                                  *
+ *          The dual number a + b e.                                          *
+ *  Source Code:                                                              *
+ *      libtmpl/include/inline/dual/                                          *
+ *          tmpl_dual_create_double.h                                         *
+ ******************************************************************************/
+#if TMPL_USE_INLINE == 1
+
+#include TMPL_INLINE_FILE(tmpl_dual_create_double.h)
+
+#else
+
+extern tmpl_DualDouble
+tmpl_DualDouble_Create(double a, double b);
+
+#endif
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Add                                                   *
+ *  Purpose:                                                                  *
+ *      Adds two dual numbers.                                                *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *      y (const tmpl_DualDouble):                                            *
+ *          Another dual number.                                              *
+ *  Output:                                                                   *
+ *      sum (tmpl_DualDouble):                                                *
+ *          The sum of x and y.                                               *
+ *  Source Code:                                                              *
+ *      libtmpl/include/inline/dual/                                          *
+ *          tmpl_dual_add_double.h                                            *
+ ******************************************************************************/
+#if TMPL_USE_INLINE == 1
+
+#include TMPL_INLINE_FILE(tmpl_dual_add_double.h)
+
+#else
+
+extern tmpl_DualDouble
+tmpl_DualDouble_Add(const tmpl_DualDouble x, const tmpl_DualDouble y);
+
+#endif
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Subtract                                              *
+ *  Purpose:                                                                  *
+ *      Subtracts two dual numbers.                                           *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *      y (const tmpl_DualDouble):                                            *
+ *          Another dual number.                                              *
+ *  Output:                                                                   *
+ *      diff (tmpl_DualDouble):                                               *
+ *          The difference x - y.                                             *
+ *  Source Code:                                                              *
+ *      libtmpl/include/inline/dual/                                          *
+ *          tmpl_dual_subtract_double.h                                       *
+ ******************************************************************************/
+#if TMPL_USE_INLINE == 1
+
+#include TMPL_INLINE_FILE(tmpl_dual_subtract_double.h)
+
+#else
+
+extern tmpl_DualDouble
+tmpl_DualDouble_Subtract(const tmpl_DualDouble x, const tmpl_DualDouble y);
+
+#endif
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Multiply                                              *
+ *  Purpose:                                                                  *
+ *      Multiplies two dual numbers.                                          *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *      y (const tmpl_DualDouble):                                            *
+ *          Another dual number.                                              *
+ *  Output:                                                                   *
+ *      prod (tmpl_DualDouble):                                               *
+ *          The product x y.                                                  *
+ *  Source Code:                                                              *
+ *      libtmpl/include/inline/dual/                                          *
+ *          tmpl_dual_multiply_double.h                                       *
+ ******************************************************************************/
+#if TMPL_USE_INLINE == 1
+
+#include TMPL_INLINE_FILE(tmpl_dual_multiply_double.h)
+
+#else
+
+extern tmpl_DualDouble
+tmpl_DualDouble_Multiply(const tmpl_DualDouble x, const tmpl_DualDouble y);
+
+#endif
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Divide                                                *
+ *  Purpose:                                                                  *
+ *      Divides two dual numbers.                                             *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *      y (const tmpl_DualDouble):                                            *
+ *          Another dual number.                                              *
+ *  Output:                                                                   *
+ *      quot (tmpl_DualDouble):                                               *
+ *          The quotient x / y.                                               *
+ *  Source Code:                                                              *
+ *      libtmpl/include/inline/dual/                                          *
+ *          tmpl_dual_divide_double.h                                         *
+ ******************************************************************************/
+#if TMPL_USE_INLINE == 1
+
+#include TMPL_INLINE_FILE(tmpl_dual_divide_double.h)
+
+#else
+
+extern tmpl_DualDouble
+tmpl_DualDouble_Divide(const tmpl_DualDouble x, const tmpl_DualDouble y);
+
+#endif
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Add_Real                                              *
+ *  Purpose:                                                                  *
+ *      Adds a real number to a dual number.                                  *
+ *  Arguments:                                                                *
+ *      r (double):                                                           *
+ *          A real number.                                                    *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      sum (tmpl_DualDouble):                                                *
+ *          The sum r + x.                                                    *
+ *  Source Code:                                                              *
+ *      libtmpl/include/inline/dual/                                          *
+ *          tmpl_dual_add_real_double.h                                       *
+ ******************************************************************************/
+#if TMPL_USE_INLINE == 1
+
+#include TMPL_INLINE_FILE(tmpl_dual_add_real_double.h)
+
+#else
+
+extern tmpl_DualDouble
+tmpl_DualDouble_Add_Real(double r, const tmpl_DualDouble x);
+
+#endif
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Multiply_Real                                         *
+ *  Purpose:                                                                  *
+ *      Multiplies a dual number by a real number.                            *
+ *  Arguments:                                                                *
+ *      r (double):                                                           *
+ *          A real number.                                                    *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      prod (tmpl_DualDouble):                                               *
+ *          The product r x.                                                  *
+ *  Source Code:                                                              *
+ *      libtmpl/include/inline/dual/                                          *
+ *          tmpl_dual_multiply_real_double.h                                  *
+ ******************************************************************************/
+#if TMPL_USE_INLINE == 1
+
+#include TMPL_INLINE_FILE(tmpl_dual_multiply_real_double.h)
+
+#else
+
+extern tmpl_DualDouble
+tmpl_DualDouble_Multiply_Real(double r, const tmpl_DualDouble x);
+
+#endif
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Sqrt                                                  *
+ *  Purpose:                                                                  *
+ *      Computes the square root of a dual number.                            *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The square root of x.                                             *
+ *  Notes:                                                                    *
+ *      1.) The dual part is infinite or NaN for a = 0, where sqrt is not     *
+ *          differentiable.                                                   *
+ *  Source Code:                                                              *
+ *      libtmpl/src/dual/                                                     *
+ *          tmpl_sqrt_dual_double.c                                           *
+ ******************************************************************************/
+extern tmpl_DualDouble tmpl_DualDouble_Sqrt(const tmpl_DualDouble x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Cbrt                                                  *
+ *  Purpose:                                                                  *
+ *      Computes the cube root of a dual number.                              *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The cube root of x.                                               *
+ *  Notes:                                                                    *
+ *      1.) The dual part is infinite or NaN for a = 0, where cbrt is not     *
+ *          differentiable.                                                   *
+ *  Source Code:                                                              *
+ *      libtmpl/src/dual/                                                     *
+ *          tmpl_cbrt_dual_double.c                                           *
+ ******************************************************************************/
+extern tmpl_DualDouble tmpl_DualDouble_Cbrt(const tmpl_DualDouble x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Exp                                                   *
+ *  Purpose:                                                                  *
+ *      Computes the exponential of a dual number.                            *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The exponential of x.                                             *
+ *  Source Code:                                                              *
+ *      libtmpl/src/dual/                                                     *
+ *          tmpl_exp_dual_double.c                                            *
+ ******************************************************************************/
+extern tmpl_DualDouble tmpl_DualDouble_Exp(const tmpl_DualDouble x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Log                                                   *
+ *  Purpose:                                                                  *
+ *      Computes the natural logarithm of a dual number.                      *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The natural logarithm of x.                                       *
+ *  Source Code:                                                              *
+ *      libtmpl/src/dual/                                                     *
+ *          tmpl_log_dual_double.c                                            *
+ ******************************************************************************/
+extern tmpl_DualDouble tmpl_DualDouble_Log(const tmpl_DualDouble x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Sin                                                   *
+ *  Purpose:                                                                  *
+ *      Computes the sine of a dual number.                                   *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The sine of x.                                                    *
+ *  Source Code:                                                              *
+ *      libtmpl/src/dual/                                                     *
+ *          tmpl_sin_dual_double.c                                            *
+ ******************************************************************************/
+extern tmpl_DualDouble tmpl_DualDouble_Sin(const tmpl_DualDouble x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Cos                                                   *
+ *  Purpose:                                                                  *
+ *      Computes the cosine of a dual number.                                 *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The cosine of x.                                                  *
+ *  Source Code:                                                              *
+ *      libtmpl/src/dual/                                                     *
+ *          tmpl_cos_dual_double.c                                            *
+ ******************************************************************************/
+extern tmpl_DualDouble tmpl_DualDouble_Cos(const tmpl_DualDouble x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Tan                                                   *
+ *  Purpose:                                                                  *
+ *      Computes the tangent of a dual number.                                *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The tangent of x.                                                 *
+ *  Source Code:                                                              *
+ *      libtmpl/src/dual/                                                     *
+ *          tmpl_tan_dual_double.c                                            *
+ ******************************************************************************/
+extern tmpl_DualDouble tmpl_DualDouble_Tan(const tmpl_DualDouble x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Arctan                                                *
+ *  Purpose:                                                                  *
+ *      Computes the inverse tangent of a dual number.                        *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The inverse tangent of x.                                         *
+ *  Source Code:                                                              *
+ *      libtmpl/src/dual/                                                     *
+ *          tmpl_arctan_dual_double.c                                         *
+ ******************************************************************************/
+extern tmpl_DualDouble tmpl_DualDouble_Arctan(const tmpl_DualDouble x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Arcsin                                                *
+ *  Purpose:                                                                  *
+ *      Computes the inverse sine of a dual number.                           *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The inverse sine of x.                                            *
+ *  Notes:                                                                    *
+ *      1.) The dual part is infinite for a = +/- 1, and NaN for |a| > 1.     *
+ *  Source Code:                                                              *
+ *      libtmpl/src/dual/                                                     *
+ *          tmpl_arcsin_dual_double.c                                         *
+ ******************************************************************************/
+extern tmpl_DualDouble tmpl_DualDouble_Arcsin(const tmpl_DualDouble x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Arccos                                                *
+ *  Purpose:                                                                  *
+ *      Computes the inverse cosine of a dual number.                         *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The inverse cosine of x.                                          *
+ *  Notes:                                                                    *
+ *      1.) The dual part is infinite for a = +/- 1, and NaN for |a| > 1.     *
+ *  Source Code:                                                              *
+ *      libtmpl/src/dual/                                                     *
+ *          tmpl_arccos_dual_double.c                                         *
+ ******************************************************************************/
+extern tmpl_DualDouble tmpl_DualDouble_Arccos(const tmpl_DualDouble x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Sinh                                                  *
+ *  Purpose:                                                                  *
+ *      Computes the hyperbolic sine of a dual number.                        *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The hyperbolic sine of x.                                         *
+ *  Source Code:                                                              *
+ *      libtmpl/src/dual/                                                     *
+ *          tmpl_sinh_dual_double.c                                           *
+ ******************************************************************************/
+extern tmpl_DualDouble tmpl_DualDouble_Sinh(const tmpl_DualDouble x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Cosh                                                  *
+ *  Purpose:                                                                  *
+ *      Computes the hyperbolic cosine of a dual number.                      *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The hyperbolic cosine of x.                                       *
+ *  Source Code:                                                              *
+ *      libtmpl/src/dual/                                                     *
+ *          tmpl_cosh_dual_double.c                                           *
+ ******************************************************************************/
+extern tmpl_DualDouble tmpl_DualDouble_Cosh(const tmpl_DualDouble x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Tanh                                                  *
+ *  Purpose:                                                                  *
+ *      Computes the hyperbolic tangent of a dual number.                     *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The hyperbolic tangent of x.                                      *
+ *  Source Code:                                                              *
+ *      libtmpl/src/dual/                                                     *
+ *          tmpl_tanh_dual_double.c                                           *
+ ******************************************************************************/
+extern tmpl_DualDouble tmpl_DualDouble_Tanh(const tmpl_DualDouble x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Erf                                                   *
+ *  Purpose:                                                                  *
+ *      Computes the error function of a dual number.                         *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The error function of x.                                          *
+ *  Source Code:                                                              *
+ *      libtmpl/src/dual/                                                     *
+ *          tmpl_erf_dual_double.c                                            *
+ ******************************************************************************/
+extern tmpl_DualDouble tmpl_DualDouble_Erf(const tmpl_DualDouble x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_DualDouble_Abs                                                   *
+ *  Purpose:                                                                  *
+ *      Computes the absolute value of a dual number.                         *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The absolute value of x.                                          *
+ *  Notes:                                                                    *
+ *      1.) |x| is not differentiable at a = 0. The derivative from the right,*
+ *          sgn(a) = 1, is used there.                                        *
+ *  Source Code:                                                              *
+ *      libtmpl/src/dual/                                                     *
+ *          tmpl_abs_dual_double.c                                            *
+ ******************************************************************************/
+extern tmpl_DualDouble tmpl_DualDouble_Abs(const tmpl_DualDouble x);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef TMPL_INLINE_FILE
+#undef TMPL_INLINE_FILE
+#endif
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,41 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                                 tmpl_float                                 *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      This file is created by the config.c file. It provides macros         *
+ *      for floating-point types like float, double, and long double.         *
+ ******************************************************************************/
+
+#ifndef TMPL_FLOAT_H
+#define TMPL_FLOAT_H
+
+#define TMPL_DBL_EPS (2.220446049250313080847263E-16)
+#define TMPL_FLT_EPS (1.192092895507812500000000E-07F)
+#define TMPL_LDBL_EPS (1.084202172485504434007453E-19L)
+
+#define TMPL_SQRT_DBL_EPS (1.490116119384765625000000E-08)
+#define TMPL_SQRT_FLT_EPS (3.452669830012439083895967E-04F)
+#define TMPL_SQRT_LDBL_EPS (3.292722539913596233268706E-10L)
+
+#define TMPL_QURT_DBL_EPS (1.220703125000000000000000E-04)
+#define TMPL_QURT_FLT_EPS (1.858136117191751666699324E-02F)
+#define TMPL_QURT_LDBL_EPS (1.814586051945069987011059E-05L)
+
+#endif
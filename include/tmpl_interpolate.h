@@ -37,9 +37,23 @@
 #include <libtmpl/include/types/tmpl_cubic_float.h>
 #include <libtmpl/include/types/tmpl_cubic_ldouble.h>
 
+/*  Cubic spline typedef provided here.                                       */
+#include <libtmpl/include/types/tmpl_cubic_spline_double.h>
+
+/*  Linear interpolation plan typedef's provided here.                        */
+#include <libtmpl/include/types/tmpl_linear_interp_plan_double.h>
+#include <libtmpl/include/types/tmpl_linear_interp_plan_float.h>
+#include <libtmpl/include/types/tmpl_linear_interp_plan_ldouble.h>
+
 /*  size_t typedef provided here.                                             */
 #include <stddef.h>
 
+/*  With OpenMP support, interpolation plans are executed in parallel for     *
+ *  grids with at least this many points.                                     */
+#ifndef TMPL_INTERPOLATE_PARALLEL_MIN_LENGTH
+#define TMPL_INTERPOLATE_PARALLEL_MIN_LENGTH ((size_t)65536)
+#endif
+
 extern void
 tmpl_Double_Natural_Cubic_Spline(const double * const x,
                                  const double * const y,
@@ -196,5 +210,366 @@ tmpl_LDouble_Sorted_Linear_Interp1d(const long double * const x,
                                     long double * const y_new,
                                     const size_t len_new);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CubicSplineDouble_Create                                         *
+ *  Purpose:                                                                  *
+ *      Creates a spline object from knots and splining polynomials.          *
+ *  Arguments:                                                                *
+ *      x (const double * const):                                             *
+ *          The knots, strictly increasing.                                   *
+ *      p (const tmpl_CubicDouble * const):                                   *
+ *          The splining polynomials, in terms of x - x[n]. There are len - 1.*
+ *      len (size_t):                                                         *
+ *          The number of elements of x. Must be at least 2.                  *
+ *  Output:                                                                   *
+ *      spline (tmpl_CubicSplineDouble):                                      *
+ *          The spline, with copies of x and p and a lookup table.            *
+ *  Notes:                                                                    *
+ *      1.) Nearly uniform grids (every knot within a quarter step of the     *
+ *          uniform grid with the same endpoints) use index arithmetic to     *
+ *          find the interval containing a point. Other grids use a bucketed  *
+ *          table with len - 1 buckets and a short binary search.             *
+ *                                                                            *
+ *      2.) Invalid inputs, unsorted knots, or a failed malloc set the        *
+ *          error_occurred Boolean.                                           *
+ *                                                                            *
+ *      3.) The output must be freed with tmpl_CubicSplineDouble_Destroy.     *
+ ******************************************************************************/
+extern tmpl_CubicSplineDouble
+tmpl_CubicSplineDouble_Create(const double * const x,
+                              const tmpl_CubicDouble * const p,
+                              size_t len);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CubicSplineDouble_Create_Natural                                 *
+ *  Purpose:                                                                  *
+ *      Creates a spline object for the natural cubic spline of (x, y).       *
+ *  Arguments:                                                                *
+ *      x (const double * const):                                             *
+ *          The knots, strictly increasing.                                   *
+ *      y (const double * const):                                             *
+ *          The data points corresponding to x.                               *
+ *      len (size_t):                                                         *
+ *          The number of elements of x and y. Must be at least 2.            *
+ *  Output:                                                                   *
+ *      spline (tmpl_CubicSplineDouble):                                      *
+ *          The natural cubic spline for the data.                            *
+ *  Notes:                                                                    *
+ *      1.) If len = 2 the spline is the line through the two points.         *
+ *                                                                            *
+ *      2.) The output must be freed with tmpl_CubicSplineDouble_Destroy.     *
+ ******************************************************************************/
+extern tmpl_CubicSplineDouble
+tmpl_CubicSplineDouble_Create_Natural(const double * const x,
+                                      const double * const y,
+                                      size_t len);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CubicSplineDouble_Destroy                                        *
+ *  Purpose:                                                                  *
+ *      Frees all of the memory in a spline object.                           *
+ *  Arguments:                                                                *
+ *      spline (tmpl_CubicSplineDouble * const):                              *
+ *          The spline to destroy.                                            *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+tmpl_CubicSplineDouble_Destroy(tmpl_CubicSplineDouble * const spline);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CubicSplineDouble_Find_Interval                                  *
+ *  Purpose:                                                                  *
+ *      Finds the index n with x[n] <= val < x[n + 1].                        *
+ *  Arguments:                                                                *
+ *      spline (const tmpl_CubicSplineDouble * const):                        *
+ *          A spline created by tmpl_CubicSplineDouble_Create.                *
+ *      val (double):                                                         *
+ *          A real number.                                                    *
+ *  Output:                                                                   *
+ *      n (size_t):                                                           *
+ *          The index of the interval containing val.                         *
+ *  Notes:                                                                    *
+ *      1.) Values below x[0], and NaN, give 0. Values at or above the last   *
+ *          knot give length - 2.                                             *
+ *                                                                            *
+ *      2.) The inputs need not be sorted. The cost is O(1) on uniform grids  *
+ *          and O(1) on average for non-uniform ones.                         *
+ ******************************************************************************/
+extern size_t
+tmpl_CubicSplineDouble_Find_Interval(
+    const tmpl_CubicSplineDouble * const spline,
+    double val
+);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CubicSplineDouble_Eval                                           *
+ *  Purpose:                                                                  *
+ *      Evaluates a spline at a point.                                        *
+ *  Arguments:                                                                *
+ *      spline (const tmpl_CubicSplineDouble * const):                        *
+ *          A spline created by tmpl_CubicSplineDouble_Create.                *
+ *      val (double):                                                         *
+ *          A real number.                                                    *
+ *  Output:                                                                   *
+ *      y (double):                                                           *
+ *          The value of the spline at val.                                   *
+ *  Notes:                                                                    *
+ *      1.) Outside of [x[0], x[length - 1]] the spline is extended linearly  *
+ *          using the slope at the nearest endpoint, as is done in            *
+ *          tmpl_Double_Sorted_Cubic_Interp1d.                                *
+ ******************************************************************************/
+extern double
+tmpl_CubicSplineDouble_Eval(const tmpl_CubicSplineDouble * const spline,
+                            double val);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CubicSplineDouble_Deriv                                          *
+ *  Purpose:                                                                  *
+ *      Evaluates the derivative of a spline at a point.                      *
+ *  Arguments:                                                                *
+ *      spline (const tmpl_CubicSplineDouble * const):                        *
+ *          A spline created by tmpl_CubicSplineDouble_Create.                *
+ *      val (double):                                                         *
+ *          A real number.                                                    *
+ *  Output:                                                                   *
+ *      dy (double):                                                          *
+ *          The derivative of the spline at val.                              *
+ ******************************************************************************/
+extern double
+tmpl_CubicSplineDouble_Deriv(const tmpl_CubicSplineDouble * const spline,
+                             double val);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CubicSplineDouble_Antiderivative                                 *
+ *  Purpose:                                                                  *
+ *      Computes the integral of a spline from x[0] to a point.               *
+ *  Arguments:                                                                *
+ *      spline (const tmpl_CubicSplineDouble * const):                        *
+ *          A spline created by tmpl_CubicSplineDouble_Create.                *
+ *      val (double):                                                         *
+ *          A real number.                                                    *
+ *  Output:                                                                   *
+ *      F (double):                                                           *
+ *          The integral of the spline from x[0] to val.                      *
+ *  Notes:                                                                    *
+ *      1.) This uses the precomputed integrals over each interval, so the    *
+ *          cost does not depend on the distance from x[0].                   *
+ ******************************************************************************/
+extern double
+tmpl_CubicSplineDouble_Antiderivative(
+    const tmpl_CubicSplineDouble * const spline,
+    double val
+);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CubicSplineDouble_Integral                                       *
+ *  Purpose:                                                                  *
+ *      Computes the integral of a spline over [a, b].                        *
+ *  Arguments:                                                                *
+ *      spline (const tmpl_CubicSplineDouble * const):                        *
+ *          A spline created by tmpl_CubicSplineDouble_Create.                *
+ *      a (double):                                                           *
+ *          The lower limit of integration.                                   *
+ *      b (double):                                                           *
+ *          The upper limit of integration.                                   *
+ *  Output:                                                                   *
+ *      integral (double):                                                    *
+ *          The integral of the spline from a to b.                           *
+ ******************************************************************************/
+extern double
+tmpl_CubicSplineDouble_Integral(const tmpl_CubicSplineDouble * const spline,
+                                double a, double b);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CubicSplineDouble_Eval_Array                                     *
+ *  Purpose:                                                                  *
+ *      Evaluates a spline at every point of an array.                        *
+ *  Arguments:                                                                *
+ *      spline (const tmpl_CubicSplineDouble * const):                        *
+ *          A spline created by tmpl_CubicSplineDouble_Create.                *
+ *      x_new (const double * const):                                         *
+ *          The points. These do not need to be sorted.                       *
+ *      y_new (double * const):                                               *
+ *          The values of the spline at x_new.                                *
+ *      len_new (size_t):                                                     *
+ *          The number of elements of x_new and y_new.                        *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+tmpl_CubicSplineDouble_Eval_Array(const tmpl_CubicSplineDouble * const spline,
+                                  const double * const x_new,
+                                  double * const y_new,
+                                  size_t len_new);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CubicSplineDouble_Deriv_Array                                    *
+ *  Purpose:                                                                  *
+ *      Evaluates the derivative of a spline at every point of an array.      *
+ *  Arguments:                                                                *
+ *      spline (const tmpl_CubicSplineDouble * const):                        *
+ *          A spline created by tmpl_CubicSplineDouble_Create.                *
+ *      x_new (const double * const):                                         *
+ *          The points. These do not need to be sorted.                       *
+ *      dy_new (double * const):                                              *
+ *          The derivatives of the spline at x_new.                           *
+ *      len_new (size_t):                                                     *
+ *          The number of elements of x_new and dy_new.                       *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+tmpl_CubicSplineDouble_Deriv_Array(
+    const tmpl_CubicSplineDouble * const spline,
+    const double * const x_new,
+    double * const dy_new,
+    size_t len_new
+);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_CubicSplineDouble_Integral_Array                                 *
+ *  Purpose:                                                                  *
+ *      Computes the integrals of a spline over the intervals [a[n], b[n]].   *
+ *  Arguments:                                                                *
+ *      spline (const tmpl_CubicSplineDouble * const):                        *
+ *          A spline created by tmpl_CubicSplineDouble_Create.                *
+ *      a (const double * const):                                             *
+ *          The lower limits of integration.                                  *
+ *      b (const double * const):                                             *
+ *          The upper limits of integration.                                  *
+ *      out (double * const):                                                 *
+ *          The integrals from a[n] to b[n].                                  *
+ *      len (size_t):                                                         *
+ *          The number of elements of a, b, and out.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+tmpl_CubicSplineDouble_Integral_Array(
+    const tmpl_CubicSplineDouble * const spline,
+    const double * const a,
+    const double * const b,
+    double * const out,
+    size_t len
+);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_LinearInterpPlanDouble_Create                                    *
+ *  Purpose:                                                                  *
+ *      Precomputes the brackets and weights for linearly interpolating data  *
+ *      on x onto x_new.                                                      *
+ *  Arguments:                                                                *
+ *      x (const double * const):                                             *
+ *          A sorted array of real numbers that are monotonically increasing. *
+ *      len (size_t):                                                         *
+ *          The number of elements of x.                                      *
+ *      x_new (const double * const):                                         *
+ *          The new grid. This does not need to be sorted.                    *
+ *      len_new (size_t):                                                     *
+ *          The number of elements of x_new.                                  *
+ *  Output:                                                                   *
+ *      plan (tmpl_LinearInterpPlanDouble):                                   *
+ *          The interpolation plan.                                           *
+ *  Notes:                                                                    *
+ *      1.) Values outside of [x[0], x[len - 1]] are clamped to the nearest   *
+ *          endpoint, as in tmpl_Double_Sorted_Linear_Interp1d.               *
+ *                                                                            *
+ *      2.) Use the plan with tmpl_LinearInterpPlanDouble_Execute for each    *
+ *          data set on the x grid, and free it with                          *
+ *          tmpl_LinearInterpPlanDouble_Destroy.                              *
+ ******************************************************************************/
+extern tmpl_LinearInterpPlanFloat
+tmpl_LinearInterpPlanFloat_Create(const float * const x,
+                                  size_t len,
+                                  const float * const x_new,
+                                  size_t len_new);
+
+extern tmpl_LinearInterpPlanDouble
+tmpl_LinearInterpPlanDouble_Create(const double * const x,
+                                   size_t len,
+                                   const double * const x_new,
+                                   size_t len_new);
+
+extern tmpl_LinearInterpPlanLongDouble
+tmpl_LinearInterpPlanLongDouble_Create(const long double * const x,
+                                       size_t len,
+                                       const long double * const x_new,
+                                       size_t len_new);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_LinearInterpPlanDouble_Destroy                                   *
+ *  Purpose:                                                                  *
+ *      Frees the memory in an interpolation plan.                            *
+ *  Arguments:                                                                *
+ *      plan (tmpl_LinearInterpPlanDouble * const):                           *
+ *          The plan to destroy.                                              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+tmpl_LinearInterpPlanFloat_Destroy(tmpl_LinearInterpPlanFloat * const plan);
+
+extern void
+tmpl_LinearInterpPlanDouble_Destroy(tmpl_LinearInterpPlanDouble * const plan);
+
+extern void
+tmpl_LinearInterpPlanLongDouble_Destroy(
+    tmpl_LinearInterpPlanLongDouble * const plan
+);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_LinearInterpPlanDouble_Execute                                   *
+ *  Purpose:                                                                  *
+ *      Interpolates a data set using a precomputed plan.                     *
+ *  Arguments:                                                                *
+ *      plan (const tmpl_LinearInterpPlanDouble * const):                     *
+ *          A plan created by tmpl_LinearInterpPlanDouble_Create.             *
+ *      y (const double * const):                                             *
+ *          The data on the source grid. This has plan->source_length points. *
+ *      y_new (double * const):                                               *
+ *          The interpolated data. This has plan->length points.              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      1.) This is a single branch-free pass over the new grid. With OpenMP  *
+ *          support, grids with at least TMPL_INTERPOLATE_PARALLEL_MIN_LENGTH *
+ *          points are split across threads.                                  *
+ ******************************************************************************/
+extern void
+tmpl_LinearInterpPlanFloat_Execute(
+    const tmpl_LinearInterpPlanFloat * const plan,
+    const float * const y,
+    float * const y_new
+);
+
+extern void
+tmpl_LinearInterpPlanDouble_Execute(
+    const tmpl_LinearInterpPlanDouble * const plan,
+    const double * const y,
+    double * const y_new
+);
+
+extern void
+tmpl_LinearInterpPlanLongDouble_Execute(
+    const tmpl_LinearInterpPlanLongDouble * const plan,
+    const long double * const y,
+    long double * const y_new
+);
+
 #endif
 /*  End of include guard.                                                     */
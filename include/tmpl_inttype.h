@@ -0,0 +1,64 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                                tmpl_inttype                                *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      This file is created by the config.c file. It provides macros         *
+ *      for fixed-width integers for 8, 16, 32, and 64 bits, as well as       *
+ *      typedefs, if such data types exist on your platform.                  *
+ ******************************************************************************/
+
+#ifndef TMPL_INTTYPE_H
+#define TMPL_INTTYPE_H
+
+#define TMPL_HAS_LONGLONG 1
+
+#define TMPL_HAS_8_BIT_INT 1
+typedef unsigned char tmpl_UInt8;
+typedef signed char tmpl_SInt8;
+#define tmpl_UInt8_Trailing_Zeros TMPL_UCHAR_TRAILING_ZEROS
+#define tmpl_SInt8_Trailing_Zeros TMPL_CHAR_TRAILING_ZEROS
+#define tmpl_UInt8_Leading_Zeros TMPL_UCHAR_LEADING_ZEROS
+#define TMPL_UINT8_LITERAL(x) (x##U)
+
+#define TMPL_HAS_16_BIT_INT 1
+typedef unsigned short int tmpl_UInt16;
+typedef signed short int tmpl_SInt16;
+#define tmpl_UInt16_Trailing_Zeros TMPL_USHORT_TRAILING_ZEROS
+#define tmpl_SInt16_Trailing_Zeros TMPL_SHORT_TRAILING_ZEROS
+#define tmpl_UInt16_Leading_Zeros TMPL_USHORT_LEADING_ZEROS
+#define TMPL_UINT16_LITERAL(x) (x##U)
+
+#define TMPL_HAS_32_BIT_INT 1
+typedef unsigned int tmpl_UInt32;
+typedef signed int tmpl_SInt32;
+#define tmpl_UInt32_Trailing_Zeros TMPL_UINT_TRAILING_ZEROS
+#define tmpl_SInt32_Trailing_Zeros TMPL_INT_TRAILING_ZEROS
+#define tmpl_UInt32_Leading_Zeros TMPL_UINT_LEADING_ZEROS
+#define TMPL_UINT32_LITERAL(x) (x##U)
+
+#define TMPL_HAS_64_BIT_INT 1
+typedef unsigned long int tmpl_UInt64;
+typedef signed long int tmpl_SInt64;
+#define tmpl_UInt64_Trailing_Zeros TMPL_ULONG_TRAILING_ZEROS
+#define tmpl_SInt64_Trailing_Zeros TMPL_LONG_TRAILING_ZEROS
+#define tmpl_UInt64_Leading_Zeros TMPL_ULONG_LEADING_ZEROS
+#define TMPL_UINT64_LITERAL(x) (x##UL)
+
+#endif
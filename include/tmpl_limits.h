@@ -0,0 +1,35 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                                 tmpl_limits                                *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      This file is created by the config.c file. It provides macros         *
+ *      for unsigned integers, providing their largest possible values.       *
+ ******************************************************************************/
+
+#ifndef TMPL_LIMITS_H
+#define TMPL_LIMITS_H
+
+#define TMPL_UCHAR_BIT 8
+#define TMPL_USHORT_BIT 16
+#define TMPL_UINT_BIT 32
+#define TMPL_ULONG_BIT 64
+#define TMPL_ULLONG_BIT 64
+
+#endif
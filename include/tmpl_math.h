@@ -1500,6 +1500,55 @@ extern long double
 tmpl_LDouble_Poly_Eval(const long double * const coeffs,
                        size_t degree, long double x);
 
+/*  With OpenMP support, polynomials are evaluated in parallel for arrays     *
+ *  with at least this many points.                                           */
+#ifndef TMPL_POLY_EVAL_PARALLEL_MIN_LENGTH
+#define TMPL_POLY_EVAL_PARALLEL_MIN_LENGTH ((size_t)16384)
+#endif
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Double_Poly_Eval_Array                                           *
+ *  Purpose:                                                                  *
+ *      Evaluates a polynomial at every element of an array.                  *
+ *  Arguments:                                                                *
+ *      double *coeffs:                                                       *
+ *          The coefficients. There must be degree + 1 elements in the array. *
+ *      size_t degree:                                                        *
+ *          The degree of the polynomial.                                     *
+ *      double *x:                                                            *
+ *          The points where the polynomial is being evaluated.               *
+ *      double *y:                                                            *
+ *          The polynomial evaluated at the points x.                         *
+ *      size_t len:                                                           *
+ *          The number of elements in x and y.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Several points are evaluated at once with interleaved Horner chains.  *
+ *      The results agree with tmpl_Double_Poly_Eval. y may be the same as x. *
+ ******************************************************************************/
+extern void
+tmpl_Float_Poly_Eval_Array(const float * const coeffs,
+                           size_t degree,
+                           const float * const x,
+                           float * const y,
+                           size_t len);
+
+extern void
+tmpl_Double_Poly_Eval_Array(const double * const coeffs,
+                            size_t degree,
+                            const double * const x,
+                            double * const y,
+                            size_t len);
+
+extern void
+tmpl_LDouble_Poly_Eval_Array(const long double * const coeffs,
+                             size_t degree,
+                             const long double * const x,
+                             long double * const y,
+                             size_t len);
+
 /*
  *  TODO:
  *    "Safe" eval using double-double arithmetic to avoid precision loss.
@@ -46,6 +46,8 @@
  *  2025/12/03: Ryan Maguire                                                  *
  *      Moved typedefs to their own files. Changed function calls to have the *
  *      dest variable (sum, prod, etc.) as the first argument.                *
+ *  2026/10/18: Ryan Maguire                                                  *
+ *      Added exact evaluation at arbitrary-precision integers.               *
  ******************************************************************************/
 
 /*  TODO:
@@ -72,12 +74,45 @@ extern "C" {
 /*  Polynomial data types defined here.                                       */
 #include <libtmpl/include/types/tmpl_polynomial_int.h>
 
+/*  Arbitrary-precision integer data type defined here.                       */
+#include <libtmpl/include/types/tmpl_bigint.h>
+
+/*  Workspace arena and capacity-aware polynomial types defined here.         */
+#include <libtmpl/include/types/tmpl_polynomial_arena_int.h>
+#include <libtmpl/include/types/tmpl_polynomial_buffer_int.h>
+
 /*  The size_t data type is found here.                                       */
 #include <stddef.h>
 
 /*  FILE data type found here.                                                */
 #include <stdio.h>
 
+/*  Below this length the classical O(n^2) product is fastest. Polynomials    *
+ *  whose shorter factor has at least this many coefficients are multiplied   *
+ *  with Karatsuba's method by tmpl_IntPolynomial_Multiply.                   */
+#ifndef TMPL_INTPOLY_KARATSUBA_THRESHOLD
+#define TMPL_INTPOLY_KARATSUBA_THRESHOLD (32)
+#endif
+
+/*  Shorter factors with at least this many coefficients use Toom-3. This     *
+ *  must be at least 5 and no smaller than the Karatsuba threshold.           */
+#ifndef TMPL_INTPOLY_TOOM3_THRESHOLD
+#define TMPL_INTPOLY_TOOM3_THRESHOLD (256)
+#endif
+
+/*  tmpl_IntPolynomial_Eval_Array uses a subproduct tree for polynomials with *
+ *  at least this many coefficients, and Horner's method otherwise. Batched   *
+ *  Horner vectorizes well, so the tree only pays off for very high degrees.  */
+#ifndef TMPL_INTPOLY_SUBPRODUCT_THRESHOLD
+#define TMPL_INTPOLY_SUBPRODUCT_THRESHOLD (16384)
+#endif
+
+/*  With OpenMP support, Horner's method is run in parallel for arrays with   *
+ *  at least this many points.                                                */
+#ifndef TMPL_INTPOLY_EVAL_PARALLEL_MIN_LENGTH
+#define TMPL_INTPOLY_EVAL_PARALLEL_MIN_LENGTH ((size_t)16384)
+#endif
+
 /*  Polynomials with integer coefficients, elements of Z[x]. Short data type. */
 typedef struct tmpl_ShortPolynomial_Def {
 
@@ -545,6 +580,72 @@ tmpl_IntPolynomial tmpl_IntPolynomial_Empty(void);
  ******************************************************************************/
 int tmpl_IntPolynomial_Eval(const tmpl_IntPolynomial *poly, int val);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomial_Eval_BigInt                                        *
+ *  Purpose:                                                                  *
+ *      Evaluates an integer polynomial exactly at a big integer.             *
+ *  Arguments:                                                                *
+ *      eval (tmpl_BigInt *):                                                 *
+ *          An initialized number, the value of poly at x.                    *
+ *      poly (const tmpl_IntPolynomial *):                                    *
+ *          A pointer to a polynomial.                                        *
+ *      x (const tmpl_BigInt *):                                              *
+ *          The point where poly is evaluated.                                *
+ *  Outputs:                                                                  *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+tmpl_IntPolynomial_Eval_BigInt(tmpl_BigInt *eval,
+                               const tmpl_IntPolynomial *poly,
+                               const tmpl_BigInt *x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomial_Eval_Array                                         *
+ *  Purpose:                                                                  *
+ *      Evaluates an integer polynomial at every element of an array.         *
+ *  Arguments:                                                                *
+ *      evals (int *):                                                        *
+ *          The values of poly at the points x, len elements.                 *
+ *      poly (const tmpl_IntPolynomial *):                                    *
+ *          A pointer to a polynomial.                                        *
+ *      x (const int *):                                                      *
+ *          The integers at which we're evaluating the polynomial.            *
+ *      len (size_t):                                                         *
+ *          The number of elements in evals and x.                            *
+ *  Outputs:                                                                  *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      1.) The Horner version runs several interleaved Horner chains and is  *
+ *          O(n len), where n is the degree. The Subproduct version uses a    *
+ *          subproduct tree and is O(len M(n) log(n) / n), where M(n) is the  *
+ *          cost of a product. The generic version picks one of the two using *
+ *          TMPL_INTPOLY_SUBPRODUCT_THRESHOLD.                                *
+ *                                                                            *
+ *      2.) All versions compute modulo 2^N and give identical results. They  *
+ *          agree with tmpl_IntPolynomial_Eval whenever it does not overflow. *
+ *                                                                            *
+ *      3.) evals may be the same array as x.                                 *
+ ******************************************************************************/
+extern void
+tmpl_IntPolynomial_Eval_Array(int *evals,
+                              const tmpl_IntPolynomial *poly,
+                              const int *x,
+                              size_t len);
+
+extern void
+tmpl_IntPolynomial_Eval_Array_Horner(int *evals,
+                                     const tmpl_IntPolynomial *poly,
+                                     const int *x,
+                                     size_t len);
+
+extern void
+tmpl_IntPolynomial_Eval_Array_Subproduct(int *evals,
+                                         const tmpl_IntPolynomial *poly,
+                                         const int *x,
+                                         size_t len);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      tmpl_IntPolynomial_Extract_Term                                       *
@@ -666,6 +767,10 @@ tmpl_IntPolynomial_Multiply_Monomial(const tmpl_IntPolynomial *P, size_t deg,
  *          A pointer to a polynomial, the value P*Q will be stored in it.    *
  *  Output:                                                                   *
  *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The method is chosen by the length of the shorter factor. The naive   *
+ *      product is used below TMPL_INTPOLY_KARATSUBA_THRESHOLD, Karatsuba's   *
+ *      method below TMPL_INTPOLY_TOOM3_THRESHOLD, and Toom-3 otherwise.      *
  ******************************************************************************/
 extern void
 tmpl_IntPolynomial_Multiply(const tmpl_IntPolynomial *P,
@@ -712,6 +817,223 @@ tmpl_IntPolynomial_Multiply_Naive_Kernel(const tmpl_IntPolynomial *P,
                                          const tmpl_IntPolynomial *Q,
                                          tmpl_IntPolynomial *prod);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomial_Multiply_Karatsuba                                 *
+ *  Purpose:                                                                  *
+ *      Multiplies two elements of Z[x] using Karatsuba's method.             *
+ *  Arguments:                                                                *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          A pointer to a polynomial.                                        *
+ *      Q (const tmpl_IntPolynomial *):                                       *
+ *          Another pointer to a polynomial.                                  *
+ *      prod (tmpl_IntPolynomial *):                                          *
+ *          A pointer to a polynomial, the value P*Q will be stored in it.    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The workspace is allocated and freed internally. To reuse it over     *
+ *      many products, use tmpl_IntPolynomial_Multiply_Karatsuba_Kernel.      *
+ ******************************************************************************/
+extern void
+tmpl_IntPolynomial_Multiply_Karatsuba(const tmpl_IntPolynomial *P,
+                                      const tmpl_IntPolynomial *Q,
+                                      tmpl_IntPolynomial *prod);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomial_Multiply_Karatsuba_Kernel                          *
+ *  Purpose:                                                                  *
+ *      Multiplies two elements of Z[x] using Karatsuba's method, without     *
+ *      error checks, with a caller-provided workspace.                       *
+ *  Arguments:                                                                *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          A pointer to a polynomial.                                        *
+ *      Q (const tmpl_IntPolynomial *):                                       *
+ *          Another pointer to a polynomial.                                  *
+ *      prod (tmpl_IntPolynomial *):                                          *
+ *          A pointer to a polynomial, the value P*Q will be stored in it.    *
+ *      scratch (void *):                                                     *
+ *          Workspace of at least                                             *
+ *          tmpl_IntPolynomial_Multiply_Karatsuba_Scratch_Size(P, Q) bytes,   *
+ *          obtained from malloc or suitably aligned.                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+tmpl_IntPolynomial_Multiply_Karatsuba_Kernel(const tmpl_IntPolynomial *P,
+                                             const tmpl_IntPolynomial *Q,
+                                             tmpl_IntPolynomial *prod,
+                                             void *scratch);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomial_Multiply_Karatsuba_Scratch_Size                    *
+ *  Purpose:                                                                  *
+ *      Computes the size of the workspace needed by                          *
+ *      tmpl_IntPolynomial_Multiply_Karatsuba_Kernel.                         *
+ *  Arguments:                                                                *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          A pointer to a polynomial.                                        *
+ *      Q (const tmpl_IntPolynomial *):                                       *
+ *          Another pointer to a polynomial.                                  *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The size of the workspace, in bytes.                              *
+ *  Notes:                                                                    *
+ *      The size depends only on the degrees, so one buffer may be reused for *
+ *      any products of polynomials of no larger degrees.                     *
+ ******************************************************************************/
+extern size_t
+tmpl_IntPolynomial_Multiply_Karatsuba_Scratch_Size(const tmpl_IntPolynomial *P,
+                                                   const tmpl_IntPolynomial *Q);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomial_Multiply_Toom3                                     *
+ *  Purpose:                                                                  *
+ *      Multiplies two elements of Z[x] using the Toom-3 method.              *
+ *  Arguments:                                                                *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          A pointer to a polynomial.                                        *
+ *      Q (const tmpl_IntPolynomial *):                                       *
+ *          Another pointer to a polynomial.                                  *
+ *      prod (tmpl_IntPolynomial *):                                          *
+ *          A pointer to a polynomial, the value P*Q will be stored in it.    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The workspace is allocated and freed internally. To reuse it over     *
+ *      many products, use tmpl_IntPolynomial_Multiply_Toom3_Kernel.          *
+ ******************************************************************************/
+extern void
+tmpl_IntPolynomial_Multiply_Toom3(const tmpl_IntPolynomial *P,
+                                  const tmpl_IntPolynomial *Q,
+                                  tmpl_IntPolynomial *prod);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomial_Multiply_Toom3_Kernel                              *
+ *  Purpose:                                                                  *
+ *      Multiplies two elements of Z[x] using the Toom-3 method, without      *
+ *      error checks, with a caller-provided workspace.                       *
+ *  Arguments:                                                                *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          A pointer to a polynomial.                                        *
+ *      Q (const tmpl_IntPolynomial *):                                       *
+ *          Another pointer to a polynomial.                                  *
+ *      prod (tmpl_IntPolynomial *):                                          *
+ *          A pointer to a polynomial, the value P*Q will be stored in it.    *
+ *      scratch (void *):                                                     *
+ *          Workspace of at least                                             *
+ *          tmpl_IntPolynomial_Multiply_Toom3_Scratch_Size(P, Q) bytes,       *
+ *          obtained from malloc or suitably aligned.                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+tmpl_IntPolynomial_Multiply_Toom3_Kernel(const tmpl_IntPolynomial *P,
+                                         const tmpl_IntPolynomial *Q,
+                                         tmpl_IntPolynomial *prod,
+                                         void *scratch);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomial_Multiply_Toom3_Scratch_Size                        *
+ *  Purpose:                                                                  *
+ *      Computes the size of the workspace needed by                          *
+ *      tmpl_IntPolynomial_Multiply_Toom3_Kernel.                             *
+ *  Arguments:                                                                *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          A pointer to a polynomial.                                        *
+ *      Q (const tmpl_IntPolynomial *):                                       *
+ *          Another pointer to a polynomial.                                  *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The size of the workspace, in bytes.                              *
+ ******************************************************************************/
+extern size_t
+tmpl_IntPolynomial_Multiply_Toom3_Scratch_Size(const tmpl_IntPolynomial *P,
+                                               const tmpl_IntPolynomial *Q);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomial_Multiply_NTT                                       *
+ *  Purpose:                                                                  *
+ *      Multiplies two elements of Z[x] exactly using the number theoretic    *
+ *      transform, in O(n log(n)) time.                                       *
+ *  Arguments:                                                                *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          A pointer to a polynomial.                                        *
+ *      Q (const tmpl_IntPolynomial *):                                       *
+ *          Another pointer to a polynomial.                                  *
+ *      prod (tmpl_IntPolynomial *):                                          *
+ *          A pointer to a polynomial, the value P*Q will be stored in it.    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      If a coefficient of the product does not fit in an int, the           *
+ *      error_occurred Boolean of prod is set. prod may be P or Q.            *
+ ******************************************************************************/
+extern void
+tmpl_IntPolynomial_Multiply_NTT(const tmpl_IntPolynomial *P,
+                                const tmpl_IntPolynomial *Q,
+                                tmpl_IntPolynomial *prod);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_LongPolynomial_Multiply_NTT                                      *
+ *  Purpose:                                                                  *
+ *      Multiplies two elements of Z[x] exactly using the number theoretic    *
+ *      transform, in O(n log(n)) time.                                       *
+ *  Arguments:                                                                *
+ *      P (const tmpl_LongPolynomial *):                                      *
+ *          A pointer to a polynomial.                                        *
+ *      Q (const tmpl_LongPolynomial *):                                      *
+ *          Another pointer to a polynomial.                                  *
+ *      prod (tmpl_LongPolynomial *):                                         *
+ *          A pointer to a polynomial, the value P*Q will be stored in it.    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      If a coefficient of the product does not fit in a long, the           *
+ *      error_occurred Boolean of prod is set. prod may be P or Q.            *
+ ******************************************************************************/
+extern void
+tmpl_LongPolynomial_Multiply_NTT(const tmpl_LongPolynomial *P,
+                                 const tmpl_LongPolynomial *Q,
+                                 tmpl_LongPolynomial *prod);
+
+/*  long long version only available if long long support is available.       */
+#if TMPL_HAS_LONGLONG == 1
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_LongLongPolynomial_Multiply_NTT                                  *
+ *  Purpose:                                                                  *
+ *      Multiplies two elements of Z[x] exactly using the number theoretic    *
+ *      transform, in O(n log(n)) time.                                       *
+ *  Arguments:                                                                *
+ *      P (const tmpl_LongLongPolynomial *):                                  *
+ *          A pointer to a polynomial.                                        *
+ *      Q (const tmpl_LongLongPolynomial *):                                  *
+ *          Another pointer to a polynomial.                                  *
+ *      prod (tmpl_LongLongPolynomial *):                                     *
+ *          A pointer to a polynomial, the value P*Q will be stored in it.    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      If a coefficient of the product does not fit in a long long, the      *
+ *      error_occurred Boolean of prod is set. prod may be P or Q.            *
+ ******************************************************************************/
+extern void
+tmpl_LongLongPolynomial_Multiply_NTT(const tmpl_LongLongPolynomial *P,
+                                     const tmpl_LongLongPolynomial *Q,
+                                     tmpl_LongLongPolynomial *prod);
+
+#endif
+/*  End of #if TMPL_HAS_LONGLONG == 1.                                        */
+
 /******************************************************************************
  *  Function:                                                                 *
  *      tmpl_IntPolynomial_As_String                                          *
@@ -941,6 +1263,241 @@ tmpl_IntPolynomial_Random(size_t degree);
 extern tmpl_IntPolynomial
 tmpl_IntPolynomial_Create_From_Data(const int *data, size_t len);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomialArena_Create                                        *
+ *  Purpose:                                                                  *
+ *      Allocates a single block of memory that capacity-aware polynomials    *
+ *      can take their coefficient arrays from.                               *
+ *  Arguments:                                                                *
+ *      capacity (size_t):                                                    *
+ *          The total number of coefficients the arena can hand out.          *
+ *  Output:                                                                   *
+ *      arena (tmpl_IntPolynomialArena):                                      *
+ *          An empty arena with room for capacity coefficients.               *
+ *  Notes:                                                                    *
+ *      If malloc fails the error_occurred Boolean is set. The arena must be  *
+ *      freed with tmpl_IntPolynomialArena_Destroy.                           *
+ ******************************************************************************/
+extern tmpl_IntPolynomialArena
+tmpl_IntPolynomialArena_Create(const size_t capacity);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomialArena_Destroy                                       *
+ *  Purpose:                                                                  *
+ *      Frees the memory in an arena.                                         *
+ *  Arguments:                                                                *
+ *      arena (tmpl_IntPolynomialArena *):                                    *
+ *          A pointer to the arena that is to be destroyed.                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Buffers taken from the arena must not be used after this call.        *
+ ******************************************************************************/
+extern void tmpl_IntPolynomialArena_Destroy(tmpl_IntPolynomialArena *arena);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomialArena_Reset                                         *
+ *  Purpose:                                                                  *
+ *      Returns every coefficient handed out by an arena, keeping the memory. *
+ *  Arguments:                                                                *
+ *      arena (tmpl_IntPolynomialArena *):                                    *
+ *          A pointer to the arena that is to be reset.                       *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Buffers taken from the arena must not be used after this call.        *
+ ******************************************************************************/
+extern void tmpl_IntPolynomialArena_Reset(tmpl_IntPolynomialArena *arena);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomialBuffer_Create                                       *
+ *  Purpose:                                                                  *
+ *      Creates the zero polynomial with room for capacity coefficients.      *
+ *  Arguments:                                                                *
+ *      capacity (size_t):                                                    *
+ *          The number of coefficients to allocate. Zero is treated as one.   *
+ *  Output:                                                                   *
+ *      buffer (tmpl_IntPolynomialBuffer):                                    *
+ *          A zero polynomial that owns its memory.                           *
+ *  Notes:                                                                    *
+ *      If malloc fails the error_occurred Boolean is set. The buffer must be *
+ *      freed with tmpl_IntPolynomialBuffer_Destroy.                          *
+ ******************************************************************************/
+extern tmpl_IntPolynomialBuffer
+tmpl_IntPolynomialBuffer_Create(const size_t capacity);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomialBuffer_From_Arena                                   *
+ *  Purpose:                                                                  *
+ *      Creates the zero polynomial using capacity coefficients of an arena.  *
+ *  Arguments:                                                                *
+ *      arena (tmpl_IntPolynomialArena *):                                    *
+ *          The arena the coefficients are taken from.                        *
+ *      capacity (size_t):                                                    *
+ *          The number of coefficients to take. Zero is treated as one.       *
+ *  Output:                                                                   *
+ *      buffer (tmpl_IntPolynomialBuffer):                                    *
+ *          A zero polynomial whose memory belongs to the arena.              *
+ *  Notes:                                                                    *
+ *      No memory is allocated. If the arena does not have enough room the    *
+ *      error_occurred Boolean is set. The capacity of the output is fixed.   *
+ ******************************************************************************/
+extern tmpl_IntPolynomialBuffer
+tmpl_IntPolynomialBuffer_From_Arena(tmpl_IntPolynomialArena *arena,
+                                    const size_t capacity);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomialBuffer_Destroy                                      *
+ *  Purpose:                                                                  *
+ *      Frees the memory in a buffer, unless it belongs to an arena.          *
+ *  Arguments:                                                                *
+ *      buffer (tmpl_IntPolynomialBuffer *):                                  *
+ *          A pointer to the polynomial that is to be destroyed.              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void tmpl_IntPolynomialBuffer_Destroy(tmpl_IntPolynomialBuffer *buffer);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomialBuffer_Reserve                                      *
+ *  Purpose:                                                                  *
+ *      Ensures a buffer can hold at least capacity coefficients.             *
+ *  Arguments:                                                                *
+ *      buffer (tmpl_IntPolynomialBuffer *):                                  *
+ *          The polynomial whose capacity is to be increased.                 *
+ *      capacity (size_t):                                                    *
+ *          The required number of coefficients.                              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The capacity at least doubles when it grows. Buffers taken from an    *
+ *      arena can not grow, and the error_occurred Boolean is set instead.    *
+ ******************************************************************************/
+extern void
+tmpl_IntPolynomialBuffer_Reserve(tmpl_IntPolynomialBuffer *buffer,
+                                 const size_t capacity);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomialBuffer_Make_Zero                                    *
+ *  Purpose:                                                                  *
+ *      Sets a buffer to the zero polynomial, keeping its memory.             *
+ *  Arguments:                                                                *
+ *      buffer (tmpl_IntPolynomialBuffer *):                                  *
+ *          The polynomial that is to be set to zero.                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+tmpl_IntPolynomialBuffer_Make_Zero(tmpl_IntPolynomialBuffer *buffer);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomialBuffer_Set                                          *
+ *  Purpose:                                                                  *
+ *      Computes buffer = P, reusing the memory of the buffer.                *
+ *  Arguments:                                                                *
+ *      buffer (tmpl_IntPolynomialBuffer *):                                  *
+ *          The polynomial the data is copied into.                           *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          The polynomial that is copied.                                    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+tmpl_IntPolynomialBuffer_Set(tmpl_IntPolynomialBuffer *buffer,
+                             const tmpl_IntPolynomial *P);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomialBuffer_View                                         *
+ *  Purpose:                                                                  *
+ *      Returns a tmpl_IntPolynomial sharing the coefficients of a buffer.    *
+ *  Arguments:                                                                *
+ *      buffer (const tmpl_IntPolynomialBuffer *):                            *
+ *          The polynomial that is to be viewed.                              *
+ *  Output:                                                                   *
+ *      view (tmpl_IntPolynomial):                                            *
+ *          A polynomial pointing to the same coefficients as the buffer.     *
+ *  Notes:                                                                    *
+ *      The view does not own its memory. Only pass it to functions that read *
+ *      their inputs, never to tmpl_IntPolynomial_Destroy.                    *
+ ******************************************************************************/
+extern tmpl_IntPolynomial
+tmpl_IntPolynomialBuffer_View(const tmpl_IntPolynomialBuffer *buffer);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomialBuffer_AddTo                                        *
+ *  Purpose:                                                                  *
+ *      Computes buffer += P in place.                                        *
+ *  Arguments:                                                                *
+ *      buffer (tmpl_IntPolynomialBuffer *):                                  *
+ *          The polynomial that is added to.                                  *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          The polynomial that is added.                                     *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      No memory is allocated if the capacity of the buffer is sufficient.   *
+ ******************************************************************************/
+extern void
+tmpl_IntPolynomialBuffer_AddTo(tmpl_IntPolynomialBuffer *buffer,
+                               const tmpl_IntPolynomial *P);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomialBuffer_AddTo_Product                                *
+ *  Purpose:                                                                  *
+ *      Computes buffer += P * Q in place, without a temporary product.       *
+ *  Arguments:                                                                *
+ *      buffer (tmpl_IntPolynomialBuffer *):                                  *
+ *          The polynomial that is added to.                                  *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          The first factor of the product.                                  *
+ *      Q (const tmpl_IntPolynomial *):                                       *
+ *          The second factor of the product.                                 *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      No memory is allocated if the capacity of the buffer is sufficient.   *
+ *      P and Q may not be views of the buffer.                               *
+ ******************************************************************************/
+extern void
+tmpl_IntPolynomialBuffer_AddTo_Product(tmpl_IntPolynomialBuffer *buffer,
+                                       const tmpl_IntPolynomial *P,
+                                       const tmpl_IntPolynomial *Q);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomialBuffer_Multiply                                     *
+ *  Purpose:                                                                  *
+ *      Computes buffer = P * Q, reusing the memory of the buffer.            *
+ *  Arguments:                                                                *
+ *      buffer (tmpl_IntPolynomialBuffer *):                                  *
+ *          The polynomial the product is written to.                         *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          The first factor of the product.                                  *
+ *      Q (const tmpl_IntPolynomial *):                                       *
+ *          The second factor of the product.                                 *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      No memory is allocated if the capacity of the buffer is sufficient.   *
+ *      P and Q may not be views of the buffer.                               *
+ ******************************************************************************/
+extern void
+tmpl_IntPolynomialBuffer_Multiply(tmpl_IntPolynomialBuffer *buffer,
+                                  const tmpl_IntPolynomial *P,
+                                  const tmpl_IntPolynomial *Q);
+
 /*  End of extern "C" statement allowing C++ compatibility.                   */
 #ifdef __cplusplus
 }
@@ -25,8 +25,10 @@
  ******************************************************************************
  *  1.) tmpl_bool.h:                                                          *
  *          Header file containing Booleans.                                  *
- *  2.) stdio.h:                                                              *
- *          Standard C header file containing the FILE data type.             *
+ *  2.) tmpl_polynomial_int.h:                                                *
+ *          Header file with the tmpl_IntPolynomial type.                     *
+ *  3.) stddef.h:                                                             *
+ *          Standard C header file with size_t data type.                     *
  ******************************************************************************
  *  Author:     Ryan Maguire                                                  *
  *  Date:       February 10, 2023                                             *
@@ -41,6 +43,9 @@
  *      Moved integer data type to own file. Added more data types (int etc.).*
  *  2023/02/10: Ryan Maguire                                                  *
  *      Moved polynomial matrices here from regular polynomials.              *
+ *  2026/10/18: Ryan Maguire                                                  *
+ *      Added the missing includes. Added creation, multiplication, and the   *
+ *      determinant.                                                          *
  ******************************************************************************/
 
 /*  Include guard to prevent including this file twice.                       */
@@ -53,10 +58,28 @@
 extern "C" {
 #endif
 
+/*  Booleans located here.                                                    */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Polynomial data type for the entries defined here.                        */
+#include <libtmpl/include/types/tmpl_polynomial_int.h>
+
+/*  The size_t data type is found here.                                       */
+#include <stddef.h>
+
+/*  Matrix products are computed in square tiles of output entries. The       *
+ *  entries of a tile share rows of the first factor and columns of the       *
+ *  second, which then stay in cache. Tiles are also the unit of work that is *
+ *  handed to each thread when OpenMP support is enabled.                     */
+#ifndef TMPL_INTPOLYMAT_BLOCK_SIZE
+#define TMPL_INTPOLYMAT_BLOCK_SIZE (8)
+#endif
+
 /*  Data type for matrices of polynomials in Z[x].                            */
 typedef struct tmpl_IntPolynomialMatrix_Def {
 
-    /*  An array of polynomials, representing the matrix.                     */
+    /*  An array of polynomials, representing the matrix. The entries are     *
+     *  stored in row-major order, entry (m, n) is data[m*number_of_columns+n]*/
     tmpl_IntPolynomial *data;
 
     /*  The number of rows and columns, respectively.                         */
@@ -70,6 +93,87 @@ typedef struct tmpl_IntPolynomialMatrix_Def {
     char *error_message;
 } tmpl_IntPolynomialMatrix;
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomialMatrix_Create                                       *
+ *  Purpose:                                                                  *
+ *      Creates a matrix of polynomials with every entry set to zero.         *
+ *  Arguments:                                                                *
+ *      rows (size_t):                                                        *
+ *          The number of rows.                                               *
+ *      columns (size_t):                                                     *
+ *          The number of columns.                                            *
+ *  Output:                                                                   *
+ *      matrix (tmpl_IntPolynomialMatrix):                                    *
+ *          The zero matrix of the given shape.                               *
+ *  Notes:                                                                    *
+ *      If malloc fails the error_occurred Boolean is set. The matrix must be *
+ *      freed with tmpl_IntPolynomialMatrix_Destroy.                          *
+ ******************************************************************************/
+extern tmpl_IntPolynomialMatrix
+tmpl_IntPolynomialMatrix_Create(size_t rows, size_t columns);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomialMatrix_Destroy                                      *
+ *  Purpose:                                                                  *
+ *      Frees every entry of a matrix, the array of entries, and the error    *
+ *      message.                                                              *
+ *  Arguments:                                                                *
+ *      matrix (tmpl_IntPolynomialMatrix *):                                  *
+ *          The matrix that is to be destroyed.                               *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void tmpl_IntPolynomialMatrix_Destroy(tmpl_IntPolynomialMatrix *matrix);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomialMatrix_Determinant                                  *
+ *  Purpose:                                                                  *
+ *      Computes the determinant of a square matrix of polynomials using the  *
+ *      fraction-free Bareiss algorithm.                                      *
+ *  Arguments:                                                                *
+ *      det (tmpl_IntPolynomial *):                                           *
+ *          The output polynomial.                                            *
+ *      matrix (const tmpl_IntPolynomialMatrix *):                            *
+ *          A square matrix.                                                  *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Every intermediate entry of the Bareiss algorithm is a minor of the   *
+ *      matrix. If one of these does not fit in an int, the error_occurred    *
+ *      Boolean of det is set. The determinant of a 0x0 matrix is one.        *
+ ******************************************************************************/
+extern void
+tmpl_IntPolynomialMatrix_Determinant(tmpl_IntPolynomial *det,
+                                     const tmpl_IntPolynomialMatrix *matrix);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_IntPolynomialMatrix_Multiply                                     *
+ *  Purpose:                                                                  *
+ *      Computes the matrix product prod = A * B.                             *
+ *  Arguments:                                                                *
+ *      prod (tmpl_IntPolynomialMatrix *):                                    *
+ *          The output matrix. It may be the same as A or B.                  *
+ *      A (const tmpl_IntPolynomialMatrix *):                                 *
+ *          The first factor.                                                 *
+ *      B (const tmpl_IntPolynomialMatrix *):                                 *
+ *          The second factor. It must have as many rows as A has columns.    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The output is computed in tiles of TMPL_INTPOLYMAT_BLOCK_SIZE entries *
+ *      per side. With OpenMP the tiles are shared among the threads, and     *
+ *      each thread reuses one workspace for all of its entry products. The   *
+ *      result does not depend on the number of threads.                      *
+ ******************************************************************************/
+extern void
+tmpl_IntPolynomialMatrix_Multiply(tmpl_IntPolynomialMatrix *prod,
+                                  const tmpl_IntPolynomialMatrix *A,
+                                  const tmpl_IntPolynomialMatrix *B);
+
 /*  End of extern "C" statement allowing C++ compatibility.                   */
 #ifdef __cplusplus
 }
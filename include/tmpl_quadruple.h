@@ -1,5 +1,5 @@
 /******************************************************************************
- *                                 LICENSE                                    *
+ *                                  LICENSE                                   *
  ******************************************************************************
  *  This file is part of libtmpl.                                             *
  *                                                                            *
@@ -15,39 +15,338 @@
  *                                                                            *
  *  You should have received a copy of the GNU General Public License         *
  *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                               tmpl_quadruple                               *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides software IEEE-754 binary128 (quadruple precision) numbers.   *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file containing Booleans.                                  *
+ *  2.) tmpl_quadruple.h (types):                                             *
+ *          Header file with the quadruple typedefs.                          *
+ ******************************************************************************
+ *                            A NOTE ON ROUNDING                              *
+ ******************************************************************************
+ *  All operations round to nearest, ties to even, and support subnormal      *
+ *  numbers. The arithmetic is correctly rounded. Floating-point exceptions   *
+ *  are not raised, and NaN payloads are not kept, every NaN result is the    *
+ *  default quiet NaN.                                                        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
  ******************************************************************************/
 
+/*  Include guard to prevent including this file twice.                       */
 #ifndef TMPL_QUADRUPLE_H
 #define TMPL_QUADRUPLE_H
 
+/*  If using with C++ (and not C) we need to wrap the entire header file in   *
+ *  an extern "C" statement. Check if C++ is being used with __cplusplus.     */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /*  Booleans found here.                                                      */
 #include <libtmpl/include/tmpl_bool.h>
 
-/*  Use a bit-field to implement 128-bit quadruple precision. Unsigned int is *
- *  required to be at least 16 bits wide, so we can safely and portably       *
- *  create this struct. The IEEE format specify 112 bits for the mantissa, 15 *
- *  bits for the exponent, and 1 bit for the sign.                            */
-typedef struct tmpl_Quadruple_Def {
-    unsigned int mant1 : 16;
-    unsigned int mant2 : 16;
-    unsigned int mant3 : 16;
-    unsigned int mant4 : 16;
-    unsigned int mant5 : 16;
-    unsigned int mant6 : 16;
-    unsigned int mant7 : 16;
-    unsigned int exponent : 15;
-    unsigned int sign: 1;
-} tmpl_Quadruple;
+/*  tmpl_Quadruple and tmpl_UnpackedQuadruple typedefs provided here.         */
+#include <libtmpl/include/types/tmpl_quadruple.h>
 
+/*  Positive infinity, negative infinity, and the default quiet NaN.          */
 extern const tmpl_Quadruple tmpl_Quadruple_Inf;
 extern const tmpl_Quadruple tmpl_Quadruple_Neg_Inf;
 extern const tmpl_Quadruple tmpl_Quadruple_NaN;
 
-extern tmpl_Bool tmpl_Quaduple_Is_Zero(tmpl_Quadruple x);
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Quadruple_Is_Zero                                                *
+ *      tmpl_Quadruple_Is_Inf                                                 *
+ *      tmpl_Quadruple_Is_NaN                                                 *
+ *      tmpl_Quadruple_Is_Positive                                            *
+ *      tmpl_Quadruple_Is_Negative                                            *
+ *  Purpose:                                                                  *
+ *      Classifies a quadruple precision number.                              *
+ *  Arguments:                                                                *
+ *      x (tmpl_Quadruple):                                                   *
+ *          A number.                                                         *
+ *  Output:                                                                   *
+ *      is_kind (tmpl_Bool):                                                  *
+ *          True if x is of the given kind.                                   *
+ *  Notes:                                                                    *
+ *      Is_Positive and Is_Negative check the sign bit, and are false for     *
+ *      NaN. Zero has a sign, so +0 is positive and -0 is negative.           *
+ *  Source Code:                                                              *
+ *      libtmpl/src/quadruple/tmpl_classify_quadruple.c                       *
+ ******************************************************************************/
+extern tmpl_Bool tmpl_Quadruple_Is_Zero(tmpl_Quadruple x);
 extern tmpl_Bool tmpl_Quadruple_Is_Inf(tmpl_Quadruple x);
 extern tmpl_Bool tmpl_Quadruple_Is_NaN(tmpl_Quadruple x);
 extern tmpl_Bool tmpl_Quadruple_Is_Positive(tmpl_Quadruple x);
 extern tmpl_Bool tmpl_Quadruple_Is_Negative(tmpl_Quadruple x);
 
+/*  The arithmetic and conversions work with 64-bit limbs.                    */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Quadruple_Unpack                                                 *
+ *  Purpose:                                                                  *
+ *      Splits a number into sign, exponent, and significand.                 *
+ *  Arguments:                                                                *
+ *      x (tmpl_Quadruple):                                                   *
+ *          A number.                                                         *
+ *  Output:                                                                   *
+ *      out (tmpl_UnpackedQuadruple):                                         *
+ *          The unpacked form of x.                                           *
+ *  Notes:                                                                    *
+ *      Chained computations should unpack once, use the                      *
+ *      tmpl_UnpackedQuadruple functions, and pack the final result.          *
+ *  Source Code:                                                              *
+ *      libtmpl/src/quadruple/tmpl_unpack_quadruple.c                         *
+ ******************************************************************************/
+extern tmpl_UnpackedQuadruple tmpl_Quadruple_Unpack(tmpl_Quadruple x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Quadruple_Pack                                                   *
+ *  Purpose:                                                                  *
+ *      Packs an unpacked number into the binary128 bit-fields.               *
+ *  Arguments:                                                                *
+ *      x (const tmpl_UnpackedQuadruple * const):                             *
+ *          An unpacked number.                                               *
+ *  Output:                                                                   *
+ *      out (tmpl_Quadruple):                                                 *
+ *          The packed form of x.                                             *
+ *  Source Code:                                                              *
+ *      libtmpl/src/quadruple/tmpl_pack_quadruple.c                           *
+ ******************************************************************************/
+extern tmpl_Quadruple
+tmpl_Quadruple_Pack(const tmpl_UnpackedQuadruple * const x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_UnpackedQuadruple_Add                                            *
+ *      tmpl_UnpackedQuadruple_Subtract                                       *
+ *  Purpose:                                                                  *
+ *      Computes x + y, or x - y.                                             *
+ *  Arguments:                                                                *
+ *      x (const tmpl_UnpackedQuadruple * const):                             *
+ *          A number.                                                         *
+ *      y (const tmpl_UnpackedQuadruple * const):                             *
+ *          Another number.                                                   *
+ *  Output:                                                                   *
+ *      sum (tmpl_UnpackedQuadruple):                                         *
+ *          The correctly rounded sum or difference.                          *
+ *  Notes:                                                                    *
+ *      The tmpl_Quadruple version unpacks, calls this, and packs.            *
+ *  Source Code:                                                              *
+ *      libtmpl/src/quadruple/tmpl_add_quadruple.c                            *
+ ******************************************************************************/
+extern tmpl_UnpackedQuadruple
+tmpl_UnpackedQuadruple_Add(const tmpl_UnpackedQuadruple * const x,
+                           const tmpl_UnpackedQuadruple * const y);
+
+extern tmpl_UnpackedQuadruple
+tmpl_UnpackedQuadruple_Subtract(const tmpl_UnpackedQuadruple * const x,
+                                const tmpl_UnpackedQuadruple * const y);
+
 extern tmpl_Quadruple tmpl_Quadruple_Add(tmpl_Quadruple x, tmpl_Quadruple y);
+extern tmpl_Quadruple
+tmpl_Quadruple_Subtract(tmpl_Quadruple x, tmpl_Quadruple y);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_UnpackedQuadruple_Multiply                                       *
+ *  Purpose:                                                                  *
+ *      Computes x * y.                                                       *
+ *  Arguments:                                                                *
+ *      x (const tmpl_UnpackedQuadruple * const):                             *
+ *          A number.                                                         *
+ *      y (const tmpl_UnpackedQuadruple * const):                             *
+ *          Another number.                                                   *
+ *  Output:                                                                   *
+ *      prod (tmpl_UnpackedQuadruple):                                        *
+ *          The correctly rounded product.                                    *
+ *  Notes:                                                                    *
+ *      The tmpl_Quadruple version unpacks, calls this, and packs.            *
+ *  Source Code:                                                              *
+ *      libtmpl/src/quadruple/tmpl_multiply_quadruple.c                       *
+ ******************************************************************************/
+extern tmpl_UnpackedQuadruple
+tmpl_UnpackedQuadruple_Multiply(const tmpl_UnpackedQuadruple * const x,
+                                const tmpl_UnpackedQuadruple * const y);
+
+extern tmpl_Quadruple
+tmpl_Quadruple_Multiply(tmpl_Quadruple x, tmpl_Quadruple y);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_UnpackedQuadruple_Divide                                         *
+ *  Purpose:                                                                  *
+ *      Computes x / y.                                                       *
+ *  Arguments:                                                                *
+ *      x (const tmpl_UnpackedQuadruple * const):                             *
+ *          A number.                                                         *
+ *      y (const tmpl_UnpackedQuadruple * const):                             *
+ *          Another number.                                                   *
+ *  Output:                                                                   *
+ *      quot (tmpl_UnpackedQuadruple):                                        *
+ *          The correctly rounded quotient.                                   *
+ *  Notes:                                                                    *
+ *      Division of a non-zero number by zero gives a signed infinity.        *
+ *      The tmpl_Quadruple version unpacks, calls this, and packs.            *
+ *  Source Code:                                                              *
+ *      libtmpl/src/quadruple/tmpl_divide_quadruple.c                         *
+ ******************************************************************************/
+extern tmpl_UnpackedQuadruple
+tmpl_UnpackedQuadruple_Divide(const tmpl_UnpackedQuadruple * const x,
+                              const tmpl_UnpackedQuadruple * const y);
+
+extern tmpl_Quadruple tmpl_Quadruple_Divide(tmpl_Quadruple x, tmpl_Quadruple y);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_UnpackedQuadruple_Sqrt                                           *
+ *  Purpose:                                                                  *
+ *      Computes the square root of x.                                        *
+ *  Arguments:                                                                *
+ *      x (const tmpl_UnpackedQuadruple * const):                             *
+ *          A number.                                                         *
+ *  Output:                                                                   *
+ *      sqrt_x (tmpl_UnpackedQuadruple):                                      *
+ *          The correctly rounded square root.                                *
+ *  Notes:                                                                    *
+ *      Negative inputs give NaN, and sqrt(-0) = -0.                          *
+ *      The tmpl_Quadruple version unpacks, calls this, and packs.            *
+ *  Source Code:                                                              *
+ *      libtmpl/src/quadruple/tmpl_sqrt_quadruple.c                           *
+ ******************************************************************************/
+extern tmpl_UnpackedQuadruple
+tmpl_UnpackedQuadruple_Sqrt(const tmpl_UnpackedQuadruple * const x);
+
+extern tmpl_Quadruple tmpl_Quadruple_Sqrt(tmpl_Quadruple x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_UnpackedQuadruple_FMA                                            *
+ *  Purpose:                                                                  *
+ *      Computes x * y + z with a single rounding.                            *
+ *  Arguments:                                                                *
+ *      x (const tmpl_UnpackedQuadruple * const):                             *
+ *          A number.                                                         *
+ *      y (const tmpl_UnpackedQuadruple * const):                             *
+ *          Another number.                                                   *
+ *      z (const tmpl_UnpackedQuadruple * const):                             *
+ *          The number that is added.                                         *
+ *  Output:                                                                   *
+ *      fma (tmpl_UnpackedQuadruple):                                         *
+ *          The correctly rounded value of x * y + z.                         *
+ *  Notes:                                                                    *
+ *      The tmpl_Quadruple version unpacks, calls this, and packs.            *
+ *  Source Code:                                                              *
+ *      libtmpl/src/quadruple/tmpl_fma_quadruple.c                            *
+ ******************************************************************************/
+extern tmpl_UnpackedQuadruple
+tmpl_UnpackedQuadruple_FMA(const tmpl_UnpackedQuadruple * const x,
+                           const tmpl_UnpackedQuadruple * const y,
+                           const tmpl_UnpackedQuadruple * const z);
+
+extern tmpl_Quadruple
+tmpl_Quadruple_FMA(tmpl_Quadruple x, tmpl_Quadruple y, tmpl_Quadruple z);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Quadruple_From_Double                                            *
+ *      tmpl_Quadruple_From_LDouble                                           *
+ *  Purpose:                                                                  *
+ *      Converts a double or long double to quadruple precision.              *
+ *  Arguments:                                                                *
+ *      x (double):                                                           *
+ *          A real number.                                                    *
+ *  Output:                                                                   *
+ *      out (tmpl_Quadruple):                                                 *
+ *          The number x as a quadruple.                                      *
+ *  Notes:                                                                    *
+ *      The conversion is exact, except for double-double long double         *
+ *      values that need more than 113 bits, which are rounded.               *
+ *  Source Code:                                                              *
+ *      libtmpl/src/quadruple/tmpl_from_double_quadruple.c                    *
+ *      libtmpl/src/quadruple/tmpl_from_ldouble_quadruple.c                   *
+ ******************************************************************************/
+extern tmpl_Quadruple tmpl_Quadruple_From_Double(double x);
+extern tmpl_Quadruple tmpl_Quadruple_From_LDouble(long double x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Quadruple_To_Double                                              *
+ *      tmpl_Quadruple_To_LDouble                                             *
+ *  Purpose:                                                                  *
+ *      Converts a quadruple to double or long double.                        *
+ *  Arguments:                                                                *
+ *      x (tmpl_Quadruple):                                                   *
+ *          A number.                                                         *
+ *  Output:                                                                   *
+ *      out (double):                                                         *
+ *          The number x correctly rounded to a double.                       *
+ *  Notes:                                                                    *
+ *      Results that are subnormal in the narrower format are rounded once.   *
+ *  Source Code:                                                              *
+ *      libtmpl/src/quadruple/tmpl_to_double_quadruple.c                      *
+ *      libtmpl/src/quadruple/tmpl_to_ldouble_quadruple.c                     *
+ ******************************************************************************/
+extern double tmpl_Quadruple_To_Double(tmpl_Quadruple x);
+extern long double tmpl_Quadruple_To_LDouble(tmpl_Quadruple x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Quadruple_From_String                                            *
+ *  Purpose:                                                                  *
+ *      Converts a decimal string to quadruple precision.                     *
+ *  Arguments:                                                                *
+ *      str (const char *):                                                   *
+ *          A number such as "-1.25e-3", "inf", or "nan". Leading and         *
+ *          trailing white space is allowed.                                  *
+ *  Output:                                                                   *
+ *      out (tmpl_Quadruple):                                                 *
+ *          The correctly rounded value of str. NaN if str is NULL or         *
+ *          is not a number.                                                  *
+ *  Notes:                                                                    *
+ *      The conversion is exact, using arbitrary-precision integers, so       *
+ *      any number of digits may be given.                                    *
+ *  Source Code:                                                              *
+ *      libtmpl/src/quadruple/tmpl_from_string_quadruple.c                    *
+ ******************************************************************************/
+extern tmpl_Quadruple tmpl_Quadruple_From_String(const char *str);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Quadruple_To_String                                              *
+ *  Purpose:                                                                  *
+ *      Converts a quadruple to a decimal string.                             *
+ *  Arguments:                                                                *
+ *      x (tmpl_Quadruple):                                                   *
+ *          A number.                                                         *
+ *  Output:                                                                   *
+ *      str (char *):                                                         *
+ *          The value of x with 36 significant digits, correctly rounded,     *
+ *          in the form "-d.ddde+dd". 36 digits are enough to read the        *
+ *          number back exactly. NULL if malloc fails. The caller must        *
+ *          free this.                                                        *
+ *  Source Code:                                                              *
+ *      libtmpl/src/quadruple/tmpl_to_string_quadruple.c                      *
+ ******************************************************************************/
+extern char *tmpl_Quadruple_To_String(tmpl_Quadruple x);
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
+
+/*  End of extern "C" statement allowing C++ compatibility.                   */
+#ifdef __cplusplus
+}
+#endif
+
 #endif
+/*  End of include guard.                                                     */
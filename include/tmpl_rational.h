@@ -26,7 +26,7 @@
  *  1.) tmpl_bool.h:                                                          *
  *          Header file containing Booleans.                                  *
  *  2.) stdio.h:                                                              *
- *          C Standard header file containing FILE type.                      *
+ *          C Standard header file containing FILE and size_t types.          *
  ******************************************************************************
  *                            A NOTE ON COMMENTS                              *
  ******************************************************************************
@@ -111,6 +111,98 @@ tmpl_RationalNumber_Add(const tmpl_RationalNumber *p,
 extern void
 tmpl_RationalNumber_AddTo(tmpl_RationalNumber *p, const tmpl_RationalNumber *q);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_RationalNumber_Checked_Add                                       *
+ *  Purpose:                                                                  *
+ *      Adds two rational numbers, checking for overflow. The inputs are      *
+ *      reduced first and the sum is computed with Henrici's algorithm, so    *
+ *      the result is in lowest terms. Unlike tmpl_RationalNumber_Add, this   *
+ *      never overflows silently. A similar function is provided for          *
+ *      subtraction.                                                          *
+ *  Arguments:                                                                *
+ *      p (const tmpl_RationalNumber *):                                      *
+ *          A rational number.                                                *
+ *      q (const tmpl_RationalNumber *):                                      *
+ *          Another rational number.                                          *
+ *      out (tmpl_RationalNumber *):                                          *
+ *          The sum of p and q.                                               *
+ *  Output:                                                                   *
+ *      success (tmpl_Bool):                                                  *
+ *          True if the result fits in signed longs, false otherwise.         *
+ *  Source Code:                                                              *
+ *      libtmpl/src/rational/tmpl_rational_checked_add.c                      *
+ ******************************************************************************/
+extern tmpl_Bool
+tmpl_RationalNumber_Checked_Add(const tmpl_RationalNumber *p,
+                                const tmpl_RationalNumber *q,
+                                tmpl_RationalNumber *out);
+
+extern tmpl_Bool
+tmpl_RationalNumber_Checked_Subtract(const tmpl_RationalNumber *p,
+                                     const tmpl_RationalNumber *q,
+                                     tmpl_RationalNumber *out);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_RationalNumber_Checked_Multiply                                  *
+ *  Purpose:                                                                  *
+ *      Multiplies two rational numbers, checking for overflow. Common        *
+ *      factors are cancelled first, so the result is in lowest terms. A      *
+ *      similar function is provided for division.                            *
+ *  Arguments:                                                                *
+ *      p (const tmpl_RationalNumber *):                                      *
+ *          A rational number.                                                *
+ *      q (const tmpl_RationalNumber *):                                      *
+ *          Another rational number.                                          *
+ *      out (tmpl_RationalNumber *):                                          *
+ *          The product of p and q.                                           *
+ *  Output:                                                                   *
+ *      success (tmpl_Bool):                                                  *
+ *          True if the result fits in signed longs, false otherwise.         *
+ *  Source Code:                                                              *
+ *      libtmpl/src/rational/tmpl_rational_checked_multiply.c                 *
+ ******************************************************************************/
+extern tmpl_Bool
+tmpl_RationalNumber_Checked_Multiply(const tmpl_RationalNumber *p,
+                                     const tmpl_RationalNumber *q,
+                                     tmpl_RationalNumber *out);
+
+extern tmpl_Bool
+tmpl_RationalNumber_Checked_Divide(const tmpl_RationalNumber *p,
+                                   const tmpl_RationalNumber *q,
+                                   tmpl_RationalNumber *out);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_RationalNumber_Array_Sum                                         *
+ *  Purpose:                                                                  *
+ *      Computes the exact sum of an array of rational numbers, in lowest     *
+ *      terms, checking for overflow. A similar function is provided for      *
+ *      the product.                                                          *
+ *  Arguments:                                                                *
+ *      arr (const tmpl_RationalNumber *):                                    *
+ *          An array of rational numbers.                                     *
+ *      len (size_t):                                                         *
+ *          The number of elements in arr.                                    *
+ *      out (tmpl_RationalNumber *):                                          *
+ *          The sum of the elements of arr.                                   *
+ *  Output:                                                                   *
+ *      success (tmpl_Bool):                                                  *
+ *          True if the result fits in signed longs, false otherwise.         *
+ *  Source Code:                                                              *
+ *      libtmpl/src/rational/tmpl_rational_array_sum.c                        *
+ ******************************************************************************/
+extern tmpl_Bool
+tmpl_RationalNumber_Array_Sum(const tmpl_RationalNumber *arr,
+                              size_t len,
+                              tmpl_RationalNumber *out);
+
+extern tmpl_Bool
+tmpl_RationalNumber_Array_Product(const tmpl_RationalNumber *arr,
+                                  size_t len,
+                                  tmpl_RationalNumber *out);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      tmpl_RationalNumber_Create                                            *
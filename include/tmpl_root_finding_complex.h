@@ -24,6 +24,9 @@
 #include <libtmpl/include/tmpl_complex.h>
 #include <stddef.h>
 
+/*  Batched root finders with at least this many seeds use OpenMP.            */
+#define TMPL_ROOT_FINDING_COMPLEX_PARALLEL_MIN_LENGTH ((size_t)1024)
+
 extern tmpl_ComplexDouble
 tmpl_CDouble_Halleys_Method_Explicit_With_Vars(
     tmpl_ComplexDouble z,
@@ -69,4 +72,65 @@ tmpl_CDouble_Newtons_Method_Polynomial(
     const double * const coeffs, size_t degree
 );
 
+extern size_t
+tmpl_CDouble_Newtons_Method_Explicit_Array(
+    const tmpl_ComplexDouble * const z,
+    tmpl_ComplexDouble (*f)(tmpl_ComplexDouble),
+    tmpl_ComplexDouble (*f_prime)(tmpl_ComplexDouble),
+    tmpl_ComplexDouble * const roots, size_t len,
+    unsigned int max_iters, double eps
+);
+
+extern size_t
+tmpl_CDouble_Halleys_Method_Explicit_Array(
+    const tmpl_ComplexDouble * const z,
+    tmpl_ComplexDouble (*f)(tmpl_ComplexDouble),
+    tmpl_ComplexDouble (*f_prime)(tmpl_ComplexDouble),
+    tmpl_ComplexDouble (*f_2prime)(tmpl_ComplexDouble),
+    tmpl_ComplexDouble * const roots, size_t len,
+    unsigned int max_iters, double eps
+);
+
+extern size_t
+tmpl_CDouble_Newtons_Method_Polynomial_Array(
+    const tmpl_ComplexDouble * const z,
+    const double * const coeffs, size_t degree,
+    tmpl_ComplexDouble * const roots, size_t len,
+    unsigned int max_iters, double eps
+);
+
+extern size_t
+tmpl_CDouble_Halleys_Method_Polynomial_Array(
+    const tmpl_ComplexDouble * const z,
+    const double * const coeffs, size_t degree,
+    tmpl_ComplexDouble * const roots, size_t len,
+    unsigned int max_iters, double eps
+);
+
+extern size_t
+tmpl_CDouble_Aberth_Ehrlich_Polynomial_With_Vars(
+    const tmpl_ComplexDouble * const coeffs, size_t degree,
+    tmpl_ComplexDouble * const roots,
+    unsigned int max_iters, double eps
+);
+
+extern size_t
+tmpl_CDouble_Aberth_Ehrlich_Polynomial(
+    const tmpl_ComplexDouble * const coeffs, size_t degree,
+    tmpl_ComplexDouble * const roots
+);
+
+extern size_t
+tmpl_CDouble_Aberth_Ehrlich_Polynomial_Real_Coeffs_With_Vars(
+    const double * const coeffs, size_t degree,
+    tmpl_ComplexDouble * const roots,
+    unsigned int max_iters, double eps
+);
+
+extern size_t
+tmpl_CDouble_Aberth_Ehrlich_Polynomial_Real_Coeffs(
+    const double * const coeffs, size_t degree,
+    tmpl_ComplexDouble * const roots
+);
+
 #endif
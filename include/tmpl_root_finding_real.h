@@ -2,6 +2,11 @@
 #ifndef TMPL_ROOT_FINDING_REAL_H
 #define TMPL_ROOT_FINDING_REAL_H
 
+#include <stddef.h>
+
+/*  Dual number typedef provided here.                                        */
+#include <libtmpl/include/types/tmpl_dual_double.h>
+
 extern float
 tmpl_Newton_Raphson_Float(float x, float (*f)(float), float (*f_prime)(float),
                           unsigned int max_iters, float eps);
@@ -16,6 +21,11 @@ tmpl_Newton_Raphson_LDouble(long double x, long double (*f)(long double),
                             long double (*f_prime)(long double),
                             unsigned int max_iters, long double eps);
 
+extern double
+tmpl_Newton_Raphson_Dual_Double(double x,
+                                tmpl_DualDouble (*f)(tmpl_DualDouble),
+                                unsigned int max_iters, double eps);
+
 extern float
 tmpl_Halleys_Method_Float(float x, float (*f)(float),
                           float (*f_prime)(float),
@@ -34,4 +44,128 @@ tmpl_Halleys_Method_LDouble(long double x, long double (*f)(long double),
                             long double (*f_2prime)(long double),
                             unsigned int max_iters, long double eps);
 
+extern size_t
+tmpl_Newton_Raphson_Float_Array(const float * const x,
+                                float (*f)(float),
+                                float (*f_prime)(float),
+                                float * const roots,
+                                size_t len,
+                                unsigned int max_iters,
+                                float eps);
+
+extern size_t
+tmpl_Newton_Raphson_Double_Array(const double * const x,
+                                 double (*f)(double),
+                                 double (*f_prime)(double),
+                                 double * const roots,
+                                 size_t len,
+                                 unsigned int max_iters,
+                                 double eps);
+
+extern size_t
+tmpl_Newton_Raphson_LDouble_Array(const long double * const x,
+                                  long double (*f)(long double),
+                                  long double (*f_prime)(long double),
+                                  long double * const roots,
+                                  size_t len,
+                                  unsigned int max_iters,
+                                  long double eps);
+
+extern size_t
+tmpl_Halleys_Method_Float_Array(const float * const x,
+                                float (*f)(float),
+                                float (*f_prime)(float),
+                                float (*f_2prime)(float),
+                                float * const roots,
+                                size_t len,
+                                unsigned int max_iters,
+                                float eps);
+
+extern size_t
+tmpl_Halleys_Method_Double_Array(const double * const x,
+                                 double (*f)(double),
+                                 double (*f_prime)(double),
+                                 double (*f_2prime)(double),
+                                 double * const roots,
+                                 size_t len,
+                                 unsigned int max_iters,
+                                 double eps);
+
+extern size_t
+tmpl_Halleys_Method_LDouble_Array(const long double * const x,
+                                  long double (*f)(long double),
+                                  long double (*f_prime)(long double),
+                                  long double (*f_2prime)(long double),
+                                  long double * const roots,
+                                  size_t len,
+                                  unsigned int max_iters,
+                                  long double eps);
+
+
+extern float
+tmpl_Brents_Method_Float(float a,
+                         float b,
+                         float (*f)(float),
+                         unsigned int max_iters,
+                         float eps);
+
+extern double
+tmpl_Brents_Method_Double(double a,
+                          double b,
+                          double (*f)(double),
+                          unsigned int max_iters,
+                          double eps);
+
+extern long double
+tmpl_Brents_Method_LDouble(long double a,
+                           long double b,
+                           long double (*f)(long double),
+                           unsigned int max_iters,
+                           long double eps);
+
+extern float
+tmpl_Newton_Bisection_Float(float a,
+                            float b,
+                            float (*f)(float),
+                            float (*f_prime)(float),
+                            unsigned int max_iters,
+                            float eps);
+
+extern double
+tmpl_Newton_Bisection_Double(double a,
+                             double b,
+                             double (*f)(double),
+                             double (*f_prime)(double),
+                             unsigned int max_iters,
+                             double eps);
+
+extern long double
+tmpl_Newton_Bisection_LDouble(long double a,
+                              long double b,
+                              long double (*f)(long double),
+                              long double (*f_prime)(long double),
+                              unsigned int max_iters,
+                              long double eps);
+
+extern float
+tmpl_ITP_Method_Float(float a,
+                      float b,
+                      float (*f)(float),
+                      unsigned int max_iters,
+                      float eps);
+
+extern double
+tmpl_ITP_Method_Double(double a,
+                       double b,
+                       double (*f)(double),
+                       unsigned int max_iters,
+                       double eps);
+
+extern long double
+tmpl_ITP_Method_LDouble(long double a,
+                        long double b,
+                        long double (*f)(long double),
+                        unsigned int max_iters,
+                        long double eps);
+
 #endif
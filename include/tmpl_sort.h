@@ -55,6 +55,38 @@ int tmpl_Double_Merge_Sort(double *arr, size_t arr_size);
 int tmpl_Float_Merge_Sort(float *arr, size_t arr_size);
 int tmpl_LDouble_Merge_Sort(long double *arr, size_t arr_size);
 
+/*  Arrays shorter than this are sorted serially by the parallel routines.    *
+ *  Below this size the cost of waking the threads dominates the sort.        */
+#ifndef TMPL_PARALLEL_SORT_MIN_LENGTH
+#define TMPL_PARALLEL_SORT_MIN_LENGTH ((size_t)65536)
+#endif
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Double_Parallel_Merge_Sort                                       *
+ *  Purpose:                                                                  *
+ *      Sorts an array of real numbers using a multi-threaded merge sort.     *
+ *  Arguments:                                                                *
+ *      double *arr:                                                          *
+ *          An array of real numbers.                                         *
+ *      size_t len:                                                           *
+ *          The number of elements in the array.                              *
+ *  Output:                                                                   *
+ *      int success:                                                          *
+ *          0 if fail (malloc returns NULL), 1 if successful.                 *
+ *  Notes:                                                                    *
+ *      Each thread sorts a contiguous run of the array, and the runs are     *
+ *      then merged pairwise, with every merge split across all threads. The  *
+ *      sort is stable, O(N log(N)) in time, and O(N) extra in space.         *
+ *                                                                            *
+ *      If libtmpl is built without OpenMP, or if the array has fewer than    *
+ *      TMPL_PARALLEL_SORT_MIN_LENGTH elements, this falls back to the serial *
+ *      merge sort. If malloc fails the data is untouched and 0 is returned.  *
+ ******************************************************************************/
+int tmpl_Double_Parallel_Merge_Sort(double *arr, size_t len);
+int tmpl_Float_Parallel_Merge_Sort(float *arr, size_t len);
+int tmpl_LDouble_Parallel_Merge_Sort(long double *arr, size_t len);
+
 /*  End of extern "C" statement allowing C++ compatibility.                   */
 #ifdef __cplusplus
 }
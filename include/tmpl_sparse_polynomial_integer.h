@@ -25,7 +25,9 @@
  ******************************************************************************
  *  1.) tmpl_bool.h:                                                          *
  *          Header file containing Booleans.                                  *
- *  2.) stdio.h:                                                              *
+ *  2.) tmpl_polynomial_int.h:                                                *
+ *          Header file with the dense tmpl_IntPolynomial type.               *
+ *  3.) stdio.h:                                                              *
  *          Standard C header file containing the FILE data type.             *
  ******************************************************************************
  *  Author:     Ryan Maguire                                                  *
@@ -41,6 +43,9 @@
  *      Moved integer data type to own file. Added more data types (int etc.).*
  *  2023/02/10: Ryan Maguire                                                  *
  *      Moved sparse polynomials here from regular polynomials.               *
+ *  2026/10/18: Ryan Maguire                                                  *
+ *      Added arithmetic, evaluation, and conversion to and from dense        *
+ *      polynomials.                                                          *
  ******************************************************************************/
 
 /*  Include guard to prevent including this file twice.                       */
@@ -59,6 +64,9 @@ extern "C" {
 /*  Booleans located here.                                                    */
 #include <libtmpl/include/tmpl_bool.h>
 
+/*  Dense polynomial type, for converting to and from sparse ones.            */
+#include <libtmpl/include/types/tmpl_polynomial_int.h>
+
 /*  The size_t data type is found here.                                       */
 #include <stddef.h>
 
@@ -86,6 +94,162 @@ typedef struct tmpl_SparseIntPolynomial_Def {
     char *error_message;
 } tmpl_SparseIntPolynomial;
 
+/*  The functions below expect, and produce, polynomials in canonical form.   *
+ *  The degrees are strictly increasing and every term is non-zero. The zero  *
+ *  polynomial has no terms. Coefficients are computed with unsigned long     *
+ *  arithmetic, so overflow wraps around.                                     */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_SparseIntPolynomial_Add                                          *
+ *  Purpose:                                                                  *
+ *      Computes sum = P + Q by merging the two lists of terms.               *
+ *  Arguments:                                                                *
+ *      sum (tmpl_SparseIntPolynomial *):                                     *
+ *          The output polynomial. It may be the same as P or Q.              *
+ *      P (const tmpl_SparseIntPolynomial *):                                 *
+ *          The first polynomial.                                             *
+ *      Q (const tmpl_SparseIntPolynomial *):                                 *
+ *          The second polynomial.                                            *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      This is O(t1 + t2) for t1 and t2 terms. NULL inputs are zero.         *
+ ******************************************************************************/
+extern void
+tmpl_SparseIntPolynomial_Add(tmpl_SparseIntPolynomial *sum,
+                             const tmpl_SparseIntPolynomial *P,
+                             const tmpl_SparseIntPolynomial *Q);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_SparseIntPolynomial_Create_From_Data                             *
+ *  Purpose:                                                                  *
+ *      Creates a sparse polynomial from coefficients and their degrees.      *
+ *  Arguments:                                                                *
+ *      terms (const signed long int *):                                      *
+ *          The coefficients of the terms.                                    *
+ *      degrees (const size_t *):                                             *
+ *          The degrees of the terms.                                         *
+ *      len (size_t):                                                         *
+ *          The number of elements in terms and degrees.                      *
+ *  Output:                                                                   *
+ *      poly (tmpl_SparseIntPolynomial):                                      *
+ *          The sum of the terms, in canonical form.                          *
+ *  Notes:                                                                    *
+ *      The terms may be in any order and degrees may repeat.                 *
+ ******************************************************************************/
+extern tmpl_SparseIntPolynomial
+tmpl_SparseIntPolynomial_Create_From_Data(const signed long int *terms,
+                                          const size_t *degrees,
+                                          size_t len);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_SparseIntPolynomial_Destroy                                      *
+ *  Purpose:                                                                  *
+ *      Frees all of the memory in a sparse polynomial.                       *
+ *  Arguments:                                                                *
+ *      poly (tmpl_SparseIntPolynomial *):                                    *
+ *          The polynomial that is to be destroyed.                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void tmpl_SparseIntPolynomial_Destroy(tmpl_SparseIntPolynomial *poly);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_SparseIntPolynomial_Eval                                         *
+ *  Purpose:                                                                  *
+ *      Evaluates a sparse polynomial at an integer.                          *
+ *  Arguments:                                                                *
+ *      poly (const tmpl_SparseIntPolynomial *):                              *
+ *          The polynomial that is evaluated.                                 *
+ *      x (signed long int):                                                  *
+ *          The point poly is evaluated at.                                   *
+ *  Output:                                                                   *
+ *      eval (signed long int):                                               *
+ *          The value poly(x), modulo 2^N where N is the width of long.       *
+ *  Notes:                                                                    *
+ *      Horner's method over the terms, O(t log(deg)).                        *
+ ******************************************************************************/
+extern signed long int
+tmpl_SparseIntPolynomial_Eval(const tmpl_SparseIntPolynomial *poly,
+                              signed long int x);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_SparseIntPolynomial_From_Dense                                   *
+ *  Purpose:                                                                  *
+ *      Converts a dense polynomial into a sparse one.                        *
+ *  Arguments:                                                                *
+ *      sparse (tmpl_SparseIntPolynomial *):                                  *
+ *          The output polynomial.                                            *
+ *      dense (const tmpl_IntPolynomial *):                                   *
+ *          The polynomial that is converted.                                 *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+tmpl_SparseIntPolynomial_From_Dense(tmpl_SparseIntPolynomial *sparse,
+                                    const tmpl_IntPolynomial *dense);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_SparseIntPolynomial_Init                                         *
+ *  Purpose:                                                                  *
+ *      Initializes a sparse polynomial to zero, with NULL pointers.          *
+ *  Arguments:                                                                *
+ *      poly (tmpl_SparseIntPolynomial *):                                    *
+ *          The polynomial that is to be initialized.                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void tmpl_SparseIntPolynomial_Init(tmpl_SparseIntPolynomial *poly);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_SparseIntPolynomial_Multiply                                     *
+ *  Purpose:                                                                  *
+ *      Computes prod = P * Q using Johnson's heap merge.                     *
+ *  Arguments:                                                                *
+ *      prod (tmpl_SparseIntPolynomial *):                                    *
+ *          The output polynomial. It may be the same as P or Q.              *
+ *      P (const tmpl_SparseIntPolynomial *):                                 *
+ *          The first factor.                                                 *
+ *      Q (const tmpl_SparseIntPolynomial *):                                 *
+ *          The second factor.                                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      This is O(t1 t2 log(min(t1, t2))) time and O(min(t1, t2)) working     *
+ *      memory for t1 and t2 terms, independent of the degrees.               *
+ ******************************************************************************/
+extern void
+tmpl_SparseIntPolynomial_Multiply(tmpl_SparseIntPolynomial *prod,
+                                  const tmpl_SparseIntPolynomial *P,
+                                  const tmpl_SparseIntPolynomial *Q);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_SparseIntPolynomial_To_Dense                                     *
+ *  Purpose:                                                                  *
+ *      Converts a sparse polynomial into a dense one.                        *
+ *  Arguments:                                                                *
+ *      dense (tmpl_IntPolynomial *):                                         *
+ *          The output polynomial.                                            *
+ *      sparse (const tmpl_SparseIntPolynomial *):                            *
+ *          The polynomial that is converted.                                 *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      If a coefficient does not fit in an int, the error_occurred Boolean   *
+ *      of dense is set.                                                      *
+ ******************************************************************************/
+extern void
+tmpl_SparseIntPolynomial_To_Dense(tmpl_IntPolynomial *dense,
+                                  const tmpl_SparseIntPolynomial *sparse);
+
 /*  End of extern "C" statement allowing C++ compatibility.                   */
 #ifdef __cplusplus
 }
@@ -0,0 +1,356 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                             tmpl_split_complex                             *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides complex vectors stored as two real arrays, one for the real  *
+ *      parts and one for the imaginary parts, and element-wise routines for  *
+ *      them. An array of tmpl_ComplexDouble interleaves the real and         *
+ *      imaginary parts, and a loop over it must shuffle every pair before    *
+ *      it can use SIMD instructions. With split storage the arithmetic is    *
+ *      the same as for real arrays, and compilers vectorize the loops.       *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_complex_double.h:                                                *
+ *          Header file with the tmpl_ComplexDouble typedef.                  *
+ *  2.) tmpl_complex_float.h:                                                 *
+ *          Header file with the tmpl_ComplexFloat typedef.                   *
+ *  3.) tmpl_split_complex_double.h:                                          *
+ *          Header file with the tmpl_SplitComplexDouble typedef.             *
+ *  4.) tmpl_split_complex_float.h:                                           *
+ *          Header file with the tmpl_SplitComplexFloat typedef.              *
+ ******************************************************************************
+ *                              A NOTE ON ERRORS                              *
+ ******************************************************************************
+ *  Routines that write to a split complex vector set its error_occurred      *
+ *  Boolean if an input is NULL, has an error, or has the wrong length.       *
+ *  Routines that write to a real array do nothing for such inputs. The       *
+ *  output may be the same vector as one of the inputs.                       *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_SPLIT_COMPLEX_H
+#define TMPL_SPLIT_COMPLEX_H
+
+/*  If using with C++ (and not C) we need to wrap the entire header file in   *
+ *  an extern "C" statement. Check if C++ is being used with __cplusplus.     */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*  Interleaved complex typedef's provided here.                              */
+#include <libtmpl/include/types/tmpl_complex_double.h>
+#include <libtmpl/include/types/tmpl_complex_float.h>
+
+/*  Split complex vector typedef's provided here.                             */
+#include <libtmpl/include/types/tmpl_split_complex_double.h>
+#include <libtmpl/include/types/tmpl_split_complex_float.h>
+
+/*  size_t typedef provided here.                                             */
+#include <stddef.h>
+
+/*  With OpenMP support, vectors with at least this many elements are split   *
+ *  across threads.                                                           */
+#ifndef TMPL_SPLIT_COMPLEX_PARALLEL_MIN_LENGTH
+#define TMPL_SPLIT_COMPLEX_PARALLEL_MIN_LENGTH ((size_t)16384)
+#endif
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_SplitComplexDouble_Create                                        *
+ *  Purpose:                                                                  *
+ *      Allocates memory for a split complex vector.                          *
+ *  Arguments:                                                                *
+ *      len (size_t):                                                         *
+ *          The number of elements.                                           *
+ *  Output:                                                                   *
+ *      vec (tmpl_SplitComplexDouble):                                        *
+ *          A vector with len elements. The values are not initialized.       *
+ *  Notes:                                                                    *
+ *      1.) If malloc fails the error_occurred Boolean is set. len = 0 is     *
+ *          allowed and gives an empty vector.                                *
+ *                                                                            *
+ *      2.) The output must be freed with tmpl_SplitComplexDouble_Destroy.    *
+ *  Source Code:                                                              *
+ *      libtmpl/src/split_complex/                                            *
+ *          tmpl_create_split_complex_double.c                                *
+ *          tmpl_create_split_complex_float.c                                 *
+ ******************************************************************************/
+extern tmpl_SplitComplexFloat tmpl_SplitComplexFloat_Create(size_t len);
+extern tmpl_SplitComplexDouble tmpl_SplitComplexDouble_Create(size_t len);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_SplitComplexDouble_Destroy                                       *
+ *  Purpose:                                                                  *
+ *      Frees the memory in a split complex vector.                           *
+ *  Arguments:                                                                *
+ *      vec (tmpl_SplitComplexDouble * const):                                *
+ *          The vector. It is reset to an empty vector.                       *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Source Code:                                                              *
+ *      libtmpl/src/split_complex/                                            *
+ *          tmpl_destroy_split_complex_double.c                               *
+ *          tmpl_destroy_split_complex_float.c                                *
+ ******************************************************************************/
+extern void tmpl_SplitComplexFloat_Destroy(tmpl_SplitComplexFloat * const vec);
+
+extern void
+tmpl_SplitComplexDouble_Destroy(tmpl_SplitComplexDouble * const vec);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_SplitComplexDouble_From_Interleaved                              *
+ *  Purpose:                                                                  *
+ *      Creates a split complex vector from an array of complex numbers.      *
+ *  Arguments:                                                                *
+ *      z (const tmpl_ComplexDouble * const):                                 *
+ *          An array of complex numbers.                                      *
+ *      len (size_t):                                                         *
+ *          The number of elements of z.                                      *
+ *  Output:                                                                   *
+ *      vec (tmpl_SplitComplexDouble):                                        *
+ *          The vector with real[n] = Re(z[n]) and imag[n] = Im(z[n]).        *
+ *  Notes:                                                                    *
+ *      1.) If z is NULL with len > 0, or if malloc fails, the                *
+ *          error_occurred Boolean is set.                                    *
+ *                                                                            *
+ *      2.) The output must be freed with tmpl_SplitComplexDouble_Destroy.    *
+ *  Source Code:                                                              *
+ *      libtmpl/src/split_complex/                                            *
+ *          tmpl_from_interleaved_split_complex_double.c                      *
+ *          tmpl_from_interleaved_split_complex_float.c                       *
+ ******************************************************************************/
+extern tmpl_SplitComplexFloat
+tmpl_SplitComplexFloat_From_Interleaved(const tmpl_ComplexFloat * const z,
+                                        size_t len);
+
+extern tmpl_SplitComplexDouble
+tmpl_SplitComplexDouble_From_Interleaved(const tmpl_ComplexDouble * const z,
+                                         size_t len);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_SplitComplexDouble_To_Interleaved                                *
+ *  Purpose:                                                                  *
+ *      Copies a split complex vector to an array of complex numbers.         *
+ *  Arguments:                                                                *
+ *      vec (const tmpl_SplitComplexDouble * const):                          *
+ *          A split complex vector.                                           *
+ *      z (tmpl_ComplexDouble * const):                                       *
+ *          An array with room for vec->length complex numbers.               *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Source Code:                                                              *
+ *      libtmpl/src/split_complex/                                            *
+ *          tmpl_to_interleaved_split_complex_double.c                        *
+ *          tmpl_to_interleaved_split_complex_float.c                         *
+ ******************************************************************************/
+extern void
+tmpl_SplitComplexFloat_To_Interleaved(const tmpl_SplitComplexFloat * const vec,
+                                      tmpl_ComplexFloat * const z);
+
+extern void
+tmpl_SplitComplexDouble_To_Interleaved(
+    const tmpl_SplitComplexDouble * const vec,
+    tmpl_ComplexDouble * const z
+);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_SplitComplexDouble_Multiply                                      *
+ *      tmpl_SplitComplexDouble_Conj_Multiply                                 *
+ *  Purpose:                                                                  *
+ *      Computes the element-wise products x[n] y[n], or conj(x[n]) y[n].     *
+ *  Arguments:                                                                *
+ *      x (const tmpl_SplitComplexDouble * const):                            *
+ *          A split complex vector.                                           *
+ *      y (const tmpl_SplitComplexDouble * const):                            *
+ *          Another split complex vector, the same length as x.               *
+ *      prod (tmpl_SplitComplexDouble * const):                               *
+ *          The product, a vector the same length as x. This may be x or y.   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The conjugate product is the correlation kernel, avoiding a separate  *
+ *      pass to conjugate x.                                                  *
+ *  Source Code:                                                              *
+ *      libtmpl/src/split_complex/                                            *
+ *          tmpl_multiply_split_complex_double.c                              *
+ *          tmpl_multiply_split_complex_float.c                               *
+ *          tmpl_conj_multiply_split_complex_double.c                         *
+ *          tmpl_conj_multiply_split_complex_float.c                          *
+ ******************************************************************************/
+extern void
+tmpl_SplitComplexFloat_Multiply(const tmpl_SplitComplexFloat * const x,
+                                const tmpl_SplitComplexFloat * const y,
+                                tmpl_SplitComplexFloat * const prod);
+
+extern void
+tmpl_SplitComplexDouble_Multiply(const tmpl_SplitComplexDouble * const x,
+                                 const tmpl_SplitComplexDouble * const y,
+                                 tmpl_SplitComplexDouble * const prod);
+
+extern void
+tmpl_SplitComplexFloat_Conj_Multiply(const tmpl_SplitComplexFloat * const x,
+                                     const tmpl_SplitComplexFloat * const y,
+                                     tmpl_SplitComplexFloat * const prod);
+
+extern void
+tmpl_SplitComplexDouble_Conj_Multiply(const tmpl_SplitComplexDouble * const x,
+                                      const tmpl_SplitComplexDouble * const y,
+                                      tmpl_SplitComplexDouble * const prod);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_SplitComplexDouble_Multiply_Accumulate                           *
+ *  Purpose:                                                                  *
+ *      Computes acc[n] += x[n] y[n] for each element.                        *
+ *  Arguments:                                                                *
+ *      acc (tmpl_SplitComplexDouble * const):                                *
+ *          The accumulator. The products are added to it.                    *
+ *      x (const tmpl_SplitComplexDouble * const):                            *
+ *          A split complex vector, the same length as acc.                   *
+ *      y (const tmpl_SplitComplexDouble * const):                            *
+ *          Another split complex vector, the same length as acc.             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Source Code:                                                              *
+ *      libtmpl/src/split_complex/                                            *
+ *          tmpl_multiply_accumulate_split_complex_double.c                   *
+ *          tmpl_multiply_accumulate_split_complex_float.c                    *
+ ******************************************************************************/
+extern void
+tmpl_SplitComplexFloat_Multiply_Accumulate(
+    tmpl_SplitComplexFloat * const acc,
+    const tmpl_SplitComplexFloat * const x,
+    const tmpl_SplitComplexFloat * const y
+);
+
+extern void
+tmpl_SplitComplexDouble_Multiply_Accumulate(
+    tmpl_SplitComplexDouble * const acc,
+    const tmpl_SplitComplexDouble * const x,
+    const tmpl_SplitComplexDouble * const y
+);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_SplitComplexDouble_Abs                                           *
+ *      tmpl_SplitComplexDouble_Abs_Squared                                   *
+ *      tmpl_SplitComplexDouble_Arg                                           *
+ *  Purpose:                                                                  *
+ *      Computes |z[n]|, |z[n]|^2, or arg(z[n]) for each element.             *
+ *  Arguments:                                                                *
+ *      z (const tmpl_SplitComplexDouble * const):                            *
+ *          A split complex vector.                                           *
+ *      out (double * const):                                                 *
+ *          An array with room for z->length real numbers.                    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      1.) Abs avoids overflow and underflow, like tmpl_CDouble_Abs.         *
+ *          Abs_Squared is the plain sum of squares.                          *
+ *                                                                            *
+ *      2.) Arg returns values in [-pi, pi], like tmpl_CDouble_Argument.      *
+ *  Source Code:                                                              *
+ *      libtmpl/src/split_complex/                                            *
+ *          tmpl_abs_split_complex_double.c                                   *
+ *          tmpl_abs_split_complex_float.c                                    *
+ *          tmpl_abs_squared_split_complex_double.c                           *
+ *          tmpl_abs_squared_split_complex_float.c                            *
+ *          tmpl_arg_split_complex_double.c                                   *
+ *          tmpl_arg_split_complex_float.c                                    *
+ ******************************************************************************/
+extern void
+tmpl_SplitComplexFloat_Abs(const tmpl_SplitComplexFloat * const z,
+                           float * const out);
+
+extern void
+tmpl_SplitComplexDouble_Abs(const tmpl_SplitComplexDouble * const z,
+                            double * const out);
+
+extern void
+tmpl_SplitComplexFloat_Abs_Squared(const tmpl_SplitComplexFloat * const z,
+                                   float * const out);
+
+extern void
+tmpl_SplitComplexDouble_Abs_Squared(const tmpl_SplitComplexDouble * const z,
+                                    double * const out);
+
+extern void
+tmpl_SplitComplexFloat_Arg(const tmpl_SplitComplexFloat * const z,
+                           float * const out);
+
+extern void
+tmpl_SplitComplexDouble_Arg(const tmpl_SplitComplexDouble * const z,
+                            double * const out);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_SplitComplexDouble_Expi                                          *
+ *      tmpl_SplitComplexDouble_Polar                                         *
+ *  Purpose:                                                                  *
+ *      Computes exp(i theta[n]), or r[n] exp(i theta[n]), for each element.  *
+ *  Arguments:                                                                *
+ *      r (const double * const):                                             *
+ *          The magnitudes. Polar only.                                       *
+ *      theta (const double * const):                                         *
+ *          The angles.                                                       *
+ *      out (tmpl_SplitComplexDouble * const):                                *
+ *          The output vector. theta, and r, have out->length elements.       *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Source Code:                                                              *
+ *      libtmpl/src/split_complex/                                            *
+ *          tmpl_expi_split_complex_double.c                                  *
+ *          tmpl_expi_split_complex_float.c                                   *
+ *          tmpl_polar_split_complex_double.c                                 *
+ *          tmpl_polar_split_complex_float.c                                  *
+ ******************************************************************************/
+extern void
+tmpl_SplitComplexFloat_Expi(const float * const theta,
+                            tmpl_SplitComplexFloat * const out);
+
+extern void
+tmpl_SplitComplexDouble_Expi(const double * const theta,
+                             tmpl_SplitComplexDouble * const out);
+
+extern void
+tmpl_SplitComplexFloat_Polar(const float * const r,
+                             const float * const theta,
+                             tmpl_SplitComplexFloat * const out);
+
+extern void
+tmpl_SplitComplexDouble_Polar(const double * const r,
+                              const double * const theta,
+                              tmpl_SplitComplexDouble * const out);
+
+/*  End of extern "C" statement allowing C++ compatibility.                   */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/*  End of include guard.                                                     */
@@ -38,6 +38,8 @@
  *      Getting rid of -Wreserved-identifier warnings with clang.             *
  *  2022/12/22: Ryan Maguire                                                  *
  *      Splitting vector code into integer, real, and complex versions.       *
+ *  2026/10/18: Ryan Maguire                                                  *
+ *      Added the segmented prime sieve tmpl_ULong_Prime_Sieve.               *
  ******************************************************************************/
 
 /*  Include guard to prevent including this file twice.                       */
@@ -297,17 +299,59 @@ tmpl_ULongVector_Add(tmpl_ULongVector *v,
  ******************************************************************************/
 extern unsigned int tmpl_UIntVector_GCD(tmpl_UIntVector *arr);
 
+/*  Number of bytes in one segment of tmpl_ULong_Prime_Sieve. Each byte      *
+ *  holds eight odd numbers. The default is a typical L1 data cache size.     */
+#ifndef TMPL_PRIME_SIEVE_SEGMENT_BYTES
+#define TMPL_PRIME_SIEVE_SEGMENT_BYTES (32768)
+#endif
+
+/*  Function type for consuming primes. Return false to stop the sieve.       */
+typedef tmpl_Bool (*tmpl_ULongPrimeCallback)(unsigned long int prime,
+                                             void *data);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_ULong_Prime_Sieve                                                *
+ *  Purpose:                                                                  *
+ *      Computes all primes less than N with a segmented Sieve of             *
+ *      Eratosthenes, passing them to a callback in increasing order.         *
+ *  Arguments:                                                                *
+ *      N (unsigned long int):                                                *
+ *          The upper bound. Primes p with p < N are computed.                *
+ *      callback (tmpl_ULongPrimeCallback):                                   *
+ *          Function called once for each prime, in increasing order. If it   *
+ *          returns false, the sieve stops.                                   *
+ *      data (void *):                                                        *
+ *          Pointer passed along to the callback.                             *
+ *  Output:                                                                   *
+ *      success (tmpl_Bool):                                                  *
+ *          False if an allocation failed, true otherwise.                    *
+ *  Notes:                                                                    *
+ *      Only odd numbers are stored, one bit each, in segments of             *
+ *      TMPL_PRIME_SIEVE_SEGMENT_BYTES bytes. Memory use is independent of N, *
+ *      apart from the primes up to sqrt(N). With OpenMP the segments are     *
+ *      sieved in parallel, but the callback is always called from the        *
+ *      calling thread and in order, so it need not be thread safe.           *
+ ******************************************************************************/
+extern tmpl_Bool
+tmpl_ULong_Prime_Sieve(unsigned long int N,
+                       tmpl_ULongPrimeCallback callback,
+                       void *data);
+
 /******************************************************************************
  *  Function:                                                                 *
- *      tmpl_Sieve_of_Eratosthenes                                            *
+ *      tmpl_ULong_Sieve_of_Eratosthenes                                      *
  *  Purpose:                                                                  *
- *      Computes the first N prime numbers using the Sieve of Eratosthenes.   *
+ *      Computes all primes less than N using the Sieve of Eratosthenes.      *
  *  Arguments:                                                                *
- *      N (size_t):                                                           *
- *          The number of primes to compute.                                  *
+ *      N (unsigned long int):                                                *
+ *          The upper bound. Primes p with p < N are computed.                *
  *  Output:                                                                   *
  *      arr (tmpl_ULongVector *):                                             *
- *          The first N primes in order.                                      *
+ *          The primes less than N in increasing order.                       *
+ *  Notes:                                                                    *
+ *      This stores every prime. To consume primes as they are produced, use  *
+ *      tmpl_ULong_Prime_Sieve with a callback instead.                       *
  ******************************************************************************/
 extern tmpl_ULongVector *tmpl_ULong_Sieve_of_Eratosthenes(unsigned long int N);
 
@@ -4,6 +4,17 @@
 
 #include <stddef.h>
 
+/*  Packed bitmask and index list data types.                                 */
+#include <libtmpl/include/types/tmpl_where_indices.h>
+#include <libtmpl/include/types/tmpl_where_mask.h>
+
+/*  With OpenMP support, the _Mask and _Indices functions split arrays with   *
+ *  at least this many elements across threads. The output is the same for    *
+ *  any number of threads. Smaller arrays are processed serially.             */
+#ifndef TMPL_WHERE_PARALLEL_MIN_LENGTH
+#define TMPL_WHERE_PARALLEL_MIN_LENGTH ((size_t)262144)
+#endif
+
 extern size_t **
 tmpl_Where_Lesser_Char(char *data, size_t dim, double threshold);
 
@@ -115,5 +126,431 @@ extern size_t **
 tmpl_Where_LesserGreater_LDouble(long double *data, size_t dim,
                                  long double lower, long double upper);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Where_Greater_Double_Mask                                        *
+ *  Purpose:                                                                  *
+ *      Computes a packed bitmask of the elements with data[n] > threshold.   *
+ *  Arguments:                                                                *
+ *      data (const double *):                                                *
+ *          The array being searched.                                         *
+ *      dim (size_t):                                                         *
+ *          The number of elements in data.                                   *
+ *      threshold (double):                                                   *
+ *          The value the data is compared against.                           *
+ *  Output:                                                                   *
+ *      mask (tmpl_WhereMask):                                                *
+ *          Bit n % 8 of mask.bits[n / 8] is set if element n matched.        *
+ *          mask.count is the number of matches.                              *
+ *  Notes:                                                                    *
+ *      The data is read once with a branchless loop. The mask takes one bit  *
+ *      per element and must be freed with tmpl_WhereMask_Destroy. Versions   *
+ *      for all of the integer and real types are provided. Large arrays are  *
+ *      processed in parallel when OpenMP support is enabled.                 *
+ ******************************************************************************/
+extern tmpl_WhereMask
+tmpl_Where_Greater_Char_Mask(const char *data, size_t dim, double threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Greater_UChar_Mask(const unsigned char *data, size_t dim,
+                              double threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Greater_Short_Mask(const short *data, size_t dim, double threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Greater_UShort_Mask(const unsigned short *data, size_t dim,
+                               double threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Greater_Int_Mask(const int *data, size_t dim, double threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Greater_UInt_Mask(const unsigned int *data, size_t dim,
+                             double threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Greater_Long_Mask(const long *data, size_t dim, double threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Greater_ULong_Mask(const unsigned long *data, size_t dim,
+                              double threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Greater_Float_Mask(const float *data, size_t dim, float threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Greater_Double_Mask(const double *data, size_t dim,
+                               double threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Greater_LDouble_Mask(const long double *data, size_t dim,
+                                long double threshold);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Where_Lesser_Double_Mask                                         *
+ *  Purpose:                                                                  *
+ *      Computes a packed bitmask of the elements with data[n] < threshold.   *
+ *  Arguments:                                                                *
+ *      data (const double *):                                                *
+ *          The array being searched.                                         *
+ *      dim (size_t):                                                         *
+ *          The number of elements in data.                                   *
+ *      threshold (double):                                                   *
+ *          The value the data is compared against.                           *
+ *  Output:                                                                   *
+ *      mask (tmpl_WhereMask):                                                *
+ *          Bit n % 8 of mask.bits[n / 8] is set if element n matched.        *
+ *          mask.count is the number of matches.                              *
+ *  Notes:                                                                    *
+ *      The data is read once with a branchless loop. The mask takes one bit  *
+ *      per element and must be freed with tmpl_WhereMask_Destroy. Versions   *
+ *      for all of the integer and real types are provided. Large arrays are  *
+ *      processed in parallel when OpenMP support is enabled.                 *
+ ******************************************************************************/
+extern tmpl_WhereMask
+tmpl_Where_Lesser_Char_Mask(const char *data, size_t dim, double threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Lesser_UChar_Mask(const unsigned char *data, size_t dim,
+                             double threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Lesser_Short_Mask(const short *data, size_t dim, double threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Lesser_UShort_Mask(const unsigned short *data, size_t dim,
+                              double threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Lesser_Int_Mask(const int *data, size_t dim, double threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Lesser_UInt_Mask(const unsigned int *data, size_t dim,
+                            double threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Lesser_Long_Mask(const long *data, size_t dim, double threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Lesser_ULong_Mask(const unsigned long *data, size_t dim,
+                             double threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Lesser_Float_Mask(const float *data, size_t dim, float threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Lesser_Double_Mask(const double *data, size_t dim, double threshold);
+
+extern tmpl_WhereMask
+tmpl_Where_Lesser_LDouble_Mask(const long double *data, size_t dim,
+                               long double threshold);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Where_LesserGreater_Double_Mask                                  *
+ *  Purpose:                                                                  *
+ *      Computes a packed bitmask of the elements with lower < data[n] < upper*
+ *  Arguments:                                                                *
+ *      data (const double *):                                                *
+ *          The array being searched.                                         *
+ *      dim (size_t):                                                         *
+ *          The number of elements in data.                                   *
+ *      lower (double):                                                       *
+ *          The lower bound. Matching elements are strictly greater than this.*
+ *      upper (double):                                                       *
+ *          The upper bound. Matching elements are strictly less than this.   *
+ *  Output:                                                                   *
+ *      mask (tmpl_WhereMask):                                                *
+ *          Bit n % 8 of mask.bits[n / 8] is set if element n matched.        *
+ *          mask.count is the number of matches.                              *
+ *  Notes:                                                                    *
+ *      The data is read once with a branchless loop. The mask takes one bit  *
+ *      per element and must be freed with tmpl_WhereMask_Destroy. Versions   *
+ *      for all of the integer and real types are provided. Large arrays are  *
+ *      processed in parallel when OpenMP support is enabled.                 *
+ ******************************************************************************/
+extern tmpl_WhereMask
+tmpl_Where_LesserGreater_Char_Mask(const char *data, size_t dim,
+                                   double lower, double upper);
+
+extern tmpl_WhereMask
+tmpl_Where_LesserGreater_UChar_Mask(const unsigned char *data, size_t dim,
+                                    double lower, double upper);
+
+extern tmpl_WhereMask
+tmpl_Where_LesserGreater_Short_Mask(const short *data, size_t dim,
+                                    double lower, double upper);
+
+extern tmpl_WhereMask
+tmpl_Where_LesserGreater_UShort_Mask(const unsigned short *data, size_t dim,
+                                     double lower, double upper);
+
+extern tmpl_WhereMask
+tmpl_Where_LesserGreater_Int_Mask(const int *data, size_t dim,
+                                  double lower, double upper);
+
+extern tmpl_WhereMask
+tmpl_Where_LesserGreater_UInt_Mask(const unsigned int *data, size_t dim,
+                                   double lower, double upper);
+
+extern tmpl_WhereMask
+tmpl_Where_LesserGreater_Long_Mask(const long *data, size_t dim,
+                                   double lower, double upper);
+
+extern tmpl_WhereMask
+tmpl_Where_LesserGreater_ULong_Mask(const unsigned long *data, size_t dim,
+                                    double lower, double upper);
+
+extern tmpl_WhereMask
+tmpl_Where_LesserGreater_Float_Mask(const float *data, size_t dim,
+                                    float lower, float upper);
+
+extern tmpl_WhereMask
+tmpl_Where_LesserGreater_Double_Mask(const double *data, size_t dim,
+                                     double lower, double upper);
+
+extern tmpl_WhereMask
+tmpl_Where_LesserGreater_LDouble_Mask(const long double *data, size_t dim,
+                                      long double lower, long double upper);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Where_Greater_Double_Indices                                     *
+ *  Purpose:                                                                  *
+ *      Computes the indices of the elements with data[n] > threshold.        *
+ *  Arguments:                                                                *
+ *      data (const double *):                                                *
+ *          The array being searched.                                         *
+ *      dim (size_t):                                                         *
+ *          The number of elements in data.                                   *
+ *      threshold (double):                                                   *
+ *          The value the data is compared against.                           *
+ *  Output:                                                                   *
+ *      where (tmpl_WhereIndices):                                            *
+ *          The matching indices, in increasing order, and their number.      *
+ *  Notes:                                                                    *
+ *      The output is allocated exactly, the only transient memory used is a  *
+ *      bitmask with one bit per element. The result must be freed with       *
+ *      tmpl_WhereIndices_Destroy. Versions for all of the integer and real   *
+ *      types are provided. Large arrays are processed in parallel when       *
+ *      OpenMP support is enabled. The indices are in increasing order, and   *
+ *      are the same, for any number of threads.                              *
+ ******************************************************************************/
+extern tmpl_WhereIndices
+tmpl_Where_Greater_Char_Indices(const char *data, size_t dim, double threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Greater_UChar_Indices(const unsigned char *data, size_t dim,
+                                 double threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Greater_Short_Indices(const short *data, size_t dim,
+                                 double threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Greater_UShort_Indices(const unsigned short *data, size_t dim,
+                                  double threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Greater_Int_Indices(const int *data, size_t dim, double threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Greater_UInt_Indices(const unsigned int *data, size_t dim,
+                                double threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Greater_Long_Indices(const long *data, size_t dim, double threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Greater_ULong_Indices(const unsigned long *data, size_t dim,
+                                 double threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Greater_Float_Indices(const float *data, size_t dim,
+                                 float threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Greater_Double_Indices(const double *data, size_t dim,
+                                  double threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Greater_LDouble_Indices(const long double *data, size_t dim,
+                                   long double threshold);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Where_Lesser_Double_Indices                                      *
+ *  Purpose:                                                                  *
+ *      Computes the indices of the elements with data[n] < threshold.        *
+ *  Arguments:                                                                *
+ *      data (const double *):                                                *
+ *          The array being searched.                                         *
+ *      dim (size_t):                                                         *
+ *          The number of elements in data.                                   *
+ *      threshold (double):                                                   *
+ *          The value the data is compared against.                           *
+ *  Output:                                                                   *
+ *      where (tmpl_WhereIndices):                                            *
+ *          The matching indices, in increasing order, and their number.      *
+ *  Notes:                                                                    *
+ *      The output is allocated exactly, the only transient memory used is a  *
+ *      bitmask with one bit per element. The result must be freed with       *
+ *      tmpl_WhereIndices_Destroy. Versions for all of the integer and real   *
+ *      types are provided. Large arrays are processed in parallel when       *
+ *      OpenMP support is enabled. The indices are in increasing order, and   *
+ *      are the same, for any number of threads.                              *
+ ******************************************************************************/
+extern tmpl_WhereIndices
+tmpl_Where_Lesser_Char_Indices(const char *data, size_t dim, double threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Lesser_UChar_Indices(const unsigned char *data, size_t dim,
+                                double threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Lesser_Short_Indices(const short *data, size_t dim,
+                                double threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Lesser_UShort_Indices(const unsigned short *data, size_t dim,
+                                 double threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Lesser_Int_Indices(const int *data, size_t dim, double threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Lesser_UInt_Indices(const unsigned int *data, size_t dim,
+                               double threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Lesser_Long_Indices(const long *data, size_t dim, double threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Lesser_ULong_Indices(const unsigned long *data, size_t dim,
+                                double threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Lesser_Float_Indices(const float *data, size_t dim, float threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Lesser_Double_Indices(const double *data, size_t dim,
+                                 double threshold);
+
+extern tmpl_WhereIndices
+tmpl_Where_Lesser_LDouble_Indices(const long double *data, size_t dim,
+                                  long double threshold);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_Where_LesserGreater_Double_Indices                               *
+ *  Purpose:                                                                  *
+ *      Computes the indices of the elements with lower < data[n] < upper.    *
+ *  Arguments:                                                                *
+ *      data (const double *):                                                *
+ *          The array being searched.                                         *
+ *      dim (size_t):                                                         *
+ *          The number of elements in data.                                   *
+ *      lower (double):                                                       *
+ *          The lower bound. Matching elements are strictly greater than this.*
+ *      upper (double):                                                       *
+ *          The upper bound. Matching elements are strictly less than this.   *
+ *  Output:                                                                   *
+ *      where (tmpl_WhereIndices):                                            *
+ *          The matching indices, in increasing order, and their number.      *
+ *  Notes:                                                                    *
+ *      The output is allocated exactly, the only transient memory used is a  *
+ *      bitmask with one bit per element. The result must be freed with       *
+ *      tmpl_WhereIndices_Destroy. Versions for all of the integer and real   *
+ *      types are provided. Large arrays are processed in parallel when       *
+ *      OpenMP support is enabled. The indices are in increasing order, and   *
+ *      are the same, for any number of threads.                              *
+ ******************************************************************************/
+extern tmpl_WhereIndices
+tmpl_Where_LesserGreater_Char_Indices(const char *data, size_t dim,
+                                      double lower, double upper);
+
+extern tmpl_WhereIndices
+tmpl_Where_LesserGreater_UChar_Indices(const unsigned char *data, size_t dim,
+                                       double lower, double upper);
+
+extern tmpl_WhereIndices
+tmpl_Where_LesserGreater_Short_Indices(const short *data, size_t dim,
+                                       double lower, double upper);
+
+extern tmpl_WhereIndices
+tmpl_Where_LesserGreater_UShort_Indices(const unsigned short *data, size_t dim,
+                                        double lower, double upper);
+
+extern tmpl_WhereIndices
+tmpl_Where_LesserGreater_Int_Indices(const int *data, size_t dim,
+                                     double lower, double upper);
+
+extern tmpl_WhereIndices
+tmpl_Where_LesserGreater_UInt_Indices(const unsigned int *data, size_t dim,
+                                      double lower, double upper);
+
+extern tmpl_WhereIndices
+tmpl_Where_LesserGreater_Long_Indices(const long *data, size_t dim,
+                                      double lower, double upper);
+
+extern tmpl_WhereIndices
+tmpl_Where_LesserGreater_ULong_Indices(const unsigned long *data, size_t dim,
+                                       double lower, double upper);
+
+extern tmpl_WhereIndices
+tmpl_Where_LesserGreater_Float_Indices(const float *data, size_t dim,
+                                       float lower, float upper);
+
+extern tmpl_WhereIndices
+tmpl_Where_LesserGreater_Double_Indices(const double *data, size_t dim,
+                                        double lower, double upper);
+
+extern tmpl_WhereIndices
+tmpl_Where_LesserGreater_LDouble_Indices(const long double *data, size_t dim,
+                                         long double lower, long double upper);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_WhereMask_To_Indices                                             *
+ *  Purpose:                                                                  *
+ *      Expands a bitmask into the list of the indices of its set bits.       *
+ *  Arguments:                                                                *
+ *      mask (const tmpl_WhereMask *):                                        *
+ *          A bitmask computed by one of the tmpl_Where_*_Mask functions.     *
+ *  Output:                                                                   *
+ *      where (tmpl_WhereIndices):                                            *
+ *          The indices of the set bits, in increasing order.                 *
+ ******************************************************************************/
+extern tmpl_WhereIndices
+tmpl_WhereMask_To_Indices(const tmpl_WhereMask *mask);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_WhereMask_Destroy                                                *
+ *  Purpose:                                                                  *
+ *      Frees the memory in a bitmask and resets its variables.               *
+ *  Arguments:                                                                *
+ *      mask (tmpl_WhereMask * const):                                        *
+ *          The mask to be destroyed.                                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void tmpl_WhereMask_Destroy(tmpl_WhereMask * const mask);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tmpl_WhereIndices_Destroy                                             *
+ *  Purpose:                                                                  *
+ *      Frees the memory in a list of indices and resets its variables.       *
+ *  Arguments:                                                                *
+ *      where (tmpl_WhereIndices * const):                                    *
+ *          The list of indices to be destroyed.                              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void tmpl_WhereIndices_Destroy(tmpl_WhereIndices * const where);
+
 #endif
 /*  End of include guard.                                                     */
@@ -0,0 +1,97 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                                tmpl_bigint                                 *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides an arbitrary-precision integer type.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_TYPES_BIGINT_H
+#define TMPL_TYPES_BIGINT_H
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Fixed-width integer typedefs and TMPL_HAS_32_BIT_INT found here.          */
+#include <libtmpl/include/tmpl_inttype.h>
+
+/*  size_t typedef provided here.                                             */
+#include <stddef.h>
+
+/*  A limb is one digit of the base 2^TMPL_BIGINT_LIMB_BIT expansion. The     *
+ *  double limb type must hold the product of two limbs plus two more limbs.  *
+ *  32-bit limbs are used if 32 and 64 bit integers exist. Otherwise 16-bit   *
+ *  limbs are used with unsigned long, which is always at least 32 bits.      */
+#if TMPL_HAS_32_BIT_INT == 1 && TMPL_HAS_64_BIT_INT == 1
+typedef tmpl_UInt32 tmpl_BigIntLimb;
+typedef tmpl_UInt64 tmpl_BigIntDoubleLimb;
+typedef tmpl_SInt64 tmpl_BigIntSignedDoubleLimb;
+#define TMPL_BIGINT_LIMB_BIT (32)
+#else
+typedef unsigned short int tmpl_BigIntLimb;
+typedef unsigned long int tmpl_BigIntDoubleLimb;
+typedef signed long int tmpl_BigIntSignedDoubleLimb;
+#define TMPL_BIGINT_LIMB_BIT (16)
+#endif
+
+/*  The largest value of a limb. Limbs are always reduced by this mask, so    *
+ *  the code is correct even if the limb type has more bits than needed.      */
+#define TMPL_BIGINT_LIMB_MASK \
+    ((((tmpl_BigIntDoubleLimb)1) << TMPL_BIGINT_LIMB_BIT) - 1)
+
+/*  Number of limbs stored in the struct itself. Numbers this small never     *
+ *  allocate memory. With 32-bit limbs this is 128 bits.                      */
+#define TMPL_BIGINT_SMALL_LIMBS (4)
+
+/*  Arbitrary-precision integers in sign-magnitude form.                      */
+typedef struct tmpl_BigInt_Def {
+
+    /*  Heap storage for large numbers. NULL if small is used instead.        */
+    tmpl_BigIntLimb *heap;
+
+    /*  Inline storage for small numbers. The number is kept here, and not    *
+     *  pointed to, so a tmpl_BigInt may be copied or moved with assignment.  */
+    tmpl_BigIntLimb small[TMPL_BIGINT_SMALL_LIMBS];
+
+    /*  Number of significant limbs, least significant first. The limb at     *
+     *  index length - 1 is non-zero. Zero has length zero.                   */
+    size_t length;
+
+    /*  Number of limbs available in heap, or TMPL_BIGINT_SMALL_LIMBS.        */
+    size_t capacity;
+
+    /*  Sign of the number. Zero is never negative.                           */
+    tmpl_Bool is_negative;
+
+    /*  Boolean for keeping track of errors.                                  */
+    tmpl_Bool error_occurred;
+
+    /*  And an error message in case an error does occur.                     */
+    const char *error_message;
+} tmpl_BigInt;
+
+/*  The limbs of a number, wherever they are stored.                          */
+#define TMPL_BIGINT_LIMBS(x) ((x)->heap ? (x)->heap : (x)->small)
+
+#endif
+/*  End of include guard.                                                     */
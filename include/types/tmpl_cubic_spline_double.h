@@ -0,0 +1,80 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                          tmpl_cubic_spline_double                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides a struct for cubic splines with fast lookup of the interval  *
+ *      containing an arbitrary point.                                        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_TYPES_CUBIC_SPLINE_DOUBLE_H
+#define TMPL_TYPES_CUBIC_SPLINE_DOUBLE_H
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Cubic polynomial typedef provided here.                                   */
+#include <libtmpl/include/types/tmpl_cubic_double.h>
+
+/*  size_t typedef provided here.                                             */
+#include <stddef.h>
+
+/*  Double precision cubic spline. The struct owns all of its arrays.         */
+typedef struct tmpl_CubicSplineDouble_Def {
+
+    /*  The knots, strictly increasing. There are length elements.            */
+    double *x;
+
+    /*  The splining polynomials. p[n] is in terms of x - x[n] and is used on *
+     *  the interval [x[n], x[n + 1]). There are length - 1 elements.         */
+    tmpl_CubicDouble *p;
+
+    /*  integral[n] is the integral of the spline from x[0] to x[n]. This     *
+     *  array has length elements.                                            */
+    double *integral;
+
+    /*  The number of knots.                                                  */
+    size_t length;
+
+    /*  Lookup table for non-uniform grids. The interval containing a point   *
+     *  in bucket b lies between buckets[b] and buckets[b + 1]. This is NULL  *
+     *  for uniform grids, and has number_of_buckets + 1 elements otherwise.  */
+    size_t *buckets;
+    size_t number_of_buckets;
+
+    /*  Converts x - x[0] into an interval index for uniform grids, and into  *
+     *  a bucket index for non-uniform ones.                                  */
+    double scale;
+
+    /*  Boolean for grids where the index can be computed directly.           */
+    tmpl_Bool is_uniform;
+
+    /*  Boolean for keeping track of errors.                                  */
+    tmpl_Bool error_occurred;
+
+    /*  And an error message in case an error does occur.                     */
+    const char *error_message;
+} tmpl_CubicSplineDouble;
+
+#endif
+/*  End of include guard.                                                     */
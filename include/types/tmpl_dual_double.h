@@ -0,0 +1,47 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                              tmpl_dual_double                              *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides a double precision dual number data type.                    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_TYPES_DUAL_DOUBLE_H
+#define TMPL_TYPES_DUAL_DOUBLE_H
+
+/*  A dual number is a + b e with e^2 = 0. For any smooth function f,         *
+ *  f(a + b e) = f(a) + b f'(a) e, so the dual part carries the derivative.   *
+ *  The layout is the same as tmpl_ComplexDouble.                             */
+typedef struct tmpl_DualDouble_Def {
+
+    /*  The zeroth element is the real part and the first element is the     *
+     *  dual part. By using an array we ensure the data is contiguous.        */
+    double dat[2];
+} tmpl_DualDouble;
+
+/*  Helper macros for the dual double struct. Real and dual parts.            */
+#define TMPL_DUAL_DOUBLE_REAL_PART(x) ((x).dat[0])
+#define TMPL_DUAL_DOUBLE_DUAL_PART(x) ((x).dat[1])
+
+#endif
+/*  End of include guard.                                                     */
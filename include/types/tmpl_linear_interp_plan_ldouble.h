@@ -0,0 +1,63 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                      tmpl_linear_interp_plan_ldouble                       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides a struct for precomputed linear interpolation from one grid  *
+ *      onto another.                                                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_TYPES_LINEAR_INTERP_PLAN_LDOUBLE_H
+#define TMPL_TYPES_LINEAR_INTERP_PLAN_LDOUBLE_H
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  size_t typedef provided here.                                             */
+#include <stddef.h>
+
+/*  Interpolation plan from x onto x_new. For any data y on the x grid:       *
+ *      y_new[m] = (1 - weight[m]) * y[index[m]] + weight[m] * y[index[m] + 1]*/
+typedef struct tmpl_LinearInterpPlanLongDouble_Def {
+
+    /*  The index of the left end of the bracket for each point of x_new.     */
+    size_t *index;
+
+    /*  The relative position of x_new[m] in its bracket, between 0 and 1.    */
+    long double *weight;
+
+    /*  The number of points in x_new. index and weight have this many.       */
+    size_t length;
+
+    /*  The number of points in the original grid x.                          */
+    size_t source_length;
+
+    /*  Boolean for keeping track of errors.                                  */
+    tmpl_Bool error_occurred;
+
+    /*  And an error message in case an error does occur.                     */
+    const char *error_message;
+} tmpl_LinearInterpPlanLongDouble;
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,57 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                         tmpl_polynomial_arena_int                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides a workspace arena that integer polynomials can draw from.    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_TYPES_POLYNOMIAL_ARENA_INT_H
+#define TMPL_TYPES_POLYNOMIAL_ARENA_INT_H
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  size_t typedef provided here.                                             */
+#include <stddef.h>
+
+/*  A single block of coefficients handed out to polynomials in order.        */
+typedef struct tmpl_IntPolynomialArena_Def {
+
+    /*  The block of memory. It is allocated once, when the arena is created. */
+    signed int *data;
+
+    /*  The total number of coefficients data can hold.                       */
+    size_t capacity;
+
+    /*  The number of coefficients that have been handed out so far.          */
+    size_t used;
+
+    /*  Boolean for keeping track of errors.                                  */
+    tmpl_Bool error_occurred;
+
+    /*  And an error message in case an error does occur.                     */
+    const char *error_message;
+} tmpl_IntPolynomialArena;
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,64 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                         tmpl_polynomial_buffer_int                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides a polynomial type with "int" coefficients that keeps track   *
+ *      of its allocated length separately from its degree.                   *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_TYPES_POLYNOMIAL_BUFFER_INT_H
+#define TMPL_TYPES_POLYNOMIAL_BUFFER_INT_H
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  size_t typedef provided here.                                             */
+#include <stddef.h>
+
+/*  Capacity-aware polynomials with int coefficients. Operations write into   *
+ *  the existing memory and only reallocate if the capacity is too small.     */
+typedef struct tmpl_IntPolynomialBuffer_Def {
+
+    /*  A pointer to a signed int array containing the coefficients.          */
+    signed int *coeffs;
+
+    /*  The degree of the polynomial. coeffs[0] through coeffs[degree] are    *
+     *  the coefficients, the rest of the array is unused workspace.          */
+    size_t degree;
+
+    /*  The number of elements allocated for coeffs. Always above degree.     */
+    size_t capacity;
+
+    /*  Boolean for whether coeffs came from malloc. If false the memory      *
+     *  belongs to a tmpl_IntPolynomialArena and the capacity can not grow.   */
+    tmpl_Bool owns_memory;
+
+    /*  Boolean for keeping track of errors.                                  */
+    tmpl_Bool error_occurred;
+
+    /*  And an error message in case an error does occur.                     */
+    const char *error_message;
+} tmpl_IntPolynomialBuffer;
+
+#endif
+/*  End of include guard.                                                     */
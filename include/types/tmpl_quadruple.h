@@ -0,0 +1,101 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                               tmpl_quadruple                               *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides a software IEEE-754 binary128 (quadruple precision) type,    *
+ *      and an unpacked form of it used for arithmetic.                       *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file containing Booleans.                                  *
+ *  2.) tmpl_inttype.h:                                                       *
+ *          Fixed-width integer typedefs and TMPL_HAS_64_BIT_INT found here.  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_TYPES_QUADRUPLE_H
+#define TMPL_TYPES_QUADRUPLE_H
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Fixed-width integer typedefs and TMPL_HAS_64_BIT_INT found here.          */
+#include <libtmpl/include/tmpl_inttype.h>
+
+/*  Use a bit-field to implement 128-bit quadruple precision. Unsigned int is *
+ *  required to be at least 16 bits wide, so we can safely and portably       *
+ *  create this struct. The IEEE format specify 112 bits for the mantissa, 15 *
+ *  bits for the exponent, and 1 bit for the sign. mant1 holds the lowest 16  *
+ *  bits of the mantissa and mant7 the highest, so on little-endian machines  *
+ *  the memory layout is that of binary128.                                   */
+typedef struct tmpl_Quadruple_Def {
+    unsigned int mant1 : 16;
+    unsigned int mant2 : 16;
+    unsigned int mant3 : 16;
+    unsigned int mant4 : 16;
+    unsigned int mant5 : 16;
+    unsigned int mant6 : 16;
+    unsigned int mant7 : 16;
+    unsigned int exponent : 15;
+    unsigned int sign: 1;
+} tmpl_Quadruple;
+
+/*  The arithmetic routines work with 64-bit limbs.                           */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  The kinds of values an unpacked quadruple can hold.                       */
+typedef enum tmpl_QuadrupleKind_Def {
+    TMPL_QUADRUPLE_ZERO,
+    TMPL_QUADRUPLE_FINITE,
+    TMPL_QUADRUPLE_INF,
+    TMPL_QUADRUPLE_NAN
+} tmpl_QuadrupleKind;
+
+/*  A quadruple split into its parts. Packing and unpacking the bit-fields    *
+ *  costs about as much as an addition, so chained computations should stay   *
+ *  in this form and only pack the final result.                              */
+typedef struct tmpl_UnpackedQuadruple_Def {
+
+    /*  The significand, with the implicit leading bit written out. For       *
+     *  finite values bit 112 of the 128-bit number (hi, lo) is set, even for *
+     *  subnormal numbers, and hi has no bits above bit 48. The value is      *
+     *  (hi 2^64 + lo) 2^(expo - 112).                                        */
+    tmpl_UInt64 hi, lo;
+
+    /*  The unbiased exponent of the leading bit. Subnormal numbers have      *
+     *  expo below -16382, the smallest being -16494.                         */
+    signed long int expo;
+
+    /*  Zero, finite and non-zero, infinity, or NaN.                          */
+    tmpl_QuadrupleKind kind;
+
+    /*  Sign of the number. NaN may have either sign.                         */
+    tmpl_Bool is_negative;
+} tmpl_UnpackedQuadruple;
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,61 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                         tmpl_split_complex_double                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides a struct for arrays of complex numbers with the real and     *
+ *      imaginary parts stored in separate arrays.                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_TYPES_SPLIT_COMPLEX_DOUBLE_H
+#define TMPL_TYPES_SPLIT_COMPLEX_DOUBLE_H
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  size_t typedef provided here.                                             */
+#include <stddef.h>
+
+/*  Complex vector z with z[n] = real[n] + i imag[n]. Unlike an array of      *
+ *  tmpl_ComplexDouble, consecutive real parts are adjacent in memory.        *
+ *  This is the layout SIMD instructions want.                                */
+typedef struct tmpl_SplitComplexDouble_Def {
+
+    /*  The real parts of the elements.                                       */
+    double *real;
+
+    /*  The imaginary parts of the elements.                                  */
+    double *imag;
+
+    /*  The number of elements. real and imag both have this many.            */
+    size_t length;
+
+    /*  Boolean for keeping track of errors.                                  */
+    tmpl_Bool error_occurred;
+
+    /*  And an error message in case an error does occur.                     */
+    const char *error_message;
+} tmpl_SplitComplexDouble;
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,59 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                              tmpl_where_mask                               *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides a packed bitmask type for the results of tmpl_Where.         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_TYPES_WHERE_MASK_H
+#define TMPL_TYPES_WHERE_MASK_H
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  size_t typedef provided here.                                             */
+#include <stddef.h>
+
+/*  Membership of each element of an array in a selection, one bit each.      */
+typedef struct tmpl_WhereMask_Def {
+
+    /*  Packed bits. Bit n % 8 of bits[n / 8] is set if element n matched.    *
+     *  There are (length + 7) / 8 bytes, unused high bits are zero.          */
+    unsigned char *bits;
+
+    /*  The number of elements in the array the mask was computed from.       */
+    size_t length;
+
+    /*  The number of set bits, which is the number of matching elements.     */
+    size_t count;
+
+    /*  Boolean for keeping track of errors.                                  */
+    tmpl_Bool error_occurred;
+
+    /*  And an error message in case an error does occur.                     */
+    const char *error_message;
+} tmpl_WhereMask;
+
+#endif
+/*  End of include guard.                                                     */
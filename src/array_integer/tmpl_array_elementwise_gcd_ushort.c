@@ -0,0 +1,96 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                     tmpl_array_elementwise_gcd_ushort                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the GCDs of pairs of elements of two unsigned short arrays.  *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_UShort_Array_Elementwise_GCD                                     *
+ *  Purpose:                                                                  *
+ *      Computes out[n] = GCD(a[n], b[n]) for 0 <= n < len.                   *
+ *  Arguments:                                                                *
+ *      a (const unsigned short int * const):                                 *
+ *          The first array.                                                  *
+ *      b (const unsigned short int * const):                                 *
+ *          The second array.                                                 *
+ *      out (unsigned short int * const):                                     *
+ *          The output array. It may be the same as a or b.                   *
+ *      len (size_t):                                                         *
+ *          The length of the arrays.                                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_integer.h:                                                       *
+ *          tmpl_UShort_GCD_Mixed_Binary:                                     *
+ *              Computes the GCD of two integers.                             *
+ *  Method:                                                                   *
+ *      Loop over the arrays and compute each GCD with the mixed binary       *
+ *      algorithm. The iterations are independent of each other, so the       *
+ *      processor can overlap several GCDs at once. With OpenMP support,      *
+ *      arrays of at least TMPL_ARRAY_GCD_PARALLEL_MIN_LENGTH elements are    *
+ *      split among the threads.                                              *
+ *  Notes:                                                                    *
+ *      1.) If any of the pointers is NULL, nothing is done.                  *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) stddef.h:                                                             *
+ *          Standard header file containing the size_t typedef.               *
+ *  2.) tmpl_integer.h:                                                       *
+ *          Header file with the GCD functions.                               *
+ *  3.) tmpl_array_integer.h:                                                 *
+ *          Header file with the function prototype.                          *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  size_t typedef found here.                                                */
+#include <stddef.h>
+
+/*  tmpl_UShort_GCD_Mixed_Binary function found here.                         */
+#include <libtmpl/include/tmpl_integer.h>
+
+/*  Function prototype and TMPL_ARRAY_GCD_PARALLEL_MIN_LENGTH given here.     */
+#include <libtmpl/include/tmpl_array_integer.h>
+
+/*  Function for computing elementwise GCDs of unsigned short arrays.         */
+void
+tmpl_UShort_Array_Elementwise_GCD(const unsigned short int * const a,
+                                  const unsigned short int * const b,
+                                  unsigned short int * const out,
+                                  size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+
+    /*  Check for NULL pointers. There is nothing to be done in this case.    */
+    if (!a || !b || !out)
+        return;
+
+    /*  Every element is independent, long arrays are split among threads.    */
+#ifdef _OPENMP
+#pragma omp parallel for if(len >= TMPL_ARRAY_GCD_PARALLEL_MIN_LENGTH)
+#endif
+    for (n = 0; n < len; ++n)
+        out[n] = tmpl_UShort_GCD_Mixed_Binary(a[n], b[n]);
+}
+/*  End of tmpl_UShort_Array_Elementwise_GCD.                                 */
@@ -0,0 +1,219 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                           tmpl_array_gcd_ullong                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the GCD of an unsigned long long array.                      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_ULLong_Array_GCD                                                 *
+ *  Purpose:                                                                  *
+ *      Computes the greatest common divisor of all elements of an unsigned   *
+ *      long long array.                                                      *
+ *  Arguments:                                                                *
+ *      arr (const unsigned long long int * const):                           *
+ *          An unsigned long long array.                                      *
+ *      len (size_t):                                                         *
+ *          The length of the array.                                          *
+ *  Output:                                                                   *
+ *      gcd (unsigned long long int):                                         *
+ *          The GCD of the elements of the array.                             *
+ *  Called Functions:                                                         *
+ *      tmpl_integer.h:                                                       *
+ *          tmpl_ULLong_GCD_Mixed_Binary:                                     *
+ *              Computes the GCD of two integers.                             *
+ *      omp.h:                                                                *
+ *          omp_get_max_threads:                                              *
+ *              Returns the number of threads a parallel region may use.      *
+ *  Method:                                                                   *
+ *      The GCD is computed with four independent running GCDs, or lanes.     *
+ *      Lane k handles the elements with index congruent to k mod 4. The four *
+ *      lanes have no data dependencies between them, so the processor can    *
+ *      overlap their divisions instead of waiting on a single chain of GCDs. *
+ *      After the loop the lanes are combined pairwise in a tree.             *
+ *                                                                            *
+ *      Since GCD(1, n) = 1, the computation stops as soon as any lane        *
+ *      reaches one. For most data this happens after a few elements.         *
+ *                                                                            *
+ *      With OpenMP support, arrays of at least                               *
+ *      TMPL_ARRAY_GCD_PARALLEL_MIN_LENGTH elements are split into one chunk  *
+ *      per thread, and the GCDs of the chunks are combined at the end. A     *
+ *      thread whose chunk reaches one sets a shared flag, and the other      *
+ *      threads check this flag and stop early as well.                       *
+ *  Notes:                                                                    *
+ *      1.) If the array is NULL or empty, zero is returned. GCD(0, n) = n,   *
+ *          so zero is the identity for the GCD.                              *
+ *                                                                            *
+ *      2.) The result does not depend on the number of threads.              *
+ *                                                                            *
+ *      3.) This file is only compiled if long long support is available.     *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_inttype.h:                                                       *
+ *          Header file with the TMPL_HAS_LONGLONG macro.                     *
+ *  2.) stddef.h:                                                             *
+ *          Standard header file containing the size_t typedef.               *
+ *  3.) tmpl_integer.h:                                                       *
+ *          Header file with the GCD functions.                               *
+ *  4.) tmpl_array_integer.h:                                                 *
+ *          Header file with the function prototype.                          *
+ *  5.) omp.h:                                                                *
+ *          OpenMP header file. Only included if OpenMP is enabled.           *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  The TMPL_HAS_LONGLONG macro is found here.                                */
+#include <libtmpl/include/tmpl_inttype.h>
+
+/*  Only compile this if long long support is available / requested.          */
+#if TMPL_HAS_LONGLONG == 1
+
+/*  size_t typedef found here.                                                */
+#include <stddef.h>
+
+/*  tmpl_ULLong_GCD_Mixed_Binary function found here.                         */
+#include <libtmpl/include/tmpl_integer.h>
+
+/*  Function prototype and TMPL_ARRAY_GCD_PARALLEL_MIN_LENGTH given here.     */
+#include <libtmpl/include/tmpl_array_integer.h>
+
+/*  omp_get_max_threads provided here.                                        */
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*  Computes the GCD of arr[0], ..., arr[len - 1] using four lanes. If        *
+ *  stop is not NULL it is a flag shared by all threads. It is set when a     *
+ *  GCD of one is found, and checked to stop early when another thread did.   */
+static unsigned long long int
+tmpl_ullong_array_gcd_kernel(const unsigned long long int * const arr,
+                             size_t len,
+                             int *stop)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    unsigned long long int g0 = 0ULL, g1 = 0ULL, g2 = 0ULL, g3 = 0ULL;
+
+#ifndef _OPENMP
+    /*  Without OpenMP there are no other threads to signal.                  */
+    (void)stop;
+#endif
+
+    /*  GCD(0, n) = n, so each lane starts at zero and absorbs its elements.  */
+    for (n = 0; n + 4 <= len; n += 4)
+    {
+        g0 = tmpl_ULLong_GCD_Mixed_Binary(g0, arr[n]);
+        g1 = tmpl_ULLong_GCD_Mixed_Binary(g1, arr[n + 1]);
+        g2 = tmpl_ULLong_GCD_Mixed_Binary(g2, arr[n + 2]);
+        g3 = tmpl_ULLong_GCD_Mixed_Binary(g3, arr[n + 3]);
+
+        /*  The GCD of the whole array divides each lane. Stop at one.        */
+        if (g0 == 1ULL || g1 == 1ULL || g2 == 1ULL || g3 == 1ULL)
+            goto FOUND_ONE;
+
+#ifdef _OPENMP
+        /*  Another thread may already have found a GCD of one.               */
+        if (stop)
+        {
+            int stopped;
+
+#pragma omp atomic read
+            stopped = *stop;
+
+            if (stopped)
+                return 1ULL;
+        }
+#endif
+    }
+
+    /*  The last few elements go into the first lane.                         */
+    for (; n < len; ++n)
+        g0 = tmpl_ULLong_GCD_Mixed_Binary(g0, arr[n]);
+
+    /*  Combine the lanes pairwise.                                           */
+    g0 = tmpl_ULLong_GCD_Mixed_Binary(g0, g1);
+    g2 = tmpl_ULLong_GCD_Mixed_Binary(g2, g3);
+    return tmpl_ULLong_GCD_Mixed_Binary(g0, g2);
+
+    /*  A lane reached one, which is the GCD. Let the other threads know.     */
+FOUND_ONE:
+
+#ifdef _OPENMP
+    if (stop)
+    {
+#pragma omp atomic write
+        *stop = 1;
+    }
+#endif
+
+    return 1ULL;
+}
+/*  End of tmpl_ullong_array_gcd_kernel.                                      */
+
+/*  Function for computing the GCD of an unsigned long long array.            */
+unsigned long long int
+tmpl_ULLong_Array_GCD(const unsigned long long int * const arr, size_t len)
+{
+    /*  GCD(0, n) = n, so zero is returned for NULL or empty arrays.          */
+    if (!arr || !len)
+        return 0ULL;
+
+#ifdef _OPENMP
+
+    /*  Long arrays are split into one chunk per thread.                      */
+    if (len >= TMPL_ARRAY_GCD_PARALLEL_MIN_LENGTH)
+    {
+        /*  Declare necessary variables. C89 requires this at the top.        */
+        size_t n;
+        int stop = 0;
+        unsigned long long int gcd = 0ULL;
+        const size_t threads = (size_t)omp_get_max_threads();
+
+#pragma omp parallel for
+        for (n = 0; n < threads; ++n)
+        {
+            const size_t first = (len / threads) * n;
+            const size_t last = (n + 1 == threads ?
+                                 len : (len / threads) * (n + 1));
+
+            const unsigned long long int part = tmpl_ullong_array_gcd_kernel(
+                arr + first, last - first, &stop
+            );
+
+            /*  GCD is associative and commutative, so order is irrelevant.   */
+#pragma omp critical
+            gcd = tmpl_ULLong_GCD_Mixed_Binary(gcd, part);
+        }
+
+        return gcd;
+    }
+
+#endif
+/*  End of #ifdef _OPENMP.                                                    */
+
+    return tmpl_ullong_array_gcd_kernel(arr, len, NULL);
+}
+/*  End of tmpl_ULLong_Array_GCD.                                             */
+
+#endif
+/*  End of #if TMPL_HAS_LONGLONG == 1.                                        */
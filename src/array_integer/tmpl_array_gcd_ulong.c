@@ -0,0 +1,206 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                            tmpl_array_gcd_ulong                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the GCD of an unsigned long array.                           *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_ULong_Array_GCD                                                  *
+ *  Purpose:                                                                  *
+ *      Computes the greatest common divisor of all elements of an unsigned   *
+ *      long array.                                                           *
+ *  Arguments:                                                                *
+ *      arr (const unsigned long int * const):                                *
+ *          An unsigned long array.                                           *
+ *      len (size_t):                                                         *
+ *          The length of the array.                                          *
+ *  Output:                                                                   *
+ *      gcd (unsigned long int):                                              *
+ *          The GCD of the elements of the array.                             *
+ *  Called Functions:                                                         *
+ *      tmpl_integer.h:                                                       *
+ *          tmpl_ULong_GCD_Mixed_Binary:                                      *
+ *              Computes the GCD of two integers.                             *
+ *      omp.h:                                                                *
+ *          omp_get_max_threads:                                              *
+ *              Returns the number of threads a parallel region may use.      *
+ *  Method:                                                                   *
+ *      The GCD is computed with four independent running GCDs, or lanes.     *
+ *      Lane k handles the elements with index congruent to k mod 4. The four *
+ *      lanes have no data dependencies between them, so the processor can    *
+ *      overlap their divisions instead of waiting on a single chain of GCDs. *
+ *      After the loop the lanes are combined pairwise in a tree.             *
+ *                                                                            *
+ *      Since GCD(1, n) = 1, the computation stops as soon as any lane        *
+ *      reaches one. For most data this happens after a few elements.         *
+ *                                                                            *
+ *      With OpenMP support, arrays of at least                               *
+ *      TMPL_ARRAY_GCD_PARALLEL_MIN_LENGTH elements are split into one chunk  *
+ *      per thread, and the GCDs of the chunks are combined at the end. A     *
+ *      thread whose chunk reaches one sets a shared flag, and the other      *
+ *      threads check this flag and stop early as well.                       *
+ *  Notes:                                                                    *
+ *      1.) If the array is NULL or empty, zero is returned. GCD(0, n) = n,   *
+ *          so zero is the identity for the GCD.                              *
+ *                                                                            *
+ *      2.) The result does not depend on the number of threads.              *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) stddef.h:                                                             *
+ *          Standard header file containing the size_t typedef.               *
+ *  2.) tmpl_integer.h:                                                       *
+ *          Header file with the GCD functions.                               *
+ *  3.) tmpl_array_integer.h:                                                 *
+ *          Header file with the function prototype.                          *
+ *  4.) omp.h:                                                                *
+ *          OpenMP header file. Only included if OpenMP is enabled.           *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  size_t typedef found here.                                                */
+#include <stddef.h>
+
+/*  tmpl_ULong_GCD_Mixed_Binary function found here.                          */
+#include <libtmpl/include/tmpl_integer.h>
+
+/*  Function prototype and TMPL_ARRAY_GCD_PARALLEL_MIN_LENGTH given here.     */
+#include <libtmpl/include/tmpl_array_integer.h>
+
+/*  omp_get_max_threads provided here.                                        */
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*  Computes the GCD of arr[0], ..., arr[len - 1] using four lanes. If        *
+ *  stop is not NULL it is a flag shared by all threads. It is set when a     *
+ *  GCD of one is found, and checked to stop early when another thread did.   */
+static unsigned long int
+tmpl_ulong_array_gcd_kernel(const unsigned long int * const arr,
+                            size_t len,
+                            int *stop)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    unsigned long int g0 = 0UL, g1 = 0UL, g2 = 0UL, g3 = 0UL;
+
+#ifndef _OPENMP
+    /*  Without OpenMP there are no other threads to signal.                  */
+    (void)stop;
+#endif
+
+    /*  GCD(0, n) = n, so each lane starts at zero and absorbs its elements.  */
+    for (n = 0; n + 4 <= len; n += 4)
+    {
+        g0 = tmpl_ULong_GCD_Mixed_Binary(g0, arr[n]);
+        g1 = tmpl_ULong_GCD_Mixed_Binary(g1, arr[n + 1]);
+        g2 = tmpl_ULong_GCD_Mixed_Binary(g2, arr[n + 2]);
+        g3 = tmpl_ULong_GCD_Mixed_Binary(g3, arr[n + 3]);
+
+        /*  The GCD of the whole array divides each lane. Stop at one.        */
+        if (g0 == 1UL || g1 == 1UL || g2 == 1UL || g3 == 1UL)
+            goto FOUND_ONE;
+
+#ifdef _OPENMP
+        /*  Another thread may already have found a GCD of one.               */
+        if (stop)
+        {
+            int stopped;
+
+#pragma omp atomic read
+            stopped = *stop;
+
+            if (stopped)
+                return 1UL;
+        }
+#endif
+    }
+
+    /*  The last few elements go into the first lane.                         */
+    for (; n < len; ++n)
+        g0 = tmpl_ULong_GCD_Mixed_Binary(g0, arr[n]);
+
+    /*  Combine the lanes pairwise.                                           */
+    g0 = tmpl_ULong_GCD_Mixed_Binary(g0, g1);
+    g2 = tmpl_ULong_GCD_Mixed_Binary(g2, g3);
+    return tmpl_ULong_GCD_Mixed_Binary(g0, g2);
+
+    /*  A lane reached one, which is the GCD. Let the other threads know.     */
+FOUND_ONE:
+
+#ifdef _OPENMP
+    if (stop)
+    {
+#pragma omp atomic write
+        *stop = 1;
+    }
+#endif
+
+    return 1UL;
+}
+/*  End of tmpl_ulong_array_gcd_kernel.                                       */
+
+/*  Function for computing the GCD of an unsigned long array.                 */
+unsigned long int
+tmpl_ULong_Array_GCD(const unsigned long int * const arr, size_t len)
+{
+    /*  GCD(0, n) = n, so zero is returned for NULL or empty arrays.          */
+    if (!arr || !len)
+        return 0UL;
+
+#ifdef _OPENMP
+
+    /*  Long arrays are split into one chunk per thread.                      */
+    if (len >= TMPL_ARRAY_GCD_PARALLEL_MIN_LENGTH)
+    {
+        /*  Declare necessary variables. C89 requires this at the top.        */
+        size_t n;
+        int stop = 0;
+        unsigned long int gcd = 0UL;
+        const size_t threads = (size_t)omp_get_max_threads();
+
+#pragma omp parallel for
+        for (n = 0; n < threads; ++n)
+        {
+            const size_t first = (len / threads) * n;
+            const size_t last = (n + 1 == threads ?
+                                 len : (len / threads) * (n + 1));
+
+            const unsigned long int part = tmpl_ulong_array_gcd_kernel(
+                arr + first, last - first, &stop
+            );
+
+            /*  GCD is associative and commutative, so order is irrelevant.   */
+#pragma omp critical
+            gcd = tmpl_ULong_GCD_Mixed_Binary(gcd, part);
+        }
+
+        return gcd;
+    }
+
+#endif
+/*  End of #ifdef _OPENMP.                                                    */
+
+    return tmpl_ulong_array_gcd_kernel(arr, len, NULL);
+}
+/*  End of tmpl_ULong_Array_GCD.                                              */
@@ -0,0 +1,216 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                            tmpl_array_lcm_uchar                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the LCM of an unsigned char array.                           *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_UChar_Array_LCM                                                  *
+ *  Purpose:                                                                  *
+ *      Computes the least common multiple of all elements of an unsigned     *
+ *      char array.                                                           *
+ *  Arguments:                                                                *
+ *      arr (const unsigned char * const):                                    *
+ *          An unsigned char array.                                           *
+ *      len (size_t):                                                         *
+ *          The length of the array.                                          *
+ *  Output:                                                                   *
+ *      lcm (unsigned char):                                                  *
+ *          The LCM of the elements of the array.                             *
+ *  Called Functions:                                                         *
+ *      tmpl_integer.h:                                                       *
+ *          tmpl_UChar_GCD_Mixed_Binary:                                      *
+ *              Computes the GCD of two integers.                             *
+ *      omp.h:                                                                *
+ *          omp_get_max_threads:                                              *
+ *              Returns the number of threads a parallel region may use.      *
+ *  Method:                                                                   *
+ *      Use LCM(a, b) = a (b / GCD(a, b)) and fold over the array. Before     *
+ *      each multiplication, check that the product fits in the type.         *
+ *                                                                            *
+ *      The computation stops as soon as the LCM is zero, which happens when  *
+ *      an element is zero, or when it overflows. In both cases zero is       *
+ *      returned.                                                             *
+ *                                                                            *
+ *      With OpenMP support, arrays of at least                               *
+ *      TMPL_ARRAY_GCD_PARALLEL_MIN_LENGTH elements are split into one chunk  *
+ *      per thread and the LCMs of the chunks are combined at the end. A      *
+ *      thread that finds a zero or an overflow sets a shared flag so the     *
+ *      others stop early as well.                                            *
+ *  Notes:                                                                    *
+ *      1.) If the array is NULL or empty, one is returned. This is the       *
+ *          identity for the LCM.                                             *
+ *                                                                            *
+ *      2.) If the LCM does not fit in the type, zero is returned. Zero is    *
+ *          also the LCM of any array containing zero.                        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) stddef.h:                                                             *
+ *          Standard header file containing the size_t typedef.               *
+ *  2.) tmpl_integer.h:                                                       *
+ *          Header file with the GCD functions.                               *
+ *  3.) tmpl_array_integer.h:                                                 *
+ *          Header file with the function prototype.                          *
+ *  4.) omp.h:                                                                *
+ *          OpenMP header file. Only included if OpenMP is enabled.           *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  size_t typedef found here.                                                */
+#include <stddef.h>
+
+/*  tmpl_UChar_GCD_Mixed_Binary function found here.                          */
+#include <libtmpl/include/tmpl_integer.h>
+
+/*  Function prototype and TMPL_ARRAY_GCD_PARALLEL_MIN_LENGTH given here.     */
+#include <libtmpl/include/tmpl_array_integer.h>
+
+/*  omp_get_max_threads provided here.                                        */
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*  Computes LCM(lcm, x). Returns zero if x is zero or the LCM overflows.     */
+static unsigned char
+tmpl_uchar_lcm_step(unsigned char lcm,
+                    unsigned char x)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned char factor;
+
+    if (!lcm || !x)
+        return 0U;
+
+    /*  LCM(lcm, x) = lcm * (x / GCD(lcm, x)). Check the product fits.        */
+    factor = (unsigned char)(x / tmpl_UChar_GCD_Mixed_Binary(lcm, x));
+
+    if (lcm > ((unsigned char)-1) / factor)
+        return 0U;
+
+    return (unsigned char)(lcm * factor);
+}
+/*  End of tmpl_uchar_lcm_step.                                               */
+
+/*  Computes the LCM of arr[0], ..., arr[len - 1]. If stop is not NULL it     *
+ *  is a flag shared by all threads. It is set when the LCM becomes zero,     *
+ *  and checked to stop early when another thread found a zero LCM.           */
+static unsigned char
+tmpl_uchar_array_lcm_kernel(const unsigned char * const arr,
+                            size_t len,
+                            int *stop)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    unsigned char lcm = 1U;
+
+#ifndef _OPENMP
+    /*  Without OpenMP there are no other threads to signal.                  */
+    (void)stop;
+#endif
+
+    for (n = 0; n < len; ++n)
+    {
+        lcm = tmpl_uchar_lcm_step(lcm, arr[n]);
+
+        /*  A zero or overflowed LCM stays zero, there is no need to go on.   */
+        if (!lcm)
+            goto FOUND_ZERO;
+
+#ifdef _OPENMP
+        /*  Another thread may already have found a zero LCM. Check this      *
+         *  every so often.                                                   */
+        if (stop && !(n & 0xFF))
+        {
+            int stopped;
+
+#pragma omp atomic read
+            stopped = *stop;
+
+            if (stopped)
+                return 0U;
+        }
+#endif
+    }
+
+    return lcm;
+
+    /*  The LCM is zero. Let the other threads know.                          */
+FOUND_ZERO:
+
+#ifdef _OPENMP
+    if (stop)
+    {
+#pragma omp atomic write
+        *stop = 1;
+    }
+#endif
+
+    return 0U;
+}
+/*  End of tmpl_uchar_array_lcm_kernel.                                       */
+
+/*  Function for computing the LCM of an unsigned char array.                 */
+unsigned char
+tmpl_UChar_Array_LCM(const unsigned char * const arr, size_t len)
+{
+    /*  The LCM of no numbers is one, the identity for the LCM.               */
+    if (!arr || !len)
+        return 1U;
+
+#ifdef _OPENMP
+
+    /*  Long arrays are split into one chunk per thread.                      */
+    if (len >= TMPL_ARRAY_GCD_PARALLEL_MIN_LENGTH)
+    {
+        /*  Declare necessary variables. C89 requires this at the top.        */
+        size_t n;
+        int stop = 0;
+        unsigned char lcm = 1U;
+        const size_t threads = (size_t)omp_get_max_threads();
+
+#pragma omp parallel for
+        for (n = 0; n < threads; ++n)
+        {
+            const size_t first = (len / threads) * n;
+            const size_t last = (n + 1 == threads ?
+                                 len : (len / threads) * (n + 1));
+
+            const unsigned char part = tmpl_uchar_array_lcm_kernel(
+                arr + first, last - first, &stop
+            );
+
+            /*  LCM is associative and commutative, so order is irrelevant.   */
+#pragma omp critical
+            lcm = tmpl_uchar_lcm_step(lcm, part);
+        }
+
+        return lcm;
+    }
+
+#endif
+/*  End of #ifdef _OPENMP.                                                    */
+
+    return tmpl_uchar_array_lcm_kernel(arr, len, NULL);
+}
+/*  End of tmpl_UChar_Array_LCM.                                              */
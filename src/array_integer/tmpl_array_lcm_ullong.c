@@ -0,0 +1,229 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                           tmpl_array_lcm_ullong                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the LCM of an unsigned long long array.                      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_ULLong_Array_LCM                                                 *
+ *  Purpose:                                                                  *
+ *      Computes the least common multiple of all elements of an unsigned     *
+ *      long long array.                                                      *
+ *  Arguments:                                                                *
+ *      arr (const unsigned long long int * const):                           *
+ *          An unsigned long long array.                                      *
+ *      len (size_t):                                                         *
+ *          The length of the array.                                          *
+ *  Output:                                                                   *
+ *      lcm (unsigned long long int):                                         *
+ *          The LCM of the elements of the array.                             *
+ *  Called Functions:                                                         *
+ *      tmpl_integer.h:                                                       *
+ *          tmpl_ULLong_GCD_Mixed_Binary:                                     *
+ *              Computes the GCD of two integers.                             *
+ *      omp.h:                                                                *
+ *          omp_get_max_threads:                                              *
+ *              Returns the number of threads a parallel region may use.      *
+ *  Method:                                                                   *
+ *      Use LCM(a, b) = a (b / GCD(a, b)) and fold over the array. Before     *
+ *      each multiplication, check that the product fits in the type.         *
+ *                                                                            *
+ *      The computation stops as soon as the LCM is zero, which happens when  *
+ *      an element is zero, or when it overflows. In both cases zero is       *
+ *      returned.                                                             *
+ *                                                                            *
+ *      With OpenMP support, arrays of at least                               *
+ *      TMPL_ARRAY_GCD_PARALLEL_MIN_LENGTH elements are split into one chunk  *
+ *      per thread and the LCMs of the chunks are combined at the end. A      *
+ *      thread that finds a zero or an overflow sets a shared flag so the     *
+ *      others stop early as well.                                            *
+ *  Notes:                                                                    *
+ *      1.) If the array is NULL or empty, one is returned. This is the       *
+ *          identity for the LCM.                                             *
+ *                                                                            *
+ *      2.) If the LCM does not fit in the type, zero is returned. Zero is    *
+ *          also the LCM of any array containing zero.                        *
+ *                                                                            *
+ *      3.) This file is only compiled if long long support is available.     *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_inttype.h:                                                       *
+ *          Header file with the TMPL_HAS_LONGLONG macro.                     *
+ *  2.) stddef.h:                                                             *
+ *          Standard header file containing the size_t typedef.               *
+ *  3.) tmpl_integer.h:                                                       *
+ *          Header file with the GCD functions.                               *
+ *  4.) tmpl_array_integer.h:                                                 *
+ *          Header file with the function prototype.                          *
+ *  5.) omp.h:                                                                *
+ *          OpenMP header file. Only included if OpenMP is enabled.           *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  The TMPL_HAS_LONGLONG macro is found here.                                */
+#include <libtmpl/include/tmpl_inttype.h>
+
+/*  Only compile this if long long support is available / requested.          */
+#if TMPL_HAS_LONGLONG == 1
+
+/*  size_t typedef found here.                                                */
+#include <stddef.h>
+
+/*  tmpl_ULLong_GCD_Mixed_Binary function found here.                         */
+#include <libtmpl/include/tmpl_integer.h>
+
+/*  Function prototype and TMPL_ARRAY_GCD_PARALLEL_MIN_LENGTH given here.     */
+#include <libtmpl/include/tmpl_array_integer.h>
+
+/*  omp_get_max_threads provided here.                                        */
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*  Computes LCM(lcm, x). Returns zero if x is zero or the LCM overflows.     */
+static unsigned long long int
+tmpl_ullong_lcm_step(unsigned long long int lcm,
+                     unsigned long long int x)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned long long int factor;
+
+    if (!lcm || !x)
+        return 0ULL;
+
+    /*  LCM(lcm, x) = lcm * (x / GCD(lcm, x)). Check the product fits.        */
+    factor = x / tmpl_ULLong_GCD_Mixed_Binary(lcm, x);
+
+    if (lcm > ((unsigned long long int)-1) / factor)
+        return 0ULL;
+
+    return lcm * factor;
+}
+/*  End of tmpl_ullong_lcm_step.                                              */
+
+/*  Computes the LCM of arr[0], ..., arr[len - 1]. If stop is not NULL it     *
+ *  is a flag shared by all threads. It is set when the LCM becomes zero,     *
+ *  and checked to stop early when another thread found a zero LCM.           */
+static unsigned long long int
+tmpl_ullong_array_lcm_kernel(const unsigned long long int * const arr,
+                             size_t len,
+                             int *stop)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    unsigned long long int lcm = 1ULL;
+
+#ifndef _OPENMP
+    /*  Without OpenMP there are no other threads to signal.                  */
+    (void)stop;
+#endif
+
+    for (n = 0; n < len; ++n)
+    {
+        lcm = tmpl_ullong_lcm_step(lcm, arr[n]);
+
+        /*  A zero or overflowed LCM stays zero, there is no need to go on.   */
+        if (!lcm)
+            goto FOUND_ZERO;
+
+#ifdef _OPENMP
+        /*  Another thread may already have found a zero LCM. Check this      *
+         *  every so often.                                                   */
+        if (stop && !(n & 0xFF))
+        {
+            int stopped;
+
+#pragma omp atomic read
+            stopped = *stop;
+
+            if (stopped)
+                return 0ULL;
+        }
+#endif
+    }
+
+    return lcm;
+
+    /*  The LCM is zero. Let the other threads know.                          */
+FOUND_ZERO:
+
+#ifdef _OPENMP
+    if (stop)
+    {
+#pragma omp atomic write
+        *stop = 1;
+    }
+#endif
+
+    return 0ULL;
+}
+/*  End of tmpl_ullong_array_lcm_kernel.                                      */
+
+/*  Function for computing the LCM of an unsigned long long array.            */
+unsigned long long int
+tmpl_ULLong_Array_LCM(const unsigned long long int * const arr, size_t len)
+{
+    /*  The LCM of no numbers is one, the identity for the LCM.               */
+    if (!arr || !len)
+        return 1ULL;
+
+#ifdef _OPENMP
+
+    /*  Long arrays are split into one chunk per thread.                      */
+    if (len >= TMPL_ARRAY_GCD_PARALLEL_MIN_LENGTH)
+    {
+        /*  Declare necessary variables. C89 requires this at the top.        */
+        size_t n;
+        int stop = 0;
+        unsigned long long int lcm = 1ULL;
+        const size_t threads = (size_t)omp_get_max_threads();
+
+#pragma omp parallel for
+        for (n = 0; n < threads; ++n)
+        {
+            const size_t first = (len / threads) * n;
+            const size_t last = (n + 1 == threads ?
+                                 len : (len / threads) * (n + 1));
+
+            const unsigned long long int part = tmpl_ullong_array_lcm_kernel(
+                arr + first, last - first, &stop
+            );
+
+            /*  LCM is associative and commutative, so order is irrelevant.   */
+#pragma omp critical
+            lcm = tmpl_ullong_lcm_step(lcm, part);
+        }
+
+        return lcm;
+    }
+
+#endif
+/*  End of #ifdef _OPENMP.                                                    */
+
+    return tmpl_ullong_array_lcm_kernel(arr, len, NULL);
+}
+/*  End of tmpl_ULLong_Array_LCM.                                             */
+
+#endif
+/*  End of #if TMPL_HAS_LONGLONG == 1.                                        */
@@ -0,0 +1,95 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                          tmpl_bigint_check_inputs                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Passes NULL or invalid inputs on to the output as an error.           *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigInt_Check_Inputs                                              *
+ *  Purpose:                                                                  *
+ *      Passes NULL or invalid inputs on to the output as an error.           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file containing TMPL_STATIC_INLINE macro.                  *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_bigint.h:                                                        *
+ *          Header file with the tmpl_BigInt typedef.                         *
+ *  4.) tmpl_bigint_set_error.h:                                              *
+ *          Marks a number as invalid.                                        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_BIGINT_CHECK_INPUTS_H
+#define TMPL_BIGINT_CHECK_INPUTS_H
+
+/*  Location of the TMPL_STATIC_INLINE macro.                                 */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  tmpl_BigInt typedef and the limb types given here.                        */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  tmpl_BigInt_Set_Error found here.                                         */
+#include "tmpl_bigint_set_error.h"
+
+/*  Checks the inputs to a binary operation. If either is NULL or has an      *
+ *  error, out is marked as invalid and false is returned.                    */
+TMPL_STATIC_INLINE
+tmpl_Bool
+tmpl_BigInt_Check_Inputs(tmpl_BigInt *out,
+                         const tmpl_BigInt *x,
+                         const tmpl_BigInt *y,
+                         const char *null_message)
+{
+    if (!x || !y)
+    {
+        tmpl_BigInt_Set_Error(out, null_message);
+        return tmpl_False;
+    }
+
+    /*  Errors in the inputs are passed along to the output.                  */
+    if (x->error_occurred)
+    {
+        tmpl_BigInt_Set_Error(out, x->error_message);
+        return tmpl_False;
+    }
+
+    if (y->error_occurred)
+    {
+        tmpl_BigInt_Set_Error(out, y->error_message);
+        return tmpl_False;
+    }
+
+    return tmpl_True;
+}
+/*  End of tmpl_BigInt_Check_Inputs.                                          */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,83 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                           tmpl_bigint_limbs_add                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Adds two limb arrays, returning the carry.                            *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigIntLimbs_Add                                                  *
+ *  Purpose:                                                                  *
+ *      Adds two limb arrays, returning the carry.                            *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file containing TMPL_STATIC_INLINE macro.                  *
+ *  2.) tmpl_bigint.h:                                                        *
+ *          Header file with the limb types.                                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_BIGINT_LIMBS_ADD_H
+#define TMPL_BIGINT_LIMBS_ADD_H
+
+/*  Location of the TMPL_STATIC_INLINE macro.                                 */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  The limb types and macros given here.                                     */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  Computes r = a + b for an >= bn, with r having an limbs, and returns the  *
+ *  carry. r may be the same array as a or b.                                 */
+TMPL_STATIC_INLINE
+tmpl_BigIntLimb
+tmpl_BigIntLimbs_Add(tmpl_BigIntLimb *r,
+                     const tmpl_BigIntLimb *a, size_t an,
+                     const tmpl_BigIntLimb *b, size_t bn)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k;
+    tmpl_BigIntDoubleLimb carry = 0;
+
+    for (k = 0; k < bn; ++k)
+    {
+        carry += (tmpl_BigIntDoubleLimb)a[k] + (tmpl_BigIntDoubleLimb)b[k];
+        r[k] = (tmpl_BigIntLimb)(carry & TMPL_BIGINT_LIMB_MASK);
+        carry >>= TMPL_BIGINT_LIMB_BIT;
+    }
+
+    for (; k < an; ++k)
+    {
+        carry += (tmpl_BigIntDoubleLimb)a[k];
+        r[k] = (tmpl_BigIntLimb)(carry & TMPL_BIGINT_LIMB_MASK);
+        carry >>= TMPL_BIGINT_LIMB_BIT;
+    }
+
+    return (tmpl_BigIntLimb)carry;
+}
+/*  End of tmpl_BigIntLimbs_Add.                                              */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,79 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                         tmpl_bigint_limbs_addmul_1                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Adds a multiple of a limb array to another.                           *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigIntLimbs_AddMul_1                                             *
+ *  Purpose:                                                                  *
+ *      Adds a multiple of a limb array to another.                           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file containing TMPL_STATIC_INLINE macro.                  *
+ *  2.) tmpl_bigint.h:                                                        *
+ *          Header file with the limb types.                                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_BIGINT_LIMBS_ADDMUL_1_H
+#define TMPL_BIGINT_LIMBS_ADDMUL_1_H
+
+/*  Location of the TMPL_STATIC_INLINE macro.                                 */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  The limb types and macros given here.                                     */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  Computes r += a * m, where r and a have n limbs. Returns the carry.       */
+TMPL_STATIC_INLINE
+tmpl_BigIntLimb
+tmpl_BigIntLimbs_AddMul_1(tmpl_BigIntLimb *r,
+                          const tmpl_BigIntLimb *a,
+                          size_t n,
+                          tmpl_BigIntLimb m)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k;
+    tmpl_BigIntDoubleLimb carry = 0;
+
+    /*  (B - 1)^2 + 2 (B - 1) = B^2 - 1, so this never wraps.                 */
+    for (k = 0; k < n; ++k)
+    {
+        carry += (tmpl_BigIntDoubleLimb)a[k] * (tmpl_BigIntDoubleLimb)m +
+                 (tmpl_BigIntDoubleLimb)r[k];
+
+        r[k] = (tmpl_BigIntLimb)(carry & TMPL_BIGINT_LIMB_MASK);
+        carry >>= TMPL_BIGINT_LIMB_BIT;
+    }
+
+    return (tmpl_BigIntLimb)carry;
+}
+/*  End of tmpl_BigIntLimbs_AddMul_1.                                         */
+
+#endif
+/*  End of include guard.                                                     */
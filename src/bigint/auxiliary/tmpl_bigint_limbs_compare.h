@@ -0,0 +1,75 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                         tmpl_bigint_limbs_compare                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Compares the magnitudes of two limb arrays.                           *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigIntLimbs_Compare                                              *
+ *  Purpose:                                                                  *
+ *      Compares the magnitudes of two limb arrays.                           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file containing TMPL_STATIC_INLINE macro.                  *
+ *  2.) tmpl_bigint.h:                                                        *
+ *          Header file with the limb types.                                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_BIGINT_LIMBS_COMPARE_H
+#define TMPL_BIGINT_LIMBS_COMPARE_H
+
+/*  Location of the TMPL_STATIC_INLINE macro.                                 */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  The limb types and macros given here.                                     */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  Compares the magnitudes a and b, given without leading zeros. Returns     *
+ *  -1, 0, or 1 if a < b, a = b, or a > b, respectively.                      */
+TMPL_STATIC_INLINE
+int
+tmpl_BigIntLimbs_Compare(const tmpl_BigIntLimb *a, size_t an,
+                         const tmpl_BigIntLimb *b, size_t bn)
+{
+    if (an != bn)
+        return (an < bn ? -1 : 1);
+
+    while (an)
+    {
+        --an;
+
+        if (a[an] != b[an])
+            return (a[an] < b[an] ? -1 : 1);
+    }
+
+    return 0;
+}
+/*  End of tmpl_BigIntLimbs_Compare.                                          */
+
+#endif
+/*  End of include guard.                                                     */
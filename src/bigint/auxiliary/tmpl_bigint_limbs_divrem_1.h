@@ -0,0 +1,77 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                         tmpl_bigint_limbs_divrem_1                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Divides a limb array by a single limb.                                *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigIntLimbs_DivRem_1                                             *
+ *  Purpose:                                                                  *
+ *      Divides a limb array by a single limb.                                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file containing TMPL_STATIC_INLINE macro.                  *
+ *  2.) tmpl_bigint.h:                                                        *
+ *          Header file with the limb types.                                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_BIGINT_LIMBS_DIVREM_1_H
+#define TMPL_BIGINT_LIMBS_DIVREM_1_H
+
+/*  Location of the TMPL_STATIC_INLINE macro.                                 */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  The limb types and macros given here.                                     */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  Computes q = a / d, where a and q have n limbs and d is not zero, and     *
+ *  returns a mod d. q may be the same array as a.                            */
+TMPL_STATIC_INLINE
+tmpl_BigIntLimb
+tmpl_BigIntLimbs_DivRem_1(tmpl_BigIntLimb *q,
+                          const tmpl_BigIntLimb *a,
+                          size_t n,
+                          tmpl_BigIntLimb d)
+{
+    tmpl_BigIntDoubleLimb rem = 0;
+
+    /*  Schoolbook short division, from the most significant limb down.       */
+    while (n)
+    {
+        --n;
+        rem = (rem << TMPL_BIGINT_LIMB_BIT) | (tmpl_BigIntDoubleLimb)a[n];
+        q[n] = (tmpl_BigIntLimb)(rem / d);
+        rem %= d;
+    }
+
+    return (tmpl_BigIntLimb)rem;
+}
+/*  End of tmpl_BigIntLimbs_DivRem_1.                                         */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,77 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                   tmpl_bigint_limbs_multiply_schoolbook                    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies two limb arrays in O(n m) time.                            *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigIntLimbs_Multiply_Schoolbook                                  *
+ *  Purpose:                                                                  *
+ *      Multiplies two limb arrays in O(n m) time.                            *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file containing TMPL_STATIC_INLINE macro.                  *
+ *  2.) tmpl_bigint.h:                                                        *
+ *          Header file with the limb types.                                  *
+ *  3.) tmpl_bigint_limbs_addmul_1.h:                                         *
+ *          Multiply-accumulate by a single limb.                             *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_BIGINT_LIMBS_MULTIPLY_SCHOOLBOOK_H
+#define TMPL_BIGINT_LIMBS_MULTIPLY_SCHOOLBOOK_H
+
+/*  Location of the TMPL_STATIC_INLINE macro.                                 */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  The limb types and macros given here.                                     */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  tmpl_BigIntLimbs_AddMul_1 found here.                                     */
+#include "tmpl_bigint_limbs_addmul_1.h"
+
+/*  Computes r = a * b, where r has an + bn limbs and is not the same array   *
+ *  as a or b.                                                                */
+TMPL_STATIC_INLINE
+void
+tmpl_BigIntLimbs_Multiply_Schoolbook(tmpl_BigIntLimb *r,
+                                     const tmpl_BigIntLimb *a, size_t an,
+                                     const tmpl_BigIntLimb *b, size_t bn)
+{
+    size_t k;
+
+    for (k = 0; k < an + bn; ++k)
+        r[k] = 0;
+
+    /*  Each row is one multiply-accumulate, and its carry is the next limb.  */
+    for (k = 0; k < bn; ++k)
+        r[k + an] = tmpl_BigIntLimbs_AddMul_1(r + k, a, an, b[k]);
+}
+/*  End of tmpl_BigIntLimbs_Multiply_Schoolbook.                              */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,87 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                         tmpl_bigint_limbs_subtract                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Subtracts two limb arrays, returning the borrow.                      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigIntLimbs_Subtract                                             *
+ *  Purpose:                                                                  *
+ *      Subtracts two limb arrays, returning the borrow.                      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file containing TMPL_STATIC_INLINE macro.                  *
+ *  2.) tmpl_bigint.h:                                                        *
+ *          Header file with the limb types.                                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_BIGINT_LIMBS_SUBTRACT_H
+#define TMPL_BIGINT_LIMBS_SUBTRACT_H
+
+/*  Location of the TMPL_STATIC_INLINE macro.                                 */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  The limb types and macros given here.                                     */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  Computes r = a - b for an >= bn, with r having an limbs, and returns the  *
+ *  borrow, which is zero if a >= b. r may be the same array as a or b.       */
+TMPL_STATIC_INLINE
+tmpl_BigIntLimb
+tmpl_BigIntLimbs_Subtract(tmpl_BigIntLimb *r,
+                          const tmpl_BigIntLimb *a, size_t an,
+                          const tmpl_BigIntLimb *b, size_t bn)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k;
+    tmpl_BigIntDoubleLimb borrow = 0;
+
+    /*  The difference is computed modulo the double limb, so a borrow        *
+     *  shows up as a set bit above the low limb.                             */
+    for (k = 0; k < bn; ++k)
+    {
+        const tmpl_BigIntDoubleLimb diff =
+            (tmpl_BigIntDoubleLimb)a[k] - (tmpl_BigIntDoubleLimb)b[k] - borrow;
+
+        r[k] = (tmpl_BigIntLimb)(diff & TMPL_BIGINT_LIMB_MASK);
+        borrow = (diff >> TMPL_BIGINT_LIMB_BIT) & 1U;
+    }
+
+    for (; k < an; ++k)
+    {
+        const tmpl_BigIntDoubleLimb diff = (tmpl_BigIntDoubleLimb)a[k] - borrow;
+        r[k] = (tmpl_BigIntLimb)(diff & TMPL_BIGINT_LIMB_MASK);
+        borrow = (diff >> TMPL_BIGINT_LIMB_BIT) & 1U;
+    }
+
+    return (tmpl_BigIntLimb)borrow;
+}
+/*  End of tmpl_BigIntLimbs_Subtract.                                         */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,77 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                              tmpl_bigint_move                              *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Replaces the contents of one number with another, without copying.    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigInt_Move                                                      *
+ *  Purpose:                                                                  *
+ *      Replaces the contents of one number with another, without copying.    *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file containing TMPL_STATIC_INLINE macro.                  *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_free.h:                                                          *
+ *          Header file providing TMPL_FREE.                                  *
+ *  4.) tmpl_bigint.h:                                                        *
+ *          Header file with the tmpl_BigInt typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_BIGINT_MOVE_H
+#define TMPL_BIGINT_MOVE_H
+
+/*  Location of the TMPL_STATIC_INLINE macro.                                 */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  TMPL_FREE macro found here.                                               */
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  tmpl_BigInt typedef and the limb types given here.                        */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  Frees the memory in dest and takes over the contents of src. src is left  *
+ *  as a valid zero. Since small numbers are stored inline, this is safe.     */
+TMPL_STATIC_INLINE
+void tmpl_BigInt_Move(tmpl_BigInt *dest, tmpl_BigInt *src)
+{
+    TMPL_FREE(dest->heap);
+    *dest = *src;
+    src->heap = NULL;
+    src->length = 0;
+    src->capacity = TMPL_BIGINT_SMALL_LIMBS;
+    src->is_negative = tmpl_False;
+}
+/*  End of tmpl_BigInt_Move.                                                  */
+
+#endif
+/*  End of include guard.                                                     */
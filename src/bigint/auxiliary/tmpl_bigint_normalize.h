@@ -0,0 +1,72 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                           tmpl_bigint_normalize                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Removes leading zero limbs and clears the sign of zero.               *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigInt_Normalize                                                 *
+ *  Purpose:                                                                  *
+ *      Removes leading zero limbs and clears the sign of zero.               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file containing TMPL_STATIC_INLINE macro.                  *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_bigint.h:                                                        *
+ *          Header file with the tmpl_BigInt typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_BIGINT_NORMALIZE_H
+#define TMPL_BIGINT_NORMALIZE_H
+
+/*  Location of the TMPL_STATIC_INLINE macro.                                 */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  tmpl_BigInt typedef and the limb types given here.                        */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  Drops leading zero limbs. Zero is given a positive sign.                  */
+TMPL_STATIC_INLINE
+void tmpl_BigInt_Normalize(tmpl_BigInt *x)
+{
+    const tmpl_BigIntLimb * const limbs = TMPL_BIGINT_LIMBS(x);
+
+    while (x->length && !limbs[x->length - 1])
+        --x->length;
+
+    if (!x->length)
+        x->is_negative = tmpl_False;
+}
+/*  End of tmpl_BigInt_Normalize.                                             */
+
+#endif
+/*  End of include guard.                                                     */
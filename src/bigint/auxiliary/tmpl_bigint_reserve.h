@@ -0,0 +1,110 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                            tmpl_bigint_reserve                             *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Ensures a number has room for a given number of limbs.                *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigInt_Reserve                                                   *
+ *  Purpose:                                                                  *
+ *      Ensures a number has room for a given number of limbs.                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file containing TMPL_STATIC_INLINE macro.                  *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_malloc.h:                                                        *
+ *          Header file providing TMPL_MALLOC.                                *
+ *  4.) tmpl_free.h:                                                          *
+ *          Header file providing TMPL_FREE.                                  *
+ *  5.) tmpl_bigint.h:                                                        *
+ *          Header file with the tmpl_BigInt typedef.                         *
+ *  6.) tmpl_bigint_set_error.h:                                              *
+ *          Marks a number as invalid.                                        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_BIGINT_RESERVE_H
+#define TMPL_BIGINT_RESERVE_H
+
+/*  Location of the TMPL_STATIC_INLINE macro.                                 */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  TMPL_MALLOC and TMPL_FREE macros found here.                              */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  tmpl_BigInt typedef and the limb types given here.                        */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  tmpl_BigInt_Set_Error found here.                                         */
+#include "tmpl_bigint_set_error.h"
+
+/*  Makes room for at least n limbs, keeping the current value. Returns       *
+ *  false, and marks x as invalid with the given message, if malloc fails.    */
+TMPL_STATIC_INLINE
+tmpl_Bool tmpl_BigInt_Reserve(tmpl_BigInt *x, size_t n, const char *message)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, capacity;
+    tmpl_BigIntLimb *limbs, *old;
+
+    if (n <= x->capacity)
+        return tmpl_True;
+
+    /*  Grow geometrically so repeated growth costs amortized O(1) per limb.  */
+    capacity = 2 * x->capacity;
+
+    if (capacity < n)
+        capacity = n;
+
+    limbs = TMPL_MALLOC(tmpl_BigIntLimb, capacity);
+
+    if (!limbs)
+    {
+        tmpl_BigInt_Set_Error(x, message);
+        return tmpl_False;
+    }
+
+    old = TMPL_BIGINT_LIMBS(x);
+
+    for (k = 0; k < x->length; ++k)
+        limbs[k] = old[k];
+
+    /*  TMPL_FREE is a no-op for NULL, which is the case for small numbers.   */
+    TMPL_FREE(x->heap);
+    x->heap = limbs;
+    x->capacity = capacity;
+    return tmpl_True;
+}
+/*  End of tmpl_BigInt_Reserve.                                               */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,69 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                           tmpl_bigint_set_error                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Marks a number as invalid, giving it the value zero.                  *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigInt_Set_Error                                                 *
+ *  Purpose:                                                                  *
+ *      Marks a number as invalid, giving it the value zero.                  *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file containing TMPL_STATIC_INLINE macro.                  *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_bigint.h:                                                        *
+ *          Header file with the tmpl_BigInt typedef.                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_BIGINT_SET_ERROR_H
+#define TMPL_BIGINT_SET_ERROR_H
+
+/*  Location of the TMPL_STATIC_INLINE macro.                                 */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  tmpl_BigInt typedef and the limb types given here.                        */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  Sets x to an invalid zero with the given error message.                   */
+TMPL_STATIC_INLINE
+void tmpl_BigInt_Set_Error(tmpl_BigInt *x, const char *message)
+{
+    x->length = 0;
+    x->is_negative = tmpl_False;
+    x->error_occurred = tmpl_True;
+    x->error_message = message;
+}
+/*  End of tmpl_BigInt_Set_Error.                                             */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,205 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                              tmpl_add_bigint                               *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Adds and subtracts arbitrary-precision integers.                      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigInt_Add                                                       *
+ *      tmpl_BigInt_Subtract                                                  *
+ *  Purpose:                                                                  *
+ *      Computes x + y, or x - y.                                             *
+ *  Arguments:                                                                *
+ *      sum (tmpl_BigInt *):                                                  *
+ *          An initialized number, the sum or difference of x and y.          *
+ *      x (const tmpl_BigInt *):                                              *
+ *          A number.                                                         *
+ *      y (const tmpl_BigInt *):                                              *
+ *          Another number.                                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      src/bigint/auxiliary/tmpl_bigint_reserve.h:                           *
+ *          tmpl_BigInt_Reserve:                                              *
+ *              Makes room for the result.                                    *
+ *      src/bigint/auxiliary/tmpl_bigint_limbs_add.h:                         *
+ *          tmpl_BigIntLimbs_Add:                                             *
+ *              Adds two magnitudes.                                          *
+ *      src/bigint/auxiliary/tmpl_bigint_limbs_subtract.h:                    *
+ *          tmpl_BigIntLimbs_Subtract:                                        *
+ *              Subtracts two magnitudes.                                     *
+ *  Method:                                                                   *
+ *      Subtraction is addition with the sign of y flipped. If the signs      *
+ *      agree, add the magnitudes and keep the sign. Otherwise subtract the   *
+ *      smaller magnitude from the larger and take the sign of the larger.    *
+ *      The limb routines work in place, so no temporary is needed when sum   *
+ *      is the same as x or y.                                                *
+ *  Notes:                                                                    *
+ *      NULL or invalid inputs, and malloc failures, set the error_occurred   *
+ *      Boolean of sum.                                                       *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bigint.h:                                                        *
+ *          Header file where the function prototypes are given.              *
+ *  2.) tmpl_bigint_check_inputs.h:                                           *
+ *          Checks the inputs of a binary operation.                          *
+ *  3.) tmpl_bigint_reserve.h:                                                *
+ *          Makes room for the limbs of a number.                             *
+ *  4.) tmpl_bigint_normalize.h:                                              *
+ *          Removes leading zero limbs.                                       *
+ *  5.) tmpl_bigint_limbs_compare.h:                                          *
+ *          Compares two magnitudes.                                          *
+ *  6.) tmpl_bigint_limbs_add.h:                                              *
+ *          Adds two magnitudes.                                              *
+ *  7.) tmpl_bigint_limbs_subtract.h:                                         *
+ *          Subtracts two magnitudes.                                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes and typedefs given here.                              */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  Limb arithmetic and storage management found here.                        */
+#include "auxiliary/tmpl_bigint_check_inputs.h"
+#include "auxiliary/tmpl_bigint_reserve.h"
+#include "auxiliary/tmpl_bigint_normalize.h"
+#include "auxiliary/tmpl_bigint_limbs_compare.h"
+#include "auxiliary/tmpl_bigint_limbs_add.h"
+#include "auxiliary/tmpl_bigint_limbs_subtract.h"
+
+/*  Computes sum = x + (-1)^y_negative |y|, with the inputs already checked.  */
+static void
+tmpl_bigint_signed_add(tmpl_BigInt *sum,
+                       const tmpl_BigInt *x,
+                       const tmpl_BigInt *y,
+                       tmpl_Bool y_negative,
+                       const char *malloc_message)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const tmpl_BigInt *big, *small;
+    tmpl_Bool big_negative, small_negative;
+    tmpl_BigIntLimb *out;
+    size_t big_length, small_length;
+
+    /*  Order the inputs by magnitude.                                        */
+    const int cmp = tmpl_BigIntLimbs_Compare(TMPL_BIGINT_LIMBS(x), x->length,
+                                             TMPL_BIGINT_LIMBS(y), y->length);
+
+    if (cmp >= 0)
+    {
+        big = x;
+        small = y;
+        big_negative = x->is_negative;
+        small_negative = y_negative;
+    }
+
+    else
+    {
+        big = y;
+        small = x;
+        big_negative = y_negative;
+        small_negative = x->is_negative;
+    }
+
+    big_length = big->length;
+    small_length = small->length;
+
+    /*  The sum needs at most one more limb than the larger input. Reserve    *
+     *  keeps the current limbs of sum, which matters if sum is x or y.       */
+    if (!tmpl_BigInt_Reserve(sum, big_length + 1, malloc_message))
+        return;
+
+    out = TMPL_BIGINT_LIMBS(sum);
+
+    /*  Reserve may have moved the limbs of sum, so get those of x and y now. */
+    if (big_negative == small_negative)
+        out[big_length] = tmpl_BigIntLimbs_Add(
+            out, TMPL_BIGINT_LIMBS(big), big_length,
+            TMPL_BIGINT_LIMBS(small), small_length
+        );
+
+    else
+    {
+        (void)tmpl_BigIntLimbs_Subtract(
+            out, TMPL_BIGINT_LIMBS(big), big_length,
+            TMPL_BIGINT_LIMBS(small), small_length
+        );
+
+        out[big_length] = 0;
+    }
+
+    sum->length = big_length + 1;
+    sum->is_negative = big_negative;
+    sum->error_occurred = tmpl_False;
+    sum->error_message = NULL;
+    tmpl_BigInt_Normalize(sum);
+}
+/*  End of tmpl_bigint_signed_add.                                            */
+
+/*  Function for adding two numbers.                                          */
+void
+tmpl_BigInt_Add(tmpl_BigInt *sum, const tmpl_BigInt *x, const tmpl_BigInt *y)
+{
+    /*  Nothing to do if there is nowhere to write.                           */
+    if (!sum)
+        return;
+
+    if (!tmpl_BigInt_Check_Inputs(sum, x, y,
+                                  "\nError Encountered:\n"
+                                  "    tmpl_BigInt_Add\n\n"
+                                  "Input is NULL. Aborting.\n\n"))
+        return;
+
+    tmpl_bigint_signed_add(sum, x, y, y->is_negative,
+                           "\nError Encountered:\n"
+                           "    tmpl_BigInt_Add\n\n"
+                           "malloc failed. Aborting.\n\n");
+}
+/*  End of tmpl_BigInt_Add.                                                   */
+
+/*  Function for subtracting two numbers.                                     */
+void
+tmpl_BigInt_Subtract(tmpl_BigInt *diff,
+                     const tmpl_BigInt *x,
+                     const tmpl_BigInt *y)
+{
+    /*  Nothing to do if there is nowhere to write.                           */
+    if (!diff)
+        return;
+
+    if (!tmpl_BigInt_Check_Inputs(diff, x, y,
+                                  "\nError Encountered:\n"
+                                  "    tmpl_BigInt_Subtract\n\n"
+                                  "Input is NULL. Aborting.\n\n"))
+        return;
+
+    /*  x - y = x + (-y). The sign of zero does not matter here, since        *
+     *  Normalize gives a zero result a positive sign.                        */
+    tmpl_bigint_signed_add(diff, x, y, !y->is_negative,
+                           "\nError Encountered:\n"
+                           "    tmpl_BigInt_Subtract\n\n"
+                           "malloc failed. Aborting.\n\n");
+}
+/*  End of tmpl_BigInt_Subtract.                                              */
@@ -0,0 +1,92 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                            tmpl_compare_bigint                             *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Compares two arbitrary-precision integers.                            *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigInt_Compare                                                   *
+ *  Purpose:                                                                  *
+ *      Determines if x is less than, equal to, or greater than y.            *
+ *  Arguments:                                                                *
+ *      x (const tmpl_BigInt *):                                              *
+ *          A number.                                                         *
+ *      y (const tmpl_BigInt *):                                              *
+ *          Another number.                                                   *
+ *  Output:                                                                   *
+ *      cmp (int):                                                            *
+ *          -1 if x < y, 0 if x = y, and 1 if x > y.                          *
+ *  Called Functions:                                                         *
+ *      src/bigint/auxiliary/tmpl_bigint_limbs_compare.h:                     *
+ *          tmpl_BigIntLimbs_Compare:                                         *
+ *              Compares two magnitudes.                                      *
+ *  Method:                                                                   *
+ *      Numbers of opposite signs compare by sign alone. Otherwise compare    *
+ *      the magnitudes, and flip the result for negative numbers.             *
+ *  Notes:                                                                    *
+ *      NULL pointers and invalid numbers are treated as zero.                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bigint.h:                                                        *
+ *          Header file where the function prototype is given.                *
+ *  2.) tmpl_bigint_limbs_compare.h:                                          *
+ *          Compares two magnitudes.                                          *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  tmpl_BigIntLimbs_Compare found here.                                      */
+#include "auxiliary/tmpl_bigint_limbs_compare.h"
+
+/*  Function for comparing two numbers.                                       */
+int tmpl_BigInt_Compare(const tmpl_BigInt *x, const tmpl_BigInt *y)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    int cmp;
+    size_t xn, yn;
+    tmpl_Bool x_neg, y_neg;
+
+    /*  Invalid numbers are treated as zero.                                  */
+    xn = (x && !x->error_occurred ? x->length : 0);
+    yn = (y && !y->error_occurred ? y->length : 0);
+    x_neg = (xn && x->is_negative);
+    y_neg = (yn && y->is_negative);
+
+    if (x_neg != y_neg)
+        return (x_neg ? -1 : 1);
+
+    /*  The signs agree, so if one is zero the other is zero or positive.     */
+    if (!xn || !yn)
+        return (xn ? 1 : (yn ? -1 : 0));
+
+    /*  Same signs. Compare magnitudes, the longer one is larger.             */
+    cmp = tmpl_BigIntLimbs_Compare(TMPL_BIGINT_LIMBS(x), xn,
+                                   TMPL_BIGINT_LIMBS(y), yn);
+
+    return (x_neg ? -cmp : cmp);
+}
+/*  End of tmpl_BigInt_Compare.                                               */
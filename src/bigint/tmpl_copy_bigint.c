@@ -0,0 +1,117 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                              tmpl_copy_bigint                              *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Copies an arbitrary-precision integer.                                *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigInt_Copy                                                      *
+ *  Purpose:                                                                  *
+ *      Sets dest to the value of src.                                        *
+ *  Arguments:                                                                *
+ *      dest (tmpl_BigInt *):                                                 *
+ *          An initialized number, the copy.                                  *
+ *      src (const tmpl_BigInt *):                                            *
+ *          The number being copied.                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      src/bigint/auxiliary/tmpl_bigint_reserve.h:                           *
+ *          tmpl_BigInt_Reserve:                                              *
+ *              Makes room for the limbs of src.                              *
+ *  Method:                                                                   *
+ *      Grow dest if needed, and copy the limbs. The existing storage of dest *
+ *      is reused whenever it is large enough.                                *
+ *  Notes:                                                                    *
+ *      Errors in src are copied to dest.                                     *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bigint.h:                                                        *
+ *          Header file where the function prototype is given.                *
+ *  2.) tmpl_bigint_set_error.h:                                              *
+ *          Marks a number as invalid.                                        *
+ *  3.) tmpl_bigint_reserve.h:                                                *
+ *          Makes room for the limbs of a number.                             *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  tmpl_BigInt_Reserve found here.                                           */
+#include "auxiliary/tmpl_bigint_set_error.h"
+#include "auxiliary/tmpl_bigint_reserve.h"
+
+/*  Function for copying a number.                                            */
+void tmpl_BigInt_Copy(tmpl_BigInt *dest, const tmpl_BigInt *src)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    tmpl_BigIntLimb *out;
+    const tmpl_BigIntLimb *in;
+
+    /*  Nothing to do if there is nowhere to write, or nothing to copy.       */
+    if (!dest || dest == src)
+        return;
+
+    if (!src)
+    {
+        tmpl_BigInt_Set_Error(
+            dest,
+            "\nError Encountered:\n"
+            "    tmpl_BigInt_Copy\n\n"
+            "Input is NULL. Aborting.\n\n"
+        );
+
+        return;
+    }
+
+    if (src->error_occurred)
+    {
+        tmpl_BigInt_Set_Error(dest, src->error_message);
+        return;
+    }
+
+    /*  The old value does not need to be kept while growing.                 */
+    dest->length = 0;
+
+    if (!tmpl_BigInt_Reserve(dest, src->length,
+                             "\nError Encountered:\n"
+                             "    tmpl_BigInt_Copy\n\n"
+                             "malloc failed. Aborting.\n\n"))
+        return;
+
+    out = TMPL_BIGINT_LIMBS(dest);
+    in = TMPL_BIGINT_LIMBS(src);
+
+    for (n = 0; n < src->length; ++n)
+        out[n] = in[n];
+
+    dest->length = src->length;
+    dest->is_negative = src->is_negative;
+    dest->error_occurred = tmpl_False;
+    dest->error_message = NULL;
+}
+/*  End of tmpl_BigInt_Copy.                                                  */
@@ -0,0 +1,73 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                            tmpl_destroy_bigint                             *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Frees the memory in an arbitrary-precision integer.                   *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigInt_Destroy                                                   *
+ *  Purpose:                                                                  *
+ *      Frees the heap memory of a number and resets it to zero.              *
+ *  Arguments:                                                                *
+ *      x (tmpl_BigInt *):                                                    *
+ *          An initialized number.                                            *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_bigint.h:                                                        *
+ *          tmpl_BigInt_Init:                                                 *
+ *              Resets the number to zero.                                    *
+ *  Method:                                                                   *
+ *      Free the heap storage, if there is any, and re-initialize.            *
+ *  Notes:                                                                    *
+ *      It is safe to call this more than once, and the number may be used    *
+ *      again afterwards.                                                     *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_free.h:                                                          *
+ *          Header file providing TMPL_FREE.                                  *
+ *  2.) tmpl_bigint.h:                                                        *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_FREE macro found here.                                               */
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  Function for freeing the memory in a number.                              */
+void tmpl_BigInt_Destroy(tmpl_BigInt *x)
+{
+    /*  Nothing to do for a NULL pointer.                                     */
+    if (!x)
+        return;
+
+    /*  TMPL_FREE is a no-op for NULL, which is the case for small numbers.   */
+    TMPL_FREE(x->heap);
+    tmpl_BigInt_Init(x);
+}
+/*  End of tmpl_BigInt_Destroy.                                               */
@@ -0,0 +1,399 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                             tmpl_divrem_bigint                             *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Divides arbitrary-precision integers.                                 *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigInt_DivRem                                                    *
+ *  Purpose:                                                                  *
+ *      Computes the truncated quotient x / y and the remainder x mod y.      *
+ *  Arguments:                                                                *
+ *      quot (tmpl_BigInt *):                                                 *
+ *          An initialized number, the quotient. May be NULL.                 *
+ *      rem (tmpl_BigInt *):                                                  *
+ *          An initialized number, the remainder. May be NULL.                *
+ *      x (const tmpl_BigInt *):                                              *
+ *          The dividend.                                                     *
+ *      y (const tmpl_BigInt *):                                              *
+ *          The divisor.                                                      *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      src/bigint/auxiliary/tmpl_bigint_limbs_divrem_1.h:                    *
+ *          tmpl_BigIntLimbs_DivRem_1:                                        *
+ *              Divides a magnitude by a single limb.                         *
+ *      src/bigint/auxiliary/tmpl_bigint_reserve.h:                           *
+ *          tmpl_BigInt_Reserve:                                              *
+ *              Makes room for the quotient and remainder.                    *
+ *  Method:                                                                   *
+ *      Single limb divisors use short division. Otherwise use Knuth's        *
+ *      Algorithm D (The Art of Computer Programming, Vol. 2, 4.3.1).         *
+ *      Shift both numbers left so the top bit of the divisor v is set. Then  *
+ *      for each limb of the quotient, estimate it from the top two limbs of  *
+ *      the running remainder u and the top limb of v:                        *
+ *                                                                            *
+ *          qhat = (u[j+n] B + u[j+n-1]) / v[n-1]                             *
+ *                                                                            *
+ *      Correct qhat using v[n-2], after which it is at most one too large.   *
+ *      Subtract qhat v from u. If the result is negative, which is rare,     *
+ *      decrement qhat and add v back. Finally shift the remainder back.      *
+ *                                                                            *
+ *      The quotient is rounded towards zero, so it is negative if the signs  *
+ *      differ, and the remainder has the sign of x.                          *
+ *  Notes:                                                                    *
+ *      Division by zero, NULL or invalid inputs, and malloc failures set the *
+ *      error_occurred Boolean of the outputs. The results are computed into  *
+ *      new storage, so quot and rem may be the same as x or y.               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_malloc.h:                                                        *
+ *          Header file providing TMPL_MALLOC.                                *
+ *  2.) tmpl_free.h:                                                          *
+ *          Header file providing TMPL_FREE.                                  *
+ *  3.) tmpl_bigint.h:                                                        *
+ *          Header file where the function prototype is given.                *
+ *  4.) tmpl_bigint_set_error.h:                                              *
+ *          Marks a number as invalid.                                        *
+ *  5.) tmpl_bigint_reserve.h:                                                *
+ *          Makes room for the limbs of a number.                             *
+ *  6.) tmpl_bigint_normalize.h:                                              *
+ *          Removes leading zero limbs.                                       *
+ *  7.) tmpl_bigint_move.h:                                                   *
+ *          Moves one number into another.                                    *
+ *  8.) tmpl_bigint_limbs_compare.h:                                          *
+ *          Compares two magnitudes.                                          *
+ *  9.) tmpl_bigint_limbs_divrem_1.h:                                         *
+ *          Divides a magnitude by a single limb.                             *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_MALLOC and TMPL_FREE macros found here.                              */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  Limb arithmetic and storage management found here.                        */
+#include "auxiliary/tmpl_bigint_set_error.h"
+#include "auxiliary/tmpl_bigint_reserve.h"
+#include "auxiliary/tmpl_bigint_normalize.h"
+#include "auxiliary/tmpl_bigint_move.h"
+#include "auxiliary/tmpl_bigint_limbs_compare.h"
+#include "auxiliary/tmpl_bigint_limbs_divrem_1.h"
+
+/*  Marks both outputs as invalid. Either may be NULL.                        */
+static void
+tmpl_bigint_divrem_error(tmpl_BigInt *quot,
+                         tmpl_BigInt *rem,
+                         const char *message)
+{
+    if (quot)
+        tmpl_BigInt_Set_Error(quot, message);
+
+    if (rem)
+        tmpl_BigInt_Set_Error(rem, message);
+}
+/*  End of tmpl_bigint_divrem_error.                                          */
+
+/*  Computes r = a << shift for 0 <= shift < TMPL_BIGINT_LIMB_BIT, where r   *
+ *  and a have n limbs. Returns the bits shifted out of the top limb.         */
+static tmpl_BigIntLimb
+tmpl_bigint_shift_left(tmpl_BigIntLimb *r,
+                       const tmpl_BigIntLimb *a,
+                       size_t n,
+                       unsigned int shift)
+{
+    tmpl_BigIntDoubleLimb acc = 0;
+    size_t k;
+
+    /*  Shifting within the double limb avoids a shift by the full width.     */
+    for (k = 0; k < n; ++k)
+    {
+        acc |= (tmpl_BigIntDoubleLimb)a[k] << shift;
+        r[k] = (tmpl_BigIntLimb)(acc & TMPL_BIGINT_LIMB_MASK);
+        acc >>= TMPL_BIGINT_LIMB_BIT;
+    }
+
+    return (tmpl_BigIntLimb)acc;
+}
+/*  End of tmpl_bigint_shift_left.                                            */
+
+/*  Computes r = a >> shift for 0 <= shift < TMPL_BIGINT_LIMB_BIT, where r    *
+ *  has n limbs and a has n + 1.                                              */
+static void
+tmpl_bigint_shift_right(tmpl_BigIntLimb *r,
+                        const tmpl_BigIntLimb *a,
+                        size_t n,
+                        unsigned int shift)
+{
+    size_t k;
+
+    for (k = 0; k < n; ++k)
+    {
+        const tmpl_BigIntDoubleLimb pair =
+            ((tmpl_BigIntDoubleLimb)a[k + 1] << TMPL_BIGINT_LIMB_BIT) |
+            (tmpl_BigIntDoubleLimb)a[k];
+
+        r[k] = (tmpl_BigIntLimb)((pair >> shift) & TMPL_BIGINT_LIMB_MASK);
+    }
+}
+/*  End of tmpl_bigint_shift_right.                                           */
+
+/*  Knuth's Algorithm D. Computes q = u / v and r = u mod v for un >= vn >= 2 *
+ *  and v[vn - 1] non-zero. q has un - vn + 1 limbs and r has vn limbs.       *
+ *  Returns false if malloc fails.                                            */
+static tmpl_Bool
+tmpl_bigint_divrem_knuth(tmpl_BigIntLimb *q,
+                         tmpl_BigIntLimb *r,
+                         const tmpl_BigIntLimb *u, size_t un,
+                         const tmpl_BigIntLimb *v, size_t vn)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t i, j;
+    unsigned int shift = 0U;
+    tmpl_BigIntLimb top;
+    tmpl_BigIntLimb *work, *wu, *wv;
+
+    /*  The base B = 2^TMPL_BIGINT_LIMB_BIT as a double limb.                 */
+    const tmpl_BigIntDoubleLimb base = (tmpl_BigIntDoubleLimb)1
+                                     << TMPL_BIGINT_LIMB_BIT;
+
+    /*  The shifted dividend needs one extra limb.                            */
+    work = TMPL_MALLOC(tmpl_BigIntLimb, un + vn + 1);
+
+    if (!work)
+        return tmpl_False;
+
+    wu = work;
+    wv = work + un + 1;
+
+    /*  Count the leading zeros of the divisor.                               */
+    top = v[vn - 1];
+
+    while (!(top >> (TMPL_BIGINT_LIMB_BIT - 1)))
+    {
+        top = (tmpl_BigIntLimb)(top << 1);
+        ++shift;
+    }
+
+    /*  Shift both numbers left so the divisor's top bit is set.              */
+    (void)tmpl_bigint_shift_left(wv, v, vn, shift);
+    wu[un] = tmpl_bigint_shift_left(wu, u, un, shift);
+
+    /*  Compute the quotient one limb at a time, from the top down.           */
+    for (j = un - vn + 1; j > 0; --j)
+    {
+        const size_t k = j - 1;
+        tmpl_BigIntDoubleLimb qhat, rhat, carry, borrow, diff;
+
+        const tmpl_BigIntDoubleLimb num =
+            ((tmpl_BigIntDoubleLimb)wu[k + vn] << TMPL_BIGINT_LIMB_BIT) |
+            (tmpl_BigIntDoubleLimb)wu[k + vn - 1];
+
+        /*  Estimate the quotient limb from the leading limbs.                */
+        qhat = num / wv[vn - 1];
+        rhat = num % wv[vn - 1];
+
+        /*  Correct the estimate with the second limb of the divisor.         */
+        while (qhat >= base ||
+               qhat * wv[vn - 2] > ((rhat << TMPL_BIGINT_LIMB_BIT) |
+                                    (tmpl_BigIntDoubleLimb)wu[k + vn - 2]))
+        {
+            --qhat;
+            rhat += wv[vn - 1];
+
+            if (rhat >= base)
+                break;
+        }
+
+        /*  Subtract qhat times the divisor from the running remainder.       */
+        carry = 0;
+        borrow = 0;
+
+        for (i = 0; i < vn; ++i)
+        {
+            const tmpl_BigIntDoubleLimb prod = qhat * wv[i] + carry;
+            carry = prod >> TMPL_BIGINT_LIMB_BIT;
+
+            diff = (tmpl_BigIntDoubleLimb)wu[k + i] -
+                   (prod & TMPL_BIGINT_LIMB_MASK) - borrow;
+
+            wu[k + i] = (tmpl_BigIntLimb)(diff & TMPL_BIGINT_LIMB_MASK);
+            borrow = (diff >> TMPL_BIGINT_LIMB_BIT) & 1U;
+        }
+
+        carry += borrow;
+        borrow = ((tmpl_BigIntDoubleLimb)wu[k + vn] < carry);
+        wu[k + vn] = (tmpl_BigIntLimb)(((tmpl_BigIntDoubleLimb)wu[k + vn] -
+                                        carry) & TMPL_BIGINT_LIMB_MASK);
+
+        /*  The estimate was one too large. Add the divisor back.             */
+        if (borrow)
+        {
+            --qhat;
+            carry = 0;
+
+            for (i = 0; i < vn; ++i)
+            {
+                carry += (tmpl_BigIntDoubleLimb)wu[k + i] +
+                         (tmpl_BigIntDoubleLimb)wv[i];
+
+                wu[k + i] = (tmpl_BigIntLimb)(carry & TMPL_BIGINT_LIMB_MASK);
+                carry >>= TMPL_BIGINT_LIMB_BIT;
+            }
+
+            wu[k + vn] = (tmpl_BigIntLimb)((wu[k + vn] + carry) &
+                                           TMPL_BIGINT_LIMB_MASK);
+        }
+
+        q[k] = (tmpl_BigIntLimb)qhat;
+    }
+
+    /*  Undo the shift on the remainder.                                      */
+    tmpl_bigint_shift_right(r, wu, vn, shift);
+
+    TMPL_FREE(work);
+    return tmpl_True;
+}
+/*  End of tmpl_bigint_divrem_knuth.                                          */
+
+/*  Function for dividing two numbers with remainder.                         */
+void
+tmpl_BigInt_DivRem(tmpl_BigInt *quot,
+                   tmpl_BigInt *rem,
+                   const tmpl_BigInt *x,
+                   const tmpl_BigInt *y)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    tmpl_BigInt q, r;
+    size_t xn, yn;
+
+    /*  Error message for malloc failures.                                    */
+    const char * const malloc_message =
+        "\nError Encountered:\n"
+        "    tmpl_BigInt_DivRem\n\n"
+        "malloc failed. Aborting.\n\n";
+
+    /*  Nothing to do if there is nowhere to write.                           */
+    if (!quot && !rem)
+        return;
+
+    if (!x || !y)
+    {
+        tmpl_bigint_divrem_error(quot, rem,
+                                 "\nError Encountered:\n"
+                                 "    tmpl_BigInt_DivRem\n\n"
+                                 "Input is NULL. Aborting.\n\n");
+        return;
+    }
+
+    /*  Errors in the inputs are passed along to the outputs.                 */
+    if (x->error_occurred || y->error_occurred)
+    {
+        tmpl_bigint_divrem_error(
+            quot, rem, (x->error_occurred ? x->error_message : y->error_message)
+        );
+
+        return;
+    }
+
+    if (!y->length)
+    {
+        tmpl_bigint_divrem_error(quot, rem,
+                                 "\nError Encountered:\n"
+                                 "    tmpl_BigInt_DivRem\n\n"
+                                 "Division by zero. Aborting.\n\n");
+        return;
+    }
+
+    xn = x->length;
+    yn = y->length;
+    tmpl_BigInt_Init(&q);
+    tmpl_BigInt_Init(&r);
+
+    /*  If |x| < |y| the quotient is zero and the remainder is x.             */
+    if (tmpl_BigIntLimbs_Compare(TMPL_BIGINT_LIMBS(x), xn,
+                                 TMPL_BIGINT_LIMBS(y), yn) < 0)
+    {
+        tmpl_BigInt_Copy(&r, x);
+
+        if (r.error_occurred)
+        {
+            tmpl_bigint_divrem_error(quot, rem, malloc_message);
+            return;
+        }
+    }
+
+    else
+    {
+        if (!tmpl_BigInt_Reserve(&q, xn - yn + 1, malloc_message) ||
+            !tmpl_BigInt_Reserve(&r, yn, malloc_message))
+        {
+            tmpl_BigInt_Destroy(&q);
+            tmpl_BigInt_Destroy(&r);
+            tmpl_bigint_divrem_error(quot, rem, malloc_message);
+            return;
+        }
+
+        /*  Short division needs no workspace.                                */
+        if (yn == 1)
+            TMPL_BIGINT_LIMBS(&r)[0] = tmpl_BigIntLimbs_DivRem_1(
+                TMPL_BIGINT_LIMBS(&q), TMPL_BIGINT_LIMBS(x), xn,
+                TMPL_BIGINT_LIMBS(y)[0]
+            );
+
+        else if (!tmpl_bigint_divrem_knuth(TMPL_BIGINT_LIMBS(&q),
+                                           TMPL_BIGINT_LIMBS(&r),
+                                           TMPL_BIGINT_LIMBS(x), xn,
+                                           TMPL_BIGINT_LIMBS(y), yn))
+        {
+            tmpl_BigInt_Destroy(&q);
+            tmpl_BigInt_Destroy(&r);
+            tmpl_bigint_divrem_error(quot, rem, malloc_message);
+            return;
+        }
+
+        q.length = xn - yn + 1;
+        q.is_negative = (x->is_negative != y->is_negative);
+        r.length = yn;
+        r.is_negative = x->is_negative;
+        tmpl_BigInt_Normalize(&q);
+        tmpl_BigInt_Normalize(&r);
+    }
+
+    /*  x and y are no longer needed, so the outputs may now be written.      */
+    if (quot)
+        tmpl_BigInt_Move(quot, &q);
+    else
+        tmpl_BigInt_Destroy(&q);
+
+    if (rem)
+        tmpl_BigInt_Move(rem, &r);
+    else
+        tmpl_BigInt_Destroy(&r);
+}
+/*  End of tmpl_BigInt_DivRem.                                                */
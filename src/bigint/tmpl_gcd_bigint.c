@@ -0,0 +1,366 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                              tmpl_gcd_bigint                               *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the GCD of arbitrary-precision integers.                     *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigInt_GCD                                                       *
+ *  Purpose:                                                                  *
+ *      Computes the greatest common divisor of x and y.                      *
+ *  Arguments:                                                                *
+ *      gcd (tmpl_BigInt *):                                                  *
+ *          An initialized number, the GCD of x and y.                        *
+ *      x (const tmpl_BigInt *):                                              *
+ *          A number.                                                         *
+ *      y (const tmpl_BigInt *):                                              *
+ *          Another number.                                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      libtmpl/include/tmpl_integer.h:                                       *
+ *          tmpl_ULong_GCD_Mixed_Binary:                                      *
+ *              Computes the GCD once both numbers fit in one limb.           *
+ *      libtmpl/include/tmpl_bigint.h:                                        *
+ *          tmpl_BigInt_DivRem:                                               *
+ *              Performs a full Euclidean step when Lehmer's step fails.      *
+ *      src/bigint/auxiliary/tmpl_bigint_limbs_addmul_1.h:                    *
+ *          tmpl_BigIntLimbs_AddMul_1:                                        *
+ *              Multiplies a magnitude by a cofactor.                         *
+ *      src/bigint/auxiliary/tmpl_bigint_limbs_divrem_1.h:                    *
+ *          tmpl_BigIntLimbs_DivRem_1:                                        *
+ *              Reduces the larger number by a single limb.                   *
+ *  Method:                                                                   *
+ *      Lehmer's algorithm (Knuth, The Art of Computer Programming, Vol. 2,   *
+ *      4.5.2, Algorithm L). Most Euclidean quotients are small, and depend   *
+ *      only on the leading digits of a and b. Take the top limb's worth of   *
+ *      bits of a, and the bits of b at the same position, call these ahat    *
+ *      and bhat, and run the Euclidean algorithm on them with cofactors:     *
+ *                                                                            *
+ *          q = (ahat + A) / (bhat + C) = (ahat + B) / (bhat + D)             *
+ *                                                                            *
+ *      The two quotients bound the true one, so while they agree, q is the   *
+ *      quotient of the full numbers as well. Once they differ, apply all of  *
+ *      the steps at once with a single pass over the limbs:                  *
+ *                                                                            *
+ *          (a, b) <- (A a + B b, C a + D b)                                  *
+ *                                                                            *
+ *      If not even one step succeeded (B = 0), do a full division instead.   *
+ *      This replaces most multi-precision divisions by single limb products. *
+ *      Once b fits in one limb, finish with one short division and the       *
+ *      binary GCD on machine words.                                          *
+ *  Notes:                                                                    *
+ *      NULL or invalid inputs, and malloc failures, set the error_occurred   *
+ *      Boolean of gcd. The result is non-negative, and GCD(0, 0) = 0.        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_malloc.h:                                                        *
+ *          Header file providing TMPL_MALLOC.                                *
+ *  2.) tmpl_free.h:                                                          *
+ *          Header file providing TMPL_FREE.                                  *
+ *  3.) tmpl_integer.h:                                                       *
+ *          Header file with tmpl_ULong_GCD_Mixed_Binary.                     *
+ *  4.) tmpl_bigint.h:                                                        *
+ *          Header file where the function prototype is given.                *
+ *  5.) tmpl_bigint_set_error.h:                                              *
+ *          Marks a number as invalid.                                        *
+ *  6.) tmpl_bigint_check_inputs.h:                                           *
+ *          Checks the inputs of a binary operation.                          *
+ *  7.) tmpl_bigint_reserve.h:                                                *
+ *          Makes room for the limbs of a number.                             *
+ *  8.) tmpl_bigint_normalize.h:                                              *
+ *          Removes leading zero limbs.                                       *
+ *  9.) tmpl_bigint_move.h:                                                   *
+ *          Moves one number into another.                                    *
+ *  10.) tmpl_bigint_limbs_subtract.h:                                        *
+ *          Subtracts two magnitudes.                                         *
+ *  11.) tmpl_bigint_limbs_addmul_1.h:                                        *
+ *          Multiply-accumulate by a single limb.                             *
+ *  12.) tmpl_bigint_limbs_divrem_1.h:                                        *
+ *          Divides a magnitude by a single limb.                             *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_MALLOC and TMPL_FREE macros found here.                              */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  tmpl_ULong_GCD_Mixed_Binary found here.                                   */
+#include <libtmpl/include/tmpl_integer.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  Limb arithmetic and storage management found here.                        */
+#include "auxiliary/tmpl_bigint_set_error.h"
+#include "auxiliary/tmpl_bigint_check_inputs.h"
+#include "auxiliary/tmpl_bigint_reserve.h"
+#include "auxiliary/tmpl_bigint_normalize.h"
+#include "auxiliary/tmpl_bigint_move.h"
+#include "auxiliary/tmpl_bigint_limbs_subtract.h"
+#include "auxiliary/tmpl_bigint_limbs_addmul_1.h"
+#include "auxiliary/tmpl_bigint_limbs_divrem_1.h"
+
+/*  Computes out = s a + t b, with a and b having n limbs, where s and t do   *
+ *  not have the same sign and the result is known to be non-negative. p and  *
+ *  q are scratch arrays of n + 1 limbs, and out has n + 1 limbs.             */
+static void
+tmpl_bigint_lehmer_combine(tmpl_BigIntLimb *out,
+                           const tmpl_BigIntLimb *a,
+                           const tmpl_BigIntLimb *b,
+                           size_t n,
+                           tmpl_BigIntSignedDoubleLimb s,
+                           tmpl_BigIntSignedDoubleLimb t,
+                           tmpl_BigIntLimb *p,
+                           tmpl_BigIntLimb *q)
+{
+    size_t k;
+    const tmpl_BigIntLimb abs_s = (tmpl_BigIntLimb)(s < 0 ? -s : s);
+    const tmpl_BigIntLimb abs_t = (tmpl_BigIntLimb)(t < 0 ? -t : t);
+
+    for (k = 0; k < n; ++k)
+    {
+        p[k] = 0;
+        q[k] = 0;
+    }
+
+    /*  The cofactors are less than one limb in magnitude.                    */
+    p[n] = tmpl_BigIntLimbs_AddMul_1(p, a, n, abs_s);
+    q[n] = tmpl_BigIntLimbs_AddMul_1(q, b, n, abs_t);
+
+    /*  If t is positive then s <= 0, and out = |t| b - |s| a.                */
+    if (t > 0)
+        (void)tmpl_BigIntLimbs_Subtract(out, q, n + 1, p, n + 1);
+    else
+        (void)tmpl_BigIntLimbs_Subtract(out, p, n + 1, q, n + 1);
+}
+/*  End of tmpl_bigint_lehmer_combine.                                        */
+
+/*  Swaps two numbers. Small numbers are stored inline, so this is safe.      */
+static void tmpl_bigint_swap(tmpl_BigInt *x, tmpl_BigInt *y)
+{
+    const tmpl_BigInt tmp = *x;
+    *x = *y;
+    *y = tmp;
+}
+/*  End of tmpl_bigint_swap.                                                  */
+
+/*  Reduces a >= b >= 0 until b has at most one limb, keeping the GCD. r is  *
+ *  a temporary and work has 4 (n + 1) limbs, n the initial length of a.      *
+ *  Returns false if malloc fails.                                            */
+static tmpl_Bool
+tmpl_bigint_lehmer_reduce(tmpl_BigInt *a,
+                          tmpl_BigInt *b,
+                          tmpl_BigInt *r,
+                          tmpl_BigIntLimb *work,
+                          const char *malloc_message)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    tmpl_BigIntLimb *al, *bl;
+    size_t n, k;
+
+    while (b->length > 1)
+    {
+        tmpl_BigIntSignedDoubleLimb ahat, bhat, q0, q1, tmp;
+        tmpl_BigIntSignedDoubleLimb A = 1, B = 0, C = 0, D = 1;
+        unsigned int bits = 1U;
+
+        n = a->length;
+
+        /*  If the lengths differ by more than a limb, the quotient is large  *
+         *  and one division is the fastest way to reduce a.                  */
+        if (n - b->length > 1)
+        {
+            tmpl_BigInt_DivRem(NULL, r, a, b);
+
+            if (r->error_occurred)
+                return tmpl_False;
+
+            tmpl_bigint_swap(a, b);
+            tmpl_bigint_swap(b, r);
+            continue;
+        }
+
+        /*  b has n or n - 1 limbs. Pad it with zeros to n limbs.             */
+        if (!tmpl_BigInt_Reserve(b, n, malloc_message))
+            return tmpl_False;
+
+        al = TMPL_BIGINT_LIMBS(a);
+        bl = TMPL_BIGINT_LIMBS(b);
+
+        for (k = b->length; k < n; ++k)
+            bl[k] = 0;
+
+        /*  The top limb's worth of bits of a, and those of b at the same     *
+         *  position. bits is the bit length of the top limb of a.            */
+        while (bits < TMPL_BIGINT_LIMB_BIT && (al[n - 1] >> bits))
+            ++bits;
+
+        ahat = (tmpl_BigIntSignedDoubleLimb)(
+            ((((tmpl_BigIntDoubleLimb)al[n - 1] << TMPL_BIGINT_LIMB_BIT) |
+              (tmpl_BigIntDoubleLimb)al[n - 2]) >> bits)
+        );
+
+        bhat = (tmpl_BigIntSignedDoubleLimb)(
+            ((((tmpl_BigIntDoubleLimb)bl[n - 1] << TMPL_BIGINT_LIMB_BIT) |
+              (tmpl_BigIntDoubleLimb)bl[n - 2]) >> bits)
+        );
+
+        /*  Single precision Euclid, while the quotient is certain.           */
+        while (bhat + C > 0 && bhat + D > 0)
+        {
+            q0 = (ahat + A) / (bhat + C);
+            q1 = (ahat + B) / (bhat + D);
+
+            if (q0 != q1)
+                break;
+
+            tmp = A - q0 * C;
+            A = C;
+            C = tmp;
+            tmp = B - q0 * D;
+            B = D;
+            D = tmp;
+            tmp = ahat - q0 * bhat;
+            ahat = bhat;
+            bhat = tmp;
+        }
+
+        /*  No step could be taken. Fall back to one full division.           */
+        if (B == 0)
+        {
+            tmpl_BigInt_DivRem(NULL, r, a, b);
+
+            if (r->error_occurred)
+                return tmpl_False;
+
+            tmpl_bigint_swap(a, b);
+            tmpl_bigint_swap(b, r);
+            continue;
+        }
+
+        /*  Apply all of the steps at once. Both results are at most a.       */
+        tmpl_bigint_lehmer_combine(work, al, bl, n, A, B,
+                                   work + 2 * (n + 1), work + 3 * (n + 1));
+
+        tmpl_bigint_lehmer_combine(work + (n + 1), al, bl, n, C, D,
+                                   work + 2 * (n + 1), work + 3 * (n + 1));
+
+        for (k = 0; k < n; ++k)
+        {
+            al[k] = work[k];
+            bl[k] = work[n + 1 + k];
+        }
+
+        a->length = n;
+        b->length = n;
+        tmpl_BigInt_Normalize(a);
+        tmpl_BigInt_Normalize(b);
+    }
+
+    return tmpl_True;
+}
+/*  End of tmpl_bigint_lehmer_reduce.                                         */
+
+/*  Function for computing the GCD of two numbers.                            */
+void
+tmpl_BigInt_GCD(tmpl_BigInt *gcd, const tmpl_BigInt *x, const tmpl_BigInt *y)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    tmpl_BigInt a, b, r;
+    tmpl_BigIntLimb *work = NULL;
+    tmpl_Bool success;
+    unsigned long int u, v;
+
+    /*  Error message for malloc failures.                                    */
+    const char * const malloc_message =
+        "\nError Encountered:\n"
+        "    tmpl_BigInt_GCD\n\n"
+        "malloc failed. Aborting.\n\n";
+
+    /*  Nothing to do if there is nowhere to write.                           */
+    if (!gcd)
+        return;
+
+    if (!tmpl_BigInt_Check_Inputs(gcd, x, y,
+                                  "\nError Encountered:\n"
+                                  "    tmpl_BigInt_GCD\n\n"
+                                  "Input is NULL. Aborting.\n\n"))
+        return;
+
+    /*  Work with |x| and |y|, sorted so that a >= b.                         */
+    tmpl_BigInt_Init(&a);
+    tmpl_BigInt_Init(&b);
+    tmpl_BigInt_Init(&r);
+    tmpl_BigInt_Copy(&a, x);
+    tmpl_BigInt_Copy(&b, y);
+    a.is_negative = tmpl_False;
+    b.is_negative = tmpl_False;
+
+    if (tmpl_BigInt_Compare(&a, &b) < 0)
+        tmpl_bigint_swap(&a, &b);
+
+    /*  Copy failures leave the numbers invalid. The lengths only decrease,   *
+     *  so the workspace is allocated once.                                   */
+    success = (!a.error_occurred && !b.error_occurred);
+
+    if (success && b.length > 1)
+    {
+        work = TMPL_MALLOC(tmpl_BigIntLimb, 4 * (a.length + 1));
+        success = (work != NULL);
+
+        if (success)
+            success = tmpl_bigint_lehmer_reduce(&a, &b, &r, work,
+                                                malloc_message);
+    }
+
+    TMPL_FREE(work);
+    tmpl_BigInt_Destroy(&r);
+
+    if (!success)
+    {
+        tmpl_BigInt_Destroy(&a);
+        tmpl_BigInt_Destroy(&b);
+        tmpl_BigInt_Set_Error(gcd, malloc_message);
+        return;
+    }
+
+    /*  b fits in a limb. One short division brings a down to a limb too,     *
+     *  and the binary GCD finishes. If b is zero, the GCD is a.              */
+    if (b.length)
+    {
+        v = (unsigned long int)TMPL_BIGINT_LIMBS(&b)[0];
+        u = (unsigned long int)tmpl_BigIntLimbs_DivRem_1(
+            TMPL_BIGINT_LIMBS(&a), TMPL_BIGINT_LIMBS(&a), a.length,
+            TMPL_BIGINT_LIMBS(&b)[0]
+        );
+
+        tmpl_BigInt_Set_ULong(&a, tmpl_ULong_GCD_Mixed_Binary(u, v));
+    }
+
+    tmpl_BigInt_Destroy(&b);
+    tmpl_BigInt_Move(gcd, &a);
+}
+/*  End of tmpl_BigInt_GCD.                                                   */
@@ -0,0 +1,75 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                              tmpl_init_bigint                              *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Initializes an arbitrary-precision integer to zero.                   *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigInt_Init                                                      *
+ *  Purpose:                                                                  *
+ *      Sets a number to zero, using the inline storage.                      *
+ *  Arguments:                                                                *
+ *      x (tmpl_BigInt *):                                                    *
+ *          The number to be initialized.                                     *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Set the heap pointer to NULL and the length to zero. No memory is     *
+ *      allocated until the number outgrows its inline storage.               *
+ *  Notes:                                                                    *
+ *      Do not call this on a number that owns heap memory, the memory would  *
+ *      be leaked. Use tmpl_BigInt_Destroy instead.                           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) stddef.h:                                                             *
+ *          Standard header file providing NULL.                              *
+ *  2.) tmpl_bigint.h:                                                        *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  NULL is provided here.                                                    */
+#include <stddef.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  Function for initializing a number to zero.                               */
+void tmpl_BigInt_Init(tmpl_BigInt *x)
+{
+    /*  Nothing to do for a NULL pointer.                                     */
+    if (!x)
+        return;
+
+    x->heap = NULL;
+    x->length = 0;
+    x->capacity = TMPL_BIGINT_SMALL_LIMBS;
+    x->is_negative = tmpl_False;
+    x->error_occurred = tmpl_False;
+    x->error_message = NULL;
+}
+/*  End of tmpl_BigInt_Init.                                                  */
@@ -0,0 +1,328 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                            tmpl_multiply_bigint                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies arbitrary-precision integers.                              *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigInt_Multiply                                                  *
+ *  Purpose:                                                                  *
+ *      Computes the product x * y.                                           *
+ *  Arguments:                                                                *
+ *      prod (tmpl_BigInt *):                                                 *
+ *          An initialized number, the product of x and y.                    *
+ *      x (const tmpl_BigInt *):                                              *
+ *          A number.                                                         *
+ *      y (const tmpl_BigInt *):                                              *
+ *          Another number.                                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates the scratch space for Karatsuba's method.           *
+ *      src/bigint/auxiliary/tmpl_bigint_limbs_multiply_schoolbook.h:         *
+ *          tmpl_BigIntLimbs_Multiply_Schoolbook:                             *
+ *              Multiplies two magnitudes in O(n m) time.                     *
+ *      src/bigint/auxiliary/tmpl_bigint_limbs_add.h:                         *
+ *          tmpl_BigIntLimbs_Add:                                             *
+ *              Adds two magnitudes.                                          *
+ *      src/bigint/auxiliary/tmpl_bigint_limbs_subtract.h:                    *
+ *          tmpl_BigIntLimbs_Subtract:                                        *
+ *              Subtracts two magnitudes.                                     *
+ *  Method:                                                                   *
+ *      If the shorter factor has fewer than TMPL_BIGINT_KARATSUBA_THRESHOLD  *
+ *      limbs, use the schoolbook method. Otherwise use Karatsuba's method.   *
+ *      Write a = a1 B^h + a0 and b = b1 B^h + b0, where B is the limb base   *
+ *      and h is half the length. Then:                                       *
+ *                                                                            *
+ *          a b = z2 B^2h + z1 B^h + z0                                       *
+ *                                                                            *
+ *      where z0 = a0 b0, z2 = a1 b1, and                                     *
+ *                                                                            *
+ *          z1 = (a0 + a1)(b0 + b1) - z0 - z2                                 *
+ *                                                                            *
+ *      so three half-size products replace four, giving O(n^1.585) time.     *
+ *      z0 and z2 are computed directly in the output, and z1 in one scratch  *
+ *      buffer that is allocated once, up front, for the whole recursion.     *
+ *                                                                            *
+ *      If one factor is much longer than the other, it is cut into pieces    *
+ *      the length of the shorter factor. Each piece is multiplied with       *
+ *      Karatsuba's method and added into place. The last piece is padded     *
+ *      with zeros to full length.                                            *
+ *  Notes:                                                                    *
+ *      NULL or invalid inputs, and malloc failures, set the error_occurred   *
+ *      Boolean of prod. The product is computed into new storage, so prod    *
+ *      may be the same as x or y.                                            *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_malloc.h:                                                        *
+ *          Header file providing TMPL_MALLOC.                                *
+ *  2.) tmpl_free.h:                                                          *
+ *          Header file providing TMPL_FREE.                                  *
+ *  3.) tmpl_bigint.h:                                                        *
+ *          Header file where the function prototype is given.                *
+ *  4.) tmpl_bigint_set_error.h:                                              *
+ *          Marks a number as invalid.                                        *
+ *  5.) tmpl_bigint_check_inputs.h:                                           *
+ *          Checks the inputs of a binary operation.                          *
+ *  6.) tmpl_bigint_reserve.h:                                                *
+ *          Makes room for the limbs of a number.                             *
+ *  7.) tmpl_bigint_normalize.h:                                              *
+ *          Removes leading zero limbs.                                       *
+ *  8.) tmpl_bigint_move.h:                                                   *
+ *          Moves one number into another.                                    *
+ *  9.) tmpl_bigint_limbs_add.h:                                              *
+ *          Adds two magnitudes.                                              *
+ *  10.) tmpl_bigint_limbs_subtract.h:                                        *
+ *          Subtracts two magnitudes.                                         *
+ *  11.) tmpl_bigint_limbs_multiply_schoolbook.h:                             *
+ *          Schoolbook multiplication.                                        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_MALLOC and TMPL_FREE macros found here.                              */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  Limb arithmetic and storage management found here.                        */
+#include "auxiliary/tmpl_bigint_set_error.h"
+#include "auxiliary/tmpl_bigint_check_inputs.h"
+#include "auxiliary/tmpl_bigint_reserve.h"
+#include "auxiliary/tmpl_bigint_normalize.h"
+#include "auxiliary/tmpl_bigint_move.h"
+#include "auxiliary/tmpl_bigint_limbs_add.h"
+#include "auxiliary/tmpl_bigint_limbs_subtract.h"
+#include "auxiliary/tmpl_bigint_limbs_multiply_schoolbook.h"
+
+/*  The recursion splits into halves of at least two limbs. This keeps the    *
+ *  middle product inside the output for any choice of threshold.             */
+#if TMPL_BIGINT_KARATSUBA_THRESHOLD < 4
+#define TMPL_BIGINT_KARATSUBA_CUTOFF (4)
+#else
+#define TMPL_BIGINT_KARATSUBA_CUTOFF TMPL_BIGINT_KARATSUBA_THRESHOLD
+#endif
+
+/*  Number of scratch limbs needed by tmpl_bigint_karatsuba for length n.     */
+static size_t tmpl_bigint_karatsuba_scratch(size_t n)
+{
+    size_t scratch = 0;
+
+    /*  Each level needs two sums of m + 1 limbs and their product, and the   *
+     *  deepest recursion is on the middle product with m + 1 limbs.          */
+    while (n >= TMPL_BIGINT_KARATSUBA_CUTOFF)
+    {
+        const size_t m = n - n / 2;
+        scratch += 4 * (m + 1);
+        n = m + 1;
+    }
+
+    return scratch;
+}
+/*  End of tmpl_bigint_karatsuba_scratch.                                     */
+
+/*  Computes r = a * b for a and b with n limbs each, and r with 2n limbs.    */
+static void
+tmpl_bigint_karatsuba(tmpl_BigIntLimb *r,
+                      const tmpl_BigIntLimb *a,
+                      const tmpl_BigIntLimb *b,
+                      size_t n,
+                      tmpl_BigIntLimb *scratch)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t h, m;
+    tmpl_BigIntLimb *sa, *sb, *z1;
+
+    if (n < TMPL_BIGINT_KARATSUBA_CUTOFF)
+    {
+        tmpl_BigIntLimbs_Multiply_Schoolbook(r, a, n, b, n);
+        return;
+    }
+
+    /*  a = a1 B^h + a0, where a0 has h limbs and a1 has m >= h limbs.        */
+    h = n / 2;
+    m = n - h;
+
+    /*  z0 = a0 b0 goes in r[0, 2h) and z2 = a1 b1 goes in r[2h, 2n).         */
+    tmpl_bigint_karatsuba(r, a, b, h, scratch);
+    tmpl_bigint_karatsuba(r + 2 * h, a + h, b + h, m, scratch);
+
+    /*  The sums a0 + a1 and b0 + b1 have m + 1 limbs.                        */
+    sa = scratch;
+    sb = scratch + (m + 1);
+    z1 = scratch + 2 * (m + 1);
+
+    sa[m] = tmpl_BigIntLimbs_Add(sa, a + h, m, a, h);
+    sb[m] = tmpl_BigIntLimbs_Add(sb, b + h, m, b, h);
+
+    /*  z1 = (a0 + a1)(b0 + b1) - z0 - z2, which is non-negative.             */
+    tmpl_bigint_karatsuba(z1, sa, sb, m + 1, scratch + 4 * (m + 1));
+    (void)tmpl_BigIntLimbs_Subtract(z1, z1, 2 * (m + 1), r, 2 * h);
+    (void)tmpl_BigIntLimbs_Subtract(z1, z1, 2 * (m + 1), r + 2 * h, 2 * m);
+
+    /*  Add z1 B^h. Since h >= 2, r + h has 2m + h >= 2m + 2 limbs left.      */
+    (void)tmpl_BigIntLimbs_Add(r + h, r + h, 2 * m + h, z1, 2 * (m + 1));
+}
+/*  End of tmpl_bigint_karatsuba.                                             */
+
+/*  Computes r = a * b for an >= bn >= TMPL_BIGINT_KARATSUBA_CUTOFF. Returns  *
+ *  false if malloc fails.                                                    */
+static tmpl_Bool
+tmpl_bigint_multiply_large(tmpl_BigIntLimb *r,
+                           const tmpl_BigIntLimb *a, size_t an,
+                           const tmpl_BigIntLimb *b, size_t bn)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, k;
+    tmpl_BigIntLimb *scratch, *piece, *tmp;
+
+    /*  Balanced products are computed directly in the output.                */
+    if (an == bn)
+    {
+        scratch = TMPL_MALLOC(tmpl_BigIntLimb,
+                              tmpl_bigint_karatsuba_scratch(bn) + 1);
+
+        if (!scratch)
+            return tmpl_False;
+
+        tmpl_bigint_karatsuba(r, a, b, bn, scratch);
+        TMPL_FREE(scratch);
+        return tmpl_True;
+    }
+
+    /*  Room for a padded piece of a, the product of the piece with b, and    *
+     *  the scratch space of the recursion.                                   */
+    scratch = TMPL_MALLOC(tmpl_BigIntLimb,
+                          3 * bn + tmpl_bigint_karatsuba_scratch(bn));
+
+    if (!scratch)
+        return tmpl_False;
+
+    piece = scratch;
+    tmp = scratch + bn;
+
+    for (k = 0; k < an + bn; ++k)
+        r[k] = 0;
+
+    /*  Multiply b with each piece of a and add the products into place.      */
+    for (n = 0; n < an; n += bn)
+    {
+        const size_t length = (an - n < bn ? an - n : bn);
+
+        for (k = 0; k < length; ++k)
+            piece[k] = a[n + k];
+
+        for (; k < bn; ++k)
+            piece[k] = 0;
+
+        tmpl_bigint_karatsuba(tmp, piece, b, bn, scratch + 3 * bn);
+
+        /*  The product of the piece has at most length + bn limbs.           */
+        (void)tmpl_BigIntLimbs_Add(r + n, r + n, an + bn - n, tmp, length + bn);
+    }
+
+    TMPL_FREE(scratch);
+    return tmpl_True;
+}
+/*  End of tmpl_bigint_multiply_large.                                        */
+
+/*  Function for multiplying two numbers.                                     */
+void
+tmpl_BigInt_Multiply(tmpl_BigInt *prod,
+                     const tmpl_BigInt *x,
+                     const tmpl_BigInt *y)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    tmpl_BigInt result;
+    const tmpl_BigInt *big, *small;
+
+    /*  Error message for malloc failures.                                    */
+    const char * const malloc_message =
+        "\nError Encountered:\n"
+        "    tmpl_BigInt_Multiply\n\n"
+        "malloc failed. Aborting.\n\n";
+
+    /*  Nothing to do if there is nowhere to write.                           */
+    if (!prod)
+        return;
+
+    if (!tmpl_BigInt_Check_Inputs(prod, x, y,
+                                  "\nError Encountered:\n"
+                                  "    tmpl_BigInt_Multiply\n\n"
+                                  "Input is NULL. Aborting.\n\n"))
+        return;
+
+    /*  Products with zero are zero. This also makes both lengths positive.   */
+    if (!x->length || !y->length)
+    {
+        prod->length = 0;
+        prod->is_negative = tmpl_False;
+        prod->error_occurred = tmpl_False;
+        prod->error_message = NULL;
+        return;
+    }
+
+    big = (x->length >= y->length ? x : y);
+    small = (x->length >= y->length ? y : x);
+
+    /*  Compute into new storage, so that prod may be the same as x or y.     */
+    tmpl_BigInt_Init(&result);
+
+    if (!tmpl_BigInt_Reserve(&result, big->length + small->length,
+                             malloc_message))
+    {
+        tmpl_BigInt_Set_Error(prod, malloc_message);
+        return;
+    }
+
+    if (small->length < TMPL_BIGINT_KARATSUBA_CUTOFF)
+        tmpl_BigIntLimbs_Multiply_Schoolbook(
+            TMPL_BIGINT_LIMBS(&result),
+            TMPL_BIGINT_LIMBS(big), big->length,
+            TMPL_BIGINT_LIMBS(small), small->length
+        );
+
+    else if (!tmpl_bigint_multiply_large(TMPL_BIGINT_LIMBS(&result),
+                                         TMPL_BIGINT_LIMBS(big), big->length,
+                                         TMPL_BIGINT_LIMBS(small),
+                                         small->length))
+    {
+        tmpl_BigInt_Destroy(&result);
+        tmpl_BigInt_Set_Error(prod, malloc_message);
+        return;
+    }
+
+    result.length = big->length + small->length;
+    result.is_negative = (x->is_negative != y->is_negative);
+    tmpl_BigInt_Normalize(&result);
+    tmpl_BigInt_Move(prod, &result);
+}
+/*  End of tmpl_BigInt_Multiply.                                              */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_BIGINT_KARATSUBA_CUTOFF
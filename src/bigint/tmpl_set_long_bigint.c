@@ -0,0 +1,123 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                            tmpl_set_long_bigint                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Sets an arbitrary-precision integer to the value of a machine word.   *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigInt_Set_ULong                                                 *
+ *      tmpl_BigInt_Set_Long                                                  *
+ *  Purpose:                                                                  *
+ *      Sets a number to the value of an unsigned long, or a signed long.     *
+ *  Arguments:                                                                *
+ *      x (tmpl_BigInt *):                                                    *
+ *          An initialized number.                                            *
+ *      val (unsigned long int or signed long int):                           *
+ *          The new value of x.                                               *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      src/bigint/auxiliary/tmpl_bigint_reserve.h:                           *
+ *          tmpl_BigInt_Reserve:                                              *
+ *              Makes room for the limbs of the value.                        *
+ *  Method:                                                                   *
+ *      Split the value into limbs, least significant first. The magnitude    *
+ *      of a negative value is computed without overflow, even for LONG_MIN.  *
+ *  Notes:                                                                    *
+ *      Any error in x is cleared. An unsigned long fits in the inline        *
+ *      storage of x on all common platforms, so this does not allocate.      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bigint.h:                                                        *
+ *          Header file where the function prototypes are given.              *
+ *  2.) tmpl_bigint_reserve.h:                                                *
+ *          Makes room for the limbs of a number.                             *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes and typedefs given here.                              */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  tmpl_BigInt_Reserve found here.                                           */
+#include "auxiliary/tmpl_bigint_reserve.h"
+
+/*  Function for setting a number to the value of an unsigned long.           */
+void tmpl_BigInt_Set_ULong(tmpl_BigInt *x, unsigned long int val)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    unsigned long int tmp;
+    tmpl_BigIntLimb *limbs;
+
+    /*  Nothing to do for a NULL pointer.                                     */
+    if (!x)
+        return;
+
+    x->error_occurred = tmpl_False;
+    x->error_message = NULL;
+
+    /*  Count the limbs. The shift is done in two steps, since shifting by    *
+     *  the full width of an unsigned long is undefined.                      */
+    for (n = 0, tmp = val; tmp; ++n)
+        tmp = (tmp >> (TMPL_BIGINT_LIMB_BIT - 1)) >> 1;
+
+    if (!tmpl_BigInt_Reserve(x, n,
+                             "\nError Encountered:\n"
+                             "    tmpl_BigInt_Set_ULong\n\n"
+                             "malloc failed. Aborting.\n\n"))
+        return;
+
+    limbs = TMPL_BIGINT_LIMBS(x);
+
+    for (n = 0; val; ++n)
+    {
+        limbs[n] = (tmpl_BigIntLimb)(val & TMPL_BIGINT_LIMB_MASK);
+        val = (val >> (TMPL_BIGINT_LIMB_BIT - 1)) >> 1;
+    }
+
+    x->length = n;
+    x->is_negative = tmpl_False;
+}
+/*  End of tmpl_BigInt_Set_ULong.                                             */
+
+/*  Function for setting a number to the value of a signed long.              */
+void tmpl_BigInt_Set_Long(tmpl_BigInt *x, signed long int val)
+{
+    /*  The magnitude, written so that LONG_MIN does not overflow.            */
+    const unsigned long int abs_val =
+        (val < 0L ? (unsigned long int)(-(val + 1L)) + 1UL
+                  : (unsigned long int)val);
+
+    /*  Nothing to do for a NULL pointer.                                     */
+    if (!x)
+        return;
+
+    tmpl_BigInt_Set_ULong(x, abs_val);
+
+    /*  Zero has a positive sign. Set_ULong already took care of that.        */
+    if (val < 0L && !x->error_occurred)
+        x->is_negative = tmpl_True;
+}
+/*  End of tmpl_BigInt_Set_Long.                                              */
@@ -0,0 +1,108 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                            tmpl_to_long_bigint                             *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Converts an arbitrary-precision integer to a signed long.             *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigInt_To_Long                                                   *
+ *  Purpose:                                                                  *
+ *      Computes the value of a number as a signed long, if it fits.          *
+ *  Arguments:                                                                *
+ *      x (const tmpl_BigInt *):                                              *
+ *          A number.                                                         *
+ *      val (signed long int *):                                              *
+ *          The value of x.                                                   *
+ *  Output:                                                                   *
+ *      fits (tmpl_Bool):                                                     *
+ *          True if x is valid and LONG_MIN <= x <= LONG_MAX.                 *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Accumulate the limbs into an unsigned long from the most significant  *
+ *      limb down, checking that no bits are shifted out. Then check the      *
+ *      magnitude against LONG_MAX, or LONG_MAX + 1 for negative numbers.     *
+ *  Notes:                                                                    *
+ *      If false is returned, val is not modified.                            *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) limits.h:                                                             *
+ *          Standard library header file with LONG_MAX and ULONG_MAX.         *
+ *  2.) tmpl_bigint.h:                                                        *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  LONG_MAX and ULONG_MAX found here.                                        */
+#include <limits.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  Function for converting a number to a signed long.                        */
+tmpl_Bool tmpl_BigInt_To_Long(const tmpl_BigInt *x, signed long int *val)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    unsigned long int abs_val = 0UL;
+    const tmpl_BigIntLimb *limbs;
+
+    /*  The largest magnitude that shifting left by one limb can hold.        */
+    const unsigned long int shift_max =
+        (ULONG_MAX >> (TMPL_BIGINT_LIMB_BIT - 1)) >> 1;
+
+    /*  Invalid inputs do not have a value.                                   */
+    if (!x || !val || x->error_occurred)
+        return tmpl_False;
+
+    limbs = TMPL_BIGINT_LIMBS(x);
+
+    for (n = x->length; n; --n)
+    {
+        if (abs_val > shift_max)
+            return tmpl_False;
+
+        abs_val = ((abs_val << (TMPL_BIGINT_LIMB_BIT - 1)) << 1) |
+                  (unsigned long int)limbs[n - 1];
+    }
+
+    /*  Positive values must be at most LONG_MAX.                             */
+    if (!x->is_negative)
+    {
+        if (abs_val > (unsigned long int)LONG_MAX)
+            return tmpl_False;
+
+        *val = (signed long int)abs_val;
+        return tmpl_True;
+    }
+
+    /*  Negative values may go down to -LONG_MAX - 1 = LONG_MIN.              */
+    if (abs_val - 1UL > (unsigned long int)LONG_MAX)
+        return tmpl_False;
+
+    *val = -(signed long int)(abs_val - 1UL) - 1L;
+    return tmpl_True;
+}
+/*  End of tmpl_BigInt_To_Long.                                               */
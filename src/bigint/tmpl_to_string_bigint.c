@@ -0,0 +1,170 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                           tmpl_to_string_bigint                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Converts an arbitrary-precision integer to a decimal string.          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_BigInt_To_String                                                 *
+ *  Purpose:                                                                  *
+ *      Computes the decimal digits of a number.                              *
+ *  Arguments:                                                                *
+ *      x (const tmpl_BigInt *):                                              *
+ *          A number.                                                         *
+ *  Output:                                                                   *
+ *      str (char *):                                                         *
+ *          The decimal representation of x. The caller must free this.       *
+ *  Called Functions:                                                         *
+ *      src/bigint/auxiliary/tmpl_bigint_limbs_divrem_1.h:                    *
+ *          tmpl_BigIntLimbs_DivRem_1:                                        *
+ *              Divides a magnitude by a single limb.                         *
+ *  Method:                                                                   *
+ *      Repeatedly divide by the largest power of ten that fits in a limb,    *
+ *      10^9 for 32-bit limbs and 10^4 for 16-bit ones. Each remainder gives  *
+ *      that many decimal digits, least significant first. Print the chunks   *
+ *      from the top down, padding all but the leading one with zeros.        *
+ *  Notes:                                                                    *
+ *      NULL is returned for NULL or invalid inputs, and if malloc fails.     *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_malloc.h:                                                        *
+ *          Header file providing TMPL_MALLOC.                                *
+ *  2.) tmpl_free.h:                                                          *
+ *          Header file providing TMPL_FREE.                                  *
+ *  3.) tmpl_bigint.h:                                                        *
+ *          Header file where the function prototype is given.                *
+ *  4.) tmpl_bigint_limbs_divrem_1.h:                                         *
+ *          Divides a magnitude by a single limb.                             *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_MALLOC and TMPL_FREE macros found here.                              */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  tmpl_BigIntLimbs_DivRem_1 found here.                                     */
+#include "auxiliary/tmpl_bigint_limbs_divrem_1.h"
+
+/*  Largest power of ten that fits in a limb, and its number of digits.       */
+#if TMPL_BIGINT_LIMB_BIT == 32
+#define TMPL_BIGINT_DECIMAL_BASE (1000000000UL)
+#define TMPL_BIGINT_DECIMAL_DIGITS (9)
+#else
+#define TMPL_BIGINT_DECIMAL_BASE (10000UL)
+#define TMPL_BIGINT_DECIMAL_DIGITS (4)
+#endif
+
+/*  Function for converting a number to a string.                             */
+char *tmpl_BigInt_To_String(const tmpl_BigInt *x)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, k, length, chunks;
+    tmpl_BigIntLimb *work, *digits;
+    char *str, *ptr;
+    int d;
+
+    /*  Invalid inputs do not have a value.                                   */
+    if (!x || x->error_occurred)
+        return NULL;
+
+    /*  A limb is less than two decimal chunks, so 2 n + 1 chunks suffice.    */
+    length = x->length;
+    work = TMPL_MALLOC(tmpl_BigIntLimb, 3 * length + 1);
+
+    if (!work)
+        return NULL;
+
+    digits = work + length;
+
+    for (n = 0; n < length; ++n)
+        work[n] = TMPL_BIGINT_LIMBS(x)[n];
+
+    /*  Peel off decimal chunks, dropping leading zero limbs as they appear.  */
+    chunks = 0;
+
+    do {
+        digits[chunks] = tmpl_BigIntLimbs_DivRem_1(
+            work, work, length, (tmpl_BigIntLimb)TMPL_BIGINT_DECIMAL_BASE
+        );
+
+        ++chunks;
+
+        while (length && !work[length - 1])
+            --length;
+
+    } while (length);
+
+    /*  Room for a sign, the digits, and the terminating zero.                */
+    str = TMPL_MALLOC(char, chunks * TMPL_BIGINT_DECIMAL_DIGITS + 2);
+
+    if (!str)
+    {
+        TMPL_FREE(work);
+        return NULL;
+    }
+
+    ptr = str;
+
+    if (x->is_negative && x->length)
+        *ptr++ = '-';
+
+    /*  The leading chunk is printed without padding.                         */
+    for (d = TMPL_BIGINT_DECIMAL_DIGITS - 1; d > 0; --d)
+    {
+        tmpl_BigIntLimb power = 1;
+
+        for (k = 0; k < (size_t)d; ++k)
+            power *= 10;
+
+        if (digits[chunks - 1] >= power)
+            break;
+    }
+
+    for (n = chunks; n > 0; --n)
+    {
+        tmpl_BigIntLimb chunk = digits[n - 1];
+        const int width = (n == chunks ? d + 1 : TMPL_BIGINT_DECIMAL_DIGITS);
+
+        for (k = (size_t)width; k > 0; --k)
+        {
+            ptr[k - 1] = (char)('0' + (int)(chunk % 10));
+            chunk /= 10;
+        }
+
+        ptr += width;
+    }
+
+    *ptr = '\0';
+    TMPL_FREE(work);
+    return str;
+}
+/*  End of tmpl_BigInt_To_String.                                             */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_BIGINT_DECIMAL_BASE
+#undef TMPL_BIGINT_DECIMAL_DIGITS
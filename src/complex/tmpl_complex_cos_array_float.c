@@ -0,0 +1,100 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                        tmpl_complex_cos_array_float                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the complex cosine of an array of complex numbers.           *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_CFloat_Cos_Array                                                 *
+ *  Purpose:                                                                  *
+ *      Computes w[n] = cos(z[n]) for each n.                                 *
+ *  Arguments:                                                                *
+ *      z (const tmpl_ComplexFloat * const):                                  *
+ *          An array of complex numbers.                                      *
+ *      w (tmpl_ComplexFloat * const):                                        *
+ *          The output array. This may be the same as z.                      *
+ *      len (size_t):                                                         *
+ *          The number of elements of z and w.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_math.h:                                                          *
+ *          tmpl_Float_Sin:                                                   *
+ *              Computes sine.                                                *
+ *          tmpl_Float_Cos:                                                   *
+ *              Computes cosine.                                              *
+ *          tmpl_Float_SinhCosh:                                              *
+ *              Computes hyperbolic sine and cosine simultaneously.           *
+ *  Method:                                                                   *
+ *      cos(x + iy) = cos(x) cosh(y) - i sin(x) sinh(y). tmpl_CFloat_Cos      *
+ *      calls sinh and cosh separately, each computing an exponential. Here   *
+ *      the hyperbolic pair is computed with one call, sharing the            *
+ *      exponential of y.                                                     *
+ *  Notes:                                                                    *
+ *      1.) If z or w is NULL, nothing is done.                               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file with the real functions.                              *
+ *  2.) tmpl_complex.h:                                                       *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Real functions found here.                                                */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Function prototype and complex typedefs given here.                       */
+#include <libtmpl/include/tmpl_complex.h>
+
+/*  Function for computing cos(z) for an array of complex numbers.            */
+void
+tmpl_CFloat_Cos_Array(const tmpl_ComplexFloat * const z,
+                      tmpl_ComplexFloat * const w,
+                      size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!z || !w)
+        return;
+
+    /*  The elements are independent. With OpenMP support, long arrays are    *
+     *  split across threads.                                                 */
+#ifdef _OPENMP
+#pragma omp parallel for if(len >= TMPL_COMPLEX_ARRAY_PARALLEL_MIN_LENGTH)
+#endif
+    for (n = 0; n < len; ++n)
+    {
+        float sin_x, cos_x, sinh_y, cosh_y;
+        sin_x = tmpl_Float_Sin(z[n].dat[0]);
+        cos_x = tmpl_Float_Cos(z[n].dat[0]);
+        tmpl_Float_SinhCosh(z[n].dat[1], &sinh_y, &cosh_y);
+        w[n].dat[0] = cos_x * cosh_y;
+        w[n].dat[1] = -sin_x * sinh_y;
+    }
+}
+/*  End of tmpl_CFloat_Cos_Array.                                             */
@@ -0,0 +1,112 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                        tmpl_complex_exp_array_float                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the complex exponential of an array of complex numbers.      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_CFloat_Exp_Array                                                 *
+ *  Purpose:                                                                  *
+ *      Computes w[n] = exp(z[n]) for each n.                                 *
+ *  Arguments:                                                                *
+ *      z (const tmpl_ComplexFloat * const):                                  *
+ *          An array of complex numbers.                                      *
+ *      w (tmpl_ComplexFloat * const):                                        *
+ *          The output array. This may be the same as z.                      *
+ *      len (size_t):                                                         *
+ *          The number of elements of z and w.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_math.h:                                                          *
+ *          tmpl_Float_Exp:                                                   *
+ *              Computes the real exponential.                                *
+ *          tmpl_Float_SinCos:                                                *
+ *              Computes sine and cosine simultaneously.                      *
+ *  Method:                                                                   *
+ *      exp(x + iy) = exp(x) cos(y) + i exp(x) sin(y). One exponential and    *
+ *      one SinCos call are made per element, as in tmpl_CFloat_Exp, but      *
+ *      without a call through a function pointer.                            *
+ *  Notes:                                                                    *
+ *      1.) If z or w is NULL, nothing is done.                               *
+ *                                                                            *
+ *      2.) Real inputs, y = 0, return exp(x) + 0i, like tmpl_CFloat_Exp.     *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file with the real functions.                              *
+ *  2.) tmpl_complex.h:                                                       *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Real functions found here.                                                */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Function prototype and complex typedefs given here.                       */
+#include <libtmpl/include/tmpl_complex.h>
+
+/*  Function for computing exp(z) for an array of complex numbers.            */
+void
+tmpl_CFloat_Exp_Array(const tmpl_ComplexFloat * const z,
+                      tmpl_ComplexFloat * const w,
+                      size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!z || !w)
+        return;
+
+    /*  The elements are independent. With OpenMP support, long arrays are    *
+     *  split across threads.                                                 */
+#ifdef _OPENMP
+#pragma omp parallel for if(len >= TMPL_COMPLEX_ARRAY_PARALLEL_MIN_LENGTH)
+#endif
+    for (n = 0; n < len; ++n)
+    {
+        const float x = z[n].dat[0];
+        const float y = z[n].dat[1];
+        const float exp_x = tmpl_Float_Exp(x);
+
+        /*  Avoid inf * 0 = NaN for real inputs, as tmpl_CFloat_Exp does.     */
+        if (y == 0.0F)
+        {
+            w[n].dat[0] = exp_x;
+            w[n].dat[1] = 0.0F;
+        }
+
+        /*  Otherwise use Euler's formula, computing sin(y) and cos(y) once.  */
+        else
+        {
+            float sin_y, cos_y;
+            tmpl_Float_SinCos(y, &sin_y, &cos_y);
+            w[n].dat[0] = exp_x * cos_y;
+            w[n].dat[1] = exp_x * sin_y;
+        }
+    }
+}
+/*  End of tmpl_CFloat_Exp_Array.                                             */
@@ -0,0 +1,86 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                       tmpl_complex_expi_array_float                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes points on the unit circle for an array of angles.            *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_CFloat_Expi_Array                                                *
+ *  Purpose:                                                                  *
+ *      Computes w[n] = exp(i theta[n]) for each n.                           *
+ *  Arguments:                                                                *
+ *      theta (const float * const):                                          *
+ *          An array of real numbers, the angles.                             *
+ *      w (tmpl_ComplexFloat * const):                                        *
+ *          The output array.                                                 *
+ *      len (size_t):                                                         *
+ *          The number of elements of theta and w.                            *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_math.h:                                                          *
+ *          tmpl_Float_SinCos:                                                *
+ *              Computes sine and cosine simultaneously.                      *
+ *  Method:                                                                   *
+ *      exp(i t) = cos(t) + i sin(t). SinCos writes directly to the output.   *
+ *  Notes:                                                                    *
+ *      If theta or w is NULL, nothing is done.                               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file with the real functions.                              *
+ *  2.) tmpl_complex.h:                                                       *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Real functions found here.                                                */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Function prototype and complex typedefs given here.                       */
+#include <libtmpl/include/tmpl_complex.h>
+
+/*  Function for computing exp(i theta) for an array of real numbers.         */
+void
+tmpl_CFloat_Expi_Array(const float * const theta,
+                       tmpl_ComplexFloat * const w,
+                       size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!theta || !w)
+        return;
+
+    /*  The elements are independent. With OpenMP support, long arrays are    *
+     *  split across threads.                                                 */
+#ifdef _OPENMP
+#pragma omp parallel for if(len >= TMPL_COMPLEX_ARRAY_PARALLEL_MIN_LENGTH)
+#endif
+    for (n = 0; n < len; ++n)
+        tmpl_Float_SinCos(theta[n], &w[n].dat[1], &w[n].dat[0]);
+}
+/*  End of tmpl_CFloat_Expi_Array.                                            */
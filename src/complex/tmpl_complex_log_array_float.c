@@ -0,0 +1,85 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                        tmpl_complex_log_array_float                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the complex logarithm of an array of complex numbers.        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_CFloat_Log_Array                                                 *
+ *  Purpose:                                                                  *
+ *      Computes w[n] = log(z[n]) for each n.                                 *
+ *  Arguments:                                                                *
+ *      z (const tmpl_ComplexFloat * const):                                  *
+ *          An array of complex numbers.                                      *
+ *      w (tmpl_ComplexFloat * const):                                        *
+ *          The output array. This may be the same as z.                      *
+ *      len (size_t):                                                         *
+ *          The number of elements of z and w.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_complex.h:                                                       *
+ *          tmpl_CFloat_Log:                                                  *
+ *              Computes the principal logarithm of a complex number.         *
+ *  Method:                                                                   *
+ *      Call tmpl_CFloat_Log directly for each element. This avoids the       *
+ *      call through a function pointer made by tmpl_Void_Array_CD2CD, and    *
+ *      allows the compiler to inline or clone the loop.                      *
+ *  Notes:                                                                    *
+ *      1.) If z or w is NULL, nothing is done.                               *
+ *                                                                            *
+ *      2.) The imaginary part is in [-pi, pi], as for tmpl_CFloat_Log.       *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_complex.h:                                                       *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and complex typedefs given here.                       */
+#include <libtmpl/include/tmpl_complex.h>
+
+/*  Function for computing log(z) for an array of complex numbers.            */
+void
+tmpl_CFloat_Log_Array(const tmpl_ComplexFloat * const z,
+                      tmpl_ComplexFloat * const w,
+                      size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!z || !w)
+        return;
+
+    /*  The elements are independent. With OpenMP support, long arrays are    *
+     *  split across threads.                                                 */
+#ifdef _OPENMP
+#pragma omp parallel for if(len >= TMPL_COMPLEX_ARRAY_PARALLEL_MIN_LENGTH)
+#endif
+    for (n = 0; n < len; ++n)
+        w[n] = tmpl_CFloat_Log(z[n]);
+}
+/*  End of tmpl_CFloat_Log_Array.                                             */
@@ -0,0 +1,89 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                       tmpl_complex_pow_array_double                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Raises an array of complex numbers to a fixed complex power.          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_CDouble_Pow_Array                                                *
+ *  Purpose:                                                                  *
+ *      Computes w[n] = z[n]^p for each n.                                    *
+ *  Arguments:                                                                *
+ *      z (const tmpl_ComplexDouble * const):                                 *
+ *          An array of complex numbers, the bases.                           *
+ *      p (tmpl_ComplexDouble):                                               *
+ *          The power.                                                        *
+ *      w (tmpl_ComplexDouble * const):                                       *
+ *          The output array. This may be the same as z.                      *
+ *      len (size_t):                                                         *
+ *          The number of elements of z and w.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_complex.h:                                                       *
+ *          tmpl_CDouble_Pow:                                                 *
+ *              Computes z^p = exp(p log(z)).                                 *
+ *  Method:                                                                   *
+ *      Call tmpl_CDouble_Pow directly for each element, avoiding the call    *
+ *      through a function pointer. The power is the same for every element,  *
+ *      which is the common case for plots and for transmittance conversions. *
+ *  Notes:                                                                    *
+ *      1.) If z or w is NULL, nothing is done.                               *
+ *                                                                            *
+ *      2.) The principal branch of the logarithm is used, as for             *
+ *          tmpl_CDouble_Pow.                                                 *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_complex.h:                                                       *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and complex typedefs given here.                       */
+#include <libtmpl/include/tmpl_complex.h>
+
+/*  Function for computing z^p for an array of complex numbers.               */
+void
+tmpl_CDouble_Pow_Array(const tmpl_ComplexDouble * const z,
+                       tmpl_ComplexDouble p,
+                       tmpl_ComplexDouble * const w,
+                       size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!z || !w)
+        return;
+
+    /*  The elements are independent. With OpenMP support, long arrays are    *
+     *  split across threads.                                                 */
+#ifdef _OPENMP
+#pragma omp parallel for if(len >= TMPL_COMPLEX_ARRAY_PARALLEL_MIN_LENGTH)
+#endif
+    for (n = 0; n < len; ++n)
+        w[n] = tmpl_CDouble_Pow(z[n], p);
+}
+/*  End of tmpl_CDouble_Pow_Array.                                            */
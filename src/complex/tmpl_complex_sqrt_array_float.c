@@ -0,0 +1,201 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                       tmpl_complex_sqrt_array_float                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the principal square root of an array of complex numbers.    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_CFloat_Sqrt_Array                                                *
+ *  Purpose:                                                                  *
+ *      Computes w[n] = sqrt(z[n]) for each n.                                *
+ *  Arguments:                                                                *
+ *      z (const tmpl_ComplexFloat * const):                                  *
+ *          An array of complex numbers.                                      *
+ *      w (tmpl_ComplexFloat * const):                                        *
+ *          The output array. This may be the same as z.                      *
+ *      len (size_t):                                                         *
+ *          The number of elements of z and w.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_math.h:                                                          *
+ *          tmpl_Float_Hypot:                                                 *
+ *              Computes |z| without overflow or underflow.                   *
+ *          tmpl_Float_Sqrt:                                                  *
+ *              Computes the real square root.                                *
+ *          tmpl_Float_Abs:                                                   *
+ *              Computes the absolute value of a real number.                 *
+ *          tmpl_Float_Copysign:                                              *
+ *              Gives the magnitude of one number the sign of another.        *
+ *          tmpl_Float_Is_Inf:                                                *
+ *              Determines if a real number is infinite.                      *
+ *  Method:                                                                   *
+ *      tmpl_CFloat_Sqrt computes sqrt(r) exp(i theta / 2), which needs a     *
+ *      hypotenuse, an arctangent, a sine, and a cosine. The half-angle       *
+ *      formulas give the same value with only the hypotenuse and a square    *
+ *      root. With z = x + iy and r = |z|, let                                *
+ *                                                                            *
+ *                    -----------                                             *
+ *                   /  r + |x|                                               *
+ *          t = \    / ---------                                              *
+ *               \  /      2                                                  *
+ *                \/                                                          *
+ *                                                                            *
+ *      For x >= 0, sqrt(z) = t + i y / (2t). For x < 0, the real part is     *
+ *      |y| / (2t) and the imaginary part is t with the sign of y. The        *
+ *      subtraction of nearly equal numbers in r - |x| never happens, so the  *
+ *      result is accurate even close to the axes. (r + |x|) / 2 is computed  *
+ *      as r / 2 + |x| / 2. If x or y is close to the overflow threshold, z   *
+ *      is scaled down by 4 so that r is finite. If x and y are both tiny, z  *
+ *      is scaled up so that r and r / 2 keep their precision. The square     *
+ *      root is then scaled back.                                             *
+ *  Notes:                                                                    *
+ *      1.) If z or w is NULL, nothing is done.                               *
+ *                                                                            *
+ *      2.) The branch cut is the negative real axis, as for                  *
+ *          tmpl_CFloat_Sqrt. The sign of the imaginary part follows the      *
+ *          sign of y, including the sign of zero.                            *
+ *                                                                            *
+ *      3.) If y is infinite, the output is inf + iy, as required by C99.     *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file with the real functions.                              *
+ *  2.) tmpl_complex.h:                                                       *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Real functions found here.                                                */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Function prototype and complex typedefs given here.                       */
+#include <libtmpl/include/tmpl_complex.h>
+
+/*  Above this, x and y are scaled down by 4 so that |z| is finite.           */
+#define TMPL_SQRT_BIG (8.50705917E+37F)
+
+/*  Below this, x and y are scaled up by 2^24 so that |z| / 2 is normal.      */
+#define TMPL_SQRT_SMALL (4.70197740E-38F)
+
+/*  The values 2^24 and 2^-12. The latter is the inverse square root of       *
+ *  the former, undoing the scaling.                                          */
+#define TMPL_SQRT_SCALE_UP (1.6777216E+07F)
+#define TMPL_SQRT_SCALE_DOWN (2.44140625E-04F)
+
+/*  Positive infinity, the real part of sqrt(x + i inf).                      */
+#define TMPL_SQRT_INFINITY (TMPL_INFINITYF)
+
+/*  Function for computing sqrt(z) for an array of complex numbers.           */
+void
+tmpl_CFloat_Sqrt_Array(const tmpl_ComplexFloat * const z,
+                       tmpl_ComplexFloat * const w,
+                       size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!z || !w)
+        return;
+
+    /*  The elements are independent. With OpenMP support, long arrays are    *
+     *  split across threads.                                                 */
+#ifdef _OPENMP
+#pragma omp parallel for if(len >= TMPL_COMPLEX_ARRAY_PARALLEL_MIN_LENGTH)
+#endif
+    for (n = 0; n < len; ++n)
+    {
+        float x = z[n].dat[0];
+        float y = z[n].dat[1];
+        float abs_x = tmpl_Float_Abs(x);
+        float abs_y = tmpl_Float_Abs(y);
+        float scale = 1.0F;
+        float r, t;
+
+        /*  sqrt(x +/- i inf) = inf +/- i inf, even if x is NaN.              */
+        if (tmpl_Float_Is_Inf(y))
+        {
+            w[n].dat[0] = TMPL_SQRT_INFINITY;
+            w[n].dat[1] = y;
+            continue;
+        }
+
+        /*  sqrt(0) = 0. The imaginary part keeps the sign of y.              */
+        if (abs_x == 0.0F && abs_y == 0.0F)
+        {
+            w[n].dat[0] = 0.0F;
+            w[n].dat[1] = y;
+            continue;
+        }
+
+        /*  For huge z, r may overflow. Scale z down by 4, and the square     *
+         *  root up by 2. For tiny z, r / 2 may be subnormal and inaccurate.  *
+         *  Scale z up by an even power of two, and the square root down by   *
+         *  half of it.                                                       */
+        if (abs_x > TMPL_SQRT_BIG || abs_y > TMPL_SQRT_BIG)
+        {
+            x *= 0.25F;
+            y *= 0.25F;
+            abs_x *= 0.25F;
+            abs_y *= 0.25F;
+            scale = 2.0F;
+        }
+
+        else if (abs_x < TMPL_SQRT_SMALL && abs_y < TMPL_SQRT_SMALL)
+        {
+            x *= TMPL_SQRT_SCALE_UP;
+            y *= TMPL_SQRT_SCALE_UP;
+            abs_x *= TMPL_SQRT_SCALE_UP;
+            abs_y *= TMPL_SQRT_SCALE_UP;
+            scale = TMPL_SQRT_SCALE_DOWN;
+        }
+
+        r = tmpl_Float_Hypot(x, y);
+        t = tmpl_Float_Sqrt(0.5F*r + 0.5F*abs_x);
+
+        /*  Right half-plane, t is the real part.                             */
+        if (x >= 0.0F)
+        {
+            w[n].dat[0] = scale * t;
+            w[n].dat[1] = scale * (y / (t + t));
+        }
+
+        /*  Left half-plane, t is the magnitude of the imaginary part.        */
+        else
+        {
+            w[n].dat[0] = scale * (abs_y / (t + t));
+            w[n].dat[1] = scale * tmpl_Float_Copysign(t, y);
+        }
+    }
+}
+/*  End of tmpl_CFloat_Sqrt_Array.                                            */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_SQRT_BIG
+#undef TMPL_SQRT_SMALL
+#undef TMPL_SQRT_SCALE_UP
+#undef TMPL_SQRT_SCALE_DOWN
+#undef TMPL_SQRT_INFINITY
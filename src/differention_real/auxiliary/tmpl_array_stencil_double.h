@@ -0,0 +1,198 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                         tmpl_array_stencil_double                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides the interior sweep for the array derivatives.                *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Double_Array_Stencil                                             *
+ *  Purpose:                                                                  *
+ *      Applies a centered stencil with fixed weights to an array.            *
+ *  Arguments:                                                                *
+ *      y (const double * const):                                             *
+ *          The input array.                                                  *
+ *      out (double * const):                                                 *
+ *          The output array. It must not overlap y.                          *
+ *      len (size_t):                                                         *
+ *          The number of elements in y and out, at least width.              *
+ *      w (const double * const):                                             *
+ *          The weights of the stencil.                                       *
+ *      width (size_t):                                                       *
+ *          The number of weights. This is odd, 2 r + 1.                      *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      For r <= n < len - r this sets                                        *
+ *                                                                            *
+ *                   2r                                                       *
+ *                  ---                                                       *
+ *          out[n] = \   w[j] y[n - r + j]                                    *
+ *                  /                                                         *
+ *                  ---                                                       *
+ *                  j=0                                                       *
+ *                                                                            *
+ *      and the other elements of out are not touched. The zero weights are   *
+ *      dropped. The outputs are computed in blocks that fit in the L1        *
+ *      cache, and each pass over a block adds two weights times shifted      *
+ *      copies of y. The inner loops are branch free and vectorize, and this  *
+ *      uses half as many passes over the block as one weight at a time.      *
+ *      The blocks are independent and are split among threads with OpenMP.   *
+ *  Notes:                                                                    *
+ *      1.) This is a plain static function, not TMPL_STATIC_INLINE. GCC      *
+ *          moves the body of the OpenMP loop into a separate function, and   *
+ *          an always_inline attribute on it breaks linking with -flto.       *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_differentiation_real.h:                                          *
+ *          Header file with the size limits for the stencils.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_ARRAY_STENCIL_DOUBLE_H
+#define TMPL_ARRAY_STENCIL_DOUBLE_H
+
+/*  TMPL_SAVITZKY_GOLAY_MAX_HALF_WIDTH found here.                            */
+#include <libtmpl/include/tmpl_differentiation_real.h>
+
+/*  The Savitzky-Golay windows are the widest stencils used.                  */
+#define TMPL_STENCIL_MAX_WIDTH (2*TMPL_SAVITZKY_GOLAY_MAX_HALF_WIDTH + 1)
+
+/*  Number of outputs computed together. This is 4 kB, well within L1.        */
+#define TMPL_STENCIL_BLOCK_SIZE (512)
+
+/*  Applies a centered stencil to the interior of an array.                   */
+static void
+tmpl_Double_Array_Stencil(const double * const y,
+                          double * const out,
+                          size_t len,
+                          const double * const w,
+                          size_t width)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    double weight[TMPL_STENCIL_MAX_WIDTH];
+    size_t shift[TMPL_STENCIL_MAX_WIDTH];
+    size_t j, b, count, blocks;
+
+    /*  The stencil extends half points to either side.                       */
+    const size_t half = (width - 1) / 2;
+
+    /*  Keep the non-zero weights. Centered odd derivatives have a zero       *
+     *  weight at the center.                                                 */
+    count = 0;
+
+    for (j = 0; j < width; ++j)
+    {
+        if (w[j] != 0.0)
+        {
+            weight[count] = w[j];
+            shift[count] = j;
+            ++count;
+        }
+    }
+
+    /*  All weights zero means the output is zero. Add a zero weight so that  *
+     *  the first pass below still sets the output.                           */
+    if (count == 0)
+    {
+        weight[0] = 0.0;
+        shift[0] = 0;
+        count = 1;
+    }
+
+    blocks = (len - 2*half + TMPL_STENCIL_BLOCK_SIZE - 1) /
+             TMPL_STENCIL_BLOCK_SIZE;
+
+#ifdef _OPENMP
+#pragma omp parallel for private(j) \
+    if(len >= TMPL_DIFFERENTIATION_REAL_PARALLEL_MIN_LENGTH)
+#endif
+    for (b = 0; b < blocks; ++b)
+    {
+        size_t n;
+        const size_t first = half + b * TMPL_STENCIL_BLOCK_SIZE;
+        const size_t size = (len - half - first > TMPL_STENCIL_BLOCK_SIZE ?
+                             TMPL_STENCIL_BLOCK_SIZE : len - half - first);
+
+        /*  x is the start of the window for out[first].                      */
+        const double * const x = y + first - half;
+        double * const z = out + first;
+
+        /*  The first pass sets the output, using one or two weights.         */
+        if (count == 1)
+        {
+            const double w0 = weight[0];
+            const double * const x0 = x + shift[0];
+
+            for (n = 0; n < size; ++n)
+                z[n] = w0 * x0[n];
+
+            j = 1;
+        }
+
+        else
+        {
+            const double w0 = weight[0];
+            const double w1 = weight[1];
+            const double * const x0 = x + shift[0];
+            const double * const x1 = x + shift[1];
+
+            for (n = 0; n < size; ++n)
+                z[n] = w0 * x0[n] + w1 * x1[n];
+
+            j = 2;
+        }
+
+        /*  The remaining weights are added two at a time.                    */
+        for (; j + 1 < count; j += 2)
+        {
+            const double w0 = weight[j];
+            const double w1 = weight[j + 1];
+            const double * const x0 = x + shift[j];
+            const double * const x1 = x + shift[j + 1];
+
+            for (n = 0; n < size; ++n)
+                z[n] += w0 * x0[n] + w1 * x1[n];
+        }
+
+        /*  There may be one weight left over.                                */
+        if (j < count)
+        {
+            const double w0 = weight[j];
+            const double * const x0 = x + shift[j];
+
+            for (n = 0; n < size; ++n)
+                z[n] += w0 * x0[n];
+        }
+    }
+}
+/*  End of tmpl_Double_Array_Stencil.                                         */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_STENCIL_MAX_WIDTH
+#undef TMPL_STENCIL_BLOCK_SIZE
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,139 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                        tmpl_fornberg_weights_double                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides Fornberg's algorithm for finite difference weights.          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Double_Fornberg_Weights                                          *
+ *  Purpose:                                                                  *
+ *      Computes weights w_j with f^(m)(z) ~= sum_j w_j f(x_j).               *
+ *  Arguments:                                                                *
+ *      x (const double * const):                                             *
+ *          The nodes, which must be distinct. They need not be sorted.       *
+ *      n (size_t):                                                           *
+ *          The number of nodes, at most TMPL_ARRAY_DERIVATIVE_MAX_POINTS.    *
+ *      z (double):                                                           *
+ *          The point where the derivative is approximated.                   *
+ *      m (unsigned int):                                                     *
+ *          The order of the derivative, less than n.                         *
+ *      w (double * const):                                                   *
+ *          The output array for the n weights.                               *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      The weights are the m-th derivatives at z of the Lagrange basis       *
+ *      polynomials. Fornberg's recursion builds them by adding one node at a *
+ *      time, for all derivative orders up to m at once. This costs O(n^2 m)  *
+ *      operations, and is stable for the small n used here.                  *
+ *  References:                                                               *
+ *      1.) Fornberg, B. (1988)                                               *
+ *          "Generation of Finite Difference Formulas on Arbitrarily Spaced   *
+ *           Grids", Mathematics of Computation, Vol. 51, No. 184.            *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing TMPL_STATIC_INLINE.                         *
+ *  2.) tmpl_differentiation_real.h:                                          *
+ *          Header file with TMPL_ARRAY_DERIVATIVE_MAX_POINTS.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_FORNBERG_WEIGHTS_DOUBLE_H
+#define TMPL_FORNBERG_WEIGHTS_DOUBLE_H
+
+/*  TMPL_STATIC_INLINE macro provided here.                                   */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  TMPL_ARRAY_DERIVATIVE_MAX_POINTS found here.                              */
+#include <libtmpl/include/tmpl_differentiation_real.h>
+
+/*  Finite difference weights for the m-th derivative at z.                   */
+TMPL_STATIC_INLINE
+void
+tmpl_Double_Fornberg_Weights(const double * const x,
+                             size_t n,
+                             double z,
+                             unsigned int m,
+                             double * const w)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    double c[TMPL_ARRAY_DERIVATIVE_MAX_POINTS]
+            [TMPL_ARRAY_DERIVATIVE_MAX_POINTS];
+    double c1, c2, c3, c4, c5;
+    size_t i, j;
+    unsigned int k, top;
+
+    /*  c[j][k] is the weight of node j for the k-th derivative, using the    *
+     *  nodes added so far. Start with the single node x[0].                  */
+    for (j = 0; j < n; ++j)
+        for (k = 0U; k <= m; ++k)
+            c[j][k] = 0.0;
+
+    c[0][0] = 1.0;
+    c1 = 1.0;
+    c4 = x[0] - z;
+
+    for (i = 1; i < n; ++i)
+    {
+        /*  With i + 1 nodes, derivatives above order i are zero.             */
+        top = (i < m ? (unsigned int)i : m);
+        c2 = 1.0;
+        c5 = c4;
+        c4 = x[i] - z;
+
+        for (j = 0; j < i; ++j)
+        {
+            c3 = x[i] - x[j];
+            c2 *= c3;
+
+            /*  The weights for the new node x[i].                            */
+            if (j == i - 1)
+            {
+                for (k = top; k > 0U; --k)
+                    c[i][k] = c1 * ((double)k * c[i - 1][k - 1] -
+                                    c5 * c[i - 1][k]) / c2;
+
+                c[i][0] = -c1 * c5 * c[i - 1][0] / c2;
+            }
+
+            /*  Update the weights of the old nodes.                          */
+            for (k = top; k > 0U; --k)
+                c[j][k] = (c4 * c[j][k] - (double)k * c[j][k - 1]) / c3;
+
+            c[j][0] = c4 * c[j][0] / c3;
+        }
+
+        c1 = c2;
+    }
+
+    for (j = 0; j < n; ++j)
+        w[j] = c[j][m];
+}
+/*  End of tmpl_Double_Fornberg_Weights.                                      */
+
+#endif
+/*  End of include guard.                                                     */
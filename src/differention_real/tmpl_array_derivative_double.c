@@ -0,0 +1,189 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                        tmpl_array_derivative_double                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes derivatives of data sampled on a uniform grid.               *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Double_Array_Derivative                                          *
+ *  Purpose:                                                                  *
+ *      Computes dy[n] ~= f^(deriv)(x_0 + n h) from the samples y[n].         *
+ *  Arguments:                                                                *
+ *      y (const double * const):                                             *
+ *          The samples y[n] = f(x_0 + n h).                                  *
+ *      dy (double * const):                                                  *
+ *          The output array. It must have len elements and not overlap y.    *
+ *      len (size_t):                                                         *
+ *          The number of samples.                                            *
+ *      h (double):                                                           *
+ *          The grid spacing.                                                 *
+ *      deriv (unsigned int):                                                 *
+ *          The order of the derivative, at least one.                        *
+ *      order (unsigned int):                                                 *
+ *          The order of accuracy. This must be even and positive.            *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      src/differention_real/auxiliary/                                      *
+ *          tmpl_Double_Fornberg_Weights:                                     *
+ *              Computes finite difference weights on arbitrary nodes.        *
+ *          tmpl_Double_Array_Stencil:                                        *
+ *              Applies a centered stencil to the interior of an array.       *
+ *  Method:                                                                   *
+ *      A centered stencil with 2 r + 1 points, r = (deriv + order - 1) / 2,  *
+ *      is exact for polynomials of degree 2 r, and hence has error           *
+ *      O(h^order). The weights are the same for every interior point, so     *
+ *      the interior is a convolution. This is done in cache sized blocks of  *
+ *      outputs, adding two weights times shifted copies of y per pass. The   *
+ *      inner loops are branch free and vectorize.                            *
+ *                                                                            *
+ *      The first and last r points use one-sided stencils over the first     *
+ *      and last deriv + order samples. These are exact for polynomials of    *
+ *      degree deriv + order - 1, and so have the same order of accuracy.     *
+ *      All weights are computed with Fornberg's algorithm on integer nodes   *
+ *      and scaled by 1 / h^deriv.                                            *
+ *  Notes:                                                                    *
+ *      1.) If y or dy is NULL, nothing is done.                              *
+ *                                                                            *
+ *      2.) If deriv is zero, order is odd or zero, the stencil is larger     *
+ *          than TMPL_ARRAY_DERIVATIVE_MAX_POINTS, or there are fewer samples *
+ *          than the stencil, dy is set to NaN.                               *
+ *                                                                            *
+ *      3.) Higher orders reduce the truncation error, but amplify rounding   *
+ *          errors and noise in y. For noisy data, see                        *
+ *          tmpl_Double_Array_Savitzky_Golay_Derivative.                      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file providing TMPL_NAN.                                   *
+ *  2.) tmpl_differentiation_real.h:                                          *
+ *          Header file where the function prototype is given.                *
+ *  3.) tmpl_fornberg_weights_double.h:                                       *
+ *          Auxiliary header file with Fornberg's algorithm.                  *
+ *  4.) tmpl_array_stencil_double.h:                                          *
+ *          Auxiliary header file with the interior sweep.                    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_NAN found here.                                                      */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Function prototype and TMPL_ARRAY_DERIVATIVE_MAX_POINTS given here.       */
+#include <libtmpl/include/tmpl_differentiation_real.h>
+
+/*  tmpl_Double_Fornberg_Weights provided here.                               */
+#include "auxiliary/tmpl_fornberg_weights_double.h"
+
+/*  tmpl_Double_Array_Stencil provided here.                                  */
+#include "auxiliary/tmpl_array_stencil_double.h"
+
+/*  Computes the deriv-th derivative of uniformly sampled data.               */
+void
+tmpl_Double_Array_Derivative(const double * const y,
+                             double * const dy,
+                             size_t len,
+                             double h,
+                             unsigned int deriv,
+                             unsigned int order)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    double nodes[TMPL_ARRAY_DERIVATIVE_MAX_POINTS];
+    double w[TMPL_ARRAY_DERIVATIVE_MAX_POINTS];
+    double scale;
+    size_t n, j, half, width, edge;
+    unsigned int k;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!y || !dy || len == 0)
+        return;
+
+    /*  The central stencil has 2 half + 1 points, and is accurate to order   *
+     *  2 half + 1 - deriv, rounded up to an even number by symmetry. The     *
+     *  one-sided stencils at the ends need deriv + order points.             */
+    half = (deriv + order - 1U) / 2U;
+    width = 2*half + 1;
+    edge = (size_t)(deriv + order);
+
+    /*  Invalid parameters, or too few samples. Return NaN.                   */
+    if (deriv == 0U || order == 0U || (order & 1U) ||
+        edge > TMPL_ARRAY_DERIVATIVE_MAX_POINTS ||
+        width > TMPL_ARRAY_DERIVATIVE_MAX_POINTS ||
+        len < edge || len < width)
+    {
+        for (n = 0; n < len; ++n)
+            dy[n] = TMPL_NAN;
+
+        return;
+    }
+
+    /*  The weights are for unit spacing. Scale by 1 / h^deriv.               */
+    scale = 1.0;
+
+    for (k = 0U; k < deriv; ++k)
+        scale /= h;
+
+    /*  The first half outputs use the first edge samples.                    */
+    for (j = 0; j < edge; ++j)
+        nodes[j] = (double)j;
+
+    for (n = 0; n < half; ++n)
+    {
+        double sum = 0.0;
+        tmpl_Double_Fornberg_Weights(nodes, edge, (double)n, deriv, w);
+
+        for (j = 0; j < edge; ++j)
+            sum += w[j] * y[j];
+
+        dy[n] = sum * scale;
+    }
+
+    /*  The last half outputs use the last edge samples.                      */
+    for (n = 0; n < half; ++n)
+    {
+        double sum = 0.0;
+        const size_t ind = len - 1 - n;
+        const size_t start = len - edge;
+
+        tmpl_Double_Fornberg_Weights(nodes, edge, (double)(ind - start),
+                                     deriv, w);
+
+        for (j = 0; j < edge; ++j)
+            sum += w[j] * y[start + j];
+
+        dy[ind] = sum * scale;
+    }
+
+    /*  The interior uses the central stencil, the same for every point.      */
+    for (j = 0; j < width; ++j)
+        nodes[j] = (double)j - (double)half;
+
+    tmpl_Double_Fornberg_Weights(nodes, width, 0.0, deriv, w);
+
+    for (j = 0; j < width; ++j)
+        w[j] *= scale;
+
+    tmpl_Double_Array_Stencil(y, dy, len, w, width);
+}
+/*  End of tmpl_Double_Array_Derivative.                                      */
@@ -0,0 +1,192 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                  tmpl_array_derivative_nonuniform_double                   *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes derivatives of data sampled on a non-uniform grid.           *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Double_Array_Derivative_Nonuniform                               *
+ *  Purpose:                                                                  *
+ *      Computes dy[n] ~= f^(deriv)(x[n]) from the samples y[n] = f(x[n]).    *
+ *  Arguments:                                                                *
+ *      x (const double * const):                                             *
+ *          The grid points. They must be strictly increasing.                *
+ *      y (const double * const):                                             *
+ *          The samples y[n] = f(x[n]).                                       *
+ *      dy (double * const):                                                  *
+ *          The output array. It must have len elements and not overlap y.    *
+ *      len (size_t):                                                         *
+ *          The number of samples.                                            *
+ *      deriv (unsigned int):                                                 *
+ *          The order of the derivative, at least one.                        *
+ *      order (unsigned int):                                                 *
+ *          The order of accuracy, at least one.                              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      src/differention_real/auxiliary/                                      *
+ *          tmpl_Double_Fornberg_Weights:                                     *
+ *              Computes finite difference weights on arbitrary nodes.        *
+ *  Method:                                                                   *
+ *      Each point uses a window of deriv + order consecutive samples,        *
+ *      centered on the point where possible and shifted inwards near the     *
+ *      ends. The stencil is exact for polynomials of degree                  *
+ *      deriv + order - 1, so the error is O(h^order), h the largest spacing  *
+ *      in the window. The weights are computed with Fornberg's algorithm,    *
+ *      using the nodes x[j] - x[n] to avoid cancellation.                    *
+ *                                                                            *
+ *      For deriv = 1 and order = 2 the interior weights have a closed form.  *
+ *      With h0 = x[n] - x[n-1] and h1 = x[n+1] - x[n]:                       *
+ *                                                                            *
+ *                   h0^2 y[n+1] - h1^2 y[n-1] + (h1^2 - h0^2) y[n]           *
+ *          dy[n] = ------------------------------------------------          *
+ *                                h0 h1 (h0 + h1)                             *
+ *                                                                            *
+ *      This loop has no calls and vectorizes.                                *
+ *  Notes:                                                                    *
+ *      1.) If x, y, or dy is NULL, nothing is done.                          *
+ *                                                                            *
+ *      2.) If deriv or order is zero, the stencil is larger than             *
+ *          TMPL_ARRAY_DERIVATIVE_MAX_POINTS, or there are fewer samples      *
+ *          than the stencil, dy is set to NaN.                               *
+ *                                                                            *
+ *      3.) On a uniform grid, tmpl_Double_Array_Derivative is faster.        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file providing TMPL_NAN.                                   *
+ *  2.) tmpl_differentiation_real.h:                                          *
+ *          Header file where the function prototype is given.                *
+ *  3.) tmpl_fornberg_weights_double.h:                                       *
+ *          Auxiliary header file with Fornberg's algorithm.                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_NAN found here.                                                      */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Function prototype and TMPL_ARRAY_DERIVATIVE_MAX_POINTS given here.       */
+#include <libtmpl/include/tmpl_differentiation_real.h>
+
+/*  tmpl_Double_Fornberg_Weights provided here.                               */
+#include "auxiliary/tmpl_fornberg_weights_double.h"
+
+/*  Computes the derivative at x[n] from the width nearest samples.           */
+static double
+tmpl_nonuniform_point(const double * const x,
+                      const double * const y,
+                      size_t len,
+                      size_t n,
+                      size_t width,
+                      unsigned int deriv)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    double nodes[TMPL_ARRAY_DERIVATIVE_MAX_POINTS];
+    double w[TMPL_ARRAY_DERIVATIVE_MAX_POINTS];
+    double sum = 0.0;
+    size_t j, start;
+
+    /*  Center the window on n, and shift it inwards near the ends.           */
+    const size_t half = (width - 1) / 2;
+    start = (n > half ? n - half : 0);
+
+    if (start > len - width)
+        start = len - width;
+
+    /*  Shift the nodes so that x[n] is at zero. This avoids cancellation     *
+     *  when the grid is far from the origin.                                 */
+    for (j = 0; j < width; ++j)
+        nodes[j] = x[start + j] - x[n];
+
+    tmpl_Double_Fornberg_Weights(nodes, width, 0.0, deriv, w);
+
+    for (j = 0; j < width; ++j)
+        sum += w[j] * y[start + j];
+
+    return sum;
+}
+/*  End of tmpl_nonuniform_point.                                             */
+
+/*  Computes the deriv-th derivative of data on a non-uniform grid.           */
+void
+tmpl_Double_Array_Derivative_Nonuniform(const double * const x,
+                                        const double * const y,
+                                        double * const dy,
+                                        size_t len,
+                                        unsigned int deriv,
+                                        unsigned int order)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+
+    /*  The stencils have deriv + order points.                               */
+    const size_t width = (size_t)deriv + (size_t)order;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!x || !y || !dy || len == 0)
+        return;
+
+    /*  Invalid parameters, or too few samples. Return NaN.                   */
+    if (deriv == 0U || order == 0U ||
+        width > TMPL_ARRAY_DERIVATIVE_MAX_POINTS || len < width)
+    {
+        for (n = 0; n < len; ++n)
+            dy[n] = TMPL_NAN;
+
+        return;
+    }
+
+    /*  Three point first derivatives are the most common case. The weights   *
+     *  have a closed form, and the loop can be vectorized.                   */
+    if (deriv == 1U && order == 2U)
+    {
+        for (n = 1; n < len - 1; ++n)
+        {
+            const double h0 = x[n] - x[n - 1];
+            const double h1 = x[n + 1] - x[n];
+            const double h0_sq = h0 * h0;
+            const double h1_sq = h1 * h1;
+            const double num = h0_sq * y[n + 1] - h1_sq * y[n - 1] +
+                               (h1_sq - h0_sq) * y[n];
+
+            dy[n] = num / (h0 * h1 * (h0 + h1));
+        }
+
+        /*  The end points use one-sided three point stencils.                */
+        dy[0] = tmpl_nonuniform_point(x, y, len, 0, width, deriv);
+        dy[len - 1] = tmpl_nonuniform_point(x, y, len, len - 1, width, deriv);
+        return;
+    }
+
+    /*  The general case computes new weights for every point. The points     *
+     *  are independent, and the cost is the same for each.                   */
+#ifdef _OPENMP
+#pragma omp parallel for \
+    if(len >= TMPL_DIFFERENTIATION_REAL_PARALLEL_MIN_LENGTH)
+#endif
+    for (n = 0; n < len; ++n)
+        dy[n] = tmpl_nonuniform_point(x, y, len, n, width, deriv);
+}
+/*  End of tmpl_Double_Array_Derivative_Nonuniform.                           */
@@ -0,0 +1,301 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                      tmpl_array_savitzky_golay_double                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Smooths and differentiates noisy data with Savitzky-Golay filters.    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Double_Array_Savitzky_Golay_Derivative                           *
+ *  Purpose:                                                                  *
+ *      Fits a polynomial to a sliding window of samples by least squares,    *
+ *      and returns the value or a derivative of the fit.                     *
+ *  Arguments:                                                                *
+ *      y (const double * const):                                             *
+ *          The samples y[n] = f(x_0 + n h).                                  *
+ *      out (double * const):                                                 *
+ *          The output array. It must have len elements and not overlap y.    *
+ *      len (size_t):                                                         *
+ *          The number of samples.                                            *
+ *      h (double):                                                           *
+ *          The grid spacing. It is not used if deriv is zero.                *
+ *      half_width (size_t):                                                  *
+ *          The half-width m. The window has 2 m + 1 points.                  *
+ *      degree (unsigned int):                                                *
+ *          The degree of the fitted polynomial, less than 2 m + 1.           *
+ *      deriv (unsigned int):                                                 *
+ *          The order of the derivative, at most degree. Zero smooths y.      *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_math.h:                                                          *
+ *          tmpl_Double_Sqrt:                                                 *
+ *              Computes the square root of a real number.                    *
+ *      src/differention_real/auxiliary/                                      *
+ *          tmpl_Double_Array_Stencil:                                        *
+ *              Applies a centered stencil to the interior of an array.       *
+ *  Method:                                                                   *
+ *      In the variable t = (x - x_c) / (m h), the window is t_j = (j - m) / m*
+ *      for 0 <= j <= 2 m. Let A be the Vandermonde matrix A_jk = t_j^k. The  *
+ *      least squares fit is c = R^-1 Q^T y, where A = Q R is computed by     *
+ *      modified Gram-Schmidt. If v is the deriv-th derivative of the powers  *
+ *      (1, t, ..., t^degree) at t = s, the derivative of the fit at s is     *
+ *                                                                            *
+ *          v^T c = (Q R^-T v)^T y                                            *
+ *                                                                            *
+ *      so the weights are w = Q u with R^T u = v. These are scaled by        *
+ *      1 / (m h)^deriv to give the derivative with respect to x.             *
+ *                                                                            *
+ *      The interior uses s = 0 for every point, and is a convolution with    *
+ *      fixed weights, done in cache sized blocks with vectorized inner       *
+ *      loops. The first and last m points use the fits over the first and    *
+ *      last windows, evaluated at the point itself, with new weights for     *
+ *      each point.                                                           *
+ *  Notes:                                                                    *
+ *      1.) If y or out is NULL, nothing is done.                             *
+ *                                                                            *
+ *      2.) If half_width is zero or greater than                             *
+ *          TMPL_SAVITZKY_GOLAY_MAX_HALF_WIDTH, degree is greater than        *
+ *          TMPL_SAVITZKY_GOLAY_MAX_DEGREE or not less than 2 m + 1, deriv is *
+ *          greater than degree, or len is less than 2 m + 1, out is set to   *
+ *          NaN.                                                              *
+ *                                                                            *
+ *      3.) Polynomials of degree at most degree are reproduced exactly, up   *
+ *          to rounding. Wider windows remove more noise, but also smooth     *
+ *          out features narrower than the window.                            *
+ *                                                                            *
+ *      4.) Scaling t to [-1, 1] and using QR keeps the fit well conditioned. *
+ *          The classic tables solve the normal equations with integer        *
+ *          offsets, which loses accuracy quickly as the degree grows.        *
+ *  References:                                                               *
+ *      1.) Savitzky, A., Golay, M. (1964)                                    *
+ *          "Smoothing and Differentiation of Data by Simplified Least        *
+ *           Squares Procedures", Analytical Chemistry, Vol. 36, No. 8.       *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file providing TMPL_NAN and tmpl_Double_Sqrt.              *
+ *  2.) tmpl_differentiation_real.h:                                          *
+ *          Header file where the function prototype is given.                *
+ *  3.) tmpl_array_stencil_double.h:                                          *
+ *          Auxiliary header file with the interior sweep.                    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_NAN found here.                                                      */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Function prototype and the Savitzky-Golay limits given here.              */
+#include <libtmpl/include/tmpl_differentiation_real.h>
+
+/*  tmpl_Double_Array_Stencil provided here.                                  */
+#include "auxiliary/tmpl_array_stencil_double.h"
+
+/*  Number of points and coefficients for the largest allowed fit.            */
+#define TMPL_SG_MAX_POINTS (2*TMPL_SAVITZKY_GOLAY_MAX_HALF_WIDTH + 1)
+#define TMPL_SG_MAX_COEFFS (TMPL_SAVITZKY_GOLAY_MAX_DEGREE + 1)
+
+/*  Computes the weights that evaluate the deriv-th derivative of the least   *
+ *  squares fit at the scaled offset s, given the QR factors of the window.   */
+static void
+tmpl_sg_weights(double q[TMPL_SG_MAX_POINTS][TMPL_SG_MAX_COEFFS],
+                double r[TMPL_SG_MAX_COEFFS][TMPL_SG_MAX_COEFFS],
+                size_t points,
+                unsigned int coeffs,
+                unsigned int deriv,
+                double s,
+                double scale,
+                double * const w)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    double u[TMPL_SG_MAX_COEFFS];
+    double power, factor;
+    unsigned int k, i, j;
+    size_t n;
+
+    /*  u starts as the deriv-th derivative of (1, t, ..., t^degree) at s.    */
+    for (k = 0U; k < deriv; ++k)
+        u[k] = 0.0;
+
+    power = 1.0;
+
+    for (k = deriv; k < coeffs; ++k)
+    {
+        /*  k! / (k - deriv)! = k (k - 1) ... (k - deriv + 1).                */
+        factor = 1.0;
+
+        for (j = 0U; j < deriv; ++j)
+            factor *= (double)(k - j);
+
+        u[k] = factor * power;
+        power *= s;
+    }
+
+    /*  The fit is c = R^-1 Q^T y, so the weights are Q R^-T u. Solve the     *
+     *  lower triangular system R^T u = v by forward substitution.            */
+    for (i = 0U; i < coeffs; ++i)
+    {
+        for (j = 0U; j < i; ++j)
+            u[i] -= r[j][i] * u[j];
+
+        u[i] /= r[i][i];
+    }
+
+    for (n = 0; n < points; ++n)
+    {
+        double sum = 0.0;
+
+        for (k = 0U; k < coeffs; ++k)
+            sum += q[n][k] * u[k];
+
+        w[n] = sum * scale;
+    }
+}
+/*  End of tmpl_sg_weights.                                                   */
+
+/*  Savitzky-Golay smoothing and differentiation of uniformly sampled data.   */
+void
+tmpl_Double_Array_Savitzky_Golay_Derivative(const double * const y,
+                                            double * const out,
+                                            size_t len,
+                                            double h,
+                                            size_t half_width,
+                                            unsigned int degree,
+                                            unsigned int deriv)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    double q[TMPL_SG_MAX_POINTS][TMPL_SG_MAX_COEFFS];
+    double r[TMPL_SG_MAX_COEFFS][TMPL_SG_MAX_COEFFS];
+    double w[TMPL_SG_MAX_POINTS];
+    double scale, norm, dot, rcpr_half;
+    size_t n, j, points;
+    unsigned int k, i, coeffs;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!y || !out || len == 0)
+        return;
+
+    points = 2*half_width + 1;
+    coeffs = degree + 1U;
+
+    /*  Invalid parameters, or too few samples. Return NaN.                   */
+    if (half_width == 0 || half_width > TMPL_SAVITZKY_GOLAY_MAX_HALF_WIDTH ||
+        degree > TMPL_SAVITZKY_GOLAY_MAX_DEGREE || (size_t)degree >= points ||
+        deriv > degree || len < points)
+    {
+        for (n = 0; n < len; ++n)
+            out[n] = TMPL_NAN;
+
+        return;
+    }
+
+    /*  The fit uses t = (x - x_c) / (m h), with x_c the center of the window *
+     *  and m the half-width, so that t lies in [-1, 1]. The derivative with  *
+     *  respect to x picks up a factor of 1 / (m h) for every order.          */
+    rcpr_half = 1.0 / (double)half_width;
+    scale = 1.0;
+
+    for (k = 0U; k < deriv; ++k)
+        scale /= ((double)half_width * h);
+
+    /*  The columns of the Vandermonde matrix, 1, t, t^2, ..., t^degree.      */
+    for (j = 0; j < points; ++j)
+    {
+        const double t = ((double)j - (double)half_width) * rcpr_half;
+        q[j][0] = 1.0;
+
+        for (k = 1U; k < coeffs; ++k)
+            q[j][k] = q[j][k - 1] * t;
+    }
+
+    /*  QR factorization by modified Gram-Schmidt. This is better conditioned *
+     *  than solving the normal equations, which square the condition number. */
+    for (k = 0U; k < coeffs; ++k)
+    {
+        for (i = 0U; i < k; ++i)
+        {
+            dot = 0.0;
+
+            for (j = 0; j < points; ++j)
+                dot += q[j][i] * q[j][k];
+
+            r[i][k] = dot;
+
+            for (j = 0; j < points; ++j)
+                q[j][k] -= dot * q[j][i];
+        }
+
+        norm = 0.0;
+
+        for (j = 0; j < points; ++j)
+            norm += q[j][k] * q[j][k];
+
+        norm = tmpl_Double_Sqrt(norm);
+        r[k][k] = norm;
+
+        for (j = 0; j < points; ++j)
+            q[j][k] /= norm;
+    }
+
+    /*  The first half_width outputs use the fit over the first window,       *
+     *  evaluated at the point itself instead of the center.                  */
+    for (n = 0; n < half_width; ++n)
+    {
+        double sum = 0.0;
+        const double s = ((double)n - (double)half_width) * rcpr_half;
+
+        tmpl_sg_weights(q, r, points, coeffs, deriv, s, scale, w);
+
+        for (j = 0; j < points; ++j)
+            sum += w[j] * y[j];
+
+        out[n] = sum;
+    }
+
+    /*  Similarly for the last half_width outputs and the last window.        */
+    for (n = 0; n < half_width; ++n)
+    {
+        double sum = 0.0;
+        const size_t start = len - points;
+        const double s = ((double)half_width - (double)n) * rcpr_half;
+
+        tmpl_sg_weights(q, r, points, coeffs, deriv, s, scale, w);
+
+        for (j = 0; j < points; ++j)
+            sum += w[j] * y[start + j];
+
+        out[len - 1 - n] = sum;
+    }
+
+    /*  The interior evaluates every fit at its center, so the weights are    *
+     *  the same for every point and the filter is a convolution.             */
+    tmpl_sg_weights(q, r, points, coeffs, deriv, 0.0, scale, w);
+
+    tmpl_Double_Array_Stencil(y, out, len, w, points);
+}
+/*  End of tmpl_Double_Array_Savitzky_Golay_Derivative.                       */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_SG_MAX_POINTS
+#undef TMPL_SG_MAX_COEFFS
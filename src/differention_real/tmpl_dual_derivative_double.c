@@ -0,0 +1,88 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                        tmpl_dual_derivative_double                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes derivatives exactly with forward-mode automatic              *
+ *      differentiation.                                                      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Double_Dual_Derivative                                           *
+ *  Purpose:                                                                  *
+ *      Computes f'(x) for a function f written with dual numbers.            *
+ *  Arguments:                                                                *
+ *      f (tmpl_DualDouble (*)(tmpl_DualDouble)):                             *
+ *          The function, written with the routines from tmpl_dual.h.         *
+ *      x (double):                                                           *
+ *          The point where f' is to be computed.                             *
+ *  Output:                                                                   *
+ *      f_prime (double):                                                     *
+ *          The derivative f'(x).                                             *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      For dual numbers, f(x + e) = f(x) + f'(x) e since e^2 = 0. Evaluate   *
+ *      f at x + e and return the dual part.                                  *
+ *  Notes:                                                                    *
+ *      1.) There is no step size. The result is exact up to the rounding     *
+ *          error in evaluating f', unlike tmpl_Double_Five_Point_Derivative  *
+ *          which loses about half of the significant digits.                 *
+ *                                                                            *
+ *      2.) f is called once. Each dual operation costs about two to four     *
+ *          real operations, so this is about as expensive as two calls to    *
+ *          the real version of f. The stencils need two to four calls.       *
+ *                                                                            *
+ *      3.) The value f(x) is computed too. Call f directly on                *
+ *          tmpl_DualDouble_Create(x, 1.0) if both are needed.                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_dual_double.h:                                                   *
+ *          Header file with the tmpl_DualDouble typedef.                     *
+ *  2.) tmpl_differentiation_real.h:                                          *
+ *          Header file containing the function prototype.                    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Dual number typedef provided here.                                        */
+#include <libtmpl/include/types/tmpl_dual_double.h>
+
+/*  Function prototype given here.                                            */
+#include <libtmpl/include/tmpl_differentiation_real.h>
+
+/*  Computes the derivative of f at x with dual numbers.                      */
+double
+tmpl_Double_Dual_Derivative(tmpl_DualDouble (*f)(tmpl_DualDouble), double x)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    tmpl_DualDouble x_dual, f_x;
+
+    /*  The dual part of the input is dx/dx = 1.                              */
+    x_dual.dat[0] = x;
+    x_dual.dat[1] = 1.0;
+
+    /*  f(x + e) = f(x) + f'(x) e. The dual part is the derivative.           */
+    f_x = f(x_dual);
+    return f_x.dat[1];
+}
+/*  End of tmpl_Double_Dual_Derivative.                                       */
@@ -0,0 +1,89 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                        tmpl_eft_fast_two_sum_double                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides an inlined Fast2Sum for the array kernels.                   *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_EFT_Double_Fast_Two_Sum                                          *
+ *  Purpose:                                                                  *
+ *      Computes x + y = sum + err exactly for |x| >= |y| (Fast2Sum).         *
+ *  Method:                                                                   *
+ *      The same algorithm as src/two_sum/, with the same barriers against    *
+ *      reordering and FMA contraction. It is kept apart from                 *
+ *      tmpl_eft_kernels_double.h since only some kernels renormalize with    *
+ *      it, and the static function would be unused in the others.            *
+ *  Notes:                                                                    *
+ *      1.) The result is only exact if |x| >= |y|, or if x is zero. The      *
+ *          caller must guarantee this.                                       *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing TMPL_STATIC_INLINE and TMPL_RESTRICT.       *
+ *  2.) tmpl_float_barrier.h:                                                 *
+ *          Macros preventing aggressive compiler optimizations.              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_EFT_FAST_TWO_SUM_DOUBLE_H
+#define TMPL_EFT_FAST_TWO_SUM_DOUBLE_H
+
+/*  TMPL_STATIC_INLINE and TMPL_RESTRICT macros provided here.                */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Macros preventing aggressive compiler optimizations given here.           */
+#include <libtmpl/include/tmpl_float_barrier.h>
+
+/*  Fast2Sum for double, inlined. Requires |x| >= |y|.                        */
+TMPL_STATIC_INLINE
+void
+tmpl_EFT_Double_Fast_Two_Sum(const double x,
+                             const double y,
+                             double * TMPL_RESTRICT const out,
+                             double * TMPL_RESTRICT const err)
+{
+    /*  Variables for the sum and the error term.                             */
+    double sum, yc, err_sum;
+
+    /*  The rounded sum, protected from optimizations with a barrier.         */
+    sum = x + y;
+    TMPL_DOUBLE_BARRIER(sum);
+
+    /*  The part of y that made it into the sum.                              */
+    yc = sum - x;
+    TMPL_DOUBLE_BARRIER(yc);
+
+    /*  The error is what remains of y.                                       */
+    err_sum = y - yc;
+    TMPL_DOUBLE_BARRIER(err_sum);
+
+    *out = sum;
+    *err = err_sum;
+}
+/*  End of tmpl_EFT_Double_Fast_Two_Sum.                                      */
+
+#endif
+/*  End of include guard.                                                     */
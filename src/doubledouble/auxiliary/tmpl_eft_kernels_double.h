@@ -0,0 +1,161 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                          tmpl_eft_kernels_double                           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides inlined error-free transformations for the array kernels.    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_EFT_Double_Two_Sum                                               *
+ *  Purpose:                                                                  *
+ *      Computes x + y = sum + err exactly (2Sum).                            *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_EFT_Double_Two_Prod                                              *
+ *  Purpose:                                                                  *
+ *      Computes x * y = prod + err exactly (2Prod).                          *
+ ******************************************************************************
+ *  Method:                                                                   *
+ *      These are the same algorithms as src/two_sum/ and src/two_prod/, with *
+ *      the same barriers against reordering and FMA contraction. The public  *
+ *      versions live in their own translation units, and are only inlined    *
+ *      with link-time optimization. The array kernels call these once or     *
+ *      twice per element, so a function call each time would cost more than  *
+ *      the arithmetic. These static versions are always inlined.             *
+ *  Notes:                                                                    *
+ *      1.) 2Prod uses Dekker's splitting, which overflows for |x| or |y|     *
+ *          larger than about 2^996.                                          *
+ *                                                                            *
+ *      2.) Each function is written for one pair of inputs. The kernels get  *
+ *          their speed by running several independent chains (lanes) at      *
+ *          once, which hides the latency of these dependent operations.      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing TMPL_STATIC_INLINE and TMPL_VOLATILE.       *
+ *  2.) tmpl_float_barrier.h:                                                 *
+ *          Macros preventing aggressive compiler optimizations.              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_EFT_KERNELS_DOUBLE_H
+#define TMPL_EFT_KERNELS_DOUBLE_H
+
+/*  TMPL_STATIC_INLINE and TMPL_VOLATILE macros provided here.                */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Macros preventing aggressive compiler optimizations given here.           */
+#include <libtmpl/include/tmpl_float_barrier.h>
+
+/*  2Sum for double, inlined.                                                 */
+TMPL_STATIC_INLINE
+void
+tmpl_EFT_Double_Two_Sum(const double x,
+                        const double y,
+                        double * TMPL_RESTRICT const out,
+                        double * TMPL_RESTRICT const err)
+{
+    /*  Variables for the sums, compensations, and errors.                    */
+    double sum, xc, yc, xerr, yerr, err_sum;
+
+    /*  The rounded sum, protected from optimizations with a barrier.         */
+    sum = x + y;
+    TMPL_DOUBLE_BARRIER(sum);
+
+    /*  The compensated values for x and y.                                   */
+    xc = sum - y;
+    TMPL_DOUBLE_BARRIER(xc);
+    yc = sum - xc;
+    TMPL_DOUBLE_BARRIER(yc);
+
+    /*  The error terms for x and y from the compensated values.              */
+    xerr = x - xc;
+    TMPL_DOUBLE_BARRIER(xerr);
+    yerr = y - yc;
+    TMPL_DOUBLE_BARRIER(yerr);
+
+    err_sum = xerr + yerr;
+    TMPL_DOUBLE_BARRIER(err_sum);
+
+    *out = sum;
+    *err = err_sum;
+}
+/*  End of tmpl_EFT_Double_Two_Sum.                                           */
+
+/*  2Prod for double using Dekker's splitting, inlined.                       */
+TMPL_STATIC_INLINE
+void
+tmpl_EFT_Double_Two_Prod(const double x,
+                         const double y,
+                         double * TMPL_RESTRICT const out,
+                         double * TMPL_RESTRICT const err)
+{
+    /*  The splitting factor, 2^27 + 1.                                       */
+    const double splitter = 134217729.0;
+
+    /*  The scaled inputs may need to be volatile for the split to work on    *
+     *  platforms where the barrier macro has no effect.                      */
+    TMPL_VOLATILE double x_scaled, y_scaled;
+
+    /*  Variables for the split inputs and the partial errors.                */
+    double x_diff, y_diff, xhi, yhi, xlo, ylo, prod, err_hi, err_mid, error;
+
+    /*  Split x into high and low halves, xhi having at most 26 bits.         */
+    x_scaled = x * splitter;
+    TMPL_DOUBLE_BARRIER(x_scaled);
+    x_diff = x_scaled - x;
+    TMPL_DOUBLE_BARRIER(x_diff);
+    xhi = x_scaled - x_diff;
+    TMPL_DOUBLE_BARRIER(xhi);
+    xlo = x - xhi;
+
+    /*  Same split for y.                                                     */
+    y_scaled = y * splitter;
+    TMPL_DOUBLE_BARRIER(y_scaled);
+    y_diff = y_scaled - y;
+    TMPL_DOUBLE_BARRIER(y_diff);
+    yhi = y_scaled - y_diff;
+    TMPL_DOUBLE_BARRIER(yhi);
+    ylo = y - yhi;
+
+    /*  The rounded product. xhi * yhi - prod must not become an FMA.         */
+    prod = x * y;
+    TMPL_DOUBLE_BARRIER(prod);
+
+    /*  Each partial product is exact, so only the order of the sums matters. */
+    err_hi = xhi * yhi - prod;
+    TMPL_DOUBLE_BARRIER(err_hi);
+    err_mid = err_hi + (xhi * ylo + xlo * yhi);
+    TMPL_DOUBLE_BARRIER(err_mid);
+    error = err_mid + xlo * ylo;
+    TMPL_DOUBLE_BARRIER(error);
+
+    *out = prod;
+    *err = error;
+}
+/*  End of tmpl_EFT_Double_Two_Prod.                                          */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,160 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                       tmpl_expm1_kernel_doubledouble                       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes exp(r) - 1 for small double-doubles.                         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_DoubleDouble_Expm1_Kernel                                        *
+ *  Purpose:                                                                  *
+ *      Computes exp(r) - 1 for |r| <= log(2) / 2.                            *
+ *  Arguments:                                                                *
+ *      r (const tmpl_DoubleDouble * const):                                  *
+ *          A double-double, |r| <= log(2) / 2.                               *
+ *  Output:                                                                   *
+ *      expm1_r (tmpl_DoubleDouble):                                          *
+ *          The double-double value exp(r) - 1.                               *
+ *  Called Functions:                                                         *
+ *      src/doubledouble/                                                     *
+ *          tmpl_DoubleDouble_Add:                                            *
+ *              Adds two double-doubles.                                      *
+ *          tmpl_DoubleDouble_Quick_Add:                                      *
+ *              Adds two double-doubles, the first much larger.               *
+ *          tmpl_DoubleDouble_Multiply:                                       *
+ *              Multiplies two double-doubles.                                *
+ *          tmpl_DoubleDouble_Multiply_Scalar:                                *
+ *              Multiplies a double-double by a double.                       *
+ *  Method:                                                                   *
+ *      Scale the input down by 2^9, so |s| = |r| / 512 < 7x10^-4, and sum    *
+ *      the Maclaurin series for exp(s) - 1 up to the s^10 term. Terms past   *
+ *      s^5 are below 10^-18 |s|, so they only need double precision. The     *
+ *      remaining terms are summed with double-doubles using Horner's method. *
+ *      We then undo the scaling using exp(2s) - 1 = 2e + e^2, where          *
+ *      e = exp(s) - 1, nine times. Working with exp(s) - 1 rather than       *
+ *      exp(s) keeps the relative error small, even when r is tiny.           *
+ *  Notes:                                                                    *
+ *      1.) The relative error is a small multiple of eps^2. No checks for    *
+ *          large inputs, infinity, or NaN are made.                          *
+ *                                                                            *
+ *      2.) This is the kernel for both tmpl_DoubleDouble_Exp and             *
+ *          tmpl_DoubleDouble_Log.                                            *
+ *  References:                                                               *
+ *      1.) Hida, Y., Li, X., Bailey, D. (May 2008).                          *
+ *          Library for Double-Double and Quad-Double Arithmetic.             *
+ *          The scaling and squaring method used here follows the QD library. *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing the TMPL_STATIC_INLINE macro.               *
+ *  2.) tmpl_attributes.h:                                                    *
+ *          Provides (optional) C23 attributes for optimization.              *
+ *  3.) tmpl_doubledouble.h:                                                  *
+ *          Double-double arithmetic routines provided here.                  *
+ *  4.) tmpl_doubledouble_tables.h:                                           *
+ *          The table of reciprocal factorials is declared here.              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_EXPM1_KERNEL_DOUBLEDOUBLE_H
+#define TMPL_EXPM1_KERNEL_DOUBLEDOUBLE_H
+
+/*  TMPL_STATIC_INLINE macro provided here.                                   */
+#include <libtmpl/include/tmpl_config.h>
+#include <libtmpl/include/tmpl_attributes.h>
+
+/*  Double-double arithmetic found here.                                      */
+#include <libtmpl/include/tmpl_doubledouble.h>
+
+/*  Lookup table of 1 / n!, as double-doubles, declared here.                 */
+#include <libtmpl/include/tables/tmpl_doubledouble_tables.h>
+
+/*  The input is scaled by 2^-TMPL_EXPM1_SQUARINGS before summing the series. */
+#define TMPL_EXPM1_SQUARINGS (9)
+#define TMPL_EXPM1_SCALE (1.953125E-03)
+
+/*  Shorthand for the table of reciprocal factorials, 1 / n!.                 */
+#define TMPL_RCPR_FACT tmpl_doubledouble_rcpr_factorial_table
+
+/*  Computes exp(r) - 1 for small r.                                          */
+TMPL_PURE_FUNC
+TMPL_STATIC_INLINE
+tmpl_DoubleDouble
+tmpl_DoubleDouble_Expm1_Kernel(const tmpl_DoubleDouble * const r)
+TMPL_UNSEQUENCED
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_DoubleDouble s, poly, prod, twice;
+    double s_hi, tail;
+    unsigned int n;
+
+    /*  Scaling by a power of two is exact, barring underflow.                */
+    s.dat[0] = r->dat[0] * TMPL_EXPM1_SCALE;
+    s.dat[1] = r->dat[1] * TMPL_EXPM1_SCALE;
+    s_hi = s.dat[0];
+
+    /*  The terms s^6 / 6! through s^10 / 10!, divided by s^6. These are too  *
+     *  small to need more than double precision.                             */
+    tail = TMPL_RCPR_FACT[10].dat[0];
+    tail = TMPL_RCPR_FACT[9].dat[0] + s_hi * tail;
+    tail = TMPL_RCPR_FACT[8].dat[0] + s_hi * tail;
+    tail = TMPL_RCPR_FACT[7].dat[0] + s_hi * tail;
+    tail = TMPL_RCPR_FACT[6].dat[0] + s_hi * tail;
+
+    /*  Continue Horner's method with double-doubles for 1 / 5! to 1 / 2!.    */
+    prod = tmpl_DoubleDouble_Multiply_Scalar(tail, &s);
+    poly = tmpl_DoubleDouble_Quick_Add(&TMPL_RCPR_FACT[5], &prod);
+
+    for (n = 4U; n > 1U; --n)
+    {
+        prod = tmpl_DoubleDouble_Multiply(&s, &poly);
+        poly = tmpl_DoubleDouble_Quick_Add(&TMPL_RCPR_FACT[n], &prod);
+    }
+
+    /*  exp(s) - 1 = s + s^2 * poly. s is much larger than the second term.   */
+    prod = tmpl_DoubleDouble_Multiply(&s, &poly);
+    prod = tmpl_DoubleDouble_Multiply(&s, &prod);
+    poly = tmpl_DoubleDouble_Quick_Add(&s, &prod);
+
+    /*  Undo the scaling. exp(2s) - 1 = 2 (exp(s) - 1) + (exp(s) - 1)^2.      */
+    for (n = 0U; n < TMPL_EXPM1_SQUARINGS; ++n)
+    {
+        prod = tmpl_DoubleDouble_Multiply(&poly, &poly);
+        twice.dat[0] = 2.0 * poly.dat[0];
+        twice.dat[1] = 2.0 * poly.dat[1];
+        poly = tmpl_DoubleDouble_Add(&twice, &prod);
+    }
+
+    return poly;
+}
+/*  End of tmpl_DoubleDouble_Expm1_Kernel.                                    */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_EXPM1_SQUARINGS
+#undef TMPL_EXPM1_SCALE
+#undef TMPL_RCPR_FACT
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,270 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                     tmpl_rem_pio2_kernel_doubledouble                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Reduces a double of any size modulo pi / 2, with double-double        *
+ *      output.                                                               *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_DoubleDouble_Rem_Pio2_Kernel                                     *
+ *  Purpose:                                                                  *
+ *      Computes x = q pi / 2 + r with q an integer and |r| <= pi / 4.        *
+ *  Arguments:                                                                *
+ *      x (double):                                                           *
+ *          A finite, non-zero real number.                                   *
+ *      r (tmpl_DoubleDouble * const):                                        *
+ *          The reduced argument r is stored here.                            *
+ *  Output:                                                                   *
+ *      quadrant (unsigned int):                                              *
+ *          The value q mod 4.                                                *
+ *  Called Functions:                                                         *
+ *      src/doubledouble/                                                     *
+ *          tmpl_DoubleDouble_Add_Scalar:                                     *
+ *              Adds a double to a double-double.                             *
+ *          tmpl_DoubleDouble_Multiply:                                       *
+ *              Multiplies two double-doubles.                                *
+ *      src/math/                                                             *
+ *          tmpl_Double_Base2_Mant_and_Exp:                                   *
+ *              Computes the mantissa and exponent of a double.               *
+ *          tmpl_Double_Pow2:                                                 *
+ *              Computes an integer power of two.                             *
+ *  Method:                                                                   *
+ *      Payne-Hanek reduction with exact integer arithmetic. Write            *
+ *      |x| = M 2^E with M a 53-bit integer, stored as four 16-bit limbs.     *
+ *      2 / pi is tabulated as 16-bit limbs t_k with 2 / pi = sum t_k 2^-16k. *
+ *      The term M t_k 2^(E - 16k) is a multiple of 4 if E - 16k >= 2, and    *
+ *      does not change q mod 4 or r, so these limbs are skipped. The next    *
+ *      18 limbs are multiplied by M exactly, giving at least 270 bits after  *
+ *      the binary point of the product. The limbs past the window change it  *
+ *      by less than 2^53 units in the last place, so the fraction is correct *
+ *      to about 2^-217.                                                      *
+ *                                                                            *
+ *      The two bits above the binary point are q mod 4. If the fraction f is *
+ *      at least 1 / 2, q is increased by one and f becomes f - 1, so that    *
+ *      |f| <= 1 / 2. The leading 128 bits of f are summed into a             *
+ *      double-double and multiplied by pi / 2 to give r.                     *
+ *  Notes:                                                                    *
+ *      1.) The limb products are below 2^32, so unsigned long is enough and  *
+ *          this is valid C89. No IEEE-754 bit manipulation is needed.        *
+ *                                                                            *
+ *      2.) The closest a double comes to a multiple of pi / 2 is about       *
+ *          2^-61, so the fraction always has enough correct bits to give r   *
+ *          to double-double precision.                                       *
+ *                                                                            *
+ *      3.) No checks for zero, infinity, or NaN are made.                    *
+ *  References:                                                               *
+ *      1.) Payne, M., Hanek, R. (January 1983).                              *
+ *          "Radian Reduction for Trigonometric Functions",                   *
+ *          ACM SIGNUM Newsletter, Vol. 18, No. 1.                            *
+ *      2.) Muller, J. (2016).                                                *
+ *          "Elementary Functions: Algorithms and Implementation",            *
+ *          Chapter 11, Birkhauser.                                           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing the TMPL_STATIC_INLINE macro.               *
+ *  2.) tmpl_math.h:                                                          *
+ *          Header file providing the mantissa, exponent, and powers of two.  *
+ *  3.) tmpl_doubledouble.h:                                                  *
+ *          Double-double arithmetic routines provided here.                  *
+ *  4.) tmpl_doubledouble_tables.h:                                           *
+ *          The table of the bits of 2 / pi is declared here.                 *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_REM_PIO2_KERNEL_DOUBLEDOUBLE_H
+#define TMPL_REM_PIO2_KERNEL_DOUBLEDOUBLE_H
+
+/*  TMPL_STATIC_INLINE macro provided here.                                   */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  tmpl_Double_Base2_Mant_and_Exp and tmpl_Double_Pow2 found here.           */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Double-double arithmetic found here.                                      */
+#include <libtmpl/include/tmpl_doubledouble.h>
+
+/*  The bits of 2 / pi, 16 at a time, declared here.                          */
+#include <libtmpl/include/tables/tmpl_doubledouble_tables.h>
+
+/*  Number of limbs of 2 / pi multiplied by the mantissa of x.                */
+#define TMPL_REM_PIO2_LIMBS (18)
+
+/*  pi / 2 as a double-double.                                                */
+#define TMPL_REM_PIO2_PI_BY_TWO_HI (+1.570796326794896557998981734272E+00)
+#define TMPL_REM_PIO2_PI_BY_TWO_LO (+6.123233995736766035868820147292E-17)
+
+/*  Shorthand for the table of the bits of 2 / pi.                            */
+#define TMPL_TWO_BY_PI tmpl_doubledouble_two_by_pi_table
+
+/*  Reduces a double modulo pi / 2, returning the quadrant.                   */
+TMPL_STATIC_INLINE
+unsigned int
+tmpl_DoubleDouble_Rem_Pio2_Kernel(double x, tmpl_DoubleDouble * const r)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    unsigned long mant_limbs[4];
+    unsigned long window[TMPL_REM_PIO2_LIMBS];
+    unsigned long z[TMPL_REM_PIO2_LIMBS + 4];
+    unsigned long carry, prod, mask;
+    unsigned int n, j, bits, ind, offset, quadrant, top, last, negative;
+    signed int expo, first;
+    double mant, scale;
+    tmpl_DoubleDouble frac, pi_by_two;
+
+    /*  |x| = mant 2^expo with 1 <= mant < 2, so |x| = M 2^(expo - 52) where  *
+     *  M = mant 2^52 is an integer.                                          */
+    tmpl_Double_Base2_Mant_and_Exp(x, &mant, &expo);
+    expo -= 52;
+
+    /*  The 16-bit limbs of M, from the top down. M / 2^48 = 16 mant. The     *
+     *  subtractions and scalings by powers of two are all exact.             */
+    mant *= 16.0;
+
+    for (n = 4U; n > 0U; --n)
+    {
+        mant_limbs[n - 1U] = (unsigned long)mant;
+        mant = (mant - (double)mant_limbs[n - 1U]) * 65536.0;
+    }
+
+    /*  The window is the limbs t_k for first - 17 <= k <= first. This gives  *
+     *  bits = 16 first - expo fractional bits, with 270 <= bits < 286, and   *
+     *  the skipped limbs k < first - 17 satisfy expo - 16k >= 3. Limbs with  *
+     *  k < 1 are above the binary point of 2 / pi, and are zero. |x| is      *
+     *  at least 2^-53 here, so first is positive.                            */
+    first = (expo + 285) / 16;
+
+    for (n = 0U; n < TMPL_REM_PIO2_LIMBS; ++n)
+    {
+        const signed int k = first - (signed int)n;
+        window[n] = (k >= 1 ? (unsigned long)TMPL_TWO_BY_PI[k - 1] : 0UL);
+    }
+
+    /*  The exact product of M and the window, schoolbook style. Each limb    *
+     *  product plus the carries is less than 2^32.                           */
+    for (n = 0U; n < TMPL_REM_PIO2_LIMBS + 4U; ++n)
+        z[n] = 0UL;
+
+    for (j = 0U; j < 4U; ++j)
+    {
+        carry = 0UL;
+
+        for (n = 0U; n < TMPL_REM_PIO2_LIMBS; ++n)
+        {
+            prod = window[n] * mant_limbs[j] + z[n + j] + carry;
+            z[n + j] = prod & 0xFFFFUL;
+            carry = prod >> 16;
+        }
+
+        z[TMPL_REM_PIO2_LIMBS + j] = carry;
+    }
+
+    /*  The binary point is at bit number 16 first - expo of z.               */
+    bits = (unsigned int)(16 * first - expo);
+    ind = bits / 16U;
+    offset = bits % 16U;
+
+    /*  The two bits above the binary point are q mod 4.                      */
+    quadrant = (unsigned int)(((z[ind] >> offset) |
+                               (z[ind + 1U] << (16U - offset))) & 3UL);
+
+    /*  Keep only the fraction. The bits above the binary point are removed.  */
+    mask = (1UL << offset) - 1UL;
+    z[ind] &= mask;
+
+    /*  Round q to the nearest integer. If the fraction f is at least 1 / 2,  *
+     *  replace it with 1 - f, which is the magnitude of f - 1.               */
+    if (offset > 0U)
+        negative = (unsigned int)((z[ind] >> (offset - 1U)) & 1UL);
+    else
+        negative = (unsigned int)((z[ind - 1U] >> 15) & 1UL);
+
+    if (negative)
+    {
+        quadrant += 1U;
+        carry = 1UL;
+
+        /*  Two's complement of the fraction, 2^bits - f.                     */
+        for (n = 0U; n <= ind; ++n)
+        {
+            prod = ((~z[n]) & 0xFFFFUL) + carry;
+            z[n] = prod & 0xFFFFUL;
+            carry = prod >> 16;
+        }
+
+        z[ind] &= mask;
+    }
+
+    /*  Find the leading non-zero limb of the fraction.                       */
+    top = ind;
+
+    while (top > 0U && z[top] == 0UL)
+        --top;
+
+    /*  The leading 128 bits of the fraction, summed from the top down. Each  *
+     *  term is exact, and the sum is correct to double-double precision.     */
+    last = (top > 7U ? top - 7U : 0U);
+    scale = tmpl_Double_Pow2(16 * (signed int)top - (signed int)bits);
+    frac.dat[0] = 0.0;
+    frac.dat[1] = 0.0;
+
+    for (n = top + 1U; n > last; --n)
+    {
+        frac = tmpl_DoubleDouble_Add_Scalar((double)z[n - 1U] * scale, &frac);
+        scale *= 1.52587890625E-05;
+    }
+
+    /*  r = f pi / 2, with the sign of f - 1 if f was rounded up.             */
+    pi_by_two.dat[0] = TMPL_REM_PIO2_PI_BY_TWO_HI;
+    pi_by_two.dat[1] = TMPL_REM_PIO2_PI_BY_TWO_LO;
+    *r = tmpl_DoubleDouble_Multiply(&frac, &pi_by_two);
+
+    if (negative)
+    {
+        r->dat[0] = -r->dat[0];
+        r->dat[1] = -r->dat[1];
+    }
+
+    /*  For negative x, x = -q pi / 2 - r.                                    */
+    if (x < 0.0)
+    {
+        r->dat[0] = -r->dat[0];
+        r->dat[1] = -r->dat[1];
+        quadrant = 4U - (quadrant & 3U);
+    }
+
+    return quadrant & 3U;
+}
+/*  End of tmpl_DoubleDouble_Rem_Pio2_Kernel.                                 */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_REM_PIO2_LIMBS
+#undef TMPL_REM_PIO2_PI_BY_TWO_HI
+#undef TMPL_REM_PIO2_PI_BY_TWO_LO
+#undef TMPL_TWO_BY_PI
+
+#endif
+/*  End of include guard.                                                     */
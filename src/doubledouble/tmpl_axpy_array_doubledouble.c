@@ -0,0 +1,138 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                        tmpl_axpy_array_doubledouble                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes y = a x + y for arrays of double-doubles.                    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_DoubleDouble_Axpy_Array                                          *
+ *  Purpose:                                                                  *
+ *      Replaces y[n] with a * x[n] + y[n] for each n.                        *
+ *  Arguments:                                                                *
+ *      a (const tmpl_DoubleDouble * const):                                  *
+ *          The scale factor.                                                 *
+ *      x (const tmpl_DoubleDouble * const):                                  *
+ *          An array of double-doubles.                                       *
+ *      y (tmpl_DoubleDouble * const):                                        *
+ *          Another array of double-doubles, overwritten with the result.     *
+ *      len (size_t):                                                         *
+ *          The number of elements in x and y.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      src/doubledouble/auxiliary/tmpl_eft_kernels_double.h:                 *
+ *          tmpl_EFT_Double_Two_Sum:                                          *
+ *              Performs 2Sum, inlined.                                       *
+ *          tmpl_EFT_Double_Two_Prod:                                         *
+ *              Performs 2Prod, inlined.                                      *
+ *      src/doubledouble/auxiliary/tmpl_eft_fast_two_sum_double.h:            *
+ *          tmpl_EFT_Double_Fast_Two_Sum:                                     *
+ *              Performs Fast2Sum, inlined.                                   *
+ *  Method:                                                                   *
+ *      Each element is the product of tmpl_DoubleDouble_Multiply followed by *
+ *      the sum of tmpl_DoubleDouble_Add, with the same operations in the     *
+ *      same order. Those functions are compiled on their own, so calling     *
+ *      them costs two function calls per element, and the compiler cannot    *
+ *      overlap one element with the next. Here the error-free steps are      *
+ *      inlined, and since the elements are independent the processor runs    *
+ *      several of them at once. With OpenMP support, long arrays are split   *
+ *      across threads.                                                       *
+ *  Notes:                                                                    *
+ *      1.) The error bound is that of tmpl_DoubleDouble_Multiply followed    *
+ *          by tmpl_DoubleDouble_Add.                                         *
+ *                                                                            *
+ *      2.) If a, x, or y is NULL nothing is done. x may be the same array    *
+ *          as y.                                                             *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_doubledouble.h:                                                  *
+ *          Header file with the functions prototype.                         *
+ *  2.) tmpl_eft_kernels_double.h:                                            *
+ *          Inlined error-free transformations.                               *
+ *  3.) tmpl_eft_fast_two_sum_double.h:                                       *
+ *          Inlined Fast2Sum.                                                 *
+ *  4.) stddef.h:                                                             *
+ *          Standard library header with the size_t typedef.                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  size_t typedef is here.                                                   */
+#include <stddef.h>
+
+/*  Function prototype and double-double typedef given here.                  */
+#include <libtmpl/include/tmpl_doubledouble.h>
+
+/*  Inlined 2Sum and 2Prod found here.                                        */
+#include "auxiliary/tmpl_eft_kernels_double.h"
+
+/*  Inlined Fast2Sum found here.                                              */
+#include "auxiliary/tmpl_eft_fast_two_sum_double.h"
+
+/*  Function for computing a * x + y for arrays of double-doubles.            */
+void
+tmpl_DoubleDouble_Axpy_Array(const tmpl_DoubleDouble * const a,
+                             const tmpl_DoubleDouble * const x,
+                             tmpl_DoubleDouble * const y,
+                             size_t len)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    double a_hi, a_lo;
+    size_t n;
+
+    /*  Nothing can be done if there is nowhere to read from or write to.     */
+    if (!a || !x || !y)
+        return;
+
+    a_hi = a->dat[0];
+    a_lo = a->dat[1];
+
+    /*  The elements are independent, so they may be split across threads.    */
+#ifdef _OPENMP
+#pragma omp parallel for if(len >= TMPL_DOUBLEDOUBLE_PARALLEL_MIN_LENGTH)
+#endif
+    for (n = 0; n < len; ++n)
+    {
+        /*  Declare necessary variables. C89 requires this at the top.        */
+        double prod_hi, prod_err, prod_lo, comp;
+        double sum_hi, err_hi, sum_lo, err_lo, comp_hi, comp_lo;
+        const double x_hi = x[n].dat[0];
+        const double x_lo = x[n].dat[1];
+
+        /*  The product a * x[n], as in tmpl_DoubleDouble_Multiply.           */
+        tmpl_EFT_Double_Two_Prod(a_hi, x_hi, &prod_hi, &prod_err);
+        comp = prod_err + (a_hi * x_lo + a_lo * x_hi);
+        tmpl_EFT_Double_Fast_Two_Sum(prod_hi, comp, &prod_hi, &prod_lo);
+
+        /*  The sum a * x[n] + y[n], as in tmpl_DoubleDouble_Add.             */
+        tmpl_EFT_Double_Two_Sum(prod_hi, y[n].dat[0], &sum_hi, &err_hi);
+        tmpl_EFT_Double_Two_Sum(prod_lo, y[n].dat[1], &sum_lo, &err_lo);
+        tmpl_EFT_Double_Fast_Two_Sum(sum_hi, err_hi + sum_lo,
+                                     &comp_hi, &comp_lo);
+
+        tmpl_EFT_Double_Fast_Two_Sum(comp_hi, err_lo + comp_lo,
+                                     &y[n].dat[0], &y[n].dat[1]);
+    }
+}
+/*  End of tmpl_DoubleDouble_Axpy_Array.                                      */
@@ -0,0 +1,75 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                           tmpl_cos_doubledouble                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the cosine of a double-word real number.                     *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_DoubleDouble_Cos                                                 *
+ *  Purpose:                                                                  *
+ *      Evaluates cos(x) for a double-double x.                               *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DoubleDouble * const):                                  *
+ *          A double-double real number.                                      *
+ *  Output:                                                                   *
+ *      cos_x (tmpl_DoubleDouble):                                            *
+ *          The double-double cosine of x.                                    *
+ *  Called Functions:                                                         *
+ *      src/doubledouble/                                                     *
+ *          tmpl_DoubleDouble_SinCos:                                         *
+ *              Computes sin(x) and cos(x) simultaneously.                    *
+ *  Method:                                                                   *
+ *      The argument reduction produces both sin(r) and cos(r) for the reduced*
+ *      argument, so computing cos(x) costs the same as computing both.       *
+ *  Notes:                                                                    *
+ *      See tmpl_DoubleDouble_SinCos for accuracy and special cases.          *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_attributes.h:                                                    *
+ *          Provides (optional) C23 attributes for optimization.              *
+ *  2.) tmpl_doubledouble.h:                                                  *
+ *          Function prototype and double-double typedefs provided here.      *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Optional C23 attributes for optimization provided here.                   */
+#include <libtmpl/include/tmpl_attributes.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <libtmpl/include/tmpl_doubledouble.h>
+
+/*  Computes the cosine of a double-double.                                   */
+TMPL_PURE_FUNC
+tmpl_DoubleDouble tmpl_DoubleDouble_Cos(const tmpl_DoubleDouble * const x)
+TMPL_UNSEQUENCED
+{
+    /*  Both values come out of the reduction, sin(x) is discarded.           */
+    tmpl_DoubleDouble sin_x, cos_x;
+
+    /*  SinCos does all of the work.                                          */
+    tmpl_DoubleDouble_SinCos(x, &sin_x, &cos_x);
+    return cos_x;
+}
+/*  End of tmpl_DoubleDouble_Cos.                                             */
@@ -0,0 +1,232 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                          tmpl_divide_doubledouble                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Performs division for two double-word real numbers.                   *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_DoubleDouble_Divide                                              *
+ *  Purpose:                                                                  *
+ *      Evaluates the quotient of two double-doubles.                         *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DoubleDouble * const):                                  *
+ *          A double-double real number, the numerator.                       *
+ *      y (const tmpl_DoubleDouble * const):                                  *
+ *          Another double-double real number, the denominator.               *
+ *  Output:                                                                   *
+ *      quotient (tmpl_DoubleDouble):                                         *
+ *          The double-double quotient x / y.                                 *
+ *  Called Functions:                                                         *
+ *      src/doubledouble/                                                     *
+ *          tmpl_DoubleDouble_Multiply_Scalar:                                *
+ *              Multiplies a double-double by a double.                       *
+ *      src/math/                                                             *
+ *          tmpl_Double_Base2_Mant_and_Exp:                                   *
+ *              Computes the mantissa and exponent of a double.               *
+ *          tmpl_Double_Pow2:                                                 *
+ *              Computes 2^n for an integer n.                                *
+ *      src/two_sum/                                                          *
+ *          tmpl_Double_Fast_Two_Sum:                                         *
+ *              Performs Fast2Sum: (sum, error) = Fast2Sum(x, y).             *
+ *  Method:                                                                   *
+ *      We use algorithm 17 from Joldes et al. 2017. Start with the ordinary  *
+ *      quotient of the high words, and compute the remainder of x with       *
+ *      respect to this guess:                                                *
+ *                q_hi = xhi / yhi                                            *
+ *                   r = y * q_hi                                             *
+ *                   d = (xhi - rhi) + (xlo - rlo)                            *
+ *      The remainder d is tiny, so d / yhi is an accurate correction term:   *
+ *                q_lo = d / yhi                                              *
+ *          (out_hi, out_lo) = Fast2Sum(q_hi, q_lo)                           *
+ *      xhi - rhi is computed exactly since the two are very close.           *
+ *                                                                            *
+ *      The product y * q_hi uses Dekker splitting, which overflows if q_hi   *
+ *      or yhi is above about 2^996, or if the product is close to DBL_MAX.   *
+ *      Its error term also loses bits to underflow if the values are tiny.   *
+ *      If xhi, yhi, or q_hi is outside of 10^-270 to 10^299 in magnitude,    *
+ *      x and y are first scaled by powers of two to [1, 2), and the          *
+ *      quotient is scaled back by the difference of the exponents. All of    *
+ *      these scalings are exact, unless the quotient is itself subnormal.    *
+ *  Notes:                                                                    *
+ *      1.) The relative error is bounded by 15*eps^2 + 56*eps^3, where eps   *
+ *          is the epsilon value of double. For 64-bit double, this is about  *
+ *          2x10^-31. See theorem 7.4 in Joldes et al. 2017. This holds for   *
+ *          all finite x and non-zero finite y whose quotient is normal.      *
+ *                                                                            *
+ *      2.) Division by zero, infinities, and NaN follow the rules of the     *
+ *          high word division, with the low word also set to that value.     *
+ *          A quotient too large for a double is returned as infinity in      *
+ *          both words.                                                       *
+ *  References:                                                               *
+ *      1.) Joldes, M., Muller, J., Popescu, V. (October 2017).               *
+ *          Tight and rigorous error bounds for basic                         *
+ *          building blocks of double-word arithmetic.                        *
+ *          ACM Transactions on Mathematical Software, Vol. 44, No. 2.        *
+ *          Detailed description of double-double algorithms are provided     *
+ *          here. libtmpl uses many of the ideas from this paper in it's      *
+ *          implementation of double-double arithmetic.                       *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing the TMPL_ALWAYS_INLINE macro.               *
+ *  2.) tmpl_attributes.h:                                                    *
+ *          Provides (optional) C23 attributes for optimization.              *
+ *  3.) tmpl_math.h:                                                          *
+ *          Header file providing the mantissa, exponent, and powers of two.  *
+ *  4.) tmpl_two_sum.h:                                                       *
+ *          Provides 2Sum, Fast2Sum, and other 2Sum-like routines.            *
+ *  5.) tmpl_doubledouble.h:                                                  *
+ *          Function prototype and double-double typedefs provided here.      *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_ALWAYS_INLINE macro found here.                                      */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Optional C23 attributes for optimization provided here.                   */
+#include <libtmpl/include/tmpl_attributes.h>
+
+/*  tmpl_Double_Base2_Mant_and_Exp and tmpl_Double_Pow2 found here.           */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Fast2Sum is needed for the final renormalization.                         */
+#include <libtmpl/include/tmpl_two_sum.h>
+
+/*  Function prototype and tmpl_DoubleDouble_Multiply_Scalar found here.      */
+#include <libtmpl/include/tmpl_doubledouble.h>
+
+/*  Performs division for two double-doubles.                                 */
+TMPL_PURE_FUNC
+TMPL_ALWAYS_INLINE
+tmpl_DoubleDouble
+tmpl_DoubleDouble_Divide(const tmpl_DoubleDouble * const x,
+                         const tmpl_DoubleDouble * const y)
+TMPL_UNSEQUENCED
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_DoubleDouble num, den, rem, out;
+    double diff_hi, diff_lo, diff, quot_lo, abs_x, abs_y, abs_q, mant, scale;
+    signed int num_expo, den_expo, half_expo;
+
+    /*  The numerator and denominator used below, possibly scaled copies.     */
+    const tmpl_DoubleDouble *n = x;
+    const tmpl_DoubleDouble *d = y;
+
+    /*  The quotient is scaled by 2^expo at the end. It is 0 for most inputs. */
+    signed int expo = 0;
+
+    /*  The leading approximation, correct to double precision.               */
+    double quot_hi = x->dat[0] / y->dat[0];
+
+    /*  Special cases (division by zero, infinities, or NaN) give non-finite  *
+     *  values. The correction below would produce NaN, so return now.        */
+    if (quot_hi - quot_hi != 0.0)
+    {
+        out.dat[0] = quot_hi;
+        out.dat[1] = quot_hi;
+        return out;
+    }
+
+    abs_x = (x->dat[0] < 0.0 ? -x->dat[0] : x->dat[0]);
+    abs_y = (y->dat[0] < 0.0 ? -y->dat[0] : y->dat[0]);
+    abs_q = (quot_hi < 0.0 ? -quot_hi : quot_hi);
+
+    /*  The splitting in 2Prod overflows for large values, and its error term *
+     *  underflows for tiny ones. The sum is large if any of the terms is.    *
+     *  Zero x is also scaled, which is harmless since its exponent is zero.  */
+    if (abs_x + abs_y + abs_q > 1.0E+299 ||
+        abs_x < 1.0E-270 || abs_y < 1.0E-270 || abs_q < 1.0E-270)
+    {
+        num = *x;
+        den = *y;
+
+        tmpl_Double_Base2_Mant_and_Exp(x->dat[0], &mant, &num_expo);
+        tmpl_Double_Base2_Mant_and_Exp(y->dat[0], &mant, &den_expo);
+
+        /*  Scale both to [1, 2) in two steps, since 2^1074 overflows.        */
+        half_expo = num_expo / 2;
+        scale = tmpl_Double_Pow2(-half_expo);
+        num.dat[0] *= scale;
+        num.dat[1] *= scale;
+        scale = tmpl_Double_Pow2(half_expo - num_expo);
+        num.dat[0] *= scale;
+        num.dat[1] *= scale;
+
+        half_expo = den_expo / 2;
+        scale = tmpl_Double_Pow2(-half_expo);
+        den.dat[0] *= scale;
+        den.dat[1] *= scale;
+        scale = tmpl_Double_Pow2(half_expo - den_expo);
+        den.dat[0] *= scale;
+        den.dat[1] *= scale;
+
+        expo = num_expo - den_expo;
+        quot_hi = num.dat[0] / den.dat[0];
+        n = &num;
+        d = &den;
+    }
+
+    /*  den * quot_hi is very nearly num. Compute it to double-double         *
+     *  precision.                                                            */
+    rem = tmpl_DoubleDouble_Multiply_Scalar(quot_hi, d);
+
+    /*  The high words agree in their leading bits, so this is exact.         */
+    diff_hi = n->dat[0] - rem.dat[0];
+
+    /*  The rest of the remainder, num - den * quot_hi.                       */
+    diff_lo = n->dat[1] - rem.dat[1];
+    diff = diff_hi + diff_lo;
+
+    /*  The remainder is small, and double precision is enough to divide it.  */
+    quot_lo = diff / d->dat[0];
+
+    /*  quot_hi is much larger than the correction, so Fast2Sum suffices.     */
+    tmpl_Double_Fast_Two_Sum(quot_hi, quot_lo, &out.dat[0], &out.dat[1]);
+
+    if (expo)
+    {
+        /*  |quot_hi| is in (1/2, 2). Beyond 2^1100 the result is infinite    *
+         *  or zero either way, and the halves of the exponent stay in range. */
+        if (expo > 1100)
+            expo = 1100;
+        else if (expo < -1100)
+            expo = -1100;
+
+        half_expo = expo / 2;
+        scale = tmpl_Double_Pow2(half_expo);
+        out.dat[0] *= scale;
+        out.dat[1] *= scale;
+        scale = tmpl_Double_Pow2(expo - half_expo);
+        out.dat[0] *= scale;
+        out.dat[1] *= scale;
+
+        /*  An overflowing quotient is infinite in both words, as above.      */
+        if (out.dat[0] - out.dat[0] != 0.0)
+            out.dat[1] = out.dat[0];
+    }
+
+    return out;
+}
+/*  End of tmpl_DoubleDouble_Divide.                                          */
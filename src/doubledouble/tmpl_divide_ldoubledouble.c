@@ -0,0 +1,140 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                         tmpl_divide_ldoubledouble                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Performs division for two long double-word real numbers.              *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_LDoubleDouble_Divide                                             *
+ *  Purpose:                                                                  *
+ *      Evaluates the quotient of two long long double-doubles.               *
+ *  Arguments:                                                                *
+ *      x (const tmpl_LongDoubleDouble * const):                              *
+ *          A long double-double real number, the numerator.                  *
+ *      y (const tmpl_LongDoubleDouble * const):                              *
+ *          Another long double-double real number, the denominator.          *
+ *  Output:                                                                   *
+ *      quotient (tmpl_DoubleDouble):                                         *
+ *          The long double-double quotient x / y.                            *
+ *  Called Functions:                                                         *
+ *      src/doubledouble/                                                     *
+ *          tmpl_LDoubleDouble_Multiply_Scalar:                               *
+ *              Multiplies a long double-double by a double.                  *
+ *      src/two_sum/                                                          *
+ *          tmpl_LDouble_Fast_Two_Sum:                                        *
+ *              Performs Fast2Sum: (sum, error) = Fast2Sum(x, y).             *
+ *  Method:                                                                   *
+ *      We use algorithm 17 from Joldes et al. 2017. Start with the ordinary  *
+ *      quotient of the high words, and compute the remainder of x with       *
+ *      respect to this guess:                                                *
+ *                q_hi = xhi / yhi                                            *
+ *                   r = y * q_hi                                             *
+ *                   d = (xhi - rhi) + (xlo - rlo)                            *
+ *      The remainder d is tiny, so d / yhi is an accurate correction term:   *
+ *                q_lo = d / yhi                                              *
+ *          (out_hi, out_lo) = Fast2Sum(q_hi, q_lo)                           *
+ *      xhi - rhi is computed exactly since the two are very close.           *
+ *  Notes:                                                                    *
+ *      1.) The relative error is bounded by 15*eps^2 + 56*eps^3, where eps   *
+ *          is the epsilon value of long double. For 80-bit extended, this is *
+ *          about 4x10^-38. See theorem 7.4 in Joldes et al. 2017.            *
+ *                                                                            *
+ *      2.) Division by zero, infinities, and NaN follow the rules of the     *
+ *          high word division, with the low word also set to that value.     *
+ *  References:                                                               *
+ *      1.) Joldes, M., Muller, J., Popescu, V. (October 2017).               *
+ *          Tight and rigorous error bounds for basic                         *
+ *          building blocks of double-word arithmetic.                        *
+ *          ACM Transactions on Mathematical Software, Vol. 44, No. 2.        *
+ *          Detailed description of double-double algorithms are provided     *
+ *          here. libtmpl uses many of the ideas from this paper in it's      *
+ *          implementation of long double-double arithmetic.                  *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing the TMPL_ALWAYS_INLINE macro.               *
+ *  2.) tmpl_attributes.h:                                                    *
+ *          Provides (optional) C23 attributes for optimization.              *
+ *  3.) tmpl_two_sum.h:                                                       *
+ *          Provides 2Sum, Fast2Sum, and other 2Sum-like routines.            *
+ *  4.) tmpl_doubledouble.h:                                                  *
+ *          Function prototype and long double-double typedefs provided here. *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_ALWAYS_INLINE macro found here.                                      */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Optional C23 attributes for optimization provided here.                   */
+#include <libtmpl/include/tmpl_attributes.h>
+
+/*  Fast2Sum is needed for the final renormalization.                         */
+#include <libtmpl/include/tmpl_two_sum.h>
+
+/*  Function prototype and tmpl_LDoubleDouble_Multiply_Scalar found here.     */
+#include <libtmpl/include/tmpl_doubledouble.h>
+
+/*  Performs division for two long long double-doubles.                       */
+TMPL_PURE_FUNC
+TMPL_ALWAYS_INLINE
+tmpl_LongDoubleDouble
+tmpl_LDoubleDouble_Divide(const tmpl_LongDoubleDouble * const x,
+                          const tmpl_LongDoubleDouble * const y)
+TMPL_UNSEQUENCED
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_LongDoubleDouble rem, out;
+    long double diff_hi, diff_lo, diff, quot_lo;
+
+    /*  The leading approximation, correct to long double precision.          */
+    const long double quot_hi = x->dat[0] / y->dat[0];
+
+    /*  Special cases (division by zero, infinities, or NaN) give non-finite  *
+     *  values. The correction below would produce NaN, so return now.        */
+    if (quot_hi - quot_hi != 0.0L)
+    {
+        out.dat[0] = quot_hi;
+        out.dat[1] = quot_hi;
+        return out;
+    }
+
+    /*  y * quot_hi is very nearly x. Compute it to full precision.           */
+    rem = tmpl_LDoubleDouble_Multiply_Scalar(quot_hi, y);
+
+    /*  The high words agree in their leading bits, so this is exact.         */
+    diff_hi = x->dat[0] - rem.dat[0];
+
+    /*  The rest of the remainder, x - y * quot_hi.                           */
+    diff_lo = x->dat[1] - rem.dat[1];
+    diff = diff_hi + diff_lo;
+
+    /*  The remainder is small, so long double precision suffices here.       */
+    quot_lo = diff / y->dat[0];
+
+    /*  quot_hi is much larger than the correction, so Fast2Sum suffices.     */
+    tmpl_LDouble_Fast_Two_Sum(quot_hi, quot_lo, &out.dat[0], &out.dat[1]);
+    return out;
+}
+/*  End of tmpl_LDoubleDouble_Divide.                                         */
@@ -0,0 +1,171 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                           tmpl_dot2_array_double                           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes a dot product in twice the working precision.                *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Double_Dot2_Array                                                *
+ *  Purpose:                                                                  *
+ *      Computes sum x[n] y[n] with the compensated Dot2 algorithm.           *
+ *  Arguments:                                                                *
+ *      x (const double * const):                                             *
+ *          An array of real numbers.                                         *
+ *      y (const double * const):                                             *
+ *          Another array of real numbers.                                    *
+ *      len (size_t):                                                         *
+ *          The number of elements in x and y.                                *
+ *  Output:                                                                   *
+ *      dot (tmpl_DoubleDouble):                                              *
+ *          The dot product of x and y, as a double-double.                   *
+ *  Called Functions:                                                         *
+ *      src/doubledouble/auxiliary/tmpl_eft_kernels_double.h:                 *
+ *          tmpl_EFT_Double_Two_Sum:                                          *
+ *              Performs 2Sum, inlined.                                       *
+ *          tmpl_EFT_Double_Two_Prod:                                         *
+ *              Performs 2Prod, inlined.                                      *
+ *  Method:                                                                   *
+ *      Ogita, Rump, and Oishi's Dot2. Each product is split exactly into     *
+ *      h + r with 2Prod. h is added to the running sum p with 2Sum, and the  *
+ *      rounding errors of both steps are collected in a plain double s:      *
+ *                                                                            *
+ *          (h, r) = 2Prod(x[n], y[n])                                        *
+ *          (p, q) = 2Sum(p, h)                                               *
+ *               s = s + (q + r)                                              *
+ *                                                                            *
+ *      The 2Sum on p is a chain of six dependent additions per element, so   *
+ *      a single chain runs at the latency of the adder. We instead keep      *
+ *      TMPL_DOT2_ARRAY_LANES independent (p, s) pairs, element n going to    *
+ *      lane n mod TMPL_DOT2_ARRAY_LANES, and merge the lanes with 2Sum at    *
+ *      the end. The final p + s is normalized with 2Sum.                     *
+ *  Notes:                                                                    *
+ *      1.) The result is as accurate as if the dot product was computed in   *
+ *          twice the working precision, and then rounded to a double-double  *
+ *          whose low word is itself a rounded correction. That is, the       *
+ *          relative error is about u + cond * u^2, u = 2^-53, where cond is  *
+ *          the condition number of the dot product.                          *
+ *                                                                            *
+ *      2.) The result does not depend on threads, or on the compiler, since  *
+ *          the order of the operations is fixed.                             *
+ *                                                                            *
+ *      3.) If x or y is NULL, or len is zero, zero is returned.              *
+ *                                                                            *
+ *      4.) 2Prod uses Dekker's splitting, so products of elements larger     *
+ *          than about 2^996 in magnitude overflow.                           *
+ *  References:                                                               *
+ *      1.) Ogita, T., Rump, S., Oishi, S. (2005).                            *
+ *          Accurate Sum and Dot Product.                                     *
+ *          SIAM Journal on Scientific Computing, Vol. 26, No. 6.             *
+ *                                                                            *
+ *          Original description and error analysis of Dot2.                  *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_doubledouble.h:                                                  *
+ *          Header file with the functions prototype.                         *
+ *  2.) tmpl_eft_kernels_double.h:                                            *
+ *          Inlined error-free transformations.                               *
+ *  3.) stddef.h:                                                             *
+ *          Standard library header with the size_t typedef.                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  size_t typedef is here.                                                   */
+#include <stddef.h>
+
+/*  Function prototype and double-double typedef given here.                  */
+#include <libtmpl/include/tmpl_doubledouble.h>
+
+/*  Inlined 2Sum and 2Prod found here.                                        */
+#include "auxiliary/tmpl_eft_kernels_double.h"
+
+/*  Number of independent summation chains.                                   */
+#define TMPL_DOT2_ARRAY_LANES (4)
+
+/*  Function for computing a compensated dot product.                         */
+tmpl_DoubleDouble
+tmpl_Double_Dot2_Array(const double * const x,
+                       const double * const y,
+                       size_t len)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    double sum[TMPL_DOT2_ARRAY_LANES], err[TMPL_DOT2_ARRAY_LANES];
+    double prod, prod_err, sum_err;
+    size_t n, lane;
+    tmpl_DoubleDouble dot;
+
+    const size_t end = (len / TMPL_DOT2_ARRAY_LANES) * TMPL_DOT2_ARRAY_LANES;
+
+    /*  Treat NULL pointers as empty arrays, the dot product is then zero.    */
+    if (!x || !y)
+    {
+        dot.dat[0] = 0.0;
+        dot.dat[1] = 0.0;
+        return dot;
+    }
+
+    for (lane = 0; lane < TMPL_DOT2_ARRAY_LANES; ++lane)
+    {
+        sum[lane] = 0.0;
+        err[lane] = 0.0;
+    }
+
+    /*  The main loop, one step of Dot2 for each of the lanes.                */
+    for (n = 0; n < end; n += TMPL_DOT2_ARRAY_LANES)
+    {
+        for (lane = 0; lane < TMPL_DOT2_ARRAY_LANES; ++lane)
+        {
+            tmpl_EFT_Double_Two_Prod(x[n + lane], y[n + lane],
+                                     &prod, &prod_err);
+
+            tmpl_EFT_Double_Two_Sum(sum[lane], prod, &sum[lane], &sum_err);
+            err[lane] += sum_err + prod_err;
+        }
+    }
+
+    /*  The elements that do not fill a block go to the first lane.           */
+    for (n = end; n < len; ++n)
+    {
+        tmpl_EFT_Double_Two_Prod(x[n], y[n], &prod, &prod_err);
+        tmpl_EFT_Double_Two_Sum(sum[0], prod, &sum[0], &sum_err);
+        err[0] += sum_err + prod_err;
+    }
+
+    /*  Merge the lanes. This is more of Dot2, with the products replaced by  *
+     *  the lane sums, so the error analysis is unchanged.                    */
+    for (lane = 1; lane < TMPL_DOT2_ARRAY_LANES; ++lane)
+    {
+        tmpl_EFT_Double_Two_Sum(sum[0], sum[lane], &sum[0], &sum_err);
+        err[0] += sum_err + err[lane];
+    }
+
+    /*  Normalize the output. After heavy cancellation |err| may exceed |sum| *
+     *  so Fast2Sum is not safe here, use 2Sum.                               */
+    tmpl_EFT_Double_Two_Sum(sum[0], err[0], &dot.dat[0], &dot.dat[1]);
+    return dot;
+}
+/*  End of tmpl_Double_Dot2_Array.                                            */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_DOT2_ARRAY_LANES
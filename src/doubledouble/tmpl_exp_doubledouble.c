@@ -0,0 +1,192 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                           tmpl_exp_doubledouble                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the exponential of a double-word real number.                *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_DoubleDouble_Exp                                                 *
+ *  Purpose:                                                                  *
+ *      Evaluates exp(x) for a double-double x.                               *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DoubleDouble * const):                                  *
+ *          A double-double real number.                                      *
+ *  Output:                                                                   *
+ *      exp_x (tmpl_DoubleDouble):                                            *
+ *          The double-double exponential of x.                               *
+ *  Called Functions:                                                         *
+ *      src/doubledouble/                                                     *
+ *          tmpl_DoubleDouble_Add:                                            *
+ *              Adds two double-doubles.                                      *
+ *          tmpl_DoubleDouble_Add_Scalar:                                     *
+ *              Adds a double to a double-double.                             *
+ *      src/doubledouble/auxiliary/                                           *
+ *          tmpl_DoubleDouble_Expm1_Kernel:                                   *
+ *              Computes exp(r) - 1 for |r| <= log(2) / 2.                    *
+ *      src/math/                                                             *
+ *          tmpl_Double_Floor:                                                *
+ *              Computes the floor of a double.                               *
+ *          tmpl_Double_Pow2:                                                 *
+ *              Computes 2^n for an integer n.                                *
+ *      src/two_prod/                                                         *
+ *          tmpl_Double_Two_Prod:                                             *
+ *              Performs 2Prod: (prod, error) = 2Prod(x, y).                  *
+ *  Method:                                                                   *
+ *      Write x = k log(2) + r with k an integer and |r| <= log(2) / 2. Then: *
+ *          exp(x) = 2^k exp(r) = 2^k (1 + expm1(r))                          *
+ *      log(2) is stored as the sum of three doubles L0 + L1 + L2. k has at   *
+ *      most 11 bits, so k L0 and k L1 are computed exactly with 2Prod, and   *
+ *      k L2 is far below the precision of r. This gives r to double-double   *
+ *      precision, even though x - k log(2) cancels most of the bits of x.    *
+ *      expm1(r) is computed by the kernel, and the power of two is applied   *
+ *      in two halves so that 2^k does not overflow before the product does.  *
+ *  Notes:                                                                    *
+ *      1.) The relative error is a small multiple of eps^2, where eps is the *
+ *          epsilon value of double.                                          *
+ *                                                                            *
+ *      2.) Large inputs overflow to infinity, very negative inputs return    *
+ *          zero, and NaN returns NaN. Results in the subnormal range lose    *
+ *          the bits of the low word that fall below the smallest subnormal.  *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing the TMPL_ALWAYS_INLINE macro.               *
+ *  2.) tmpl_attributes.h:                                                    *
+ *          Provides (optional) C23 attributes for optimization.              *
+ *  3.) tmpl_math.h:                                                          *
+ *          Header file providing floor, Pow2, and infinity.                  *
+ *  4.) tmpl_two_prod.h:                                                      *
+ *          Provides the 2Prod function.                                      *
+ *  5.) tmpl_doubledouble.h:                                                  *
+ *          Function prototype and double-double typedefs provided here.      *
+ *  6.) tmpl_expm1_kernel_doubledouble.h:                                     *
+ *          Computes exp(r) - 1 for small r.                                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_ALWAYS_INLINE macro found here.                                      */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Optional C23 attributes for optimization provided here.                   */
+#include <libtmpl/include/tmpl_attributes.h>
+
+/*  tmpl_Double_Floor, tmpl_Double_Pow2, and TMPL_INFINITY found here.        */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  2Prod is needed for the argument reduction.                               */
+#include <libtmpl/include/tmpl_two_prod.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <libtmpl/include/tmpl_doubledouble.h>
+
+/*  tmpl_DoubleDouble_Expm1_Kernel provided here.                             */
+#include "auxiliary/tmpl_expm1_kernel_doubledouble.h"
+
+/*  log(2) split into three doubles, and 1 / log(2).                          */
+#define LN_2_0 (+6.931471805599452862267639829952E-01)
+#define LN_2_1 (+2.319046813846299558417771079713E-17)
+#define LN_2_2 (+5.707708438416212065777028267848E-34)
+#define RCPR_LN_2 (+1.442695040888963407359924681002E+00)
+
+/*  exp(x) overflows above this value, and underflows to zero below MIN_ARG.  */
+#define MAX_ARG (+7.097827128933840E+02)
+#define MIN_ARG (-7.451332191019412E+02)
+
+/*  Computes the exponential of a double-double.                              */
+TMPL_PURE_FUNC
+TMPL_ALWAYS_INLINE
+tmpl_DoubleDouble
+tmpl_DoubleDouble_Exp(const tmpl_DoubleDouble * const x)
+TMPL_UNSEQUENCED
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_DoubleDouble red, prod, expm1_r, out;
+    double k, scale;
+    signed int expo, half_expo;
+
+    /*  NaN is returned as is.                                                */
+    if (x->dat[0] != x->dat[0])
+    {
+        out.dat[0] = x->dat[0];
+        out.dat[1] = x->dat[0];
+        return out;
+    }
+
+    /*  Overflow, return infinity.                                            */
+    if (x->dat[0] > MAX_ARG)
+    {
+        out.dat[0] = TMPL_INFINITY;
+        out.dat[1] = 0.0;
+        return out;
+    }
+
+    /*  Underflow, return zero.                                               */
+    if (x->dat[0] < MIN_ARG)
+    {
+        out.dat[0] = 0.0;
+        out.dat[1] = 0.0;
+        return out;
+    }
+
+    /*  The nearest integer to x / log(2). |k| <= 1075, so this is exact.     */
+    k = tmpl_Double_Floor(x->dat[0] * RCPR_LN_2 + 0.5);
+
+    /*  r = x - k L0. k L0 is computed exactly.                               */
+    tmpl_Double_Two_Prod(-k, LN_2_0, &prod.dat[0], &prod.dat[1]);
+    red = tmpl_DoubleDouble_Add(x, &prod);
+
+    /*  r = r - k L1, again with k L1 computed exactly.                       */
+    tmpl_Double_Two_Prod(-k, LN_2_1, &prod.dat[0], &prod.dat[1]);
+    red = tmpl_DoubleDouble_Add(&red, &prod);
+
+    /*  The last term only affects the lowest bits of the low word.           */
+    red = tmpl_DoubleDouble_Add_Scalar(-k * LN_2_2, &red);
+
+    /*  exp(r) = 1 + expm1(r), with |r| <= log(2) / 2.                        */
+    expm1_r = tmpl_DoubleDouble_Expm1_Kernel(&red);
+    out = tmpl_DoubleDouble_Add_Scalar(1.0, &expm1_r);
+
+    /*  Multiply by 2^k in two steps. 2^1024 overflows, but exp(x) may not.   */
+    expo = (signed int)k;
+    half_expo = expo / 2;
+
+    scale = tmpl_Double_Pow2(half_expo);
+    out.dat[0] *= scale;
+    out.dat[1] *= scale;
+
+    scale = tmpl_Double_Pow2(expo - half_expo);
+    out.dat[0] *= scale;
+    out.dat[1] *= scale;
+    return out;
+}
+/*  End of tmpl_DoubleDouble_Exp.                                             */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef LN_2_0
+#undef LN_2_1
+#undef LN_2_2
+#undef RCPR_LN_2
+#undef MAX_ARG
+#undef MIN_ARG
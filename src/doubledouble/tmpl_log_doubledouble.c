@@ -0,0 +1,201 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                           tmpl_log_doubledouble                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the natural logarithm of a double-word real number.          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_DoubleDouble_Log                                                 *
+ *  Purpose:                                                                  *
+ *      Evaluates log(x) for a double-double x.                               *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DoubleDouble * const):                                  *
+ *          A double-double real number.                                      *
+ *  Output:                                                                   *
+ *      log_x (tmpl_DoubleDouble):                                            *
+ *          The double-double natural logarithm of x.                         *
+ *  Called Functions:                                                         *
+ *      src/doubledouble/                                                     *
+ *          tmpl_DoubleDouble_Add:                                            *
+ *              Adds two double-doubles.                                      *
+ *          tmpl_DoubleDouble_Add_Scalar:                                     *
+ *              Adds a double to a double-double.                             *
+ *          tmpl_DoubleDouble_Multiply:                                       *
+ *              Multiplies two double-doubles.                                *
+ *      src/doubledouble/auxiliary/                                           *
+ *          tmpl_DoubleDouble_Expm1_Kernel:                                   *
+ *              Computes exp(r) - 1 for |r| <= log(2) / 2.                    *
+ *      src/math/                                                             *
+ *          tmpl_Double_Base2_Mant_and_Exp:                                   *
+ *              Splits a double into its mantissa and exponent.               *
+ *          tmpl_Double_Log:                                                  *
+ *              Computes log(x) at double precision.                          *
+ *          tmpl_Double_Pow2:                                                 *
+ *              Computes 2^n for an integer n.                                *
+ *      src/two_prod/                                                         *
+ *          tmpl_Double_Two_Prod:                                             *
+ *              Performs 2Prod: (prod, error) = 2Prod(x, y).                  *
+ *  Method:                                                                   *
+ *      Write x = 2^e m with e an integer and 1 / sqrt(2) <= m < sqrt(2),     *
+ *      using the exponent of the high word. Scaling by 2^-e is exact, and    *
+ *      log(x) = e log(2) + log(m). log(2) is stored as L0 + L1, and e has    *
+ *      at most 11 bits, so e L0 is computed exactly with 2Prod.              *
+ *                                                                            *
+ *      For log(m), start with y = log(mhi), which is correct to double       *
+ *      precision, and perform one Newton step for f(y) = exp(y) - m.         *
+ *      Writing d = m exp(-y) - 1, we have log(m) = y + log(1 + d), and d is  *
+ *      about the size of the rounding error in y. Hence:                     *
+ *          log(m) ~= y + d - d^2 / 2                                         *
+ *      d^3 is negligible. Since |y| <= log(2) / 2, d is computed as          *
+ *      d = (m - 1) + m expm1(-y), which avoids the cancellation in           *
+ *      m exp(-y) - 1 when m is close to 1.                                   *
+ *  Notes:                                                                    *
+ *      1.) The relative error is a small multiple of eps^2, where eps is the *
+ *          epsilon value of double. This holds for all positive x, including *
+ *          very large and subnormal values.                                  *
+ *                                                                            *
+ *      2.) log(0) returns -infinity, log of a negative number or NaN         *
+ *          returns NaN, and log(infinity) returns infinity. For these values *
+ *          both words of the output are set to the same value.               *
+ *  References:                                                               *
+ *      1.) Hida, Y., Li, X., Bailey, D. (May 2008).                          *
+ *          Library for Double-Double and Quad-Double Arithmetic.             *
+ *          The Newton step used here follows the QD library.                 *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing the TMPL_ALWAYS_INLINE macro.               *
+ *  2.) tmpl_attributes.h:                                                    *
+ *          Provides (optional) C23 attributes for optimization.              *
+ *  3.) tmpl_math.h:                                                          *
+ *          Header file providing tmpl_Double_Log and tmpl_Double_Pow2.       *
+ *  4.) tmpl_two_prod.h:                                                      *
+ *          Provides the 2Prod function.                                      *
+ *  5.) tmpl_doubledouble.h:                                                  *
+ *          Function prototype and double-double typedefs provided here.      *
+ *  6.) tmpl_expm1_kernel_doubledouble.h:                                     *
+ *          Computes exp(r) - 1 for small r.                                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_ALWAYS_INLINE macro found here.                                      */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Optional C23 attributes for optimization provided here.                   */
+#include <libtmpl/include/tmpl_attributes.h>
+
+/*  tmpl_Double_Log, tmpl_Double_Pow2, and the mantissa split found here.     */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  2Prod is needed for e log(2).                                             */
+#include <libtmpl/include/tmpl_two_prod.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <libtmpl/include/tmpl_doubledouble.h>
+
+/*  tmpl_DoubleDouble_Expm1_Kernel provided here.                             */
+#include "auxiliary/tmpl_expm1_kernel_doubledouble.h"
+
+/*  log(2) split into two doubles, L0 + L1.                                   */
+#define LN_2_0 (+6.931471805599452862267639829952E-01)
+#define LN_2_1 (+2.319046813846299558417771079713E-17)
+
+/*  The mantissa is reduced to [1 / sqrt(2), sqrt(2)).                        */
+#define SQRT_2 (+1.414213562373095048801688724209698E+00)
+
+/*  Computes the natural logarithm of a double-double.                        */
+TMPL_PURE_FUNC
+TMPL_ALWAYS_INLINE
+tmpl_DoubleDouble
+tmpl_DoubleDouble_Log(const tmpl_DoubleDouble * const x)
+TMPL_UNSEQUENCED
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_DoubleDouble m, neg_y, expm1_neg_y, diff, prod, out;
+    double y, mant, scale, half_square;
+    signed int expo, half_expo;
+
+    /*  Zero, negative numbers, NaN, and infinity. The Newton step would      *
+     *  give NaN for these, so return the double precision result.            */
+    if (!(x->dat[0] > 0.0) || x->dat[0] - x->dat[0] != 0.0)
+    {
+        out.dat[0] = tmpl_Double_Log(x->dat[0]);
+        out.dat[1] = out.dat[0];
+        return out;
+    }
+
+    /*  x = 2^expo m with 1 / sqrt(2) <= m < sqrt(2). mant is in [1, 2).      */
+    tmpl_Double_Base2_Mant_and_Exp(x->dat[0], &mant, &expo);
+
+    if (mant >= SQRT_2)
+        ++expo;
+
+    /*  Scale by 2^-expo in two steps, since 2^1074 overflows. Both factors   *
+     *  are powers of two, so m is computed exactly.                          */
+    half_expo = expo / 2;
+
+    scale = tmpl_Double_Pow2(-half_expo);
+    m.dat[0] = x->dat[0] * scale;
+    m.dat[1] = x->dat[1] * scale;
+
+    scale = tmpl_Double_Pow2(half_expo - expo);
+    m.dat[0] *= scale;
+    m.dat[1] *= scale;
+
+    /*  The logarithm of the high word, correct to double precision.          */
+    y = tmpl_Double_Log(m.dat[0]);
+    neg_y.dat[0] = -y;
+    neg_y.dat[1] = 0.0;
+
+    /*  |y| <= log(2) / 2, so compute d = (m - 1) + m expm1(-y). Both terms   *
+     *  are found with small relative error and their sum is tiny next to y.  */
+    expm1_neg_y = tmpl_DoubleDouble_Expm1_Kernel(&neg_y);
+    prod = tmpl_DoubleDouble_Multiply(&m, &expm1_neg_y);
+    diff = tmpl_DoubleDouble_Add_Scalar(-1.0, &m);
+    diff = tmpl_DoubleDouble_Add(&diff, &prod);
+
+    /*  log(1 + d) = d - d^2 / 2 + O(d^3), and d^3 is negligible.             */
+    half_square = 0.5 * diff.dat[0] * diff.dat[0];
+    diff = tmpl_DoubleDouble_Add_Scalar(-half_square, &diff);
+
+    /*  y is much larger than the correction d.                               */
+    out = tmpl_DoubleDouble_Add_Scalar(y, &diff);
+
+    if (expo == 0)
+        return out;
+
+    /*  e log(2) = e L0 + e L1, with e L0 computed exactly.                   */
+    tmpl_Double_Two_Prod((double)expo, LN_2_0, &prod.dat[0], &prod.dat[1]);
+    prod = tmpl_DoubleDouble_Add_Scalar((double)expo * LN_2_1, &prod);
+
+    /*  |log(m)| <= |e log(2)| / 2, so at most one bit cancels in the sum.    */
+    return tmpl_DoubleDouble_Add(&prod, &out);
+}
+/*  End of tmpl_DoubleDouble_Log.                                             */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef LN_2_0
+#undef LN_2_1
+#undef SQRT_2
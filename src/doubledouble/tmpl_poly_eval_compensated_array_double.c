@@ -0,0 +1,209 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                  tmpl_poly_eval_compensated_array_double                   *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Evaluates a polynomial at every element of an array, accurately.      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Double_Poly_Eval_Compensated_Array                               *
+ *  Purpose:                                                                  *
+ *      Evaluates a polynomial at many real numbers with compensated Horner.  *
+ *  Arguments:                                                                *
+ *      coeffs (const double * const):                                        *
+ *          The coefficients array for the polynomial.                        *
+ *      degree (size_t):                                                      *
+ *          The degree of the polynomial. There must be at least degree + 1   *
+ *          elements in the coeffs array.                                     *
+ *      x (const double * const):                                             *
+ *          The points where the polynomial is evaluated.                     *
+ *      y (double * const):                                                   *
+ *          The values of the polynomial at the points x.                     *
+ *      len (size_t):                                                         *
+ *          The number of elements in x and y.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      src/doubledouble/auxiliary/tmpl_eft_kernels_double.h:                 *
+ *          tmpl_EFT_Double_Two_Sum:                                          *
+ *              Performs 2Sum, inlined.                                       *
+ *          tmpl_EFT_Double_Two_Prod:                                         *
+ *              Performs 2Prod, inlined.                                      *
+ *  Method:                                                                   *
+ *      Graillat, Langlois, and Louvet's compensated Horner scheme. Each step *
+ *      of Horner's method is split exactly with 2Prod and 2Sum, and the      *
+ *      rounding errors are run through a second Horner scheme in double:     *
+ *                                                                            *
+ *          (p, pi) = 2Prod(r, x)                                             *
+ *       (r, sigma) = 2Sum(p, a[k])                                           *
+ *                c = c * x + (pi + sigma)                                    *
+ *                                                                            *
+ *      starting with r = a[degree] and c = 0. The output is r + c. As in     *
+ *      tmpl_Double_Poly_Eval_Array, TMPL_COMPENSATED_HORNER_LANES points are *
+ *      evaluated at once, sharing each coefficient load, so the long         *
+ *      dependency chain of one step is overlapped with the others. With      *
+ *      OpenMP support, long arrays are split across threads.                 *
+ *  Notes:                                                                    *
+ *      1.) The result is as accurate as if Horner's method was done in twice *
+ *          the working precision, and then rounded to double. The relative   *
+ *          error is about u + cond * u^2, u = 2^-53, where cond is the       *
+ *          condition number of the polynomial at x.                          *
+ *                                                                            *
+ *      2.) If x or y is NULL nothing is done. If coeffs is NULL, the         *
+ *          polynomial is treated as zero. y may be the same array as x.      *
+ *                                                                            *
+ *      3.) 2Prod uses Dekker's splitting, so intermediate values larger than *
+ *          about 2^996 in magnitude overflow.                                *
+ *  References:                                                               *
+ *      1.) Graillat, S., Langlois, P., Louvet, N. (2009).                    *
+ *          Algorithms for accurate, validated and fast polynomial            *
+ *          evaluation.                                                       *
+ *          Japan Journal of Industrial and Applied Mathematics, Vol. 26.     *
+ *                                                                            *
+ *          Description and error analysis of compensated Horner.             *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_doubledouble.h:                                                  *
+ *          Header file with the functions prototype.                         *
+ *  2.) tmpl_math.h:                                                          *
+ *          Provides TMPL_POLY_EVAL_PARALLEL_MIN_LENGTH.                      *
+ *  3.) tmpl_eft_kernels_double.h:                                            *
+ *          Inlined error-free transformations.                               *
+ *  4.) stddef.h:                                                             *
+ *          Standard library header with the size_t typedef.                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  size_t typedef is here.                                                   */
+#include <stddef.h>
+
+/*  Function prototype given here.                                            */
+#include <libtmpl/include/tmpl_doubledouble.h>
+
+/*  TMPL_POLY_EVAL_PARALLEL_MIN_LENGTH provided here.                         */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Inlined 2Sum and 2Prod found here.                                        */
+#include "auxiliary/tmpl_eft_kernels_double.h"
+
+/*  Number of compensated Horner chains that are run at the same time.        */
+#define TMPL_COMPENSATED_HORNER_LANES (4)
+
+/*  Compensated Horner's method for a single point.                           */
+static double
+tmpl_double_poly_eval_compensated(const double * const coeffs,
+                                  size_t degree,
+                                  double x)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    double poly = coeffs[degree];
+    double comp = 0.0;
+    double prod, prod_err, sum_err;
+    size_t k;
+
+    for (k = degree; k > 0; --k)
+    {
+        tmpl_EFT_Double_Two_Prod(poly, x, &prod, &prod_err);
+        tmpl_EFT_Double_Two_Sum(prod, coeffs[k - 1], &poly, &sum_err);
+        comp = comp * x + (prod_err + sum_err);
+    }
+
+    return poly + comp;
+}
+/*  End of tmpl_double_poly_eval_compensated.                                 */
+
+/*  Function for accurately evaluating a polynomial at many points.           */
+void
+tmpl_Double_Poly_Eval_Compensated_Array(const double * const coeffs,
+                                        size_t degree,
+                                        const double * const x,
+                                        double * const y,
+                                        size_t len)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    size_t n, block;
+    const size_t blocks = len / TMPL_COMPENSATED_HORNER_LANES;
+
+    /*  Nothing can be done if there is nowhere to read from or write to.     */
+    if (!x || !y)
+        return;
+
+    /*  A NULL coefficient array is treated as the zero polynomial.           */
+    if (!coeffs)
+    {
+        for (n = 0; n < len; ++n)
+            y[n] = 0.0;
+
+        return;
+    }
+
+    /*  Evaluate the polynomial at several points at once.                    */
+#ifdef _OPENMP
+#pragma omp parallel for if(len >= TMPL_POLY_EVAL_PARALLEL_MIN_LENGTH)
+#endif
+    for (block = 0; block < blocks; ++block)
+    {
+        /*  Declare necessary variables. C89 requires this at the top.        */
+        double point[TMPL_COMPENSATED_HORNER_LANES];
+        double poly[TMPL_COMPENSATED_HORNER_LANES];
+        double comp[TMPL_COMPENSATED_HORNER_LANES];
+        const size_t start = block * TMPL_COMPENSATED_HORNER_LANES;
+        double prod, prod_err, sum_err;
+        size_t k, lane;
+
+        /*  Copy the points first. This allows y to be the same array as x.   */
+        for (lane = 0; lane < TMPL_COMPENSATED_HORNER_LANES; ++lane)
+        {
+            point[lane] = x[start + lane];
+            poly[lane] = coeffs[degree];
+            comp[lane] = 0.0;
+        }
+
+        /*  Compensated Horner, with one independent chain for each lane.     */
+        for (k = degree; k > 0; --k)
+        {
+            const double c = coeffs[k - 1];
+
+            for (lane = 0; lane < TMPL_COMPENSATED_HORNER_LANES; ++lane)
+            {
+                tmpl_EFT_Double_Two_Prod(poly[lane], point[lane],
+                                         &prod, &prod_err);
+
+                tmpl_EFT_Double_Two_Sum(prod, c, &poly[lane], &sum_err);
+                comp[lane] = comp[lane] * point[lane] + (prod_err + sum_err);
+            }
+        }
+
+        for (lane = 0; lane < TMPL_COMPENSATED_HORNER_LANES; ++lane)
+            y[start + lane] = poly[lane] + comp[lane];
+    }
+
+    /*  Handle the points that do not fill a block.                           */
+    for (n = blocks * TMPL_COMPENSATED_HORNER_LANES; n < len; ++n)
+        y[n] = tmpl_double_poly_eval_compensated(coeffs, degree, x[n]);
+}
+/*  End of tmpl_Double_Poly_Eval_Compensated_Array.                           */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_COMPENSATED_HORNER_LANES
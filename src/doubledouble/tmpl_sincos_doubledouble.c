@@ -0,0 +1,342 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                          tmpl_sincos_doubledouble                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes sine and cosine of a double-word real number.                *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_DoubleDouble_SinCos                                              *
+ *  Purpose:                                                                  *
+ *      Evaluates sin(x) and cos(x) simultaneously for a double-double x.     *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DoubleDouble * const):                                  *
+ *          A double-double real number.                                      *
+ *      sin_x (tmpl_DoubleDouble * const):                                    *
+ *          The double-double sine of x is stored here.                       *
+ *      cos_x (tmpl_DoubleDouble * const):                                    *
+ *          The double-double cosine of x is stored here.                     *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      src/doubledouble/                                                     *
+ *          tmpl_DoubleDouble_Add:                                            *
+ *              Adds two double-doubles.                                      *
+ *          tmpl_DoubleDouble_Add_Scalar:                                     *
+ *              Adds a double to a double-double.                             *
+ *          tmpl_DoubleDouble_Multiply:                                       *
+ *              Multiplies two double-doubles.                                *
+ *          tmpl_DoubleDouble_Quick_Add:                                      *
+ *              Adds two double-doubles, the first much larger.               *
+ *          tmpl_DoubleDouble_Sqrt:                                           *
+ *              Computes the square root of a double-double.                  *
+ *      src/doubledouble/auxiliary/                                           *
+ *          tmpl_DoubleDouble_Rem_Pio2_Kernel:                                *
+ *              Payne-Hanek reduction of a double modulo pi / 2.              *
+ *      src/math/                                                             *
+ *          tmpl_Double_Abs:                                                  *
+ *              Computes the absolute value of a double.                      *
+ *          tmpl_Double_Floor:                                                *
+ *              Computes the floor of a double.                               *
+ *      src/two_prod/                                                         *
+ *          tmpl_Double_Two_Prod:                                             *
+ *              Performs 2Prod: (prod, error) = 2Prod(x, y).                  *
+ *  Method:                                                                   *
+ *      Reduce in two steps. First write x = q pi / 2 + r with q an integer   *
+ *      and |r| <= pi / 4. pi / 2 is stored as the sum of three doubles,      *
+ *      P0 + P1 + P2, and q P0 and q P1 are computed exactly with 2Prod, so r *
+ *      is accurate even when most of the bits of x cancel. For |x| >= 2^30   *
+ *      the high and low words are each reduced with Payne-Hanek reduction,   *
+ *      and the two remainders are added and brought back to [-pi/4, pi/4].   *
+ *      Next write                                                            *
+ *      r = k pi / 16 + t with |k| <= 4 and |t| <= pi / 32. sin(t) is summed  *
+ *      from its Maclaurin series to the t^17 term, and cos(t) is computed    *
+ *      as sqrt(1 - sin(t)^2), which is well conditioned for small t. The     *
+ *      angle sum formulas with tabulated values of sin(k pi / 16) and        *
+ *      cos(k pi / 16) give sin(r) and cos(r), and q mod 4 selects the signs  *
+ *      and order of the output.                                              *
+ *  Notes:                                                                    *
+ *      1.) For |x| < 2^30 the reduction has an absolute error of about       *
+ *          2^-160 |x|. The relative error is a small multiple of eps^2,      *
+ *          where eps is the epsilon value of double, unless the reduced      *
+ *          argument is below 2^-54 |x|. This only happens for x very close   *
+ *          to a nonzero multiple of pi / 2. Larger inputs are reduced with   *
+ *          an absolute error of about 2^-200, for any finite x.              *
+ *                                                                            *
+ *      2.) Infinity and NaN give NaN for both outputs.                       *
+ *                                                                            *
+ *      3.) Terms past t^9 in the series are below 10^-17 |t|, so they only   *
+ *          need double precision. The rest are summed with double-doubles.   *
+ *  References:                                                               *
+ *      1.) Hida, Y., Li, X., Bailey, D. (May 2008).                          *
+ *          Library for Double-Double and Quad-Double Arithmetic.             *
+ *          The two-step reduction used here follows the QD library.          *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing the TMPL_ALWAYS_INLINE macro.               *
+ *  2.) tmpl_math.h:                                                          *
+ *          Header file providing abs, floor, and NaN.                        *
+ *  3.) tmpl_two_prod.h:                                                      *
+ *          Provides the 2Prod function.                                      *
+ *  4.) tmpl_doubledouble.h:                                                  *
+ *          Function prototype and double-double typedefs provided here.      *
+ *  5.) tmpl_doubledouble_tables.h:                                           *
+ *          Tables of 1 / n!, sin(k pi / 16), and cos(k pi / 16).             *
+ *  6.) tmpl_rem_pio2_kernel_doubledouble.h:                                  *
+ *          Payne-Hanek reduction for large inputs.                           *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_ALWAYS_INLINE macro found here.                                      */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  tmpl_Double_Abs, tmpl_Double_Floor, and TMPL_NAN found here.              */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  2Prod is needed for the argument reduction.                               */
+#include <libtmpl/include/tmpl_two_prod.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <libtmpl/include/tmpl_doubledouble.h>
+
+/*  Lookup tables for the Maclaurin series and the angle sum formulas.        */
+#include <libtmpl/include/tables/tmpl_doubledouble_tables.h>
+
+/*  tmpl_DoubleDouble_Rem_Pio2_Kernel provided here.                          */
+#include "auxiliary/tmpl_rem_pio2_kernel_doubledouble.h"
+
+/*  pi / 2 split into three doubles, and 2 / pi.                              */
+#define PI_BY_TWO_0 (+1.570796326794896557998981734272E+00)
+#define PI_BY_TWO_1 (+6.123233995736766035868820147292E-17)
+#define PI_BY_TWO_2 (-1.497384904859169832943508177106E-33)
+#define TWO_BY_PI (+6.366197723675813824328884038550E-01)
+#define PI_BY_FOUR (+7.853981633974483096156608458198E-01)
+
+/*  Inputs at least 2^30 in magnitude use Payne-Hanek reduction.              */
+#define LARGE_ARGUMENT (1.073741824E+09)
+
+/*  pi / 16 split into two doubles, and 16 / pi.                              */
+#define PI_BY_SIXTEEN_0 (+1.963495408493620697498727167840E-01)
+#define PI_BY_SIXTEEN_1 (+7.654042494670957544836025184115E-18)
+#define SIXTEEN_BY_PI (+5.092958178940651059463107230840E+00)
+
+/*  Shorthand for the lookup tables.                                          */
+#define TMPL_RCPR_FACT tmpl_doubledouble_rcpr_factorial_table
+#define TMPL_SINPI16 tmpl_doubledouble_sinpi16_table
+#define TMPL_COSPI16 tmpl_doubledouble_cospi16_table
+
+/*  Computes sine and cosine of a double-double.                              */
+void
+tmpl_DoubleDouble_SinCos(const tmpl_DoubleDouble * const x,
+                         tmpl_DoubleDouble * const sin_x,
+                         tmpl_DoubleDouble * const cos_x)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_DoubleDouble red, prod, t_sq, poly, sin_t, cos_t, sin_r, cos_r, a, b;
+    double q, k, t_hi_sq, tail;
+    unsigned int quadrant, ind, n;
+
+    /*  Infinity and NaN both give NaN.                                       */
+    if (x->dat[0] - x->dat[0] != 0.0)
+    {
+        sin_x->dat[0] = sin_x->dat[1] = TMPL_NAN;
+        cos_x->dat[0] = cos_x->dat[1] = TMPL_NAN;
+        return;
+    }
+
+    /*  First reduction, x = q pi / 2 + r.                                    */
+    if (tmpl_Double_Abs(x->dat[0]) < LARGE_ARGUMENT)
+    {
+        q = tmpl_Double_Floor(x->dat[0] * TWO_BY_PI + 0.5);
+
+        /*  r = x - q P0 - q P1 - q P2. The first two products are exact.     */
+        tmpl_Double_Two_Prod(-q, PI_BY_TWO_0, &prod.dat[0], &prod.dat[1]);
+        red = tmpl_DoubleDouble_Add(x, &prod);
+        tmpl_Double_Two_Prod(-q, PI_BY_TWO_1, &prod.dat[0], &prod.dat[1]);
+        red = tmpl_DoubleDouble_Add(&red, &prod);
+        red = tmpl_DoubleDouble_Add_Scalar(-q * PI_BY_TWO_2, &red);
+
+        /*  q mod 4 determines the signs and order of the outputs.            */
+        quadrant = (unsigned int)(q - 4.0 * tmpl_Double_Floor(0.25 * q));
+    }
+
+    /*  q P0 is no longer exact. Reduce the two words separately.             */
+    else
+    {
+        quadrant = tmpl_DoubleDouble_Rem_Pio2_Kernel(x->dat[0], &red);
+
+        if (tmpl_Double_Abs(x->dat[1]) > PI_BY_FOUR)
+        {
+            quadrant += tmpl_DoubleDouble_Rem_Pio2_Kernel(x->dat[1], &prod);
+            red = tmpl_DoubleDouble_Add(&red, &prod);
+        }
+
+        else
+            red = tmpl_DoubleDouble_Add_Scalar(x->dat[1], &red);
+
+        /*  The sum of the remainders may be outside of [-pi / 4, pi / 4].    */
+        if (red.dat[0] > PI_BY_FOUR)
+        {
+            red = tmpl_DoubleDouble_Add_Scalar(-PI_BY_TWO_0, &red);
+            red = tmpl_DoubleDouble_Add_Scalar(-PI_BY_TWO_1, &red);
+            red = tmpl_DoubleDouble_Add_Scalar(-PI_BY_TWO_2, &red);
+            quadrant += 1U;
+        }
+
+        else if (red.dat[0] < -PI_BY_FOUR)
+        {
+            red = tmpl_DoubleDouble_Add_Scalar(PI_BY_TWO_0, &red);
+            red = tmpl_DoubleDouble_Add_Scalar(PI_BY_TWO_1, &red);
+            red = tmpl_DoubleDouble_Add_Scalar(PI_BY_TWO_2, &red);
+            quadrant += 3U;
+        }
+
+        quadrant &= 3U;
+    }
+
+    /*  Second reduction, r = k pi / 16 + t. k is small, so k P0 is exact and *
+     *  the error in k P1 is far below the precision of t.                    */
+    k = tmpl_Double_Floor(red.dat[0] * SIXTEEN_BY_PI + 0.5);
+    tmpl_Double_Two_Prod(-k, PI_BY_SIXTEEN_0, &prod.dat[0], &prod.dat[1]);
+    red = tmpl_DoubleDouble_Add(&red, &prod);
+    red = tmpl_DoubleDouble_Add_Scalar(-k * PI_BY_SIXTEEN_1, &red);
+
+    /*  The series for sin(t) is in terms of t^2.                             */
+    t_sq = tmpl_DoubleDouble_Multiply(&red, &red);
+    t_hi_sq = t_sq.dat[0];
+
+    /*  Terms t^11 / 11! to t^17 / 17!, divided by t^11, in double precision. */
+    tail = TMPL_RCPR_FACT[17].dat[0];
+    tail = -TMPL_RCPR_FACT[15].dat[0] + t_hi_sq * tail;
+    tail = TMPL_RCPR_FACT[13].dat[0] + t_hi_sq * tail;
+    tail = -TMPL_RCPR_FACT[11].dat[0] + t_hi_sq * tail;
+
+    /*  Horner's method with double-doubles for -1/3!, 1/5!, -1/7!, and 1/9!. */
+    poly.dat[0] = tail;
+    poly.dat[1] = 0.0;
+
+    for (n = 4U; n > 0U; --n)
+    {
+        /*  The coefficient (-1)^n / (2n + 1)!.                               */
+        a = TMPL_RCPR_FACT[2U*n + 1U];
+
+        if (n & 1U)
+        {
+            a.dat[0] = -a.dat[0];
+            a.dat[1] = -a.dat[1];
+        }
+
+        prod = tmpl_DoubleDouble_Multiply(&t_sq, &poly);
+        poly = tmpl_DoubleDouble_Quick_Add(&a, &prod);
+    }
+
+    /*  sin(t) = t + t (t^2 poly), and t is much larger than the rest.        */
+    prod = tmpl_DoubleDouble_Multiply(&t_sq, &poly);
+    prod = tmpl_DoubleDouble_Multiply(&red, &prod);
+    sin_t = tmpl_DoubleDouble_Quick_Add(&red, &prod);
+
+    /*  cos(t) = sqrt(1 - sin(t)^2). |sin(t)| < 0.1, so this is accurate.     */
+    prod = tmpl_DoubleDouble_Multiply(&sin_t, &sin_t);
+    prod.dat[0] = -prod.dat[0];
+    prod.dat[1] = -prod.dat[1];
+    prod = tmpl_DoubleDouble_Add_Scalar(1.0, &prod);
+    cos_t = tmpl_DoubleDouble_Sqrt(&prod);
+
+    /*  Angle sum formulas for r = k pi / 16 + t.                             */
+    if (k == 0.0)
+    {
+        sin_r = sin_t;
+        cos_r = cos_t;
+    }
+
+    else
+    {
+        ind = (unsigned int)(k < 0.0 ? -k : k);
+        a = TMPL_SINPI16[ind];
+        b = TMPL_COSPI16[ind];
+
+        /*  sin(-y) = -sin(y), cos(-y) = cos(y).                              */
+        if (k < 0.0)
+        {
+            a.dat[0] = -a.dat[0];
+            a.dat[1] = -a.dat[1];
+        }
+
+        /*  sin(r) = sin(k pi / 16) cos(t) + cos(k pi / 16) sin(t).           */
+        sin_r = tmpl_DoubleDouble_Multiply(&a, &cos_t);
+        prod = tmpl_DoubleDouble_Multiply(&b, &sin_t);
+        sin_r = tmpl_DoubleDouble_Add(&sin_r, &prod);
+
+        /*  cos(r) = cos(k pi / 16) cos(t) - sin(k pi / 16) sin(t).           */
+        cos_r = tmpl_DoubleDouble_Multiply(&b, &cos_t);
+        prod = tmpl_DoubleDouble_Multiply(&a, &sin_t);
+        prod.dat[0] = -prod.dat[0];
+        prod.dat[1] = -prod.dat[1];
+        cos_r = tmpl_DoubleDouble_Add(&cos_r, &prod);
+    }
+
+    /*  Rotate by q quarter turns.                                            */
+    switch (quadrant)
+    {
+        case 0U:
+            *sin_x = sin_r;
+            *cos_x = cos_r;
+            break;
+
+        case 1U:
+            *sin_x = cos_r;
+            cos_x->dat[0] = -sin_r.dat[0];
+            cos_x->dat[1] = -sin_r.dat[1];
+            break;
+
+        case 2U:
+            sin_x->dat[0] = -sin_r.dat[0];
+            sin_x->dat[1] = -sin_r.dat[1];
+            cos_x->dat[0] = -cos_r.dat[0];
+            cos_x->dat[1] = -cos_r.dat[1];
+            break;
+
+        default:
+            sin_x->dat[0] = -cos_r.dat[0];
+            sin_x->dat[1] = -cos_r.dat[1];
+            *cos_x = sin_r;
+            break;
+    }
+}
+/*  End of tmpl_DoubleDouble_SinCos.                                          */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef PI_BY_TWO_0
+#undef PI_BY_TWO_1
+#undef PI_BY_TWO_2
+#undef TWO_BY_PI
+#undef PI_BY_FOUR
+#undef LARGE_ARGUMENT
+#undef PI_BY_SIXTEEN_0
+#undef PI_BY_SIXTEEN_1
+#undef SIXTEEN_BY_PI
+#undef TMPL_RCPR_FACT
+#undef TMPL_SINPI16
+#undef TMPL_COSPI16
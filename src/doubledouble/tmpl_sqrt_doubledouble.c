@@ -0,0 +1,188 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                           tmpl_sqrt_doubledouble                           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the square root of a double-word real number.                *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_DoubleDouble_Sqrt                                                *
+ *  Purpose:                                                                  *
+ *      Evaluates the square root of a double-double.                         *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DoubleDouble * const):                                  *
+ *          A double-double real number.                                      *
+ *  Output:                                                                   *
+ *      sqrt_x (tmpl_DoubleDouble):                                           *
+ *          The double-double square root of x.                               *
+ *  Called Functions:                                                         *
+ *      src/math/                                                             *
+ *          tmpl_Double_Sqrt:                                                 *
+ *              Computes the square root of a double.                         *
+ *          tmpl_Double_Pow2:                                                 *
+ *              Computes 2^n for an integer n.                                *
+ *      src/two_prod/                                                         *
+ *          tmpl_Double_Two_Square:                                           *
+ *              Computes x^2 exactly as the sum of two doubles.               *
+ *      src/two_sum/                                                          *
+ *          tmpl_Double_Fast_Two_Sum:                                         *
+ *              Performs Fast2Sum: (sum, error) = Fast2Sum(x, y).             *
+ *  Method:                                                                   *
+ *      Start with s = sqrt(xhi), which is correct to double precision, and   *
+ *      perform one Newton step for f(s) = s^2 - x:                           *
+ *          sqrt(x) ~= s + (x - s^2) / (2s)                                   *
+ *      Newton's method doubles the number of correct bits, so this is good   *
+ *      to double-double precision. The residual x - s^2 is small and must be *
+ *      computed carefully. 2Square gives s^2 = p + e exactly, and xhi - p is *
+ *      exact since xhi and p are very close. Hence:                          *
+ *                   d = ((xhi - p) - e) + xlo                                *
+ *          (out_hi, out_lo) = Fast2Sum(s, d / (2s))                          *
+ *                                                                            *
+ *      2Square overflows if s^2 is close to DBL_MAX, and its error term      *
+ *      loses bits to underflow if x is tiny. Outside of                      *
+ *      10^-270 < x < 10^300, x is first scaled by 2^-600 or 2^600, and       *
+ *      the result by 2^300 or 2^-300. These are powers of two, so the        *
+ *      scaling is exact.                                                     *
+ *  Notes:                                                                    *
+ *      1.) The relative error is a small multiple of eps^2, where eps is the *
+ *          epsilon value of double. For 64-bit double this is about 10^-31.  *
+ *          This holds for all positive finite x, from the smallest           *
+ *          subnormal up to DBL_MAX.                                          *
+ *                                                                            *
+ *      2.) Zero is returned as is. Negative numbers and NaN return NaN, and  *
+ *          positive infinity returns infinity. For these values both words   *
+ *          of the output are set to the same value.                          *
+ *  References:                                                               *
+ *      1.) Karp, A., Markstein, P. (December 1997).                          *
+ *          High-precision division and square root.                          *
+ *          ACM Transactions on Mathematical Software, Vol. 23, No. 4.        *
+ *          The single Newton step used here is described in this paper.      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing the TMPL_ALWAYS_INLINE macro.               *
+ *  2.) tmpl_attributes.h:                                                    *
+ *          Provides (optional) C23 attributes for optimization.              *
+ *  3.) tmpl_math.h:                                                          *
+ *          Header file providing tmpl_Double_Sqrt and tmpl_Double_Pow2.      *
+ *  4.) tmpl_two_sum.h:                                                       *
+ *          Provides 2Sum, Fast2Sum, and other 2Sum-like routines.            *
+ *  5.) tmpl_two_prod.h:                                                      *
+ *          Provides the 2Square function.                                    *
+ *  6.) tmpl_doubledouble.h:                                                  *
+ *          Function prototype and double-double typedefs provided here.      *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_ALWAYS_INLINE macro found here.                                      */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Optional C23 attributes for optimization provided here.                   */
+#include <libtmpl/include/tmpl_attributes.h>
+
+/*  tmpl_Double_Sqrt and tmpl_Double_Pow2 provided here.                      */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Fast2Sum and 2Square are needed for the Newton step.                      */
+#include <libtmpl/include/tmpl_two_sum.h>
+#include <libtmpl/include/tmpl_two_prod.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <libtmpl/include/tmpl_doubledouble.h>
+
+/*  Computes the square root of a double-double.                              */
+TMPL_PURE_FUNC
+TMPL_ALWAYS_INLINE
+tmpl_DoubleDouble
+tmpl_DoubleDouble_Sqrt(const tmpl_DoubleDouble * const x)
+TMPL_UNSEQUENCED
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_DoubleDouble out, y;
+    double sqrt_hi, square_hi, square_lo, diff, correction, scale;
+
+    /*  The result is scaled by this at the end. It is 1 for most inputs.     */
+    double unscale = 1.0;
+
+    /*  sqrt(+/- 0) = +/- 0. Return the input.                                */
+    if (x->dat[0] == 0.0)
+    {
+        out.dat[0] = x->dat[0];
+        out.dat[1] = 0.0;
+        return out;
+    }
+
+    /*  The square root of the high word, correct to double precision.        */
+    sqrt_hi = tmpl_Double_Sqrt(x->dat[0]);
+
+    /*  Negative numbers, NaN, and infinity. The Newton step would give NaN   *
+     *  for infinity, so return the double precision result.                  */
+    if (!(x->dat[0] > 0.0) || sqrt_hi - sqrt_hi != 0.0)
+    {
+        out.dat[0] = sqrt_hi;
+        out.dat[1] = sqrt_hi;
+        return out;
+    }
+
+    y = *x;
+
+    /*  sqrt_hi^2 may overflow for large x, and its error term may underflow  *
+     *  for small x. Scale by an even power of two, which is exact, so that   *
+     *  sqrt(y) is sqrt(x) times a power of two.                              */
+    if (x->dat[0] > 1.0E+300 || x->dat[0] < 1.0E-270)
+    {
+        if (x->dat[0] > 1.0)
+        {
+            scale = tmpl_Double_Pow2(-600);
+            unscale = tmpl_Double_Pow2(300);
+        }
+        else
+        {
+            scale = tmpl_Double_Pow2(600);
+            unscale = tmpl_Double_Pow2(-300);
+        }
+
+        y.dat[0] *= scale;
+        y.dat[1] *= scale;
+        sqrt_hi = tmpl_Double_Sqrt(y.dat[0]);
+    }
+
+    /*  The square of sqrt_hi, computed exactly.                              */
+    tmpl_Double_Two_Square(sqrt_hi, &square_hi, &square_lo);
+
+    /*  The residual y - sqrt_hi^2. yhi - square_hi is computed exactly.      */
+    diff = ((y.dat[0] - square_hi) - square_lo) + y.dat[1];
+
+    /*  One Newton step doubles the number of correct bits.                   */
+    correction = 0.5 * diff / sqrt_hi;
+
+    /*  sqrt_hi is much larger than the correction, Fast2Sum suffices.        */
+    tmpl_Double_Fast_Two_Sum(sqrt_hi, correction, &out.dat[0], &out.dat[1]);
+
+    /*  Undo the scaling. The result is well inside the normal range.         */
+    out.dat[0] *= unscale;
+    out.dat[1] *= unscale;
+    return out;
+}
+/*  End of tmpl_DoubleDouble_Sqrt.                                            */
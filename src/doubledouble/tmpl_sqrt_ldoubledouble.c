@@ -0,0 +1,149 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                          tmpl_sqrt_ldoubledouble                           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the square root of a long double-word real number.           *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_LDoubleDouble_Sqrt                                               *
+ *  Purpose:                                                                  *
+ *      Evaluates the square root of a long double-double.                    *
+ *  Arguments:                                                                *
+ *      x (const tmpl_LongDoubleDouble * const):                              *
+ *          A long double-double real number.                                 *
+ *  Output:                                                                   *
+ *      sqrt_x (tmpl_DoubleDouble):                                           *
+ *          The long double-double square root of x.                          *
+ *  Called Functions:                                                         *
+ *      src/math/                                                             *
+ *          tmpl_LDouble_Sqrt:                                                *
+ *              Computes the square root of a long double.                    *
+ *      src/two_prod/                                                         *
+ *          tmpl_LDouble_Two_Square:                                          *
+ *              Computes x^2 exactly as the sum of two long doubles.          *
+ *      src/two_sum/                                                          *
+ *          tmpl_LDouble_Fast_Two_Sum:                                        *
+ *              Performs Fast2Sum: (sum, error) = Fast2Sum(x, y).             *
+ *  Method:                                                                   *
+ *      Start with s = sqrt(xhi), which is correct to long double precision,  *
+ *      and perform one Newton step for f(s) = s^2 - x:                       *
+ *          sqrt(x) ~= s + (x - s^2) / (2s)                                   *
+ *      Newton's method doubles the number of correct bits, so this is good   *
+ *      to long double-double precision. The residual x - s^2 is small and    *
+ *      must be computed carefully. 2Square gives s^2 = p + e exactly, and    *
+ *      xhi - p is exact since xhi and p are very close. Hence:               *
+ *                   d = ((xhi - p) - e) + xlo                                *
+ *          (out_hi, out_lo) = Fast2Sum(s, d / (2s))                          *
+ *  Notes:                                                                    *
+ *      1.) The relative error is a small multiple of eps^2, where eps is the *
+ *          epsilon value of long double. For 80-bit extended, this is about  *
+ *          10^-37.                                                           *
+ *                                                                            *
+ *      2.) Zero is returned as is. Negative numbers and NaN return NaN, and  *
+ *          positive infinity returns infinity. For these values both words   *
+ *          of the output are set to the same value.                          *
+ *  References:                                                               *
+ *      1.) Karp, A., Markstein, P. (December 1997).                          *
+ *          High-precision division and square root.                          *
+ *          ACM Transactions on Mathematical Software, Vol. 23, No. 4.        *
+ *          The single Newton step used here is described in this paper.      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing the TMPL_ALWAYS_INLINE macro.               *
+ *  2.) tmpl_attributes.h:                                                    *
+ *          Provides (optional) C23 attributes for optimization.              *
+ *  3.) tmpl_math.h:                                                          *
+ *          Header file providing tmpl_LDouble_Sqrt.                          *
+ *  4.) tmpl_two_sum.h:                                                       *
+ *          Provides 2Sum, Fast2Sum, and other 2Sum-like routines.            *
+ *  5.) tmpl_two_prod.h:                                                      *
+ *          Provides the 2Square function.                                    *
+ *  6.) tmpl_doubledouble.h:                                                  *
+ *          Function prototype and long double-double typedefs provided here. *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_ALWAYS_INLINE macro found here.                                      */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Optional C23 attributes for optimization provided here.                   */
+#include <libtmpl/include/tmpl_attributes.h>
+
+/*  tmpl_LDouble_Sqrt provided here.                                          */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Fast2Sum and 2Square are needed for the Newton step.                      */
+#include <libtmpl/include/tmpl_two_sum.h>
+#include <libtmpl/include/tmpl_two_prod.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <libtmpl/include/tmpl_doubledouble.h>
+
+/*  Computes the square root of a long double-double.                         */
+TMPL_PURE_FUNC
+TMPL_ALWAYS_INLINE
+tmpl_LongDoubleDouble
+tmpl_LDoubleDouble_Sqrt(const tmpl_LongDoubleDouble * const x)
+TMPL_UNSEQUENCED
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_LongDoubleDouble out;
+    long double sqrt_hi, square_hi, square_lo, diff, correction;
+
+    /*  sqrt(+/- 0) = +/- 0. Return the input.                                */
+    if (x->dat[0] == 0.0L)
+    {
+        out.dat[0] = x->dat[0];
+        out.dat[1] = 0.0L;
+        return out;
+    }
+
+    /*  The square root of the high word, correct to long double precision.   */
+    sqrt_hi = tmpl_LDouble_Sqrt(x->dat[0]);
+
+    /*  Negative numbers, NaN, and infinity. The Newton step would give NaN   *
+     *  for infinity, so return the long double result.                  */
+    if (!(x->dat[0] > 0.0L) || sqrt_hi - sqrt_hi != 0.0L)
+    {
+        out.dat[0] = sqrt_hi;
+        out.dat[1] = sqrt_hi;
+        return out;
+    }
+
+    /*  The square of sqrt_hi, computed exactly.                              */
+    tmpl_LDouble_Two_Square(sqrt_hi, &square_hi, &square_lo);
+
+    /*  The residual x - sqrt_hi^2. xhi - square_hi is computed exactly.      */
+    diff = ((x->dat[0] - square_hi) - square_lo) + x->dat[1];
+
+    /*  One Newton step doubles the number of correct bits.                   */
+    correction = 0.5L * diff / sqrt_hi;
+
+    /*  sqrt_hi is much larger than the correction, Fast2Sum suffices.        */
+    tmpl_LDouble_Fast_Two_Sum(sqrt_hi, correction, &out.dat[0], &out.dat[1]);
+    return out;
+}
+/*  End of tmpl_LDoubleDouble_Sqrt.                                           */
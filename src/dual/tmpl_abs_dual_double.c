@@ -0,0 +1,77 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                            tmpl_abs_dual_double                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the absolute value of a dual number.                         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_DualDouble_Abs                                                   *
+ *  Purpose:                                                                  *
+ *      Computes f(x) for x = a + b e, where f is the absolute value.         *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The absolute value of x.                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Use f(a + b e) = f(a) + b f'(a) e:                                    *
+ *                                                                            *
+ *          |a + b e| = |a| + sgn(a) b e                                      *
+ *                                                                            *
+ *  Notes:                                                                    *
+ *      1.) |x| is not differentiable at a = 0. The derivative from the right,*
+ *          sgn(a) = 1, is used there.                                        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_dual.h:                                                          *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype given here.                                            */
+#include <libtmpl/include/tmpl_dual.h>
+
+/*  Computes the absolute value of a dual number.                             */
+tmpl_DualDouble tmpl_DualDouble_Abs(const tmpl_DualDouble x)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_DualDouble out;
+
+    /*  For negative a the function is -x, otherwise it is x.                 */
+    if (x.dat[0] < 0.0)
+    {
+        out.dat[0] = -x.dat[0];
+        out.dat[1] = -x.dat[1];
+    }
+
+    else
+        out = x;
+
+    return out;
+}
+/*  End of tmpl_DualDouble_Abs.                                               */
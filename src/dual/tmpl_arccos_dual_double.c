@@ -0,0 +1,82 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                          tmpl_arccos_dual_double                           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the inverse cosine of a dual number.                         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_DualDouble_Arccos                                                *
+ *  Purpose:                                                                  *
+ *      Computes f(x) for x = a + b e, where f is the inverse cosine.         *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The inverse cosine of x.                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_math.h:                                                          *
+ *          tmpl_Double_Arccos:                                               *
+ *              Computes the inverse cosine of a real number.                 *
+ *          tmpl_Double_Sqrt:                                                 *
+ *              Computes the square root of a real number.                    *
+ *  Method:                                                                   *
+ *      Use f(a + b e) = f(a) + b f'(a) e:                                    *
+ *                                                                            *
+ *          acos(a + b e) = acos(a) - (b / sqrt(1 - a^2)) e                   *
+ *                                                                            *
+ *  Notes:                                                                    *
+ *      1.) The dual part is infinite for a = +/- 1, and NaN for |a| > 1.     *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file with the real-valued functions.                       *
+ *  2.) tmpl_dual.h:                                                          *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Real-valued functions found here.                                         */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Function prototype given here.                                            */
+#include <libtmpl/include/tmpl_dual.h>
+
+/*  Computes the inverse cosine of a dual number.                             */
+tmpl_DualDouble tmpl_DualDouble_Arccos(const tmpl_DualDouble x)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_DualDouble out;
+
+    /*  1 - a^2 = (1 - a)(1 + a) is computed without cancellation for a near  *
+     *  +/- 1, which is where the derivative is largest.                      */
+    const double root = tmpl_Double_Sqrt((1.0 - x.dat[0]) * (1.0 + x.dat[0]));
+
+    /*  The derivative of acos(a) is -1 / sqrt(1 - a^2).                      */
+    out.dat[0] = tmpl_Double_Arccos(x.dat[0]);
+    out.dat[1] = -x.dat[1] / root;
+    return out;
+}
+/*  End of tmpl_DualDouble_Arccos.                                            */
@@ -0,0 +1,77 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                           tmpl_cbrt_dual_double                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the cube root of a dual number.                              *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_DualDouble_Cbrt                                                  *
+ *  Purpose:                                                                  *
+ *      Computes f(x) for x = a + b e, where f is the cube root.              *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The cube root of x.                                               *
+ *  Called Functions:                                                         *
+ *      tmpl_math.h:                                                          *
+ *          tmpl_Double_Cbrt:                                                 *
+ *              Computes the cube root of a real number.                      *
+ *  Method:                                                                   *
+ *      Use f(a + b e) = f(a) + b f'(a) e:                                    *
+ *                                                                            *
+ *          cbrt(a + b e) = cbrt(a) + (b / (3 cbrt(a)^2)) e                   *
+ *                                                                            *
+ *  Notes:                                                                    *
+ *      1.) The dual part is infinite or NaN for a = 0, where cbrt is not     *
+ *          differentiable.                                                   *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file with the real-valued function.                        *
+ *  2.) tmpl_dual.h:                                                          *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Real-valued functions found here.                                         */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Function prototype given here.                                            */
+#include <libtmpl/include/tmpl_dual.h>
+
+/*  Computes the cube root of a dual number.                                  */
+tmpl_DualDouble tmpl_DualDouble_Cbrt(const tmpl_DualDouble x)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_DualDouble out;
+
+    /*  The derivative of cbrt(a) is 1 / (3 cbrt(a)^2).                       */
+    out.dat[0] = tmpl_Double_Cbrt(x.dat[0]);
+    out.dat[1] = x.dat[1] / (3.0 * out.dat[0] * out.dat[0]);
+    return out;
+}
+/*  End of tmpl_DualDouble_Cbrt.                                              */
@@ -0,0 +1,46 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                          tmpl_dual_create_double                           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Creates a dual number from its real and dual parts.                   *
+ *      Source: include/inline/dual/tmpl_dual_create_double.h.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Location of the TMPL_USE_INLINE macro.                                    */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Only used if inline support is not requested.                             */
+#if TMPL_USE_INLINE != 1
+
+/*  Double precision dual numbers.                                            */
+#include <libtmpl/include/types/tmpl_dual_double.h>
+
+/*  Function prototype / forward declaration.                                 */
+extern tmpl_DualDouble
+tmpl_DualDouble_Create(double a, double b);
+
+/*  Implemented here.                                                         */
+#include "../../include/inline/dual/tmpl_dual_create_double.h"
+
+#endif
+/*  End of #if TMPL_USE_INLINE != 1.                                          */
@@ -0,0 +1,85 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                            tmpl_erf_dual_double                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the error function of a dual number.                         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_DualDouble_Erf                                                   *
+ *  Purpose:                                                                  *
+ *      Computes f(x) for x = a + b e, where f is the error function.         *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The error function of x.                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_math.h:                                                          *
+ *          tmpl_Double_Erf:                                                  *
+ *              Computes the error function of a real number.                 *
+ *          tmpl_Double_Exp:                                                  *
+ *              Computes the exponential of a real number.                    *
+ *  Method:                                                                   *
+ *      Use f(a + b e) = f(a) + b f'(a) e:                                    *
+ *                                                                            *
+ *          erf(a + b e) = erf(a) + (2 b / sqrt(pi)) exp(-a^2) e              *
+ *                                                                            *
+ *  Notes:                                                                    *
+ *      1.) No checks for NaN or infinity are made.                           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file with the real-valued functions.                       *
+ *  2.) tmpl_math_constants.h:                                                *
+ *          Header file with the constant 2 / sqrt(pi).                       *
+ *  3.) tmpl_dual.h:                                                          *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Real-valued functions found here.                                         */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  TMPL_DOUBLE_TWO_BY_SQRT_PI found here.                                    */
+#include <libtmpl/include/constants/tmpl_math_constants.h>
+
+/*  Function prototype given here.                                            */
+#include <libtmpl/include/tmpl_dual.h>
+
+/*  Computes the error function of a dual number.                             */
+tmpl_DualDouble tmpl_DualDouble_Erf(const tmpl_DualDouble x)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_DualDouble out;
+
+    /*  The derivative of erf(a) is 2 exp(-a^2) / sqrt(pi).                   */
+    const double scale = TMPL_DOUBLE_TWO_BY_SQRT_PI * x.dat[1];
+
+    out.dat[0] = tmpl_Double_Erf(x.dat[0]);
+    out.dat[1] = scale * tmpl_Double_Exp(-x.dat[0] * x.dat[0]);
+    return out;
+}
+/*  End of tmpl_DualDouble_Erf.                                               */
@@ -0,0 +1,95 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                           tmpl_tanh_dual_double                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the hyperbolic tangent of a dual number.                     *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_DualDouble_Tanh                                                  *
+ *  Purpose:                                                                  *
+ *      Computes f(x) for x = a + b e, where f is the hyperbolic tangent.     *
+ *  Arguments:                                                                *
+ *      x (const tmpl_DualDouble):                                            *
+ *          A dual number.                                                    *
+ *  Output:                                                                   *
+ *      f_x (tmpl_DualDouble):                                                *
+ *          The hyperbolic tangent of x.                                      *
+ *  Called Functions:                                                         *
+ *      tmpl_math.h:                                                          *
+ *          tmpl_Double_Tanh:                                                 *
+ *              Computes the hyperbolic tangent of a real number.             *
+ *          tmpl_Double_Exp:                                                  *
+ *              Computes the exponential of a real number.                    *
+ *          tmpl_Double_Abs:                                                  *
+ *              Computes the absolute value of a real number.                 *
+ *  Method:                                                                   *
+ *      Use f(a + b e) = f(a) + b f'(a) e:                                    *
+ *                                                                            *
+ *          tanh(a + b e) = tanh(a) + b sech(a)^2 e                           *
+ *                                                                            *
+ *      Computing sech(a)^2 as 1 - tanh(a)^2 cancels catastrophically once    *
+ *      tanh(a) rounds to +/- 1, returning zero for |a| > 19.06. Instead,     *
+ *      with t = exp(-|a|), use:                                              *
+ *                                                                            *
+ *                          2 t                                               *
+ *          sech(a) = -----------                                             *
+ *                     1 + t^2                                                *
+ *                                                                            *
+ *      and square the result. Since 0 < t <= 1 there is no cancellation,     *
+ *      and t only underflows once sech(a)^2 is zero in double precision.     *
+ *  Notes:                                                                    *
+ *      1.) No checks for NaN or infinity are made.                           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file with the real-valued function.                        *
+ *  2.) tmpl_dual.h:                                                          *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Real-valued functions found here.                                         */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Function prototype given here.                                            */
+#include <libtmpl/include/tmpl_dual.h>
+
+/*  Computes the hyperbolic tangent of a dual number.                         */
+tmpl_DualDouble tmpl_DualDouble_Tanh(const tmpl_DualDouble x)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_DualDouble out;
+    double t, sech_a;
+
+    /*  sech is even, use exp(-|a|) so the exponential never overflows.       */
+    t = tmpl_Double_Exp(-tmpl_Double_Abs(x.dat[0]));
+    sech_a = 2.0 * t / (1.0 + t * t);
+
+    /*  The derivative of tanh(a) is sech(a)^2.                               */
+    out.dat[0] = tmpl_Double_Tanh(x.dat[0]);
+    out.dat[1] = x.dat[1] * sech_a * sech_a;
+    return out;
+}
+/*  End of tmpl_DualDouble_Tanh.                                              */
@@ -0,0 +1,66 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                        tmpl_gcd_mixed_binary_uchar                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Contains code for computing the GCD of unsigned integers.             *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_UChar_GCD_Mixed_Binary                                           *
+ *  Purpose:                                                                  *
+ *      Computes GCD(m, n), the greatest common divisor of m and n.           *
+ *  Arguments:                                                                *
+ *      m (unsigned char):                                                    *
+ *          An integer.                                                       *
+ *      n (unsigned char):                                                    *
+ *          Another integer.                                                  *
+ *  Output:                                                                   *
+ *      gcd (unsigned char):                                                  *
+ *          The greatest common divisor of m and n.                           *
+ *  Called Functions:                                                         *
+ *      tmpl_integer.h:                                                       *
+ *          tmpl_UInt_GCD_Mixed_Binary:                                       *
+ *              Computes the GCD of two unsigned ints.                        *
+ *  Method:                                                                   *
+ *      Both arguments are promoted to unsigned int, which is at least as     *
+ *      wide, and the unsigned int version is used. The GCD is no larger      *
+ *      than the inputs, so converting the result back is exact.              *
+ *  Notes:                                                                    *
+ *      By definition, GCD(0, 0) = 0, GCD(n, 0) = n, and GCD(0, n) = n.       *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_integer.h:                                                       *
+ *          Header file with the function prototype.                          *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype found here.                                            */
+#include <libtmpl/include/tmpl_integer.h>
+
+/*  Function for computing the GCD of two unsigned chars.                     */
+unsigned char
+tmpl_UChar_GCD_Mixed_Binary(unsigned char m, unsigned char n)
+{
+    return (unsigned char)tmpl_UInt_GCD_Mixed_Binary(m, n);
+}
+/*  End of tmpl_UChar_GCD_Mixed_Binary.                                       */
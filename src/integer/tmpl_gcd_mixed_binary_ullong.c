@@ -0,0 +1,138 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                        tmpl_gcd_mixed_binary_ullong                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Contains code for computing the GCD of unsigned integers.             *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_ULLong_GCD_Mixed_Binary                                          *
+ *  Purpose:                                                                  *
+ *      Computes GCD(m, n), the greatest common divisor of m and n.           *
+ *  Arguments:                                                                *
+ *      m (const unsigned long long int):                                     *
+ *          An integer.                                                       *
+ *      n (const unsigned long long int):                                     *
+ *          Another integer.                                                  *
+ *  Output:                                                                   *
+ *      gcd (unsigned long long int):                                         *
+ *          The greatest common divisor of m and n.                           *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Remove the common powers of two, as in Stein's binary algorithm. Then *
+ *      alternate a Euclidean step, u = u mod v and v = v - u, with a binary  *
+ *      step removing the factors of two from u and v, until one of them is   *
+ *      zero or one. This is the algorithm of tmpl_ULong_GCD_Mixed_Binary.    *
+ *  Notes:                                                                    *
+ *      1.) By definition, GCD(0, 0) = 0, GCD(n, 0) = n, and GCD(0, n) = n.   *
+ *          This function follows these requirements.                         *
+ *                                                                            *
+ *      2.) This file is only compiled if long long support is available.     *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_inttype.h:                                                       *
+ *          TMPL_HAS_LONGLONG macro defined here.                             *
+ *  2.) tmpl_integer.h:                                                       *
+ *          Header file with TMPL_ULLONG_TRAILING_ZEROS and the prototype.    *
+ *  3.) tmpl_min.h:                                                           *
+ *          Header file containing the TMPL_MIN macro.                        *
+ *  4.) tmpl_swap.h:                                                          *
+ *          Header file containing the TMPL_SWAP macro.                       *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  The TMPL_HAS_LONGLONG macro is defined here.                              */
+#include <libtmpl/include/tmpl_inttype.h>
+
+/*  Only compile this if long long support is available / requested.          */
+#if TMPL_HAS_LONGLONG == 1
+
+/*  Function prototype and TMPL_ULLONG_TRAILING_ZEROS found here.             */
+#include <libtmpl/include/tmpl_integer.h>
+
+/*  TMPL_MIN and TMPL_SWAP macros are provided here.                          */
+#include <libtmpl/include/helper/tmpl_min.h>
+#include <libtmpl/include/helper/tmpl_swap.h>
+
+/*  Function for computing the GCD of two unsigned integers.                  */
+unsigned long long int
+tmpl_ULLong_GCD_Mixed_Binary(const unsigned long long int m,
+                             const unsigned long long int n)
+{
+    /*  Declare all necessary variables. C89 requires this at the top.        */
+    unsigned long long int u, v;
+    int m_zeros, n_zeros, shift;
+
+    /*  Special cases. GCD(m, 0) = m and GCD(0, n) = n. Use this.             */
+    if (m == 0ULL)
+        return n;
+
+    if (n == 0ULL)
+        return m;
+
+    /*  Use the fact that GCD(2m, 2n) = 2 GCD(m, n) to reduce the arguments.  */
+    m_zeros = (int)TMPL_ULLONG_TRAILING_ZEROS(m);
+    n_zeros = (int)TMPL_ULLONG_TRAILING_ZEROS(n);
+    u = m >> m_zeros;
+    v = n >> n_zeros;
+
+    /*  Swap u and v, if necessary, so that u is the larger one.              */
+    if (u < v)
+        TMPL_SWAP(unsigned long long int, u, v);
+
+    /*  Save the smaller of n_zeros and m_zeros for later. Before returning   *
+     *  the output we need to bit shift to the left by this value.            */
+    shift = TMPL_MIN(m_zeros, n_zeros);
+
+    /*  Apply the Euclidean and Binary reductions repeatedly, decreasing u    *
+     *  and v at each step, until one of the values is zero or one.           */
+    while (1ULL < v)
+    {
+        /*  Apply the Euclidean reduction.                                    */
+        u %= v;
+        v -= u;
+
+        /*  If u is zero, we are done. Note that v can't be zero since        *
+         *  u mod v is less than v, hence v - u is positive.                  */
+        if (u == 0ULL)
+            return v << shift;
+
+        /*  Apply the binary (i.e. Stein GCD) reduction step.                 */
+        u >>= TMPL_ULLONG_TRAILING_ZEROS(u);
+        v >>= TMPL_ULLONG_TRAILING_ZEROS(v);
+
+        /*  Swap u and v, if necessary, so that u is larger.                  */
+        if (u < v)
+            TMPL_SWAP(unsigned long long int, u, v);
+    }
+
+    if (v == 1ULL)
+        return 1ULL << shift;
+
+    return u << shift;
+}
+/*  End of tmpl_ULLong_GCD_Mixed_Binary.                                      */
+
+#endif
+/*  End of #if TMPL_HAS_LONGLONG == 1.                                        */
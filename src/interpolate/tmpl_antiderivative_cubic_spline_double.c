@@ -0,0 +1,115 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                  tmpl_antiderivative_cubic_spline_double                   *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the integral of a cubic spline from its first knot to a      *
+ *      given point.                                                          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_CubicSplineDouble_Antiderivative                                 *
+ *  Purpose:                                                                  *
+ *      Computes the integral of the spline from x[0] to val.                 *
+ *  Arguments:                                                                *
+ *      spline (const tmpl_CubicSplineDouble * const):                        *
+ *          A spline created by tmpl_CubicSplineDouble_Create.                *
+ *      val (double):                                                         *
+ *          A real number.                                                    *
+ *  Output:                                                                   *
+ *      F (double):                                                           *
+ *          The integral of the spline from x[0] to val.                      *
+ *  Called Functions:                                                         *
+ *      tmpl_interpolate.h:                                                   *
+ *          tmpl_CubicSplineDouble_Find_Interval:                             *
+ *              Finds the index n with x[n] <= val < x[n + 1].                *
+ *  Method:                                                                   *
+ *      The integral from x[0] to x[n] is stored in the integral array. With  *
+ *      t = val - x[n], the remaining piece is:                               *
+ *                                                                            *
+ *                       2        3        4                                  *
+ *          a t + b t / 2 + c t / 3 + d t / 4                                 *
+ *                                                                            *
+ *      which is computed using Horner's method. Outside of the knots the     *
+ *      spline is linear, and the integral of that line is added instead.     *
+ *  Notes:                                                                    *
+ *      1.) No error checking is done. spline should be a valid spline with   *
+ *          at least two knots.                                               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_cubic_double.h:                                                  *
+ *          Header providing cubic polynomials and helper macros.             *
+ *  2.) tmpl_interpolate.h:                                                   *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Cubic polynomial typedef and helper macros provided here.                 */
+#include <libtmpl/include/types/tmpl_cubic_double.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_interpolate.h>
+
+/*  Function for integrating a cubic spline from x[0] to a point.             */
+double
+tmpl_CubicSplineDouble_Antiderivative(
+    const tmpl_CubicSplineDouble * const spline,
+    double val
+)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const double * const x = spline->x;
+    const tmpl_CubicDouble * const p = spline->p;
+    const size_t last = spline->length - 1;
+    size_t n;
+    double t;
+
+    /*  To the left of the knots, integrate the line a + b (x - x[0]).        */
+    if (val < x[0])
+    {
+        t = val - x[0];
+        return t * (p[0].dat[0] + 0.5 * p[0].dat[1] * t);
+    }
+
+    /*  To the right, integrate the line through the final knot.              */
+    if (val > x[last])
+    {
+        const double h = x[last] - x[last - 1];
+        const double a = TMPL_CUBIC_DOUBLE_EVAL(p[last - 1], h);
+        const double b = TMPL_CUBIC_DOUBLE_DERIV_EVAL(p[last - 1], h);
+
+        t = val - x[last];
+        return spline->integral[last] + t * (a + 0.5 * b * t);
+    }
+
+    /*  General case, add the partial integral over the nth interval.         */
+    n = tmpl_CubicSplineDouble_Find_Interval(spline, val);
+    t = val - x[n];
+
+    return spline->integral[n] + t * (
+        p[n].dat[0] + t * (
+            0.5 * p[n].dat[1] + t * (p[n].dat[2] / 3.0 + 0.25 * p[n].dat[3] * t)
+        )
+    );
+}
+/*  End of tmpl_CubicSplineDouble_Antiderivative.                             */
@@ -0,0 +1,239 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                      tmpl_create_cubic_spline_double                       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Creates a cubic spline object with a lookup structure for the knots.  *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_CubicSplineDouble_Create                                         *
+ *  Purpose:                                                                  *
+ *      Copies knots and splining polynomials into a spline object, and       *
+ *      builds the tables used for fast evaluation at unsorted points.        *
+ *  Arguments:                                                                *
+ *      x (const double * const):                                             *
+ *          The knots, strictly increasing.                                   *
+ *      p (const tmpl_CubicDouble * const):                                   *
+ *          The splining polynomials, in terms of x - x[n]. There are len - 1.*
+ *      len (size_t):                                                         *
+ *          The number of elements of x. Must be at least 2.                  *
+ *  Output:                                                                   *
+ *      spline (tmpl_CubicSplineDouble):                                      *
+ *          The spline object.                                                *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates memory for the arrays.                              *
+ *      tmpl_interpolate.h:                                                   *
+ *          tmpl_CubicSplineDouble_Destroy:                                   *
+ *              Frees the arrays if one of the allocations fails.             *
+ *  Method:                                                                   *
+ *      Let h = (x[len - 1] - x[0]) / (len - 1) be the average step. If every *
+ *      knot is within h / 4 of x[0] + n h, the grid is treated as uniform    *
+ *      and the interval containing a point v is floor((v - x[0]) / h), up to *
+ *      a single correction step. No table is needed.                         *
+ *                                                                            *
+ *      Otherwise [x[0], x[len - 1]] is cut into len - 1 buckets of equal     *
+ *      width, and buckets[b] stores the index of the interval containing the *
+ *      left edge of bucket b. A point in bucket b lies in an interval with   *
+ *      index between buckets[b] and buckets[b + 1]. Since there are as many  *
+ *      buckets as intervals, this range is short on average and a binary     *
+ *      search over it finishes quickly. The table is built with one merged   *
+ *      pass over the knots and the bucket edges.                             *
+ *                                                                            *
+ *      Lastly, the integral of the spline over each interval is accumulated  *
+ *      into the integral array, so antiderivatives cost O(1) as well.        *
+ *  Notes:                                                                    *
+ *      1.) NULL pointers, len < 2, and knots that are not strictly           *
+ *          increasing (including NaN) set the error_occurred Boolean.        *
+ *                                                                            *
+ *      2.) If malloc fails, the error_occurred Boolean is set and any memory *
+ *          that was allocated is freed.                                      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_malloc.h:                                                        *
+ *          Header file providing the TMPL_MALLOC macro.                      *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_interpolate.h:                                                   *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_MALLOC macro provided here.                                          */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+
+/*  Booleans provided here.                                                   */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_interpolate.h>
+
+/*  Checks if the knots are close enough to uniform for direct indexing.      */
+static tmpl_Bool
+tmpl_cubic_spline_double_is_uniform(const double * const x, size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    const double h = (x[len - 1] - x[0]) / (double)(len - 1);
+    const double tolerance = 0.25 * h;
+
+    for (n = 1; n < len - 1; ++n)
+    {
+        const double diff = x[n] - (x[0] + (double)n * h);
+
+        if (diff > tolerance || diff < -tolerance)
+            return tmpl_False;
+    }
+
+    return tmpl_True;
+}
+/*  End of tmpl_cubic_spline_double_is_uniform.                               */
+
+/*  Function for creating a cubic spline from knots and polynomials.          */
+tmpl_CubicSplineDouble
+tmpl_CubicSplineDouble_Create(const double * const x,
+                              const tmpl_CubicDouble * const p,
+                              size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    tmpl_CubicSplineDouble spline;
+
+    /*  Start with an empty spline. This is returned on error.                */
+    spline.x = NULL;
+    spline.p = NULL;
+    spline.integral = NULL;
+    spline.length = (size_t)0;
+    spline.buckets = NULL;
+    spline.number_of_buckets = (size_t)0;
+    spline.scale = 0.0;
+    spline.is_uniform = tmpl_False;
+    spline.error_occurred = tmpl_False;
+    spline.error_message = NULL;
+
+    /*  Check for invalid inputs. Treat these as an error.                    */
+    if (!x || !p || len < 2)
+    {
+        spline.error_occurred = tmpl_True;
+        spline.error_message =
+            "\nError Encountered:\n"
+            "    tmpl_CubicSplineDouble_Create\n\n"
+            "Input is NULL or has fewer than two points. Aborting.\n\n";
+
+        return spline;
+    }
+
+    /*  The knots must be strictly increasing. The negated comparison also    *
+     *  rejects NaN.                                                          */
+    for (n = 0; n < len - 1; ++n)
+    {
+        if (!(x[n] < x[n + 1]))
+        {
+            spline.error_occurred = tmpl_True;
+            spline.error_message =
+                "\nError Encountered:\n"
+                "    tmpl_CubicSplineDouble_Create\n\n"
+                "Knots are not strictly increasing. Aborting.\n\n";
+
+            return spline;
+        }
+    }
+
+    /*  Allocate memory for the knots, polynomials, and integrals.            */
+    spline.x = TMPL_MALLOC(double, len);
+    spline.p = TMPL_MALLOC(tmpl_CubicDouble, len - 1);
+    spline.integral = TMPL_MALLOC(double, len);
+    spline.is_uniform = tmpl_cubic_spline_double_is_uniform(x, len);
+
+    /*  Non-uniform grids use one bucket per interval, plus an extra entry.   */
+    if (!spline.is_uniform)
+    {
+        spline.number_of_buckets = len - 1;
+        spline.buckets = TMPL_MALLOC(size_t, len);
+    }
+
+    /*  Check if malloc failed. Abort the computation if it did.              */
+    if (!spline.x || !spline.p || !spline.integral ||
+        (!spline.is_uniform && !spline.buckets))
+    {
+        tmpl_CubicSplineDouble_Destroy(&spline);
+        spline.error_occurred = tmpl_True;
+        spline.error_message =
+            "\nError Encountered:\n"
+            "    tmpl_CubicSplineDouble_Create\n\n"
+            "malloc failed. Aborting.\n\n";
+
+        return spline;
+    }
+
+    spline.length = len;
+
+    /*  Copy the knots and the splining polynomials.                          */
+    for (n = 0; n < len - 1; ++n)
+    {
+        spline.x[n] = x[n];
+        spline.p[n] = p[n];
+    }
+
+    spline.x[len - 1] = x[len - 1];
+
+    /*  Either scale converts x - x[0] to an interval or a bucket index.      */
+    spline.scale = (double)(len - 1) / (x[len - 1] - x[0]);
+
+    /*  Build the bucket table with a merged pass over knots and edges.       */
+    if (!spline.is_uniform)
+    {
+        const double width = (x[len - 1] - x[0]) / (double)(len - 1);
+        size_t b;
+        n = 0;
+
+        for (b = 0; b < len; ++b)
+        {
+            const double edge = x[0] + (double)b * width;
+
+            while (n < len - 2 && x[n + 1] <= edge)
+                ++n;
+
+            spline.buckets[b] = n;
+        }
+    }
+
+    /*  Accumulate the integral over each interval. With t = x[n + 1] - x[n] *
+     *  this is a t + b t^2 / 2 + c t^3 / 3 + d t^4 / 4.                      */
+    spline.integral[0] = 0.0;
+
+    for (n = 0; n < len - 1; ++n)
+    {
+        const double t = x[n + 1] - x[n];
+        const double *c = p[n].dat;
+        const double area =
+            t * (c[0] + t * (0.5 * c[1] + t * (c[2] / 3.0 + t * 0.25 * c[3])));
+
+        spline.integral[n + 1] = spline.integral[n] + area;
+    }
+
+    return spline;
+}
+/*  End of tmpl_CubicSplineDouble_Create.                                     */
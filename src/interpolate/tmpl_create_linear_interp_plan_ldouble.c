@@ -0,0 +1,204 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                   tmpl_create_linear_interp_plan_ldouble                   *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Precomputes the brackets and weights for linearly interpolating data  *
+ *      from one grid onto another.                                           *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_LinearInterpPlanLongDouble_Create                                *
+ *  Purpose:                                                                  *
+ *      Computes, for every point of x_new, the index n with                  *
+ *      x[n] <= x_new[m] < x[n + 1] and the relative position of x_new[m]     *
+ *      between x[n] and x[n + 1].                                            *
+ *  Arguments:                                                                *
+ *      x (const long double * const):                                        *
+ *          A sorted array of real numbers that are monotonically increasing. *
+ *      len (size_t):                                                         *
+ *          The number of elements of x.                                      *
+ *      x_new (const long double * const):                                    *
+ *          The new grid. This does not need to be sorted.                    *
+ *      len_new (size_t):                                                     *
+ *          The number of elements of x_new.                                  *
+ *  Output:                                                                   *
+ *      plan (tmpl_LinearInterpPlanLongDouble):                               *
+ *          The interpolation plan.                                           *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates memory for the indices and weights.                 *
+ *      tmpl_interpolate.h:                                                   *
+ *          tmpl_LinearInterpPlanLongDouble_Destroy:                          *
+ *              Frees the memory if one of the allocations fails.             *
+ *  Method:                                                                   *
+ *      For each x_new[m], first check if it lies in the same bracket as the  *
+ *      previous point. This is the common case for sorted grids where x_new  *
+ *      is finer than x. Otherwise, find the bracket with a binary search.    *
+ *      Given the bracket n, the weight is:                                   *
+ *                                                                            *
+ *                   x_new[m] - x[n]                                          *
+ *          w[m] = -----------------                                          *
+ *                  x[n + 1] - x[n]                                           *
+ *                                                                            *
+ *      Points with x_new[m] <= x[0] get n = 0 and w = 0, and points with     *
+ *      x_new[m] >= x[len - 1] get n = len - 2 and w = 1. This clamps the     *
+ *      output to y[0] and y[len - 1], as tmpl_LDouble_Sorted_Linear_Interp1d *
+ *      does.                                                                 *
+ *  Notes:                                                                    *
+ *      1.) If x or x_new is NULL, if len = 0, or if malloc fails, the        *
+ *          error_occurred Boolean is set.                                    *
+ *                                                                            *
+ *      2.) If len = 1 no indices or weights are needed. Executing the plan   *
+ *          sets every output to y[0].                                        *
+ *                                                                            *
+ *      3.) The plan does not keep a reference to x or x_new. It may be used  *
+ *          with any data y on the x grid.                                    *
+ *                                                                            *
+ *      4.) The output must be freed with                                     *
+ *          tmpl_LinearInterpPlanLongDouble_Destroy.                          *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_malloc.h:                                                        *
+ *          Header file providing the TMPL_MALLOC macro.                      *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_interpolate.h:                                                   *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_MALLOC macro provided here.                                          */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+
+/*  Booleans provided here.                                                   */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_interpolate.h>
+
+/*  Function for precomputing a linear interpolation from x onto x_new.       */
+tmpl_LinearInterpPlanLongDouble
+tmpl_LinearInterpPlanLongDouble_Create(const long double * const x,
+                                       size_t len,
+                                       const long double * const x_new,
+                                       size_t len_new)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t m;
+    size_t n = 0;
+    tmpl_LinearInterpPlanLongDouble plan;
+
+    /*  Start with an empty plan. This is returned on error.                  */
+    plan.index = NULL;
+    plan.weight = NULL;
+    plan.length = (size_t)0;
+    plan.source_length = (size_t)0;
+    plan.error_occurred = tmpl_False;
+    plan.error_message = NULL;
+
+    /*  Check for invalid inputs. Treat these as an error.                    */
+    if (!x || !x_new || len == 0)
+    {
+        plan.error_occurred = tmpl_True;
+        plan.error_message =
+            "\nError Encountered:\n"
+            "    tmpl_LinearInterpPlanLongDouble_Create\n\n"
+            "Input is NULL or empty. Aborting.\n\n";
+
+        return plan;
+    }
+
+    plan.length = len_new;
+    plan.source_length = len;
+
+    /*  With a single source point every output is y[0]. Nothing to store.    */
+    if (len == 1 || len_new == 0)
+        return plan;
+
+    /*  Allocate memory for the indices and the weights.                      */
+    plan.index = TMPL_MALLOC(size_t, len_new);
+    plan.weight = TMPL_MALLOC(long double, len_new);
+
+    /*  Check if malloc failed. Abort the computation if it did.              */
+    if (!plan.index || !plan.weight)
+    {
+        tmpl_LinearInterpPlanLongDouble_Destroy(&plan);
+        plan.error_occurred = tmpl_True;
+        plan.error_message =
+            "\nError Encountered:\n"
+            "    tmpl_LinearInterpPlanLongDouble_Create\n\n"
+            "malloc failed. Aborting.\n\n";
+
+        return plan;
+    }
+
+    /*  Loop over the new grid and compute the brackets and the weights.      */
+    for (m = 0; m < len_new; ++m)
+    {
+        const long double val = x_new[m];
+
+        /*  Points at or to the left of the grid are clamped to y[0].         */
+        if (!(val > x[0]))
+        {
+            plan.index[m] = 0;
+            plan.weight[m] = 0.0L;
+            continue;
+        }
+
+        /*  Points at or to the right of the grid are clamped to y[len - 1].  */
+        if (val >= x[len - 1])
+        {
+            plan.index[m] = len - 2;
+            plan.weight[m] = 1.0L;
+            continue;
+        }
+
+        /*  If val is not in the previous bracket, binary search for it.      */
+        if (val < x[n] || x[n + 1] <= val)
+        {
+            size_t lo = 0;
+            size_t hi = len - 2;
+
+            /*  Find the largest index n with x[n] <= val.                    */
+            while (lo < hi)
+            {
+                const size_t mid = lo + ((hi - lo + 1) >> 1);
+
+                if (x[mid] <= val)
+                    lo = mid;
+                else
+                    hi = mid - 1;
+            }
+
+            n = lo;
+        }
+
+        plan.index[m] = n;
+        plan.weight[m] = (val - x[n]) / (x[n + 1] - x[n]);
+    }
+
+    return plan;
+}
+/*  End of tmpl_LinearInterpPlanLongDouble_Create.                            */
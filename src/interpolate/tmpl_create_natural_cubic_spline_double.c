@@ -0,0 +1,140 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                  tmpl_create_natural_cubic_spline_double                   *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Creates a spline object for the natural cubic spline of a data set.   *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_CubicSplineDouble_Create_Natural                                 *
+ *  Purpose:                                                                  *
+ *      Computes the natural cubic spline of (x, y) and stores it in a spline *
+ *      object that can be evaluated at unsorted points.                      *
+ *  Arguments:                                                                *
+ *      x (const double * const):                                             *
+ *          The knots, strictly increasing.                                   *
+ *      y (const double * const):                                             *
+ *          The data points corresponding to x.                               *
+ *      len (size_t):                                                         *
+ *          The number of elements of x and y. Must be at least 2.            *
+ *  Output:                                                                   *
+ *      spline (tmpl_CubicSplineDouble):                                      *
+ *          The natural cubic spline.                                         *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates temporary memory for the splining polynomials.      *
+ *          free:                                                             *
+ *              Frees the temporary memory.                                   *
+ *      tmpl_interpolate.h:                                                   *
+ *          tmpl_Double_Natural_Cubic_Spline:                                 *
+ *              Computes the coefficients of the natural cubic spline.        *
+ *          tmpl_CubicSplineDouble_Create:                                    *
+ *              Creates the spline object from the coefficients.              *
+ *  Method:                                                                   *
+ *      Compute the coefficients with tmpl_Double_Natural_Cubic_Spline and    *
+ *      pass them to tmpl_CubicSplineDouble_Create. With two points there is  *
+ *      no tridiagonal system to solve and the spline is the line between     *
+ *      the points.                                                           *
+ *  Notes:                                                                    *
+ *      1.) Invalid inputs, or a failed malloc, set the error_occurred        *
+ *          Boolean of the output.                                            *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_malloc.h:                                                        *
+ *          Header file providing the TMPL_MALLOC macro.                      *
+ *  2.) tmpl_free.h:                                                          *
+ *          Header file providing the TMPL_FREE macro.                        *
+ *  3.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  4.) tmpl_interpolate.h:                                                   *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_MALLOC and TMPL_FREE macros provided here.                           */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Booleans provided here.                                                   */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_interpolate.h>
+
+/*  Function for creating the natural cubic spline of a data set.             */
+tmpl_CubicSplineDouble
+tmpl_CubicSplineDouble_Create_Natural(const double * const x,
+                                      const double * const y,
+                                      size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    tmpl_CubicSplineDouble spline;
+    tmpl_CubicDouble *p;
+
+    /*  Check for invalid inputs. Treat these as an error.                    */
+    if (!x || !y || len < 2)
+    {
+        spline = tmpl_CubicSplineDouble_Create(NULL, NULL, 0);
+        spline.error_message =
+            "\nError Encountered:\n"
+            "    tmpl_CubicSplineDouble_Create_Natural\n\n"
+            "Input is NULL or has fewer than two points. Aborting.\n\n";
+
+        return spline;
+    }
+
+    /*  Temporary space for the coefficients. These are copied into spline.   */
+    p = TMPL_MALLOC(tmpl_CubicDouble, len - 1);
+
+    /*  Check if malloc failed. Abort the computation if it did.              */
+    if (!p)
+    {
+        spline = tmpl_CubicSplineDouble_Create(NULL, NULL, 0);
+        spline.error_message =
+            "\nError Encountered:\n"
+            "    tmpl_CubicSplineDouble_Create_Natural\n\n"
+            "malloc failed. Aborting.\n\n";
+
+        return spline;
+    }
+
+    /*  The natural spline needs at least three points. Use a line for two.   */
+    if (len == 2)
+    {
+        p[0].dat[0] = y[0];
+        p[0].dat[1] = (y[1] - y[0]) / (x[1] - x[0]);
+        p[0].dat[2] = 0.0;
+        p[0].dat[3] = 0.0;
+    }
+
+    else
+        tmpl_Double_Natural_Cubic_Spline(x, y, p, len);
+
+    /*  Copy the data into the spline object and build the lookup table.      */
+    spline = tmpl_CubicSplineDouble_Create(x, p, len);
+    TMPL_FREE(p);
+    return spline;
+}
+/*  End of tmpl_CubicSplineDouble_Create_Natural.                             */
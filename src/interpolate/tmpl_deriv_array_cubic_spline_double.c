@@ -0,0 +1,89 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                    tmpl_deriv_array_cubic_spline_double                    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the derivatives of a cubic spline at an array of points.     *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_CubicSplineDouble_Deriv_Array                                    *
+ *  Purpose:                                                                  *
+ *      Computes the derivatives of a spline at unsorted points.              *
+ *  Arguments:                                                                *
+ *      spline (const tmpl_CubicSplineDouble * const):                        *
+ *          A spline created by tmpl_CubicSplineDouble_Create.                *
+ *      x_new (const double * const):                                         *
+ *          The points. These do not need to be sorted.                       *
+ *      dy_new (double * const):                                              *
+ *          The derivatives of the spline at x_new.                           *
+ *      len_new (size_t):                                                     *
+ *          The number of elements of x_new and dy_new.                       *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_interpolate.h:                                                   *
+ *          tmpl_CubicSplineDouble_Deriv:                                     *
+ *              Computes the derivative of the spline at a single point.      *
+ *  Method:                                                                   *
+ *      Loop over the points. Each lookup is O(1) on uniform grids and O(1)   *
+ *      on average for non-uniform ones, so unlike                            *
+ *      tmpl_Double_Sorted_Cubic_Interp1d the points do not need to be        *
+ *      sorted first.                                                         *
+ *  Notes:                                                                    *
+ *      1.) If any of the pointers are NULL, or if the spline has an error,   *
+ *          nothing is done.                                                  *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_interpolate.h:                                                   *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_interpolate.h>
+
+/*  Function for computing the derivatives of a cubic spline over an array.   */
+void
+tmpl_CubicSplineDouble_Deriv_Array(
+    const tmpl_CubicSplineDouble * const spline,
+    const double * const x_new,
+    double * const dy_new,
+    size_t len_new
+)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!spline || !x_new || !dy_new)
+        return;
+
+    if (spline->error_occurred || spline->length < 2)
+        return;
+
+    /*  The points may be in any order, each is looked up independently.      */
+    for (n = 0; n < len_new; ++n)
+        dy_new[n] = tmpl_CubicSplineDouble_Deriv(spline, x_new[n]);
+}
+/*  End of tmpl_CubicSplineDouble_Deriv_Array.                                */
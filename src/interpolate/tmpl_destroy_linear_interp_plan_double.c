@@ -0,0 +1,55 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                   tmpl_destroy_linear_interp_plan_double                   *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Frees the memory in a linear interpolation plan.                      *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_FREE macro provided here.                                            */
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Booleans provided here.                                                   */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_interpolate.h>
+
+/*  Function for freeing the memory in a linear interpolation plan.           */
+void
+tmpl_LinearInterpPlanDouble_Destroy(tmpl_LinearInterpPlanDouble * const plan)
+{
+    /*  Nothing to do for a NULL pointer.                                     */
+    if (!plan)
+        return;
+
+    /*  TMPL_FREE sets the pointers to NULL after freeing them.               */
+    TMPL_FREE(plan->index);
+    TMPL_FREE(plan->weight);
+
+    /*  Reset the remaining parameters to those of an empty plan.             */
+    plan->length = (size_t)0;
+    plan->source_length = (size_t)0;
+    plan->error_occurred = tmpl_False;
+    plan->error_message = NULL;
+}
+/*  End of tmpl_LinearInterpPlanDouble_Destroy.                               */
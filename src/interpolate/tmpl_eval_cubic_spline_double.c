@@ -0,0 +1,98 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                       tmpl_eval_cubic_spline_double                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Evaluates a cubic spline at a point.                                  *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_CubicSplineDouble_Eval                                           *
+ *  Purpose:                                                                  *
+ *      Computes the value of a spline at an arbitrary point.                 *
+ *  Arguments:                                                                *
+ *      spline (const tmpl_CubicSplineDouble * const):                        *
+ *          A spline created by tmpl_CubicSplineDouble_Create.                *
+ *      val (double):                                                         *
+ *          A real number.                                                    *
+ *  Output:                                                                   *
+ *      y (double):                                                           *
+ *          The value of the spline at val.                                   *
+ *  Called Functions:                                                         *
+ *      tmpl_interpolate.h:                                                   *
+ *          tmpl_CubicSplineDouble_Find_Interval:                             *
+ *              Finds the index n with x[n] <= val < x[n + 1].                *
+ *  Method:                                                                   *
+ *      Find the interval n containing val and evaluate the nth polynomial at *
+ *      val - x[n] using Horner's method. Outside of the knots, the spline is *
+ *      extended linearly using the value and slope at the nearest endpoint.  *
+ *  Notes:                                                                    *
+ *      1.) No error checking is done. spline should be a valid spline with   *
+ *          at least two knots.                                               *
+ *                                                                            *
+ *      2.) The extrapolation is the same as the one used by                  *
+ *          tmpl_Double_Sorted_Cubic_Interp1d.                                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_cubic_double.h:                                                  *
+ *          Header providing cubic polynomials and helper macros.             *
+ *  2.) tmpl_interpolate.h:                                                   *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Cubic polynomial typedef and helper macros provided here.                 */
+#include <libtmpl/include/types/tmpl_cubic_double.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_interpolate.h>
+
+/*  Function for evaluating a cubic spline at a point.                        */
+double
+tmpl_CubicSplineDouble_Eval(const tmpl_CubicSplineDouble * const spline,
+                            double val)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const double * const x = spline->x;
+    const tmpl_CubicDouble * const p = spline->p;
+    const size_t last = spline->length - 1;
+    size_t n;
+
+    /*  To the left of the knots, extend the first polynomial linearly.       */
+    if (val < x[0])
+        return p[0].dat[0] + p[0].dat[1] * (val - x[0]);
+
+    /*  To the right, use the value and slope at the final knot.              */
+    if (val > x[last])
+    {
+        const double t = x[last] - x[last - 1];
+        const double a = TMPL_CUBIC_DOUBLE_EVAL(p[last - 1], t);
+        const double b = TMPL_CUBIC_DOUBLE_DERIV_EVAL(p[last - 1], t);
+        return a + b * (val - x[last]);
+    }
+
+    /*  General case, evaluate the polynomial for the interval containing val.*/
+    n = tmpl_CubicSplineDouble_Find_Interval(spline, val);
+    return TMPL_CUBIC_DOUBLE_EVAL(p[n], val - x[n]);
+}
+/*  End of tmpl_CubicSplineDouble_Eval.                                       */
@@ -0,0 +1,113 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                  tmpl_execute_linear_interp_plan_ldouble                   *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Applies a precomputed linear interpolation plan to a data set.        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_LinearInterpPlanLongDouble_Execute                               *
+ *  Purpose:                                                                  *
+ *      Interpolates data y on the source grid of the plan onto its new grid. *
+ *  Arguments:                                                                *
+ *      plan (const tmpl_LinearInterpPlanLongDouble * const):                 *
+ *          A plan created by tmpl_LinearInterpPlanLongDouble_Create.         *
+ *      y (const long double * const):                                        *
+ *          The data on the source grid. This has plan->source_length points. *
+ *      y_new (long double * const):                                          *
+ *          The interpolated data. This has plan->length points.              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      All of the searching was done when the plan was created. Each output  *
+ *      is a gather of two neighbouring values and a weighted sum:            *
+ *                                                                            *
+ *          y_new[m] = (1 - w[m]) y[n[m]] + w[m] y[n[m] + 1]                  *
+ *                                                                            *
+ *      The iterations are independent, so the loop is branch-free and the    *
+ *      compiler may vectorize it. With OpenMP support, long arrays are split *
+ *      across threads.                                                       *
+ *  Notes:                                                                    *
+ *      1.) If any of the pointers are NULL, or if the plan has an error,     *
+ *          nothing is done.                                                  *
+ *                                                                            *
+ *      2.) For clamped points the weight is exactly 0 or 1, so the output is *
+ *          exactly y[0] or y[len - 1].                                       *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_interpolate.h:                                                   *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_interpolate.h>
+
+/*  Function for applying a linear interpolation plan to a data set.          */
+void
+tmpl_LinearInterpPlanLongDouble_Execute(
+    const tmpl_LinearInterpPlanLongDouble * const plan,
+    const long double * const y,
+    long double * const y_new
+)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t m, length;
+    const size_t *index;
+    const long double *weight;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!plan || !y || !y_new)
+        return;
+
+    if (plan->error_occurred || plan->length == 0)
+        return;
+
+    /*  With a single source point, every output is y[0].                     */
+    if (plan->source_length == 1)
+    {
+        for (m = 0; m < plan->length; ++m)
+            y_new[m] = y[0];
+
+        return;
+    }
+
+    length = plan->length;
+    index = plan->index;
+    weight = plan->weight;
+
+    /*  Gather the two neighbours and take the weighted sum.                  */
+#ifdef _OPENMP
+#pragma omp parallel for if(length >= TMPL_INTERPOLATE_PARALLEL_MIN_LENGTH)
+#endif
+    for (m = 0; m < length; ++m)
+    {
+        const size_t n = index[m];
+        const long double w = weight[m];
+        y_new[m] = (1.0L - w) * y[n] + w * y[n + 1];
+    }
+}
+/*  End of tmpl_LinearInterpPlanLongDouble_Execute.                           */
@@ -0,0 +1,135 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                   tmpl_find_interval_cubic_spline_double                   *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Finds the interval of a cubic spline containing a given point.        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_CubicSplineDouble_Find_Interval                                  *
+ *  Purpose:                                                                  *
+ *      Computes the index n with x[n] <= val < x[n + 1].                     *
+ *  Arguments:                                                                *
+ *      spline (const tmpl_CubicSplineDouble * const):                        *
+ *          A spline created by tmpl_CubicSplineDouble_Create.                *
+ *      val (double):                                                         *
+ *          A real number.                                                    *
+ *  Output:                                                                   *
+ *      n (size_t):                                                           *
+ *          The index of the interval containing val.                         *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Uniform grids:                                                        *
+ *          The index is (val - x[0]) * scale rounded down, where scale is    *
+ *          the reciprocal of the average step. Since every knot is within a  *
+ *          quarter step of its ideal position, this guess is off by at most  *
+ *          one, and the guess is corrected by comparing against the knots.   *
+ *      Non-uniform grids:                                                    *
+ *          The bucket index is (val - x[0]) * scale rounded down. The answer *
+ *          lies between buckets[b] and buckets[b + 1], and is found with a   *
+ *          binary search over this range. Rounding in the bucket edges may   *
+ *          put the answer one interval away, so the result is corrected by   *
+ *          comparing against the knots in the same way.                      *
+ *  Notes:                                                                    *
+ *      1.) Values below x[0], and NaN, give 0. Values at or above the last   *
+ *          knot give length - 2.                                             *
+ *                                                                            *
+ *      2.) No error checking is done. spline should be a valid spline with   *
+ *          at least two knots.                                               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_interpolate.h:                                                   *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_interpolate.h>
+
+/*  Function for finding the interval of a spline containing a point.         */
+size_t
+tmpl_CubicSplineDouble_Find_Interval(
+    const tmpl_CubicSplineDouble * const spline,
+    double val
+)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    const double * const x = spline->x;
+    const size_t last = spline->length - 2;
+
+    /*  Points to the left of the spline, and NaN, use the first interval.    */
+    if (!(val > x[0]))
+        return 0;
+
+    /*  Points to the right of the spline use the last interval.              */
+    if (val >= x[last + 1])
+        return last;
+
+    /*  Uniform grids, the index can be computed directly.                    */
+    if (spline->is_uniform)
+    {
+        n = (size_t)((val - x[0]) * spline->scale);
+
+        if (n > last)
+            n = last;
+    }
+
+    /*  Non-uniform grids, search the short range given by the bucket table.  */
+    else
+    {
+        size_t lo, hi;
+        size_t b = (size_t)((val - x[0]) * spline->scale);
+
+        if (b >= spline->number_of_buckets)
+            b = spline->number_of_buckets - 1;
+
+        lo = spline->buckets[b];
+        hi = spline->buckets[b + 1];
+
+        /*  Find the largest index lo <= n <= hi with x[n] <= val.            */
+        while (lo < hi)
+        {
+            const size_t mid = lo + ((hi - lo + 1) >> 1);
+
+            if (x[mid] <= val)
+                lo = mid;
+            else
+                hi = mid - 1;
+        }
+
+        n = lo;
+    }
+
+    /*  Correct for rounding errors in the computation of the index.          */
+    while (n > 0 && val < x[n])
+        --n;
+
+    while (n < last && val >= x[n + 1])
+        ++n;
+
+    return n;
+}
+/*  End of tmpl_CubicSplineDouble_Find_Interval.                              */
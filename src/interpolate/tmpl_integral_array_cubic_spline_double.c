@@ -0,0 +1,93 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                  tmpl_integral_array_cubic_spline_double                   *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the integrals of a cubic spline over arrays of intervals.    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_CubicSplineDouble_Integral_Array                                 *
+ *  Purpose:                                                                  *
+ *      Computes the integrals of a spline from a[n] to b[n].                 *
+ *  Arguments:                                                                *
+ *      spline (const tmpl_CubicSplineDouble * const):                        *
+ *          A spline created by tmpl_CubicSplineDouble_Create.                *
+ *      a (const double * const):                                             *
+ *          The lower limits of integration.                                  *
+ *      b (const double * const):                                             *
+ *          The upper limits of integration.                                  *
+ *      out (double * const):                                                 *
+ *          The integrals from a[n] to b[n].                                  *
+ *      len (size_t):                                                         *
+ *          The number of elements of a, b, and out.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_interpolate.h:                                                   *
+ *          tmpl_CubicSplineDouble_Integral:                                  *
+ *              Computes the integral of the spline over a single interval.   *
+ *  Method:                                                                   *
+ *      Loop over the intervals. Each integral is the difference of two       *
+ *      antiderivatives, and each antiderivative costs a single lookup.       *
+ *  Notes:                                                                    *
+ *      1.) If any of the pointers are NULL, or if the spline has an error,   *
+ *          nothing is done.                                                  *
+ *                                                                            *
+ *      2.) out may point to a or b, the inputs are read before the output is *
+ *          written.                                                          *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_interpolate.h:                                                   *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_interpolate.h>
+
+/*  Function for integrating a cubic spline over arrays of intervals.         */
+void
+tmpl_CubicSplineDouble_Integral_Array(
+    const tmpl_CubicSplineDouble * const spline,
+    const double * const a,
+    const double * const b,
+    double * const out,
+    size_t len
+)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!spline || !a || !b || !out)
+        return;
+
+    if (spline->error_occurred || spline->length < 2)
+        return;
+
+    /*  Compute each integral independently.                                  */
+    for (n = 0; n < len; ++n)
+        out[n] = tmpl_CubicSplineDouble_Integral(spline, a[n], b[n]);
+}
+/*  End of tmpl_CubicSplineDouble_Integral_Array.                             */
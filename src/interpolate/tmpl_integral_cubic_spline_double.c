@@ -0,0 +1,71 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                     tmpl_integral_cubic_spline_double                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the integral of a cubic spline over an interval.             *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_CubicSplineDouble_Integral                                       *
+ *  Purpose:                                                                  *
+ *      Computes the integral of the spline from a to b.                      *
+ *  Arguments:                                                                *
+ *      spline (const tmpl_CubicSplineDouble * const):                        *
+ *          A spline created by tmpl_CubicSplineDouble_Create.                *
+ *      a (double):                                                           *
+ *          The lower limit of integration.                                   *
+ *      b (double):                                                           *
+ *          The upper limit of integration.                                   *
+ *  Output:                                                                   *
+ *      integral (double):                                                    *
+ *          The integral of the spline from a to b.                           *
+ *  Called Functions:                                                         *
+ *      tmpl_interpolate.h:                                                   *
+ *          tmpl_CubicSplineDouble_Antiderivative:                            *
+ *              Computes the integral of the spline from x[0] to a point.     *
+ *  Method:                                                                   *
+ *      By the fundamental theorem of calculus, this is F(b) - F(a) where F   *
+ *      is the antiderivative of the spline with F(x[0]) = 0.                 *
+ *  Notes:                                                                    *
+ *      1.) If b < a the result is negative, as usual.                        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_interpolate.h:                                                   *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_interpolate.h>
+
+/*  Function for integrating a cubic spline over an interval.                 */
+double
+tmpl_CubicSplineDouble_Integral(const tmpl_CubicSplineDouble * const spline,
+                                double a, double b)
+{
+    const double upper = tmpl_CubicSplineDouble_Antiderivative(spline, b);
+    const double lower = tmpl_CubicSplineDouble_Antiderivative(spline, a);
+    return upper - lower;
+}
+/*  End of tmpl_CubicSplineDouble_Integral.                                   */
@@ -0,0 +1,147 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                         tmpl_poly_eval_array_float                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Evaluates a polynomial at every element of an array.                  *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Float_Poly_Eval_Array                                            *
+ *  Purpose:                                                                  *
+ *      Evaluates a polynomial at many real numbers using Horner's method.    *
+ *  Arguments:                                                                *
+ *      coeffs (const float * const):                                         *
+ *          The coefficients array for the polynomial.                        *
+ *      degree (size_t):                                                      *
+ *          The degree of the polynomial. There must be at least degree + 1   *
+ *          elements in the coeffs array.                                     *
+ *      x (const float * const):                                              *
+ *          The points where the polynomial is evaluated.                     *
+ *      y (float * const):                                                    *
+ *          The values of the polynomial at the points x.                     *
+ *      len (size_t):                                                         *
+ *          The number of elements in x and y.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_math.h:                                                          *
+ *          tmpl_Float_Poly_Eval:                                             *
+ *              Evaluates the polynomial at the last few points.              *
+ *  Method:                                                                   *
+ *      Horner's method is a chain of dependent multiply-adds, so one chain   *
+ *      runs at the latency of the multiply-add, not its throughput. Run      *
+ *      TMPL_POLY_EVAL_ARRAY_LANES chains at once, one per point, sharing     *
+ *      each coefficient load. The inner loop over the lanes has a fixed      *
+ *      length and independent iterations, so the compiler may vectorize it.  *
+ *      With OpenMP support, long arrays are split across threads. Points     *
+ *      left over after the last full block use tmpl_Float_Poly_Eval.         *
+ *  Notes:                                                                    *
+ *      1.) Each output is computed with the same operations, in the same     *
+ *          order, as tmpl_Float_Poly_Eval.                                   *
+ *                                                                            *
+ *      2.) If x or y is NULL nothing is done. If coeffs is NULL, the         *
+ *          polynomial is treated as zero. y may be the same array as x.      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file with the functions prototype.                         *
+ *  2.) stddef.h:                                                             *
+ *          Standard library header with the size_t typedef.                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  size_t typedef is here.                                                   */
+#include <stddef.h>
+
+/*  Function prototype given here.                                            */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Number of Horner chains that are run at the same time.                    */
+#define TMPL_POLY_EVAL_ARRAY_LANES (8)
+
+/*  Function for evaluating a polynomial at many points.                      */
+void
+tmpl_Float_Poly_Eval_Array(const float * const coeffs,
+                           size_t degree,
+                           const float * const x,
+                           float * const y,
+                           size_t len)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    size_t n, block;
+    const size_t blocks = len / TMPL_POLY_EVAL_ARRAY_LANES;
+
+    /*  Nothing can be done if there is nowhere to read from or write to.     */
+    if (!x || !y)
+        return;
+
+    /*  A NULL coefficient array is treated as the zero polynomial.           */
+    if (!coeffs)
+    {
+        for (n = 0; n < len; ++n)
+            y[n] = 0.0F;
+
+        return;
+    }
+
+    /*  Evaluate the polynomial at TMPL_POLY_EVAL_ARRAY_LANES points at once. */
+#ifdef _OPENMP
+#pragma omp parallel for if(len >= TMPL_POLY_EVAL_PARALLEL_MIN_LENGTH)
+#endif
+    for (block = 0; block < blocks; ++block)
+    {
+        /*  Declare necessary variables. C89 requires this at the top.        */
+        float point[TMPL_POLY_EVAL_ARRAY_LANES];
+        float poly[TMPL_POLY_EVAL_ARRAY_LANES];
+        const size_t start = block * TMPL_POLY_EVAL_ARRAY_LANES;
+        size_t k, lane;
+
+        /*  Copy the points first. This allows y to be the same array as x.   */
+        for (lane = 0; lane < TMPL_POLY_EVAL_ARRAY_LANES; ++lane)
+        {
+            point[lane] = x[start + lane];
+            poly[lane] = coeffs[degree];
+        }
+
+        /*  Horner's method, with one independent chain for each lane.        */
+        for (k = degree; k > 0; --k)
+        {
+            const float c = coeffs[k - 1];
+
+            for (lane = 0; lane < TMPL_POLY_EVAL_ARRAY_LANES; ++lane)
+                poly[lane] = point[lane] * poly[lane] + c;
+        }
+
+        for (lane = 0; lane < TMPL_POLY_EVAL_ARRAY_LANES; ++lane)
+            y[start + lane] = poly[lane];
+    }
+
+    /*  Handle the points that do not fill a block.                           */
+    for (n = blocks * TMPL_POLY_EVAL_ARRAY_LANES; n < len; ++n)
+        y[n] = tmpl_Float_Poly_Eval(coeffs, degree, x[n]);
+}
+/*  End of tmpl_Float_Poly_Eval_Array.                                        */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_POLY_EVAL_ARRAY_LANES
@@ -0,0 +1,30 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************/
+
+/*  tmpl_DoubleDouble typedef and table declaration given here.               */
+#include <libtmpl/include/tables/tmpl_doubledouble_tables.h>
+
+/*  The values cos(pi * k / 16) for k = 0, 1, ..., 4, split as hi + lo.       */
+const tmpl_DoubleDouble tmpl_doubledouble_cospi16_table[5] = {
+    {{+1.000000000000000000000000E+00, +0.000000000000000000000000E+00}},
+    {{+9.807852804032304305792422E-01, +1.854693999782500572590833E-17}},
+    {{+9.238795325112867384831361E-01, +1.764504708433667705995697E-17}},
+    {{+8.314696123025452356714027E-01, +1.407385698472802389307852E-18}},
+    {{+7.071067811865475727373109E-01, -4.833646656726456725527350E-17}}
+};
@@ -0,0 +1,43 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************/
+
+/*  tmpl_DoubleDouble typedef and table declaration given here.               */
+#include <libtmpl/include/tables/tmpl_doubledouble_tables.h>
+
+/*  The values 1 / n! for n = 0, 1, ..., 17, split as hi + lo.                */
+const tmpl_DoubleDouble tmpl_doubledouble_rcpr_factorial_table[18] = {
+    {{+1.000000000000000000000000E+00, +0.000000000000000000000000E+00}},
+    {{+1.000000000000000000000000E+00, +0.000000000000000000000000E+00}},
+    {{+5.000000000000000000000000E-01, +0.000000000000000000000000E+00}},
+    {{+1.666666666666666574148081E-01, +9.251858538542970656615612E-18}},
+    {{+4.166666666666666435370203E-02, +2.312964634635742664153903E-18}},
+    {{+8.333333333333333217685102E-03, +1.156482317317871380225200E-19}},
+    {{+1.388888888888888941894328E-03, -5.300543954373577059056649E-20}},
+    {{+1.984126984126984125263171E-04, +1.720955829342070528677869E-22}},
+    {{+2.480158730158730156578964E-05, +2.151194786677588160847336E-23}},
+    {{+2.755731922398589251095059E-06, -1.858393274046472081039227E-22}},
+    {{+2.755731922398588827578586E-07, +2.376771462225029731851820E-23}},
+    {{+2.505210838544172022386618E-08, -1.448814070935911966029308E-24}},
+    {{+2.087675698786810018655515E-09, -1.207345059113259971691090E-25}},
+    {{+1.605904383682161334086292E-10, +1.258529458875209805211658E-26}},
+    {{+1.147074559772972450729657E-11, +2.065551275283074542453960E-28}},
+    {{+7.647163731819816405513844E-13, +7.038728777334530010612468E-30}},
+    {{+4.779477332387385253446153E-14, +4.399205485834081256632793E-31}},
+    {{+2.811457254345520598110518E-15, +1.650884273086143259940274E-31}}
+};
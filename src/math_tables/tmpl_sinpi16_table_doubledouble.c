@@ -0,0 +1,30 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************/
+
+/*  tmpl_DoubleDouble typedef and table declaration given here.               */
+#include <libtmpl/include/tables/tmpl_doubledouble_tables.h>
+
+/*  The values sin(pi * k / 16) for k = 0, 1, ..., 4, split as hi + lo.       */
+const tmpl_DoubleDouble tmpl_doubledouble_sinpi16_table[5] = {
+    {{+0.000000000000000000000000E+00, +0.000000000000000000000000E+00}},
+    {{+1.950903220161282758393639E-01, -7.991079068461731263442897E-18}},
+    {{+3.826834323650897817792327E-01, -1.005077269646158761168666E-17}},
+    {{+5.555702330196021776487214E-01, +4.709410940561676821384049E-17}},
+    {{+7.071067811865475727373109E-01, -4.833646656726456725527350E-17}}
+};
@@ -0,0 +1,37 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************/
+
+/*  Table declaration given here.                                             */
+#include <libtmpl/include/tables/tmpl_doubledouble_tables.h>
+
+/*  The first 1280 bits of 2 / pi, 16 bits per entry. Entry k - 1 holds the   *
+ *  bits with weights 2^-(16k - 15) down to 2^-16k, so that                   *
+ *  2 / pi = sum table[k - 1] 2^-16k. Used for Payne-Hanek reduction.         */
+const unsigned int tmpl_doubledouble_two_by_pi_table[80] = {
+    0xA2F9U, 0x836EU, 0x4E44U, 0x1529U, 0xFC27U, 0x57D1U, 0xF534U, 0xDDC0U,
+    0xDB62U, 0x9599U, 0x3C43U, 0x9041U, 0xFE51U, 0x63ABU, 0xDEBBU, 0xC561U,
+    0xB724U, 0x6E3AU, 0x424DU, 0xD2E0U, 0x0649U, 0x2EEAU, 0x09D1U, 0x921CU,
+    0xFE1DU, 0xEB1CU, 0xB129U, 0xA73EU, 0xE882U, 0x35F5U, 0x2EBBU, 0x4484U,
+    0xE99CU, 0x7026U, 0xB45FU, 0x7E41U, 0x3991U, 0xD639U, 0x8353U, 0x39F4U,
+    0x9C84U, 0x5F8BU, 0xBDF9U, 0x283BU, 0x1FF8U, 0x97FFU, 0xDE05U, 0x980FU,
+    0xEF2FU, 0x118BU, 0x5A0AU, 0x6D1FU, 0x6D36U, 0x7ECFU, 0x27CBU, 0x09B7U,
+    0x4F46U, 0x3F66U, 0x9E5FU, 0xEA2DU, 0x7527U, 0xBAC7U, 0xEBE5U, 0xF17BU,
+    0x3D07U, 0x39F7U, 0x8A52U, 0x92EAU, 0x6BFBU, 0x5FB1U, 0x1F8DU, 0x5D08U,
+    0x5603U, 0x3046U, 0xFC7BU, 0x6BABU, 0xF0CFU, 0xBC20U, 0x9AF4U, 0x361DU
+};
@@ -0,0 +1,306 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                      tmpl_intpolynomial_fast_multiply                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides the tools shared by the sub-quadratic multiplication kernels *
+ *      for polynomials with int coefficients.                                *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_intpoly_karatsuba                                                *
+ *  Purpose:                                                                  *
+ *      Multiplies two arrays of n words using Karatsuba's method.            *
+ *  Arguments:                                                                *
+ *      a (const tmpl_intpoly_word *):                                        *
+ *          The first array, n elements.                                      *
+ *      b (const tmpl_intpoly_word *):                                        *
+ *          The second array, n elements.                                     *
+ *      n (size_t):                                                           *
+ *          The number of elements in a and b.                                *
+ *      out (tmpl_intpoly_word *):                                            *
+ *          The product, 2n - 1 elements. Must not overlap a, b, or scratch.  *
+ *      scratch (tmpl_intpoly_word *):                                        *
+ *          Workspace with tmpl_intpoly_karatsuba_scratch(n) elements.        *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      Write a = a0 + a1 x^h and b = b0 + b1 x^h with h = floor(n / 2).      *
+ *      Then a b = z0 + z1 x^h + z2 x^2h where z0 = a0 b0, z2 = a1 b1, and:   *
+ *                                                                            *
+ *          z1 = (a0 + a1)(b0 + b1) - z0 - z2                                 *
+ *                                                                            *
+ *      Three half-size products replace four, giving O(n^log2(3)). Below     *
+ *      TMPL_INTPOLY_KARATSUBA_THRESHOLD the classical method is faster and   *
+ *      is used instead. z0 and z2 are written directly into out, the sums    *
+ *      and z1 live in scratch, and the recursive calls use the rest of       *
+ *      scratch. Nothing is allocated.                                        *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_intpoly_unbalanced_product                                       *
+ *  Purpose:                                                                  *
+ *      Multiplies int arrays of different lengths using a balanced kernel.   *
+ *  Method:                                                                   *
+ *      The longer array is cut into blocks as long as the shorter one. Each  *
+ *      block is multiplied by the shorter array with the balanced kernel and *
+ *      the partial products are added into an accumulator.                   *
+ ******************************************************************************
+ *  Notes:                                                                    *
+ *      1.) All of the arithmetic is done with unsigned words, which wrap     *
+ *          around modulo 2^N instead of overflowing. The coefficients are    *
+ *          converted back to int at the very end. Whenever the classical     *
+ *          product fits in an int, the result is identical to it.            *
+ *                                                                            *
+ *      2.) The words are at least twice as wide as an int when the platform  *
+ *          allows. This headroom is what lets Toom-Cook divide by two.       *
+ *                                                                            *
+ *      3.) This file is not part of the public API. It is only included by   *
+ *          the multiplication kernels in this directory.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_INTPOLYNOMIAL_FAST_MULTIPLY_H
+#define TMPL_INTPOLYNOMIAL_FAST_MULTIPLY_H
+
+/*  TMPL_HAS_LONGLONG macro provided here.                                    */
+#include <libtmpl/include/tmpl_inttype.h>
+
+/*  Bit widths of the unsigned integer types.                                 */
+#include <libtmpl/include/tmpl_limits.h>
+
+/*  Polynomial typedefs and threshold macros.                                 */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  INT_MAX and UINT_MAX found here.                                          */
+#include <limits.h>
+
+/*  Pick the narrowest word that is at least twice as wide as an int.         */
+#if TMPL_ULONG_BIT >= 2 * TMPL_UINT_BIT
+typedef unsigned long int tmpl_intpoly_word;
+#define TMPL_INTPOLY_WORD_BIT TMPL_ULONG_BIT
+#elif TMPL_HAS_LONGLONG == 1
+typedef unsigned long long int tmpl_intpoly_word;
+#define TMPL_INTPOLY_WORD_BIT TMPL_ULLONG_BIT
+#else
+typedef unsigned long int tmpl_intpoly_word;
+#define TMPL_INTPOLY_WORD_BIT TMPL_ULONG_BIT
+#endif
+
+/*  Toom-Cook loses one bit of each word per level of recursion. Only enable  *
+ *  it if the words have at least an int's worth of spare bits.               */
+#if TMPL_INTPOLY_WORD_BIT >= 2 * TMPL_UINT_BIT
+#define TMPL_INTPOLY_HAS_TOOM3 1
+#else
+#define TMPL_INTPOLY_HAS_TOOM3 0
+#endif
+
+/*  Signature shared by the balanced kernels, Karatsuba and Toom-3.           */
+typedef void
+(*tmpl_intpoly_balanced_kernel)(const tmpl_intpoly_word *a,
+                                const tmpl_intpoly_word *b,
+                                size_t n,
+                                tmpl_intpoly_word *out,
+                                tmpl_intpoly_word *scratch);
+
+/*  Converts a word back to an int, keeping the low bits. This avoids the     *
+ *  implementation-defined conversion of large unsigned values to int.        */
+static int tmpl_intpoly_word_to_int(tmpl_intpoly_word w)
+{
+    const unsigned int u = (unsigned int)(w & (tmpl_intpoly_word)UINT_MAX);
+
+    if (u <= (unsigned int)INT_MAX)
+        return (int)u;
+
+    return -(int)(UINT_MAX - u) - 1;
+}
+/*  End of tmpl_intpoly_word_to_int.                                          */
+
+/*  Classical product, used for the base case of the recursion.               */
+static void
+tmpl_intpoly_naive(const tmpl_intpoly_word *a,
+                   const tmpl_intpoly_word *b,
+                   size_t n,
+                   tmpl_intpoly_word *out)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t i, j;
+
+    for (i = 0; i < 2 * n - 1; ++i)
+        out[i] = 0;
+
+    for (i = 0; i < n; ++i)
+        for (j = 0; j < n; ++j)
+            out[i + j] += a[i] * b[j];
+}
+/*  End of tmpl_intpoly_naive.                                                */
+
+/*  Number of words of scratch space needed by tmpl_intpoly_karatsuba.        */
+static size_t tmpl_intpoly_karatsuba_scratch(size_t n)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t total = 0;
+
+    /*  Each level stores the two sums (hi words each) and their product.     */
+    while (n >= TMPL_INTPOLY_KARATSUBA_THRESHOLD)
+    {
+        const size_t hi = n - (n >> 1);
+        total += 4 * hi - 1;
+        n = hi;
+    }
+
+    return total;
+}
+/*  End of tmpl_intpoly_karatsuba_scratch.                                    */
+
+/*  Balanced Karatsuba product of two arrays of length n.                     */
+static void
+tmpl_intpoly_karatsuba(const tmpl_intpoly_word *a,
+                       const tmpl_intpoly_word *b,
+                       size_t n,
+                       tmpl_intpoly_word *out,
+                       tmpl_intpoly_word *scratch)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t i, lo, hi;
+    tmpl_intpoly_word *sa, *sb, *z1, *rest;
+
+    /*  Small products are faster with the classical method.                  */
+    if (n < TMPL_INTPOLY_KARATSUBA_THRESHOLD)
+    {
+        tmpl_intpoly_naive(a, b, n, out);
+        return;
+    }
+
+    /*  Split into a low half of lo words and a high half of hi >= lo words.  */
+    lo = n >> 1;
+    hi = n - lo;
+
+    /*  Carve the scratch space. The remainder is for the recursive calls.    */
+    sa = scratch;
+    sb = sa + hi;
+    z1 = sb + hi;
+    rest = z1 + (2 * hi - 1);
+
+    /*  z0 = a0 b0 goes in out[0, 2 lo - 1), z2 = a1 b1 in out[2 lo, 2n - 1). */
+    tmpl_intpoly_karatsuba(a, b, lo, out, rest);
+    tmpl_intpoly_karatsuba(a + lo, b + lo, hi, out + 2 * lo, rest);
+    out[2 * lo - 1] = 0;
+
+    /*  The sums a0 + a1 and b0 + b1. The high halves may be one longer.      */
+    for (i = 0; i < lo; ++i)
+    {
+        sa[i] = a[i] + a[lo + i];
+        sb[i] = b[i] + b[lo + i];
+    }
+
+    if (hi > lo)
+    {
+        sa[lo] = a[n - 1];
+        sb[lo] = b[n - 1];
+    }
+
+    /*  z1 = (a0 + a1)(b0 + b1) - z0 - z2.                                    */
+    tmpl_intpoly_karatsuba(sa, sb, hi, z1, rest);
+
+    for (i = 0; i < 2 * lo - 1; ++i)
+        z1[i] -= out[i];
+
+    for (i = 0; i < 2 * hi - 1; ++i)
+        z1[i] -= out[2 * lo + i];
+
+    /*  Add the middle term, shifted by lo, into the output.                  */
+    for (i = 0; i < 2 * hi - 1; ++i)
+        out[lo + i] += z1[i];
+}
+/*  End of tmpl_intpoly_karatsuba.                                            */
+
+/*  Number of words needed by tmpl_intpoly_unbalanced_product. The balanced   *
+ *  kernel needs kernel_scratch words for arrays of length short_len.         */
+static size_t
+tmpl_intpoly_unbalanced_scratch(size_t short_len,
+                                size_t long_len,
+                                size_t kernel_scratch)
+{
+    /*  Short array, one block, the block product, and the accumulator.       */
+    return short_len + short_len + (2 * short_len - 1) +
+           (short_len + long_len - 1) + kernel_scratch;
+}
+/*  End of tmpl_intpoly_unbalanced_scratch.                                   */
+
+/*  Multiplies int arrays of lengths short_len <= long_len.                   */
+static void
+tmpl_intpoly_unbalanced_product(const int *shorter,
+                                size_t short_len,
+                                const int *longer,
+                                size_t long_len,
+                                int *out,
+                                tmpl_intpoly_balanced_kernel kernel,
+                                tmpl_intpoly_word *scratch)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t i, start;
+    const size_t out_len = short_len + long_len - 1;
+
+    /*  Carve the scratch space. The remainder is for the balanced kernel.    */
+    tmpl_intpoly_word * const a = scratch;
+    tmpl_intpoly_word * const b = a + short_len;
+    tmpl_intpoly_word * const block = b + short_len;
+    tmpl_intpoly_word * const acc = block + (2 * short_len - 1);
+    tmpl_intpoly_word * const rest = acc + out_len;
+
+    /*  Conversion from int is well defined, negatives wrap modulo 2^N.       */
+    for (i = 0; i < short_len; ++i)
+        a[i] = (tmpl_intpoly_word)shorter[i];
+
+    for (i = 0; i < out_len; ++i)
+        acc[i] = 0;
+
+    /*  Multiply the short array by each block of the long one.               */
+    for (start = 0; start < long_len; start += short_len)
+    {
+        const size_t remaining = long_len - start;
+        const size_t len = (remaining < short_len ? remaining : short_len);
+        const size_t terms = (remaining < short_len ?
+                              short_len + remaining - 1 : 2 * short_len - 1);
+
+        /*  The final block may be short. Pad it with zeros.                  */
+        for (i = 0; i < len; ++i)
+            b[i] = (tmpl_intpoly_word)longer[start + i];
+
+        for (i = len; i < short_len; ++i)
+            b[i] = 0;
+
+        kernel(a, b, short_len, block, rest);
+
+        /*  Padding produces zeros past the end of the product, skip those.   */
+        for (i = 0; i < terms; ++i)
+            acc[start + i] += block[i];
+    }
+
+    for (i = 0; i < out_len; ++i)
+        out[i] = tmpl_intpoly_word_to_int(acc[i]);
+}
+/*  End of tmpl_intpoly_unbalanced_product.                                   */
+
+#endif
+/*  End of include guard.                                                     */
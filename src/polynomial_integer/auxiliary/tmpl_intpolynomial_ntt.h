@@ -0,0 +1,567 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                           tmpl_intpolynomial_ntt                           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides the number theoretic transform (NTT) and the Chinese         *
+ *      remainder theorem (CRT) tools shared by the exact NTT multipliers for *
+ *      polynomials with int, long, and long long coefficients.               *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_intpoly_ntt_convolve                                             *
+ *  Purpose:                                                                  *
+ *      Computes the cyclic convolution of two arrays of residues modulo one  *
+ *      of the NTT primes.                                                    *
+ *  Arguments:                                                                *
+ *      a (tmpl_UInt32 **):                                                   *
+ *          Pointer to the first array, N elements in Montgomery form. On     *
+ *          output it points to the convolution, as ordinary residues.        *
+ *      b (tmpl_UInt32 **):                                                   *
+ *          Pointer to the second array, N elements in Montgomery form. This  *
+ *          is ignored if square is true. The contents are destroyed.         *
+ *      tmp (tmpl_UInt32 **):                                                 *
+ *          Pointer to a workspace of N elements. The three pointers may be   *
+ *          swapped with each other, but always point to the same buffers.    *
+ *      twiddles (tmpl_UInt32 *):                                             *
+ *          Workspace of N elements for the roots of unity.                   *
+ *      N (size_t):                                                           *
+ *          The length of the transform, a power of two.                      *
+ *      square (tmpl_Bool):                                                   *
+ *          If true, computes the convolution of a with itself.               *
+ *      mod (const tmpl_intpoly_ntt_modulus *):                               *
+ *          The prime and its Montgomery constants.                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      Forward transform, pointwise product, inverse transform. The          *
+ *      transforms use the same iterative Stockham form of the Cooley-Tukey   *
+ *      algorithm as tmpl_CDouble_FFT_Cooley_Tukey, ping-ponging between the  *
+ *      data and a scratch buffer so no bit reversal is needed. The complex   *
+ *      exponentials are replaced by powers of a root of unity modulo p, and  *
+ *      the products are Montgomery multiplications. Everything is exact.     *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_intpoly_ntt_crt_reconstruct                                      *
+ *  Purpose:                                                                  *
+ *      Recovers a signed integer from its residues modulo the first k NTT    *
+ *      primes.                                                               *
+ *  Arguments:                                                                *
+ *      crt (const tmpl_intpoly_ntt_crt *):                                   *
+ *          The primes, the product M, and the precomputed inverses.          *
+ *      residues (const tmpl_UInt32 *):                                       *
+ *          The residues. residues[i * stride] is the value modulo prime i.   *
+ *      stride (size_t):                                                      *
+ *          The distance between consecutive residues.                        *
+ *      limbs (tmpl_UInt32 *):                                                *
+ *          The magnitude of the integer, in base 2^32, least significant     *
+ *          limb first. Must have room for crt->number_of_primes limbs.       *
+ *  Output:                                                                   *
+ *      negative (tmpl_Bool):                                                 *
+ *          True if the integer is negative.                                  *
+ *  Method:                                                                   *
+ *      Garner's algorithm gives the mixed radix digits v_i with:             *
+ *                                                                            *
+ *          x = v_0 + v_1 p_0 + v_2 p_0 p_1 + ... ,    0 <= v_i < p_i         *
+ *                                                                            *
+ *      x is then assembled in base 2^32 with Horner's method. The integer is *
+ *      the representative of x in (-M / 2, M / 2), so it is negative if x    *
+ *      exceeds floor(M / 2), and its magnitude is then M - x.                *
+ ******************************************************************************
+ *  Notes:                                                                    *
+ *      1.) The primes p are below 2^31 and of the form c 2^k + 1 with large  *
+ *          k. All products of residues fit in 64 bits. The transforms need   *
+ *          exact 32-bit and 64-bit unsigned types. If the platform lacks     *
+ *          them, TMPL_INTPOLY_HAS_NTT is zero and nothing else is defined.   *
+ *                                                                            *
+ *      2.) Each prime exceeds 2^30. If the product of k of them is to be     *
+ *          larger than twice a bound B on the coefficients, it suffices that *
+ *          30 k > log2(B) + 1. tmpl_intpoly_ntt_number_of_primes computes k. *
+ *                                                                            *
+ *      3.) This file is not part of the public API. It is only included by   *
+ *          the NTT multiplication routines in this directory.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_INTPOLYNOMIAL_NTT_H
+#define TMPL_INTPOLYNOMIAL_NTT_H
+
+/*  Fixed-width integer types, tmpl_UInt32 and tmpl_UInt64, found here.       */
+#include <libtmpl/include/tmpl_inttype.h>
+
+/*  Booleans provided here.                                                   */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  size_t typedef given here.                                                */
+#include <stddef.h>
+
+/*  The transforms require exact 32-bit and 64-bit unsigned integers.         */
+#if TMPL_HAS_32_BIT_INT == 1 && TMPL_HAS_64_BIT_INT == 1
+#define TMPL_INTPOLY_HAS_NTT 1
+#else
+#define TMPL_INTPOLY_HAS_NTT 0
+#endif
+
+#if TMPL_INTPOLY_HAS_NTT == 1
+
+/*  Enough primes for the product of two 64-bit coefficient arrays with up    *
+ *  to 2^64 terms: 64 + 64 + 64 + 1 = 193 bits, and 30 * 7 = 210.            */
+#define TMPL_INTPOLY_NTT_MAX_PRIMES (8)
+
+/*  The primes p = c 2^k + 1, in decreasing order of k. Each is in the range  *
+ *  2^30 < p < 2^31.                                                          */
+static const tmpl_UInt32
+tmpl_intpoly_ntt_primes[TMPL_INTPOLY_NTT_MAX_PRIMES] = {
+    TMPL_UINT32_LITERAL(2013265921),  /*   15 * 2^27 + 1   */
+    TMPL_UINT32_LITERAL(1811939329),  /*   27 * 2^26 + 1   */
+    TMPL_UINT32_LITERAL(2113929217),  /*   63 * 2^25 + 1   */
+    TMPL_UINT32_LITERAL(1711276033),  /*   51 * 2^25 + 1   */
+    TMPL_UINT32_LITERAL(1107296257),  /*   33 * 2^25 + 1   */
+    TMPL_UINT32_LITERAL(2130706433),  /*  127 * 2^24 + 1   */
+    TMPL_UINT32_LITERAL(1224736769),  /*   73 * 2^24 + 1   */
+    TMPL_UINT32_LITERAL(2088763393)   /*  249 * 2^23 + 1   */
+};
+
+/*  A primitive root modulo each of the primes.                               */
+static const tmpl_UInt32
+tmpl_intpoly_ntt_roots[TMPL_INTPOLY_NTT_MAX_PRIMES] = {
+    31U, 13U, 5U, 29U, 10U, 3U, 3U, 5U
+};
+
+/*  The exponent k for each prime. Transforms of length up to 2^k exist.      */
+static const unsigned int
+tmpl_intpoly_ntt_orders[TMPL_INTPOLY_NTT_MAX_PRIMES] = {
+    27U, 26U, 25U, 25U, 25U, 24U, 24U, 23U
+};
+
+/*  A prime together with the constants for Montgomery multiplication.        */
+typedef struct tmpl_intpoly_ntt_modulus_def {
+
+    /*  The prime p.                                                          */
+    tmpl_UInt64 p;
+
+    /*  -1 / p modulo 2^32.                                                   */
+    tmpl_UInt64 neg_inv;
+
+    /*  2^64 modulo p, used for converting to Montgomery form.                */
+    tmpl_UInt64 r2;
+} tmpl_intpoly_ntt_modulus;
+
+/*  The first k primes, their product, and the inverses for Garner's method.  */
+typedef struct tmpl_intpoly_ntt_crt_def {
+
+    /*  The number of primes used.                                            */
+    unsigned int number_of_primes;
+
+    /*  inverse[i][j] is 1 / p_j modulo p_i, for j < i.                       */
+    tmpl_UInt32
+    inverse[TMPL_INTPOLY_NTT_MAX_PRIMES][TMPL_INTPOLY_NTT_MAX_PRIMES];
+
+    /*  floor(M / 2), where M is the product of the primes, in base 2^32.     */
+    tmpl_UInt32 half[TMPL_INTPOLY_NTT_MAX_PRIMES];
+
+    /*  M itself, in base 2^32.                                               */
+    tmpl_UInt32 product[TMPL_INTPOLY_NTT_MAX_PRIMES];
+} tmpl_intpoly_ntt_crt;
+
+/*  The lower 32 bits of a 64-bit integer.                                    */
+#define TMPL_INTPOLY_NTT_LOW_MASK (TMPL_UINT64_LITERAL(0xFFFFFFFF))
+
+/*  Smallest number of primes whose product exceeds 2^(bits + 1).             */
+static unsigned int tmpl_intpoly_ntt_number_of_primes(unsigned int bits)
+{
+    const unsigned int k = (bits + 30U) / 30U;
+    return (k == 0U ? 1U : k);
+}
+/*  End of tmpl_intpoly_ntt_number_of_primes.                                 */
+
+/*  Number of bits needed to store a size_t.                                  */
+static unsigned int tmpl_intpoly_ntt_bit_length(size_t n)
+{
+    unsigned int bits = 0U;
+
+    while (n)
+    {
+        ++bits;
+        n >>= 1;
+    }
+
+    return bits;
+}
+/*  End of tmpl_intpoly_ntt_bit_length.                                       */
+
+/*  Ordinary modular exponentiation, used only for the setup.                 */
+static tmpl_UInt32
+tmpl_intpoly_ntt_pow(tmpl_UInt64 base, tmpl_UInt64 exponent, tmpl_UInt64 p)
+{
+    tmpl_UInt64 result = 1U;
+    base %= p;
+
+    while (exponent)
+    {
+        if (exponent & 1U)
+            result = (result * base) % p;
+
+        base = (base * base) % p;
+        exponent >>= 1;
+    }
+
+    return (tmpl_UInt32)result;
+}
+/*  End of tmpl_intpoly_ntt_pow.                                              */
+
+/*  Computes the Montgomery constants for prime number n in the table.        */
+static void
+tmpl_intpoly_ntt_modulus_init(tmpl_intpoly_ntt_modulus *mod, unsigned int n)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned int iter;
+    const tmpl_UInt64 p = tmpl_intpoly_ntt_primes[n];
+    const tmpl_UInt64 r = (TMPL_UINT64_LITERAL(1) << 32) % p;
+
+    /*  p * p = 1 mod 8 for odd p, so p is its own inverse to 3 bits. Each    *
+     *  Newton step doubles the number of correct bits: 3, 6, 12, 24, 48.     */
+    tmpl_UInt64 inv = p;
+
+    for (iter = 0U; iter < 4U; ++iter)
+        inv = (inv * (2U - p * inv)) & TMPL_INTPOLY_NTT_LOW_MASK;
+
+    mod->p = p;
+    mod->neg_inv = ((TMPL_INTPOLY_NTT_LOW_MASK + 1U) - inv)
+                 & TMPL_INTPOLY_NTT_LOW_MASK;
+    mod->r2 = (r * r) % p;
+}
+/*  End of tmpl_intpoly_ntt_modulus_init.                                     */
+
+/*  Montgomery reduction, computes t / 2^32 mod p for 0 <= t < p^2.           */
+static tmpl_UInt32
+tmpl_intpoly_ntt_reduce(tmpl_UInt64 t, const tmpl_intpoly_ntt_modulus *mod)
+{
+    const tmpl_UInt64 m = ((t & TMPL_INTPOLY_NTT_LOW_MASK) * mod->neg_inv)
+                        & TMPL_INTPOLY_NTT_LOW_MASK;
+
+    /*  t + m p is divisible by 2^32. It is at most p^2 + 2^32 p < 2^63.      */
+    const tmpl_UInt64 u = (t + m * mod->p) >> 32;
+
+    return (tmpl_UInt32)(u >= mod->p ? u - mod->p : u);
+}
+/*  End of tmpl_intpoly_ntt_reduce.                                           */
+
+/*  Product of two numbers in Montgomery form.                                */
+static tmpl_UInt32
+tmpl_intpoly_ntt_multiply(tmpl_UInt32 a, tmpl_UInt32 b,
+                          const tmpl_intpoly_ntt_modulus *mod)
+{
+    return tmpl_intpoly_ntt_reduce((tmpl_UInt64)a * b, mod);
+}
+/*  End of tmpl_intpoly_ntt_multiply.                                         */
+
+/*  Converts a residue 0 <= x < p, negated if requested, to Montgomery form.  */
+static tmpl_UInt32
+tmpl_intpoly_ntt_from_residue(tmpl_UInt64 x, tmpl_Bool negative,
+                              const tmpl_intpoly_ntt_modulus *mod)
+{
+    if (negative && x)
+        x = mod->p - x;
+
+    return tmpl_intpoly_ntt_reduce(x * mod->r2, mod);
+}
+/*  End of tmpl_intpoly_ntt_from_residue.                                     */
+
+/*  Stockham form of the Cooley-Tukey transform. Returns the buffer, either   *
+ *  data or scratch, containing the result.                                   */
+static tmpl_UInt32 *
+tmpl_intpoly_ntt_transform(tmpl_UInt32 *data,
+                           tmpl_UInt32 *scratch,
+                           size_t N,
+                           const tmpl_UInt32 *twiddles,
+                           const tmpl_intpoly_ntt_modulus *mod)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, k, m, skip;
+    const tmpl_UInt32 p = (tmpl_UInt32)mod->p;
+    tmpl_UInt32 *E = data;
+    tmpl_UInt32 *X = scratch;
+
+    for (n = 1; n < N; n <<= 1)
+    {
+        /*  Pointers to the first and second halves of the output.            */
+        tmpl_UInt32 *Xp = X;
+        tmpl_UInt32 *Xp2 = X + (N >> 1);
+        const tmpl_UInt32 *Ep = E;
+
+        skip = N / (n << 1);
+
+        for (k = 0; k < n; ++k)
+        {
+            const tmpl_UInt32 t = twiddles[k * skip];
+
+            for (m = 0; m < skip; ++m)
+            {
+                const tmpl_UInt32 e = Ep[m];
+                const tmpl_UInt32 d = tmpl_intpoly_ntt_multiply(
+                    t, Ep[m + skip], mod
+                );
+
+                Xp[m] = (e >= p - d ? e - (p - d) : e + d);
+                Xp2[m] = (e >= d ? e - d : e + (p - d));
+            }
+
+            Xp += skip;
+            Xp2 += skip;
+            Ep += skip << 1;
+        }
+
+        /*  The output of this pass is the input of the next.                 */
+        E = X;
+        X = (X == scratch ? data : scratch);
+    }
+
+    return E;
+}
+/*  End of tmpl_intpoly_ntt_transform.                                        */
+
+/*  Computes w^k in Montgomery form for 0 <= k < N / 2, w a primitive N^th    *
+ *  root of unity, or its inverse.                                            */
+static void
+tmpl_intpoly_ntt_twiddles(tmpl_UInt32 *twiddles, size_t N, unsigned int n,
+                          tmpl_Bool inverse,
+                          const tmpl_intpoly_ntt_modulus *mod)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k;
+    const tmpl_UInt64 p = mod->p;
+    tmpl_UInt64 w = tmpl_intpoly_ntt_pow(
+        tmpl_intpoly_ntt_roots[n], (p - 1U) / N, p
+    );
+
+    /*  The inverse root is w^(N - 1).                                        */
+    if (inverse)
+        w = tmpl_intpoly_ntt_pow(w, N - 1U, p);
+
+    if (N < 2)
+        return;
+
+    twiddles[0] = tmpl_intpoly_ntt_from_residue(1U, tmpl_False, mod);
+    w = tmpl_intpoly_ntt_from_residue(w, tmpl_False, mod);
+
+    for (k = 1; k < (N >> 1); ++k)
+        twiddles[k] = tmpl_intpoly_ntt_multiply(
+            twiddles[k - 1], (tmpl_UInt32)w, mod
+        );
+}
+/*  End of tmpl_intpoly_ntt_twiddles.                                         */
+
+/*  Cyclic convolution of *a and *b modulo the prime. See above.              */
+static void
+tmpl_intpoly_ntt_convolve(tmpl_UInt32 **a, tmpl_UInt32 **b,
+                          tmpl_UInt32 **tmp, tmpl_UInt32 *twiddles,
+                          size_t N, unsigned int n, tmpl_Bool square,
+                          const tmpl_intpoly_ntt_modulus *mod)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k;
+    tmpl_UInt32 *result, *swap;
+    tmpl_UInt32 scale;
+
+    /*  Forward transforms. The result may land in the scratch buffer, in     *
+     *  which case the roles of the two buffers are swapped.                  */
+    tmpl_intpoly_ntt_twiddles(twiddles, N, n, tmpl_False, mod);
+    result = tmpl_intpoly_ntt_transform(*a, *tmp, N, twiddles, mod);
+
+    if (result != *a)
+    {
+        swap = *a;
+        *a = result;
+        *tmp = swap;
+    }
+
+    if (square)
+        for (k = 0; k < N; ++k)
+            (*a)[k] = tmpl_intpoly_ntt_multiply((*a)[k], (*a)[k], mod);
+
+    else
+    {
+        result = tmpl_intpoly_ntt_transform(*b, *tmp, N, twiddles, mod);
+
+        if (result != *b)
+        {
+            swap = *b;
+            *b = result;
+            *tmp = swap;
+        }
+
+        for (k = 0; k < N; ++k)
+            (*a)[k] = tmpl_intpoly_ntt_multiply((*a)[k], (*b)[k], mod);
+    }
+
+    /*  Inverse transform.                                                    */
+    tmpl_intpoly_ntt_twiddles(twiddles, N, n, tmpl_True, mod);
+    result = tmpl_intpoly_ntt_transform(*a, *tmp, N, twiddles, mod);
+
+    if (result != *a)
+    {
+        swap = *a;
+        *a = result;
+        *tmp = swap;
+    }
+
+    /*  Reducing x R times 1 / N gives x / N as an ordinary residue.          */
+    scale = tmpl_intpoly_ntt_pow(N, mod->p - 2U, mod->p);
+
+    for (k = 0; k < N; ++k)
+        (*a)[k] = tmpl_intpoly_ntt_multiply((*a)[k], scale, mod);
+}
+/*  End of tmpl_intpoly_ntt_convolve.                                         */
+
+/*  Computes x = x * c + d for a base 2^32 integer x with len limbs.          */
+static void
+tmpl_intpoly_ntt_limbs_multiply_add(tmpl_UInt32 *x, unsigned int len,
+                                    tmpl_UInt32 c, tmpl_UInt32 d)
+{
+    unsigned int n;
+    tmpl_UInt64 carry = d;
+
+    for (n = 0U; n < len; ++n)
+    {
+        const tmpl_UInt64 t = (tmpl_UInt64)x[n] * c + carry;
+        x[n] = (tmpl_UInt32)(t & TMPL_INTPOLY_NTT_LOW_MASK);
+        carry = t >> 32;
+    }
+}
+/*  End of tmpl_intpoly_ntt_limbs_multiply_add.                               */
+
+/*  Sets up the CRT data for the first k primes.                              */
+static void tmpl_intpoly_ntt_crt_init(tmpl_intpoly_ntt_crt *crt, unsigned int k)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned int i, j;
+
+    crt->number_of_primes = k;
+
+    for (i = 0U; i < k; ++i)
+    {
+        const tmpl_UInt64 p = tmpl_intpoly_ntt_primes[i];
+
+        for (j = 0U; j < i; ++j)
+            crt->inverse[i][j] = tmpl_intpoly_ntt_pow(
+                tmpl_intpoly_ntt_primes[j], p - 2U, p
+            );
+    }
+
+    /*  M = p_0 p_1 ... p_{k-1}. Each prime adds at most 31 bits, so k limbs  *
+     *  of 32 bits are enough.                                                */
+    for (i = 0U; i < k; ++i)
+        crt->product[i] = 0U;
+
+    crt->product[0] = 1U;
+
+    for (i = 0U; i < k; ++i)
+        tmpl_intpoly_ntt_limbs_multiply_add(
+            crt->product, k, tmpl_intpoly_ntt_primes[i], 0U
+        );
+
+    /*  floor(M / 2) by shifting each limb right, borrowing from above.       */
+    for (i = 0U; i < k; ++i)
+    {
+        const tmpl_UInt32 above = (i + 1U < k ? crt->product[i + 1U] : 0U);
+        crt->half[i] = (crt->product[i] >> 1) | ((above & 1U) << 31);
+    }
+}
+/*  End of tmpl_intpoly_ntt_crt_init.                                         */
+
+/*  Recovers a signed integer from its residues. See above.                   */
+static tmpl_Bool
+tmpl_intpoly_ntt_crt_reconstruct(const tmpl_intpoly_ntt_crt *crt,
+                                 const tmpl_UInt32 *residues,
+                                 size_t stride, tmpl_UInt32 *limbs)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned int i, j;
+    tmpl_UInt64 borrow;
+    const unsigned int k = crt->number_of_primes;
+    const tmpl_UInt64 base = TMPL_INTPOLY_NTT_LOW_MASK + 1U;
+    tmpl_UInt32 digits[TMPL_INTPOLY_NTT_MAX_PRIMES];
+
+    /*  Garner's algorithm for the mixed radix digits.                        */
+    for (i = 0U; i < k; ++i)
+    {
+        const tmpl_UInt64 p = tmpl_intpoly_ntt_primes[i];
+        tmpl_UInt64 x = residues[i * stride];
+
+        for (j = 0U; j < i; ++j)
+        {
+            const tmpl_UInt64 v = digits[j] % p;
+            x = (x >= v ? x - v : x + p - v);
+            x = (x * crt->inverse[i][j]) % p;
+        }
+
+        digits[i] = (tmpl_UInt32)x;
+    }
+
+    /*  Horner's method, x = v_0 + p_0 (v_1 + p_1 (v_2 + ...)).               */
+    for (i = 0U; i < k; ++i)
+        limbs[i] = 0U;
+
+    i = k;
+
+    while (i--)
+        tmpl_intpoly_ntt_limbs_multiply_add(
+            limbs, k, (i + 1U < k ? tmpl_intpoly_ntt_primes[i] : 1U), digits[i]
+        );
+
+    /*  Compare with floor(M / 2), starting from the most significant limb.   */
+    i = k;
+
+    while (i--)
+    {
+        if (limbs[i] != crt->half[i])
+            break;
+    }
+
+    /*  x <= floor(M / 2), the integer is non-negative and equal to x. If    *
+     *  the loop ran to completion, i wrapped around and is now at least k.   */
+    if (i >= k || limbs[i] < crt->half[i])
+        return tmpl_False;
+
+    /*  Otherwise the integer is x - M. Compute M - x, which is positive.     */
+    borrow = 0U;
+
+    for (i = 0U; i < k; ++i)
+    {
+        const tmpl_UInt64 a = crt->product[i];
+        const tmpl_UInt64 b = (tmpl_UInt64)limbs[i] + borrow;
+
+        borrow = (a < b ? 1U : 0U);
+        limbs[i] = (tmpl_UInt32)(a + borrow * base - b);
+    }
+
+    return tmpl_True;
+}
+/*  End of tmpl_intpoly_ntt_crt_reconstruct.                                  */
+
+#endif
+/*  End of #if TMPL_INTPOLY_HAS_NTT == 1.                                     */
+
+#endif
+/*  End of include guard.                                                     */
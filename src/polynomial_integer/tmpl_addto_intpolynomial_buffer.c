@@ -0,0 +1,139 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                      tmpl_addto_intpolynomial_buffer                       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Adds a polynomial to a capacity-aware polynomial in place.            *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomialBuffer_AddTo                                        *
+ *  Purpose:                                                                  *
+ *      Computes buffer += P.                                                 *
+ *  Arguments:                                                                *
+ *      buffer (tmpl_IntPolynomialBuffer *):                                  *
+ *          The polynomial that is added to.                                  *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          The polynomial that is added.                                     *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_polynomial_integer.h:                                            *
+ *          tmpl_IntPolynomialBuffer_Reserve:                                 *
+ *              Grows the buffer if it is too small.                          *
+ *          tmpl_IntPolynomialBuffer_Make_Zero:                               *
+ *              Initializes empty buffers.                                    *
+ *  Method:                                                                   *
+ *      Reserve room for the larger degree, zero the terms of the buffer      *
+ *      between its degree and the degree of P, and add term by term. The     *
+ *      degree is then lowered past any cancelled leading terms. The memory   *
+ *      is never shrunk, so once the buffer is large enough this function     *
+ *      does not allocate.                                                    *
+ *  Notes:                                                                    *
+ *      1.) NULL and empty polynomials are treated as zero.                   *
+ *                                                                            *
+ *      2.) If P has its error_occurred Boolean set, so does the buffer.      *
+ *                                                                            *
+ *      3.) P may be a view of the buffer itself, computing 2 * buffer.       *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_polynomial_integer.h:                                            *
+ *          Header where the function prototype is given.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  tmpl_Bool, tmpl_False, and tmpl_True are given here.                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  Function for computing buffer += P without reallocating once warm.        */
+void
+tmpl_IntPolynomialBuffer_AddTo(tmpl_IntPolynomialBuffer *buffer,
+                               const tmpl_IntPolynomial *P)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    size_t n;
+
+    /*  If the output is NULL there is nothing to be done.                    */
+    if (!buffer)
+        return;
+
+    /*  Similarly if an error occurred previously.                            */
+    if (buffer->error_occurred)
+        return;
+
+    /*  An empty buffer is zero, give it a constant term before adding.       */
+    if (!buffer->coeffs)
+    {
+        tmpl_IntPolynomialBuffer_Make_Zero(buffer);
+
+        if (buffer->error_occurred)
+            return;
+    }
+
+    /*  If P is NULL there is nothing to add.                                 */
+    if (!P)
+        return;
+
+    /*  If P has an error, abort the computation. Treat this as an error.     */
+    if (P->error_occurred)
+    {
+        buffer->error_occurred = tmpl_True;
+        buffer->error_message =
+            "\nError Encountered:\n"
+            "    tmpl_IntPolynomialBuffer_AddTo\n\n"
+            "Input polynomial has error_occurred set to true.\n\n";
+
+        return;
+    }
+
+    /*  Empty polynomials are zero, nothing to add.                           */
+    if (!P->coeffs)
+        return;
+
+    /*  If P has the larger degree, the buffer needs new leading terms.       */
+    if (P->degree > buffer->degree)
+    {
+        tmpl_IntPolynomialBuffer_Reserve(buffer, P->degree + 1);
+
+        if (buffer->error_occurred)
+            return;
+
+        for (n = buffer->degree + 1; n <= P->degree; ++n)
+            buffer->coeffs[n] = 0;
+
+        buffer->degree = P->degree;
+    }
+
+    /*  Add the terms of P. The rest of the buffer is unchanged.              */
+    for (n = 0; n <= P->degree; ++n)
+        buffer->coeffs[n] += P->coeffs[n];
+
+    /*  Remove cancelled leading terms by lowering the degree.                */
+    while (buffer->degree > 0 && buffer->coeffs[buffer->degree] == 0)
+        buffer->degree--;
+}
+/*  End of tmpl_IntPolynomialBuffer_AddTo.                                    */
@@ -0,0 +1,176 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                  tmpl_addto_product_intpolynomial_buffer                   *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Fused multiply-add for capacity-aware polynomials.                    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomialBuffer_AddTo_Product                                *
+ *  Purpose:                                                                  *
+ *      Computes buffer += P * Q, accumulating the product directly into the  *
+ *      buffer without forming it in a temporary.                             *
+ *  Arguments:                                                                *
+ *      buffer (tmpl_IntPolynomialBuffer *):                                  *
+ *          The polynomial that is added to.                                  *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          The first factor of the product.                                  *
+ *      Q (const tmpl_IntPolynomial *):                                       *
+ *          The second factor of the product.                                 *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_polynomial_integer.h:                                            *
+ *          tmpl_IntPolynomialBuffer_Reserve:                                 *
+ *              Grows the buffer if it is too small.                          *
+ *          tmpl_IntPolynomialBuffer_Make_Zero:                               *
+ *              Initializes empty buffers.                                    *
+ *  Method:                                                                   *
+ *      Reserve deg(P) + deg(Q) + 1 terms and zero the terms of the buffer    *
+ *      above its current degree. For each non-zero coefficient a = P[m],     *
+ *      add a * Q[n] to buffer[m + n] for every n. The inner loop runs over   *
+ *      contiguous memory with a fixed scale factor, which compilers          *
+ *      vectorize. Finally the degree is lowered past any cancelled leading   *
+ *      terms. The memory is never shrunk, so once the buffer is large        *
+ *      enough this function does not allocate.                               *
+ *  Notes:                                                                    *
+ *      1.) NULL and empty polynomials are treated as zero, in which case the *
+ *          buffer is not changed.                                            *
+ *                                                                            *
+ *      2.) If P or Q has its error_occurred Boolean set, so does the buffer. *
+ *                                                                            *
+ *      3.) P and Q may not be views of the buffer, since the buffer is       *
+ *          written while they are read. This is checked, and treated as an   *
+ *          error. P and Q may be the same polynomial.                        *
+ *                                                                            *
+ *      4.) The naive algorithm is used. This function is intended for the    *
+ *          many small products of an inner loop, where the cost of malloc    *
+ *          dominates. tmpl_IntPolynomial_Multiply is faster for large inputs.*
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_polynomial_integer.h:                                            *
+ *          Header where the function prototype is given.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  tmpl_Bool, tmpl_False, and tmpl_True are given here.                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  Function for computing buffer += P * Q without reallocating once warm.    */
+void
+tmpl_IntPolynomialBuffer_AddTo_Product(tmpl_IntPolynomialBuffer *buffer,
+                                       const tmpl_IntPolynomial *P,
+                                       const tmpl_IntPolynomial *Q)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    size_t m, n, degree;
+
+    /*  If the output is NULL there is nothing to be done.                    */
+    if (!buffer)
+        return;
+
+    /*  Similarly if an error occurred previously.                            */
+    if (buffer->error_occurred)
+        return;
+
+    /*  An empty buffer is zero, give it a constant term before adding.       */
+    if (!buffer->coeffs)
+    {
+        tmpl_IntPolynomialBuffer_Make_Zero(buffer);
+
+        if (buffer->error_occurred)
+            return;
+    }
+
+    /*  If either factor is NULL the product is zero, nothing to add.         */
+    if (!P || !Q)
+        return;
+
+    /*  If P or Q have an error, abort the computation.                       */
+    if (P->error_occurred || Q->error_occurred)
+    {
+        buffer->error_occurred = tmpl_True;
+        buffer->error_message =
+            "\nError Encountered:\n"
+            "    tmpl_IntPolynomialBuffer_AddTo_Product\n\n"
+            "Input polynomial has error_occurred set to true.\n\n";
+
+        return;
+    }
+
+    /*  Empty polynomials are zero, and so is the product.                    */
+    if (!P->coeffs || !Q->coeffs)
+        return;
+
+    /*  The buffer is written while P and Q are read. They can not alias.     */
+    if (P->coeffs == buffer->coeffs || Q->coeffs == buffer->coeffs)
+    {
+        buffer->error_occurred = tmpl_True;
+        buffer->error_message =
+            "\nError Encountered:\n"
+            "    tmpl_IntPolynomialBuffer_AddTo_Product\n\n"
+            "Input polynomial shares memory with the output.\n\n";
+
+        return;
+    }
+
+    degree = P->degree + Q->degree;
+
+    /*  If the product has the larger degree, add new leading terms.          */
+    if (degree > buffer->degree)
+    {
+        tmpl_IntPolynomialBuffer_Reserve(buffer, degree + 1);
+
+        if (buffer->error_occurred)
+            return;
+
+        for (n = buffer->degree + 1; n <= degree; ++n)
+            buffer->coeffs[n] = 0;
+
+        buffer->degree = degree;
+    }
+
+    /*  Accumulate the product one row P[m] * Q at a time.                    */
+    for (m = 0; m <= P->degree; ++m)
+    {
+        const signed int a = P->coeffs[m];
+        signed int * const out = buffer->coeffs + m;
+
+        /*  Zero terms contribute nothing, which is common for sparse input.  */
+        if (a == 0)
+            continue;
+
+        for (n = 0; n <= Q->degree; ++n)
+            out[n] += a * Q->coeffs[n];
+    }
+
+    /*  Remove cancelled leading terms by lowering the degree.                */
+    while (buffer->degree > 0 && buffer->coeffs[buffer->degree] == 0)
+        buffer->degree--;
+}
+/*  End of tmpl_IntPolynomialBuffer_AddTo_Product.                            */
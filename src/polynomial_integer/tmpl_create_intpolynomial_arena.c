@@ -0,0 +1,114 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                      tmpl_create_intpolynomial_arena                       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Creates a workspace arena for integer polynomials.                    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomialArena_Create                                        *
+ *  Purpose:                                                                  *
+ *      Allocates a single block of memory that capacity-aware polynomials    *
+ *      can take their coefficient arrays from.                               *
+ *  Arguments:                                                                *
+ *      capacity (size_t):                                                    *
+ *          The total number of coefficients the arena can hand out.          *
+ *  Output:                                                                   *
+ *      arena (tmpl_IntPolynomialArena):                                      *
+ *          An empty arena with room for capacity coefficients.               *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates the block of memory.                                *
+ *  Method:                                                                   *
+ *      Call malloc once and check for errors. Nothing is handed out yet, so  *
+ *      the used counter starts at zero.                                      *
+ *  Notes:                                                                    *
+ *      1.) If malloc fails the error_occurred Boolean is set.                *
+ *                                                                            *
+ *      2.) A capacity of zero gives an arena with NULL data. This is not an  *
+ *          error, but every request made from it will fail.                  *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_malloc.h:                                                        *
+ *          Header providing TMPL_MALLOC.                                     *
+ *  3.) tmpl_polynomial_arena_int.h:                                          *
+ *          Header where the tmpl_IntPolynomialArena typedef is given.        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_MALLOC macro found here.                                             */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+
+/*  tmpl_Bool, tmpl_False, and tmpl_True are given here.                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Integer polynomial arena typedef provided here.                           */
+#include <libtmpl/include/types/tmpl_polynomial_arena_int.h>
+
+/*  Forward declaration / function prototype.                                 */
+extern tmpl_IntPolynomialArena
+tmpl_IntPolynomialArena_Create(const size_t capacity);
+
+/*  Function for creating an arena of coefficients for polynomials.           */
+tmpl_IntPolynomialArena tmpl_IntPolynomialArena_Create(const size_t capacity)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_IntPolynomialArena arena;
+
+    /*  Nothing has been handed out yet, and no error has occurred.           */
+    arena.used = 0;
+    arena.error_occurred = tmpl_False;
+    arena.error_message = NULL;
+
+    /*  Special case. An arena with no room does not need any memory.         */
+    if (capacity == 0)
+    {
+        arena.data = NULL;
+        arena.capacity = 0;
+        return arena;
+    }
+
+    /*  Allocate the entire workspace at once.                                */
+    arena.data = TMPL_MALLOC(signed int, capacity);
+
+    /*  malloc returns NULL on failure. Check for this.                       */
+    if (!arena.data)
+    {
+        arena.capacity = 0;
+        arena.error_occurred = tmpl_True;
+        arena.error_message =
+            "\nError Encountered: libtmpl\n"
+            "    tmpl_IntPolynomialArena_Create\n\n"
+            "malloc failed and returned NULL. Aborting.\n\n";
+    }
+
+    /*  Otherwise the full capacity is available.                             */
+    else
+        arena.capacity = capacity;
+
+    return arena;
+}
+/*  End of tmpl_IntPolynomialArena_Create.                                    */
@@ -0,0 +1,109 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                      tmpl_create_intpolynomial_buffer                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Creates a capacity-aware polynomial with its own memory.              *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomialBuffer_Create                                       *
+ *  Purpose:                                                                  *
+ *      Allocates room for a given number of coefficients and initializes     *
+ *      the polynomial to zero.                                               *
+ *  Arguments:                                                                *
+ *      capacity (size_t):                                                    *
+ *          The number of coefficients to allocate. Zero is treated as one.   *
+ *  Output:                                                                   *
+ *      buffer (tmpl_IntPolynomialBuffer):                                    *
+ *          The zero polynomial with room for capacity coefficients.          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates memory for the coefficients.                        *
+ *  Method:                                                                   *
+ *      Call malloc and check for errors. Only the constant coefficient is    *
+ *      set, the remaining elements are workspace and are left untouched.     *
+ *  Notes:                                                                    *
+ *      1.) If malloc fails the error_occurred Boolean is set.                *
+ *                                                                            *
+ *      2.) The output must be freed with tmpl_IntPolynomialBuffer_Destroy.   *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_malloc.h:                                                        *
+ *          Header providing TMPL_MALLOC.                                     *
+ *  3.) tmpl_polynomial_buffer_int.h:                                         *
+ *          Header where the tmpl_IntPolynomialBuffer typedef is given.       *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_MALLOC macro found here.                                             */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+
+/*  tmpl_Bool, tmpl_False, and tmpl_True are given here.                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Capacity-aware integer polynomial typedef provided here.                  */
+#include <libtmpl/include/types/tmpl_polynomial_buffer_int.h>
+
+/*  Forward declaration / function prototype.                                 */
+extern tmpl_IntPolynomialBuffer
+tmpl_IntPolynomialBuffer_Create(const size_t capacity);
+
+/*  Function for creating a zero polynomial with room to grow.                */
+tmpl_IntPolynomialBuffer tmpl_IntPolynomialBuffer_Create(const size_t capacity)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_IntPolynomialBuffer buffer;
+
+    /*  The zero polynomial needs at least one coefficient.                   */
+    const size_t length = (capacity == 0 ? 1 : capacity);
+
+    /*  The output is the zero polynomial, and it owns its memory.            */
+    buffer.degree = 0;
+    buffer.owns_memory = tmpl_True;
+    buffer.error_occurred = tmpl_False;
+    buffer.error_message = NULL;
+
+    /*  Allocate the workspace.                                               */
+    buffer.coeffs = TMPL_MALLOC(signed int, length);
+
+    /*  malloc returns NULL on failure. Check for this.                       */
+    if (!buffer.coeffs)
+    {
+        buffer.capacity = 0;
+        buffer.error_occurred = tmpl_True;
+        buffer.error_message =
+            "\nError Encountered: libtmpl\n"
+            "    tmpl_IntPolynomialBuffer_Create\n\n"
+            "malloc failed and returned NULL. Aborting.\n\n";
+
+        return buffer;
+    }
+
+    buffer.capacity = length;
+    buffer.coeffs[0] = 0;
+    return buffer;
+}
+/*  End of tmpl_IntPolynomialBuffer_Create.                                   */
@@ -0,0 +1,85 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                      tmpl_destroy_intpolynomial_arena                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Frees the memory in a workspace arena for integer polynomials.        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomialArena_Destroy                                       *
+ *  Purpose:                                                                  *
+ *      Frees the block of memory in an arena and resets its variables.       *
+ *  Arguments:                                                                *
+ *      arena (tmpl_IntPolynomialArena *):                                    *
+ *          A pointer to the arena that is to be destroyed.                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          free:                                                             *
+ *              Frees the block of memory.                                    *
+ *  Method:                                                                   *
+ *      Free the data pointer and set the counters to zero.                   *
+ *  Notes:                                                                    *
+ *      Every tmpl_IntPolynomialBuffer taken from the arena points into the   *
+ *      freed memory. These buffers must not be used after this call.         *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_free.h:                                                          *
+ *          Header providing TMPL_FREE.                                       *
+ *  3.) tmpl_polynomial_arena_int.h:                                          *
+ *          Header where the tmpl_IntPolynomialArena typedef is given.        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_FREE macro found here.                                               */
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Integer polynomial arena typedef provided here.                           */
+#include <libtmpl/include/types/tmpl_polynomial_arena_int.h>
+
+/*  Forward declaration / function prototype.                                 */
+extern void tmpl_IntPolynomialArena_Destroy(tmpl_IntPolynomialArena *arena);
+
+/*  Function for freeing all memory in an arena.                              */
+void tmpl_IntPolynomialArena_Destroy(tmpl_IntPolynomialArena *arena)
+{
+    /*  If the input is NULL there is nothing to be done.                     */
+    if (!arena)
+        return;
+
+    /*  Safely free the data and then set it to NULL to avoid double free's.  */
+    TMPL_FREE(arena->data);
+
+    /*  Set the remaining variables to their default zero values.             */
+    arena->capacity = 0;
+    arena->used = 0;
+    arena->error_occurred = tmpl_False;
+    arena->error_message = NULL;
+}
+/*  End of tmpl_IntPolynomialArena_Destroy.                                   */
@@ -0,0 +1,88 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                     tmpl_destroy_intpolynomial_buffer                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Frees the memory in a capacity-aware polynomial.                      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomialBuffer_Destroy                                      *
+ *  Purpose:                                                                  *
+ *      Frees the coefficients of a buffer, if it owns them, and resets the   *
+ *      rest of the variables.                                                *
+ *  Arguments:                                                                *
+ *      buffer (tmpl_IntPolynomialBuffer *):                                  *
+ *          A pointer to the polynomial that is to be destroyed.              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          free:                                                             *
+ *              Frees the coefficients.                                       *
+ *  Method:                                                                   *
+ *      Free the coefficients if they came from malloc. Memory that belongs   *
+ *      to an arena is simply forgotten. Set the remaining variables to zero. *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_free.h:                                                          *
+ *          Header providing TMPL_FREE.                                       *
+ *  3.) tmpl_polynomial_buffer_int.h:                                         *
+ *          Header where the tmpl_IntPolynomialBuffer typedef is given.       *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_FREE macro found here.                                               */
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Capacity-aware integer polynomial typedef provided here.                  */
+#include <libtmpl/include/types/tmpl_polynomial_buffer_int.h>
+
+/*  Forward declaration / function prototype.                                 */
+extern void tmpl_IntPolynomialBuffer_Destroy(tmpl_IntPolynomialBuffer *buffer);
+
+/*  Function for freeing all memory in a capacity-aware polynomial.           */
+void tmpl_IntPolynomialBuffer_Destroy(tmpl_IntPolynomialBuffer *buffer)
+{
+    /*  If the input is NULL there is nothing to be done.                     */
+    if (!buffer)
+        return;
+
+    /*  Memory taken from an arena is freed with the arena, not here.         */
+    if (buffer->owns_memory)
+        TMPL_FREE(buffer->coeffs);
+    else
+        buffer->coeffs = NULL;
+
+    /*  Set the remaining variables to their default zero values.             */
+    buffer->degree = 0;
+    buffer->capacity = 0;
+    buffer->owns_memory = tmpl_False;
+    buffer->error_occurred = tmpl_False;
+    buffer->error_message = NULL;
+}
+/*  End of tmpl_IntPolynomialBuffer_Destroy.                                  */
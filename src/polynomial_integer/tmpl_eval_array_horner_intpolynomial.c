@@ -0,0 +1,171 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                    tmpl_eval_array_horner_intpolynomial                    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Evaluates a polynomial at many integers using Horner's method.        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomial_Eval_Array_Horner                                  *
+ *  Purpose:                                                                  *
+ *      Evaluates a polynomial with integer coefficients at every element of  *
+ *      an array of integers.                                                 *
+ *  Arguments:                                                                *
+ *      evals (int *):                                                        *
+ *          The values of poly at the points x, len elements.                 *
+ *      poly (const tmpl_IntPolynomial *):                                    *
+ *          A pointer to a polynomial.                                        *
+ *      x (const int *):                                                      *
+ *          The integers at which we're evaluating the polynomial.            *
+ *      len (size_t):                                                         *
+ *          The number of elements in evals and x.                            *
+ *  Outputs:                                                                  *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Run TMPL_INTPOLY_EVAL_LANES Horner chains at once, one per point,     *
+ *      sharing each coefficient load. The chains are independent, so the     *
+ *      multiplies overlap instead of waiting on each other, and the inner    *
+ *      loop over the lanes may be vectorized by the compiler. With OpenMP    *
+ *      support, long arrays are split across threads.                        *
+ *  Notes:                                                                    *
+ *      1.) The arithmetic is done with unsigned int, which wraps around      *
+ *          modulo 2^N instead of overflowing. The results are identical to   *
+ *          tmpl_IntPolynomial_Eval whenever it does not overflow.            *
+ *                                                                            *
+ *      2.) As with tmpl_IntPolynomial_Eval, NULL, flawed, and empty          *
+ *          polynomials are treated as zero. If evals or x is NULL nothing is *
+ *          done. evals may be the same array as x.                           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) limits.h:                                                             *
+ *          Standard library header with INT_MAX and UINT_MAX.                *
+ *  2.) stddef.h:                                                             *
+ *          Standard library file where size_t is provided.                   *
+ *  3.) tmpl_polynomial_integer.h:                                            *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  INT_MAX and UINT_MAX found here.                                          */
+#include <limits.h>
+
+/*  size_t date type provided here.                                           */
+#include <stddef.h>
+
+/*  Function prototype provided here.                                         */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  Number of Horner chains that are run at the same time.                    */
+#define TMPL_INTPOLY_EVAL_LANES (8)
+
+/*  Converts back to int, keeping the low bits. This avoids the               *
+ *  implementation-defined conversion of large unsigned values to int.        */
+static int tmpl_intpoly_eval_to_int(unsigned int u)
+{
+    if (u <= (unsigned int)INT_MAX)
+        return (int)u;
+
+    return -(int)(UINT_MAX - u) - 1;
+}
+/*  End of tmpl_intpoly_eval_to_int.                                          */
+
+/*  Function for evaluating a polynomial at many integers.                    */
+void
+tmpl_IntPolynomial_Eval_Array_Horner(int *evals,
+                                     const tmpl_IntPolynomial *poly,
+                                     const int *x,
+                                     size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, k, block, degree, blocks;
+    const int *coeffs;
+    unsigned int eval, point;
+
+    /*  Nothing can be done if there is nowhere to read from or write to.     */
+    if (!evals || !x)
+        return;
+
+    /*  NULL, flawed, and empty polynomials are considered to be zero.        */
+    if (!poly || poly->error_occurred || !poly->coeffs)
+    {
+        for (n = 0; n < len; ++n)
+            evals[n] = 0;
+
+        return;
+    }
+
+    coeffs = poly->coeffs;
+    degree = poly->degree;
+    blocks = len / TMPL_INTPOLY_EVAL_LANES;
+
+    /*  Evaluate the polynomial at TMPL_INTPOLY_EVAL_LANES points at once.    */
+#ifdef _OPENMP
+#pragma omp parallel for if(len >= TMPL_INTPOLY_EVAL_PARALLEL_MIN_LENGTH)
+#endif
+    for (block = 0; block < blocks; ++block)
+    {
+        /*  Declare necessary variables. C89 requires this at the top.        */
+        unsigned int points[TMPL_INTPOLY_EVAL_LANES];
+        unsigned int polys[TMPL_INTPOLY_EVAL_LANES];
+        const size_t start = block * TMPL_INTPOLY_EVAL_LANES;
+        size_t m, lane;
+
+        /*  Conversion from int is well defined, negatives wrap modulo 2^N.   */
+        for (lane = 0; lane < TMPL_INTPOLY_EVAL_LANES; ++lane)
+        {
+            points[lane] = (unsigned int)x[start + lane];
+            polys[lane] = (unsigned int)coeffs[degree];
+        }
+
+        /*  Horner's method, with one independent chain for each lane.        */
+        for (m = degree; m > 0; --m)
+        {
+            const unsigned int c = (unsigned int)coeffs[m - 1];
+
+            for (lane = 0; lane < TMPL_INTPOLY_EVAL_LANES; ++lane)
+                polys[lane] = polys[lane] * points[lane] + c;
+        }
+
+        for (lane = 0; lane < TMPL_INTPOLY_EVAL_LANES; ++lane)
+            evals[start + lane] = tmpl_intpoly_eval_to_int(polys[lane]);
+    }
+
+    /*  Handle the points that do not fill a block.                           */
+    for (n = blocks * TMPL_INTPOLY_EVAL_LANES; n < len; ++n)
+    {
+        point = (unsigned int)x[n];
+        eval = (unsigned int)coeffs[degree];
+
+        for (k = degree; k > 0; --k)
+            eval = eval * point + (unsigned int)coeffs[k - 1];
+
+        evals[n] = tmpl_intpoly_eval_to_int(eval);
+    }
+}
+/*  End of tmpl_IntPolynomial_Eval_Array_Horner.                              */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_INTPOLY_EVAL_LANES
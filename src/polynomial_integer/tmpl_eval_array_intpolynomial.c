@@ -0,0 +1,98 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                       tmpl_eval_array_intpolynomial                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Evaluates a polynomial at many integers.                              *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomial_Eval_Array                                         *
+ *  Purpose:                                                                  *
+ *      Evaluates a polynomial with integer coefficients at every element of  *
+ *      an array of integers.                                                 *
+ *  Arguments:                                                                *
+ *      evals (int *):                                                        *
+ *          The values of poly at the points x, len elements.                 *
+ *      poly (const tmpl_IntPolynomial *):                                    *
+ *          A pointer to a polynomial.                                        *
+ *      x (const int *):                                                      *
+ *          The integers at which we're evaluating the polynomial.            *
+ *      len (size_t):                                                         *
+ *          The number of elements in evals and x.                            *
+ *  Outputs:                                                                  *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      src/polynomial_integer/                                               *
+ *          tmpl_IntPolynomial_Eval_Array_Horner:                             *
+ *              Interleaved Horner's method.                                  *
+ *          tmpl_IntPolynomial_Eval_Array_Subproduct:                         *
+ *              Multipoint evaluation with a subproduct tree.                 *
+ *  Method:                                                                   *
+ *      The subproduct tree only wins once the degree is large enough for the *
+ *      fast multiplication routines to beat the O(n) cost per point of       *
+ *      Horner's method, and only if there are enough points to fill a tree.  *
+ *      Use it if both the number of coefficients and the number of points    *
+ *      are at least TMPL_INTPOLY_SUBPRODUCT_THRESHOLD, and Horner otherwise. *
+ *  Notes:                                                                    *
+ *      Both methods give identical results, so the choice only affects       *
+ *      speed. See the two routines for the handling of invalid inputs.       *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) stddef.h:                                                             *
+ *          Standard library file where size_t is provided.                   *
+ *  2.) tmpl_polynomial_integer.h:                                            *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  size_t data type provided here.                                           */
+#include <stddef.h>
+
+/*  Function prototype provided here.                                         */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  Function for evaluating a polynomial at an array of integers.             */
+void
+tmpl_IntPolynomial_Eval_Array(int *evals,
+                              const tmpl_IntPolynomial *poly,
+                              const int *x,
+                              size_t len)
+{
+    /*  The threshold as a size_t, for comparing with the degree and length.  */
+    const size_t threshold = (size_t)TMPL_INTPOLY_SUBPRODUCT_THRESHOLD;
+
+    /*  Large degree with many points, use the subproduct tree.               */
+    if (poly && !poly->error_occurred && poly->coeffs)
+    {
+        if (poly->degree >= threshold - 1 && len >= threshold)
+        {
+            tmpl_IntPolynomial_Eval_Array_Subproduct(evals, poly, x, len);
+            return;
+        }
+    }
+
+    /*  Otherwise, and for invalid inputs, use Horner's method.               */
+    tmpl_IntPolynomial_Eval_Array_Horner(evals, poly, x, len);
+}
+/*  End of tmpl_IntPolynomial_Eval_Array.                                     */
@@ -0,0 +1,512 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                  tmpl_eval_array_subproduct_intpolynomial                  *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Evaluates a polynomial at many integers using a subproduct tree.      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomial_Eval_Array_Subproduct                              *
+ *  Purpose:                                                                  *
+ *      Evaluates a polynomial with integer coefficients at every element of  *
+ *      an array of integers in O(M(n) log(n)) time per n points, where M(n)  *
+ *      is the cost of multiplying polynomials of degree n.                   *
+ *  Arguments:                                                                *
+ *      evals (int *):                                                        *
+ *          The values of poly at the points x, len elements.                 *
+ *      poly (const tmpl_IntPolynomial *):                                    *
+ *          A pointer to a polynomial.                                        *
+ *      x (const int *):                                                      *
+ *          The integers at which we're evaluating the polynomial.            *
+ *      len (size_t):                                                         *
+ *          The number of elements in evals and x.                            *
+ *  Outputs:                                                                  *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates the tree and the workspace.                         *
+ *      libtmpl/include/tmpl_polynomial_integer.h:                            *
+ *          tmpl_IntPolynomial_Eval_Array_Horner:                             *
+ *              Used for small inputs, or if malloc fails.                    *
+ *      src/polynomial_integer/auxiliary/tmpl_intpolynomial_fast_multiply.h:  *
+ *          tmpl_intpoly_unbalanced_product:                                  *
+ *              Multiplies polynomials with Karatsuba's method.               *
+ *  Method:                                                                   *
+ *      The value of f at a is the remainder of f modulo x - a. Remainders    *
+ *      can be taken in stages: if M = M_L M_R, then                          *
+ *                                                                            *
+ *          f mod M_L = (f mod M) mod M_L                                     *
+ *                                                                            *
+ *      Split the points into blocks of n = deg(f) + 1. For each block, build *
+ *      the subproduct tree, whose leaves are the products of (x - a) over    *
+ *      small groups of points, and whose nodes are the products of their     *
+ *      two children. Then walk down the tree, reducing the remainder of the  *
+ *      parent modulo each child. At the leaves the remainders have small     *
+ *      degree and are evaluated with Horner's method.                        *
+ *                                                                            *
+ *      Each remainder is computed with a Newton iteration. Since the tree    *
+ *      polynomials are monic, with rev(g) = x^deg(g) g(1/x) we have          *
+ *                                                                            *
+ *          rev(q) = rev(f) / rev(g) mod x^(deg(f) - deg(g) + 1)              *
+ *                                                                            *
+ *      and 1 / rev(g) is found by the iteration h <- h (2 - rev(g) h), which *
+ *      doubles the number of correct terms each step. Then f mod g = f - q g.*
+ *      All products use Karatsuba's method, so both building and descending  *
+ *      the tree cost O(M(n) log(n)), compared with O(n^2) for Horner.        *
+ *  Notes:                                                                    *
+ *      1.) All of the arithmetic is done modulo 2^N, exactly, by wrapping    *
+ *          unsigned words. The results are identical to the ones of          *
+ *          tmpl_IntPolynomial_Eval_Array_Horner, and so agree with           *
+ *          tmpl_IntPolynomial_Eval whenever it does not overflow.            *
+ *                                                                            *
+ *      2.) As with tmpl_IntPolynomial_Eval, NULL, flawed, and empty          *
+ *          polynomials are treated as zero. If evals or x is NULL nothing is *
+ *          done. evals may be the same array as x.                           *
+ *                                                                            *
+ *      3.) If malloc fails, Horner's method is used instead.                 *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) limits.h:                                                             *
+ *          Standard library header with CHAR_BIT.                            *
+ *  2.) tmpl_malloc.h:                                                        *
+ *          Header file providing TMPL_MALLOC.                                *
+ *  3.) tmpl_free.h:                                                          *
+ *          Header file providing TMPL_FREE.                                  *
+ *  4.) tmpl_polynomial_integer.h:                                            *
+ *          Header file where the function prototype is given.                *
+ *  5.) tmpl_intpolynomial_fast_multiply.h:                                   *
+ *          Private header with the Karatsuba recursion.                      *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  CHAR_BIT found here.                                                      */
+#include <limits.h>
+
+/*  TMPL_MALLOC and TMPL_FREE macros found here.                              */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Polynomial typedefs and function prototype.                               */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  Karatsuba recursion and the unbalanced driver found here.                 */
+#include "auxiliary/tmpl_intpolynomial_fast_multiply.h"
+
+/*  Number of points in each leaf of the tree. The remainders at the leaves   *
+ *  are evaluated directly, which is faster than dividing any further.        */
+#define TMPL_INTPOLY_SUBPRODUCT_LEAF ((size_t)32)
+
+/*  Workspace shared by the products and remainders of one block.             */
+typedef struct tmpl_intpoly_subproduct_work_def {
+
+    /*  Scratch space for tmpl_intpoly_unbalanced_product.                    */
+    tmpl_intpoly_word *words;
+
+    /*  Temporary polynomials for the division, 2 n + 1 elements each.        */
+    int *rev_f, *rev_g, *inverse, *tmp, *quot, *prod;
+} tmpl_intpoly_subproduct_work;
+
+/*  Computes a - b modulo 2^N.                                                */
+static int tmpl_intpoly_wrap_subtract(int a, int b)
+{
+    return tmpl_intpoly_word_to_int((tmpl_intpoly_word)a -
+                                    (tmpl_intpoly_word)b);
+}
+/*  End of tmpl_intpoly_wrap_subtract.                                        */
+
+/*  Computes out = a b, which has a_len + b_len - 1 elements.                 */
+static void
+tmpl_intpoly_subproduct_multiply(int *out,
+                                 const int *a, size_t a_len,
+                                 const int *b, size_t b_len,
+                                 tmpl_intpoly_word *words)
+{
+    /*  The driver wants the shorter array first.                             */
+    if (a_len <= b_len)
+        tmpl_intpoly_unbalanced_product(a, a_len, b, b_len, out,
+                                        tmpl_intpoly_karatsuba, words);
+    else
+        tmpl_intpoly_unbalanced_product(b, b_len, a, a_len, out,
+                                        tmpl_intpoly_karatsuba, words);
+}
+/*  End of tmpl_intpoly_subproduct_multiply.                                  */
+
+/*  Computes work->inverse = 1 / h mod x^k, where h[0] = 1 and h has at       *
+ *  least k elements.                                                         */
+static void
+tmpl_intpoly_subproduct_inverse(const int *h,
+                                size_t k,
+                                tmpl_intpoly_subproduct_work *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, length = 1;
+    int * const inv = work->inverse;
+    int * const err = work->tmp;
+
+    inv[0] = 1;
+
+    /*  Newton's iteration, inv <- inv (2 - h inv), doubling the precision.   */
+    while (length < k)
+    {
+        const size_t next = (2 * length < k ? 2 * length : k);
+
+        /*  err = 2 - h inv mod x^next. The product has next + length - 1     *
+         *  terms, only the first next are needed.                            */
+        tmpl_intpoly_subproduct_multiply(err, h, next, inv, length,
+                                         work->words);
+
+        for (n = 0; n < next; ++n)
+            err[n] = tmpl_intpoly_wrap_subtract(0, err[n]);
+
+        err[0] = tmpl_intpoly_word_to_int((tmpl_intpoly_word)err[0] + 2U);
+
+        /*  inv = inv err mod x^next.                                         */
+        tmpl_intpoly_subproduct_multiply(work->prod, inv, length, err, next,
+                                         work->words);
+
+        for (n = 0; n < next; ++n)
+            inv[n] = work->prod[n];
+
+        length = next;
+    }
+}
+/*  End of tmpl_intpoly_subproduct_inverse.                                   */
+
+/*  Computes rem = f mod g, where f has f_len elements and g is monic of      *
+ *  degree g_deg. rem has g_deg elements. rem may not be f.                   */
+static void
+tmpl_intpoly_subproduct_remainder(int *rem,
+                                  const int *f, size_t f_len,
+                                  const int *g, size_t g_deg,
+                                  tmpl_intpoly_subproduct_work *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, k;
+
+    /*  If deg(f) < deg(g) the remainder is f itself.                         */
+    if (f_len <= g_deg)
+    {
+        for (n = 0; n < f_len; ++n)
+            rem[n] = f[n];
+
+        for (n = f_len; n < g_deg; ++n)
+            rem[n] = 0;
+
+        return;
+    }
+
+    /*  The quotient has k = deg(f) - deg(g) + 1 terms.                       */
+    k = f_len - g_deg;
+
+    /*  The leading terms of rev(f) and rev(g), up to x^(k - 1).              */
+    for (n = 0; n < k; ++n)
+    {
+        work->rev_f[n] = f[f_len - 1 - n];
+        work->rev_g[n] = (n <= g_deg ? g[g_deg - n] : 0);
+    }
+
+    /*  rev(q) = rev(f) / rev(g) mod x^k. rev(g)[0] = 1 since g is monic.     */
+    tmpl_intpoly_subproduct_inverse(work->rev_g, k, work);
+    tmpl_intpoly_subproduct_multiply(work->prod, work->rev_f, k,
+                                     work->inverse, k, work->words);
+
+    for (n = 0; n < k; ++n)
+        work->quot[n] = work->prod[k - 1 - n];
+
+    /*  f mod g = f - q g. Only the terms below x^deg(g) are non-zero.        */
+    tmpl_intpoly_subproduct_multiply(work->prod, work->quot, k,
+                                     g, g_deg + 1, work->words);
+
+    for (n = 0; n < g_deg; ++n)
+        rem[n] = tmpl_intpoly_wrap_subtract(f[n], work->prod[n]);
+}
+/*  End of tmpl_intpoly_subproduct_remainder.                                 */
+
+/*  Number of points under node j of the given level, for a block of length   *
+ *  points. This is also the degree of the node's polynomial.                 */
+static size_t
+tmpl_intpoly_subproduct_node_degree(size_t level, size_t j, size_t length)
+{
+    const size_t width = TMPL_INTPOLY_SUBPRODUCT_LEAF << level;
+    const size_t start = j * width;
+    return (length - start < width ? length - start : width);
+}
+/*  End of tmpl_intpoly_subproduct_node_degree.                               */
+
+/*  Evaluates f, with f_len coefficients, at the length points x. tree holds  *
+ *  levels arrays for the subproduct tree, and rems two arrays of length + 1  *
+ *  elements for the remainders.                                              */
+static void
+tmpl_intpoly_subproduct_block(int *evals,
+                              const int *f, size_t f_len,
+                              const int *x, size_t length,
+                              size_t levels,
+                              int **tree,
+                              int **rems,
+                              tmpl_intpoly_subproduct_work *work)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t level, j, n, k, nodes, width, deg, left_deg, right_deg;
+    int *node, *cur, *next, *swap;
+    unsigned int eval, point;
+
+    /*  Leaves: the product of x - a over each group of points.               */
+    nodes = (length + TMPL_INTPOLY_SUBPRODUCT_LEAF - 1) /
+            TMPL_INTPOLY_SUBPRODUCT_LEAF;
+
+    for (j = 0; j < nodes; ++j)
+    {
+        const int *points = x + j * TMPL_INTPOLY_SUBPRODUCT_LEAF;
+        deg = tmpl_intpoly_subproduct_node_degree(0, j, length);
+        node = tree[0] + j * (TMPL_INTPOLY_SUBPRODUCT_LEAF + 1);
+        node[0] = 1;
+
+        /*  Multiply by x - a one point at a time, from the top down.         */
+        for (n = 0; n < deg; ++n)
+        {
+            const tmpl_intpoly_word a = (tmpl_intpoly_word)points[n];
+            node[n + 1] = node[n];
+
+            for (k = n; k > 0; --k)
+            {
+                const tmpl_intpoly_word c = (tmpl_intpoly_word)node[k];
+                const tmpl_intpoly_word d = (tmpl_intpoly_word)node[k - 1];
+                node[k] = tmpl_intpoly_word_to_int(d - a * c);
+            }
+
+            node[0] = tmpl_intpoly_word_to_int(
+                (tmpl_intpoly_word)0 - a * (tmpl_intpoly_word)node[0]
+            );
+        }
+    }
+
+    /*  Each node is the product of its two children.                         */
+    for (level = 1; level < levels; ++level)
+    {
+        width = TMPL_INTPOLY_SUBPRODUCT_LEAF << level;
+        nodes = (length + width - 1) / width;
+
+        for (j = 0; j < nodes; ++j)
+        {
+            const int *left = tree[level - 1] + 2 * j * (width / 2 + 1);
+            node = tree[level] + j * (width + 1);
+            left_deg = tmpl_intpoly_subproduct_node_degree(level - 1, 2 * j,
+                                                           length);
+
+            /*  The last node may have only one child.                        */
+            if (2 * j * (width / 2) + left_deg == length)
+            {
+                for (n = 0; n <= left_deg; ++n)
+                    node[n] = left[n];
+
+                continue;
+            }
+
+            right_deg = tmpl_intpoly_subproduct_node_degree(level - 1,
+                                                            2 * j + 1,
+                                                            length);
+
+            tmpl_intpoly_subproduct_multiply(node, left, left_deg + 1,
+                                             left + (width / 2 + 1),
+                                             right_deg + 1, work->words);
+        }
+    }
+
+    /*  The root covers every point. Reduce f modulo it.                      */
+    cur = rems[0];
+    next = rems[1];
+    tmpl_intpoly_subproduct_remainder(cur, f, f_len, tree[levels - 1],
+                                      length, work);
+
+    /*  Walk down the tree, reducing each remainder modulo the children.      */
+    for (level = levels - 1; level > 0; --level)
+    {
+        width = TMPL_INTPOLY_SUBPRODUCT_LEAF << level;
+        nodes = (length + width - 1) / width;
+
+        for (j = 0; j < nodes; ++j)
+        {
+            const size_t child_width = width / 2;
+            const size_t first = 2 * j;
+            const size_t children = (first * child_width + child_width <
+                                     length ? 2 : 1);
+
+            deg = tmpl_intpoly_subproduct_node_degree(level, j, length);
+
+            for (k = first; k < first + children; ++k)
+                tmpl_intpoly_subproduct_remainder(
+                    next + k * child_width,
+                    cur + j * width, deg,
+                    tree[level - 1] + k * (child_width + 1),
+                    tmpl_intpoly_subproduct_node_degree(level - 1, k, length),
+                    work
+                );
+        }
+
+        swap = cur;
+        cur = next;
+        next = swap;
+    }
+
+    /*  The remainders at the leaves have small degree. Evaluate directly.    */
+    nodes = (length + TMPL_INTPOLY_SUBPRODUCT_LEAF - 1) /
+            TMPL_INTPOLY_SUBPRODUCT_LEAF;
+
+    for (j = 0; j < nodes; ++j)
+    {
+        const int *rem = cur + j * TMPL_INTPOLY_SUBPRODUCT_LEAF;
+        const size_t start = j * TMPL_INTPOLY_SUBPRODUCT_LEAF;
+        deg = tmpl_intpoly_subproduct_node_degree(0, j, length);
+
+        for (n = 0; n < deg; ++n)
+        {
+            point = (unsigned int)x[start + n];
+            eval = (unsigned int)rem[deg - 1];
+
+            for (k = deg - 1; k > 0; --k)
+                eval = eval * point + (unsigned int)rem[k - 1];
+
+            evals[start + n] = tmpl_intpoly_word_to_int(eval);
+        }
+    }
+}
+/*  End of tmpl_intpoly_subproduct_block.                                     */
+
+/*  Function for evaluating a polynomial at many integers.                    */
+void
+tmpl_IntPolynomial_Eval_Array_Subproduct(int *evals,
+                                         const tmpl_IntPolynomial *poly,
+                                         const int *x,
+                                         size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    tmpl_intpoly_subproduct_work work;
+    int *tree[sizeof(size_t) * CHAR_BIT];
+    int *rems[2];
+    int *ints;
+    size_t block, length, levels, level, n, total, tree_size, words, temp_len;
+
+    /*  Nothing can be done if there is nowhere to read from or write to.     */
+    if (!evals || !x)
+        return;
+
+    /*  NULL, flawed, and empty polynomials are considered to be zero.        */
+    if (!poly || poly->error_occurred || !poly->coeffs)
+    {
+        for (n = 0; n < len; ++n)
+            evals[n] = 0;
+
+        return;
+    }
+
+    /*  Blocks of deg(f) + 1 points, so f is already reduced modulo the root. *
+     *  The tree is only worth it if there is more than one leaf.             */
+    block = poly->degree + 1;
+
+    if (block > len)
+        block = len;
+
+    if (block <= TMPL_INTPOLY_SUBPRODUCT_LEAF)
+    {
+        tmpl_IntPolynomial_Eval_Array_Horner(evals, poly, x, len);
+        return;
+    }
+
+    /*  Number of levels in the tree, and the total size of its nodes.        */
+    levels = 1;
+    tree_size = 0;
+
+    while ((TMPL_INTPOLY_SUBPRODUCT_LEAF << (levels - 1)) < block)
+        ++levels;
+
+    for (level = 0; level < levels; ++level)
+    {
+        const size_t width = TMPL_INTPOLY_SUBPRODUCT_LEAF << level;
+        tree_size += ((block + width - 1) / width) * (width + 1);
+    }
+
+    /*  The tree, two remainder arrays, and six temporary polynomials. The    *
+     *  longest temporary is a product of two polynomials of degree at most   *
+     *  deg(f), or of the quotient with the root.                             */
+    temp_len = 2 * (poly->degree + 1) + block;
+    total = tree_size + 2 * (block + 1) + 6 * temp_len;
+    n = poly->degree + 2;
+    words = tmpl_intpoly_unbalanced_scratch(n, n,
+                                            tmpl_intpoly_karatsuba_scratch(n));
+
+    ints = TMPL_MALLOC(int, total);
+    work.words = TMPL_MALLOC(tmpl_intpoly_word, words);
+
+    /*  If malloc fails, fall back to Horner's method.                        */
+    if (!ints || !work.words)
+    {
+        TMPL_FREE(ints);
+        TMPL_FREE(work.words);
+        tmpl_IntPolynomial_Eval_Array_Horner(evals, poly, x, len);
+        return;
+    }
+
+    /*  Carve the memory into the tree levels and the temporaries.            */
+    tree[0] = ints;
+
+    for (level = 1; level < levels; ++level)
+    {
+        const size_t width = TMPL_INTPOLY_SUBPRODUCT_LEAF << (level - 1);
+        tree[level] = tree[level - 1] + ((block + width - 1) / width) *
+                                        (width + 1);
+    }
+
+    rems[0] = ints + tree_size;
+    rems[1] = rems[0] + (block + 1);
+    work.rev_f = rems[1] + (block + 1);
+    work.rev_g = work.rev_f + temp_len;
+    work.inverse = work.rev_g + temp_len;
+    work.tmp = work.inverse + temp_len;
+    work.quot = work.tmp + temp_len;
+    work.prod = work.quot + temp_len;
+
+    /*  Evaluate one block of points at a time. The final block may be        *
+     *  shorter, and then its tree has fewer levels.                          */
+    for (n = 0; n < len; n += length)
+    {
+        length = (len - n < block ? len - n : block);
+
+        levels = 1;
+
+        while ((TMPL_INTPOLY_SUBPRODUCT_LEAF << (levels - 1)) < length)
+            ++levels;
+
+        tmpl_intpoly_subproduct_block(evals + n, poly->coeffs,
+                                      poly->degree + 1, x + n, length, levels,
+                                      tree, rems, &work);
+    }
+
+    TMPL_FREE(ints);
+    TMPL_FREE(work.words);
+}
+/*  End of tmpl_IntPolynomial_Eval_Array_Subproduct.                          */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_INTPOLY_SUBPRODUCT_LEAF
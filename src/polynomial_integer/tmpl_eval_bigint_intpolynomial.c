@@ -0,0 +1,124 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                      tmpl_eval_bigint_intpolynomial                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Evaluates a polynomial exactly at an arbitrary-precision integer.     *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomial_Eval_BigInt                                        *
+ *  Purpose:                                                                  *
+ *      Evaluates a polynomial with integer coefficients at a big integer,    *
+ *      without overflow.                                                     *
+ *  Arguments:                                                                *
+ *      eval (tmpl_BigInt *):                                                 *
+ *          An initialized number, the value of poly at x.                    *
+ *      poly (const tmpl_IntPolynomial *):                                    *
+ *          A pointer to a polynomial.                                        *
+ *      x (const tmpl_BigInt *):                                              *
+ *          The point where poly is evaluated.                                *
+ *  Outputs:                                                                  *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      libtmpl/include/tmpl_bigint.h:                                        *
+ *          tmpl_BigInt_Multiply:                                             *
+ *              Multiplies the running value by x.                            *
+ *          tmpl_BigInt_Add:                                                  *
+ *              Adds the next coefficient.                                    *
+ *  Method:                                                                   *
+ *      Use Horner's method to loop over the coefficients of the polynomial.  *
+ *      Unlike tmpl_IntPolynomial_Eval, every step is exact.                  *
+ *  Notes:                                                                    *
+ *      As with tmpl_IntPolynomial_Eval, NULL, flawed, and empty polynomials  *
+ *      are treated as zero. A NULL or invalid x sets the error_occurred      *
+ *      Boolean of eval. eval may be the same as x.                           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) stddef.h:                                                             *
+ *          Standard library file where size_t is provided.                   *
+ *  2.) tmpl_bigint.h:                                                        *
+ *          Header file with arbitrary-precision integer arithmetic.          *
+ *  3.) tmpl_polynomial_integer.h:                                            *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  size_t date type provided here.                                           */
+#include <stddef.h>
+
+/*  tmpl_BigInt_Multiply and tmpl_BigInt_Add found here.                      */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  Function prototype provided here.                                         */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  Function for evaluating a polynomial at a big integer.                    */
+void
+tmpl_IntPolynomial_Eval_BigInt(tmpl_BigInt *eval,
+                               const tmpl_IntPolynomial *poly,
+                               const tmpl_BigInt *x)
+{
+    /*  Variable for indexing over the coefficients of poly.                  */
+    size_t n;
+
+    /*  The running value of Horner's method, and the current coefficient.    */
+    tmpl_BigInt acc, coeff;
+
+    /*  Nothing to do if there is nowhere to write.                           */
+    if (!eval)
+        return;
+
+    /*  Copying a NULL or invalid number passes the error along to eval.      */
+    if (!x || x->error_occurred)
+    {
+        tmpl_BigInt_Copy(eval, x);
+        return;
+    }
+
+    /*  NULL, flawed, and empty polynomials are considered to be zero.        */
+    if (!poly || poly->error_occurred || !poly->coeffs)
+    {
+        tmpl_BigInt_Set_Long(eval, 0L);
+        return;
+    }
+
+    /*  eval may be the same as x, so accumulate in a temporary.              */
+    tmpl_BigInt_Init(&acc);
+    tmpl_BigInt_Init(&coeff);
+    tmpl_BigInt_Set_Long(&acc, (signed long int)poly->coeffs[poly->degree]);
+
+    /*  Loop over the remaining terms using Horner's method. Errors in acc    *
+     *  are passed along by each call, so they are checked once at the end.   */
+    for (n = poly->degree; n > 0; --n)
+    {
+        tmpl_BigInt_Set_Long(&coeff, (signed long int)poly->coeffs[n - 1]);
+        tmpl_BigInt_Multiply(&acc, &acc, x);
+        tmpl_BigInt_Add(&acc, &acc, &coeff);
+    }
+
+    tmpl_BigInt_Copy(eval, &acc);
+    tmpl_BigInt_Destroy(&acc);
+    tmpl_BigInt_Destroy(&coeff);
+}
+/*  End of tmpl_IntPolynomial_Eval_BigInt.                                    */
@@ -0,0 +1,137 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                    tmpl_from_arena_intpolynomial_buffer                    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Creates a capacity-aware polynomial whose memory comes from an arena. *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomialBuffer_From_Arena                                   *
+ *  Purpose:                                                                  *
+ *      Takes a given number of coefficients from an arena and initializes    *
+ *      the polynomial to zero. No memory is allocated.                       *
+ *  Arguments:                                                                *
+ *      arena (tmpl_IntPolynomialArena *):                                    *
+ *          The arena the coefficients are taken from.                        *
+ *      capacity (size_t):                                                    *
+ *          The number of coefficients to take. Zero is treated as one.       *
+ *  Output:                                                                   *
+ *      buffer (tmpl_IntPolynomialBuffer):                                    *
+ *          The zero polynomial with room for capacity coefficients.          *
+ *  Method:                                                                   *
+ *      Point coeffs at the first unused element of the arena and advance     *
+ *      the used counter by capacity. This is a pointer bump, it costs the    *
+ *      same for every size.                                                  *
+ *  Notes:                                                                    *
+ *      1.) If the arena is NULL, has an error, or does not have capacity     *
+ *          unused coefficients left, the error_occurred Boolean is set.      *
+ *                                                                            *
+ *      2.) The capacity of the output is fixed. Operations that need more    *
+ *          room set the error_occurred Boolean instead of reallocating.      *
+ *                                                                            *
+ *      3.) The memory is returned with tmpl_IntPolynomialArena_Reset. It is  *
+ *          safe, but not necessary, to call tmpl_IntPolynomialBuffer_Destroy.*
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_polynomial_arena_int.h:                                          *
+ *          Header where the tmpl_IntPolynomialArena typedef is given.        *
+ *  3.) tmpl_polynomial_buffer_int.h:                                         *
+ *          Header where the tmpl_IntPolynomialBuffer typedef is given.       *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  tmpl_Bool, tmpl_False, and tmpl_True are given here.                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Integer polynomial arena typedef provided here.                           */
+#include <libtmpl/include/types/tmpl_polynomial_arena_int.h>
+
+/*  Capacity-aware integer polynomial typedef provided here.                  */
+#include <libtmpl/include/types/tmpl_polynomial_buffer_int.h>
+
+/*  Forward declaration / function prototype.                                 */
+extern tmpl_IntPolynomialBuffer
+tmpl_IntPolynomialBuffer_From_Arena(tmpl_IntPolynomialArena *arena,
+                                    const size_t capacity);
+
+/*  Function for taking a zero polynomial out of an arena.                    */
+tmpl_IntPolynomialBuffer
+tmpl_IntPolynomialBuffer_From_Arena(tmpl_IntPolynomialArena *arena,
+                                    const size_t capacity)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_IntPolynomialBuffer buffer;
+
+    /*  The zero polynomial needs at least one coefficient.                   */
+    const size_t length = (capacity == 0 ? 1 : capacity);
+
+    /*  Start with an empty buffer. This is returned on error.                */
+    buffer.coeffs = NULL;
+    buffer.degree = 0;
+    buffer.capacity = 0;
+    buffer.owns_memory = tmpl_False;
+    buffer.error_occurred = tmpl_False;
+    buffer.error_message = NULL;
+
+    /*  Check for invalid inputs. Treat these as an error.                    */
+    if (!arena)
+    {
+        buffer.error_occurred = tmpl_True;
+        buffer.error_message =
+            "\nError Encountered: libtmpl\n"
+            "    tmpl_IntPolynomialBuffer_From_Arena\n\n"
+            "Input arena is NULL. Aborting.\n\n";
+
+        return buffer;
+    }
+
+    /*  Errors in creating the arena are passed along.                        */
+    if (arena->error_occurred)
+    {
+        buffer.error_occurred = tmpl_True;
+        buffer.error_message = arena->error_message;
+        return buffer;
+    }
+
+    /*  The arena never grows. Check that there is enough room left.          */
+    if (arena->capacity - arena->used < length)
+    {
+        buffer.error_occurred = tmpl_True;
+        buffer.error_message =
+            "\nError Encountered: libtmpl\n"
+            "    tmpl_IntPolynomialBuffer_From_Arena\n\n"
+            "Not enough room left in the arena. Aborting.\n\n";
+
+        return buffer;
+    }
+
+    /*  Hand out the next length coefficients of the arena.                   */
+    buffer.coeffs = arena->data + arena->used;
+    buffer.capacity = length;
+    buffer.coeffs[0] = 0;
+    arena->used += length;
+    return buffer;
+}
+/*  End of tmpl_IntPolynomialBuffer_From_Arena.                               */
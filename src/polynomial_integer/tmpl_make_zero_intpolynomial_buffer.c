@@ -0,0 +1,71 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                    tmpl_make_zero_intpolynomial_buffer                     *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Sets a capacity-aware polynomial to zero without freeing memory.      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomialBuffer_Make_Zero                                    *
+ *  Purpose:                                                                  *
+ *      Sets the polynomial to zero. The capacity is kept.                    *
+ *  Arguments:                                                                *
+ *      buffer (tmpl_IntPolynomialBuffer *):                                  *
+ *          The polynomial that is to be set to zero.                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_polynomial_integer.h:                                            *
+ *          tmpl_IntPolynomialBuffer_Reserve:                                 *
+ *              Allocates memory if the buffer is empty.                      *
+ *  Method:                                                                   *
+ *      Set the degree and the constant coefficient to zero. Only a buffer    *
+ *      with NULL coeffs needs memory, every other call is O(1).              *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_polynomial_integer.h:                                            *
+ *          Header where the function prototype is given.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  Function for setting a polynomial to zero, keeping the memory.            */
+void tmpl_IntPolynomialBuffer_Make_Zero(tmpl_IntPolynomialBuffer *buffer)
+{
+    /*  If the input is NULL there is nothing to be done.                     */
+    if (!buffer)
+        return;
+
+    /*  Empty buffers need room for the constant term.                        */
+    tmpl_IntPolynomialBuffer_Reserve(buffer, 1);
+
+    /*  Reserve sets the error Boolean on failure. Check for this.            */
+    if (buffer->error_occurred)
+        return;
+
+    buffer->coeffs[0] = 0;
+    buffer->degree = 0;
+}
+/*  End of tmpl_IntPolynomialBuffer_Make_Zero.                                */
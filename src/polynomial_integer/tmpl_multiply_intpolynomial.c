@@ -1,14 +1,104 @@
-#include <libtmpl/include/tmpl_polynomial_integer.h>
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                        tmpl_multiply_intpolynomial                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiply two polynomials with integer coefficients.                   *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomial_Multiply                                           *
+ *  Purpose:                                                                  *
+ *      Computes the product of two polynomials over Z[x] with 'int'          *
+ *      coefficients, choosing the fastest method for the given degrees.      *
+ *  Arguments:                                                                *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          A pointer to a polynomial.                                        *
+ *      Q (const tmpl_IntPolynomial *):                                       *
+ *          Another pointer to a polynomial.                                  *
+ *      prod (tmpl_IntPolynomial *):                                          *
+ *          A pointer to a polynomial. The product is stored here.            *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_polynomial_integer.h:                                            *
+ *          tmpl_IntPolynomial_Multiply_Naive:                                *
+ *              Classical O(n m) product.                                     *
+ *          tmpl_IntPolynomial_Multiply_Karatsuba:                            *
+ *              Karatsuba product, O(n^1.585).                                *
+ *          tmpl_IntPolynomial_Multiply_Toom3:                                *
+ *              Toom-3 product, O(n^1.465).                                   *
+ *  Method:                                                                   *
+ *      The cost of the fast methods is governed by the shorter factor, the   *
+ *      longer one is cut into blocks of the same length. If the shorter      *
+ *      factor has fewer than TMPL_INTPOLY_KARATSUBA_THRESHOLD coefficients   *
+ *      the naive method is used. Otherwise, if it has fewer than             *
+ *      TMPL_INTPOLY_TOOM3_THRESHOLD, Karatsuba's method is used. Longer      *
+ *      polynomials use Toom-3.                                               *
+ *  Notes:                                                                    *
+ *      All methods give identical results. Errors are handled as in the      *
+ *      called functions: inspect "prod" after using this function.           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_polynomial_integer.h:                                            *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       February 8, 2023                                              *
+ ******************************************************************************
+ *                              Revision History                              *
+ ******************************************************************************
+ *  2026/10/18: Ryan Maguire                                                  *
+ *      Dispatch to Karatsuba and Toom-3 for large degrees.                   *
+ ******************************************************************************/
 
-/*  TODO:
- *      Make this a hybrid Karatsuba / Naive algorithm, pending degrees.
- *      Experiment with DFT's for large degree polynomials.
- */
+/*  Polynomial typedefs and function prototype.                               */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
 
+/*  Function for multiplying two polynomials.                                 */
 void
 tmpl_IntPolynomial_Multiply(const tmpl_IntPolynomial *P,
                             const tmpl_IntPolynomial *Q,
                             tmpl_IntPolynomial *prod)
 {
-    tmpl_IntPolynomial_Multiply_Naive(P, Q, prod);
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t length;
+
+    /*  Invalid and empty inputs are handled by the naive routine.            */
+    if (!prod || !P || !Q || !P->coeffs || !Q->coeffs)
+    {
+        tmpl_IntPolynomial_Multiply_Naive(P, Q, prod);
+        return;
+    }
+
+    /*  The length of the shorter factor decides the method.                  */
+    length = (P->degree < Q->degree ? P->degree : Q->degree) + 1;
+
+    if (length < TMPL_INTPOLY_KARATSUBA_THRESHOLD)
+        tmpl_IntPolynomial_Multiply_Naive(P, Q, prod);
+
+    else if (length < TMPL_INTPOLY_TOOM3_THRESHOLD)
+        tmpl_IntPolynomial_Multiply_Karatsuba(P, Q, prod);
+
+    else
+        tmpl_IntPolynomial_Multiply_Toom3(P, Q, prod);
 }
+/*  End of tmpl_IntPolynomial_Multiply.                                       */
@@ -0,0 +1,83 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                     tmpl_multiply_intpolynomial_buffer                     *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies two polynomials into a capacity-aware polynomial.          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomialBuffer_Multiply                                     *
+ *  Purpose:                                                                  *
+ *      Computes buffer = P * Q, reusing the memory of the buffer.            *
+ *  Arguments:                                                                *
+ *      buffer (tmpl_IntPolynomialBuffer *):                                  *
+ *          The polynomial the product is written to.                         *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          The first factor of the product.                                  *
+ *      Q (const tmpl_IntPolynomial *):                                       *
+ *          The second factor of the product.                                 *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_polynomial_integer.h:                                            *
+ *          tmpl_IntPolynomialBuffer_Make_Zero:                               *
+ *              Sets the buffer to zero.                                      *
+ *          tmpl_IntPolynomialBuffer_AddTo_Product:                           *
+ *              Accumulates the product into the buffer.                      *
+ *  Method:                                                                   *
+ *      Set the buffer to zero, which keeps its memory, and accumulate the    *
+ *      product into it with the fused multiply-add.                          *
+ *  Notes:                                                                    *
+ *      The same rules as tmpl_IntPolynomialBuffer_AddTo_Product apply. In    *
+ *      particular P and Q may not be views of the buffer.                    *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_polynomial_integer.h:                                            *
+ *          Header where the function prototype is given.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  Function for computing buffer = P * Q without reallocating once warm.     */
+void
+tmpl_IntPolynomialBuffer_Multiply(tmpl_IntPolynomialBuffer *buffer,
+                                  const tmpl_IntPolynomial *P,
+                                  const tmpl_IntPolynomial *Q)
+{
+    /*  If the output is NULL there is nothing to be done.                    */
+    if (!buffer)
+        return;
+
+    /*  Similarly if an error occurred previously.                            */
+    if (buffer->error_occurred)
+        return;
+
+    /*  Start from zero. This is O(1), the memory is kept.                    */
+    tmpl_IntPolynomialBuffer_Make_Zero(buffer);
+
+    /*  The product is now the fused multiply-add with a zero accumulator.    */
+    tmpl_IntPolynomialBuffer_AddTo_Product(buffer, P, Q);
+}
+/*  End of tmpl_IntPolynomialBuffer_Multiply.                                 */
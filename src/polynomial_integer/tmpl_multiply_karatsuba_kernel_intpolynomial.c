@@ -0,0 +1,184 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                tmpl_multiply_karatsuba_kernel_intpolynomial                *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiply two polynomials with integer coefficients using Karatsuba's  *
+ *      method, with a caller-provided workspace.                             *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomial_Multiply_Karatsuba_Scratch_Size                    *
+ *  Purpose:                                                                  *
+ *      Computes the number of bytes of workspace needed to multiply two      *
+ *      polynomials with tmpl_IntPolynomial_Multiply_Karatsuba_Kernel.        *
+ *  Arguments:                                                                *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          A pointer to a polynomial.                                        *
+ *      Q (const tmpl_IntPolynomial *):                                       *
+ *          Another pointer to a polynomial.                                  *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The size of the workspace, in bytes.                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomial_Multiply_Karatsuba_Kernel                          *
+ *  Purpose:                                                                  *
+ *      Computes the product of two polynomials over Z[x] with 'int'          *
+ *      coefficients in O(n^log2(3)) time, where n is the smaller length.     *
+ *  Arguments:                                                                *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          A pointer to a polynomial.                                        *
+ *      Q (const tmpl_IntPolynomial *):                                       *
+ *          Another pointer to a polynomial.                                  *
+ *      prod (tmpl_IntPolynomial *):                                          *
+ *          A pointer to a polynomial. The product is stored here.            *
+ *      scratch (void *):                                                     *
+ *          Workspace of at least                                             *
+ *          tmpl_IntPolynomial_Multiply_Karatsuba_Scratch_Size(P, Q) bytes,   *
+ *          obtained from malloc or suitably aligned.                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          realloc:                                                          *
+ *              Resizes the product if needed.                                *
+ *      tmpl_string.h:                                                        *
+ *          tmpl_String_Duplicate:                                            *
+ *              Duplicates a string. Equivalent to the POSIX function strdup. *
+ *  Method:                                                                   *
+ *      The shorter polynomial is multiplied by blocks of the longer one of   *
+ *      the same length, each using the balanced Karatsuba recursion in       *
+ *      auxiliary/tmpl_intpolynomial_fast_multiply.h. All of the temporary    *
+ *      arrays are carved out of the workspace, so apart from resizing the    *
+ *      product nothing is allocated.                                         *
+ *  Notes:                                                                    *
+ *      1.) No error checks are performed on P and Q. This function assumes   *
+ *          both have coefficient arrays and no errors. Use                   *
+ *          tmpl_IntPolynomial_Multiply_Karatsuba for a checked version.      *
+ *                                                                            *
+ *      2.) prod may not be P or Q.                                           *
+ *                                                                            *
+ *      3.) If the product is too large for an int the coefficients wrap      *
+ *          around, as with the classical kernel on most platforms.           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_realloc.h:                                                       *
+ *          Header file providing the TMPL_REALLOC macro.                     *
+ *  2.) tmpl_cast.h:                                                          *
+ *          Header file providing the TMPL_CAST macro.                        *
+ *  3.) tmpl_bool.h:                                                          *
+ *          Header file containing Booleans.                                  *
+ *  4.) tmpl_string.h:                                                        *
+ *          Header file where tmpl_String_Duplicate is declared.              *
+ *  5.) tmpl_polynomial_integer.h:                                            *
+ *          Header file where the function prototypes are given.              *
+ *  6.) tmpl_intpolynomial_fast_multiply.h:                                   *
+ *          Private header with the Karatsuba recursion.                      *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_REALLOC and TMPL_CAST macros provided here.                          */
+#include <libtmpl/include/compat/tmpl_realloc.h>
+#include <libtmpl/include/compat/tmpl_cast.h>
+
+/*  Boolean given here.                                                       */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  tmpl_String_Duplicate function provided here.                             */
+#include <libtmpl/include/tmpl_string.h>
+
+/*  Polynomial typedefs and function prototype.                               */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  Karatsuba recursion and the unbalanced driver found here.                 */
+#include "auxiliary/tmpl_intpolynomial_fast_multiply.h"
+
+/*  Function for computing the size of the workspace.                         */
+size_t
+tmpl_IntPolynomial_Multiply_Karatsuba_Scratch_Size(const tmpl_IntPolynomial *P,
+                                                   const tmpl_IntPolynomial *Q)
+{
+    /*  Lengths of the coefficient arrays, sorted.                            */
+    const size_t p_len = P->degree + 1;
+    const size_t q_len = Q->degree + 1;
+    const size_t short_len = (p_len < q_len ? p_len : q_len);
+    const size_t long_len = (p_len < q_len ? q_len : p_len);
+
+    /*  Workspace for the driver plus the recursion, in words.                */
+    const size_t words = tmpl_intpoly_unbalanced_scratch(
+        short_len, long_len, tmpl_intpoly_karatsuba_scratch(short_len)
+    );
+
+    return words * sizeof(tmpl_intpoly_word);
+}
+/*  End of tmpl_IntPolynomial_Multiply_Karatsuba_Scratch_Size.                */
+
+/*  Function for multiplying two polynomials with Karatsuba's method.         */
+void
+tmpl_IntPolynomial_Multiply_Karatsuba_Kernel(const tmpl_IntPolynomial *P,
+                                             const tmpl_IntPolynomial *Q,
+                                             tmpl_IntPolynomial *prod,
+                                             void *scratch)
+{
+    /*  The degree of the product is the sum of the two degrees.              */
+    const size_t deg = P->degree + Q->degree;
+
+    /*  Check if prod needs to be resized.                                    */
+    if (prod->degree != deg || !prod->coeffs)
+    {
+        /*  Try to allocate memory for the product.                           */
+        void * const tmp = TMPL_REALLOC(prod->coeffs, deg + 1);
+
+        /*  Check if realloc failed. Abort the computation if it did.         */
+        if (!tmp)
+        {
+            prod->error_occurred = tmpl_True;
+            prod->error_message = tmpl_String_Duplicate(
+                "\nError Encountered:\n"
+                "    tmpl_IntPolynomial_Multiply_Karatsuba_Kernel\n\n"
+                "realloc failed. Aborting.\n\n"
+            );
+
+            return;
+        }
+
+        /*  Otherwise reset the coefficient pointer.                          */
+        prod->coeffs = TMPL_CAST(tmp, int *);
+        prod->degree = deg;
+    }
+
+    /*  The driver wants the shorter polynomial first.                        */
+    if (P->degree <= Q->degree)
+        tmpl_intpoly_unbalanced_product(
+            P->coeffs, P->degree + 1, Q->coeffs, Q->degree + 1, prod->coeffs,
+            tmpl_intpoly_karatsuba, TMPL_CAST(scratch, tmpl_intpoly_word *)
+        );
+
+    else
+        tmpl_intpoly_unbalanced_product(
+            Q->coeffs, Q->degree + 1, P->coeffs, P->degree + 1, prod->coeffs,
+            tmpl_intpoly_karatsuba, TMPL_CAST(scratch, tmpl_intpoly_word *)
+        );
+}
+/*  End of tmpl_IntPolynomial_Multiply_Karatsuba_Kernel.                      */
@@ -0,0 +1,421 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                      tmpl_multiply_ntt_intpolynomial                       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies polynomials with int coefficients exactly, using the       *
+ *      number theoretic transform.                                           *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomial_Multiply_NTT                                       *
+ *  Purpose:                                                                  *
+ *      Computes the product of two polynomials over Z[x] with 'int'          *
+ *      coefficients in O(n log(n)) time, detecting coefficient overflow.     *
+ *  Arguments:                                                                *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          A pointer to a polynomial.                                        *
+ *      Q (const tmpl_IntPolynomial *):                                       *
+ *          Another pointer to a polynomial.                                  *
+ *      prod (tmpl_IntPolynomial *):                                          *
+ *          A pointer to a polynomial. The product is stored here.            *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates the transform buffers.                              *
+ *          realloc:                                                          *
+ *              Resizes the product.                                          *
+ *          free:                                                             *
+ *              Releases the transform buffers.                               *
+ *      tmpl_polynomial_integer.h:                                            *
+ *          tmpl_IntPolynomial_Make_Zero:                                     *
+ *              Converts a polynomial into the zero polynomial.               *
+ *          tmpl_IntPolynomial_Shrink:                                        *
+ *              Shrinks a polynomial by removing all terms past the largest   *
+ *              non-zero coefficient.                                         *
+ *      tmpl_string.h:                                                        *
+ *          tmpl_strdup:                                                      *
+ *              Duplicates a string. Equivalent to the POSIX function strdup. *
+ *  Method:                                                                   *
+ *      Let B = min(deg(P), deg(Q)) + 1 times the largest magnitudes of the   *
+ *      coefficients of P and Q. Every coefficient of P * Q lies in [-B, B].  *
+ *      Choose k primes p_i with M = p_0 ... p_{k-1} > 2B. For each prime,    *
+ *      compute P * Q modulo p_i with a transform of length N, the smallest   *
+ *      power of two with N > deg(P) + deg(Q). Since N exceeds the degree,    *
+ *      the cyclic convolution is the ordinary product. The Chinese remainder *
+ *      theorem recovers each coefficient modulo M, and since |c| <= B < M/2  *
+ *      the representative in (-M/2, M/2) is the exact coefficient. This is   *
+ *      then compared with INT_MIN and INT_MAX.                               *
+ *                                                                            *
+ *      k depends on the actual sizes of the coefficients. Products of small  *
+ *      coefficients need only two or three transforms per operand.           *
+ *  Notes:                                                                    *
+ *      There are several possible ways for an error to occur.                *
+ *          1.) The "prod" variable is NULL, or has error_occurred = true.    *
+ *          2.) An input polynomial (P or Q) has error_occurred = true.       *
+ *          3.) malloc or realloc fail.                                       *
+ *          4.) The product is too long for the transforms. The limit is      *
+ *              between 2^23 and 2^27 coefficients, depending on how many     *
+ *              primes the size of the coefficients calls for.                *
+ *          5.) A coefficient of the product does not fit in an int. The      *
+ *              other multiplication routines silently wrap around instead.   *
+ *      One can safely handle all cases by inspecting "prod" after using this *
+ *      function. First check if it is NULL, then if error_occurred = true.   *
+ *      prod may be P or Q. It is only written to once the product is known.  *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) limits.h:                                                             *
+ *          Standard library header with INT_MIN and INT_MAX.                 *
+ *  2.) tmpl_malloc.h:                                                        *
+ *          Header file providing the TMPL_MALLOC macro.                      *
+ *  3.) tmpl_realloc.h:                                                       *
+ *          Header file providing the TMPL_REALLOC macro.                     *
+ *  4.) tmpl_free.h:                                                          *
+ *          Header file providing the TMPL_FREE macro.                        *
+ *  5.) tmpl_cast.h:                                                          *
+ *          Header file providing the TMPL_CAST macro.                        *
+ *  6.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  7.) tmpl_limits.h:                                                        *
+ *          Header file with the width of unsigned int.                       *
+ *  8.) tmpl_string.h:                                                        *
+ *          Header file where tmpl_strdup is declared.                        *
+ *  9.) tmpl_polynomial_integer.h:                                            *
+ *          Header file where the function prototype is given.                *
+ *  10.) tmpl_intpolynomial_ntt.h:                                            *
+ *          Private header with the transforms and the CRT.                   *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  INT_MIN and INT_MAX found here.                                           */
+#include <limits.h>
+
+/*  Memory management macros provided here.                                   */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+#include <libtmpl/include/compat/tmpl_realloc.h>
+#include <libtmpl/include/compat/tmpl_free.h>
+#include <libtmpl/include/compat/tmpl_cast.h>
+
+/*  Boolean given here.                                                       */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  TMPL_UINT_BIT macro found here.                                           */
+#include <libtmpl/include/tmpl_limits.h>
+
+/*  tmpl_strdup function provided here.                                       */
+#include <libtmpl/include/tmpl_string.h>
+
+/*  Polynomial typedefs and function prototype.                               */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  Transforms and the Chinese remainder theorem found here.                  */
+#include "auxiliary/tmpl_intpolynomial_ntt.h"
+
+/*  Error messages all start with the name of the function.                   */
+#define TMPL_NTT_ERROR(reason)                                                 \
+    "\nError Encountered:\n"                                                   \
+    "    tmpl_IntPolynomial_Multiply_NTT\n\n" reason "\n\n"
+
+#if TMPL_INTPOLY_HAS_NTT == 1
+
+/*  Magnitude of a coefficient. This is valid for the most negative one too.  */
+#define TMPL_INT_MAGNITUDE(c) \
+    ((c) < 0 ? 0U - (unsigned int)(c) : (unsigned int)(c))
+
+/*  Number of bits in the largest magnitude of the coefficients.              */
+static unsigned int
+tmpl_ntt_coefficient_bits(const int *coeffs, size_t length)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    unsigned int bits = 0U;
+    unsigned int largest = 0U;
+
+    for (n = 0; n < length; ++n)
+    {
+        const unsigned int mag = TMPL_INT_MAGNITUDE(coeffs[n]);
+
+        if (mag > largest)
+            largest = mag;
+    }
+
+    while (largest)
+    {
+        ++bits;
+        largest >>= 1;
+    }
+
+    return bits;
+}
+/*  End of tmpl_ntt_coefficient_bits.                                         */
+
+/*  Reduces the coefficients modulo the prime and zero-pads to length N.      */
+static void
+tmpl_ntt_load(tmpl_UInt32 *data, const int *coeffs,
+              size_t length, size_t N,
+              const tmpl_intpoly_ntt_modulus *mod)
+{
+    size_t n;
+
+    for (n = 0; n < length; ++n)
+        data[n] = tmpl_intpoly_ntt_from_residue(
+            TMPL_INT_MAGNITUDE(coeffs[n]) % mod->p, coeffs[n] < 0, mod
+        );
+
+    for (n = length; n < N; ++n)
+        data[n] = 0U;
+}
+/*  End of tmpl_ntt_load.                                       */
+
+/*  Computes the exact product. Returns an error message on failure, and     *
+ *  NULL on success.                                                          */
+static const char *
+tmpl_ntt_product(const tmpl_IntPolynomial *P,
+                 const tmpl_IntPolynomial *Q,
+                 tmpl_IntPolynomial *prod)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, N;
+    unsigned int i, k, bits;
+    tmpl_UInt32 *buffer, *residues, *a, *b, *tmp, *twiddles;
+    tmpl_intpoly_ntt_modulus mod;
+    tmpl_intpoly_ntt_crt crt;
+    void *coeffs;
+    tmpl_Bool overflow = tmpl_False;
+
+    /*  Lengths of the factors and the product.                               */
+    const size_t p_len = P->degree + 1;
+    const size_t q_len = Q->degree + 1;
+    const size_t length = p_len + q_len - 1;
+
+    /*  The largest value of a product, in absolute value, is bounded by the  *
+     *  length of the shorter factor times the largest coefficients of each.  */
+    const tmpl_Bool square = (P == Q);
+    const unsigned int p_bits = tmpl_ntt_coefficient_bits(P->coeffs, p_len);
+    const unsigned int q_bits = (square ? p_bits :
+                                 tmpl_ntt_coefficient_bits(Q->coeffs, q_len));
+
+    /*  Negative coefficients have magnitude up to -(INT_MIN + 1) + 1.        */
+    const unsigned int max_positive =
+        (unsigned int)INT_MAX;
+    const unsigned int max_negative =
+        (unsigned int)(-(INT_MIN + 1)) + 1U;
+
+    /*  Number of 32-bit limbs that fit in an unsigned int.                   */
+    const unsigned int width = (TMPL_UINT_BIT + 31U) / 32U;
+
+    bits = p_bits + q_bits + tmpl_intpoly_ntt_bit_length(
+        p_len < q_len ? p_len : q_len
+    );
+
+    k = tmpl_intpoly_ntt_number_of_primes(bits);
+
+    /*  The transform length is the smallest power of two covering the        *
+     *  product. Every prime used must admit a root of unity of this order.   */
+    N = 1;
+
+    while (N < length)
+    {
+        N <<= 1;
+
+        if (!N)
+            return TMPL_NTT_ERROR(
+                "Product is too long for the transform. Aborting."
+            );
+    }
+
+    if (tmpl_intpoly_ntt_bit_length(N) > tmpl_intpoly_ntt_orders[k - 1U] + 1U)
+        return TMPL_NTT_ERROR(
+            "Product is too long for the transform. Aborting."
+        );
+
+    /*  a, b, tmp, and the twiddle factors, plus k rows of residues.          */
+    buffer = TMPL_MALLOC(tmpl_UInt32, 4 * N);
+
+    if (!buffer)
+        return TMPL_NTT_ERROR("malloc failed. Aborting.");
+
+    residues = TMPL_MALLOC(tmpl_UInt32, k * length);
+
+    if (!residues)
+    {
+        TMPL_FREE(buffer);
+        return TMPL_NTT_ERROR("malloc failed. Aborting.");
+    }
+
+    /*  Compute the product modulo each of the primes.                        */
+    for (i = 0U; i < k; ++i)
+    {
+        a = buffer;
+        b = a + N;
+        tmp = b + N;
+        twiddles = tmp + N;
+
+        tmpl_intpoly_ntt_modulus_init(&mod, i);
+        tmpl_ntt_load(a, P->coeffs, p_len, N, &mod);
+
+        if (!square)
+            tmpl_ntt_load(b, Q->coeffs, q_len, N, &mod);
+
+        tmpl_intpoly_ntt_convolve(&a, &b, &tmp, twiddles, N, i, square, &mod);
+
+        for (n = 0; n < length; ++n)
+            residues[i * length + n] = a[n];
+    }
+
+    TMPL_FREE(buffer);
+
+    /*  Only now is the output touched, so prod may be P or Q.                */
+    coeffs = TMPL_REALLOC(prod->coeffs, length);
+
+    if (!coeffs)
+    {
+        TMPL_FREE(residues);
+        return TMPL_NTT_ERROR("realloc failed. Aborting.");
+    }
+
+    prod->coeffs = TMPL_CAST(coeffs, int *);
+    prod->degree = length - 1;
+
+    /*  Reconstruct each coefficient and check that it fits in an int.        */
+    tmpl_intpoly_ntt_crt_init(&crt, k);
+
+    for (n = 0; n < length; ++n)
+    {
+        tmpl_UInt32 limbs[TMPL_INTPOLY_NTT_MAX_PRIMES];
+        unsigned int mag = 0U;
+
+        const tmpl_Bool negative = tmpl_intpoly_ntt_crt_reconstruct(
+            &crt, residues + n, length, limbs
+        );
+
+        /*  Limbs beyond the width of an unsigned int must vanish.            */
+        for (i = width; i < k; ++i)
+            if (limbs[i])
+                overflow = tmpl_True;
+
+        if (overflow)
+            break;
+
+        /*  Assemble the magnitude. Two shifts by 16 avoid a shift by 32.     */
+        for (i = (k < width ? k : width); i > 0U; --i)
+            mag = ((mag << 16) << 16) | (unsigned int)limbs[i - 1U];
+
+        if (mag > (negative ? max_negative : max_positive))
+        {
+            overflow = tmpl_True;
+            break;
+        }
+
+        /*  -(mag - 1) - 1 avoids negating INT_MIN's magnitude directly.      */
+        if (negative)
+            prod->coeffs[n] = -(int)(mag - 1U) - 1;
+        else
+            prod->coeffs[n] = (int)mag;
+    }
+
+    TMPL_FREE(residues);
+
+    if (overflow)
+        return TMPL_NTT_ERROR(
+            "Product coefficient does not fit in an int. Aborting."
+        );
+
+    return NULL;
+}
+/*  End of tmpl_ntt_product.                                    */
+
+#undef TMPL_INT_MAGNITUDE
+
+#endif
+/*  End of #if TMPL_INTPOLY_HAS_NTT == 1.                                     */
+
+/*  Function for multiplying two polynomials exactly with the NTT.            */
+void
+tmpl_IntPolynomial_Multiply_NTT(const tmpl_IntPolynomial *P,
+                                const tmpl_IntPolynomial *Q,
+                                tmpl_IntPolynomial *prod)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    const char *reason;
+
+    /*  If the output pointer is NULL there's nothing to be done.             */
+    if (!prod)
+        return;
+
+    /*  If an error occurred before this function was called, abort.          */
+    if (prod->error_occurred)
+        return;
+
+    /*  Treat NULL polynomials as zero. Product with a zero polyomial is zero.*/
+    if (!P || !Q)
+    {
+        tmpl_IntPolynomial_Make_Zero(prod);
+        return;
+    }
+
+    /*  Similarly if either P or Q have an error.                             */
+    if (P->error_occurred || Q->error_occurred)
+    {
+        prod->error_occurred = tmpl_True;
+        prod->error_message = tmpl_strdup(
+            TMPL_NTT_ERROR(
+                "Input polynomial has error_occurred set to true. Aborting."
+            )
+        );
+
+        return;
+    }
+
+    /*  If either polynomial is empty return zero.                            */
+    if (!P->coeffs || !Q->coeffs)
+    {
+        tmpl_IntPolynomial_Make_Zero(prod);
+        return;
+    }
+
+#if TMPL_INTPOLY_HAS_NTT == 1
+    reason = tmpl_ntt_product(P, Q, prod);
+#else
+    reason = TMPL_NTT_ERROR(
+        "No 32-bit and 64-bit integer types available. Aborting."
+    );
+#endif
+
+    /*  Check if the computation failed, or if the product overflowed.        */
+    if (reason)
+    {
+        prod->error_occurred = tmpl_True;
+        prod->error_message = tmpl_strdup(reason);
+        return;
+    }
+
+    /*  Shrink the result by removing redundant terms.                        */
+    tmpl_IntPolynomial_Shrink(prod);
+}
+/*  End of tmpl_IntPolynomial_Multiply_NTT.                                   */
+
+/*  Erase the TMPL_NTT_ERROR macro.                                           */
+#undef TMPL_NTT_ERROR
@@ -0,0 +1,176 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                     tmpl_multiply_toom3_intpolynomial                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiply two polynomials with integer coefficients using the Toom-3   *
+ *      method.                                                               *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomial_Multiply_Toom3                                     *
+ *  Purpose:                                                                  *
+ *      Computes the product of two polynomials over Z[x] with 'int'          *
+ *      coefficients in O(n^log3(5)) time, where n is the smaller length.     *
+ *  Arguments:                                                                *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          A pointer to a polynomial.                                        *
+ *      Q (const tmpl_IntPolynomial *):                                       *
+ *          Another pointer to a polynomial.                                  *
+ *      prod (tmpl_IntPolynomial *):                                          *
+ *          A pointer to a polynomial. The product is stored here.            *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates the workspace.                                      *
+ *          free:                                                             *
+ *              Releases the workspace.                                       *
+ *      tmpl_polynomial_integer.h:                                            *
+ *          tmpl_IntPolynomial_Multiply_Toom3_Scratch_Size:                   *
+ *              Computes the size of the workspace.                           *
+ *          tmpl_IntPolynomial_Multiply_Toom3_Kernel:                         *
+ *              Multiply two polynomials without error checking or shrinking. *
+ *          tmpl_IntPolynomial_Make_Zero:                                     *
+ *              Converts a polynomial into the zero polynomial.               *
+ *          tmpl_IntPolynomial_Shrink:                                        *
+ *              Shrinks a polynomial by removing all terms past the largest   *
+ *              non-zero coefficient.                                         *
+ *      tmpl_string.h:                                                        *
+ *          tmpl_strdup:                                                      *
+ *              Duplicates a string. Equivalent to the POSIX function strdup. *
+ *  Method:                                                                   *
+ *      Allocate the workspace with a single call to malloc, compute the      *
+ *      product with tmpl_IntPolynomial_Multiply_Toom3_Kernel, and free       *
+ *      the workspace. See the kernel for details on the algorithm.           *
+ *  Notes:                                                                    *
+ *      There are several possible ways for an error to occur.                *
+ *          1.) The "prod" variable is NULL, or has error_occurred = true.    *
+ *          2.) An input polynomial (P or Q) has error_occurred = true.       *
+ *          3.) malloc fails to allocate the workspace.                       *
+ *          4.) realloc fails to resize the coefficient array.                *
+ *      One can safely handle all cases by inspecting "prod" after using this *
+ *      function. First check if it is NULL, then if error_occurred = true.   *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_malloc.h:                                                        *
+ *          Header file providing the TMPL_MALLOC macro.                      *
+ *  2.) tmpl_free.h:                                                          *
+ *          Header file providing the TMPL_FREE macro.                        *
+ *  3.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  4.) tmpl_string.h:                                                        *
+ *          Header file where tmpl_strdup is declared.                        *
+ *  5.) tmpl_polynomial_integer.h:                                            *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_MALLOC and TMPL_FREE macros provided here.                           */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Boolean given here.                                                       */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  tmpl_strdup function provided here.                                       */
+#include <libtmpl/include/tmpl_string.h>
+
+/*  Polynomial typedefs and function prototype.                               */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  Function for multiplying two polynomials with the Toom-3 method.          */
+void
+tmpl_IntPolynomial_Multiply_Toom3(const tmpl_IntPolynomial *P,
+                                  const tmpl_IntPolynomial *Q,
+                                  tmpl_IntPolynomial *prod)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    void *scratch;
+
+    /*  If the output pointer is NULL there's nothing to be done.             */
+    if (!prod)
+        return;
+
+    /*  If an error occurred before this function was called, abort.          */
+    if (prod->error_occurred)
+        return;
+
+    /*  Treat NULL polynomials as zero. Product with a zero polyomial is zero.*/
+    if (!P || !Q)
+    {
+        tmpl_IntPolynomial_Make_Zero(prod);
+        return;
+    }
+
+    /*  Similarly if either P or Q have an error.                             */
+    if (P->error_occurred || Q->error_occurred)
+    {
+        prod->error_occurred = tmpl_True;
+        prod->error_message = tmpl_strdup(
+            "\nError Encountered:\n"
+            "    tmpl_IntPolynomial_Multiply_Toom3\n\n"
+            "Input polynomial has error_occurred set to true. Aborting.\n\n"
+        );
+
+        return;
+    }
+
+    /*  If either polynomial is empty return zero.                            */
+    if (!P->coeffs || !Q->coeffs)
+    {
+        tmpl_IntPolynomial_Make_Zero(prod);
+        return;
+    }
+
+    /*  Allocate the workspace for the whole recursion in one go.             */
+    scratch = TMPL_MALLOC(char,
+        tmpl_IntPolynomial_Multiply_Toom3_Scratch_Size(P, Q)
+    );
+
+    /*  Check if malloc failed. Abort the computation if it did.              */
+    if (!scratch)
+    {
+        prod->error_occurred = tmpl_True;
+        prod->error_message = tmpl_strdup(
+            "\nError Encountered:\n"
+            "    tmpl_IntPolynomial_Multiply_Toom3\n\n"
+            "malloc failed. Aborting.\n\n"
+        );
+
+        return;
+    }
+
+    /*  Multiply the polynomials and release the workspace.                   */
+    tmpl_IntPolynomial_Multiply_Toom3_Kernel(P, Q, prod, scratch);
+    TMPL_FREE(scratch);
+
+    /*  If the kernel failed to resize the output there is nothing to shrink. */
+    if (prod->error_occurred)
+        return;
+
+    /*  Shrink the result by removing redundant terms.                        */
+    tmpl_IntPolynomial_Shrink(prod);
+}
+/*  End of tmpl_IntPolynomial_Multiply_Toom3.                                 */
@@ -0,0 +1,351 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                  tmpl_multiply_toom3_kernel_intpolynomial                  *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiply two polynomials with integer coefficients using the Toom-3   *
+ *      method, with a caller-provided workspace.                             *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomial_Multiply_Toom3_Scratch_Size                        *
+ *  Purpose:                                                                  *
+ *      Computes the number of bytes of workspace needed to multiply two      *
+ *      polynomials with tmpl_IntPolynomial_Multiply_Toom3_Kernel.            *
+ *  Arguments:                                                                *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          A pointer to a polynomial.                                        *
+ *      Q (const tmpl_IntPolynomial *):                                       *
+ *          Another pointer to a polynomial.                                  *
+ *  Output:                                                                   *
+ *      size (size_t):                                                        *
+ *          The size of the workspace, in bytes.                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomial_Multiply_Toom3_Kernel                              *
+ *  Purpose:                                                                  *
+ *      Computes the product of two polynomials over Z[x] with 'int'          *
+ *      coefficients in O(n^log3(5)) time, where n is the smaller length.     *
+ *  Arguments:                                                                *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          A pointer to a polynomial.                                        *
+ *      Q (const tmpl_IntPolynomial *):                                       *
+ *          Another pointer to a polynomial.                                  *
+ *      prod (tmpl_IntPolynomial *):                                          *
+ *          A pointer to a polynomial. The product is stored here.            *
+ *      scratch (void *):                                                     *
+ *          Workspace of at least                                             *
+ *          tmpl_IntPolynomial_Multiply_Toom3_Scratch_Size(P, Q) bytes,       *
+ *          obtained from malloc or suitably aligned.                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          realloc:                                                          *
+ *              Resizes the product if needed.                                *
+ *      tmpl_string.h:                                                        *
+ *          tmpl_String_Duplicate:                                            *
+ *              Duplicates a string. Equivalent to the POSIX function strdup. *
+ *  Method:                                                                   *
+ *      Split each operand into three parts of k = ceil(n / 3) coefficients:  *
+ *                                                                            *
+ *                                 k         2k                               *
+ *          a(x) = a0(x) + a1(x) y + a2(x) y ,    y = x                       *
+ *                                                                            *
+ *      and similarly for b. The product r(y) = a(y) b(y) has degree 4 in y,  *
+ *      and is recovered from its values at y = 0, 1, -1, -2, and infinity.   *
+ *      These five products of size k replace nine, which gives               *
+ *      O(n^log3(5)), roughly O(n^1.465). The interpolation follows Bodrato:  *
+ *                                                                            *
+ *          r3 = (r(-2) - r(1)) / 3                                           *
+ *          r1 = (r(1) - r(-1)) / 2                                           *
+ *          r2 = r(-1) - r(0)                                                 *
+ *          r3 = (r2 - r3) / 2 + 2 r(inf)                                     *
+ *          r2 = r2 + r1 - r(inf)                                             *
+ *          r1 = r1 - r3                                                      *
+ *                                                                            *
+ *      The divisions are exact. Division by 3 is multiplication by the       *
+ *      inverse of 3 modulo 2^N. Division by 2 is a shift, which loses the    *
+ *      top bit of each word. The words are at least twice as wide as an int  *
+ *      so the low bits, which are all that is kept, stay exact. Below        *
+ *      TMPL_INTPOLY_TOOM3_THRESHOLD the Karatsuba recursion is used.         *
+ *  Notes:                                                                    *
+ *      1.) No error checks are performed on P and Q. This function assumes   *
+ *          both have coefficient arrays and no errors. Use                   *
+ *          tmpl_IntPolynomial_Multiply_Toom3 for a checked version.          *
+ *                                                                            *
+ *      2.) prod may not be P or Q.                                           *
+ *                                                                            *
+ *      3.) If the platform has no unsigned type twice as wide as an int,     *
+ *          this function uses Karatsuba's method throughout.                 *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_realloc.h:                                                       *
+ *          Header file providing the TMPL_REALLOC macro.                     *
+ *  2.) tmpl_cast.h:                                                          *
+ *          Header file providing the TMPL_CAST macro.                        *
+ *  3.) tmpl_bool.h:                                                          *
+ *          Header file containing Booleans.                                  *
+ *  4.) tmpl_string.h:                                                        *
+ *          Header file where tmpl_String_Duplicate is declared.              *
+ *  5.) tmpl_polynomial_integer.h:                                            *
+ *          Header file where the function prototypes are given.              *
+ *  6.) tmpl_intpolynomial_fast_multiply.h:                                   *
+ *          Private header with the Karatsuba recursion.                      *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_REALLOC and TMPL_CAST macros provided here.                          */
+#include <libtmpl/include/compat/tmpl_realloc.h>
+#include <libtmpl/include/compat/tmpl_cast.h>
+
+/*  Boolean given here.                                                       */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  tmpl_String_Duplicate function provided here.                             */
+#include <libtmpl/include/tmpl_string.h>
+
+/*  Polynomial typedefs and function prototype.                               */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  Karatsuba recursion and the unbalanced driver found here.                 */
+#include "auxiliary/tmpl_intpolynomial_fast_multiply.h"
+
+#if TMPL_INTPOLY_HAS_TOOM3 == 1
+
+/*  Number of words of scratch space needed by tmpl_intpoly_toom3.            */
+static size_t tmpl_intpoly_toom3_scratch(size_t n)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t k, r, sub_k, sub_r;
+
+    /*  Below the threshold the Karatsuba recursion is used.                  */
+    if (n < TMPL_INTPOLY_TOOM3_THRESHOLD)
+        return tmpl_intpoly_karatsuba_scratch(n);
+
+    k = (n + 2) / 3;
+    r = n - 2 * k;
+    sub_k = tmpl_intpoly_toom3_scratch(k);
+    sub_r = tmpl_intpoly_toom3_scratch(r);
+
+    /*  Six evaluations of k words, three products of 2k - 1 words, and the  *
+     *  space needed by the larger of the recursive calls.                    */
+    return 12 * k - 3 + (sub_k < sub_r ? sub_r : sub_k);
+}
+/*  End of tmpl_intpoly_toom3_scratch.                                        */
+
+/*  Computes the inverse of 3 modulo 2^N using Newton's method.               */
+static tmpl_intpoly_word tmpl_intpoly_inverse_of_three(void)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned int n;
+
+    /*  3 * 3 = 9 = 1 mod 8, so 3 is its own inverse to 3 bits. Each Newton   *
+     *  step doubles the number of correct bits.                              */
+    tmpl_intpoly_word inv = 3U;
+
+    for (n = 3U; n < TMPL_INTPOLY_WORD_BIT; n <<= 1)
+        inv *= (tmpl_intpoly_word)2U - (tmpl_intpoly_word)3U * inv;
+
+    return inv;
+}
+/*  End of tmpl_intpoly_inverse_of_three.                                     */
+
+/*  Balanced Toom-3 product of two arrays of length n.                        */
+static void
+tmpl_intpoly_toom3(const tmpl_intpoly_word *a,
+                   const tmpl_intpoly_word *b,
+                   size_t n,
+                   tmpl_intpoly_word *out,
+                   tmpl_intpoly_word *scratch)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t i, k, r;
+    tmpl_intpoly_word inv3;
+    tmpl_intpoly_word *a1, *am1, *am2, *b1, *bm1, *bm2;
+    tmpl_intpoly_word *r1, *rm1, *rm2, *rest;
+
+    /*  Smaller products are faster with Karatsuba's method.                  */
+    if (n < TMPL_INTPOLY_TOOM3_THRESHOLD)
+    {
+        tmpl_intpoly_karatsuba(a, b, n, out, scratch);
+        return;
+    }
+
+    /*  Split into parts of k, k, and r coefficients, 0 < r <= k.             */
+    k = (n + 2) / 3;
+    r = n - 2 * k;
+    inv3 = tmpl_intpoly_inverse_of_three();
+
+    /*  Carve the scratch space. The remainder is for the recursive calls.    */
+    a1 = scratch;
+    am1 = a1 + k;
+    am2 = am1 + k;
+    b1 = am2 + k;
+    bm1 = b1 + k;
+    bm2 = bm1 + k;
+    r1 = bm2 + k;
+    rm1 = r1 + (2 * k - 1);
+    rm2 = rm1 + (2 * k - 1);
+    rest = rm2 + (2 * k - 1);
+
+    /*  Evaluate at y = 1, -1, and -2. The top part has only r coefficients.  */
+    for (i = 0; i < k; ++i)
+    {
+        const tmpl_intpoly_word x0 = a[i], x1 = a[k + i];
+        const tmpl_intpoly_word x2 = (i < r ? a[2 * k + i] : 0);
+        const tmpl_intpoly_word y0 = b[i], y1 = b[k + i];
+        const tmpl_intpoly_word y2 = (i < r ? b[2 * k + i] : 0);
+
+        a1[i] = x0 + x1 + x2;
+        am1[i] = x0 - x1 + x2;
+        am2[i] = x0 - 2U * x1 + 4U * x2;
+        b1[i] = y0 + y1 + y2;
+        bm1[i] = y0 - y1 + y2;
+        bm2[i] = y0 - 2U * y1 + 4U * y2;
+    }
+
+    /*  r(0) goes in out[0, 2k - 1) and r(inf) in out[4k, 2n - 1).            */
+    tmpl_intpoly_toom3(a, b, k, out, rest);
+    tmpl_intpoly_toom3(a + 2 * k, b + 2 * k, r, out + 4 * k, rest);
+
+    /*  The remaining three pointwise products.                               */
+    tmpl_intpoly_toom3(a1, b1, k, r1, rest);
+    tmpl_intpoly_toom3(am1, bm1, k, rm1, rest);
+    tmpl_intpoly_toom3(am2, bm2, k, rm2, rest);
+
+    /*  Interpolate, overwriting r(1), r(-1), r(-2) with r1, r2, r3.          */
+    for (i = 0; i < 2 * k - 1; ++i)
+    {
+        const tmpl_intpoly_word v0 = out[i];
+        const tmpl_intpoly_word vinf = (i < 2 * r - 1 ? out[4 * k + i] : 0);
+        tmpl_intpoly_word t1, t2, t3;
+
+        t3 = (rm2[i] - r1[i]) * inv3;
+        t1 = (r1[i] - rm1[i]) >> 1;
+        t2 = rm1[i] - v0;
+        t3 = ((t2 - t3) >> 1) + 2U * vinf;
+        t2 = t2 + t1 - vinf;
+        t1 = t1 - t3;
+
+        r1[i] = t1;
+        rm1[i] = t2;
+        rm2[i] = t3;
+    }
+
+    /*  The gap between r(0) and r(inf) in the output starts at zero.         */
+    for (i = 2 * k - 1; i < 4 * k; ++i)
+        out[i] = 0;
+
+    /*  Add the middle terms, shifted by k, 2k, and 3k, into the output.      */
+    for (i = 0; i < 2 * k - 1; ++i)
+    {
+        out[k + i] += r1[i];
+        out[2 * k + i] += rm1[i];
+    }
+
+    /*  The last term may run past the end of the output. Those entries are  *
+     *  zero since the product has only 2n - 1 coefficients.                  */
+    for (i = 0; i < 2 * k - 1 && 3 * k + i < 2 * n - 1; ++i)
+        out[3 * k + i] += rm2[i];
+}
+/*  End of tmpl_intpoly_toom3.                                                */
+
+#else
+/*  Else for #if TMPL_INTPOLY_HAS_TOOM3 == 1.                                 */
+
+/*  Without spare bits in the words, fall back to Karatsuba.                  */
+#define tmpl_intpoly_toom3_scratch tmpl_intpoly_karatsuba_scratch
+#define tmpl_intpoly_toom3 tmpl_intpoly_karatsuba
+
+#endif
+/*  End of #if TMPL_INTPOLY_HAS_TOOM3 == 1.                                   */
+
+/*  Function for computing the size of the workspace.                         */
+size_t
+tmpl_IntPolynomial_Multiply_Toom3_Scratch_Size(const tmpl_IntPolynomial *P,
+                                               const tmpl_IntPolynomial *Q)
+{
+    /*  Lengths of the coefficient arrays, sorted.                            */
+    const size_t p_len = P->degree + 1;
+    const size_t q_len = Q->degree + 1;
+    const size_t short_len = (p_len < q_len ? p_len : q_len);
+    const size_t long_len = (p_len < q_len ? q_len : p_len);
+
+    /*  Workspace for the driver plus the recursion, in words.                */
+    const size_t words = tmpl_intpoly_unbalanced_scratch(
+        short_len, long_len, tmpl_intpoly_toom3_scratch(short_len)
+    );
+
+    return words * sizeof(tmpl_intpoly_word);
+}
+/*  End of tmpl_IntPolynomial_Multiply_Toom3_Scratch_Size.                    */
+
+/*  Function for multiplying two polynomials with the Toom-3 method.          */
+void
+tmpl_IntPolynomial_Multiply_Toom3_Kernel(const tmpl_IntPolynomial *P,
+                                         const tmpl_IntPolynomial *Q,
+                                         tmpl_IntPolynomial *prod,
+                                         void *scratch)
+{
+    /*  The degree of the product is the sum of the two degrees.              */
+    const size_t deg = P->degree + Q->degree;
+
+    /*  Check if prod needs to be resized.                                    */
+    if (prod->degree != deg || !prod->coeffs)
+    {
+        /*  Try to allocate memory for the product.                           */
+        void * const tmp = TMPL_REALLOC(prod->coeffs, deg + 1);
+
+        /*  Check if realloc failed. Abort the computation if it did.         */
+        if (!tmp)
+        {
+            prod->error_occurred = tmpl_True;
+            prod->error_message = tmpl_String_Duplicate(
+                "\nError Encountered:\n"
+                "    tmpl_IntPolynomial_Multiply_Toom3_Kernel\n\n"
+                "realloc failed. Aborting.\n\n"
+            );
+
+            return;
+        }
+
+        /*  Otherwise reset the coefficient pointer.                          */
+        prod->coeffs = TMPL_CAST(tmp, int *);
+        prod->degree = deg;
+    }
+
+    /*  The driver wants the shorter polynomial first.                        */
+    if (P->degree <= Q->degree)
+        tmpl_intpoly_unbalanced_product(
+            P->coeffs, P->degree + 1, Q->coeffs, Q->degree + 1, prod->coeffs,
+            tmpl_intpoly_toom3, TMPL_CAST(scratch, tmpl_intpoly_word *)
+        );
+
+    else
+        tmpl_intpoly_unbalanced_product(
+            Q->coeffs, Q->degree + 1, P->coeffs, P->degree + 1, prod->coeffs,
+            tmpl_intpoly_toom3, TMPL_CAST(scratch, tmpl_intpoly_word *)
+        );
+}
+/*  End of tmpl_IntPolynomial_Multiply_Toom3_Kernel.                          */
@@ -0,0 +1,155 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                     tmpl_reserve_intpolynomial_buffer                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Ensures a capacity-aware polynomial has room for a number of terms.   *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomialBuffer_Reserve                                      *
+ *  Purpose:                                                                  *
+ *      Grows the coefficient array so that it can hold at least capacity     *
+ *      elements. Nothing is done if it is already large enough.              *
+ *  Arguments:                                                                *
+ *      buffer (tmpl_IntPolynomialBuffer *):                                  *
+ *          The polynomial whose capacity is to be increased.                 *
+ *      capacity (size_t):                                                    *
+ *          The required number of coefficients.                              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          realloc:                                                          *
+ *              Resizes the coefficient array.                                *
+ *  Method:                                                                   *
+ *      If the capacity is already sufficient, return. Otherwise realloc the  *
+ *      array to the larger of the request and twice the old capacity.        *
+ *      Doubling means a buffer that is grown a term at a time reallocates    *
+ *      only O(log(n)) times. The degree and coefficients are unchanged.      *
+ *  Notes:                                                                    *
+ *      1.) Buffers taken from a tmpl_IntPolynomialArena can not grow. If     *
+ *          more room is requested the error_occurred Boolean is set.         *
+ *                                                                            *
+ *      2.) A buffer with NULL coeffs, such as one that was destroyed or      *
+ *          zero initialized, is allocated fresh memory and owns it.          *
+ *                                                                            *
+ *      3.) If realloc fails the error_occurred Boolean is set and the old    *
+ *          coefficients are kept.                                            *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_realloc.h:                                                       *
+ *          Header providing TMPL_REALLOC.                                    *
+ *  3.) tmpl_polynomial_buffer_int.h:                                         *
+ *          Header where the tmpl_IntPolynomialBuffer typedef is given.       *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_REALLOC macro found here.                                            */
+#include <libtmpl/include/compat/tmpl_realloc.h>
+
+/*  tmpl_Bool, tmpl_False, and tmpl_True are given here.                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Capacity-aware integer polynomial typedef provided here.                  */
+#include <libtmpl/include/types/tmpl_polynomial_buffer_int.h>
+
+/*  Forward declaration / function prototype.                                 */
+extern void
+tmpl_IntPolynomialBuffer_Reserve(tmpl_IntPolynomialBuffer *buffer,
+                                 const size_t capacity);
+
+/*  Function for growing the capacity of a polynomial.                        */
+void
+tmpl_IntPolynomialBuffer_Reserve(tmpl_IntPolynomialBuffer *buffer,
+                                 const size_t capacity)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    size_t length;
+    signed int *coeffs;
+
+    /*  If the input is NULL there is nothing to be done.                     */
+    if (!buffer)
+        return;
+
+    /*  Similarly if an error occurred previously.                            */
+    if (buffer->error_occurred)
+        return;
+
+    /*  The common case, nothing needs to be done. This is the warm path.     */
+    if (buffer->coeffs && capacity <= buffer->capacity)
+        return;
+
+    /*  An empty buffer has no arena behind it. It gets its own memory.       */
+    if (!buffer->coeffs)
+    {
+        buffer->capacity = 0;
+        buffer->degree = 0;
+        buffer->owns_memory = tmpl_True;
+    }
+
+    /*  Memory borrowed from an arena can not be resized.                     */
+    else if (!buffer->owns_memory)
+    {
+        buffer->error_occurred = tmpl_True;
+        buffer->error_message =
+            "\nError Encountered: libtmpl\n"
+            "    tmpl_IntPolynomialBuffer_Reserve\n\n"
+            "Arena backed buffer is full and can not grow. Aborting.\n\n";
+
+        return;
+    }
+
+    /*  Grow geometrically, unless the request is larger still.               */
+    length = buffer->capacity << 1;
+
+    if (length < capacity)
+        length = capacity;
+
+    /*  The zero polynomial still needs one coefficient.                      */
+    if (length == 0)
+        length = 1;
+
+    coeffs = TMPL_REALLOC(buffer->coeffs, length);
+
+    /*  realloc returns NULL on failure. The old memory is still valid.       */
+    if (!coeffs)
+    {
+        buffer->error_occurred = tmpl_True;
+        buffer->error_message =
+            "\nError Encountered: libtmpl\n"
+            "    tmpl_IntPolynomialBuffer_Reserve\n\n"
+            "realloc failed and returned NULL. Aborting.\n\n";
+
+        return;
+    }
+
+    /*  A fresh allocation starts as the zero polynomial.                     */
+    if (buffer->capacity == 0)
+        coeffs[0] = 0;
+
+    buffer->coeffs = coeffs;
+    buffer->capacity = length;
+}
+/*  End of tmpl_IntPolynomialBuffer_Reserve.                                  */
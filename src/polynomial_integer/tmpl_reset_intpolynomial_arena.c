@@ -0,0 +1,69 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                       tmpl_reset_intpolynomial_arena                       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Returns all of the memory in an arena so that it may be reused.       *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomialArena_Reset                                         *
+ *  Purpose:                                                                  *
+ *      Marks every coefficient in the arena as available again.              *
+ *  Arguments:                                                                *
+ *      arena (tmpl_IntPolynomialArena *):                                    *
+ *          A pointer to the arena that is to be reset.                       *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      Set the used counter to zero. The memory is kept, so an arena that    *
+ *      is reset once per iteration of a loop is only ever allocated once.    *
+ *  Notes:                                                                    *
+ *      1.) Buffers taken from the arena before the reset must not be used    *
+ *          afterwards, their memory will be handed out again.                *
+ *                                                                            *
+ *      2.) The error_occurred Boolean is not cleared. An arena whose malloc  *
+ *          failed stays empty.                                               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_polynomial_arena_int.h:                                          *
+ *          Header where the tmpl_IntPolynomialArena typedef is given.        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Integer polynomial arena typedef provided here.                           */
+#include <libtmpl/include/types/tmpl_polynomial_arena_int.h>
+
+/*  Forward declaration / function prototype.                                 */
+extern void tmpl_IntPolynomialArena_Reset(tmpl_IntPolynomialArena *arena);
+
+/*  Function for releasing every buffer drawn from an arena at once.          */
+void tmpl_IntPolynomialArena_Reset(tmpl_IntPolynomialArena *arena)
+{
+    /*  If the input is NULL there is nothing to be done.                     */
+    if (!arena)
+        return;
+
+    /*  Only the counter is reset, the memory is kept for reuse.              */
+    arena->used = 0;
+}
+/*  End of tmpl_IntPolynomialArena_Reset.                                     */
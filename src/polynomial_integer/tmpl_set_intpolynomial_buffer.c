@@ -0,0 +1,124 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                       tmpl_set_intpolynomial_buffer                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Copies a polynomial into a capacity-aware polynomial.                 *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomialBuffer_Set                                          *
+ *  Purpose:                                                                  *
+ *      Sets buffer = P, reusing the memory of the buffer.                    *
+ *  Arguments:                                                                *
+ *      buffer (tmpl_IntPolynomialBuffer *):                                  *
+ *          The polynomial the data is copied into.                           *
+ *      P (const tmpl_IntPolynomial *):                                       *
+ *          The polynomial that is copied.                                    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_polynomial_integer.h:                                            *
+ *          tmpl_IntPolynomialBuffer_Reserve:                                 *
+ *              Grows the buffer if it is too small.                          *
+ *          tmpl_IntPolynomialBuffer_Make_Zero:                               *
+ *              Sets the buffer to zero.                                      *
+ *  Method:                                                                   *
+ *      Reserve degree + 1 terms and copy the coefficients. Trailing zeros    *
+ *      of P are dropped by lowering the degree, the memory is not shrunk.    *
+ *  Notes:                                                                    *
+ *      1.) NULL and empty polynomials are treated as zero.                   *
+ *                                                                            *
+ *      2.) If P has its error_occurred Boolean set, so does the buffer.      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_polynomial_integer.h:                                            *
+ *          Header where the function prototype is given.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  tmpl_Bool, tmpl_False, and tmpl_True are given here.                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  Function for copying a polynomial into a capacity-aware polynomial.       */
+void
+tmpl_IntPolynomialBuffer_Set(tmpl_IntPolynomialBuffer *buffer,
+                             const tmpl_IntPolynomial *P)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    size_t n;
+
+    /*  If the output is NULL there is nothing to be done.                    */
+    if (!buffer)
+        return;
+
+    /*  Similarly if an error occurred previously.                            */
+    if (buffer->error_occurred)
+        return;
+
+    /*  NULL and empty polynomials are treated as zero.                       */
+    if (!P)
+    {
+        tmpl_IntPolynomialBuffer_Make_Zero(buffer);
+        return;
+    }
+
+    /*  If P has an error, abort the computation. Treat this as an error.     */
+    if (P->error_occurred)
+    {
+        buffer->error_occurred = tmpl_True;
+        buffer->error_message =
+            "\nError Encountered:\n"
+            "    tmpl_IntPolynomialBuffer_Set\n\n"
+            "Input polynomial has error_occurred set to true.\n\n";
+
+        return;
+    }
+
+    if (!P->coeffs)
+    {
+        tmpl_IntPolynomialBuffer_Make_Zero(buffer);
+        return;
+    }
+
+    /*  Make room for the coefficients. This does nothing once warm.          */
+    tmpl_IntPolynomialBuffer_Reserve(buffer, P->degree + 1);
+
+    if (buffer->error_occurred)
+        return;
+
+    /*  Copy the data. A buffer viewed as P copies onto itself, which is OK.  */
+    for (n = 0; n <= P->degree; ++n)
+        buffer->coeffs[n] = P->coeffs[n];
+
+    /*  Remove trailing zeros by lowering the degree.                         */
+    buffer->degree = P->degree;
+
+    while (buffer->degree > 0 && buffer->coeffs[buffer->degree] == 0)
+        buffer->degree--;
+}
+/*  End of tmpl_IntPolynomialBuffer_Set.                                      */
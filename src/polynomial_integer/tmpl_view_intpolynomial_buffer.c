@@ -0,0 +1,97 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                       tmpl_view_intpolynomial_buffer                       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Views a capacity-aware polynomial as an ordinary polynomial.          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomialBuffer_View                                         *
+ *  Purpose:                                                                  *
+ *      Returns a tmpl_IntPolynomial that shares the coefficients of the      *
+ *      buffer, so that it can be passed to the tmpl_IntPolynomial functions  *
+ *      that only read their inputs (Eval, Print, Multiply, and so on).       *
+ *  Arguments:                                                                *
+ *      buffer (const tmpl_IntPolynomialBuffer *):                            *
+ *          The polynomial that is to be viewed.                              *
+ *  Output:                                                                   *
+ *      view (tmpl_IntPolynomial):                                            *
+ *          A polynomial pointing to the same coefficients as the buffer.     *
+ *  Method:                                                                   *
+ *      Copy the pointer, the degree, and the error variables. No memory is   *
+ *      allocated or copied.                                                  *
+ *  Notes:                                                                    *
+ *      1.) The view does not own its coefficients. It must not be passed to  *
+ *          tmpl_IntPolynomial_Destroy, or to any function that may realloc   *
+ *          its coefficients.                                                 *
+ *                                                                            *
+ *      2.) A NULL buffer gives the empty polynomial.                         *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_polynomial_int.h:                                                *
+ *          Header where the tmpl_IntPolynomial typedef is given.             *
+ *  3.) tmpl_polynomial_buffer_int.h:                                         *
+ *          Header where the tmpl_IntPolynomialBuffer typedef is given.       *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  tmpl_Bool, tmpl_False, and tmpl_True are given here.                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Integer polynomial typedef provided here.                                 */
+#include <libtmpl/include/types/tmpl_polynomial_int.h>
+
+/*  Capacity-aware integer polynomial typedef provided here.                  */
+#include <libtmpl/include/types/tmpl_polynomial_buffer_int.h>
+
+/*  Forward declaration / function prototype.                                 */
+extern tmpl_IntPolynomial
+tmpl_IntPolynomialBuffer_View(const tmpl_IntPolynomialBuffer *buffer);
+
+/*  Function for viewing a capacity-aware polynomial as a polynomial.         */
+tmpl_IntPolynomial
+tmpl_IntPolynomialBuffer_View(const tmpl_IntPolynomialBuffer *buffer)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_IntPolynomial view;
+
+    /*  A NULL buffer is viewed as the empty polynomial.                      */
+    if (!buffer)
+    {
+        view.coeffs = NULL;
+        view.degree = 0;
+        view.error_occurred = tmpl_False;
+        view.error_message = NULL;
+        return view;
+    }
+
+    /*  Share the data, nothing is copied.                                    */
+    view.coeffs = buffer->coeffs;
+    view.degree = buffer->degree;
+    view.error_occurred = buffer->error_occurred;
+    view.error_message = buffer->error_message;
+    return view;
+}
+/*  End of tmpl_IntPolynomialBuffer_View.                                     */
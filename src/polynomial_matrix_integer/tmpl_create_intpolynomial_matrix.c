@@ -0,0 +1,157 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                      tmpl_create_intpolynomial_matrix                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Creates a matrix of integer polynomials.                              *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomialMatrix_Create                                       *
+ *  Purpose:                                                                  *
+ *      Creates a matrix of the given shape with every entry set to zero.     *
+ *  Arguments:                                                                *
+ *      rows (size_t):                                                        *
+ *          The number of rows.                                               *
+ *      columns (size_t):                                                     *
+ *          The number of columns.                                            *
+ *  Output:                                                                   *
+ *      matrix (tmpl_IntPolynomialMatrix):                                    *
+ *          The zero matrix.                                                  *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates memory for the entries.                             *
+ *      tmpl_polynomial_integer.h:                                            *
+ *          tmpl_IntPolynomial_Init:                                          *
+ *              Initializes an entry.                                         *
+ *          tmpl_IntPolynomial_Make_Zero:                                     *
+ *              Sets an entry to the zero polynomial.                         *
+ *      tmpl_string.h:                                                        *
+ *          tmpl_strdup:                                                      *
+ *              Duplicates a string. Equivalent to the POSIX function strdup. *
+ *  Method:                                                                   *
+ *      Allocate rows * columns polynomials and make each of them zero.       *
+ *  Notes:                                                                    *
+ *      1.) If either dimension is zero, data is NULL. This is not an error.  *
+ *                                                                            *
+ *      2.) If malloc fails, or rows * columns overflows, the error_occurred  *
+ *          Boolean is set.                                                   *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_malloc.h:                                                        *
+ *          Header file providing TMPL_MALLOC.                                *
+ *  3.) tmpl_string.h:                                                        *
+ *          Header file where tmpl_strdup is declared.                        *
+ *  4.) tmpl_polynomial_integer.h:                                            *
+ *          Header file with functions for polynomials.                       *
+ *  5.) tmpl_polynomial_matrix_integer.h:                                     *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_MALLOC macro found here.                                             */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  tmpl_strdup function declared here.                                       */
+#include <libtmpl/include/tmpl_string.h>
+
+/*  tmpl_IntPolynomial_Init and tmpl_IntPolynomial_Make_Zero given here.      */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_polynomial_matrix_integer.h>
+
+/*  Function for creating a zero matrix of polynomials.                       */
+tmpl_IntPolynomialMatrix
+tmpl_IntPolynomialMatrix_Create(size_t rows, size_t columns)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_IntPolynomialMatrix matrix;
+    size_t n, length;
+
+    /*  Start with an empty matrix of the requested shape.                    */
+    matrix.data = NULL;
+    matrix.number_of_rows = rows;
+    matrix.number_of_columns = columns;
+    matrix.error_occurred = tmpl_False;
+    matrix.error_message = NULL;
+
+    /*  Matrices with no entries need no memory.                              */
+    if (rows == (size_t)0 || columns == (size_t)0)
+        return matrix;
+
+    /*  Check that the number of entries does not overflow.                   */
+    if (rows > ((size_t)-1) / columns)
+    {
+        matrix.error_occurred = tmpl_True;
+        matrix.error_message = tmpl_strdup(
+            "\nError Encountered:\n"
+            "    tmpl_IntPolynomialMatrix_Create\n\n"
+            "Number of entries overflows size_t. Aborting.\n\n"
+        );
+
+        return matrix;
+    }
+
+    length = rows * columns;
+    matrix.data = TMPL_MALLOC(tmpl_IntPolynomial, length);
+
+    /*  Check if malloc failed. Abort the computation if it did.              */
+    if (!matrix.data)
+    {
+        matrix.error_occurred = tmpl_True;
+        matrix.error_message = tmpl_strdup(
+            "\nError Encountered:\n"
+            "    tmpl_IntPolynomialMatrix_Create\n\n"
+            "malloc failed and returned NULL. Aborting.\n\n"
+        );
+
+        return matrix;
+    }
+
+    /*  Every entry is the zero polynomial. If an allocation fails the entry  *
+     *  has its error Boolean set, pass this along to the matrix.             */
+    for (n = 0; n < length; ++n)
+    {
+        tmpl_IntPolynomial_Init(&matrix.data[n]);
+        tmpl_IntPolynomial_Make_Zero(&matrix.data[n]);
+
+        if (matrix.data[n].error_occurred && !matrix.error_occurred)
+        {
+            matrix.error_occurred = tmpl_True;
+            matrix.error_message = tmpl_strdup(
+                "\nError Encountered:\n"
+                "    tmpl_IntPolynomialMatrix_Create\n\n"
+                "Failed to allocate an entry. Aborting.\n\n"
+            );
+        }
+    }
+
+    return matrix;
+}
+/*  End of tmpl_IntPolynomialMatrix_Create.                                   */
@@ -0,0 +1,101 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                     tmpl_destroy_intpolynomial_matrix                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Frees all of the memory in a matrix of integer polynomials.           *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomialMatrix_Destroy                                      *
+ *  Purpose:                                                                  *
+ *      Destroys every entry, frees the array of entries and the error        *
+ *      message, and resets the shape to 0x0.                                 *
+ *  Arguments:                                                                *
+ *      matrix (tmpl_IntPolynomialMatrix *):                                  *
+ *          The matrix that is to be destroyed.                               *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          free:                                                             *
+ *              Frees memory allocated by malloc.                             *
+ *      tmpl_polynomial_integer.h:                                            *
+ *          tmpl_IntPolynomial_Destroy:                                       *
+ *              Frees the memory in an entry.                                 *
+ *  Method:                                                                   *
+ *      Destroy each entry, then free the pointers.                           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_free.h:                                                          *
+ *          Header file providing TMPL_FREE.                                  *
+ *  3.) tmpl_polynomial_integer.h:                                            *
+ *          Header file with functions for polynomials.                       *
+ *  4.) tmpl_polynomial_matrix_integer.h:                                     *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_FREE macro found here.                                               */
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  tmpl_IntPolynomial_Destroy given here.                                    */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_polynomial_matrix_integer.h>
+
+/*  Function for freeing all memory in a matrix of polynomials.               */
+void tmpl_IntPolynomialMatrix_Destroy(tmpl_IntPolynomialMatrix *matrix)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    size_t n;
+
+    /*  If the input is NULL there is nothing to be done.                     */
+    if (!matrix)
+        return;
+
+    /*  Free each of the entries, then the array itself.                      */
+    if (matrix->data)
+    {
+        const size_t length = matrix->number_of_rows*matrix->number_of_columns;
+
+        for (n = 0; n < length; ++n)
+            tmpl_IntPolynomial_Destroy(&matrix->data[n]);
+
+        TMPL_FREE(matrix->data);
+    }
+
+    /*  Error messages for matrices are allocated with malloc.                */
+    TMPL_FREE(matrix->error_message);
+
+    /*  Set the remaining variables to their default zero values.             */
+    matrix->number_of_rows = (size_t)0;
+    matrix->number_of_columns = (size_t)0;
+    matrix->error_occurred = tmpl_False;
+}
+/*  End of tmpl_IntPolynomialMatrix_Destroy.                                  */
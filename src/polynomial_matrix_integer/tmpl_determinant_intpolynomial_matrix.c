@@ -0,0 +1,686 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                   tmpl_determinant_intpolynomial_matrix                    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the determinant of a square matrix of integer polynomials.   *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomialMatrix_Determinant                                  *
+ *  Purpose:                                                                  *
+ *      Computes det(M), an element of Z[x], for a square matrix M.           *
+ *  Arguments:                                                                *
+ *      det (tmpl_IntPolynomial *):                                           *
+ *          The output polynomial.                                            *
+ *      matrix (const tmpl_IntPolynomialMatrix *):                            *
+ *          A square matrix.                                                  *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates the working copy and the workspaces.                *
+ *      tmpl_polynomial_integer.h:                                            *
+ *          tmpl_IntPolynomial_Make_Zero:                                     *
+ *              Sets the output to zero for singular matrices.                *
+ *      tmpl_string.h:                                                        *
+ *          tmpl_strdup:                                                      *
+ *              Duplicates a string. Equivalent to the POSIX function strdup. *
+ *  Method:                                                                   *
+ *      Use the fraction-free Bareiss algorithm. Gaussian elimination over    *
+ *      Z[x] would need division, and clearing denominators instead makes the *
+ *      entries grow exponentially. Bareiss' update at step k is:             *
+ *                                                                            *
+ *                    M(i, j) M(k, k) - M(i, k) M(k, j)                       *
+ *          M(i, j) = ---------------------------------,   i, j > k           *
+ *                                   p                                        *
+ *                                                                            *
+ *      where p is the pivot M(k-1, k-1) of the previous step, and p = 1 for  *
+ *      the first step. Sylvester's identity shows that the division is exact *
+ *      and that the new M(i, j) is a minor of the original matrix, so the    *
+ *      entries only grow as much as the determinant itself. After the final  *
+ *      step, M(n-1, n-1) is the determinant.                                 *
+ *                                                                            *
+ *      If M(k, k) is zero, a later row with M(i, k) non-zero is swapped in,  *
+ *      which flips the sign of the determinant. If no such row exists the    *
+ *      matrix is singular and the determinant is zero.                       *
+ *                                                                            *
+ *      The numerators are computed in a word at least twice as wide as an    *
+ *      int, and the exact division is polynomial long division. All sums in  *
+ *      the word are checked for overflow, and every new entry is checked to  *
+ *      fit in an int.                                                        *
+ *                                                                            *
+ *      The rows of a step are independent of each other. With OpenMP they    *
+ *      are split among the threads. Each thread allocates one workspace for  *
+ *      the numerators per step and reuses it for every entry of its rows.    *
+ *  Notes:                                                                    *
+ *      1.) If matrix is NULL, has an error, or is not square, the            *
+ *          error_occurred Boolean of det is set.                             *
+ *                                                                            *
+ *      2.) Every intermediate entry is a minor of the matrix. If one of them *
+ *          does not fit in an int, the error_occurred Boolean of det is set. *
+ *          The result is never silently wrapped.                             *
+ *                                                                            *
+ *      3.) The determinant of a 0x0 matrix is one.                           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) limits.h:                                                             *
+ *          Standard library header file with INT_MIN, INT_MAX, LONG_MAX.     *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_inttype.h:                                                       *
+ *          Header file providing TMPL_HAS_LONGLONG.                          *
+ *  4.) tmpl_limits.h:                                                        *
+ *          Header file with the widths of the integer types.                 *
+ *  5.) tmpl_malloc.h:                                                        *
+ *          Header file providing TMPL_MALLOC.                                *
+ *  6.) tmpl_free.h:                                                          *
+ *          Header file providing TMPL_FREE.                                  *
+ *  7.) tmpl_string.h:                                                        *
+ *          Header file where tmpl_strdup is declared.                        *
+ *  8.) tmpl_polynomial_integer.h:                                            *
+ *          Header file with functions for polynomials.                       *
+ *  9.) tmpl_polynomial_matrix_integer.h:                                     *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  INT_MIN, INT_MAX, and LONG_MAX found here.                                */
+#include <limits.h>
+
+/*  TMPL_MALLOC and TMPL_FREE macros found here.                              */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  TMPL_HAS_LONGLONG macro provided here.                                    */
+#include <libtmpl/include/tmpl_inttype.h>
+
+/*  Bit widths of the integer types.                                          */
+#include <libtmpl/include/tmpl_limits.h>
+
+/*  tmpl_strdup function declared here.                                       */
+#include <libtmpl/include/tmpl_string.h>
+
+/*  tmpl_IntPolynomial_Make_Zero given here.                                  */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_polynomial_matrix_integer.h>
+
+/*  Pick a signed word that is at least twice as wide as an int, if possible. *
+ *  The product of two ints then always fits and only sums need checking.     */
+#if TMPL_ULONG_BIT >= 2 * TMPL_UINT_BIT
+typedef signed long int tmpl_polymat_word;
+#define TMPL_POLYMAT_WORD_MAX LONG_MAX
+#define TMPL_POLYMAT_WORD_IS_WIDE 1
+#elif TMPL_HAS_LONGLONG == 1
+typedef signed long long int tmpl_polymat_word;
+#define TMPL_POLYMAT_WORD_MAX \
+    ((tmpl_polymat_word)((unsigned long long int)-1 >> 1))
+#define TMPL_POLYMAT_WORD_IS_WIDE (TMPL_ULLONG_BIT >= 2 * TMPL_UINT_BIT)
+#else
+typedef signed long int tmpl_polymat_word;
+#define TMPL_POLYMAT_WORD_MAX LONG_MAX
+#define TMPL_POLYMAT_WORD_IS_WIDE 0
+#endif
+
+/*  The most negative word, assuming two's complement.                        */
+#define TMPL_POLYMAT_WORD_MIN (-TMPL_POLYMAT_WORD_MAX - 1)
+
+/*  Reasons a step of the elimination can fail.                               */
+#define TMPL_POLYMAT_MALLOC_FAILED (1)
+#define TMPL_POLYMAT_OVERFLOW (2)
+
+/*  An entry of the working copy of the matrix. A zero length is the zero     *
+ *  polynomial, otherwise coeffs[length - 1] is non-zero.                     */
+typedef struct tmpl_PolyMatEntry_Def {
+    signed int *coeffs;
+    size_t length;
+} tmpl_PolyMatEntry;
+
+/*  Computes sum += x * y, returning false if this overflows the word.        */
+static tmpl_Bool
+tmpl_polymat_add_product(tmpl_polymat_word *sum, signed int x, signed int y)
+{
+    tmpl_polymat_word prod;
+
+#if TMPL_POLYMAT_WORD_IS_WIDE
+    prod = (tmpl_polymat_word)x * (tmpl_polymat_word)y;
+#else
+    const tmpl_polymat_word a = (tmpl_polymat_word)x;
+    const tmpl_polymat_word b = (tmpl_polymat_word)y;
+
+    /*  The word may be too narrow for the product, check before computing.   */
+    if (a > 0)
+    {
+        if (b > 0 ? a > TMPL_POLYMAT_WORD_MAX / b
+                  : b < TMPL_POLYMAT_WORD_MIN / a)
+            return tmpl_False;
+    }
+    else if (a < 0)
+    {
+        if (b > 0 ? a < TMPL_POLYMAT_WORD_MIN / b
+                  : b != 0 && a < TMPL_POLYMAT_WORD_MAX / b)
+            return tmpl_False;
+    }
+
+    prod = a * b;
+#endif
+
+    if (prod > 0 ? *sum > TMPL_POLYMAT_WORD_MAX - prod
+                 : *sum < TMPL_POLYMAT_WORD_MIN - prod)
+        return tmpl_False;
+
+    *sum += prod;
+    return tmpl_True;
+}
+/*  End of tmpl_polymat_add_product.                                          */
+
+/*  Computes num = a * b - c * d, where num has room for the result. Returns  *
+ *  the length of num with leading zeros removed, or sets overflow.           */
+static size_t
+tmpl_polymat_numerator(tmpl_polymat_word *num,
+                       const tmpl_PolyMatEntry *a,
+                       const tmpl_PolyMatEntry *b,
+                       const tmpl_PolyMatEntry *c,
+                       const tmpl_PolyMatEntry *d,
+                       tmpl_Bool *overflow)
+{
+    size_t m, n, length = 0;
+
+    if (a->length && b->length)
+        length = a->length + b->length - 1;
+
+    if (c->length && d->length && c->length + d->length - 1 > length)
+        length = c->length + d->length - 1;
+
+    for (n = 0; n < length; ++n)
+        num[n] = 0;
+
+    for (m = 0; m < a->length; ++m)
+        for (n = 0; n < b->length; ++n)
+            if (!tmpl_polymat_add_product(&num[m + n],
+                                          a->coeffs[m], b->coeffs[n]))
+                *overflow = tmpl_True;
+
+    /*  Subtract c * d by adding (-c) * d. -INT_MIN is not an int, so use     *
+     *  c * (-d) instead when needed, and if both are INT_MIN give up.        */
+    for (m = 0; m < c->length; ++m)
+    {
+        for (n = 0; n < d->length; ++n)
+        {
+            tmpl_Bool ok;
+
+            if (c->coeffs[m] != INT_MIN)
+                ok = tmpl_polymat_add_product(&num[m + n],
+                                              -c->coeffs[m], d->coeffs[n]);
+
+            else if (d->coeffs[n] != INT_MIN)
+                ok = tmpl_polymat_add_product(&num[m + n],
+                                              c->coeffs[m], -d->coeffs[n]);
+            else
+                ok = tmpl_False;
+
+            if (!ok)
+                *overflow = tmpl_True;
+        }
+    }
+
+    while (length > 0 && num[length - 1] == 0)
+        --length;
+
+    return length;
+}
+/*  End of tmpl_polymat_numerator.                                            */
+
+/*  Divides num by p exactly, storing the quotient in out. num is destroyed.  *
+ *  Returns a TMPL_POLYMAT error code, or zero on success.                    */
+static int
+tmpl_polymat_exact_divide(tmpl_PolyMatEntry *out,
+                          tmpl_polymat_word *num,
+                          size_t length,
+                          const tmpl_PolyMatEntry *p)
+{
+    size_t n, s;
+    const tmpl_polymat_word lead = (tmpl_polymat_word)p->coeffs[p->length - 1];
+
+    out->coeffs = NULL;
+    out->length = 0;
+
+    /*  A zero numerator gives a zero entry.                                  */
+    if (!length)
+        return 0;
+
+    /*  The division is exact, so num is at least as long as p.               */
+    if (length < p->length)
+        return TMPL_POLYMAT_OVERFLOW;
+
+    out->length = length - p->length + 1;
+    out->coeffs = TMPL_MALLOC(signed int, out->length);
+
+    if (!out->coeffs)
+    {
+        out->length = 0;
+        return TMPL_POLYMAT_MALLOC_FAILED;
+    }
+
+    /*  Long division, from the highest coefficient of the quotient down.     */
+    n = out->length;
+
+    while (n > 0)
+    {
+        tmpl_polymat_word rem, quot;
+        --n;
+
+        rem = num[n + p->length - 1];
+
+        /*  -WORD_MIN is not a word, and it is not an int either.             */
+        if (lead == -1 && rem == TMPL_POLYMAT_WORD_MIN)
+            goto OVERFLOW;
+
+        /*  Exact division leaves no remainder at any step. If there is one   *
+         *  an earlier sum overflowed. The quotient must also be an int.      */
+        if (rem % lead != 0)
+            goto OVERFLOW;
+
+        quot = rem / lead;
+
+        if (quot < INT_MIN || quot > INT_MAX)
+            goto OVERFLOW;
+
+        out->coeffs[n] = (signed int)quot;
+
+        /*  Subtract quot * x^n * p, which zeros num[n + p->length - 1].      */
+        num[n + p->length - 1] = 0;
+
+        for (s = 0; s + 1 < p->length; ++s)
+        {
+            if (out->coeffs[n] == INT_MIN && p->coeffs[s] == INT_MIN)
+                goto OVERFLOW;
+
+            if (out->coeffs[n] != INT_MIN)
+            {
+                if (!tmpl_polymat_add_product(&num[n + s],
+                                              -out->coeffs[n], p->coeffs[s]))
+                    goto OVERFLOW;
+            }
+
+            else if (!tmpl_polymat_add_product(&num[n + s],
+                                               out->coeffs[n], -p->coeffs[s]))
+                goto OVERFLOW;
+        }
+    }
+
+    /*  The remainder of an exact division is zero.                           */
+    for (s = 0; s + 1 < p->length; ++s)
+        if (num[s] != 0)
+            goto OVERFLOW;
+
+    return 0;
+
+OVERFLOW:
+    TMPL_FREE(out->coeffs);
+    out->length = 0;
+    return TMPL_POLYMAT_OVERFLOW;
+}
+/*  End of tmpl_polymat_exact_divide.                                         */
+
+/*  Frees the entries of the working copy, and the copy itself.               */
+static void tmpl_polymat_free_work(tmpl_PolyMatEntry *work, size_t length)
+{
+    size_t n;
+
+    if (!work)
+        return;
+
+    for (n = 0; n < length; ++n)
+        TMPL_FREE(work[n].coeffs);
+
+    TMPL_FREE(work);
+}
+/*  End of tmpl_polymat_free_work.                                            */
+
+/*  Makes a copy of a polynomial with the leading zeros removed.              */
+static tmpl_Bool
+tmpl_polymat_copy_entry(tmpl_PolyMatEntry *out, const tmpl_IntPolynomial *poly)
+{
+    size_t n;
+
+    out->coeffs = NULL;
+    out->length = 0;
+
+    if (!poly->coeffs)
+        return tmpl_True;
+
+    out->length = poly->degree + 1;
+
+    while (out->length > 0 && poly->coeffs[out->length - 1] == 0)
+        --out->length;
+
+    if (!out->length)
+        return tmpl_True;
+
+    out->coeffs = TMPL_MALLOC(signed int, out->length);
+
+    if (!out->coeffs)
+    {
+        out->length = 0;
+        return tmpl_False;
+    }
+
+    for (n = 0; n < out->length; ++n)
+        out->coeffs[n] = poly->coeffs[n];
+
+    return tmpl_True;
+}
+/*  End of tmpl_polymat_copy_entry.                                           */
+
+/*  Sets an error message for det. All errors here abort the computation.     */
+static void tmpl_polymat_det_error(tmpl_IntPolynomial *det, const char *reason)
+{
+    det->error_occurred = tmpl_True;
+    det->error_message = tmpl_strdup(reason);
+}
+/*  End of tmpl_polymat_det_error.                                            */
+
+/*  Function for computing the determinant of a matrix of polynomials.        */
+void
+tmpl_IntPolynomialMatrix_Determinant(tmpl_IntPolynomial *det,
+                                     const tmpl_IntPolynomialMatrix *matrix)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    size_t n, k, dim, length;
+    tmpl_PolyMatEntry *work;
+    tmpl_PolyMatEntry one, result;
+    signed int one_coeff = 1;
+    const tmpl_PolyMatEntry *prev;
+    tmpl_Bool negate = tmpl_False;
+    int status = 0;
+
+    /*  If the output is NULL there is nothing to be done.                    */
+    if (!det)
+        return;
+
+    /*  Similarly if an error occurred previously.                            */
+    if (det->error_occurred)
+        return;
+
+    /*  Check for invalid inputs. Treat these as an error.                    */
+    if (!matrix)
+    {
+        tmpl_polymat_det_error(
+            det,
+            "\nError Encountered:\n"
+            "    tmpl_IntPolynomialMatrix_Determinant\n\n"
+            "Input matrix is NULL. Aborting.\n\n"
+        );
+
+        return;
+    }
+
+    if (matrix->error_occurred)
+    {
+        tmpl_polymat_det_error(
+            det,
+            "\nError Encountered:\n"
+            "    tmpl_IntPolynomialMatrix_Determinant\n\n"
+            "Input matrix has error_occurred set to true.\n\n"
+        );
+
+        return;
+    }
+
+    if (matrix->number_of_rows != matrix->number_of_columns)
+    {
+        tmpl_polymat_det_error(
+            det,
+            "\nError Encountered:\n"
+            "    tmpl_IntPolynomialMatrix_Determinant\n\n"
+            "Input matrix is not square. Aborting.\n\n"
+        );
+
+        return;
+    }
+
+    dim = matrix->number_of_rows;
+    length = dim * dim;
+
+    /*  The previous pivot of the first step is the constant one.             */
+    one.coeffs = &one_coeff;
+    one.length = 1;
+    prev = &one;
+
+    /*  The empty product, the determinant of a 0x0 matrix, is one.           */
+    if (!dim)
+    {
+        result = one;
+        goto FINISH;
+    }
+
+    work = TMPL_MALLOC(tmpl_PolyMatEntry, length);
+
+    if (!work)
+        goto MALLOC_FAILED;
+
+    for (n = 0; n < length; ++n)
+        work[n].coeffs = NULL;
+
+    for (n = 0; n < length; ++n)
+    {
+        if (matrix->data[n].error_occurred)
+        {
+            tmpl_polymat_free_work(work, length);
+            tmpl_polymat_det_error(
+                det,
+                "\nError Encountered:\n"
+                "    tmpl_IntPolynomialMatrix_Determinant\n\n"
+                "An entry has error_occurred set to true.\n\n"
+            );
+
+            return;
+        }
+
+        if (!tmpl_polymat_copy_entry(&work[n], &matrix->data[n]))
+        {
+            tmpl_polymat_free_work(work, length);
+            goto MALLOC_FAILED;
+        }
+    }
+
+    for (k = 0; k + 1 < dim; ++k)
+    {
+        size_t pivot_row, max_length, rows;
+        const tmpl_PolyMatEntry *pivot;
+
+        /*  Find a non-zero pivot, swapping rows if needed.                   */
+        for (pivot_row = k; pivot_row < dim; ++pivot_row)
+            if (work[pivot_row * dim + k].length)
+                break;
+
+        /*  An all zero column means the matrix is singular.                  */
+        if (pivot_row == dim)
+        {
+            tmpl_polymat_free_work(work, length);
+            tmpl_IntPolynomial_Make_Zero(det);
+            return;
+        }
+
+        if (pivot_row != k)
+        {
+            for (n = k; n < dim; ++n)
+            {
+                const tmpl_PolyMatEntry tmp = work[k * dim + n];
+                work[k * dim + n] = work[pivot_row * dim + n];
+                work[pivot_row * dim + n] = tmp;
+            }
+
+            negate = !negate;
+        }
+
+        pivot = &work[k * dim + k];
+
+        /*  The longest numerator of this step bounds the workspace size.     */
+        max_length = 0;
+
+        for (n = k * dim + k; n < length; ++n)
+            if (work[n].length > max_length)
+                max_length = work[n].length;
+
+        rows = dim - k - 1;
+
+        /*  Each row is updated by one thread. The rows only read row k and   *
+         *  their own entries, so the threads never write the same memory.    */
+#ifdef _OPENMP
+#pragma omp parallel if(rows > 1) reduction(|:status)
+#endif
+        {
+            size_t r;
+            tmpl_polymat_word *num =
+                TMPL_MALLOC(tmpl_polymat_word, 2 * max_length);
+
+            if (!num)
+                status |= TMPL_POLYMAT_MALLOC_FAILED;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+            for (r = 0; r < rows; ++r)
+            {
+                size_t j;
+                const size_t i = k + 1 + r;
+
+                /*  A thread whose workspace failed does no work. The error   *
+                 *  is reported once all threads are done.                    */
+                if (!num)
+                    continue;
+
+                for (j = k + 1; j < dim; ++j)
+                {
+                    tmpl_PolyMatEntry entry;
+                    tmpl_Bool overflow = tmpl_False;
+                    size_t num_length = tmpl_polymat_numerator(
+                        num, &work[i * dim + j], pivot,
+                        &work[i * dim + k], &work[k * dim + j], &overflow
+                    );
+
+                    if (overflow)
+                    {
+                        status |= TMPL_POLYMAT_OVERFLOW;
+                        break;
+                    }
+
+                    status |= tmpl_polymat_exact_divide(
+                        &entry, num, num_length, prev
+                    );
+
+                    TMPL_FREE(work[i * dim + j].coeffs);
+                    work[i * dim + j] = entry;
+                }
+            }
+
+            TMPL_FREE(num);
+        }
+
+        if (status)
+        {
+            tmpl_polymat_free_work(work, length);
+
+            if (status & TMPL_POLYMAT_MALLOC_FAILED)
+                goto MALLOC_FAILED;
+
+            tmpl_polymat_det_error(
+                det,
+                "\nError Encountered:\n"
+                "    tmpl_IntPolynomialMatrix_Determinant\n\n"
+                "A minor of the matrix does not fit in an int. Aborting.\n\n"
+            );
+
+            return;
+        }
+
+        prev = pivot;
+    }
+
+    /*  The final pivot is the determinant. Take it from the working copy.    */
+    result = work[length - 1];
+    work[length - 1].coeffs = NULL;
+    tmpl_polymat_free_work(work, length);
+
+    if (negate)
+    {
+        for (n = 0; n < result.length; ++n)
+        {
+            if (result.coeffs[n] == INT_MIN)
+            {
+                TMPL_FREE(result.coeffs);
+                tmpl_polymat_det_error(
+                    det,
+                    "\nError Encountered:\n"
+                    "    tmpl_IntPolynomialMatrix_Determinant\n\n"
+                    "The determinant does not fit in an int. Aborting.\n\n"
+                );
+
+                return;
+            }
+
+            result.coeffs[n] = -result.coeffs[n];
+        }
+    }
+
+FINISH:
+
+    /*  A singular matrix has a zero final pivot.                             */
+    if (!result.length)
+    {
+        tmpl_IntPolynomial_Make_Zero(det);
+        return;
+    }
+
+    /*  The constant one is not on the heap, make a copy of it.               */
+    if (result.coeffs == &one_coeff)
+    {
+        result.coeffs = TMPL_MALLOC(signed int, 1);
+
+        if (!result.coeffs)
+            goto MALLOC_FAILED;
+
+        result.coeffs[0] = 1;
+    }
+
+    TMPL_FREE(det->coeffs);
+    det->coeffs = result.coeffs;
+    det->degree = result.length - 1;
+    return;
+
+MALLOC_FAILED:
+    tmpl_polymat_det_error(
+        det,
+        "\nError Encountered:\n"
+        "    tmpl_IntPolynomialMatrix_Determinant\n\n"
+        "malloc failed and returned NULL. Aborting.\n\n"
+    );
+}
+/*  End of tmpl_IntPolynomialMatrix_Determinant.                              */
@@ -0,0 +1,490 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                     tmpl_multiply_intpolynomial_matrix                     *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies two matrices of integer polynomials.                       *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_IntPolynomialMatrix_Multiply                                     *
+ *  Purpose:                                                                  *
+ *      Computes the matrix product prod = A * B, where the entries are       *
+ *      elements of Z[x].                                                     *
+ *  Arguments:                                                                *
+ *      prod (tmpl_IntPolynomialMatrix *):                                    *
+ *          The output matrix. It may be the same as A or B.                  *
+ *      A (const tmpl_IntPolynomialMatrix *):                                 *
+ *          The first factor.                                                 *
+ *      B (const tmpl_IntPolynomialMatrix *):                                 *
+ *          The second factor.                                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates the output and the workspaces.                      *
+ *      tmpl_polynomial_integer.h:                                            *
+ *          tmpl_IntPolynomialBuffer_AddTo_Product:                           *
+ *              Fused multiply-add, used for short entries.                   *
+ *          tmpl_IntPolynomialBuffer_AddTo:                                   *
+ *              Adds a Karatsuba product to the accumulator.                  *
+ *          tmpl_IntPolynomial_Multiply_Karatsuba_Kernel:                     *
+ *              Multiplies long entries using a caller-provided workspace.    *
+ *      tmpl_string.h:                                                        *
+ *          tmpl_strdup:                                                      *
+ *              Duplicates a string. Equivalent to the POSIX function strdup. *
+ *  Method:                                                                   *
+ *      Entry (m, n) of the product is the sum over k of A(m, k) * B(k, n).   *
+ *                                                                            *
+ *      First the number of coefficients of every entry of A and B is found,  *
+ *      ignoring leading zeros. This gives the largest possible entry product *
+ *      and so the size of every workspace that is needed.                    *
+ *                                                                            *
+ *      A workspace is a capacity-aware accumulator, a buffer for single      *
+ *      products, and the scratch memory of the Karatsuba kernel, all sized   *
+ *      for the largest product. Each thread allocates one and reuses it for  *
+ *      every entry it computes, so the inner loops never allocate.           *
+ *                                                                            *
+ *      The output is cut into square tiles of TMPL_INTPOLYMAT_BLOCK_SIZE     *
+ *      entries per side. The entries of a tile read the same few rows of A   *
+ *      and columns of B, which stay in cache. With OpenMP the tiles are      *
+ *      handed out to the threads dynamically, since entries may have very    *
+ *      different degrees.                                                    *
+ *                                                                            *
+ *      For each entry the accumulator is set to zero and each of the terms   *
+ *      A(m, k) * B(k, n) is added. Short factors use the fused multiply-add, *
+ *      longer ones the Karatsuba kernel followed by an addition. Each entry  *
+ *      is summed over k in order by one thread, so the output is the same    *
+ *      for any number of threads. Finally the accumulator is copied into an  *
+ *      exactly sized entry of the output.                                    *
+ *  Notes:                                                                    *
+ *      1.) If A or B is NULL, has an error, or their shapes don't match, the *
+ *          error_occurred Boolean of prod is set.                            *
+ *                                                                            *
+ *      2.) The product is written to a new array of entries, and the old     *
+ *          entries of prod are freed afterwards. So prod may be A or B.      *
+ *                                                                            *
+ *      3.) As with the other tmpl_IntPolynomial functions, overflow of the   *
+ *          coefficients is not checked.                                      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_malloc.h:                                                        *
+ *          Header file providing TMPL_MALLOC.                                *
+ *  3.) tmpl_free.h:                                                          *
+ *          Header file providing TMPL_FREE.                                  *
+ *  4.) tmpl_string.h:                                                        *
+ *          Header file where tmpl_strdup is declared.                        *
+ *  5.) tmpl_polynomial_integer.h:                                            *
+ *          Header file with functions for polynomials.                       *
+ *  6.) tmpl_polynomial_matrix_integer.h:                                     *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_MALLOC and TMPL_FREE macros found here.                              */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  tmpl_strdup function declared here.                                       */
+#include <libtmpl/include/tmpl_string.h>
+
+/*  Polynomial products and capacity-aware polynomials given here.            */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_polynomial_matrix_integer.h>
+
+/*  Memory reused by one thread for every entry product it computes.          */
+typedef struct tmpl_PolyMatWorkspace_Def {
+
+    /*  The sum over k of A(m, k) * B(k, n) is accumulated here.              */
+    tmpl_IntPolynomialBuffer sum;
+
+    /*  Single Karatsuba products are written here before being added.        */
+    tmpl_IntPolynomialBuffer term;
+
+    /*  Scratch memory for tmpl_IntPolynomial_Multiply_Karatsuba_Kernel.      */
+    void *scratch;
+} tmpl_PolyMatWorkspace;
+
+/*  Number of coefficients of a polynomial, ignoring leading zeros. Zero for  *
+ *  the zero polynomial, as well as for NULL and empty polynomials.           */
+static size_t tmpl_polymat_length(const tmpl_IntPolynomial *poly)
+{
+    size_t length;
+
+    if (poly->error_occurred || !poly->coeffs)
+        return 0;
+
+    length = poly->degree + 1;
+
+    while (length > 0 && poly->coeffs[length - 1] == 0)
+        --length;
+
+    return length;
+}
+/*  End of tmpl_polymat_length.                                               */
+
+/*  Allocates a workspace for products of factors with at most a_length and   *
+ *  b_length coefficients. Returns false if an allocation fails.              */
+static tmpl_Bool
+tmpl_polymat_workspace_init(tmpl_PolyMatWorkspace *work,
+                            size_t a_length,
+                            size_t b_length)
+{
+    /*  Largest possible factors, used only for their degrees.                */
+    tmpl_IntPolynomial a, b;
+    a.degree = (a_length ? a_length - 1 : 0);
+    b.degree = (b_length ? b_length - 1 : 0);
+
+    work->sum = tmpl_IntPolynomialBuffer_Create(a.degree + b.degree + 1);
+    work->term = tmpl_IntPolynomialBuffer_Create(a.degree + b.degree + 1);
+
+    /*  Short factors never reach the Karatsuba kernel.                       */
+    if (a_length < TMPL_INTPOLY_KARATSUBA_THRESHOLD ||
+        b_length < TMPL_INTPOLY_KARATSUBA_THRESHOLD)
+        work->scratch = NULL;
+    else
+        work->scratch = TMPL_MALLOC(
+            char, tmpl_IntPolynomial_Multiply_Karatsuba_Scratch_Size(&a, &b)
+        );
+
+    if (work->sum.error_occurred || work->term.error_occurred)
+        return tmpl_False;
+
+    if (!work->scratch && a_length >= TMPL_INTPOLY_KARATSUBA_THRESHOLD &&
+        b_length >= TMPL_INTPOLY_KARATSUBA_THRESHOLD)
+        return tmpl_False;
+
+    return tmpl_True;
+}
+/*  End of tmpl_polymat_workspace_init.                                       */
+
+/*  Frees the memory in a workspace.                                          */
+static void tmpl_polymat_workspace_destroy(tmpl_PolyMatWorkspace *work)
+{
+    tmpl_IntPolynomialBuffer_Destroy(&work->sum);
+    tmpl_IntPolynomialBuffer_Destroy(&work->term);
+    TMPL_FREE(work->scratch);
+}
+/*  End of tmpl_polymat_workspace_destroy.                                    */
+
+/*  Computes entry (m, n) of A * B into out. Returns false on failure.        */
+static tmpl_Bool
+tmpl_polymat_entry(tmpl_IntPolynomial *out,
+                   const tmpl_IntPolynomialMatrix *A,
+                   const tmpl_IntPolynomialMatrix *B,
+                   const size_t *a_lengths,
+                   const size_t *b_lengths,
+                   size_t m, size_t n,
+                   tmpl_PolyMatWorkspace *work)
+{
+    size_t k;
+    const size_t inner = A->number_of_columns;
+    const size_t columns = B->number_of_columns;
+
+    tmpl_IntPolynomialBuffer_Make_Zero(&work->sum);
+
+    for (k = 0; k < inner; ++k)
+    {
+        const size_t a_ind = m * inner + k;
+        const size_t b_ind = k * columns + n;
+        tmpl_IntPolynomial a, b;
+
+        /*  Terms with a zero factor contribute nothing.                      */
+        if (!a_lengths[a_ind] || !b_lengths[b_ind])
+            continue;
+
+        /*  Views of the entries with the leading zeros removed.              */
+        a = A->data[a_ind];
+        b = B->data[b_ind];
+        a.degree = a_lengths[a_ind] - 1;
+        b.degree = b_lengths[b_ind] - 1;
+
+        /*  Short products are accumulated directly.                          */
+        if (a_lengths[a_ind] < TMPL_INTPOLY_KARATSUBA_THRESHOLD ||
+            b_lengths[b_ind] < TMPL_INTPOLY_KARATSUBA_THRESHOLD)
+            tmpl_IntPolynomialBuffer_AddTo_Product(&work->sum, &a, &b);
+
+        /*  Long ones go through the Karatsuba kernel. The view of the term   *
+         *  buffer has the exact degree of the product, so the kernel writes  *
+         *  into the buffer and does not reallocate.                          */
+        else
+        {
+            tmpl_IntPolynomial term;
+            term = tmpl_IntPolynomialBuffer_View(&work->term);
+            term.degree = a.degree + b.degree;
+
+            tmpl_IntPolynomial_Multiply_Karatsuba_Kernel(
+                &a, &b, &term, work->scratch
+            );
+
+            tmpl_IntPolynomialBuffer_AddTo(&work->sum, &term);
+        }
+    }
+
+    if (work->sum.error_occurred)
+        return tmpl_False;
+
+    /*  Copy the sum into an exactly sized entry.                             */
+    out->coeffs = TMPL_MALLOC(signed int, work->sum.degree + 1);
+
+    if (!out->coeffs)
+        return tmpl_False;
+
+    out->degree = work->sum.degree;
+
+    for (k = 0; k <= out->degree; ++k)
+        out->coeffs[k] = work->sum.coeffs[k];
+
+    return tmpl_True;
+}
+/*  End of tmpl_polymat_entry.                                                */
+
+/*  Destroys the first length entries of an array, and the array itself.      */
+static void tmpl_polymat_free_entries(tmpl_IntPolynomial *data, size_t length)
+{
+    size_t n;
+
+    if (!data)
+        return;
+
+    for (n = 0; n < length; ++n)
+        tmpl_IntPolynomial_Destroy(&data[n]);
+
+    TMPL_FREE(data);
+}
+/*  End of tmpl_polymat_free_entries.                                         */
+
+/*  Sets an error message for prod. All errors here abort the computation.    */
+static void
+tmpl_polymat_error(tmpl_IntPolynomialMatrix *prod, const char *reason)
+{
+    prod->error_occurred = tmpl_True;
+    prod->error_message = tmpl_strdup(reason);
+}
+/*  End of tmpl_polymat_error.                                                */
+
+/*  Function for multiplying two matrices of polynomials.                     */
+void
+tmpl_IntPolynomialMatrix_Multiply(tmpl_IntPolynomialMatrix *prod,
+                                  const tmpl_IntPolynomialMatrix *A,
+                                  const tmpl_IntPolynomialMatrix *B)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    size_t n, rows, columns, a_size, b_size, length;
+    size_t a_max, b_max, tile_rows, tile_columns, tiles;
+    size_t *a_lengths, *b_lengths;
+    tmpl_IntPolynomial *data;
+    int failed = 0;
+
+    /*  If the output is NULL there is nothing to be done.                    */
+    if (!prod)
+        return;
+
+    /*  Similarly if an error occurred previously.                            */
+    if (prod->error_occurred)
+        return;
+
+    /*  Check for invalid inputs. Treat these as an error.                    */
+    if (!A || !B)
+    {
+        tmpl_polymat_error(
+            prod,
+            "\nError Encountered:\n"
+            "    tmpl_IntPolynomialMatrix_Multiply\n\n"
+            "Input matrix is NULL. Aborting.\n\n"
+        );
+
+        return;
+    }
+
+    if (A->error_occurred || B->error_occurred)
+    {
+        tmpl_polymat_error(
+            prod,
+            "\nError Encountered:\n"
+            "    tmpl_IntPolynomialMatrix_Multiply\n\n"
+            "Input matrix has error_occurred set to true.\n\n"
+        );
+
+        return;
+    }
+
+    if (A->number_of_columns != B->number_of_rows)
+    {
+        tmpl_polymat_error(
+            prod,
+            "\nError Encountered:\n"
+            "    tmpl_IntPolynomialMatrix_Multiply\n\n"
+            "Number of columns of A does not equal rows of B. Aborting.\n\n"
+        );
+
+        return;
+    }
+
+    rows = A->number_of_rows;
+    columns = B->number_of_columns;
+    length = rows * columns;
+    a_size = A->number_of_rows * A->number_of_columns;
+    b_size = B->number_of_rows * B->number_of_columns;
+
+    /*  The product has no entries, only the shape needs to be set.           */
+    if (length == (size_t)0)
+    {
+        tmpl_polymat_free_entries(
+            prod->data, prod->number_of_rows * prod->number_of_columns
+        );
+
+        prod->data = NULL;
+        prod->number_of_rows = rows;
+        prod->number_of_columns = columns;
+        return;
+    }
+
+    data = TMPL_MALLOC(tmpl_IntPolynomial, length);
+
+    /*  An inner dimension of zero gives the zero matrix, which still needs   *
+     *  entries. Avoid zero sized allocations for the lengths in that case.   */
+    a_lengths = TMPL_MALLOC(size_t, a_size + 1);
+    b_lengths = TMPL_MALLOC(size_t, b_size + 1);
+
+    if (!data || !a_lengths || !b_lengths)
+    {
+        TMPL_FREE(data);
+        TMPL_FREE(a_lengths);
+        TMPL_FREE(b_lengths);
+        tmpl_polymat_error(
+            prod,
+            "\nError Encountered:\n"
+            "    tmpl_IntPolynomialMatrix_Multiply\n\n"
+            "malloc failed and returned NULL. Aborting.\n\n"
+        );
+
+        return;
+    }
+
+    /*  The sizes of the entries determine the size of the workspaces.        */
+    a_max = b_max = 0;
+
+    for (n = 0; n < a_size; ++n)
+    {
+        a_lengths[n] = tmpl_polymat_length(&A->data[n]);
+
+        if (a_lengths[n] > a_max)
+            a_max = a_lengths[n];
+    }
+
+    for (n = 0; n < b_size; ++n)
+    {
+        b_lengths[n] = tmpl_polymat_length(&B->data[n]);
+
+        if (b_lengths[n] > b_max)
+            b_max = b_lengths[n];
+    }
+
+    for (n = 0; n < length; ++n)
+        tmpl_IntPolynomial_Init(&data[n]);
+
+    tile_rows = (rows + TMPL_INTPOLYMAT_BLOCK_SIZE - 1) /
+                TMPL_INTPOLYMAT_BLOCK_SIZE;
+
+    tile_columns = (columns + TMPL_INTPOLYMAT_BLOCK_SIZE - 1) /
+                   TMPL_INTPOLYMAT_BLOCK_SIZE;
+
+    tiles = tile_rows * tile_columns;
+
+    /*  Each thread allocates one workspace and computes whole tiles with it. */
+#ifdef _OPENMP
+#pragma omp parallel if(tiles > 1) reduction(|:failed)
+#endif
+    {
+        tmpl_PolyMatWorkspace work;
+        size_t t;
+
+        if (!tmpl_polymat_workspace_init(&work, a_max, b_max))
+            failed = 1;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for (t = 0; t < tiles; ++t)
+        {
+            size_t m, k;
+            const size_t m0 = (t / tile_columns) * TMPL_INTPOLYMAT_BLOCK_SIZE;
+            const size_t k0 = (t % tile_columns) * TMPL_INTPOLYMAT_BLOCK_SIZE;
+            const size_t m1 = (m0 + TMPL_INTPOLYMAT_BLOCK_SIZE < rows ?
+                               m0 + TMPL_INTPOLYMAT_BLOCK_SIZE : rows);
+            const size_t k1 = (k0 + TMPL_INTPOLYMAT_BLOCK_SIZE < columns ?
+                               k0 + TMPL_INTPOLYMAT_BLOCK_SIZE : columns);
+
+            /*  A thread whose workspace failed still runs the loop, but does *
+             *  no work. The error is reported once every thread is done.     */
+            if (failed)
+                continue;
+
+            for (m = m0; m < m1; ++m)
+            {
+                for (k = k0; k < k1; ++k)
+                {
+                    if (!tmpl_polymat_entry(&data[m * columns + k], A, B,
+                                            a_lengths, b_lengths, m, k, &work))
+                        failed = 1;
+                }
+            }
+        }
+
+        tmpl_polymat_workspace_destroy(&work);
+    }
+
+    TMPL_FREE(a_lengths);
+    TMPL_FREE(b_lengths);
+
+    if (failed)
+    {
+        tmpl_polymat_free_entries(data, length);
+        tmpl_polymat_error(
+            prod,
+            "\nError Encountered:\n"
+            "    tmpl_IntPolynomialMatrix_Multiply\n\n"
+            "malloc failed and returned NULL. Aborting.\n\n"
+        );
+
+        return;
+    }
+
+    /*  The inputs have been read, the old entries of prod may be freed now.  */
+    tmpl_polymat_free_entries(
+        prod->data, prod->number_of_rows * prod->number_of_columns
+    );
+
+    prod->data = data;
+    prod->number_of_rows = rows;
+    prod->number_of_columns = columns;
+}
+/*  End of tmpl_IntPolynomialMatrix_Multiply.                                 */
@@ -0,0 +1,93 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                      tmpl_quadruple_bigint_bit_length                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the number of bits in a tmpl_BigInt.                         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_QuadrupleBigInt_Bit_Length                                       *
+ *  Purpose:                                                                  *
+ *      Computes the number of bits in |x|, zero for x = 0.                   *
+ *  Arguments:                                                                *
+ *      x (const tmpl_BigInt *):                                              *
+ *          An integer.                                                       *
+ *  Output:                                                                   *
+ *      bits (unsigned long int):                                             *
+ *          The number of bits in |x|.                                        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing TMPL_STATIC_INLINE.                         *
+ *  2.) tmpl_quadruple_limbs.h:                                               *
+ *          Constants and typedefs for the limb routines.                     *
+ *  3.) tmpl_bigint.h:                                                        *
+ *          Header file with the tmpl_BigInt routines.                        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_QUADRUPLE_BIGINT_BIT_LENGTH_H
+#define TMPL_QUADRUPLE_BIGINT_BIT_LENGTH_H
+
+/*  TMPL_STATIC_INLINE macro provided here.                                   */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  tmpl_UInt64 and the binary128 constants found here.                       */
+#include "tmpl_quadruple_limbs.h"
+
+/*  tmpl_BigInt and its arithmetic routines found here.                       */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  The limb routines need 64-bit integers.                                   */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  Number of bits in the magnitude of x.                                     */
+TMPL_STATIC_INLINE
+unsigned long int tmpl_QuadrupleBigInt_Bit_Length(const tmpl_BigInt *x)
+{
+    unsigned long int bits;
+    tmpl_BigIntLimb top;
+
+    if (!x->length)
+        return 0UL;
+
+    bits = (unsigned long int)(x->length - 1) * TMPL_BIGINT_LIMB_BIT;
+    top = TMPL_BIGINT_LIMBS(x)[x->length - 1];
+
+    while (top)
+    {
+        ++bits;
+        top = (tmpl_BigIntLimb)(top >> 1);
+    }
+
+    return bits;
+}
+/*  End of tmpl_QuadrupleBigInt_Bit_Length.                                   */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,104 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                         tmpl_quadruple_bigint_pow                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes powers as tmpl_BigInt for exact decimal conversion.          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_QuadrupleBigInt_Pow                                              *
+ *  Purpose:                                                                  *
+ *      Computes base^n by repeated squaring.                                 *
+ *  Arguments:                                                                *
+ *      x (tmpl_BigInt *):                                                    *
+ *          An initialized number, set to base^n.                             *
+ *      base (unsigned long int):                                             *
+ *          The base.                                                         *
+ *      n (unsigned long int):                                                *
+ *          The power.                                                        *
+ *  Output:                                                                   *
+ *      success (tmpl_Bool):                                                  *
+ *          False if an error occurred in the tmpl_BigInt routines.           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing TMPL_STATIC_INLINE.                         *
+ *  2.) tmpl_quadruple_limbs.h:                                               *
+ *          Constants and typedefs for the limb routines.                     *
+ *  3.) tmpl_bigint.h:                                                        *
+ *          Header file with the tmpl_BigInt routines.                        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_QUADRUPLE_BIGINT_POW_H
+#define TMPL_QUADRUPLE_BIGINT_POW_H
+
+/*  TMPL_STATIC_INLINE macro provided here.                                   */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  tmpl_UInt64 and the binary128 constants found here.                       */
+#include "tmpl_quadruple_limbs.h"
+
+/*  tmpl_BigInt and its arithmetic routines found here.                       */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  The limb routines need 64-bit integers.                                   */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  Computes x = base^n by repeated squaring.                                 */
+TMPL_STATIC_INLINE
+tmpl_Bool
+tmpl_QuadrupleBigInt_Pow(tmpl_BigInt *x, unsigned long int base,
+                         unsigned long int n)
+{
+    tmpl_Bool success;
+    tmpl_BigInt square;
+
+    tmpl_BigInt_Init(&square);
+    tmpl_BigInt_Set_ULong(&square, base);
+    tmpl_BigInt_Set_ULong(x, 1UL);
+
+    while (n)
+    {
+        if (n & 1UL)
+            tmpl_BigInt_Multiply(x, x, &square);
+
+        n >>= 1;
+
+        if (n)
+            tmpl_BigInt_Multiply(&square, &square, &square);
+    }
+
+    success = (tmpl_Bool)(!x->error_occurred && !square.error_occurred);
+    tmpl_BigInt_Destroy(&square);
+    return success;
+}
+/*  End of tmpl_QuadrupleBigInt_Pow.                                          */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
+
+#endif
+/*  End of include guard.                                                     */
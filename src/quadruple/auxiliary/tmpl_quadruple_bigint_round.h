@@ -0,0 +1,150 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                        tmpl_quadruple_bigint_round                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Rounds a tmpl_BigInt times a power of two to binary128.               *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_QuadrupleBigInt_Round                                            *
+ *  Purpose:                                                                  *
+ *      Rounds x 2^scale to binary128, where x is a positive integer.         *
+ *  Arguments:                                                                *
+ *      x (const tmpl_BigInt *):                                              *
+ *          A positive integer.                                               *
+ *      scale (signed long int):                                              *
+ *          The power of two x is scaled by.                                  *
+ *      sticky (tmpl_Bool):                                                   *
+ *          True if the exact value is slightly larger than x 2^scale, as     *
+ *          when x is the quotient of an inexact division.                    *
+ *      is_negative (tmpl_Bool):                                              *
+ *          The sign of the result.                                           *
+ *  Output:                                                                   *
+ *      out (tmpl_UnpackedQuadruple):                                         *
+ *          The correctly rounded value.                                      *
+ *  Method:                                                                   *
+ *      Read off the top 127 bits of x. The bits below these, and the sticky  *
+ *      argument, are jammed into one more bit placed below them, and the     *
+ *      result is passed to tmpl_UnpackedQuadruple_Round.                     *
+ *  Notes:                                                                    *
+ *      The sticky bit is only correct if x has at least 115 bits. The        *
+ *      callers arrange this when the division is inexact.                    *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing TMPL_STATIC_INLINE.                         *
+ *  2.) tmpl_quadruple_limbs.h:                                               *
+ *          Constants and typedefs for the limb routines.                     *
+ *  3.) tmpl_bigint.h:                                                        *
+ *          Header file with the tmpl_BigInt routines.                        *
+ *  4.) tmpl_quadruple_bigint_bit_length.h:                                   *
+ *          Bit length of x.                                                  *
+ *  5.) tmpl_quadruple_shift_left128.h:                                       *
+ *          Left shift of 128-bit integers.                                   *
+ *  6.) tmpl_quadruple_round.h:                                               *
+ *          Rounding to binary128.                                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_QUADRUPLE_BIGINT_ROUND_H
+#define TMPL_QUADRUPLE_BIGINT_ROUND_H
+
+/*  TMPL_STATIC_INLINE macro provided here.                                   */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  tmpl_UInt64 and the binary128 constants found here.                       */
+#include "tmpl_quadruple_limbs.h"
+
+/*  tmpl_BigInt and its arithmetic routines found here.                       */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  tmpl_QuadrupleBigInt_Bit_Length found here.                               */
+#include "tmpl_quadruple_bigint_bit_length.h"
+
+/*  tmpl_Quadruple_Shift_Left128 found here.                                  */
+#include "tmpl_quadruple_shift_left128.h"
+
+/*  tmpl_UnpackedQuadruple_Round found here.                                  */
+#include "tmpl_quadruple_round.h"
+
+/*  The limb routines need 64-bit integers.                                   */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  Bit n of the magnitude of a tmpl_BigInt.                                  */
+#define TMPL_QUADRUPLE_BIGINT_BIT(x, n)                                        \
+    ((TMPL_BIGINT_LIMBS(x)[(n) / TMPL_BIGINT_LIMB_BIT] >>                      \
+      ((n) % TMPL_BIGINT_LIMB_BIT)) & 1U)
+
+/*  Rounds x 2^scale, plus a little if sticky is set, to binary128.           */
+TMPL_STATIC_INLINE
+tmpl_UnpackedQuadruple
+tmpl_QuadrupleBigInt_Round(const tmpl_BigInt *x, signed long int scale,
+                           tmpl_Bool sticky, tmpl_Bool is_negative)
+{
+    tmpl_UInt64 hi = 0, lo = 0;
+    unsigned long int n, low;
+    const unsigned long int length = tmpl_QuadrupleBigInt_Bit_Length(x);
+
+    /*  The top 127 bits are kept, the rest only matter for the sticky bit.   */
+    low = (length > 127UL ? length - 127UL : 0UL);
+
+    for (n = length; n-- > low;)
+    {
+        tmpl_Quadruple_Shift_Left128(&hi, &lo, 1);
+        lo |= TMPL_QUADRUPLE_BIGINT_BIT(x, n);
+    }
+
+    /*  Whole limbs below the cut, and then the bits of the partial limb.     */
+    for (n = 0; n < low / TMPL_BIGINT_LIMB_BIT && !sticky; ++n)
+        sticky = (tmpl_Bool)(TMPL_BIGINT_LIMBS(x)[n] != 0);
+
+    if (!sticky && low % TMPL_BIGINT_LIMB_BIT)
+    {
+        const tmpl_BigIntLimb mask = (tmpl_BigIntLimb)(
+            ((tmpl_BigIntLimb)1 << (low % TMPL_BIGINT_LIMB_BIT)) - 1U
+        );
+
+        sticky = (tmpl_Bool)(
+            (TMPL_BIGINT_LIMBS(x)[low / TMPL_BIGINT_LIMB_BIT] & mask) != 0
+        );
+    }
+
+    /*  Place the sticky bit below everything that was kept.                  */
+    tmpl_Quadruple_Shift_Left128(&hi, &lo, 1);
+    lo |= (tmpl_UInt64)sticky;
+
+    /*  Bit 0 is now worth 2^(scale + low - 1), so bit 127 is worth this      *
+     *  times 2^127.                                                          */
+    return tmpl_UnpackedQuadruple_Round(
+        is_negative, scale + (signed long int)low + 126L, hi, lo
+    );
+}
+/*  End of tmpl_QuadrupleBigInt_Round.                                        */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
+
+#endif
+/*  End of include guard.                                                     */
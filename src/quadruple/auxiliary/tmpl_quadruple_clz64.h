@@ -0,0 +1,85 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                            tmpl_quadruple_clz64                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Counts the leading zeros of a 64-bit integer.                         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Quadruple_CLZ64                                                  *
+ *  Purpose:                                                                  *
+ *      Counts the leading zeros of a non-zero 64-bit integer.                *
+ *  Arguments:                                                                *
+ *      x (tmpl_UInt64):                                                      *
+ *          A non-zero integer.                                               *
+ *  Output:                                                                   *
+ *      clz (int):                                                            *
+ *          The number of leading zeros of x.                                 *
+ *  Method:                                                                   *
+ *      Use tmpl_UInt64_Leading_Zeros. This is a compiler builtin if          *
+ *      __has_builtin finds one, and libtmpl's portable routine               *
+ *      otherwise.                                                            *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing TMPL_STATIC_INLINE.                         *
+ *  2.) tmpl_quadruple_limbs.h:                                               *
+ *          Constants and typedefs for the limb routines.                     *
+ *  3.) tmpl_integer.h:                                                       *
+ *          Header file providing the leading zeros macros.                   *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_QUADRUPLE_CLZ64_H
+#define TMPL_QUADRUPLE_CLZ64_H
+
+/*  TMPL_STATIC_INLINE macro provided here.                                   */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  tmpl_UInt64 and the binary128 constants found here.                       */
+#include "tmpl_quadruple_limbs.h"
+
+/*  tmpl_UInt64_Leading_Zeros macro found here.                               */
+#include <libtmpl/include/tmpl_integer.h>
+
+/*  The limb routines need 64-bit integers.                                   */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  Number of leading zeros of a non-zero 64-bit integer.                     */
+TMPL_STATIC_INLINE
+int tmpl_Quadruple_CLZ64(tmpl_UInt64 x)
+{
+    /*  tmpl_integer.h picks a compiler builtin, checked with __has_builtin,  *
+     *  or falls back to libtmpl's portable routine. x is non-zero, so the    *
+     *  zero check in the macro never matters.                                */
+    return (int)tmpl_UInt64_Leading_Zeros(x);
+}
+/*  End of tmpl_Quadruple_CLZ64.                                              */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
+
+#endif
+/*  End of include guard.                                                     */
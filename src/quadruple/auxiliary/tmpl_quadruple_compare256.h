@@ -0,0 +1,85 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                         tmpl_quadruple_compare256                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Compares two 256-bit integers.                                        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Quadruple_Compare256                                             *
+ *  Purpose:                                                                  *
+ *      Compares two 256-bit integers.                                        *
+ *  Arguments:                                                                *
+ *      x (const tmpl_UInt64 * const):                                        *
+ *          Four limbs, least significant first.                              *
+ *      y (const tmpl_UInt64 * const):                                        *
+ *          Four limbs, least significant first.                              *
+ *  Output:                                                                   *
+ *      cmp (int):                                                            *
+ *          -1, 0, or 1 as x < y, x = y, or x > y.                            *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing TMPL_STATIC_INLINE.                         *
+ *  2.) tmpl_quadruple_limbs.h:                                               *
+ *          Constants and typedefs for the limb routines.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_QUADRUPLE_COMPARE256_H
+#define TMPL_QUADRUPLE_COMPARE256_H
+
+/*  TMPL_STATIC_INLINE macro provided here.                                   */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  tmpl_UInt64 and the binary128 constants found here.                       */
+#include "tmpl_quadruple_limbs.h"
+
+/*  The limb routines need 64-bit integers.                                   */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  Returns -1, 0, or 1 as x < y, x = y, or x > y.                            */
+TMPL_STATIC_INLINE
+int
+tmpl_Quadruple_Compare256(const tmpl_UInt64 * const x,
+                          const tmpl_UInt64 * const y)
+{
+    unsigned int n = 4;
+
+    while (n--)
+    {
+        if (x[n] != y[n])
+            return (x[n] < y[n] ? -1 : 1);
+    }
+
+    return 0;
+}
+/*  End of tmpl_Quadruple_Compare256.                                         */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,78 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                            tmpl_quadruple_limbs                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides the constants and typedefs shared by the 128-bit and         *
+ *      256-bit integer routines for quadruple precision.                     *
+ ******************************************************************************
+ *  Notes:                                                                    *
+ *      128-bit numbers are pairs (hi, lo), 256-bit numbers are arrays of     *
+ *      four limbs with the least significant limb first. Each routine lives  *
+ *      in its own header in this directory, so a file only includes the      *
+ *      routines it calls.                                                    *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_quadruple.h:                                                     *
+ *          Header file with the quadruple typedefs.                          *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_QUADRUPLE_LIMBS_H
+#define TMPL_QUADRUPLE_LIMBS_H
+
+/*  Quadruple typedefs and fixed-width integers found here.                   */
+#include <libtmpl/include/tmpl_quadruple.h>
+
+/*  The limb routines need 64-bit integers.                                   */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  Exponent bias and range for binary128.                                    */
+#define TMPL_QUADRUPLE_BIAS (16383L)
+#define TMPL_QUADRUPLE_EMIN (-16382L)
+#define TMPL_QUADRUPLE_EMAX (16383L)
+
+/*  The number of fraction bits, and the smallest subnormal exponent.         */
+#define TMPL_QUADRUPLE_MANTISSA_LENGTH (112)
+#define TMPL_QUADRUPLE_SUBNORMAL_EMIN (-16494L)
+
+/*  The implicit leading bit, as it sits in the high word.                    */
+#define TMPL_QUADRUPLE_HIDDEN_BIT (((tmpl_UInt64)1) << 48)
+
+/*  Mask for the low 32 bits of a 64-bit integer.                             */
+#define TMPL_QUADRUPLE_LOW32 (0xFFFFFFFFU)
+
+/*  unsigned __int128 is an extension. GCC, Clang, and friends provide it on  *
+ *  64-bit platforms and advertise it with __SIZEOF_INT128__.                 */
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 tmpl_QuadrupleWide;
+#define TMPL_QUADRUPLE_HAS_WIDE 1
+#else
+#define TMPL_QUADRUPLE_HAS_WIDE 0
+#endif
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
+
+#endif
+/*  End of include guard.                                                     */
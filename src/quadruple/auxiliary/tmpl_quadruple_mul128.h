@@ -0,0 +1,158 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                           tmpl_quadruple_mul128                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the full 256-bit product of two 128-bit integers.            *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Quadruple_Mul64                                                  *
+ *  Purpose:                                                                  *
+ *      Computes the full 128-bit product of two 64-bit integers.             *
+ *  Arguments:                                                                *
+ *      x (tmpl_UInt64):                                                      *
+ *          An integer.                                                       *
+ *      y (tmpl_UInt64):                                                      *
+ *          Another integer.                                                  *
+ *      hi (tmpl_UInt64 *):                                                   *
+ *          The high word of the product.                                     *
+ *      lo (tmpl_UInt64 *):                                                   *
+ *          The low word of the product.                                      *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      If the compiler provides unsigned __int128 it is used, which is       *
+ *      a single instruction on 64-bit machines. Otherwise the product        *
+ *      is done with 32-bit halves.                                           *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Quadruple_Mul128                                                 *
+ *  Purpose:                                                                  *
+ *      Computes the full 256-bit product of (x_hi, x_lo) and                 *
+ *      (y_hi, y_lo).                                                         *
+ *  Arguments:                                                                *
+ *      x_hi (tmpl_UInt64):                                                   *
+ *          The high word of the first factor.                                *
+ *      x_lo (tmpl_UInt64):                                                   *
+ *          The low word of the first factor.                                 *
+ *      y_hi (tmpl_UInt64):                                                   *
+ *          The high word of the second factor.                               *
+ *      y_lo (tmpl_UInt64):                                                   *
+ *          The low word of the second factor.                                *
+ *      prod (tmpl_UInt64 * const):                                           *
+ *          Four limbs for the product, least significant first.              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      Schoolbook multiplication with four calls to                          *
+ *      tmpl_Quadruple_Mul64, adding the cross terms into the middle.         *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing TMPL_STATIC_INLINE.                         *
+ *  2.) tmpl_quadruple_limbs.h:                                               *
+ *          Constants and typedefs for the limb routines.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_QUADRUPLE_MUL128_H
+#define TMPL_QUADRUPLE_MUL128_H
+
+/*  TMPL_STATIC_INLINE macro provided here.                                   */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  tmpl_UInt64 and the binary128 constants found here.                       */
+#include "tmpl_quadruple_limbs.h"
+
+/*  The limb routines need 64-bit integers.                                   */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  Full 128-bit product of two 64-bit integers.                              */
+TMPL_STATIC_INLINE
+void
+tmpl_Quadruple_Mul64(tmpl_UInt64 x, tmpl_UInt64 y,
+                     tmpl_UInt64 *hi, tmpl_UInt64 *lo)
+{
+#if TMPL_QUADRUPLE_HAS_WIDE == 1
+    const tmpl_QuadrupleWide prod = (tmpl_QuadrupleWide)x * y;
+    *hi = (tmpl_UInt64)(prod >> 64);
+    *lo = (tmpl_UInt64)prod;
+#else
+    /*  Split into 32-bit halves. Each partial product fits in 64 bits.       */
+    const tmpl_UInt64 x_lo = x & TMPL_QUADRUPLE_LOW32, x_hi = x >> 32;
+    const tmpl_UInt64 y_lo = y & TMPL_QUADRUPLE_LOW32, y_hi = y >> 32;
+    const tmpl_UInt64 lo_lo = x_lo * y_lo;
+    const tmpl_UInt64 hi_lo = x_hi * y_lo;
+    const tmpl_UInt64 lo_hi = x_lo * y_hi;
+    const tmpl_UInt64 hi_hi = x_hi * y_hi;
+
+    /*  The middle column, with carries, cannot overflow 64 bits.             */
+    const tmpl_UInt64 mid =
+        (lo_lo >> 32) + (hi_lo & TMPL_QUADRUPLE_LOW32) + lo_hi;
+
+    *hi = hi_hi + (hi_lo >> 32) + (mid >> 32);
+    *lo = (mid << 32) | (lo_lo & TMPL_QUADRUPLE_LOW32);
+#endif
+}
+/*  End of tmpl_Quadruple_Mul64.                                              */
+
+/*  Full 256-bit product of (x_hi, x_lo) and (y_hi, y_lo).                    */
+TMPL_STATIC_INLINE
+void
+tmpl_Quadruple_Mul128(tmpl_UInt64 x_hi, tmpl_UInt64 x_lo,
+                      tmpl_UInt64 y_hi, tmpl_UInt64 y_lo,
+                      tmpl_UInt64 * const prod)
+{
+    tmpl_UInt64 p_hi, p_lo, carry;
+
+    tmpl_Quadruple_Mul64(x_lo, y_lo, &prod[1], &prod[0]);
+    tmpl_Quadruple_Mul64(x_hi, y_hi, &prod[3], &prod[2]);
+
+    /*  Add the cross terms into the middle two limbs.                        */
+    tmpl_Quadruple_Mul64(x_hi, y_lo, &p_hi, &p_lo);
+    prod[1] += p_lo;
+    carry = (prod[1] < p_lo);
+    prod[2] += carry;
+    carry = (prod[2] < carry);
+    prod[2] += p_hi;
+    carry += (prod[2] < p_hi);
+    prod[3] += carry;
+
+    tmpl_Quadruple_Mul64(x_lo, y_hi, &p_hi, &p_lo);
+    prod[1] += p_lo;
+    carry = (prod[1] < p_lo);
+    prod[2] += carry;
+    carry = (prod[2] < carry);
+    prod[2] += p_hi;
+    carry += (prod[2] < p_hi);
+    prod[3] += carry;
+}
+/*  End of tmpl_Quadruple_Mul128.                                             */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
+
+#endif
+/*  End of include guard.                                                     */
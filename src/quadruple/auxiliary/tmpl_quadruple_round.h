@@ -0,0 +1,167 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                            tmpl_quadruple_round                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides correct rounding for the quadruple precision routines.       *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_UnpackedQuadruple_Round                                          *
+ *  Purpose:                                                                  *
+ *      Rounds sig 2^(expo - 127) to binary128, where sig is a non-zero       *
+ *      128-bit integer whose lowest bit is a sticky bit.                     *
+ *  Arguments:                                                                *
+ *      is_negative (tmpl_Bool):                                              *
+ *          The sign of the result.                                           *
+ *      expo (signed long int):                                               *
+ *          The exponent of bit 127 of sig.                                   *
+ *      hi (tmpl_UInt64):                                                     *
+ *          The high word of sig.                                             *
+ *      lo (tmpl_UInt64):                                                     *
+ *          The low word of sig.                                              *
+ *  Output:                                                                   *
+ *      out (tmpl_UnpackedQuadruple):                                         *
+ *          The correctly rounded value.                                      *
+ *  Method:                                                                   *
+ *      Normalize so bit 127 is set. If the exponent is below the normal      *
+ *      range, shift right (jamming) so the result has the subnormal          *
+ *      precision. The top 113 bits are kept and the lower 15 bits are the    *
+ *      round and sticky bits, so round to nearest, ties to even. Renormalize *
+ *      a carry out of the top, and check for overflow.                       *
+ *  Notes:                                                                    *
+ *      Correct rounding requires that sig has at least 2 bits below the      *
+ *      113 bits that are kept, with the lowest set if anything non-zero was  *
+ *      discarded. The callers keep at least 3.                               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing TMPL_STATIC_INLINE.                         *
+ *  2.) tmpl_quadruple_limbs.h:                                               *
+ *          Constants and typedefs for the limb routines.                     *
+ *  3.) tmpl_quadruple_clz64.h:                                               *
+ *          Counts leading zeros.                                             *
+ *  4.) tmpl_quadruple_shift_left128.h:                                       *
+ *          Left shift of 128-bit integers.                                   *
+ *  5.) tmpl_quadruple_shift_right_jam128.h:                                  *
+ *          Jamming right shift of 128-bit integers.                          *
+ *  6.) tmpl_quadruple_round_guard.h:                                         *
+ *          Rounds the top 113 bits.                                          *
+ *  7.) tmpl_quadruple_special.h:                                             *
+ *          Creates zeros and infinities.                                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_QUADRUPLE_ROUND_H
+#define TMPL_QUADRUPLE_ROUND_H
+
+/*  TMPL_STATIC_INLINE macro provided here.                                   */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  tmpl_UInt64 and the binary128 constants found here.                       */
+#include "tmpl_quadruple_limbs.h"
+
+/*  tmpl_Quadruple_CLZ64 found here.                                          */
+#include "tmpl_quadruple_clz64.h"
+
+/*  128-bit shifts found here.                                                */
+#include "tmpl_quadruple_shift_left128.h"
+#include "tmpl_quadruple_shift_right_jam128.h"
+
+/*  tmpl_Quadruple_Round_Guard found here.                                    */
+#include "tmpl_quadruple_round_guard.h"
+
+/*  tmpl_UnpackedQuadruple_Special found here.                                */
+#include "tmpl_quadruple_special.h"
+
+/*  The limb routines need 64-bit integers.                                   */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  Rounds sig 2^(expo - 127) to binary128.                                   */
+TMPL_STATIC_INLINE
+tmpl_UnpackedQuadruple
+tmpl_UnpackedQuadruple_Round(tmpl_Bool is_negative, signed long int expo,
+                             tmpl_UInt64 hi, tmpl_UInt64 lo)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_UnpackedQuadruple out;
+    int shift;
+
+    /*  Normalize so that bit 127 is set. This shift is exact.                */
+    if (hi)
+        shift = tmpl_Quadruple_CLZ64(hi);
+    else
+        shift = 64 + tmpl_Quadruple_CLZ64(lo);
+
+    tmpl_Quadruple_Shift_Left128(&hi, &lo, (unsigned long int)shift);
+    expo -= shift;
+
+    /*  Subnormal range, the precision is reduced. Shift so that the round    *
+     *  bit is in the right place, and round only once.                       */
+    if (expo < TMPL_QUADRUPLE_EMIN)
+    {
+        const signed long int diff = TMPL_QUADRUPLE_EMIN - expo;
+        tmpl_Quadruple_Shift_Right_Jam128(&hi, &lo, (unsigned long int)diff);
+        expo = TMPL_QUADRUPLE_EMIN;
+    }
+
+    if (tmpl_Quadruple_Round_Guard(&hi, &lo))
+    {
+        lo = (lo >> 1) | (hi << 63);
+        hi >>= 1;
+        ++expo;
+    }
+
+    if (!(hi | lo))
+        return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_ZERO, is_negative);
+
+    /*  Subnormal results are stored normalized, with a smaller exponent.     */
+    if (!(hi & TMPL_QUADRUPLE_HIDDEN_BIT))
+    {
+        if (hi)
+            shift = tmpl_Quadruple_CLZ64(hi) - 15;
+        else
+            shift = 64 + tmpl_Quadruple_CLZ64(lo) - 15;
+
+        tmpl_Quadruple_Shift_Left128(&hi, &lo, (unsigned long int)shift);
+        expo -= shift;
+    }
+
+    if (expo > TMPL_QUADRUPLE_EMAX)
+        return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_INF, is_negative);
+
+    out.hi = hi;
+    out.lo = lo;
+    out.expo = expo;
+    out.kind = TMPL_QUADRUPLE_FINITE;
+    out.is_negative = is_negative;
+    return out;
+}
+/*  End of tmpl_UnpackedQuadruple_Round.                                      */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
+
+#endif
+/*  End of include guard.                                                     */
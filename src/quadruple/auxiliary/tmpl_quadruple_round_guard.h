@@ -0,0 +1,99 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                         tmpl_quadruple_round_guard                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Rounds a normalized 128-bit integer to 113 bits.                      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Quadruple_Round_Guard                                            *
+ *  Purpose:                                                                  *
+ *      Rounds (hi, lo), with bit 127 set, to its top 113 bits.               *
+ *  Arguments:                                                                *
+ *      hi (tmpl_UInt64 *):                                                   *
+ *          The high word of the number.                                      *
+ *      lo (tmpl_UInt64 *):                                                   *
+ *          The low word. Bit 0 is a sticky bit.                              *
+ *  Output:                                                                   *
+ *      carry (tmpl_Bool):                                                    *
+ *          True if rounding up carried into bit 113.                         *
+ *  Method:                                                                   *
+ *      The low 15 bits are the guard bits. Shift them out and round to       *
+ *      nearest, ties to even.                                                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing TMPL_STATIC_INLINE.                         *
+ *  2.) tmpl_quadruple_limbs.h:                                               *
+ *          Constants and typedefs for the limb routines.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_QUADRUPLE_ROUND_GUARD_H
+#define TMPL_QUADRUPLE_ROUND_GUARD_H
+
+/*  TMPL_STATIC_INLINE macro provided here.                                   */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  tmpl_UInt64 and the binary128 constants found here.                       */
+#include "tmpl_quadruple_limbs.h"
+
+/*  The limb routines need 64-bit integers.                                   */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  Below the 113 kept bits of a normalized 128-bit sig are 15 guard bits.    */
+#define TMPL_QUADRUPLE_GUARD_MASK (0x7FFFU)
+#define TMPL_QUADRUPLE_GUARD_HALF (0x4000U)
+
+/*  Rounds a normalized (leading bit 127) jammed 128-bit value at bit 15.     *
+ *  Returns true if the rounded value carried into bit 128.                   */
+TMPL_STATIC_INLINE
+tmpl_Bool
+tmpl_Quadruple_Round_Guard(tmpl_UInt64 *hi, tmpl_UInt64 *lo)
+{
+    const unsigned int guard = (unsigned int)(*lo & TMPL_QUADRUPLE_GUARD_MASK);
+
+    /*  Keep the top 113 bits.                                                */
+    *lo = (*lo >> 15) | (*hi << 49);
+    *hi >>= 15;
+
+    /*  Round to nearest, ties to even.                                       */
+    if (guard > TMPL_QUADRUPLE_GUARD_HALF ||
+        (guard == TMPL_QUADRUPLE_GUARD_HALF && (*lo & 1)))
+    {
+        ++*lo;
+        *hi += (*lo == 0);
+    }
+
+    /*  Rounding up 2^113 - 1 gives 2^113, and bit 49 of hi is then set.      */
+    return (tmpl_Bool)((*hi >> 49) != 0);
+}
+/*  End of tmpl_Quadruple_Round_Guard.                                        */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
+
+#endif
+/*  End of include guard.                                                     */
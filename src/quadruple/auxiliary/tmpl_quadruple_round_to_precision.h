@@ -0,0 +1,123 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                     tmpl_quadruple_round_to_precision                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Rounds quadruples to narrower binary formats.                         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_UnpackedQuadruple_Round_To_Precision                             *
+ *  Purpose:                                                                  *
+ *      Rounds a finite non-zero quadruple to a narrower binary format.       *
+ *  Arguments:                                                                *
+ *      x (const tmpl_UnpackedQuadruple * const):                             *
+ *          A finite non-zero number.                                         *
+ *      prec (signed long int):                                               *
+ *          The precision of the format, at most 113.                         *
+ *      emin (signed long int):                                               *
+ *          The exponent of the smallest normal number in the format.         *
+ *      hi (tmpl_UInt64 *):                                                   *
+ *          The high word of the rounded significand N.                       *
+ *      lo (tmpl_UInt64 *):                                                   *
+ *          The low word of N.                                                *
+ *  Output:                                                                   *
+ *      scale (signed long int):                                              *
+ *          The rounded value is N 2^scale. N may be zero.                    *
+ *  Method:                                                                   *
+ *      The same as tmpl_UnpackedQuadruple_Round, with the precision reduced  *
+ *      below emin so the result is rounded only once, even if it is          *
+ *      subnormal in the narrower format. The caller checks for overflow.     *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing TMPL_STATIC_INLINE.                         *
+ *  2.) tmpl_quadruple_limbs.h:                                               *
+ *          Constants and typedefs for the limb routines.                     *
+ *  3.) tmpl_quadruple_shift_left128.h:                                       *
+ *          Left shift of 128-bit integers.                                   *
+ *  4.) tmpl_quadruple_shift_right_jam128.h:                                  *
+ *          Jamming right shift of 128-bit integers.                          *
+ *  5.) tmpl_quadruple_round_guard.h:                                         *
+ *          Rounds the top 113 bits.                                          *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_QUADRUPLE_ROUND_TO_PRECISION_H
+#define TMPL_QUADRUPLE_ROUND_TO_PRECISION_H
+
+/*  TMPL_STATIC_INLINE macro provided here.                                   */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  tmpl_UInt64 and the binary128 constants found here.                       */
+#include "tmpl_quadruple_limbs.h"
+
+/*  128-bit shifts found here.                                                */
+#include "tmpl_quadruple_shift_left128.h"
+#include "tmpl_quadruple_shift_right_jam128.h"
+
+/*  tmpl_Quadruple_Round_Guard found here.                                    */
+#include "tmpl_quadruple_round_guard.h"
+
+/*  The limb routines need 64-bit integers.                                   */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  Rounds a finite non-zero quadruple to prec bits, returning N and scale.   */
+TMPL_STATIC_INLINE
+signed long int
+tmpl_UnpackedQuadruple_Round_To_Precision(
+    const tmpl_UnpackedQuadruple * const x,
+    signed long int prec,
+    signed long int emin,
+    tmpl_UInt64 *hi,
+    tmpl_UInt64 *lo
+)
+{
+    /*  Number of bits of the 113-bit significand that are discarded.         */
+    signed long int shift;
+
+    /*  Below emin the format has fewer bits.                                 */
+    if (x->expo < emin)
+        prec -= emin - x->expo;
+
+    shift = 113 - prec;
+
+    /*  Put the leading bit at 127 and shift out the discarded bits, so that  *
+     *  the guard bits are in the same place as in the binary128 rounding.    */
+    *hi = x->hi;
+    *lo = x->lo;
+    tmpl_Quadruple_Shift_Left128(hi, lo, 15);
+    tmpl_Quadruple_Shift_Right_Jam128(hi, lo, (unsigned long int)shift);
+
+    /*  A carry out of the top is still an exact integer, no fixing needed.   */
+    (void)tmpl_Quadruple_Round_Guard(hi, lo);
+    return x->expo - 112 + shift;
+}
+/*  End of tmpl_UnpackedQuadruple_Round_To_Precision.                         */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
+
+#endif
+/*  End of include guard.                                                     */
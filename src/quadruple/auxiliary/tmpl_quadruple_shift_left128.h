@@ -0,0 +1,91 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                        tmpl_quadruple_shift_left128                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Shifts a 128-bit integer left.                                        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Quadruple_Shift_Left128                                          *
+ *  Purpose:                                                                  *
+ *      Shifts (hi, lo) left. The caller ensures no 1 bits are lost.          *
+ *  Arguments:                                                                *
+ *      hi (tmpl_UInt64 *):                                                   *
+ *          The high word of the number.                                      *
+ *      lo (tmpl_UInt64 *):                                                   *
+ *          The low word of the number.                                       *
+ *      shift (unsigned long int):                                            *
+ *          The number of bits to shift by, less than 128.                    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing TMPL_STATIC_INLINE.                         *
+ *  2.) tmpl_quadruple_limbs.h:                                               *
+ *          Constants and typedefs for the limb routines.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_QUADRUPLE_SHIFT_LEFT128_H
+#define TMPL_QUADRUPLE_SHIFT_LEFT128_H
+
+/*  TMPL_STATIC_INLINE macro provided here.                                   */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  tmpl_UInt64 and the binary128 constants found here.                       */
+#include "tmpl_quadruple_limbs.h"
+
+/*  The limb routines need 64-bit integers.                                   */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  Shifts (hi, lo) left by shift < 128 bits.                                 */
+TMPL_STATIC_INLINE
+void
+tmpl_Quadruple_Shift_Left128(tmpl_UInt64 *hi, tmpl_UInt64 *lo,
+                             unsigned long int shift)
+{
+    if (shift == 0)
+        return;
+
+    if (shift < 64)
+    {
+        *hi = (*hi << shift) | (*lo >> (64 - shift));
+        *lo <<= shift;
+    }
+
+    else
+    {
+        *hi = *lo << (shift - 64);
+        *lo = 0;
+    }
+}
+/*  End of tmpl_Quadruple_Shift_Left128.                                      */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,94 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                        tmpl_quadruple_shift_left256                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Shifts a 256-bit integer left.                                        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Quadruple_Shift_Left256                                          *
+ *  Purpose:                                                                  *
+ *      Shifts x left. The caller ensures no 1 bits are lost.                 *
+ *  Arguments:                                                                *
+ *      x (tmpl_UInt64 * const):                                              *
+ *          Four limbs, least significant first.                              *
+ *      shift (unsigned long int):                                            *
+ *          The number of bits to shift by, less than 256.                    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing TMPL_STATIC_INLINE.                         *
+ *  2.) tmpl_quadruple_limbs.h:                                               *
+ *          Constants and typedefs for the limb routines.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_QUADRUPLE_SHIFT_LEFT256_H
+#define TMPL_QUADRUPLE_SHIFT_LEFT256_H
+
+/*  TMPL_STATIC_INLINE macro provided here.                                   */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  tmpl_UInt64 and the binary128 constants found here.                       */
+#include "tmpl_quadruple_limbs.h"
+
+/*  The limb routines need 64-bit integers.                                   */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  Shifts a 256-bit number left by shift < 256 bits.                         */
+TMPL_STATIC_INLINE
+void
+tmpl_Quadruple_Shift_Left256(tmpl_UInt64 * const x, unsigned long int shift)
+{
+    const unsigned int words = (unsigned int)(shift >> 6);
+    const unsigned long int bits = shift & 63;
+    unsigned int n;
+
+    if (shift == 0)
+        return;
+
+    for (n = 4; n-- > words;)
+        x[n] = x[n - words];
+
+    for (n = 0; n < words; ++n)
+        x[n] = 0;
+
+    if (bits)
+    {
+        for (n = 3; n > 0; --n)
+            x[n] = (x[n] << bits) | (x[n - 1] >> (64 - bits));
+
+        x[0] <<= bits;
+    }
+}
+/*  End of tmpl_Quadruple_Shift_Left256.                                      */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,111 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                     tmpl_quadruple_shift_right_jam128                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Shifts a 128-bit integer right, keeping a sticky bit.                 *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Quadruple_Shift_Right_Jam128                                     *
+ *  Purpose:                                                                  *
+ *      Shifts (hi, lo) right, setting the lowest bit if any 1 bits           *
+ *      were shifted out.                                                     *
+ *  Arguments:                                                                *
+ *      hi (tmpl_UInt64 *):                                                   *
+ *          The high word of the number.                                      *
+ *      lo (tmpl_UInt64 *):                                                   *
+ *          The low word of the number.                                       *
+ *      shift (unsigned long int):                                            *
+ *          The number of bits to shift by. Any value is allowed.             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      The bits shifted out only matter for rounding, and only through       *
+ *      whether any of them is set, so they are collapsed into the            *
+ *      lowest bit. This is the usual way of keeping a sticky bit.            *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing TMPL_STATIC_INLINE.                         *
+ *  2.) tmpl_quadruple_limbs.h:                                               *
+ *          Constants and typedefs for the limb routines.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_QUADRUPLE_SHIFT_RIGHT_JAM128_H
+#define TMPL_QUADRUPLE_SHIFT_RIGHT_JAM128_H
+
+/*  TMPL_STATIC_INLINE macro provided here.                                   */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  tmpl_UInt64 and the binary128 constants found here.                       */
+#include "tmpl_quadruple_limbs.h"
+
+/*  The limb routines need 64-bit integers.                                   */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  Shifts (hi, lo) right by shift bits, keeping a sticky bit.                */
+TMPL_STATIC_INLINE
+void
+tmpl_Quadruple_Shift_Right_Jam128(tmpl_UInt64 *hi, tmpl_UInt64 *lo,
+                                  unsigned long int shift)
+{
+    tmpl_UInt64 sticky;
+
+    if (shift == 0)
+        return;
+
+    if (shift < 64)
+    {
+        sticky = (*lo << (64 - shift)) != 0;
+        *lo = (*hi << (64 - shift)) | (*lo >> shift) | sticky;
+        *hi >>= shift;
+    }
+
+    else if (shift < 128)
+    {
+        /*  All of lo is shifted out, and the low shift - 64 bits of hi.      */
+        sticky = (*lo != 0);
+
+        if (shift > 64)
+            sticky |= ((*hi << (128 - shift)) != 0);
+
+        *lo = (*hi >> (shift - 64)) | sticky;
+        *hi = 0;
+    }
+
+    else
+    {
+        *lo = ((*hi | *lo) != 0);
+        *hi = 0;
+    }
+}
+/*  End of tmpl_Quadruple_Shift_Right_Jam128.                                 */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
+
+#endif
+/*  End of include guard.                                                     */
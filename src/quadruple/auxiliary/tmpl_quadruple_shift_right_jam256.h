@@ -0,0 +1,117 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                     tmpl_quadruple_shift_right_jam256                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Shifts a 256-bit integer right, keeping a sticky bit.                 *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Quadruple_Shift_Right_Jam256                                     *
+ *  Purpose:                                                                  *
+ *      Shifts x right, setting the lowest bit if any 1 bits were             *
+ *      shifted out.                                                          *
+ *  Arguments:                                                                *
+ *      x (tmpl_UInt64 * const):                                              *
+ *          Four limbs, least significant first.                              *
+ *      shift (unsigned long int):                                            *
+ *          The number of bits to shift by. Any value is allowed.             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Method:                                                                   *
+ *      Whole limbs are moved first, then the remaining bits. Every bit       *
+ *      shifted out is collapsed into the lowest bit.                         *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing TMPL_STATIC_INLINE.                         *
+ *  2.) tmpl_quadruple_limbs.h:                                               *
+ *          Constants and typedefs for the limb routines.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_QUADRUPLE_SHIFT_RIGHT_JAM256_H
+#define TMPL_QUADRUPLE_SHIFT_RIGHT_JAM256_H
+
+/*  TMPL_STATIC_INLINE macro provided here.                                   */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  tmpl_UInt64 and the binary128 constants found here.                       */
+#include "tmpl_quadruple_limbs.h"
+
+/*  The limb routines need 64-bit integers.                                   */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  Shifts a 256-bit number right, keeping a sticky bit.                      */
+TMPL_STATIC_INLINE
+void
+tmpl_Quadruple_Shift_Right_Jam256(tmpl_UInt64 * const x,
+                                  unsigned long int shift)
+{
+    tmpl_UInt64 sticky = 0;
+    unsigned long int words = shift >> 6;
+    unsigned long int bits = shift & 63;
+    unsigned int n;
+
+    if (shift == 0)
+        return;
+
+    if (shift >= 256)
+    {
+        sticky = ((x[0] | x[1] | x[2] | x[3]) != 0);
+        x[0] = sticky;
+        x[1] = x[2] = x[3] = 0;
+        return;
+    }
+
+    /*  Whole limbs that are shifted out only contribute to the sticky bit.   */
+    for (n = 0; n < words; ++n)
+        sticky |= x[n];
+
+    for (n = 0; n + words < 4; ++n)
+        x[n] = x[n + words];
+
+    for (; n < 4; ++n)
+        x[n] = 0;
+
+    /*  Shift by the remaining bits, less than a limb.                        */
+    if (bits)
+    {
+        sticky |= x[0] << (64 - bits);
+
+        for (n = 0; n < 3; ++n)
+            x[n] = (x[n] >> bits) | (x[n + 1] << (64 - bits));
+
+        x[3] >>= bits;
+    }
+
+    x[0] |= (sticky != 0);
+}
+/*  End of tmpl_Quadruple_Shift_Right_Jam256.                                 */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
+
+#endif
+/*  End of include guard.                                                     */
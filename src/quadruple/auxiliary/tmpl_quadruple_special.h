@@ -0,0 +1,83 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                           tmpl_quadruple_special                           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Creates a zero, infinity, or NaN.                                     *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_UnpackedQuadruple_Special                                        *
+ *  Purpose:                                                                  *
+ *      Creates a zero, infinity, or NaN with a given sign.                   *
+ *  Arguments:                                                                *
+ *      kind (tmpl_QuadrupleKind):                                            *
+ *          TMPL_QUADRUPLE_ZERO, TMPL_QUADRUPLE_INF, or                       *
+ *          TMPL_QUADRUPLE_NAN.                                               *
+ *      is_negative (tmpl_Bool):                                              *
+ *          The sign of the result.                                           *
+ *  Output:                                                                   *
+ *      out (tmpl_UnpackedQuadruple):                                         *
+ *          The special value.                                                *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing TMPL_STATIC_INLINE.                         *
+ *  2.) tmpl_quadruple_limbs.h:                                               *
+ *          Constants and typedefs for the limb routines.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_QUADRUPLE_SPECIAL_H
+#define TMPL_QUADRUPLE_SPECIAL_H
+
+/*  TMPL_STATIC_INLINE macro provided here.                                   */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  tmpl_UInt64 and the binary128 constants found here.                       */
+#include "tmpl_quadruple_limbs.h"
+
+/*  The limb routines need 64-bit integers.                                   */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  Creates a zero, infinity, or NaN.                                         */
+TMPL_STATIC_INLINE
+tmpl_UnpackedQuadruple
+tmpl_UnpackedQuadruple_Special(tmpl_QuadrupleKind kind, tmpl_Bool is_negative)
+{
+    tmpl_UnpackedQuadruple out;
+    out.hi = 0;
+    out.lo = 0;
+    out.expo = 0;
+    out.kind = kind;
+    out.is_negative = is_negative;
+    return out;
+}
+/*  End of tmpl_UnpackedQuadruple_Special.                                    */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
+
+#endif
+/*  End of include guard.                                                     */
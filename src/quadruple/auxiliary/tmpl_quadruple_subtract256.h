@@ -0,0 +1,85 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                         tmpl_quadruple_subtract256                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Subtracts two 256-bit integers.                                       *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Quadruple_Subtract256                                            *
+ *  Purpose:                                                                  *
+ *      Computes x -= y. The caller ensures x >= y.                           *
+ *  Arguments:                                                                *
+ *      x (tmpl_UInt64 * const):                                              *
+ *          Four limbs, least significant first. The difference is            *
+ *          stored here.                                                      *
+ *      y (const tmpl_UInt64 * const):                                        *
+ *          Four limbs, least significant first.                              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file providing TMPL_STATIC_INLINE.                         *
+ *  2.) tmpl_quadruple_limbs.h:                                               *
+ *          Constants and typedefs for the limb routines.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_QUADRUPLE_SUBTRACT256_H
+#define TMPL_QUADRUPLE_SUBTRACT256_H
+
+/*  TMPL_STATIC_INLINE macro provided here.                                   */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  tmpl_UInt64 and the binary128 constants found here.                       */
+#include "tmpl_quadruple_limbs.h"
+
+/*  The limb routines need 64-bit integers.                                   */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  Computes x -= y for 256-bit numbers with x >= y.                          */
+TMPL_STATIC_INLINE
+void
+tmpl_Quadruple_Subtract256(tmpl_UInt64 * const x, const tmpl_UInt64 * const y)
+{
+    tmpl_UInt64 borrow = 0;
+    unsigned int n;
+
+    for (n = 0; n < 4; ++n)
+    {
+        const tmpl_UInt64 diff = x[n] - y[n];
+        const tmpl_UInt64 out = diff - borrow;
+        borrow = (x[n] < y[n]) | (diff < borrow);
+        x[n] = out;
+    }
+}
+/*  End of tmpl_Quadruple_Subtract256.                                        */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
+
+#endif
+/*  End of include guard.                                                     */
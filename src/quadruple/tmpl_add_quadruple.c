@@ -0,0 +1,231 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                             tmpl_add_quadruple                             *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Adds and subtracts quadruple precision numbers.                       *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_UnpackedQuadruple_Add                                            *
+ *      tmpl_UnpackedQuadruple_Subtract                                       *
+ *      tmpl_Quadruple_Add                                                    *
+ *      tmpl_Quadruple_Subtract                                               *
+ *  Purpose:                                                                  *
+ *      Computes x + y, or x - y, correctly rounded.                          *
+ *  Arguments:                                                                *
+ *      x (const tmpl_UnpackedQuadruple * const):                             *
+ *          A number.                                                         *
+ *      y (const tmpl_UnpackedQuadruple * const):                             *
+ *          Another number.                                                   *
+ *  Output:                                                                   *
+ *      sum (tmpl_UnpackedQuadruple):                                         *
+ *          The sum or difference of x and y.                                 *
+ *  Called Functions:                                                         *
+ *      src/quadruple/auxiliary/tmpl_quadruple_round.h:                       *
+ *          tmpl_UnpackedQuadruple_Round:                                     *
+ *              Rounds the exact result to binary128.                         *
+ *  Method:                                                                   *
+ *      Subtraction is addition with the sign of y flipped. Order the inputs  *
+ *      by magnitude and move both significands up by 13 bits, giving guard   *
+ *      bits below them and room for a carry above. Shift the smaller one     *
+ *      right by the difference of the exponents, jamming the bits that are   *
+ *      shifted out into a sticky bit. Add or subtract, and round. When the   *
+ *      exponents differ by 2 or more at most one bit cancels, so the sticky  *
+ *      bit stays far below the rounding position. When they differ by less   *
+ *      the shift is exact.                                                   *
+ *  Notes:                                                                    *
+ *      1.) An exact zero result is +0, unless both inputs are -0.            *
+ *                                                                            *
+ *      2.) The tmpl_Quadruple versions unpack, call these, and pack.         *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_quadruple.h:                                                     *
+ *          Header file where the function prototypes are given.              *
+ *  2.) tmpl_quadruple_shift_left128.h:                                       *
+ *          Left shift of 128-bit integers.                                   *
+ *  3.) tmpl_quadruple_shift_right_jam128.h:                                  *
+ *          Jamming right shift of 128-bit integers.                          *
+ *  4.) tmpl_quadruple_round.h:                                               *
+ *          Rounding to binary128.                                            *
+ *  5.) tmpl_quadruple_special.h:                                             *
+ *          Creates zeros, infinities, and NaN.                               *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes and typedefs given here.                              */
+#include <libtmpl/include/tmpl_quadruple.h>
+
+/*  The unpacked form needs 64-bit integers.                                  */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  128-bit shifts found here.                                                */
+#include "auxiliary/tmpl_quadruple_shift_left128.h"
+#include "auxiliary/tmpl_quadruple_shift_right_jam128.h"
+
+/*  tmpl_UnpackedQuadruple_Round and special values found here.               */
+#include "auxiliary/tmpl_quadruple_round.h"
+#include "auxiliary/tmpl_quadruple_special.h"
+
+/*  Computes x + (-1)^y_negative |y|.                                         */
+static tmpl_UnpackedQuadruple
+tmpl_unpacked_quadruple_signed_add(const tmpl_UnpackedQuadruple * const x,
+                                   const tmpl_UnpackedQuadruple * const y,
+                                   tmpl_Bool y_negative)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    const tmpl_UnpackedQuadruple *big, *small;
+    tmpl_Bool big_negative, small_negative;
+    tmpl_UInt64 big_hi, big_lo, small_hi, small_lo, hi, lo;
+    tmpl_UnpackedQuadruple out;
+
+    /*  Special cases first. NaN in gives NaN out, as does inf - inf.         */
+    if (x->kind == TMPL_QUADRUPLE_NAN || y->kind == TMPL_QUADRUPLE_NAN)
+        return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_NAN, tmpl_False);
+
+    if (x->kind == TMPL_QUADRUPLE_INF)
+    {
+        if (y->kind == TMPL_QUADRUPLE_INF && y_negative != x->is_negative)
+            return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_NAN,
+                                                  tmpl_False);
+
+        return *x;
+    }
+
+    if (y->kind == TMPL_QUADRUPLE_INF)
+        return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_INF, y_negative);
+
+    /*  Adding zero. The sum of two zeros is -0 only if both are -0.          */
+    if (y->kind == TMPL_QUADRUPLE_ZERO)
+    {
+        if (x->kind == TMPL_QUADRUPLE_ZERO)
+            return tmpl_UnpackedQuadruple_Special(
+                TMPL_QUADRUPLE_ZERO, (tmpl_Bool)(x->is_negative && y_negative)
+            );
+
+        return *x;
+    }
+
+    if (x->kind == TMPL_QUADRUPLE_ZERO)
+    {
+        out = *y;
+        out.is_negative = y_negative;
+        return out;
+    }
+
+    /*  Order the inputs by magnitude.                                        */
+    if (x->expo > y->expo || (x->expo == y->expo &&
+        (x->hi > y->hi || (x->hi == y->hi && x->lo >= y->lo))))
+    {
+        big = x;
+        small = y;
+        big_negative = x->is_negative;
+        small_negative = y_negative;
+    }
+
+    else
+    {
+        big = y;
+        small = x;
+        big_negative = y_negative;
+        small_negative = x->is_negative;
+    }
+
+    /*  Move the leading bits from 112 up to 125.                             */
+    big_hi = big->hi;
+    big_lo = big->lo;
+    small_hi = small->hi;
+    small_lo = small->lo;
+    tmpl_Quadruple_Shift_Left128(&big_hi, &big_lo, 13);
+    tmpl_Quadruple_Shift_Left128(&small_hi, &small_lo, 13);
+
+    /*  Align the smaller number with the larger one.                         */
+    tmpl_Quadruple_Shift_Right_Jam128(
+        &small_hi, &small_lo, (unsigned long int)(big->expo - small->expo)
+    );
+
+    /*  The leading bit is at 125, so the sum is less than 2^127.             */
+    if (big_negative == small_negative)
+    {
+        lo = big_lo + small_lo;
+        hi = big_hi + small_hi + (lo < big_lo);
+    }
+
+    else
+    {
+        lo = big_lo - small_lo;
+        hi = big_hi - small_hi - (big_lo < small_lo);
+
+        /*  x = -y exactly. The sum is +0 when rounding to nearest.           */
+        if (!(hi | lo))
+            return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_ZERO,
+                                                  tmpl_False);
+    }
+
+    /*  Bit 125 has the exponent of big, so bit 127 has this plus 2.          */
+    return tmpl_UnpackedQuadruple_Round(big_negative, big->expo + 2, hi, lo);
+}
+/*  End of tmpl_unpacked_quadruple_signed_add.                                */
+
+/*  Function for adding two unpacked numbers.                                 */
+tmpl_UnpackedQuadruple
+tmpl_UnpackedQuadruple_Add(const tmpl_UnpackedQuadruple * const x,
+                           const tmpl_UnpackedQuadruple * const y)
+{
+    return tmpl_unpacked_quadruple_signed_add(x, y, y->is_negative);
+}
+/*  End of tmpl_UnpackedQuadruple_Add.                                        */
+
+/*  Function for subtracting two unpacked numbers.                            */
+tmpl_UnpackedQuadruple
+tmpl_UnpackedQuadruple_Subtract(const tmpl_UnpackedQuadruple * const x,
+                                const tmpl_UnpackedQuadruple * const y)
+{
+    return tmpl_unpacked_quadruple_signed_add(x, y, !y->is_negative);
+}
+/*  End of tmpl_UnpackedQuadruple_Subtract.                                   */
+
+/*  Function for adding two quadruples.                                       */
+tmpl_Quadruple tmpl_Quadruple_Add(tmpl_Quadruple x, tmpl_Quadruple y)
+{
+    const tmpl_UnpackedQuadruple ux = tmpl_Quadruple_Unpack(x);
+    const tmpl_UnpackedQuadruple uy = tmpl_Quadruple_Unpack(y);
+    const tmpl_UnpackedQuadruple sum = tmpl_UnpackedQuadruple_Add(&ux, &uy);
+    return tmpl_Quadruple_Pack(&sum);
+}
+/*  End of tmpl_Quadruple_Add.                                                */
+
+/*  Function for subtracting two quadruples.                                  */
+tmpl_Quadruple tmpl_Quadruple_Subtract(tmpl_Quadruple x, tmpl_Quadruple y)
+{
+    const tmpl_UnpackedQuadruple ux = tmpl_Quadruple_Unpack(x);
+    const tmpl_UnpackedQuadruple uy = tmpl_Quadruple_Unpack(y);
+    const tmpl_UnpackedQuadruple diff =
+        tmpl_UnpackedQuadruple_Subtract(&ux, &uy);
+
+    return tmpl_Quadruple_Pack(&diff);
+}
+/*  End of tmpl_Quadruple_Subtract.                                           */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
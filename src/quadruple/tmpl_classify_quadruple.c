@@ -0,0 +1,117 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                          tmpl_classify_quadruple                           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Classifies quadruple precision numbers.                               *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Quadruple_Is_Zero                                                *
+ *      tmpl_Quadruple_Is_Inf                                                 *
+ *      tmpl_Quadruple_Is_NaN                                                 *
+ *      tmpl_Quadruple_Is_Positive                                            *
+ *      tmpl_Quadruple_Is_Negative                                            *
+ *  Purpose:                                                                  *
+ *      Determines if x is zero, infinite, NaN, positive, or negative.        *
+ *  Arguments:                                                                *
+ *      x (tmpl_Quadruple):                                                   *
+ *          A number.                                                         *
+ *  Output:                                                                   *
+ *      is_kind (tmpl_Bool):                                                  *
+ *          True if x is of the given kind.                                   *
+ *  Method:                                                                   *
+ *      Examine the bit-fields. All exponent bits set is infinity if the      *
+ *      mantissa is zero, and NaN otherwise. A zero exponent and mantissa is  *
+ *      zero. Positive and negative look at the sign bit, excluding NaN.      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_quadruple.h:                                                     *
+ *          Header file where the function prototypes are given.              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes and typedefs given here.                              */
+#include <libtmpl/include/tmpl_quadruple.h>
+
+/*  All exponent bits set means infinity or NaN.                              */
+#define TMPL_QUADRUPLE_NANINF_EXP (0x7FFFU)
+
+/*  Checks if any of the mantissa bits are set.                               */
+#define TMPL_QUADRUPLE_MANTISSA_IS_ZERO(x)                                     \
+    (!((x).mant1 | (x).mant2 | (x).mant3 | (x).mant4 |                         \
+       (x).mant5 | (x).mant6 | (x).mant7))
+
+/*  Function for determining if a quadruple is zero.                          */
+tmpl_Bool tmpl_Quadruple_Is_Zero(tmpl_Quadruple x)
+{
+    if (x.exponent != 0)
+        return tmpl_False;
+
+    return (tmpl_Bool)TMPL_QUADRUPLE_MANTISSA_IS_ZERO(x);
+}
+/*  End of tmpl_Quadruple_Is_Zero.                                            */
+
+/*  Function for determining if a quadruple is infinite.                      */
+tmpl_Bool tmpl_Quadruple_Is_Inf(tmpl_Quadruple x)
+{
+    if (x.exponent != TMPL_QUADRUPLE_NANINF_EXP)
+        return tmpl_False;
+
+    return (tmpl_Bool)TMPL_QUADRUPLE_MANTISSA_IS_ZERO(x);
+}
+/*  End of tmpl_Quadruple_Is_Inf.                                             */
+
+/*  Function for determining if a quadruple is Not-a-Number.                  */
+tmpl_Bool tmpl_Quadruple_Is_NaN(tmpl_Quadruple x)
+{
+    if (x.exponent != TMPL_QUADRUPLE_NANINF_EXP)
+        return tmpl_False;
+
+    return (tmpl_Bool)!TMPL_QUADRUPLE_MANTISSA_IS_ZERO(x);
+}
+/*  End of tmpl_Quadruple_Is_NaN.                                             */
+
+/*  Function for determining if the sign bit of a quadruple is unset.         */
+tmpl_Bool tmpl_Quadruple_Is_Positive(tmpl_Quadruple x)
+{
+    if (tmpl_Quadruple_Is_NaN(x))
+        return tmpl_False;
+
+    return (tmpl_Bool)(x.sign == 0);
+}
+/*  End of tmpl_Quadruple_Is_Positive.                                        */
+
+/*  Function for determining if the sign bit of a quadruple is set.           */
+tmpl_Bool tmpl_Quadruple_Is_Negative(tmpl_Quadruple x)
+{
+    if (tmpl_Quadruple_Is_NaN(x))
+        return tmpl_False;
+
+    return (tmpl_Bool)(x.sign == 1);
+}
+/*  End of tmpl_Quadruple_Is_Negative.                                        */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_QUADRUPLE_NANINF_EXP
+#undef TMPL_QUADRUPLE_MANTISSA_IS_ZERO
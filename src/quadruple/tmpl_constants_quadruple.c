@@ -0,0 +1,42 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                          tmpl_constants_quadruple                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides infinity and NaN in quadruple precision.                     *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_quadruple.h:                                                     *
+ *          Header file where the constants are declared.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Constants declared here.                                                  */
+#include <libtmpl/include/tmpl_quadruple.h>
+
+/*  The bit-fields are, in order, mant1 to mant7, the exponent, and the sign. *
+ *  Infinity has all exponent bits set and a zero mantissa.                   */
+const tmpl_Quadruple tmpl_Quadruple_Inf = {0, 0, 0, 0, 0, 0, 0, 0x7FFF, 0};
+const tmpl_Quadruple tmpl_Quadruple_Neg_Inf = {0, 0, 0, 0, 0, 0, 0, 0x7FFF, 1};
+
+/*  The default quiet NaN sets the highest mantissa bit.                      */
+const tmpl_Quadruple tmpl_Quadruple_NaN = {0, 0, 0, 0, 0, 0, 0x8000, 0x7FFF, 0};
@@ -0,0 +1,221 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                           tmpl_divide_quadruple                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Divides quadruple precision numbers.                                  *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_UnpackedQuadruple_Divide                                         *
+ *      tmpl_Quadruple_Divide                                                 *
+ *  Purpose:                                                                  *
+ *      Computes x / y, correctly rounded.                                    *
+ *  Arguments:                                                                *
+ *      x (const tmpl_UnpackedQuadruple * const):                             *
+ *          The numerator.                                                    *
+ *      y (const tmpl_UnpackedQuadruple * const):                             *
+ *          The denominator.                                                  *
+ *  Output:                                                                   *
+ *      quot (tmpl_UnpackedQuadruple):                                        *
+ *          The quotient x / y.                                               *
+ *  Called Functions:                                                         *
+ *      src/quadruple/auxiliary/tmpl_quadruple_round.h:                       *
+ *          tmpl_UnpackedQuadruple_Round:                                     *
+ *              Rounds the exact result to binary128.                         *
+ *  Method:                                                                   *
+ *      Let a and b be the 113-bit significands. Compute q = a 2^116 / b and  *
+ *      the remainder using Knuth's Algorithm D (The Art of Computer          *
+ *      Programming, Vol. 2, 4.3.1) on 32-bit digits. The divisor is b 2^15,  *
+ *      whose top bit is already set, so no normalization step is needed.     *
+ *      Since 1/2 < a / b < 2, q has 116 or 117 bits, which is more than      *
+ *      enough to round once the remainder is jammed into a sticky bit.       *
+ *  Notes:                                                                    *
+ *      1.) 0 / 0 and inf / inf are NaN. x / 0 is a signed infinity.          *
+ *                                                                            *
+ *      2.) 32-bit digits keep all of the intermediate products within 64     *
+ *          bits, so no 128-bit type is needed here.                          *
+ *                                                                            *
+ *      3.) The tmpl_Quadruple version unpacks, calls this, and packs.        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_quadruple.h:                                                     *
+ *          Header file where the function prototypes are given.              *
+ *  2.) tmpl_quadruple_limbs.h:                                               *
+ *          Binary128 constants and typedefs.                                 *
+ *  3.) tmpl_quadruple_shift_left128.h:                                       *
+ *          Left shift of 128-bit integers.                                   *
+ *  4.) tmpl_quadruple_round.h:                                               *
+ *          Rounding to binary128.                                            *
+ *  5.) tmpl_quadruple_special.h:                                             *
+ *          Creates zeros, infinities, and NaN.                               *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes and typedefs given here.                              */
+#include <libtmpl/include/tmpl_quadruple.h>
+
+/*  The unpacked form needs 64-bit integers.                                  */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  TMPL_QUADRUPLE_LOW32 and shifts found here.                               */
+#include "auxiliary/tmpl_quadruple_limbs.h"
+#include "auxiliary/tmpl_quadruple_shift_left128.h"
+
+/*  tmpl_UnpackedQuadruple_Round and special values found here.               */
+#include "auxiliary/tmpl_quadruple_round.h"
+#include "auxiliary/tmpl_quadruple_special.h"
+
+/*  The base of the digits used in the long division.                         */
+#define TMPL_QUADRUPLE_DIGIT_BASE ((tmpl_UInt64)1 << 32)
+
+/*  Function for dividing two unpacked numbers.                               */
+tmpl_UnpackedQuadruple
+tmpl_UnpackedQuadruple_Divide(const tmpl_UnpackedQuadruple * const x,
+                              const tmpl_UnpackedQuadruple * const y)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_UInt64 u[9], v[4], q[5], a_hi, a_lo, b_hi, b_lo, sticky;
+    unsigned int i, j;
+    const tmpl_Bool is_negative = (tmpl_Bool)(x->is_negative != y->is_negative);
+
+    /*  Special cases. NaN in gives NaN out, as do 0 / 0 and inf / inf.       */
+    if (x->kind == TMPL_QUADRUPLE_NAN || y->kind == TMPL_QUADRUPLE_NAN)
+        return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_NAN, tmpl_False);
+
+    if (x->kind == y->kind && x->kind != TMPL_QUADRUPLE_FINITE)
+        return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_NAN, tmpl_False);
+
+    if (x->kind == TMPL_QUADRUPLE_INF || y->kind == TMPL_QUADRUPLE_ZERO)
+        return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_INF, is_negative);
+
+    if (x->kind == TMPL_QUADRUPLE_ZERO || y->kind == TMPL_QUADRUPLE_INF)
+        return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_ZERO, is_negative);
+
+    /*  The dividend is a 2^131, whose top half is a 2^3.                     */
+    a_hi = x->hi;
+    a_lo = x->lo;
+    tmpl_Quadruple_Shift_Left128(&a_hi, &a_lo, 3);
+
+    /*  The divisor is b 2^15, putting the leading bit at 127.                */
+    b_hi = y->hi;
+    b_lo = y->lo;
+    tmpl_Quadruple_Shift_Left128(&b_hi, &b_lo, 15);
+
+    /*  Split into 32-bit digits, least significant first.                    */
+    u[0] = u[1] = u[2] = u[3] = u[8] = 0;
+    u[4] = a_lo & TMPL_QUADRUPLE_LOW32;
+    u[5] = a_lo >> 32;
+    u[6] = a_hi & TMPL_QUADRUPLE_LOW32;
+    u[7] = a_hi >> 32;
+
+    v[0] = b_lo & TMPL_QUADRUPLE_LOW32;
+    v[1] = b_lo >> 32;
+    v[2] = b_hi & TMPL_QUADRUPLE_LOW32;
+    v[3] = b_hi >> 32;
+
+    /*  Compute the quotient one digit at a time, from the top down.          */
+    for (j = 5; j > 0; --j)
+    {
+        const unsigned int k = j - 1;
+        const tmpl_UInt64 num = (u[k + 4] << 32) | u[k + 3];
+        tmpl_UInt64 qhat, rhat, carry, borrow, diff;
+
+        /*  Estimate the quotient digit from the leading digits.              */
+        qhat = num / v[3];
+        rhat = num % v[3];
+
+        /*  Correct the estimate with the second digit of the divisor.        */
+        while (qhat >= TMPL_QUADRUPLE_DIGIT_BASE ||
+               qhat * v[2] > ((rhat << 32) | u[k + 2]))
+        {
+            --qhat;
+            rhat += v[3];
+
+            if (rhat >= TMPL_QUADRUPLE_DIGIT_BASE)
+                break;
+        }
+
+        /*  Subtract qhat times the divisor from the running remainder.       */
+        carry = 0;
+        borrow = 0;
+
+        for (i = 0; i < 4; ++i)
+        {
+            const tmpl_UInt64 prod = qhat * v[i] + carry;
+            carry = prod >> 32;
+            diff = u[k + i] - (prod & TMPL_QUADRUPLE_LOW32) - borrow;
+            u[k + i] = diff & TMPL_QUADRUPLE_LOW32;
+            borrow = (diff >> 32) & 1U;
+        }
+
+        carry += borrow;
+        borrow = (u[k + 4] < carry);
+        u[k + 4] = (u[k + 4] - carry) & TMPL_QUADRUPLE_LOW32;
+
+        /*  The estimate was one too large. Add the divisor back.             */
+        if (borrow)
+        {
+            --qhat;
+            carry = 0;
+
+            for (i = 0; i < 4; ++i)
+            {
+                carry += u[k + i] + v[i];
+                u[k + i] = carry & TMPL_QUADRUPLE_LOW32;
+                carry >>= 32;
+            }
+
+            u[k + 4] = (u[k + 4] + carry) & TMPL_QUADRUPLE_LOW32;
+        }
+
+        q[k] = qhat;
+    }
+
+    /*  The remainder is in the bottom four digits of u.                      */
+    sticky = ((u[0] | u[1] | u[2] | u[3]) != 0);
+
+    /*  q < 2^117, so q[4] is zero and q fits in 128 bits. The quotient is    *
+     *  q 2^(x->expo - y->expo - 116).                                        */
+    return tmpl_UnpackedQuadruple_Round(
+        is_negative, x->expo - y->expo + 11,
+        (q[3] << 32) | q[2], (q[1] << 32) | q[0] | sticky
+    );
+}
+/*  End of tmpl_UnpackedQuadruple_Divide.                                     */
+
+/*  Function for dividing two quadruples.                                     */
+tmpl_Quadruple tmpl_Quadruple_Divide(tmpl_Quadruple x, tmpl_Quadruple y)
+{
+    const tmpl_UnpackedQuadruple ux = tmpl_Quadruple_Unpack(x);
+    const tmpl_UnpackedQuadruple uy = tmpl_Quadruple_Unpack(y);
+    const tmpl_UnpackedQuadruple quot = tmpl_UnpackedQuadruple_Divide(&ux, &uy);
+    return tmpl_Quadruple_Pack(&quot);
+}
+/*  End of tmpl_Quadruple_Divide.                                             */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_QUADRUPLE_DIGIT_BASE
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
@@ -0,0 +1,274 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                             tmpl_fma_quadruple                             *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes fused multiply-adds of quadruple precision numbers.          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_UnpackedQuadruple_FMA                                            *
+ *      tmpl_Quadruple_FMA                                                    *
+ *  Purpose:                                                                  *
+ *      Computes x * y + z with a single rounding.                            *
+ *  Arguments:                                                                *
+ *      x (const tmpl_UnpackedQuadruple * const):                             *
+ *          A number.                                                         *
+ *      y (const tmpl_UnpackedQuadruple * const):                             *
+ *          Another number, multiplied with x.                                *
+ *      z (const tmpl_UnpackedQuadruple * const):                             *
+ *          The number added to the product.                                  *
+ *  Output:                                                                   *
+ *      fma (tmpl_UnpackedQuadruple):                                         *
+ *          The correctly rounded value of x * y + z.                         *
+ *  Called Functions:                                                         *
+ *      src/quadruple/auxiliary/tmpl_quadruple_mul128.h:                      *
+ *          tmpl_Quadruple_Mul128:                                            *
+ *              Computes the full 256-bit product of the significands.        *
+ *      src/quadruple/auxiliary/tmpl_quadruple_round.h:                       *
+ *          tmpl_UnpackedQuadruple_Round:                                     *
+ *              Rounds the exact result to binary128.                         *
+ *      src/quadruple/tmpl_multiply_quadruple.c:                              *
+ *          tmpl_UnpackedQuadruple_Multiply:                                  *
+ *              Used when z is zero.                                          *
+ *  Method:                                                                   *
+ *      Compute the exact 226-bit product with leading bit at 252 or 253 of   *
+ *      a 256-bit number, and move the significand of z so that its leading   *
+ *      bit is at 253. Both are now integers times a power of two. Shift the  *
+ *      one with the smaller scale right, jamming the lost bits. Bits are     *
+ *      only lost when the two leading bits are far apart, so at most one     *
+ *      bit cancels and the sticky bit stays below the rounding position.     *
+ *      Add or subtract, normalize, and round the top 128 bits with the rest  *
+ *      jammed into a sticky bit.                                             *
+ *  Notes:                                                                    *
+ *      1.) inf * 0 + z is NaN, as is inf - inf.                              *
+ *                                                                            *
+ *      2.) An exact zero result is +0, unless x * y and z are both -0.       *
+ *                                                                            *
+ *      3.) The tmpl_Quadruple version unpacks, calls this, and packs.        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_quadruple.h:                                                     *
+ *          Header file where the function prototypes are given.              *
+ *  2.) tmpl_quadruple_add256.h:                                              *
+ *          Sum of 256-bit integers.                                          *
+ *  3.) tmpl_quadruple_subtract256.h:                                         *
+ *          Difference of 256-bit integers.                                   *
+ *  4.) tmpl_quadruple_compare256.h:                                          *
+ *          Comparison of 256-bit integers.                                   *
+ *  5.) tmpl_quadruple_mul128.h:                                              *
+ *          Full 256-bit product of 128-bit integers.                         *
+ *  6.) tmpl_quadruple_clz64.h:                                               *
+ *          Counts leading zeros.                                             *
+ *  7.) tmpl_quadruple_shift_left128.h:                                       *
+ *          Left shift of 128-bit integers.                                   *
+ *  8.) tmpl_quadruple_shift_left256.h:                                       *
+ *          Left shift of 256-bit integers.                                   *
+ *  9.) tmpl_quadruple_shift_right_jam256.h:                                  *
+ *          Jamming right shift of 256-bit integers.                          *
+ *  10.) tmpl_quadruple_round.h:                                              *
+ *          Rounding to binary128.                                            *
+ *  11.) tmpl_quadruple_special.h:                                            *
+ *          Creates zeros, infinities, and NaN.                               *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes and typedefs given here.                              */
+#include <libtmpl/include/tmpl_quadruple.h>
+
+/*  The unpacked form needs 64-bit integers.                                  */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  256-bit integer arithmetic found here.                                    */
+#include "auxiliary/tmpl_quadruple_add256.h"
+#include "auxiliary/tmpl_quadruple_subtract256.h"
+#include "auxiliary/tmpl_quadruple_compare256.h"
+#include "auxiliary/tmpl_quadruple_mul128.h"
+
+/*  Shifts and leading zeros found here.                                      */
+#include "auxiliary/tmpl_quadruple_clz64.h"
+#include "auxiliary/tmpl_quadruple_shift_left128.h"
+#include "auxiliary/tmpl_quadruple_shift_left256.h"
+#include "auxiliary/tmpl_quadruple_shift_right_jam256.h"
+
+/*  tmpl_UnpackedQuadruple_Round and special values found here.               */
+#include "auxiliary/tmpl_quadruple_round.h"
+#include "auxiliary/tmpl_quadruple_special.h"
+
+/*  Function for computing x * y + z with one rounding.                       */
+tmpl_UnpackedQuadruple
+tmpl_UnpackedQuadruple_FMA(const tmpl_UnpackedQuadruple * const x,
+                           const tmpl_UnpackedQuadruple * const y,
+                           const tmpl_UnpackedQuadruple * const z)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_UInt64 x_hi, x_lo, y_hi, y_lo, prod[4], addend[4];
+    tmpl_UInt64 *big, *small;
+    tmpl_Bool big_negative;
+    signed long int prod_expo, expo;
+    unsigned int top;
+    int shift;
+    const tmpl_Bool prod_negative =
+        (tmpl_Bool)(x->is_negative != y->is_negative);
+
+    /*  Special cases. NaN in gives NaN out.                                  */
+    if (x->kind == TMPL_QUADRUPLE_NAN || y->kind == TMPL_QUADRUPLE_NAN ||
+        z->kind == TMPL_QUADRUPLE_NAN)
+        return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_NAN, tmpl_False);
+
+    /*  An infinite product, which is NaN for inf * 0 or inf - inf.           */
+    if (x->kind == TMPL_QUADRUPLE_INF || y->kind == TMPL_QUADRUPLE_INF)
+    {
+        if (x->kind == TMPL_QUADRUPLE_ZERO || y->kind == TMPL_QUADRUPLE_ZERO)
+            return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_NAN,
+                                                  tmpl_False);
+
+        if (z->kind == TMPL_QUADRUPLE_INF && z->is_negative != prod_negative)
+            return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_NAN,
+                                                  tmpl_False);
+
+        return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_INF,
+                                              prod_negative);
+    }
+
+    /*  The product is finite, so an infinite z is the answer.                */
+    if (z->kind == TMPL_QUADRUPLE_INF)
+        return *z;
+
+    /*  A zero product. The sum of two zeros is -0 only if both are -0.       */
+    if (x->kind == TMPL_QUADRUPLE_ZERO || y->kind == TMPL_QUADRUPLE_ZERO)
+    {
+        if (z->kind == TMPL_QUADRUPLE_ZERO)
+            return tmpl_UnpackedQuadruple_Special(
+                TMPL_QUADRUPLE_ZERO,
+                (tmpl_Bool)(prod_negative && z->is_negative)
+            );
+
+        return *z;
+    }
+
+    /*  Adding zero to a non-zero product changes nothing, even if the        *
+     *  product underflows, so this is a single rounded multiplication.       */
+    if (z->kind == TMPL_QUADRUPLE_ZERO)
+        return tmpl_UnpackedQuadruple_Multiply(x, y);
+
+    /*  Leading bits at 127 and 126, so the product leads at 252 or 253 and   *
+     *  is prod 2^(x->expo + y->expo - 253).                                  */
+    x_hi = x->hi;
+    x_lo = x->lo;
+    y_hi = y->hi;
+    y_lo = y->lo;
+    tmpl_Quadruple_Shift_Left128(&x_hi, &x_lo, 15);
+    tmpl_Quadruple_Shift_Left128(&y_hi, &y_lo, 14);
+    tmpl_Quadruple_Mul128(x_hi, x_lo, y_hi, y_lo, prod);
+    prod_expo = x->expo + y->expo;
+
+    /*  z with its leading bit at 253, which is addend 2^(z->expo - 253).     */
+    addend[0] = addend[1] = 0;
+    addend[2] = z->lo;
+    addend[3] = z->hi;
+    tmpl_Quadruple_Shift_Left256(addend, 13);
+
+    /*  Align the two numbers, shifting the one with the smaller scale.       */
+    if (prod_expo >= z->expo)
+    {
+        const signed long int diff = prod_expo - z->expo;
+        tmpl_Quadruple_Shift_Right_Jam256(addend, (unsigned long int)diff);
+        expo = prod_expo;
+    }
+
+    else
+    {
+        const signed long int diff = z->expo - prod_expo;
+        tmpl_Quadruple_Shift_Right_Jam256(prod, (unsigned long int)diff);
+        expo = z->expo;
+    }
+
+    /*  Both numbers are below 2^254, so the sum fits in 256 bits.            */
+    if (prod_negative == z->is_negative)
+    {
+        tmpl_Quadruple_Add256(prod, addend);
+        big = prod;
+        big_negative = prod_negative;
+    }
+
+    else
+    {
+        const int cmp = tmpl_Quadruple_Compare256(prod, addend);
+
+        /*  x * y = -z exactly. The sum is +0 when rounding to nearest.       */
+        if (cmp == 0)
+            return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_ZERO,
+                                                  tmpl_False);
+
+        if (cmp > 0)
+        {
+            big = prod;
+            small = addend;
+            big_negative = prod_negative;
+        }
+
+        else
+        {
+            big = addend;
+            small = prod;
+            big_negative = z->is_negative;
+        }
+
+        tmpl_Quadruple_Subtract256(big, small);
+    }
+
+    /*  Find the leading bit and move it to bit 255. This is exact.           */
+    top = 3U;
+
+    while (!big[top])
+        --top;
+
+    shift = 64 * (3 - (int)top) + tmpl_Quadruple_CLZ64(big[top]);
+    tmpl_Quadruple_Shift_Left256(big, (unsigned long int)shift);
+
+    /*  The top half, with the rest jammed, is big 2^(expo - shift - 125).    */
+    big[2] |= ((big[1] | big[0]) != 0);
+
+    return tmpl_UnpackedQuadruple_Round(
+        big_negative, expo - shift + 2L, big[3], big[2]
+    );
+}
+/*  End of tmpl_UnpackedQuadruple_FMA.                                        */
+
+/*  Function for computing x * y + z with one rounding for quadruples.        */
+tmpl_Quadruple
+tmpl_Quadruple_FMA(tmpl_Quadruple x, tmpl_Quadruple y, tmpl_Quadruple z)
+{
+    const tmpl_UnpackedQuadruple ux = tmpl_Quadruple_Unpack(x);
+    const tmpl_UnpackedQuadruple uy = tmpl_Quadruple_Unpack(y);
+    const tmpl_UnpackedQuadruple uz = tmpl_Quadruple_Unpack(z);
+    const tmpl_UnpackedQuadruple fma =
+        tmpl_UnpackedQuadruple_FMA(&ux, &uy, &uz);
+
+    return tmpl_Quadruple_Pack(&fma);
+}
+/*  End of tmpl_Quadruple_FMA.                                                */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
@@ -0,0 +1,142 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                        tmpl_from_ldouble_quadruple                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Converts a long double to quadruple precision.                        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Quadruple_From_LDouble                                           *
+ *  Purpose:                                                                  *
+ *      Converts x to a tmpl_Quadruple.                                       *
+ *  Arguments:                                                                *
+ *      x (long double):                                                      *
+ *          A real number.                                                    *
+ *  Output:                                                                   *
+ *      out (tmpl_Quadruple):                                                 *
+ *          The number x as a quadruple.                                      *
+ *  Called Functions:                                                         *
+ *      src/math/:                                                            *
+ *          tmpl_LDouble_Base2_Mant_and_Exp:                                  *
+ *              Computes m and e with |x| = m 2^e and 1 <= m < 2.             *
+ *      src/quadruple/auxiliary/tmpl_quadruple_round.h:                       *
+ *          tmpl_UnpackedQuadruple_Round:                                     *
+ *              Rounds to binary128, which is exact in most cases.            *
+ *  Method:                                                                   *
+ *      Write |x| = m 2^e. The fractional part m - 1 is read off 28 bits at   *
+ *      a time by scaling by 2^28 and taking the integer part, which is exact *
+ *      in floating point. Four steps give 112 bits, and anything left over   *
+ *      is jammed into a sticky bit.                                          *
+ *  Notes:                                                                    *
+ *      1.) NaN, infinity, and signed zeros are preserved.                    *
+ *                                                                            *
+ *      2.) Only a double-double long double can have more than 113 bits, and *
+ *          only then is the result rounded.                                  *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_quadruple.h:                                                     *
+ *          Header file where the function prototype is given.                *
+ *  2.) tmpl_math.h:                                                          *
+ *          Header file providing tmpl_LDouble_Base2_Mant_and_Exp.            *
+ *  3.) tmpl_quadruple_shift_left128.h:                                       *
+ *          Left shift of 128-bit integers.                                   *
+ *  4.) tmpl_quadruple_round.h:                                               *
+ *          Rounding to binary128.                                            *
+ *  5.) tmpl_quadruple_special.h:                                             *
+ *          Creates zeros, infinities, and NaN.                               *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_quadruple.h>
+
+/*  The unpacked form needs 64-bit integers.                                  */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  tmpl_LDouble_Base2_Mant_and_Exp and the classification tools found here.  */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  tmpl_Quadruple_Shift_Left128 found here.                                  */
+#include "auxiliary/tmpl_quadruple_shift_left128.h"
+
+/*  tmpl_UnpackedQuadruple_Round and special values found here.               */
+#include "auxiliary/tmpl_quadruple_round.h"
+#include "auxiliary/tmpl_quadruple_special.h"
+
+/*  Function for converting a long double to a quadruple.                     */
+tmpl_Quadruple tmpl_Quadruple_From_LDouble(long double x)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_UnpackedQuadruple out;
+    tmpl_UInt64 hi, lo;
+    long double frac;
+    signed int expo;
+    unsigned int n;
+    const tmpl_Bool is_negative =
+        (tmpl_Bool)(tmpl_LDouble_Copysign(1.0L, x) < 0.0L);
+
+    /*  Special cases, NaN, infinity, and zero.                               */
+    if (tmpl_LDouble_Is_NaN(x))
+        out = tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_NAN, tmpl_False);
+
+    else if (tmpl_LDouble_Is_Inf(x))
+        out = tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_INF, is_negative);
+
+    else if (x == 0.0L)
+        out = tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_ZERO, is_negative);
+
+    else
+    {
+        /*  |x| = frac 2^expo with 1 <= frac < 2.                             */
+        tmpl_LDouble_Base2_Mant_and_Exp(x, &frac, &expo);
+        frac -= 1.0L;
+
+        /*  Start with the leading bit, then bring down 28 bits at a time.    */
+        hi = 0;
+        lo = 1;
+
+        for (n = 0; n < 4; ++n)
+        {
+            tmpl_UInt64 bits;
+            frac *= 268435456.0L;
+            bits = (tmpl_UInt64)frac;
+            frac -= (long double)bits;
+
+            tmpl_Quadruple_Shift_Left128(&hi, &lo, 28);
+            lo |= bits;
+        }
+
+        /*  Move the leading bit from 112 to 127, and jam whatever is left.   */
+        tmpl_Quadruple_Shift_Left128(&hi, &lo, 15);
+        lo |= (frac != 0.0L);
+
+        out = tmpl_UnpackedQuadruple_Round(is_negative, expo, hi, lo);
+    }
+
+    return tmpl_Quadruple_Pack(&out);
+}
+/*  End of tmpl_Quadruple_From_LDouble.                                       */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
@@ -0,0 +1,341 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                         tmpl_from_string_quadruple                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Converts a decimal string to quadruple precision.                     *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Quadruple_From_String                                            *
+ *  Purpose:                                                                  *
+ *      Parses a decimal number, rounding correctly to binary128.             *
+ *  Arguments:                                                                *
+ *      str (const char *):                                                   *
+ *          A string such as "-1.25e-3", "inf", "infinity", or "nan", case    *
+ *          insensitive, with optional white space on either side.            *
+ *  Output:                                                                   *
+ *      out (tmpl_Quadruple):                                                 *
+ *          The correctly rounded value of str.                               *
+ *  Called Functions:                                                         *
+ *      src/bigint/:                                                          *
+ *          tmpl_BigInt_Multiply, tmpl_BigInt_Add, tmpl_BigInt_DivRem:        *
+ *              Exact integer arithmetic.                                     *
+ *      src/quadruple/auxiliary/tmpl_quadruple_bigint_pow.h:                  *
+ *          tmpl_QuadrupleBigInt_Pow:                                         *
+ *              Computes powers of 2 and 10.                                  *
+ *      src/quadruple/auxiliary/tmpl_quadruple_bigint_round.h:                *
+ *          tmpl_QuadrupleBigInt_Round:                                       *
+ *              Rounds a big integer times a power of two.                    *
+ *  Method:                                                                   *
+ *      Collect the significant digits into an integer D, nine at a time,     *
+ *      so the value is D 10^E. If E >= 0 this is the integer D 10^E, which   *
+ *      is rounded directly. Otherwise pick s so D 2^s / 10^-E has at least   *
+ *      116 bits, divide, and round the quotient times 2^-s with the          *
+ *      remainder as a sticky bit. All of the arithmetic is exact, so the     *
+ *      result is correctly rounded no matter how many digits are given.      *
+ *  Notes:                                                                    *
+ *      1.) Values that are certainly out of range are sent to zero or        *
+ *          infinity before any big integer work is done.                     *
+ *                                                                            *
+ *      2.) NaN is returned for NULL, for strings that are not numbers, and   *
+ *          if malloc fails.                                                  *
+ *                                                                            *
+ *      3.) Parsing does not depend on the locale.                            *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_quadruple.h:                                                     *
+ *          Header file where the function prototype is given.                *
+ *  2.) tmpl_quadruple_bigint_pow.h:                                          *
+ *          Powers as big integers.                                           *
+ *  3.) tmpl_quadruple_bigint_bit_length.h:                                   *
+ *          Bit length of a big integer.                                      *
+ *  4.) tmpl_quadruple_bigint_round.h:                                        *
+ *          Rounds a big integer times a power of two.                        *
+ *  5.) tmpl_quadruple_special.h:                                             *
+ *          Creates zeros, infinities, and NaN.                               *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_quadruple.h>
+
+/*  The unpacked form needs 64-bit integers.                                  */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  tmpl_BigInt tools and tmpl_QuadrupleBigInt_Round found here.              */
+#include "auxiliary/tmpl_quadruple_bigint_pow.h"
+#include "auxiliary/tmpl_quadruple_bigint_bit_length.h"
+#include "auxiliary/tmpl_quadruple_bigint_round.h"
+
+/*  tmpl_UnpackedQuadruple_Special found here.                                */
+#include "auxiliary/tmpl_quadruple_special.h"
+
+/*  Digits are gathered nine at a time, which fits in an unsigned long.       */
+#define TMPL_QUADRUPLE_CHUNK_DIGITS (9)
+
+/*  Exponents are clamped here while parsing, well past the format's range.   */
+#define TMPL_QUADRUPLE_MAX_DECIMAL_EXP (100000000L)
+
+/*  If x >= 10^4933 the result is inf, and if x < 10^-4966 it is zero.        */
+#define TMPL_QUADRUPLE_DECIMAL_OVERFLOW (4933L)
+#define TMPL_QUADRUPLE_DECIMAL_UNDERFLOW (-4967L)
+
+/*  White space, without depending on the locale.                             */
+static tmpl_Bool tmpl_quadruple_is_space(char c)
+{
+    return (tmpl_Bool)(c == ' ' || c == '\t' || c == '\n' ||
+                       c == '\v' || c == '\f' || c == '\r');
+}
+/*  End of tmpl_quadruple_is_space.                                           */
+
+/*  Case insensitive prefix match. Returns the end of the match, or NULL.     */
+static const char *tmpl_quadruple_match(const char *str, const char *word)
+{
+    while (*word)
+    {
+        char c = *str;
+
+        if (c >= 'A' && c <= 'Z')
+            c = (char)(c - 'A' + 'a');
+
+        if (c != *word)
+            return NULL;
+
+        ++str;
+        ++word;
+    }
+
+    return str;
+}
+/*  End of tmpl_quadruple_match.                                              */
+
+/*  Sets x = x 10^count + chunk.                                              */
+static void
+tmpl_quadruple_append_digits(tmpl_BigInt *x, tmpl_BigInt *tmp,
+                             unsigned long int chunk, unsigned int count)
+{
+    unsigned long int power = 1UL;
+
+    while (count--)
+        power *= 10UL;
+
+    tmpl_BigInt_Set_ULong(tmp, power);
+    tmpl_BigInt_Multiply(x, x, tmp);
+    tmpl_BigInt_Set_ULong(tmp, chunk);
+    tmpl_BigInt_Add(x, x, tmp);
+}
+/*  End of tmpl_quadruple_append_digits.                                      */
+
+/*  Function for converting a string to a quadruple.                          */
+tmpl_Quadruple tmpl_Quadruple_From_String(const char *str)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    const char *end;
+    tmpl_Bool is_negative = tmpl_False;
+    tmpl_Bool seen_digit = tmpl_False;
+    tmpl_Bool seen_point = tmpl_False;
+    tmpl_Bool success;
+    unsigned long int chunk = 0UL;
+    unsigned int chunk_length = 0U;
+    signed long int digits = 0L, expo = 0L;
+    tmpl_BigInt num, power, quot, rem;
+    tmpl_UnpackedQuadruple out;
+
+    if (!str)
+        return tmpl_Quadruple_NaN;
+
+    /*  Optional white space and sign.                                        */
+    while (tmpl_quadruple_is_space(*str))
+        ++str;
+
+    if (*str == '-' || *str == '+')
+    {
+        is_negative = (tmpl_Bool)(*str == '-');
+        ++str;
+    }
+
+    /*  Infinity and NaN, spelled out.                                        */
+    if ((end = tmpl_quadruple_match(str, "infinity")) != NULL ||
+        (end = tmpl_quadruple_match(str, "inf")) != NULL)
+        out = tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_INF, is_negative);
+
+    else if ((end = tmpl_quadruple_match(str, "nan")) != NULL)
+        out = tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_NAN, tmpl_False);
+
+    else
+        end = NULL;
+
+    if (end)
+    {
+        while (tmpl_quadruple_is_space(*end))
+            ++end;
+
+        return (*end ? tmpl_Quadruple_NaN : tmpl_Quadruple_Pack(&out));
+    }
+
+    tmpl_BigInt_Init(&num);
+    tmpl_BigInt_Init(&power);
+
+    /*  The digits, with at most one decimal point. Leading zeros are         *
+     *  skipped, and digits after the point lower the exponent.               */
+    for (; (*str >= '0' && *str <= '9') || (*str == '.' && !seen_point); ++str)
+    {
+        if (*str == '.')
+        {
+            seen_point = tmpl_True;
+            continue;
+        }
+
+        seen_digit = tmpl_True;
+
+        if (seen_point)
+            --expo;
+
+        if (!digits && *str == '0')
+            continue;
+
+        chunk = 10UL * chunk + (unsigned long int)(*str - '0');
+        ++chunk_length;
+        ++digits;
+
+        if (chunk_length == TMPL_QUADRUPLE_CHUNK_DIGITS)
+        {
+            tmpl_quadruple_append_digits(&num, &power, chunk, chunk_length);
+            chunk = 0UL;
+            chunk_length = 0U;
+        }
+    }
+
+    if (chunk_length)
+        tmpl_quadruple_append_digits(&num, &power, chunk, chunk_length);
+
+    /*  An optional exponent, which needs at least one digit.                 */
+    if (seen_digit && (*str == 'e' || *str == 'E'))
+    {
+        tmpl_Bool expo_negative = tmpl_False;
+        signed long int value = 0L;
+
+        ++str;
+
+        if (*str == '-' || *str == '+')
+        {
+            expo_negative = (tmpl_Bool)(*str == '-');
+            ++str;
+        }
+
+        if (*str < '0' || *str > '9')
+            seen_digit = tmpl_False;
+
+        for (; *str >= '0' && *str <= '9'; ++str)
+        {
+            if (value < TMPL_QUADRUPLE_MAX_DECIMAL_EXP)
+                value = 10L * value + (signed long int)(*str - '0');
+        }
+
+        expo += (expo_negative ? -value : value);
+    }
+
+    while (tmpl_quadruple_is_space(*str))
+        ++str;
+
+    /*  Anything else means this was not a number.                            */
+    if (!seen_digit || *str || num.error_occurred)
+    {
+        tmpl_BigInt_Destroy(&num);
+        tmpl_BigInt_Destroy(&power);
+        return tmpl_Quadruple_NaN;
+    }
+
+    /*  The value is num 10^expo, and 10^(digits - 1 + expo) <= |x|.          */
+    if (!digits || digits + expo <= TMPL_QUADRUPLE_DECIMAL_UNDERFLOW)
+        out = tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_ZERO, is_negative);
+
+    else if (digits - 1L + expo >= TMPL_QUADRUPLE_DECIMAL_OVERFLOW)
+        out = tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_INF, is_negative);
+
+    /*  An integer, scale it up and round.                                    */
+    else if (expo >= 0)
+    {
+        success = tmpl_QuadrupleBigInt_Pow(&power, 10UL,
+                                           (unsigned long int)expo);
+
+        tmpl_BigInt_Multiply(&num, &num, &power);
+
+        if (success && !num.error_occurred)
+            out = tmpl_QuadrupleBigInt_Round(&num, 0L, tmpl_False, is_negative);
+        else
+            out = tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_NAN,
+                                                 tmpl_False);
+    }
+
+    /*  num / 10^-expo. Scale num by 2^shift so the quotient has at least     *
+     *  116 bits, enough for the remainder to serve as a sticky bit.          */
+    else
+    {
+        signed long int shift;
+
+        tmpl_BigInt_Init(&quot);
+        tmpl_BigInt_Init(&rem);
+
+        success = tmpl_QuadrupleBigInt_Pow(&power, 10UL,
+                                           (unsigned long int)(-expo));
+
+        shift = 116L + (signed long int)tmpl_QuadrupleBigInt_Bit_Length(&power)
+              - (signed long int)tmpl_QuadrupleBigInt_Bit_Length(&num);
+
+        if (shift < 0L)
+            shift = 0L;
+
+        success = (tmpl_Bool)(success &&
+            tmpl_QuadrupleBigInt_Pow(&quot, 2UL, (unsigned long int)shift));
+
+        tmpl_BigInt_Multiply(&num, &num, &quot);
+        tmpl_BigInt_DivRem(&quot, &rem, &num, &power);
+
+        if (success && !quot.error_occurred && !rem.error_occurred)
+            out = tmpl_QuadrupleBigInt_Round(
+                &quot, -shift, (tmpl_Bool)(rem.length != 0), is_negative
+            );
+        else
+            out = tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_NAN,
+                                                 tmpl_False);
+
+        tmpl_BigInt_Destroy(&quot);
+        tmpl_BigInt_Destroy(&rem);
+    }
+
+    tmpl_BigInt_Destroy(&num);
+    tmpl_BigInt_Destroy(&power);
+    return tmpl_Quadruple_Pack(&out);
+}
+/*  End of tmpl_Quadruple_From_String.                                        */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_QUADRUPLE_CHUNK_DIGITS
+#undef TMPL_QUADRUPLE_MAX_DECIMAL_EXP
+#undef TMPL_QUADRUPLE_DECIMAL_OVERFLOW
+#undef TMPL_QUADRUPLE_DECIMAL_UNDERFLOW
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
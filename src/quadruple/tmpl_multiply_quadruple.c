@@ -0,0 +1,146 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                          tmpl_multiply_quadruple                           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies quadruple precision numbers.                               *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_UnpackedQuadruple_Multiply                                       *
+ *      tmpl_Quadruple_Multiply                                               *
+ *  Purpose:                                                                  *
+ *      Computes x * y, correctly rounded.                                    *
+ *  Arguments:                                                                *
+ *      x (const tmpl_UnpackedQuadruple * const):                             *
+ *          A number.                                                         *
+ *      y (const tmpl_UnpackedQuadruple * const):                             *
+ *          Another number.                                                   *
+ *  Output:                                                                   *
+ *      prod (tmpl_UnpackedQuadruple):                                        *
+ *          The product of x and y.                                           *
+ *  Called Functions:                                                         *
+ *      src/quadruple/auxiliary/tmpl_quadruple_mul128.h:                      *
+ *          tmpl_Quadruple_Mul128:                                            *
+ *              Computes the full 256-bit product of the significands.        *
+ *      src/quadruple/auxiliary/tmpl_quadruple_round.h:                       *
+ *          tmpl_UnpackedQuadruple_Round:                                     *
+ *              Rounds the exact result to binary128.                         *
+ *  Method:                                                                   *
+ *      Move both significands up so the leading bits are at 127. The full    *
+ *      product then has its leading bit at 253 or 254. The top 128 bits,     *
+ *      with the lower 128 jammed into a sticky bit, hold everything that is  *
+ *      needed to round correctly.                                            *
+ *  Notes:                                                                    *
+ *      1.) inf * 0 is NaN.                                                   *
+ *                                                                            *
+ *      2.) The tmpl_Quadruple version unpacks, calls this, and packs.        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_quadruple.h:                                                     *
+ *          Header file where the function prototypes are given.              *
+ *  2.) tmpl_quadruple_mul128.h:                                              *
+ *          Full 256-bit product of 128-bit integers.                         *
+ *  3.) tmpl_quadruple_shift_left128.h:                                       *
+ *          Left shift of 128-bit integers.                                   *
+ *  4.) tmpl_quadruple_round.h:                                               *
+ *          Rounding to binary128.                                            *
+ *  5.) tmpl_quadruple_special.h:                                             *
+ *          Creates zeros, infinities, and NaN.                               *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes and typedefs given here.                              */
+#include <libtmpl/include/tmpl_quadruple.h>
+
+/*  The unpacked form needs 64-bit integers.                                  */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  tmpl_Quadruple_Mul128 and shifts found here.                              */
+#include "auxiliary/tmpl_quadruple_mul128.h"
+#include "auxiliary/tmpl_quadruple_shift_left128.h"
+
+/*  tmpl_UnpackedQuadruple_Round and special values found here.               */
+#include "auxiliary/tmpl_quadruple_round.h"
+#include "auxiliary/tmpl_quadruple_special.h"
+
+/*  Function for multiplying two unpacked numbers.                            */
+tmpl_UnpackedQuadruple
+tmpl_UnpackedQuadruple_Multiply(const tmpl_UnpackedQuadruple * const x,
+                                const tmpl_UnpackedQuadruple * const y)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_UInt64 x_hi, x_lo, y_hi, y_lo, prod[4];
+    const tmpl_Bool is_negative = (tmpl_Bool)(x->is_negative != y->is_negative);
+
+    /*  Special cases. NaN in gives NaN out, and inf * 0 is NaN.              */
+    if (x->kind == TMPL_QUADRUPLE_NAN || y->kind == TMPL_QUADRUPLE_NAN)
+        return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_NAN, tmpl_False);
+
+    if (x->kind == TMPL_QUADRUPLE_INF || y->kind == TMPL_QUADRUPLE_INF)
+    {
+        if (x->kind == TMPL_QUADRUPLE_ZERO || y->kind == TMPL_QUADRUPLE_ZERO)
+            return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_NAN,
+                                                  tmpl_False);
+
+        return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_INF, is_negative);
+    }
+
+    if (x->kind == TMPL_QUADRUPLE_ZERO || y->kind == TMPL_QUADRUPLE_ZERO)
+        return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_ZERO, is_negative);
+
+    /*  Move the leading bits from 112 up to 127.                             */
+    x_hi = x->hi;
+    x_lo = x->lo;
+    y_hi = y->hi;
+    y_lo = y->lo;
+    tmpl_Quadruple_Shift_Left128(&x_hi, &x_lo, 15);
+    tmpl_Quadruple_Shift_Left128(&y_hi, &y_lo, 15);
+
+    /*  The product is prod 2^(x->expo + y->expo - 254).                      */
+    tmpl_Quadruple_Mul128(x_hi, x_lo, y_hi, y_lo, prod);
+
+    /*  Keep the top half, with the bottom half jammed into the last bit.     */
+    prod[2] |= ((prod[1] | prod[0]) != 0);
+
+    /*  The top half is prod 2^(x->expo + y->expo - 126).                     */
+    return tmpl_UnpackedQuadruple_Round(
+        is_negative, x->expo + y->expo + 1, prod[3], prod[2]
+    );
+}
+/*  End of tmpl_UnpackedQuadruple_Multiply.                                   */
+
+/*  Function for multiplying two quadruples.                                  */
+tmpl_Quadruple tmpl_Quadruple_Multiply(tmpl_Quadruple x, tmpl_Quadruple y)
+{
+    const tmpl_UnpackedQuadruple ux = tmpl_Quadruple_Unpack(x);
+    const tmpl_UnpackedQuadruple uy = tmpl_Quadruple_Unpack(y);
+    const tmpl_UnpackedQuadruple prod =
+        tmpl_UnpackedQuadruple_Multiply(&ux, &uy);
+
+    return tmpl_Quadruple_Pack(&prod);
+}
+/*  End of tmpl_Quadruple_Multiply.                                           */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
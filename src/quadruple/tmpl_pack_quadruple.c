@@ -0,0 +1,135 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                            tmpl_pack_quadruple                             *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Packs sign, exponent, and significand into a quadruple.               *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Quadruple_Pack                                                   *
+ *  Purpose:                                                                  *
+ *      Converts an unpacked quadruple into the binary128 bit-fields.         *
+ *  Arguments:                                                                *
+ *      x (const tmpl_UnpackedQuadruple * const):                             *
+ *          An unpacked number.                                               *
+ *  Output:                                                                   *
+ *      out (tmpl_Quadruple):                                                 *
+ *          The packed form of x.                                             *
+ *  Called Functions:                                                         *
+ *      src/quadruple/auxiliary/tmpl_quadruple_shift_right_jam128.h:          *
+ *          tmpl_Quadruple_Shift_Right_Jam128:                                *
+ *              Shifts subnormal significands into place.                     *
+ *  Method:                                                                   *
+ *      The unpacked number is already rounded, so this only moves bits.      *
+ *      Normal numbers drop the leading bit and bias the exponent. Subnormal  *
+ *      numbers are shifted right so the exponent is the smallest normal      *
+ *      exponent, which is exact, and get a zero exponent field.              *
+ *  Notes:                                                                    *
+ *      NULL pointers give NaN.                                               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_quadruple.h:                                                     *
+ *          Header file where the function prototype is given.                *
+ *  2.) tmpl_quadruple_limbs.h:                                               *
+ *          Binary128 constants and typedefs.                                 *
+ *  3.) tmpl_quadruple_shift_right_jam128.h:                                  *
+ *          Jamming right shift of 128-bit integers.                          *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_quadruple.h>
+
+/*  The unpacked form needs 64-bit integers.                                  */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  Binary128 constants and the jamming shift found here.                     */
+#include "auxiliary/tmpl_quadruple_limbs.h"
+#include "auxiliary/tmpl_quadruple_shift_right_jam128.h"
+
+/*  Mask for a 16-bit field.                                                  */
+#define TMPL_QUADRUPLE_FIELD (0xFFFFU)
+
+/*  Function for packing a quadruple.                                         */
+tmpl_Quadruple tmpl_Quadruple_Pack(const tmpl_UnpackedQuadruple * const x)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_Quadruple out;
+    tmpl_UInt64 hi = 0, lo = 0;
+    unsigned int expo = 0;
+
+    if (!x)
+        return tmpl_Quadruple_NaN;
+
+    out.sign = (x->is_negative ? 1U : 0U);
+
+    if (x->kind == TMPL_QUADRUPLE_NAN)
+    {
+        out = tmpl_Quadruple_NaN;
+        out.sign = (x->is_negative ? 1U : 0U);
+        return out;
+    }
+
+    if (x->kind == TMPL_QUADRUPLE_INF)
+        expo = 0x7FFFU;
+
+    else if (x->kind == TMPL_QUADRUPLE_FINITE)
+    {
+        hi = x->hi;
+        lo = x->lo;
+
+        /*  Normal numbers store the exponent with a bias and drop the        *
+         *  leading bit. Subnormal numbers are shifted into place. The        *
+         *  number is representable, so no bits are lost.                     */
+        if (x->expo >= TMPL_QUADRUPLE_EMIN)
+        {
+            expo = (unsigned int)(x->expo + TMPL_QUADRUPLE_BIAS);
+            hi &= TMPL_QUADRUPLE_HIDDEN_BIT - 1;
+        }
+
+        else
+        {
+            const signed long int shift = TMPL_QUADRUPLE_EMIN - x->expo;
+            tmpl_Quadruple_Shift_Right_Jam128(&hi, &lo,
+                                              (unsigned long int)shift);
+        }
+    }
+
+    out.mant1 = (unsigned int)(lo & TMPL_QUADRUPLE_FIELD);
+    out.mant2 = (unsigned int)((lo >> 16) & TMPL_QUADRUPLE_FIELD);
+    out.mant3 = (unsigned int)((lo >> 32) & TMPL_QUADRUPLE_FIELD);
+    out.mant4 = (unsigned int)((lo >> 48) & TMPL_QUADRUPLE_FIELD);
+    out.mant5 = (unsigned int)(hi & TMPL_QUADRUPLE_FIELD);
+    out.mant6 = (unsigned int)((hi >> 16) & TMPL_QUADRUPLE_FIELD);
+    out.mant7 = (unsigned int)((hi >> 32) & TMPL_QUADRUPLE_FIELD);
+    out.exponent = expo & 0x7FFFU;
+    return out;
+}
+/*  End of tmpl_Quadruple_Pack.                                               */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_QUADRUPLE_FIELD
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
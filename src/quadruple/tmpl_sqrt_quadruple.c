@@ -0,0 +1,173 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                            tmpl_sqrt_quadruple                             *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes square roots of quadruple precision numbers.                 *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_UnpackedQuadruple_Sqrt                                           *
+ *      tmpl_Quadruple_Sqrt                                                   *
+ *  Purpose:                                                                  *
+ *      Computes sqrt(x), correctly rounded.                                  *
+ *  Arguments:                                                                *
+ *      x (const tmpl_UnpackedQuadruple * const):                             *
+ *          A number.                                                         *
+ *  Output:                                                                   *
+ *      sqrt_x (tmpl_UnpackedQuadruple):                                      *
+ *          The square root of x.                                             *
+ *  Called Functions:                                                         *
+ *      src/quadruple/auxiliary/tmpl_quadruple_round.h:                       *
+ *          tmpl_UnpackedQuadruple_Round:                                     *
+ *              Rounds the exact result to binary128.                         *
+ *  Method:                                                                   *
+ *      Write x = M 2^(e - 112) with M the 113-bit significand. Pick s = 118  *
+ *      or s = 119 so that e - 112 - s is even. Then R = M 2^s lies between   *
+ *      2^230 and 2^232, and sqrt(x) = sqrt(R) 2^((e - 112 - s) / 2). The     *
+ *      integer square root of R has exactly 116 bits and is computed with    *
+ *      the digit-by-digit method, bringing down two bits of R at a time.     *
+ *      The remainder stays below 2^118, so 128-bit registers are enough.     *
+ *      The remainder is non-zero exactly when the root is inexact, and it    *
+ *      is jammed into a sticky bit.                                          *
+ *  Notes:                                                                    *
+ *      1.) sqrt(-0) = -0, and the square root of any other negative number   *
+ *          is NaN.                                                           *
+ *                                                                            *
+ *      2.) The tmpl_Quadruple version unpacks, calls this, and packs.        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_quadruple.h:                                                     *
+ *          Header file where the function prototypes are given.              *
+ *  2.) tmpl_quadruple_shift_left128.h:                                       *
+ *          Left shift of 128-bit integers.                                   *
+ *  3.) tmpl_quadruple_round.h:                                               *
+ *          Rounding to binary128.                                            *
+ *  4.) tmpl_quadruple_special.h:                                             *
+ *          Creates zeros, infinities, and NaN.                               *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototypes and typedefs given here.                              */
+#include <libtmpl/include/tmpl_quadruple.h>
+
+/*  The unpacked form needs 64-bit integers.                                  */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  tmpl_Quadruple_Shift_Left128 found here.                                  */
+#include "auxiliary/tmpl_quadruple_shift_left128.h"
+
+/*  tmpl_UnpackedQuadruple_Round and special values found here.               */
+#include "auxiliary/tmpl_quadruple_round.h"
+#include "auxiliary/tmpl_quadruple_special.h"
+
+/*  Bit n of the 128-bit number (hi, lo), for n < 128.                        */
+#define TMPL_QUADRUPLE_BIT(hi, lo, n)                                          \
+    ((n) < 64 ? (((lo) >> (n)) & 1U) : (((hi) >> ((n) - 64)) & 1U))
+
+/*  Function for computing the square root of an unpacked number.             */
+tmpl_UnpackedQuadruple
+tmpl_UnpackedQuadruple_Sqrt(const tmpl_UnpackedQuadruple * const x)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_UInt64 rem_hi, rem_lo, root_hi, root_lo, trial_hi, trial_lo;
+    unsigned int n, s;
+
+    /*  Special cases. NaN and negative numbers give NaN, and sqrt(-0) = -0.  */
+    if (x->kind == TMPL_QUADRUPLE_NAN)
+        return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_NAN, tmpl_False);
+
+    if (x->kind == TMPL_QUADRUPLE_ZERO)
+        return *x;
+
+    if (x->is_negative)
+        return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_NAN, tmpl_False);
+
+    if (x->kind == TMPL_QUADRUPLE_INF)
+        return *x;
+
+    /*  e - 112 - s needs to be even. Check the parity with a mask since the  *
+     *  exponent may be negative.                                             */
+    s = ((x->expo & 1L) ? 119U : 118U);
+
+    rem_hi = rem_lo = root_hi = root_lo = 0;
+
+    /*  Bring down the bits of R = M 2^s two at a time, from bit 231 down.    */
+    for (n = 116; n > 0; --n)
+    {
+        const unsigned int bit = 2U * n - 1U;
+        tmpl_UInt64 pair = 0;
+
+        /*  Bits of R below s are zero, and bit j of R is bit j - s of M.     */
+        if (bit >= s)
+            pair |= TMPL_QUADRUPLE_BIT(x->hi, x->lo, bit - s) << 1;
+
+        if (bit - 1U >= s)
+            pair |= TMPL_QUADRUPLE_BIT(x->hi, x->lo, bit - 1U - s);
+
+        /*  rem = 4 rem + pair, and the trial value is 4 root + 1.            */
+        tmpl_Quadruple_Shift_Left128(&rem_hi, &rem_lo, 2);
+        rem_lo |= pair;
+
+        trial_hi = root_hi;
+        trial_lo = root_lo;
+        tmpl_Quadruple_Shift_Left128(&trial_hi, &trial_lo, 2);
+        trial_lo |= 1U;
+
+        tmpl_Quadruple_Shift_Left128(&root_hi, &root_lo, 1);
+
+        /*  If the trial value fits, the next bit of the root is one.         */
+        if (rem_hi > trial_hi || (rem_hi == trial_hi && rem_lo >= trial_lo))
+        {
+            rem_hi -= trial_hi + (rem_lo < trial_lo);
+            rem_lo -= trial_lo;
+            root_lo |= 1U;
+        }
+    }
+
+    /*  The root has 116 bits, so the lowest bit is well below the rounding  *
+     *  position and can hold the sticky bit.                                 */
+    root_lo |= ((rem_hi | rem_lo) != 0);
+
+    /*  sqrt(x) = root 2^((e - 112 - s) / 2), and e - 112 - s is even.        */
+    return tmpl_UnpackedQuadruple_Round(
+        tmpl_False, (x->expo - 112L - (signed long int)s) / 2L + 127L,
+        root_hi, root_lo
+    );
+}
+/*  End of tmpl_UnpackedQuadruple_Sqrt.                                       */
+
+/*  Function for computing the square root of a quadruple.                    */
+tmpl_Quadruple tmpl_Quadruple_Sqrt(tmpl_Quadruple x)
+{
+    const tmpl_UnpackedQuadruple ux = tmpl_Quadruple_Unpack(x);
+    const tmpl_UnpackedQuadruple sqrt_x = tmpl_UnpackedQuadruple_Sqrt(&ux);
+    return tmpl_Quadruple_Pack(&sqrt_x);
+}
+/*  End of tmpl_Quadruple_Sqrt.                                               */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_QUADRUPLE_BIT
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
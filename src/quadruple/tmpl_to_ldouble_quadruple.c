@@ -0,0 +1,132 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                         tmpl_to_ldouble_quadruple                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Converts a quadruple to a long double.                                *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Quadruple_To_LDouble                                             *
+ *  Purpose:                                                                  *
+ *      Converts x to a long double, correctly rounded.                       *
+ *  Arguments:                                                                *
+ *      x (tmpl_Quadruple):                                                   *
+ *          A number.                                                         *
+ *  Output:                                                                   *
+ *      out (long double):                                                    *
+ *          The number x rounded to a long double.                            *
+ *  Called Functions:                                                         *
+ *      src/math/:                                                            *
+ *          tmpl_LDouble_Pow2:                                                *
+ *              Computes 2^n, including subnormal values.                     *
+ *      src/quadruple/auxiliary/tmpl_quadruple_round.h:                       *
+ *          tmpl_UnpackedQuadruple_Round_To_Precision:                        *
+ *              Rounds the significand to fewer bits.                         *
+ *  Method:                                                                   *
+ *      Round the significand to LDBL_MANT_DIG bits with the integer code,    *
+ *      using fewer bits when the result is subnormal in the narrower         *
+ *      format. This gives x = N 2^k, where N has at most LDBL_MANT_DIG + 1   *
+ *      bits and converts exactly. N 2^k is then representable unless it      *
+ *      overflows. The rounding is done once on the exact value, so there     *
+ *      is no double rounding through an intermediate format.                 *
+ *  Notes:                                                                    *
+ *      Values that round past the largest long double give an infinity.      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_quadruple.h:                                                     *
+ *          Header file where the function prototype is given.                *
+ *  2.) tmpl_math.h:                                                          *
+ *          Header file providing tmpl_LDouble_Pow2 and the constants.        *
+ *  3.) tmpl_quadruple_clz64.h:                                               *
+ *          Counts leading zeros.                                             *
+ *  4.) tmpl_quadruple_round_to_precision.h:                                  *
+ *          Rounding to narrower formats.                                     *
+ *  5.) float.h:                                                              *
+ *          Standard library header with the parameters of the format.        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_quadruple.h>
+
+/*  The unpacked form needs 64-bit integers.                                  */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  tmpl_LDouble_Pow2 and the NaN and infinity constants found here.          */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Leading zeros and rounding to precision found here.                       */
+#include "auxiliary/tmpl_quadruple_clz64.h"
+#include "auxiliary/tmpl_quadruple_round_to_precision.h"
+
+/*  LDBL_MANT_DIG, LDBL_MIN_EXP, and LDBL_MAX_EXP found here.                 */
+#include <float.h>
+
+/*  Function for converting a quadruple to a long double.                     */
+long double tmpl_Quadruple_To_LDouble(tmpl_Quadruple x)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_UInt64 hi, lo;
+    signed long int scale, top;
+    long double out;
+    const tmpl_UnpackedQuadruple u = tmpl_Quadruple_Unpack(x);
+
+    /*  Special cases, NaN, infinity, and zero.                               */
+    if (u.kind == TMPL_QUADRUPLE_NAN)
+        return TMPL_NANL;
+
+    if (u.kind == TMPL_QUADRUPLE_INF)
+        return (u.is_negative ? -TMPL_INFINITYL : TMPL_INFINITYL);
+
+    if (u.kind == TMPL_QUADRUPLE_ZERO)
+        return (u.is_negative ? -0.0L : 0.0L);
+
+    /*  x = N 2^scale, rounded to the precision of the long double.           */
+    scale = tmpl_UnpackedQuadruple_Round_To_Precision(
+        &u, LDBL_MANT_DIG, LDBL_MIN_EXP - 1, &hi, &lo
+    );
+
+    /*  Tiny values may round to zero.                                        */
+    if (!(hi | lo))
+        return (u.is_negative ? -0.0L : 0.0L);
+
+    /*  The exponent of the leading bit of N 2^scale.                         */
+    if (hi)
+        top = 127L - tmpl_Quadruple_CLZ64(hi) + scale;
+    else
+        top = 63L - tmpl_Quadruple_CLZ64(lo) + scale;
+
+    if (top > LDBL_MAX_EXP - 1)
+        return (u.is_negative ? -TMPL_INFINITYL : TMPL_INFINITYL);
+
+    /*  N has few enough bits that both conversions and the sum are exact.    *
+     *  2^scale may be subnormal, and the product is exact.                   */
+    out = (long double)hi * 18446744073709551616.0L + (long double)lo;
+    out *= tmpl_LDouble_Pow2((signed int)scale);
+    return (u.is_negative ? -out : out);
+}
+/*  End of tmpl_Quadruple_To_LDouble.                                         */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
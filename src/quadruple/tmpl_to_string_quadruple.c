@@ -0,0 +1,373 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                          tmpl_to_string_quadruple                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Converts a quadruple to a decimal string.                             *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Quadruple_To_String                                              *
+ *  Purpose:                                                                  *
+ *      Prints x with 36 significant digits, correctly rounded.               *
+ *  Arguments:                                                                *
+ *      x (tmpl_Quadruple):                                                   *
+ *          A number.                                                         *
+ *  Output:                                                                   *
+ *      str (char *):                                                         *
+ *          The string "-d.ddd...de+XX", or "inf", "-inf", or "nan". The      *
+ *          caller must free this.                                            *
+ *  Called Functions:                                                         *
+ *      src/bigint/:                                                          *
+ *          tmpl_BigInt_Multiply, tmpl_BigInt_DivRem:                         *
+ *              Exact integer arithmetic.                                     *
+ *          tmpl_BigInt_To_String:                                            *
+ *              Computes the decimal digits of an integer.                    *
+ *      src/quadruple/auxiliary/tmpl_quadruple_bigint_pow.h:                  *
+ *          tmpl_QuadrupleBigInt_Pow:                                         *
+ *              Computes powers of 2, 5, and 10.                              *
+ *  Method:                                                                   *
+ *      Write |x| = M 2^k with M the 113-bit significand, and estimate the    *
+ *      decimal exponent of x from the binary one. Pick p so that             *
+ *      D = floor(M 2^k / 10^p) has 38 to 40 digits, and compute D and the    *
+ *      remainder exactly, moving powers of 2 and 10 to the numerator or      *
+ *      denominator so both are integers. The digits of D, and whether the    *
+ *      remainder is zero, are all that is needed to round to 36 digits, to   *
+ *      nearest with ties to even, carrying into a new leading digit if       *
+ *      needed.                                                               *
+ *  Notes:                                                                    *
+ *      1.) 36 significant digits are enough to read any binary128 value      *
+ *          back exactly with tmpl_Quadruple_From_String.                     *
+ *                                                                            *
+ *      2.) The exponent has at least two digits, as with printf.             *
+ *                                                                            *
+ *      3.) NULL is returned if malloc fails.                                 *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_malloc.h:                                                        *
+ *          Header file providing TMPL_MALLOC.                                *
+ *  2.) tmpl_free.h:                                                          *
+ *          Header file providing TMPL_FREE.                                  *
+ *  3.) tmpl_quadruple.h:                                                     *
+ *          Header file where the function prototype is given.                *
+ *  4.) tmpl_quadruple_limbs.h:                                               *
+ *          Binary128 constants and typedefs.                                 *
+ *  5.) tmpl_quadruple_bigint_pow.h:                                          *
+ *          Powers as big integers.                                           *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_MALLOC and TMPL_FREE macros found here.                              */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_quadruple.h>
+
+/*  The unpacked form needs 64-bit integers.                                  */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  tmpl_BigInt tools and binary128 constants found here.                     */
+#include "auxiliary/tmpl_quadruple_limbs.h"
+#include "auxiliary/tmpl_quadruple_bigint_pow.h"
+
+/*  The number of significant digits printed.                                 */
+#define TMPL_QUADRUPLE_DECIMAL_DIGITS (36)
+
+/*  At least this many digits, plus one, are computed before rounding.        */
+#define TMPL_QUADRUPLE_KEPT_DIGITS (38L)
+
+/*  Sign, 36 digits, the point, "e", the exponent's sign and up to 4 digits,  *
+ *  and the terminating zero, rounded up.                                     */
+#define TMPL_QUADRUPLE_STRING_LENGTH (48)
+
+/*  Copies a short string to new memory.                                      */
+static char *tmpl_quadruple_copy_string(const char *src)
+{
+    size_t n;
+    char *str = TMPL_MALLOC(char, TMPL_QUADRUPLE_STRING_LENGTH);
+
+    if (!str)
+        return NULL;
+
+    for (n = 0; src[n]; ++n)
+        str[n] = src[n];
+
+    str[n] = '\0';
+    return str;
+}
+/*  End of tmpl_quadruple_copy_string.                                        */
+
+/*  Sets x = hi 2^64 + lo, 32 bits at a time since an unsigned long may only *
+ *  have 32 bits.                                                             */
+static void
+tmpl_quadruple_set_bigint(tmpl_BigInt *x, tmpl_BigInt *tmp,
+                          tmpl_UInt64 hi, tmpl_UInt64 lo)
+{
+    unsigned int n;
+    tmpl_UInt64 words[4];
+
+    /*  C89 does not allow non-constant initializers for arrays.              */
+    words[0] = hi >> 32;
+    words[1] = hi;
+    words[2] = lo >> 32;
+    words[3] = lo;
+
+    tmpl_BigInt_Set_ULong(x, 0UL);
+
+    for (n = 0; n < 4; ++n)
+    {
+        /*  Multiply by 2^32 as 2^16 twice, and add the next word.            */
+        tmpl_BigInt_Set_ULong(tmp, 65536UL);
+        tmpl_BigInt_Multiply(x, x, tmp);
+        tmpl_BigInt_Multiply(x, x, tmp);
+        tmpl_BigInt_Set_ULong(
+            tmp, (unsigned long int)(words[n] & TMPL_QUADRUPLE_LOW32)
+        );
+
+        tmpl_BigInt_Add(x, x, tmp);
+    }
+}
+/*  End of tmpl_quadruple_set_bigint.                                         */
+
+/*  Computes the first 36 digits of |x|, correctly rounded, for finite        *
+ *  non-zero x. Returns the decimal exponent of the first digit in expo.      */
+static tmpl_Bool
+tmpl_quadruple_digits(const tmpl_UnpackedQuadruple * const x,
+                      char * const digits, signed long int * const expo)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_BigInt num, den, tmp;
+    tmpl_Bool success, round_up, sticky;
+    signed long int scale, power;
+    char *str;
+    size_t n, length;
+    const signed long int k = x->expo - TMPL_QUADRUPLE_MANTISSA_LENGTH;
+
+    /*  2^expo <= |x| < 2^(expo + 1), and 0.30103 is log10(2) to 5 places,    *
+     *  so floor(log10|x|) is within one of scale. Dividing by 10^power then  *
+     *  leaves an integer with 38 to 40 digits.                               */
+    scale = x->expo * 30103L;
+
+    if (scale >= 0L)
+        scale /= 100000L;
+    else
+        scale = -((-scale + 99999L) / 100000L);
+
+    power = scale - TMPL_QUADRUPLE_KEPT_DIGITS;
+
+    tmpl_BigInt_Init(&num);
+    tmpl_BigInt_Init(&den);
+    tmpl_BigInt_Init(&tmp);
+    tmpl_quadruple_set_bigint(&num, &tmp, x->hi, x->lo);
+
+    /*  The quotient is M 2^k / 10^power, with each factor put on the side    *
+     *  that keeps it an integer.                                             */
+    if (power >= 0L)
+        success = tmpl_QuadrupleBigInt_Pow(&den, 10UL,
+                                           (unsigned long int)power);
+
+    else
+    {
+        success = tmpl_QuadrupleBigInt_Pow(&tmp, 10UL,
+                                           (unsigned long int)(-power));
+
+        tmpl_BigInt_Multiply(&num, &num, &tmp);
+        tmpl_BigInt_Set_ULong(&den, 1UL);
+    }
+
+    if (k >= 0L)
+    {
+        success = (tmpl_Bool)(success &&
+            tmpl_QuadrupleBigInt_Pow(&tmp, 2UL, (unsigned long int)k));
+
+        tmpl_BigInt_Multiply(&num, &num, &tmp);
+    }
+
+    else
+    {
+        success = (tmpl_Bool)(success &&
+            tmpl_QuadrupleBigInt_Pow(&tmp, 2UL, (unsigned long int)(-k)));
+
+        tmpl_BigInt_Multiply(&den, &den, &tmp);
+    }
+
+    /*  The remainder only matters for breaking a tie.                        */
+    tmpl_BigInt_DivRem(&num, &tmp, &num, &den);
+    sticky = (tmpl_Bool)(tmp.length != 0);
+    *expo = power;
+
+    str = (success ? tmpl_BigInt_To_String(&num) : NULL);
+
+    tmpl_BigInt_Destroy(&num);
+    tmpl_BigInt_Destroy(&den);
+    tmpl_BigInt_Destroy(&tmp);
+
+    if (!str)
+        return tmpl_False;
+
+    for (length = 0; str[length]; ++length)
+    {
+        if (length < TMPL_QUADRUPLE_DECIMAL_DIGITS)
+            digits[length] = str[length];
+    }
+
+    *expo += (signed long int)length - 1L;
+
+    /*  Pad short numbers with zeros.                                         */
+    for (n = length; n < TMPL_QUADRUPLE_DECIMAL_DIGITS; ++n)
+        digits[n] = '0';
+
+    /*  Round to nearest. A tie needs every later digit to be zero.           */
+    round_up = tmpl_False;
+
+    if (length > TMPL_QUADRUPLE_DECIMAL_DIGITS)
+    {
+        const char next = str[TMPL_QUADRUPLE_DECIMAL_DIGITS];
+
+        if (next > '5')
+            round_up = tmpl_True;
+
+        else if (next == '5')
+        {
+            round_up = sticky;
+
+            for (n = TMPL_QUADRUPLE_DECIMAL_DIGITS + 1; n < length; ++n)
+            {
+                if (str[n] != '0')
+                {
+                    round_up = tmpl_True;
+                    break;
+                }
+            }
+
+            /*  An exact tie, round to even.                                  */
+            if (!round_up)
+            {
+                const char last = digits[TMPL_QUADRUPLE_DECIMAL_DIGITS - 1];
+                round_up = (tmpl_Bool)((last - '0') & 1);
+            }
+        }
+    }
+
+    TMPL_FREE(str);
+
+    if (round_up)
+    {
+        n = TMPL_QUADRUPLE_DECIMAL_DIGITS;
+
+        while (n > 0 && digits[n - 1] == '9')
+            digits[--n] = '0';
+
+        /*  All nines, 99...9 rounds up to 10...0.                            */
+        if (n == 0)
+        {
+            digits[0] = '1';
+            *expo += 1L;
+        }
+
+        else
+            ++digits[n - 1];
+    }
+
+    return tmpl_True;
+}
+/*  End of tmpl_quadruple_digits.                                             */
+
+/*  Function for converting a quadruple to a string.                          */
+char *tmpl_Quadruple_To_String(tmpl_Quadruple x)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    char digits[TMPL_QUADRUPLE_DECIMAL_DIGITS];
+    char exponent[8];
+    char *str, *ptr;
+    signed long int expo;
+    unsigned long int abs_expo;
+    size_t n, length;
+    const tmpl_UnpackedQuadruple u = tmpl_Quadruple_Unpack(x);
+
+    /*  Special cases, NaN and infinity.                                      */
+    if (u.kind == TMPL_QUADRUPLE_NAN)
+        return tmpl_quadruple_copy_string("nan");
+
+    if (u.kind == TMPL_QUADRUPLE_INF)
+        return tmpl_quadruple_copy_string(u.is_negative ? "-inf" : "inf");
+
+    /*  Zero has all zero digits, and otherwise compute the digits.           */
+    if (u.kind == TMPL_QUADRUPLE_ZERO)
+    {
+        for (n = 0; n < TMPL_QUADRUPLE_DECIMAL_DIGITS; ++n)
+            digits[n] = '0';
+
+        expo = 0L;
+    }
+
+    else if (!tmpl_quadruple_digits(&u, digits, &expo))
+        return NULL;
+
+    str = TMPL_MALLOC(char, TMPL_QUADRUPLE_STRING_LENGTH);
+
+    if (!str)
+        return NULL;
+
+    ptr = str;
+
+    if (u.is_negative)
+        *ptr++ = '-';
+
+    /*  d.ddd...d with the point after the first digit.                       */
+    *ptr++ = digits[0];
+    *ptr++ = '.';
+
+    for (n = 1; n < TMPL_QUADRUPLE_DECIMAL_DIGITS; ++n)
+        *ptr++ = digits[n];
+
+    /*  The exponent, with a sign and at least two digits.                    */
+    *ptr++ = 'e';
+    *ptr++ = (expo < 0L ? '-' : '+');
+    abs_expo = (unsigned long int)(expo < 0L ? -expo : expo);
+    length = 0;
+
+    do {
+        exponent[length++] = (char)('0' + (int)(abs_expo % 10UL));
+        abs_expo /= 10UL;
+    } while (abs_expo);
+
+    if (length < 2)
+        exponent[length++] = '0';
+
+    while (length)
+        *ptr++ = exponent[--length];
+
+    *ptr = '\0';
+    return str;
+}
+/*  End of tmpl_Quadruple_To_String.                                          */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_QUADRUPLE_DECIMAL_DIGITS
+#undef TMPL_QUADRUPLE_KEPT_DIGITS
+#undef TMPL_QUADRUPLE_STRING_LENGTH
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
@@ -0,0 +1,133 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                           tmpl_unpack_quadruple                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Splits a quadruple into sign, exponent, and significand.              *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Quadruple_Unpack                                                 *
+ *  Purpose:                                                                  *
+ *      Converts the bit-fields of a quadruple into 64-bit limbs.             *
+ *  Arguments:                                                                *
+ *      x (tmpl_Quadruple):                                                   *
+ *          A number.                                                         *
+ *  Output:                                                                   *
+ *      out (tmpl_UnpackedQuadruple):                                         *
+ *          The unpacked form of x.                                           *
+ *  Called Functions:                                                         *
+ *      src/quadruple/auxiliary/tmpl_quadruple_clz64.h:                       *
+ *          tmpl_Quadruple_CLZ64:                                             *
+ *              Counts leading zeros, used for normalizing subnormals.        *
+ *      src/quadruple/auxiliary/tmpl_quadruple_shift_left128.h:               *
+ *          tmpl_Quadruple_Shift_Left128:                                     *
+ *              Shifts a 128-bit number left.                                 *
+ *  Method:                                                                   *
+ *      Gather the seven 16-bit mantissa fields into two 64-bit words and     *
+ *      add the implicit leading bit. Subnormal numbers have no leading bit,  *
+ *      so shift them until bit 112 is set and lower the exponent to match.   *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_quadruple.h:                                                     *
+ *          Header file where the function prototype is given.                *
+ *  2.) tmpl_quadruple_limbs.h:                                               *
+ *          Binary128 constants and typedefs.                                 *
+ *  3.) tmpl_quadruple_clz64.h:                                               *
+ *          Counts leading zeros.                                             *
+ *  4.) tmpl_quadruple_shift_left128.h:                                       *
+ *          Left shift of 128-bit integers.                                   *
+ *  5.) tmpl_quadruple_special.h:                                             *
+ *          Creates zeros, infinities, and NaN.                               *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_quadruple.h>
+
+/*  The unpacked form needs 64-bit integers.                                  */
+#if TMPL_HAS_64_BIT_INT == 1
+
+/*  Binary128 constants, shifts, and special values found here.               */
+#include "auxiliary/tmpl_quadruple_limbs.h"
+#include "auxiliary/tmpl_quadruple_clz64.h"
+#include "auxiliary/tmpl_quadruple_shift_left128.h"
+#include "auxiliary/tmpl_quadruple_special.h"
+
+/*  Function for unpacking a quadruple.                                       */
+tmpl_UnpackedQuadruple tmpl_Quadruple_Unpack(tmpl_Quadruple x)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_UnpackedQuadruple out;
+    int shift;
+
+    out.is_negative = (tmpl_Bool)(x.sign != 0);
+
+    /*  mant7 holds the highest 16 bits of the mantissa, mant1 the lowest.    */
+    out.hi = ((tmpl_UInt64)x.mant7 << 32) |
+             ((tmpl_UInt64)x.mant6 << 16) |
+              (tmpl_UInt64)x.mant5;
+
+    out.lo = ((tmpl_UInt64)x.mant4 << 48) |
+             ((tmpl_UInt64)x.mant3 << 32) |
+             ((tmpl_UInt64)x.mant2 << 16) |
+              (tmpl_UInt64)x.mant1;
+
+    /*  All exponent bits set, infinity or NaN.                               */
+    if (x.exponent == 0x7FFFU)
+    {
+        out.kind = (out.hi | out.lo ? TMPL_QUADRUPLE_NAN : TMPL_QUADRUPLE_INF);
+        out.hi = 0;
+        out.lo = 0;
+        out.expo = 0;
+        return out;
+    }
+
+    /*  Normal number, add the implicit leading bit.                          */
+    if (x.exponent != 0)
+    {
+        out.hi |= TMPL_QUADRUPLE_HIDDEN_BIT;
+        out.expo = (signed long int)x.exponent - TMPL_QUADRUPLE_BIAS;
+        out.kind = TMPL_QUADRUPLE_FINITE;
+        return out;
+    }
+
+    if (!(out.hi | out.lo))
+        return tmpl_UnpackedQuadruple_Special(TMPL_QUADRUPLE_ZERO,
+                                              out.is_negative);
+
+    /*  Subnormal number. Shift the leading bit up to bit 112.                */
+    if (out.hi)
+        shift = tmpl_Quadruple_CLZ64(out.hi) - 15;
+    else
+        shift = 64 + tmpl_Quadruple_CLZ64(out.lo) - 15;
+
+    tmpl_Quadruple_Shift_Left128(&out.hi, &out.lo, (unsigned long int)shift);
+    out.expo = TMPL_QUADRUPLE_EMIN - shift;
+    out.kind = TMPL_QUADRUPLE_FINITE;
+    return out;
+}
+/*  End of tmpl_Quadruple_Unpack.                                             */
+
+#endif
+/*  End of #if TMPL_HAS_64_BIT_INT == 1.                                      */
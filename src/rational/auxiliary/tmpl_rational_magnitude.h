@@ -0,0 +1,145 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                          tmpl_rational_magnitude                           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Reduced sign-magnitude form for the checked rational arithmetic.      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_RationalMagnitude_Normalize                                      *
+ *  Purpose:                                                                  *
+ *      Converts a rational number into reduced sign-magnitude form.          *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      tmpl_RationalMagnitude_As_Rational                                    *
+ *  Purpose:                                                                  *
+ *      Converts a reduced sign-magnitude number back into a rational         *
+ *      number, checking that it fits.                                        *
+ *  Method:                                                                   *
+ *      All numbers are kept reduced, in sign-magnitude form, with numerator  *
+ *      and denominator at most LONG_MAX + 1. This is the magnitude of        *
+ *      LONG_MIN, so every input can be represented. Since the result is      *
+ *      reduced, it is representable if and only if its denominator is at     *
+ *      most LONG_MAX, and its numerator is at most LONG_MAX, or              *
+ *      LONG_MAX + 1 if the result is negative. This is checked when          *
+ *      converting back to a rational number.                                 *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) limits.h:                                                             *
+ *          Standard library header file with LONG_MAX.                       *
+ *  2.) tmpl_config.h:                                                        *
+ *          Header file containing TMPL_STATIC_INLINE macro.                  *
+ *  3.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  4.) tmpl_integer.h:                                                       *
+ *          Header file with tmpl_ULong_GCD_Mixed_Binary.                     *
+ *  5.) tmpl_rational.h:                                                      *
+ *          Header file with the tmpl_RationalNumber typedef.                 *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_RATIONAL_MAGNITUDE_H
+#define TMPL_RATIONAL_MAGNITUDE_H
+
+/*  LONG_MAX found here.                                                      */
+#include <limits.h>
+
+/*  Location of the TMPL_STATIC_INLINE macro.                                 */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  tmpl_ULong_GCD_Mixed_Binary function found here.                          */
+#include <libtmpl/include/tmpl_integer.h>
+
+/*  tmpl_RationalNumber typedef given here.                                   */
+#include <libtmpl/include/tmpl_rational.h>
+
+/*  A rational number (-1)^negative * numer / denom in lowest terms, with     *
+ *  0 < denom and numer, denom <= LONG_MAX + 1. Zero is 0 / 1, not negative.  */
+typedef struct tmpl_RationalMagnitude_Def {
+    unsigned long int numer;
+    unsigned long int denom;
+    tmpl_Bool negative;
+} tmpl_RationalMagnitude;
+
+/*  Converts p to reduced sign-magnitude form. Returns false if the           *
+ *  denominator is zero. Every other input, including LONG_MIN, fits.         */
+TMPL_STATIC_INLINE
+tmpl_Bool
+tmpl_RationalMagnitude_Normalize(const tmpl_RationalNumber *p,
+                                 tmpl_RationalMagnitude *m)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned long int numer, denom, gcd;
+    const signed long int n = p->numerator;
+    const signed long int d = p->denominator;
+
+    if (!d)
+        return tmpl_False;
+
+    /*  The absolute values, written so that LONG_MIN does not overflow.      */
+    numer = (n < 0L ? (unsigned long int)(-(n + 1L)) + 1UL
+                    : (unsigned long int)n);
+    denom = (d < 0L ? (unsigned long int)(-(d + 1L)) + 1UL
+                    : (unsigned long int)d);
+
+    /*  GCD(0, d) = d, so zero becomes 0 / 1 here as well.                    */
+    gcd = tmpl_ULong_GCD_Mixed_Binary(numer, denom);
+    m->numer = numer / gcd;
+    m->denom = denom / gcd;
+    m->negative = (numer && ((n < 0L) != (d < 0L)));
+    return tmpl_True;
+}
+/*  End of tmpl_RationalMagnitude_Normalize.                                  */
+
+/*  Converts a reduced sign-magnitude number to a rational number. Returns    *
+ *  false, leaving p unchanged, if the result does not fit in signed longs.   */
+TMPL_STATIC_INLINE
+tmpl_Bool
+tmpl_RationalMagnitude_As_Rational(const tmpl_RationalMagnitude *m,
+                                   tmpl_RationalNumber *p)
+{
+    /*  A negative numerator may be one larger, since -LONG_MIN = LONG_MAX+1. */
+    const unsigned long int numer_max =
+        (unsigned long int)LONG_MAX + (m->negative ? 1UL : 0UL);
+
+    if (m->numer > numer_max || m->denom > (unsigned long int)LONG_MAX)
+        return tmpl_False;
+
+    /*  Zero is never negative, so numer - 1 <= LONG_MAX and this is safe.    */
+    if (m->negative)
+        p->numerator = -(signed long int)(m->numer - 1UL) - 1L;
+    else
+        p->numerator = (signed long int)m->numer;
+
+    p->denominator = (signed long int)m->denom;
+    return tmpl_True;
+}
+/*  End of tmpl_RationalMagnitude_As_Rational.                                */
+
+#endif
+/*  End of include guard.                                                     */
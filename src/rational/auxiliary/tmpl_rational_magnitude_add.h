@@ -0,0 +1,277 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                        tmpl_rational_magnitude_add                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Overflow-checked addition of reduced rational numbers.                *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_RationalWide_Add                                                 *
+ *  Purpose:                                                                  *
+ *      Adds two double-width words.                                          *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      tmpl_RationalWide_Subtract                                            *
+ *  Purpose:                                                                  *
+ *      Subtracts two double-width words.                                     *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      tmpl_RationalWide_Is_Less                                             *
+ *  Purpose:                                                                  *
+ *      Compares two double-width words.                                      *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      tmpl_RationalWide_Is_Zero                                             *
+ *  Purpose:                                                                  *
+ *      Checks if a double-width word is zero.                                *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      tmpl_RationalWide_Mod                                                 *
+ *  Purpose:                                                                  *
+ *      Reduces a double-width word modulo an unsigned long.                  *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      tmpl_RationalMagnitude_Add                                            *
+ *  Purpose:                                                                  *
+ *      Adds two reduced numbers, checking that the result fits.              *
+ *  Method:                                                                   *
+ *      Henrici's algorithm. To compute a/b + c/d, let g = GCD(b, d). Then:   *
+ *                                                                            *
+ *              a     c     a (d / g) + c (b / g)       t                     *
+ *              -  +  -  =  ---------------------  =  ----------              *
+ *              b     d        (b / g) (d / g) g      (b / g) d               *
+ *                                                                            *
+ *      Any common factor of t and the denominator divides g, so with         *
+ *      g' = GCD(t, g), the reduced sum is (t / g') / ((b / g) (d / g')).     *
+ *      Only GCDs of denominators are needed, never GCDs of the much larger   *
+ *      cross products. t is the only intermediate that can exceed a word,    *
+ *      and it is computed with the routines from tmpl_rational_wide.h.       *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file containing TMPL_STATIC_INLINE macro.                  *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_limits.h:                                                        *
+ *          Header file with the widths of the integer types.                 *
+ *  4.) tmpl_integer.h:                                                       *
+ *          Header file with tmpl_ULong_GCD_Mixed_Binary.                     *
+ *  5.) tmpl_rational_wide.h:                                                 *
+ *          Double-width products and quotients.                              *
+ *  6.) tmpl_rational_magnitude.h:                                            *
+ *          The reduced sign-magnitude form.                                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_RATIONAL_MAGNITUDE_ADD_H
+#define TMPL_RATIONAL_MAGNITUDE_ADD_H
+
+/*  Location of the TMPL_STATIC_INLINE macro.                                 */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Bit widths of the integer types.                                          */
+#include <libtmpl/include/tmpl_limits.h>
+
+/*  tmpl_ULong_GCD_Mixed_Binary function found here.                          */
+#include <libtmpl/include/tmpl_integer.h>
+
+/*  tmpl_RationalWide typedef and products found here.                        */
+#include "tmpl_rational_wide.h"
+
+/*  tmpl_RationalMagnitude typedef given here.                                */
+#include "tmpl_rational_magnitude.h"
+
+/*  Computes a + b. The callers ensure the sum does not wrap.                 */
+TMPL_STATIC_INLINE
+tmpl_RationalWide
+tmpl_RationalWide_Add(tmpl_RationalWide a, tmpl_RationalWide b)
+{
+#if TMPL_RATIONAL_WIDE_IS_NATIVE
+    return a + b;
+#else
+    tmpl_RationalWide sum;
+    sum.lo = a.lo + b.lo;
+    sum.hi = a.hi + b.hi + (sum.lo < a.lo ? 1UL : 0UL);
+    return sum;
+#endif
+}
+/*  End of tmpl_RationalWide_Add.                                             */
+
+/*  Computes a - b, where a >= b.                                             */
+TMPL_STATIC_INLINE
+tmpl_RationalWide
+tmpl_RationalWide_Subtract(tmpl_RationalWide a, tmpl_RationalWide b)
+{
+#if TMPL_RATIONAL_WIDE_IS_NATIVE
+    return a - b;
+#else
+    tmpl_RationalWide diff;
+    diff.lo = a.lo - b.lo;
+    diff.hi = a.hi - b.hi - (a.lo < b.lo ? 1UL : 0UL);
+    return diff;
+#endif
+}
+/*  End of tmpl_RationalWide_Subtract.                                        */
+
+/*  Returns true if a < b.                                                    */
+TMPL_STATIC_INLINE
+tmpl_Bool tmpl_RationalWide_Is_Less(tmpl_RationalWide a, tmpl_RationalWide b)
+{
+#if TMPL_RATIONAL_WIDE_IS_NATIVE
+    return a < b;
+#else
+    return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+#endif
+}
+/*  End of tmpl_RationalWide_Is_Less.                                         */
+
+/*  Returns true if a is zero.                                                */
+TMPL_STATIC_INLINE
+tmpl_Bool tmpl_RationalWide_Is_Zero(tmpl_RationalWide a)
+{
+#if TMPL_RATIONAL_WIDE_IS_NATIVE
+    return !a;
+#else
+    return !a.hi && !a.lo;
+#endif
+}
+/*  End of tmpl_RationalWide_Is_Zero.                                         */
+
+/*  Computes a mod g for 0 < g <= LONG_MAX + 1.                               */
+TMPL_STATIC_INLINE
+unsigned long int
+tmpl_RationalWide_Mod(tmpl_RationalWide a, unsigned long int g)
+{
+#if TMPL_RATIONAL_WIDE_IS_NATIVE
+    return (unsigned long int)(a % g);
+#else
+    int bit;
+    unsigned long int rem = a.hi % g;
+
+    /*  Bring down one bit of the low word at a time. Since rem < g, and g    *
+     *  is at most LONG_MAX + 1, doubling rem never wraps.                    */
+    for (bit = TMPL_ULONG_BIT - 1; bit >= 0; --bit)
+    {
+        rem = (rem << 1) | ((a.lo >> bit) & 1UL);
+
+        if (rem >= g)
+            rem -= g;
+    }
+
+    return rem;
+#endif
+}
+/*  End of tmpl_RationalWide_Mod.                                             */
+
+/*  Computes sum = x + y using Henrici's algorithm. Returns false, leaving    *
+ *  sum unchanged, if the reduced sum has a numerator or denominator larger   *
+ *  than LONG_MAX + 1. sum may alias x or y.                                  */
+TMPL_STATIC_INLINE
+tmpl_Bool
+tmpl_RationalMagnitude_Add(const tmpl_RationalMagnitude *x,
+                           const tmpl_RationalMagnitude *y,
+                           tmpl_RationalMagnitude *sum)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned long int g, xg, yg, g2, numer, denom;
+    tmpl_RationalWide xt, yt, t, wide_denom;
+    tmpl_Bool negative;
+
+    /*  Adding zero is trivial and common, skip the GCD computations.         */
+    if (!y->numer)
+    {
+        *sum = *x;
+        return tmpl_True;
+    }
+
+    if (!x->numer)
+    {
+        *sum = *y;
+        return tmpl_True;
+    }
+
+    /*  The cross products a (d / g) and c (b / g). Both are at most          *
+     *  (LONG_MAX + 1)^2, a quarter of the double-width word, so their sum    *
+     *  cannot wrap.                                                          */
+    g = tmpl_ULong_GCD_Mixed_Binary(x->denom, y->denom);
+    xg = x->denom / g;
+    yg = y->denom / g;
+    xt = tmpl_RationalWide_Multiply(x->numer, yg);
+    yt = tmpl_RationalWide_Multiply(y->numer, xg);
+
+    /*  Combine the signed cross products.                                    */
+    if (x->negative == y->negative)
+    {
+        t = tmpl_RationalWide_Add(xt, yt);
+        negative = x->negative;
+    }
+
+    else if (tmpl_RationalWide_Is_Less(xt, yt))
+    {
+        t = tmpl_RationalWide_Subtract(yt, xt);
+        negative = y->negative;
+    }
+
+    else
+    {
+        t = tmpl_RationalWide_Subtract(xt, yt);
+        negative = x->negative;
+    }
+
+    /*  The terms cancelled. The sum is 0 / 1.                                */
+    if (tmpl_RationalWide_Is_Zero(t))
+    {
+        sum->numer = 0UL;
+        sum->denom = 1UL;
+        sum->negative = tmpl_False;
+        return tmpl_True;
+    }
+
+    /*  Any common factor of t and the denominator divides g.                 */
+    if (g == 1UL)
+        g2 = 1UL;
+    else
+        g2 = tmpl_ULong_GCD_Mixed_Binary(tmpl_RationalWide_Mod(t, g), g);
+
+    if (!tmpl_RationalWide_Divide(t, g2, &numer))
+        return tmpl_False;
+
+    wide_denom = tmpl_RationalWide_Multiply(xg, y->denom / g2);
+
+    if (!tmpl_RationalWide_Divide(wide_denom, 1UL, &denom))
+        return tmpl_False;
+
+    sum->numer = numer;
+    sum->denom = denom;
+    sum->negative = negative;
+    return tmpl_True;
+}
+/*  End of tmpl_RationalMagnitude_Add.                                        */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,116 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                      tmpl_rational_magnitude_multiply                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Overflow-checked multiplication of reduced rational numbers.          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_RationalMagnitude_Multiply                                       *
+ *  Purpose:                                                                  *
+ *      Multiplies two reduced numbers, checking that the result fits.        *
+ *  Method:                                                                   *
+ *      For a/b * c/d, the factors g1 = GCD(a, d) and g2 = GCD(c, b) are      *
+ *      cancelled before multiplying, and the product                         *
+ *      (a / g1)(c / g2) / ((b / g2)(d / g1)) is reduced. The products are    *
+ *      computed in a double-width word.                                      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file containing TMPL_STATIC_INLINE macro.                  *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_integer.h:                                                       *
+ *          Header file with tmpl_ULong_GCD_Mixed_Binary.                     *
+ *  4.) tmpl_rational_wide.h:                                                 *
+ *          Double-width products and quotients.                              *
+ *  5.) tmpl_rational_magnitude.h:                                            *
+ *          The reduced sign-magnitude form.                                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_RATIONAL_MAGNITUDE_MULTIPLY_H
+#define TMPL_RATIONAL_MAGNITUDE_MULTIPLY_H
+
+/*  Location of the TMPL_STATIC_INLINE macro.                                 */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  tmpl_ULong_GCD_Mixed_Binary function found here.                          */
+#include <libtmpl/include/tmpl_integer.h>
+
+/*  tmpl_RationalWide typedef and products found here.                        */
+#include "tmpl_rational_wide.h"
+
+/*  tmpl_RationalMagnitude typedef given here.                                */
+#include "tmpl_rational_magnitude.h"
+
+/*  Computes prod = x * y, cancelling common factors first. Returns false,    *
+ *  leaving prod unchanged, if the reduced product has a numerator or         *
+ *  denominator larger than LONG_MAX + 1.                                     */
+TMPL_STATIC_INLINE
+tmpl_Bool
+tmpl_RationalMagnitude_Multiply(const tmpl_RationalMagnitude *x,
+                                const tmpl_RationalMagnitude *y,
+                                tmpl_RationalMagnitude *prod)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    unsigned long int g1, g2, numer, denom;
+    tmpl_RationalWide wide;
+
+    /*  A zero factor gives 0 / 1. The formula below would not reduce this.   */
+    if (!x->numer || !y->numer)
+    {
+        prod->numer = 0UL;
+        prod->denom = 1UL;
+        prod->negative = tmpl_False;
+        return tmpl_True;
+    }
+
+    /*  x and y are reduced, so these are the only possible common factors.   */
+    g1 = tmpl_ULong_GCD_Mixed_Binary(x->numer, y->denom);
+    g2 = tmpl_ULong_GCD_Mixed_Binary(y->numer, x->denom);
+
+    wide = tmpl_RationalWide_Multiply(x->numer / g1, y->numer / g2);
+
+    if (!tmpl_RationalWide_Divide(wide, 1UL, &numer))
+        return tmpl_False;
+
+    wide = tmpl_RationalWide_Multiply(x->denom / g2, y->denom / g1);
+
+    if (!tmpl_RationalWide_Divide(wide, 1UL, &denom))
+        return tmpl_False;
+
+    prod->numer = numer;
+    prod->denom = denom;
+    prod->negative = (x->negative != y->negative);
+    return tmpl_True;
+}
+/*  End of tmpl_RationalMagnitude_Multiply.                                   */
+
+#endif
+/*  End of include guard.                                                     */
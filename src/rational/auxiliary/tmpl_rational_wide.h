@@ -0,0 +1,193 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                             tmpl_rational_wide                             *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Double-width unsigned words for the checked rational arithmetic.      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_RationalWide_Multiply                                            *
+ *  Purpose:                                                                  *
+ *      Computes the double-width product of two unsigned longs.              *
+ *                                                                            *
+ *  Function Name:                                                            *
+ *      tmpl_RationalWide_Divide                                              *
+ *  Purpose:                                                                  *
+ *      Divides a double-width word by an unsigned long, checking that        *
+ *      the quotient is at most LONG_MAX + 1.                                 *
+ *  Method:                                                                   *
+ *      The numerators and denominators in the checked arithmetic are at      *
+ *      most LONG_MAX + 1, but their products are not. These are computed in  *
+ *      a double-width word: unsigned long long if it is twice as wide as     *
+ *      unsigned long, otherwise the GCC __int128 extension if available,     *
+ *      and otherwise a pair of unsigned longs with schoolbook                *
+ *      multiplication and bitwise long division.                             *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) limits.h:                                                             *
+ *          Standard library header file with LONG_MAX.                       *
+ *  2.) tmpl_config.h:                                                        *
+ *          Header file containing TMPL_STATIC_INLINE macro.                  *
+ *  3.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  4.) tmpl_inttype.h:                                                       *
+ *          Header file providing TMPL_HAS_LONGLONG.                          *
+ *  5.) tmpl_limits.h:                                                        *
+ *          Header file with the widths of the integer types.                 *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_RATIONAL_WIDE_H
+#define TMPL_RATIONAL_WIDE_H
+
+/*  LONG_MAX found here.                                                      */
+#include <limits.h>
+
+/*  Location of the TMPL_STATIC_INLINE macro.                                 */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  TMPL_HAS_LONGLONG macro provided here.                                    */
+#include <libtmpl/include/tmpl_inttype.h>
+
+/*  Bit widths of the integer types.                                          */
+#include <libtmpl/include/tmpl_limits.h>
+
+/*  The magnitude of LONG_MIN, the largest magnitude a signed long can hold.  */
+#define TMPL_RATIONAL_MAX_MAGNITUDE ((unsigned long int)LONG_MAX + 1UL)
+
+/*  Pick an unsigned word at least twice as wide as an unsigned long.         */
+#if TMPL_HAS_LONGLONG == 1 && TMPL_ULLONG_BIT >= 2 * TMPL_ULONG_BIT
+typedef unsigned long long int tmpl_RationalWide;
+#define TMPL_RATIONAL_WIDE_IS_NATIVE 1
+#elif defined(__SIZEOF_INT128__) && TMPL_ULONG_BIT <= 64
+__extension__ typedef unsigned __int128 tmpl_RationalWide;
+#define TMPL_RATIONAL_WIDE_IS_NATIVE 1
+#else
+typedef struct tmpl_RationalWide_Def {
+    unsigned long int hi;
+    unsigned long int lo;
+} tmpl_RationalWide;
+#define TMPL_RATIONAL_WIDE_IS_NATIVE 0
+
+/*  Half the width of an unsigned long, used for schoolbook multiplication.   */
+#define TMPL_RATIONAL_HALF_BIT (TMPL_ULONG_BIT / 2)
+#define TMPL_RATIONAL_HALF_MASK ((1UL << TMPL_RATIONAL_HALF_BIT) - 1UL)
+#endif
+
+/*  Computes the double-width product x * y.                                  */
+TMPL_STATIC_INLINE
+tmpl_RationalWide
+tmpl_RationalWide_Multiply(unsigned long int x, unsigned long int y)
+{
+#if TMPL_RATIONAL_WIDE_IS_NATIVE
+    return (tmpl_RationalWide)x * (tmpl_RationalWide)y;
+#else
+    tmpl_RationalWide prod;
+    const unsigned long int x0 = x & TMPL_RATIONAL_HALF_MASK;
+    const unsigned long int x1 = x >> TMPL_RATIONAL_HALF_BIT;
+    const unsigned long int y0 = y & TMPL_RATIONAL_HALF_MASK;
+    const unsigned long int y1 = y >> TMPL_RATIONAL_HALF_BIT;
+    const unsigned long int p00 = x0 * y0;
+    const unsigned long int p01 = x0 * y1;
+    const unsigned long int p10 = x1 * y0;
+
+    /*  The middle column is a sum of three half words, so it cannot wrap.    */
+    const unsigned long int mid = (p00 >> TMPL_RATIONAL_HALF_BIT) +
+                                  (p01 & TMPL_RATIONAL_HALF_MASK) +
+                                  (p10 & TMPL_RATIONAL_HALF_MASK);
+
+    prod.lo = (p00 & TMPL_RATIONAL_HALF_MASK) |
+              (mid << TMPL_RATIONAL_HALF_BIT);
+
+    prod.hi = x1 * y1 + (p01 >> TMPL_RATIONAL_HALF_BIT) +
+              (p10 >> TMPL_RATIONAL_HALF_BIT) +
+              (mid >> TMPL_RATIONAL_HALF_BIT);
+
+    return prod;
+#endif
+}
+/*  End of tmpl_RationalWide_Multiply.                                        */
+
+/*  Computes quot = a / g for 0 < g <= LONG_MAX + 1, where g divides a.       *
+ *  Returns false if the quotient is larger than LONG_MAX + 1.                */
+TMPL_STATIC_INLINE
+tmpl_Bool
+tmpl_RationalWide_Divide(tmpl_RationalWide a,
+                         unsigned long int g,
+                         unsigned long int *quot)
+{
+#if TMPL_RATIONAL_WIDE_IS_NATIVE
+    const tmpl_RationalWide q = a / g;
+
+    if (q > (tmpl_RationalWide)TMPL_RATIONAL_MAX_MAGNITUDE)
+        return tmpl_False;
+
+    *quot = (unsigned long int)q;
+    return tmpl_True;
+#else
+    int bit;
+    unsigned long int rem, q;
+
+    /*  If the high word is at least g, the quotient needs two words.         */
+    if (a.hi >= g)
+        return tmpl_False;
+
+    rem = a.hi;
+    q = 0UL;
+
+    /*  Bitwise long division. As in tmpl_RationalWide_Mod, rem never wraps.  */
+    for (bit = TMPL_ULONG_BIT - 1; bit >= 0; --bit)
+    {
+        rem = (rem << 1) | ((a.lo >> bit) & 1UL);
+        q <<= 1;
+
+        if (rem >= g)
+        {
+            rem -= g;
+            q |= 1UL;
+        }
+    }
+
+    if (q > TMPL_RATIONAL_MAX_MAGNITUDE)
+        return tmpl_False;
+
+    *quot = q;
+    return tmpl_True;
+#endif
+}
+/*  End of tmpl_RationalWide_Divide.                                          */
+
+#undef TMPL_RATIONAL_MAX_MAGNITUDE
+
+#if !TMPL_RATIONAL_WIDE_IS_NATIVE
+#undef TMPL_RATIONAL_HALF_BIT
+#undef TMPL_RATIONAL_HALF_MASK
+#endif
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,366 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                          tmpl_rational_array_sum                           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Code for exactly summing, or multiplying, arrays of rational numbers. *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_RationalNumber_Array_Sum                                         *
+ *      tmpl_RationalNumber_Array_Product                                     *
+ *  Purpose:                                                                  *
+ *      Computes the exact sum, or product, of an array of rational numbers.  *
+ *  Arguments:                                                                *
+ *      arr (const tmpl_RationalNumber *):                                    *
+ *          An array of rational numbers.                                     *
+ *      len (size_t):                                                         *
+ *          The number of elements in arr.                                    *
+ *      out (tmpl_RationalNumber *):                                          *
+ *          The sum, or product, of the elements of arr.                      *
+ *  Output:                                                                   *
+ *      success (tmpl_Bool):                                                  *
+ *          True if the result could be computed, false otherwise.            *
+ *  Called Functions:                                                         *
+ *      src/rational/auxiliary/tmpl_rational_magnitude.h:                     *
+ *          tmpl_RationalMagnitude_Normalize:                                 *
+ *              Reduces the elements to lowest terms.                         *
+ *          tmpl_RationalMagnitude_As_Rational:                               *
+ *              Converts the reduced result back into a rational number.      *
+ *      src/rational/auxiliary/tmpl_rational_magnitude_add.h:                 *
+ *          tmpl_RationalMagnitude_Add:                                       *
+ *              Adds two reduced numbers using Henrici's algorithm.           *
+ *      src/rational/auxiliary/tmpl_rational_magnitude_multiply.h:            *
+ *          tmpl_RationalMagnitude_Multiply:                                  *
+ *              Multiplies two reduced numbers, cancelling common factors.    *
+ *      src/bigint/                                                           *
+ *          tmpl_BigInt_Init:                                                 *
+ *              Initializes a big integer to zero.                            *
+ *          tmpl_BigInt_Destroy:                                              *
+ *              Frees the memory in a big integer.                            *
+ *          tmpl_BigInt_Set_ULong:                                            *
+ *              Sets a big integer to an unsigned long.                       *
+ *          tmpl_BigInt_Add:                                                  *
+ *              Adds two big integers.                                        *
+ *          tmpl_BigInt_Subtract:                                             *
+ *              Subtracts two big integers.                                   *
+ *          tmpl_BigInt_Multiply:                                             *
+ *              Multiplies two big integers.                                  *
+ *          tmpl_BigInt_DivRem:                                               *
+ *              Divides two big integers.                                     *
+ *          tmpl_BigInt_GCD:                                                  *
+ *              Computes the GCD of two big integers.                         *
+ *          tmpl_BigInt_To_Long:                                              *
+ *              Converts a big integer to a signed long, if it fits.          *
+ *  Method:                                                                   *
+ *      Keep the running result in reduced sign-magnitude form, and fold the  *
+ *      elements in one at a time. Each element is reduced once, and the      *
+ *      running result is never converted back until the end. Since every     *
+ *      partial result is in lowest terms, the denominators stay as small as  *
+ *      possible.                                                             *
+ *                                                                            *
+ *      A partial result may not fit in a word even if the final result       *
+ *      does, for example LONG_MAX + LONG_MAX - LONG_MAX. If this happens,    *
+ *      the rest of the fold is done with big integers, and the result is     *
+ *      reduced and range checked once at the end. The product first scans    *
+ *      the array for zeros, since a zero factor makes the product zero no    *
+ *      matter how large the other factors are.                               *
+ *  Notes:                                                                    *
+ *      1.) The sum of an empty array is 0 / 1, and the product is 1 / 1.     *
+ *                                                                            *
+ *      2.) False is returned if a denominator is zero, if arr is NULL and    *
+ *          len is positive, if out is NULL, if the final result in lowest    *
+ *          terms does not fit in signed longs, or if malloc fails in the     *
+ *          big integer fallback. In this case out is not modified.           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) stddef.h:                                                             *
+ *          Standard header file containing the size_t typedef.               *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_bigint.h:                                                        *
+ *          Header file with the big integer routines.                        *
+ *  4.) tmpl_rational.h:                                                      *
+ *          Header file where the function prototypes are given.              *
+ *  5.) tmpl_rational_magnitude.h:                                            *
+ *          Reduced sign-magnitude form of rational numbers.                  *
+ *  6.) tmpl_rational_magnitude_add.h:                                        *
+ *          Overflow-checked addition of reduced numbers.                     *
+ *  7.) tmpl_rational_magnitude_multiply.h:                                   *
+ *          Overflow-checked multiplication of reduced numbers.               *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  size_t typedef found here.                                                */
+#include <stddef.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  tmpl_BigInt typedef and functions found here.                             */
+#include <libtmpl/include/tmpl_bigint.h>
+
+/*  Rational numbers and function prototypes found here.                      */
+#include <libtmpl/include/tmpl_rational.h>
+
+/*  Reduced sign-magnitude form found here.                                   */
+#include "auxiliary/tmpl_rational_magnitude.h"
+
+/*  Henrici's algorithm and cross-cancelling multiplication found here.       */
+#include "auxiliary/tmpl_rational_magnitude_add.h"
+#include "auxiliary/tmpl_rational_magnitude_multiply.h"
+
+/*  Sets x to the signed value (-1)^negative * mag.                           */
+static void
+tmpl_rational_set_bigint(tmpl_BigInt *x,
+                         unsigned long int mag,
+                         tmpl_Bool negative)
+{
+    tmpl_BigInt zero;
+
+    tmpl_BigInt_Set_ULong(x, mag);
+
+    /*  mag may be LONG_MAX + 1, which is not a signed long. Negate instead.  */
+    if (negative)
+    {
+        tmpl_BigInt_Init(&zero);
+        tmpl_BigInt_Subtract(x, &zero, x);
+        tmpl_BigInt_Destroy(&zero);
+    }
+}
+
+/*  Reduces numer / denom, for denom > 0, and converts it to a rational       *
+ *  number. Returns false, leaving out unchanged, if it does not fit or if an *
+ *  error occurred in numer or denom.                                         */
+static tmpl_Bool
+tmpl_rational_bigint_result(tmpl_BigInt *numer,
+                            tmpl_BigInt *denom,
+                            tmpl_RationalNumber *out)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    tmpl_BigInt gcd;
+    signed long int n, d;
+    tmpl_Bool fits;
+
+    /*  GCD(0, d) = d, so a zero numerator becomes 0 / 1 here.                */
+    tmpl_BigInt_Init(&gcd);
+    tmpl_BigInt_GCD(&gcd, numer, denom);
+    tmpl_BigInt_DivRem(numer, NULL, numer, &gcd);
+    tmpl_BigInt_DivRem(denom, NULL, denom, &gcd);
+    tmpl_BigInt_Destroy(&gcd);
+
+    /*  Errors propagate to numer and denom, and To_Long rejects them.        */
+    fits = tmpl_BigInt_To_Long(numer, &n) && tmpl_BigInt_To_Long(denom, &d);
+
+    if (fits)
+    {
+        out->numerator = n;
+        out->denominator = d;
+    }
+
+    return fits;
+}
+
+/*  Finishes a sum with big integers, starting from the partial sum start.    */
+static tmpl_Bool
+tmpl_rational_array_sum_bigint(const tmpl_RationalNumber *arr,
+                               size_t len,
+                               const tmpl_RationalMagnitude *start,
+                               tmpl_RationalNumber *out)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    tmpl_RationalMagnitude term;
+    tmpl_BigInt numer, denom, a, b, g;
+    tmpl_Bool success = tmpl_True;
+
+    tmpl_BigInt_Init(&numer);
+    tmpl_BigInt_Init(&denom);
+    tmpl_BigInt_Init(&a);
+    tmpl_BigInt_Init(&b);
+    tmpl_BigInt_Init(&g);
+
+    tmpl_rational_set_bigint(&numer, start->numer, start->negative);
+    tmpl_BigInt_Set_ULong(&denom, start->denom);
+
+    for (n = 0; n < len; ++n)
+    {
+        if (!tmpl_RationalMagnitude_Normalize(arr + n, &term))
+        {
+            success = tmpl_False;
+            break;
+        }
+
+        tmpl_rational_set_bigint(&a, term.numer, term.negative);
+        tmpl_BigInt_Set_ULong(&b, term.denom);
+
+        /*  With g = GCD(D, b), N / D + a / b is given by                     *
+         *  (N (b / g) + a (D / g)) / (D (b / g)). The denominator is the     *
+         *  least common multiple of the denominators seen so far.            */
+        tmpl_BigInt_GCD(&g, &denom, &b);
+        tmpl_BigInt_DivRem(&b, NULL, &b, &g);
+        tmpl_BigInt_DivRem(&g, NULL, &denom, &g);
+        tmpl_BigInt_Multiply(&numer, &numer, &b);
+        tmpl_BigInt_Multiply(&a, &a, &g);
+        tmpl_BigInt_Add(&numer, &numer, &a);
+        tmpl_BigInt_Multiply(&denom, &denom, &b);
+    }
+
+    if (success)
+        success = tmpl_rational_bigint_result(&numer, &denom, out);
+
+    tmpl_BigInt_Destroy(&numer);
+    tmpl_BigInt_Destroy(&denom);
+    tmpl_BigInt_Destroy(&a);
+    tmpl_BigInt_Destroy(&b);
+    tmpl_BigInt_Destroy(&g);
+    return success;
+}
+
+/*  Finishes a product with big integers, starting from the partial product   *
+ *  start. The elements have been checked, none are zero or have a zero       *
+ *  denominator.                                                              */
+static tmpl_Bool
+tmpl_rational_array_product_bigint(const tmpl_RationalNumber *arr,
+                                   size_t len,
+                                   const tmpl_RationalMagnitude *start,
+                                   tmpl_RationalNumber *out)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    tmpl_RationalMagnitude factor;
+    tmpl_BigInt numer, denom, a;
+    tmpl_Bool success;
+
+    tmpl_BigInt_Init(&numer);
+    tmpl_BigInt_Init(&denom);
+    tmpl_BigInt_Init(&a);
+
+    tmpl_rational_set_bigint(&numer, start->numer, start->negative);
+    tmpl_BigInt_Set_ULong(&denom, start->denom);
+
+    /*  The factors are reduced, the product is reduced once at the end.      */
+    for (n = 0; n < len; ++n)
+    {
+        tmpl_RationalMagnitude_Normalize(arr + n, &factor);
+        tmpl_rational_set_bigint(&a, factor.numer, factor.negative);
+        tmpl_BigInt_Multiply(&numer, &numer, &a);
+        tmpl_BigInt_Set_ULong(&a, factor.denom);
+        tmpl_BigInt_Multiply(&denom, &denom, &a);
+    }
+
+    success = tmpl_rational_bigint_result(&numer, &denom, out);
+
+    tmpl_BigInt_Destroy(&numer);
+    tmpl_BigInt_Destroy(&denom);
+    tmpl_BigInt_Destroy(&a);
+    return success;
+}
+
+/*  Function for exactly summing an array of rational numbers.                */
+tmpl_Bool
+tmpl_RationalNumber_Array_Sum(const tmpl_RationalNumber *arr,
+                              size_t len,
+                              tmpl_RationalNumber *out)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    tmpl_RationalMagnitude sum, term;
+
+    /*  Check for invalid inputs. Treat these as a failure.                   */
+    if (!out || (!arr && len))
+        return tmpl_False;
+
+    /*  The sum starts at 0 / 1.                                              */
+    sum.numer = 0UL;
+    sum.denom = 1UL;
+    sum.negative = tmpl_False;
+
+    for (n = 0; n < len; ++n)
+    {
+        if (!tmpl_RationalMagnitude_Normalize(arr + n, &term))
+            return tmpl_False;
+
+        /*  On overflow sum is unchanged. Redo this term with big integers.   */
+        if (!tmpl_RationalMagnitude_Add(&sum, &term, &sum))
+            return tmpl_rational_array_sum_bigint(arr + n, len - n, &sum, out);
+    }
+
+    /*  This fails if the result does not fit in signed longs.                */
+    return tmpl_RationalMagnitude_As_Rational(&sum, out);
+}
+/*  End of tmpl_RationalNumber_Array_Sum.                                     */
+
+/*  Function for exactly multiplying an array of rational numbers.            */
+tmpl_Bool
+tmpl_RationalNumber_Array_Product(const tmpl_RationalNumber *arr,
+                                  size_t len,
+                                  tmpl_RationalNumber *out)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    tmpl_RationalMagnitude prod, factor;
+    tmpl_Bool has_zero = tmpl_False;
+
+    /*  Check for invalid inputs. Treat these as a failure.                   */
+    if (!out || (!arr && len))
+        return tmpl_False;
+
+    /*  A zero factor makes the product zero, however large the others are.   *
+     *  Every denominator must still be checked.                              */
+    for (n = 0; n < len; ++n)
+    {
+        if (!arr[n].denominator)
+            return tmpl_False;
+
+        if (!arr[n].numerator)
+            has_zero = tmpl_True;
+    }
+
+    if (has_zero)
+    {
+        out->numerator = 0L;
+        out->denominator = 1L;
+        return tmpl_True;
+    }
+
+    /*  The product starts at 1 / 1.                                          */
+    prod.numer = 1UL;
+    prod.denom = 1UL;
+    prod.negative = tmpl_False;
+
+    for (n = 0; n < len; ++n)
+    {
+        /*  The denominators were checked above, so this cannot fail.         */
+        tmpl_RationalMagnitude_Normalize(arr + n, &factor);
+
+        /*  On overflow prod is unchanged. Redo this one with big integers.   */
+        if (!tmpl_RationalMagnitude_Multiply(&prod, &factor, &prod))
+            return tmpl_rational_array_product_bigint(arr + n, len - n,
+                                                      &prod, out);
+    }
+
+    /*  This fails if the result does not fit in signed longs.                */
+    return tmpl_RationalMagnitude_As_Rational(&prod, out);
+}
+/*  End of tmpl_RationalNumber_Array_Product.                                 */
@@ -0,0 +1,157 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                       tmpl_rational_checked_multiply                       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Code for multiplying and dividing rational numbers without overflow.  *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_RationalNumber_Checked_Multiply                                  *
+ *      tmpl_RationalNumber_Checked_Divide                                    *
+ *  Purpose:                                                                  *
+ *      Computes p * q, or p / q, in lowest terms, checking for overflow.     *
+ *  Arguments:                                                                *
+ *      p (const tmpl_RationalNumber *):                                      *
+ *          A rational number.                                                *
+ *      q (const tmpl_RationalNumber *):                                      *
+ *          Another rational number.                                          *
+ *      out (tmpl_RationalNumber *):                                          *
+ *          The product, or quotient, of p and q.                             *
+ *  Output:                                                                   *
+ *      success (tmpl_Bool):                                                  *
+ *          True if the result could be computed, false otherwise.            *
+ *  Called Functions:                                                         *
+ *      src/rational/auxiliary/tmpl_rational_magnitude.h:                     *
+ *          tmpl_RationalMagnitude_Normalize:                                 *
+ *              Reduces the inputs to lowest terms.                           *
+ *          tmpl_RationalMagnitude_As_Rational:                               *
+ *              Converts the reduced product back into a rational number.     *
+ *      src/rational/auxiliary/tmpl_rational_magnitude_multiply.h:            *
+ *          tmpl_RationalMagnitude_Multiply:                                  *
+ *              Multiplies two reduced numbers, cancelling common factors.    *
+ *  Method:                                                                   *
+ *      Reduce both inputs. For a/b * c/d, cancel GCD(a, d) and GCD(c, b)     *
+ *      before multiplying. The product of the remaining factors is already   *
+ *      in lowest terms, so it overflows only if the exact answer does not    *
+ *      fit. Division multiplies by the reciprocal of the reduced q.          *
+ *  Notes:                                                                    *
+ *      1.) The result is in lowest terms with a positive denominator.        *
+ *          LONG_MIN is allowed both as an input and as a result.             *
+ *                                                                            *
+ *      2.) False is returned if either denominator is zero, if q is zero     *
+ *          when dividing, if one of the pointers is NULL, or if the result   *
+ *          in lowest terms does not fit in signed longs. In this case out    *
+ *          is not modified.                                                  *
+ *                                                                            *
+ *      3.) out may point to p or q.                                          *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_rational.h:                                                      *
+ *          Header file where the function prototypes are given.              *
+ *  3.) tmpl_rational_magnitude.h:                                            *
+ *          Reduced sign-magnitude form of rational numbers.                  *
+ *  4.) tmpl_rational_magnitude_multiply.h:                                   *
+ *          Overflow-checked multiplication of reduced numbers.               *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Rational numbers and function prototypes found here.                      */
+#include <libtmpl/include/tmpl_rational.h>
+
+/*  Reduced sign-magnitude form found here.                                   */
+#include "auxiliary/tmpl_rational_magnitude.h"
+
+/*  Cross-cancelling multiplication found here.                               */
+#include "auxiliary/tmpl_rational_magnitude_multiply.h"
+
+/*  Function for multiplying two rational numbers with overflow checking.     */
+tmpl_Bool
+tmpl_RationalNumber_Checked_Multiply(const tmpl_RationalNumber *p,
+                                     const tmpl_RationalNumber *q,
+                                     tmpl_RationalNumber *out)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    tmpl_RationalMagnitude x, y;
+
+    /*  Check for NULL pointers. Treat these as a failure.                    */
+    if (!p || !q || !out)
+        return tmpl_False;
+
+    /*  Reduce the inputs. This fails for zero denominators.                  */
+    if (!tmpl_RationalMagnitude_Normalize(p, &x))
+        return tmpl_False;
+
+    if (!tmpl_RationalMagnitude_Normalize(q, &y))
+        return tmpl_False;
+
+    if (!tmpl_RationalMagnitude_Multiply(&x, &y, &x))
+        return tmpl_False;
+
+    /*  This fails if the result does not fit in signed longs.                */
+    return tmpl_RationalMagnitude_As_Rational(&x, out);
+}
+/*  End of tmpl_RationalNumber_Checked_Multiply.                              */
+
+/*  Function for dividing two rational numbers with overflow checking.        */
+tmpl_Bool
+tmpl_RationalNumber_Checked_Divide(const tmpl_RationalNumber *p,
+                                   const tmpl_RationalNumber *q,
+                                   tmpl_RationalNumber *out)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    tmpl_RationalMagnitude x, y;
+    unsigned long int swap;
+
+    /*  Check for NULL pointers. Treat these as a failure.                    */
+    if (!p || !q || !out)
+        return tmpl_False;
+
+    /*  Reduce the inputs. This fails for zero denominators.                  */
+    if (!tmpl_RationalMagnitude_Normalize(p, &x))
+        return tmpl_False;
+
+    if (!tmpl_RationalMagnitude_Normalize(q, &y))
+        return tmpl_False;
+
+    /*  Division by zero is undefined.                                        */
+    if (!y.numer)
+        return tmpl_False;
+
+    /*  p / q = p * (1 / q). The reciprocal of a reduced number is reduced.   */
+    swap = y.numer;
+    y.numer = y.denom;
+    y.denom = swap;
+
+    if (!tmpl_RationalMagnitude_Multiply(&x, &y, &x))
+        return tmpl_False;
+
+    /*  This fails if the result does not fit in signed longs.                */
+    return tmpl_RationalMagnitude_As_Rational(&x, out);
+}
+/*  End of tmpl_RationalNumber_Checked_Divide.                                */
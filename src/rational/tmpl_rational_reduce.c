@@ -35,7 +35,9 @@
  *      q (tmpl_RationalNumber):                                              *
  *          The number p in reduced form.                                     *
  *  Called Functions:                                                         *
- *      None.                                                                 *
+ *      tmpl_integer.h:                                                       *
+ *          tmpl_ULong_GCD_Mixed_Binary:                                      *
+ *              Computes the GCD of two unsigned longs.                       *
  *  Method:                                                                   *
  *      Find the GCD of the numerator and denominator and divide by this.     *
  ******************************************************************************
@@ -90,15 +92,11 @@ tmpl_RationalNumber_Reduce(const tmpl_RationalNumber *p)
     abs_numer = tmpl_Long_Abs(p->numerator);
     abs_denom = tmpl_Long_Abs(p->denominator);
 
-    /*  Get the GCD.                                                          */
-    while(abs_numer != abs_denom)
-    {
-        if (abs_numer > abs_denom)
-            abs_numer -= abs_denom;
-        else
-            abs_denom -= abs_numer;
-    }
-    GCD = abs_numer;
+    /*  Get the GCD. The subtractive algorithm takes time proportional to    *
+     *  the ratio of the two values, use the mixed binary algorithm instead.  */
+    GCD = (signed long int)tmpl_ULong_GCD_Mixed_Binary(
+        (unsigned long int)abs_numer, (unsigned long int)abs_denom
+    );
 
     /*  Compute the reduction of p.                                           */
     reduced_numer = p->numerator / GCD;
@@ -0,0 +1,100 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *               tmpl_complex_aberth_ehrlich_polynomial_double                *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes all roots of a polynomial with the default tolerances.       *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_CDouble_Aberth_Ehrlich_Polynomial                                *
+ *      tmpl_CDouble_Aberth_Ehrlich_Polynomial_Real_Coeffs                    *
+ *  Purpose:                                                                  *
+ *      Computes the roots of a_0 + a_1 z + ... + a_N z^N.                    *
+ *  Arguments:                                                                *
+ *      coeffs (const tmpl_ComplexDouble * const or const double * const):    *
+ *          The coefficients a_0, ..., a_N, in increasing order.              *
+ *      degree (size_t):                                                      *
+ *          The degree N. coeffs must have N + 1 elements.                    *
+ *      roots (tmpl_ComplexDouble * const):                                   *
+ *          The output array. It must have N elements.                        *
+ *  Output:                                                                   *
+ *      converged (size_t):                                                   *
+ *          The number of roots that converged, stored at the front of roots. *
+ *  Called Functions:                                                         *
+ *      tmpl_root_finding_complex.h:                                          *
+ *          tmpl_CDouble_Aberth_Ehrlich_Polynomial_With_Vars:                 *
+ *              Aberth-Ehrlich method with a given tolerance.                 *
+ *          tmpl_CDouble_Aberth_Ehrlich_Polynomial_Real_Coeffs_With_Vars:     *
+ *              Aberth-Ehrlich method for real coefficients.                  *
+ *  Method:                                                                   *
+ *      Call the _With_Vars functions with at most 100 sweeps and a relative  *
+ *      tolerance of 4 times the machine epsilon.                             *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_float.h:                                                         *
+ *          Header file with the machine epsilon.                             *
+ *  2.) tmpl_root_finding_complex.h:                                          *
+ *          Header file where the function prototypes are given.              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_DBL_EPS found here.                                                  */
+#include <libtmpl/include/tmpl_float.h>
+
+/*  Function prototypes given here.                                           */
+#include <libtmpl/include/tmpl_root_finding_complex.h>
+
+/*  Default values for the maximum number of sweeps and the tolerance.        */
+#define TMPL_ABERTH_MAX_ITERS (100U)
+#define TMPL_ABERTH_EPS (4.0 * TMPL_DBL_EPS)
+
+/*  Aberth-Ehrlich method for polynomials with complex coefficients.          */
+size_t
+tmpl_CDouble_Aberth_Ehrlich_Polynomial(
+    const tmpl_ComplexDouble * const coeffs, size_t degree,
+    tmpl_ComplexDouble * const roots
+)
+{
+    return tmpl_CDouble_Aberth_Ehrlich_Polynomial_With_Vars(
+        coeffs, degree, roots, TMPL_ABERTH_MAX_ITERS, TMPL_ABERTH_EPS
+    );
+}
+/*  End of tmpl_CDouble_Aberth_Ehrlich_Polynomial.                            */
+
+/*  Aberth-Ehrlich method for polynomials with real coefficients.             */
+size_t
+tmpl_CDouble_Aberth_Ehrlich_Polynomial_Real_Coeffs(
+    const double * const coeffs, size_t degree,
+    tmpl_ComplexDouble * const roots
+)
+{
+    return tmpl_CDouble_Aberth_Ehrlich_Polynomial_Real_Coeffs_With_Vars(
+        coeffs, degree, roots, TMPL_ABERTH_MAX_ITERS, TMPL_ABERTH_EPS
+    );
+}
+/*  End of tmpl_CDouble_Aberth_Ehrlich_Polynomial_Real_Coeffs.                */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_ABERTH_MAX_ITERS
+#undef TMPL_ABERTH_EPS
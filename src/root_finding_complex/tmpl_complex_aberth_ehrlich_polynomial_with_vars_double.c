@@ -0,0 +1,413 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *          tmpl_complex_aberth_ehrlich_polynomial_with_vars_double           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes all roots of a polynomial simultaneously.                    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_CDouble_Aberth_Ehrlich_Polynomial_With_Vars                      *
+ *      tmpl_CDouble_Aberth_Ehrlich_Polynomial_Real_Coeffs_With_Vars          *
+ *  Purpose:                                                                  *
+ *      Computes the roots of a_0 + a_1 z + ... + a_N z^N.                    *
+ *  Arguments:                                                                *
+ *      coeffs (const tmpl_ComplexDouble * const or const double * const):    *
+ *          The coefficients a_0, ..., a_N, in increasing order.              *
+ *      degree (size_t):                                                      *
+ *          The degree N. coeffs must have N + 1 elements.                    *
+ *      roots (tmpl_ComplexDouble * const):                                   *
+ *          The output array. It must have N elements.                        *
+ *      max_iters (unsigned int):                                             *
+ *          The maximum number of sweeps through the roots.                   *
+ *      eps (double):                                                         *
+ *          The relative tolerance for the size of the correction.            *
+ *  Output:                                                                   *
+ *      converged (size_t):                                                   *
+ *          The number of roots that converged. These are roots[0] up to      *
+ *          roots[converged - 1]. The remaining entries hold the current      *
+ *          estimates for the other roots.                                    *
+ *  Called Functions:                                                         *
+ *      tmpl_math.h:                                                          *
+ *          tmpl_Double_Abs:                                                  *
+ *              Computes the absolute value of a real number.                 *
+ *          tmpl_Double_Exp:                                                  *
+ *              Computes the exponential of a real number.                    *
+ *          tmpl_Double_Log:                                                  *
+ *              Computes the natural log of a real number.                    *
+ *          tmpl_Double_SinCos:                                               *
+ *              Computes sine and cosine simultaneously.                      *
+ *      tmpl_complex.h:                                                       *
+ *          tmpl_CDouble_Abs:                                                 *
+ *              Computes the modulus of a complex number.                     *
+ *          tmpl_CDouble_Multiply:                                            *
+ *              Multiplies two complex numbers.                               *
+ *          tmpl_CDouble_Divide:                                              *
+ *              Divides two complex numbers.                                  *
+ *  Method:                                                                   *
+ *      Start with N distinct seeds z_k on a circle whose radius is the       *
+ *      geometric mean of the moduli of the roots, (|a_0| / |a_N|)^(1 / N).   *
+ *      Each root is updated by the Aberth correction                         *
+ *                                                                            *
+ *                                    1                                       *
+ *          w_k = ---------------------------------------                     *
+ *                 p'(z_k)     ---          1                                 *
+ *                 -------  -  \      -------------                           *
+ *                 p(z_k)      /      z_k - z_j                               *
+ *                             ---                                            *
+ *                             j != k                                         *
+ *                                                                            *
+ *      and z_k is replaced with z_k - w_k. This is Newton's method with the  *
+ *      other roots divided out implicitly, and converges cubically for       *
+ *      simple roots. The new value of z_k is used right away for the other   *
+ *      roots, which speeds up convergence.                                   *
+ *                                                                            *
+ *      p(z) and p'(z) are computed together with one Horner pass, which      *
+ *      also gives the rounding error bound sum |a_j| |z|^j. A root has       *
+ *      converged if |w_k| <= eps |z_k|, or if |p(z_k)| is at the level of    *
+ *      the rounding error bound. The second test stops the iteration at      *
+ *      multiple roots, where convergence is only linear. Converged roots     *
+ *      are swapped to the front of the array and are no longer updated,      *
+ *      but are still used in the sums for the other roots.                   *
+ *  Notes:                                                                    *
+ *      1.) If coeffs or roots is NULL, nothing is done and zero is returned. *
+ *                                                                            *
+ *      2.) Leading zero coefficients lower the degree. The missing roots     *
+ *          are at infinity, and are set to NaN.                              *
+ *                                                                            *
+ *      3.) Trailing zero coefficients are exact roots at zero. They are      *
+ *          stored first, and the rest of the polynomial is solved.           *
+ *                                                                            *
+ *      4.) The roots are returned in no particular order.                    *
+ *                                                                            *
+ *      5.) The cost per sweep is O(N^2), and no memory is allocated.         *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_float.h:                                                         *
+ *          Header file with the machine epsilon.                             *
+ *  3.) tmpl_math.h:                                                          *
+ *          Header file with real functions.                                  *
+ *  4.) tmpl_complex.h:                                                       *
+ *          Header file with complex arithmetic.                              *
+ *  5.) tmpl_root_finding_complex.h:                                          *
+ *          Header file where the function prototypes are given.              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  TMPL_DBL_EPS found here.                                                  */
+#include <libtmpl/include/tmpl_float.h>
+
+/*  Exp, Log, SinCos, and TMPL_NAN found here.                                */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Complex arithmetic found here.                                            */
+#include <libtmpl/include/tmpl_complex.h>
+
+/*  Function prototypes given here.                                           */
+#include <libtmpl/include/tmpl_root_finding_complex.h>
+
+/*  Angle of the first seed. It is not a rational multiple of pi, so the      *
+ *  seeds are never symmetric about the real axis.                            */
+#define TMPL_ABERTH_SEED_ANGLE (0.7)
+
+/*  Computes |z| with the 1-norm, which is within a factor of sqrt(2) of the  *
+ *  2-norm and avoids a square root.                                          */
+#define TMPL_ABERTH_NORM(z) \
+    (tmpl_Double_Abs((z).dat[0]) + tmpl_Double_Abs((z).dat[1]))
+
+/*  Evaluates p(z) and p'(z) in a single Horner pass. Exactly one of coeffs   *
+ *  and real_coeffs is non-NULL. The return value is the sum of |a_k| |z|^k,  *
+ *  a bound for the rounding error in p(z) in units of the machine epsilon.   *
+ *  |z| must be the true modulus here, since it is raised to the Nth power.   */
+static double
+tmpl_aberth_horner(const tmpl_ComplexDouble * const coeffs,
+                   const double * const real_coeffs,
+                   size_t degree,
+                   tmpl_ComplexDouble z,
+                   tmpl_ComplexDouble *p,
+                   tmpl_ComplexDouble *dp)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    double re, bound;
+    const double abs_z = tmpl_CDouble_Abs(z);
+    tmpl_ComplexDouble val, deriv;
+
+    /*  Start with the leading coefficient, the derivative starts at zero.    */
+    if (coeffs)
+    {
+        val = coeffs[degree];
+        bound = TMPL_ABERTH_NORM(coeffs[degree]);
+    }
+
+    else
+    {
+        val.dat[0] = real_coeffs[degree];
+        val.dat[1] = 0.0;
+        bound = tmpl_Double_Abs(real_coeffs[degree]);
+    }
+
+    deriv = tmpl_CDouble_Zero;
+
+    /*  Horner's method. The derivative is updated with the old value.        */
+    for (n = degree; n > 0; --n)
+    {
+        re = deriv.dat[0];
+        deriv.dat[0] = re*z.dat[0] - deriv.dat[1]*z.dat[1] + val.dat[0];
+        deriv.dat[1] = re*z.dat[1] + deriv.dat[1]*z.dat[0] + val.dat[1];
+
+        re = val.dat[0];
+        val.dat[0] = re*z.dat[0] - val.dat[1]*z.dat[1];
+        val.dat[1] = re*z.dat[1] + val.dat[1]*z.dat[0];
+
+        if (coeffs)
+        {
+            val.dat[0] += coeffs[n - 1].dat[0];
+            val.dat[1] += coeffs[n - 1].dat[1];
+            bound = bound*abs_z + TMPL_ABERTH_NORM(coeffs[n - 1]);
+        }
+
+        else
+        {
+            val.dat[0] += real_coeffs[n - 1];
+            bound = bound*abs_z + tmpl_Double_Abs(real_coeffs[n - 1]);
+        }
+    }
+
+    *p = val;
+    *dp = deriv;
+    return bound;
+}
+/*  End of tmpl_aberth_horner.                                                */
+
+/*  Determines if the nth coefficient is zero.                                */
+static tmpl_Bool
+tmpl_aberth_coeff_is_zero(const tmpl_ComplexDouble * const coeffs,
+                          const double * const real_coeffs,
+                          size_t n)
+{
+    if (coeffs)
+        return (coeffs[n].dat[0] == 0.0) && (coeffs[n].dat[1] == 0.0);
+
+    return (real_coeffs[n] == 0.0);
+}
+/*  End of tmpl_aberth_coeff_is_zero.                                         */
+
+/*  Computes |a_n| for the nth coefficient.                                   */
+static double
+tmpl_aberth_coeff_abs(const tmpl_ComplexDouble * const coeffs,
+                      const double * const real_coeffs,
+                      size_t n)
+{
+    if (coeffs)
+        return tmpl_CDouble_Abs(coeffs[n]);
+
+    return tmpl_Double_Abs(real_coeffs[n]);
+}
+/*  End of tmpl_aberth_coeff_abs.                                             */
+
+/*  Aberth-Ehrlich iteration for either complex or real coefficients.         */
+static size_t
+tmpl_aberth_ehrlich(const tmpl_ComplexDouble *coeffs,
+                    const double *real_coeffs,
+                    size_t degree,
+                    tmpl_ComplexDouble *roots,
+                    unsigned int max_iters,
+                    double eps)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, zeros, done;
+    unsigned int iter;
+    double radius, bound, tol, sin_t, cos_t;
+    tmpl_ComplexDouble z, p, dp, sum, step, rotate;
+
+    /*  Leading zero coefficients lower the degree. The lost roots are at     *
+     *  infinity, which is flagged with NaN.                                  */
+    while (degree > 0 &&
+           tmpl_aberth_coeff_is_zero(coeffs, real_coeffs, degree))
+    {
+        --degree;
+        roots[degree] = tmpl_CDouble_Rect(TMPL_NAN, TMPL_NAN);
+    }
+
+    /*  Trailing zero coefficients are roots at the origin. They are exact,   *
+     *  so deflate them by shifting the coefficient array.                    */
+    zeros = 0;
+
+    while (zeros < degree &&
+           tmpl_aberth_coeff_is_zero(coeffs, real_coeffs, zeros))
+    {
+        roots[zeros] = tmpl_CDouble_Zero;
+        ++zeros;
+    }
+
+    if (zeros == degree)
+        return zeros;
+
+    if (coeffs)
+        coeffs += zeros;
+    else
+        real_coeffs += zeros;
+
+    roots += zeros;
+    degree -= zeros;
+
+    /*  The seeds lie on a circle whose radius is the geometric mean of the   *
+     *  moduli of the roots, (|a_0| / |a_N|)^(1 / N).                         */
+    radius = tmpl_Double_Exp(
+        (tmpl_Double_Log(tmpl_aberth_coeff_abs(coeffs, real_coeffs, 0)) -
+         tmpl_Double_Log(tmpl_aberth_coeff_abs(coeffs, real_coeffs, degree))) /
+        (double)degree
+    );
+
+    /*  Evenly spaced seeds, z_k = r exp(i (theta + 2 pi k / N)). The         *
+     *  rotation is applied by repeated multiplication.                       */
+    tmpl_Double_SinCos(TMPL_DOUBLE_TWO_PI / (double)degree, &sin_t, &cos_t);
+    rotate = tmpl_CDouble_Rect(cos_t, sin_t);
+
+    tmpl_Double_SinCos(TMPL_ABERTH_SEED_ANGLE, &sin_t, &cos_t);
+    z = tmpl_CDouble_Rect(radius * cos_t, radius * sin_t);
+
+    for (n = 0; n < degree; ++n)
+    {
+        roots[n] = z;
+        z = tmpl_CDouble_Multiply(z, rotate);
+    }
+
+    /*  p(z) is as small as rounding allows if |p(z)| is below this multiple  *
+     *  of the error bound from tmpl_aberth_horner.                           */
+    tol = 2.0 * TMPL_DBL_EPS;
+
+    /*  Converged roots are swapped to the front, roots[0, done), and are no  *
+     *  longer updated. Only the active roots roots[done, N) are iterated.    */
+    done = 0;
+
+    for (iter = 0U; iter < max_iters && done < degree; ++iter)
+    {
+        for (n = done; n < degree; ++n)
+        {
+            tmpl_Bool root_converged = tmpl_False;
+            size_t m;
+            z = roots[n];
+
+            bound = tmpl_aberth_horner(
+                coeffs, real_coeffs, degree, z, &p, &dp
+            );
+
+            /*  Backward error criterion. z is an exact root of a polynomial  *
+             *  whose coefficients differ from ours by rounding error. This   *
+             *  stops the iteration at multiple roots, where the Aberth step  *
+             *  converges slowly and stalls at the limit of accuracy.         */
+            if (TMPL_ABERTH_NORM(p) <= tol * bound)
+                root_converged = tmpl_True;
+
+            else
+            {
+                /*  The Aberth correction is w = 1 / (p'/p - sum 1/(z - z_j)) *
+                 *  with the sum over all other roots, converged or not.      */
+                sum = tmpl_CDouble_Zero;
+
+                for (m = 0; m < degree; ++m)
+                {
+                    tmpl_ComplexDouble diff;
+                    double rcpr;
+
+                    if (m == n)
+                        continue;
+
+                    /*  1 / d = conj(d) / |d|^2, with a single division.      */
+                    diff = tmpl_CDouble_Subtract(z, roots[m]);
+                    rcpr = 1.0 / (diff.dat[0]*diff.dat[0] +
+                                  diff.dat[1]*diff.dat[1]);
+
+                    sum.dat[0] += diff.dat[0] * rcpr;
+                    sum.dat[1] -= diff.dat[1] * rcpr;
+                }
+
+                step = tmpl_CDouble_Divide(
+                    tmpl_CDouble_One,
+                    tmpl_CDouble_Subtract(tmpl_CDouble_Divide(dp, p), sum)
+                );
+
+                /*  Gauss-Seidel style, later roots use the new value of z.   */
+                roots[n] = tmpl_CDouble_Subtract(z, step);
+
+                if (TMPL_ABERTH_NORM(step) <= eps * TMPL_ABERTH_NORM(roots[n]))
+                    root_converged = tmpl_True;
+            }
+
+            /*  Move the converged root to the end of the converged block.    */
+            if (root_converged)
+            {
+                z = roots[n];
+                roots[n] = roots[done];
+                roots[done] = z;
+                ++done;
+            }
+        }
+    }
+
+    return zeros + done;
+}
+/*  End of tmpl_aberth_ehrlich.                                               */
+
+/*  Aberth-Ehrlich method for polynomials with complex coefficients.          */
+size_t
+tmpl_CDouble_Aberth_Ehrlich_Polynomial_With_Vars(
+    const tmpl_ComplexDouble * const coeffs, size_t degree,
+    tmpl_ComplexDouble * const roots,
+    unsigned int max_iters, double eps
+)
+{
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!coeffs || !roots)
+        return 0;
+
+    return tmpl_aberth_ehrlich(coeffs, NULL, degree, roots, max_iters, eps);
+}
+/*  End of tmpl_CDouble_Aberth_Ehrlich_Polynomial_With_Vars.                  */
+
+/*  Aberth-Ehrlich method for polynomials with real coefficients.             */
+size_t
+tmpl_CDouble_Aberth_Ehrlich_Polynomial_Real_Coeffs_With_Vars(
+    const double * const coeffs, size_t degree,
+    tmpl_ComplexDouble * const roots,
+    unsigned int max_iters, double eps
+)
+{
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!coeffs || !roots)
+        return 0;
+
+    return tmpl_aberth_ehrlich(NULL, coeffs, degree, roots, max_iters, eps);
+}
+/*  End of tmpl_CDouble_Aberth_Ehrlich_Polynomial_Real_Coeffs_With_Vars.      */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_ABERTH_SEED_ANGLE
+#undef TMPL_ABERTH_NORM
@@ -0,0 +1,216 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *             tmpl_complex_halleys_method_explicit_array_double              *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Runs Halley's method on an arbitrary function for an array of seeds.  *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_CDouble_Halleys_Method_Explicit_Array                            *
+ *  Purpose:                                                                  *
+ *      Computes roots[n] = tmpl_CDouble_Halleys_Method_Explicit_With_Vars(   *
+ *          z[n], f, f_prime, f_2prime, max_iters, eps                        *
+ *      ) for each n.                                                         *
+ *  Arguments:                                                                *
+ *      z (const tmpl_ComplexDouble * const):                                 *
+ *          The starting points.                                              *
+ *      f (tmpl_ComplexDouble (*)(tmpl_ComplexDouble)):                       *
+ *          The function whose roots are computed.                            *
+ *      f_prime (tmpl_ComplexDouble (*)(tmpl_ComplexDouble)):                 *
+ *          The derivative of f.                                              *
+ *      f_2prime (tmpl_ComplexDouble (*)(tmpl_ComplexDouble)):                *
+ *          The second derivative of f.                                       *
+ *      roots (tmpl_ComplexDouble * const):                                   *
+ *          The output array. This may be the same as z.                      *
+ *      len (size_t):                                                         *
+ *          The number of elements of z and roots.                            *
+ *      max_iters (unsigned int):                                             *
+ *          The maximum number of steps for each seed.                        *
+ *      eps (double):                                                         *
+ *          A seed stops when |f(z)| < eps.                                   *
+ *  Output:                                                                   *
+ *      converged (size_t):                                                   *
+ *          The number of seeds for which |f(z)| fell below eps.              *
+ *  Called Functions:                                                         *
+ *      tmpl_complex.h:                                                       *
+ *          tmpl_CDouble_Abs_Squared:                                         *
+ *              Computes |z|^2.                                               *
+ *  Method:                                                                   *
+ *      The seeds are split into blocks of 64 lanes, and each sweep takes one *
+ *      step for every active lane. Lanes that converge, or that hit a zero   *
+ *      denominator, are retired and the remaining lanes are compacted. The   *
+ *      arithmetic is the same as the scalar function, so the results agree   *
+ *      exactly.                                                              *
+ *  Notes:                                                                    *
+ *      1.) If any pointer is NULL, nothing is done.                          *
+ *                                                                            *
+ *      2.) f, f_prime, and f_2prime are called from a single thread. No      *
+ *          OpenMP is used since the callbacks need not be thread safe.       *
+ *                                                                            *
+ *      3.) For polynomials, tmpl_CDouble_Halleys_Method_Polynomial_Array     *
+ *          avoids the callbacks entirely.                                    *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_complex.h:                                                       *
+ *          Header file with complex data types and functions.                *
+ *  2.) tmpl_root_finding_complex.h:                                          *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Complex data types and complex functions provided here.                   */
+#include <libtmpl/include/tmpl_complex.h>
+
+/*  Prototype for the function given here.                                    */
+#include <libtmpl/include/tmpl_root_finding_complex.h>
+
+/*  Number of lanes iterated together. The lane data lives on the stack.      */
+#define TMPL_HALLEY_BLOCK_SIZE (64)
+
+/*  Halley's method for an arbitrary function over an array of seeds.         */
+size_t
+tmpl_CDouble_Halleys_Method_Explicit_Array(
+    const tmpl_ComplexDouble * const z,
+    tmpl_ComplexDouble (*f)(tmpl_ComplexDouble),
+    tmpl_ComplexDouble (*f_prime)(tmpl_ComplexDouble),
+    tmpl_ComplexDouble (*f_2prime)(tmpl_ComplexDouble),
+    tmpl_ComplexDouble * const roots, size_t len,
+    unsigned int max_iters, double eps
+)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    tmpl_ComplexDouble lanes[TMPL_HALLEY_BLOCK_SIZE];
+    size_t lane[TMPL_HALLEY_BLOCK_SIZE];
+    size_t first, size, n, active, kept;
+    size_t converged = 0;
+    unsigned int iter;
+
+    /*  To avoid working with redundant square roots, compute eps^2.          */
+    const double eps_sq = eps*eps;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!z || !f || !f_prime || !f_2prime || !roots)
+        return 0;
+
+    for (first = 0; first < len; first += size)
+    {
+        /*  Copy the next block of seeds into the lanes. The seeds are read   *
+         *  before any root is written, so z and roots may be the same array. */
+        size = (len - first > TMPL_HALLEY_BLOCK_SIZE ?
+                TMPL_HALLEY_BLOCK_SIZE : len - first);
+
+        for (n = 0; n < size; ++n)
+        {
+            lanes[n] = z[first + n];
+            lane[n] = first + n;
+        }
+
+        active = size;
+
+        /*  One step for every active lane per sweep. Lanes that are done are *
+         *  retired, and the remaining ones are moved down to fill the gaps.  */
+        for (iter = 0U; iter < max_iters && active > 0; ++iter)
+        {
+            kept = 0;
+
+            for (n = 0; n < active; ++n)
+            {
+                double rcpr, norm_sq;
+                tmpl_ComplexDouble w_prime, w_2prime, numer, denom;
+                const tmpl_ComplexDouble zn = lanes[n];
+
+                /*  Evaluate the function at the current guess point.         */
+                const tmpl_ComplexDouble w = f(zn);
+
+                /*  Check if this point is close to a root.                   */
+                if (tmpl_CDouble_Abs_Squared(w) < eps_sq)
+                {
+                    roots[lane[n]] = zn;
+                    ++converged;
+                    continue;
+                }
+
+                /*  If not, compute f' and f'' at the guess point.            */
+                w_prime = f_prime(zn);
+                w_2prime = f_2prime(zn);
+
+                /*  The denominator is (f')^2 - f f'' / 2, as in              *
+                 *  tmpl_CDouble_Halleys_Method_Explicit_With_Vars.           */
+                denom.dat[0] =
+                    w_prime.dat[0]*w_prime.dat[0] -
+                        w_prime.dat[1]*w_prime.dat[1] -
+                            0.5*(w.dat[0]*w_2prime.dat[0] -
+                                 w.dat[1]*w_2prime.dat[1]);
+
+                denom.dat[1] =
+                    2.0*w_prime.dat[0]*w_prime.dat[1] -
+                        0.5*(w.dat[0]*w_2prime.dat[1] +
+                             w.dat[1]*w_2prime.dat[0]);
+
+                norm_sq = denom.dat[0]*denom.dat[0] +
+                          denom.dat[1]*denom.dat[1];
+
+                /*  Avoid a division by zero. Return NaN for this lane.       */
+                if (norm_sq == 0.0)
+                {
+                    roots[lane[n]] = TMPL_CNAN;
+                    continue;
+                }
+
+                /*  The numerator is f f'.                                    */
+                numer.dat[0] =
+                    w.dat[0]*w_prime.dat[0] - w.dat[1]*w_prime.dat[1];
+
+                numer.dat[1] =
+                    w.dat[0]*w_prime.dat[1] + w.dat[1]*w_prime.dat[0];
+
+                /*  The update is z - numer / denom.                          */
+                rcpr = 1.0 / norm_sq;
+
+                lanes[kept].dat[0] = zn.dat[0] - rcpr * (
+                    numer.dat[0] * denom.dat[0] + numer.dat[1] * denom.dat[1]
+                );
+
+                lanes[kept].dat[1] = zn.dat[1] - rcpr * (
+                    numer.dat[1] * denom.dat[0] - numer.dat[0] * denom.dat[1]
+                );
+
+                lane[kept] = lane[n];
+                ++kept;
+            }
+
+            active = kept;
+        }
+
+        /*  Lanes that ran out of iterations return their current value.      */
+        for (n = 0; n < active; ++n)
+            roots[lane[n]] = lanes[n];
+    }
+
+    return converged;
+}
+/*  End of tmpl_CDouble_Halleys_Method_Explicit_Array.                        */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_HALLEY_BLOCK_SIZE
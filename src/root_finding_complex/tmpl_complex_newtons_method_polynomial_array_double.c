@@ -0,0 +1,253 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *            tmpl_complex_newtons_method_polynomial_array_double             *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Runs Newton's method on a real polynomial for an array of seeds.      *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_CDouble_Newtons_Method_Polynomial_Array                          *
+ *  Purpose:                                                                  *
+ *      Computes roots[n] = tmpl_CDouble_Newtons_Method_Polynomial_With_Vars( *
+ *          z[n], coeffs, degree, max_iters, eps                              *
+ *      ) for each n.                                                         *
+ *  Arguments:                                                                *
+ *      z (const tmpl_ComplexDouble * const):                                 *
+ *          The starting points.                                              *
+ *      coeffs (const double * const):                                        *
+ *          The coefficients of the polynomial, in increasing order.          *
+ *      degree (size_t):                                                      *
+ *          The degree of the polynomial. coeffs has degree + 1 elements.     *
+ *      roots (tmpl_ComplexDouble * const):                                   *
+ *          The output array. This may be the same as z.                      *
+ *      len (size_t):                                                         *
+ *          The number of elements of z and roots.                            *
+ *      max_iters (unsigned int):                                             *
+ *          Each seed takes at most max_iters + 1 steps.                      *
+ *      eps (double):                                                         *
+ *          A seed stops when the Newton step is no larger than eps.          *
+ *  Output:                                                                   *
+ *      converged (size_t):                                                   *
+ *          The number of seeds for which the step fell below eps.            *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      The seeds are split into blocks of 64 lanes, stored on the stack in   *
+ *      split real and imaginary arrays. Each sweep evaluates p and p' for all*
+ *      active lanes together. The polynomial is evaluated inline with        *
+ *      Horner's method, and the loop over the lanes has no branches or       *
+ *      calls, so the compiler can vectorize it. Lanes that converge, or that *
+ *      hit p' = 0, are retired and the remaining lanes are compacted, so the *
+ *      later sweeps only work on the lanes that are still active.            *
+ *  Notes:                                                                    *
+ *      1.) If z, coeffs, or roots is NULL, nothing is done.                  *
+ *                                                                            *
+ *      2.) Lanes with p' = 0 return NaN, as for the scalar function.         *
+ *                                                                            *
+ *      3.) With OpenMP support, the blocks are shared among threads if len   *
+ *          is at least TMPL_ROOT_FINDING_COMPLEX_PARALLEL_MIN_LENGTH.        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file providing NaN.                                        *
+ *  2.) tmpl_complex.h:                                                       *
+ *          Header file with complex data types.                              *
+ *  3.) tmpl_root_finding_complex.h:                                          *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_NAN found here.                                                      */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Complex data types provided here.                                         */
+#include <libtmpl/include/tmpl_complex.h>
+
+/*  Prototype for the function given here.                                    */
+#include <libtmpl/include/tmpl_root_finding_complex.h>
+
+/*  Number of lanes iterated together. The lane data lives on the stack.      */
+#define TMPL_NEWTON_BLOCK_SIZE (64)
+
+/*  Runs Newton's method on one block of at most TMPL_NEWTON_BLOCK_SIZE       *
+ *  seeds. Returns the number of lanes that converged.                        */
+static size_t
+tmpl_newton_poly_block(const tmpl_ComplexDouble * const z,
+                       const double * const coeffs,
+                       size_t degree,
+                       tmpl_ComplexDouble * const roots,
+                       size_t len,
+                       unsigned int max_iters,
+                       double eps_sq)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    double x[TMPL_NEWTON_BLOCK_SIZE], y[TMPL_NEWTON_BLOCK_SIZE];
+    double p_re[TMPL_NEWTON_BLOCK_SIZE], p_im[TMPL_NEWTON_BLOCK_SIZE];
+    double dp_re[TMPL_NEWTON_BLOCK_SIZE], dp_im[TMPL_NEWTON_BLOCK_SIZE];
+    size_t lane[TMPL_NEWTON_BLOCK_SIZE];
+    size_t n, k, active, kept;
+    size_t converged = 0;
+    unsigned int iter;
+
+    /*  Copy the seeds into the lanes. The seeds are read before any root is  *
+     *  written, so z and roots may be the same array.                        */
+    for (n = 0; n < len; ++n)
+    {
+        x[n] = z[n].dat[0];
+        y[n] = z[n].dat[1];
+        lane[n] = n;
+    }
+
+    active = len;
+
+    /*  At most max_iters + 1 steps, matching                                 *
+     *  tmpl_CDouble_Newtons_Method_Polynomial_With_Vars.                     */
+    for (iter = 0U; active > 0; ++iter)
+    {
+        /*  Evaluate p and p' for all active lanes with Horner's method. The  *
+         *  loops over the lanes have no branches and no calls, so they can   *
+         *  be vectorized. The active lanes are kept contiguous below.        */
+        for (n = 0; n < active; ++n)
+        {
+            p_re[n] = coeffs[degree];
+            p_im[n] = 0.0;
+            dp_re[n] = 0.0;
+            dp_im[n] = 0.0;
+        }
+
+        for (k = degree; k > 0; --k)
+        {
+            const double a = coeffs[k - 1];
+
+            for (n = 0; n < active; ++n)
+            {
+                const double re = p_re[n];
+                const double im = p_im[n];
+                const double dre = dp_re[n];
+
+                dp_re[n] = dre*x[n] - dp_im[n]*y[n] + re;
+                dp_im[n] = dre*y[n] + dp_im[n]*x[n] + im;
+                p_re[n] = re*x[n] - im*y[n] + a;
+                p_im[n] = re*y[n] + im*x[n];
+            }
+        }
+
+        /*  Take the Newton step, and retire the lanes that are done. The     *
+         *  remaining lanes are moved down to fill the gaps.                  */
+        kept = 0;
+
+        for (n = 0; n < active; ++n)
+        {
+            double dx, dy, rcpr;
+            const double norm_sq = dp_re[n]*dp_re[n] + dp_im[n]*dp_im[n];
+
+            /*  Newton's method fails if p' = 0. Return NaN for this lane.    */
+            if (norm_sq == 0.0)
+            {
+                roots[lane[n]] = tmpl_CDouble_Rect(TMPL_NAN, TMPL_NAN);
+                continue;
+            }
+
+            /*  dz = p / p' = p conj(p') / |p'|^2.                            */
+            rcpr = 1.0 / norm_sq;
+            dx = rcpr * (p_re[n]*dp_re[n] + p_im[n]*dp_im[n]);
+            dy = rcpr * (p_im[n]*dp_re[n] - p_re[n]*dp_im[n]);
+
+            x[n] -= dx;
+            y[n] -= dy;
+
+            if (dx*dx + dy*dy <= eps_sq)
+            {
+                roots[lane[n]] = tmpl_CDouble_Rect(x[n], y[n]);
+                ++converged;
+                continue;
+            }
+
+            x[kept] = x[n];
+            y[kept] = y[n];
+            lane[kept] = lane[n];
+            ++kept;
+        }
+
+        active = kept;
+
+        if (iter == max_iters)
+            break;
+    }
+
+    /*  Lanes that ran out of iterations return their current value.          */
+    for (n = 0; n < active; ++n)
+        roots[lane[n]] = tmpl_CDouble_Rect(x[n], y[n]);
+
+    return converged;
+}
+/*  End of tmpl_newton_poly_block.                                            */
+
+/*  Newton's method for real polynomials over an array of seeds.              */
+size_t
+tmpl_CDouble_Newtons_Method_Polynomial_Array(
+    const tmpl_ComplexDouble * const z,
+    const double * const coeffs, size_t degree,
+    tmpl_ComplexDouble * const roots, size_t len,
+    unsigned int max_iters, double eps
+)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    size_t converged = 0;
+
+    /*  Number of blocks, rounding up. The last block may be short.           */
+    const size_t blocks =
+        (len + TMPL_NEWTON_BLOCK_SIZE - 1) / TMPL_NEWTON_BLOCK_SIZE;
+
+    /*  To avoid working with redundant square roots, compute eps^2.          */
+    const double eps_sq = eps*eps;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!z || !coeffs || !roots)
+        return 0;
+
+    /*  The blocks are independent. Lanes converge at different rates, so     *
+     *  the blocks are handed out to the threads dynamically.                 */
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(+: converged) \
+    if(len >= TMPL_ROOT_FINDING_COMPLEX_PARALLEL_MIN_LENGTH)
+#endif
+    for (n = 0; n < blocks; ++n)
+    {
+        const size_t first = n * TMPL_NEWTON_BLOCK_SIZE;
+        const size_t size = (len - first > TMPL_NEWTON_BLOCK_SIZE ?
+                             TMPL_NEWTON_BLOCK_SIZE : len - first);
+
+        converged += tmpl_newton_poly_block(
+            z + first, coeffs, degree, roots + first, size, max_iters, eps_sq
+        );
+    }
+
+    return converged;
+}
+/*  End of tmpl_CDouble_Newtons_Method_Polynomial_Array.                      */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_NEWTON_BLOCK_SIZE
@@ -0,0 +1,494 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                             tmpl_brents_method                             *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes a root of a real function on a bracketing interval.          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Brents_Method_Double                                             *
+ *  Purpose:                                                                  *
+ *      Computes a root of f in [a, b] using only values of f.                *
+ *  Arguments:                                                                *
+ *      a (double):                                                           *
+ *          One endpoint of the bracket.                                      *
+ *      b (double):                                                           *
+ *          The other endpoint. f(a) and f(b) must have opposite signs.       *
+ *      f (double (*)(double)):                                               *
+ *          The function whose root is computed.                              *
+ *      max_iters (unsigned int):                                             *
+ *          The maximum number of iterations. Each uses one evaluation of f.  *
+ *      eps (double):                                                         *
+ *          The absolute tolerance for the root.                              *
+ *  Output:                                                                   *
+ *      root (double):                                                        *
+ *          A root of f in [a, b].                                            *
+ *  Called Functions:                                                         *
+ *      tmpl_math.h:                                                          *
+ *          tmpl_Double_Abs:                                                  *
+ *              Computes the absolute value of a real number.                 *
+ *  Method:                                                                   *
+ *      Keep a bracket [b, c] with f(b) f(c) <= 0 and |f(b)| <= |f(c)|.       *
+ *      Each iteration tries inverse quadratic interpolation through the      *
+ *      last three points, or the secant method if there are only two.        *
+ *      The step is accepted if it lands inside the bracket and is less       *
+ *      than half the size of the step before the previous one. Otherwise     *
+ *      bisection is used. This gives superlinear convergence for smooth      *
+ *      functions, and never more than about twice the steps of bisection.    *
+ *      See R. P. Brent, Algorithms for Minimization without Derivatives,     *
+ *      Chapter 4.                                                            *
+ *                                                                            *
+ *      The iteration stops once the bracket is smaller than                  *
+ *      2 (2 DBL_EPS |b| + eps / 2). Steps are never smaller than this        *
+ *      tolerance, so no evaluations are spent on points next to b.           *
+ *  Notes:                                                                    *
+ *      1.) If f(a) and f(b) have the same sign, or either is NaN, then NaN   *
+ *          is returned. Only these two evaluations are made in this case.    *
+ *                                                                            *
+ *      2.) If f(a) or f(b) is zero, that endpoint is returned.               *
+ *                                                                            *
+ *      3.) The total number of evaluations is at most max_iters + 2.         *
+ *                                                                            *
+ *      4.) Near a multiple root the interpolation steps are accepted but     *
+ *          make slow progress, and Brent's method can take a few times as    *
+ *          many evaluations as bisection. tmpl_ITP_Method_Double never       *
+ *          takes more than one step more than bisection, and is the          *
+ *          better choice if multiple roots are expected.                     *
+ *                                                                            *
+ *      5.) Float and long double versions are provided as well.              *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file with the absolute value function and NaN.             *
+ *  2.) tmpl_float.h:                                                         *
+ *          Header file with the machine epsilon.                             *
+ *  3.) tmpl_root_finding_real.h:                                             *
+ *          Header file where the function prototypes are given.              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Absolute value functions and the NaN macros found here.                   */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Machine epsilon for float, double, and long double.                       */
+#include <libtmpl/include/tmpl_float.h>
+
+/*  Function prototypes given here.                                           */
+#include <libtmpl/include/tmpl_root_finding_real.h>
+
+/*  Brent's method for float precision.                                       */
+float
+tmpl_Brents_Method_Float(float a,
+                         float b,
+                         float (*f)(float),
+                         unsigned int max_iters,
+                         float eps)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    float c, d, e, fa, fb, fc, m, p, q, r, s, tol;
+    unsigned int n;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!f)
+        return TMPL_NANF;
+
+    /*  These are the only two evaluations outside of the main loop.          */
+    fa = f(a);
+    fb = f(b);
+
+    /*  Either endpoint may already be a root.                                */
+    if (fa == 0.0F)
+        return a;
+
+    if (fb == 0.0F)
+        return b;
+
+    /*  The function must change sign on [a, b]. This also catches NaN.       */
+    if (!((fa < 0.0F && fb > 0.0F) || (fa > 0.0F && fb < 0.0F)))
+        return TMPL_NANF;
+
+    /*  b is the best guess, a is the previous one, and [b, c] brackets the   *
+     *  root. d is the current step and e is the step before that.            */
+    c = a;
+    fc = fa;
+    d = e = b - a;
+
+    for (n = 0U; n < max_iters; ++n)
+    {
+        /*  Keep the root bracketed between b and c.                          */
+        if ((fb > 0.0F && fc > 0.0F) || (fb < 0.0F && fc < 0.0F))
+        {
+            c = a;
+            fc = fa;
+            d = e = b - a;
+        }
+
+        /*  Make b the endpoint with the smaller function value.              */
+        if (tmpl_Float_Abs(fc) < tmpl_Float_Abs(fb))
+        {
+            a = b;
+            b = c;
+            c = a;
+            fa = fb;
+            fb = fc;
+            fc = fa;
+        }
+
+        /*  The tolerance can not be smaller than the spacing of the numbers  *
+         *  near b, otherwise the steps below would not change b.             */
+        tol = 2.0F*TMPL_FLT_EPS*tmpl_Float_Abs(b) + 0.5F*eps;
+
+        /*  Half of the step to c. c - b may overflow for wide brackets, so   *
+         *  halve both first. The halving is exact unless they are subnormal. */
+        m = 0.5F*c - 0.5F*b;
+
+        if (tmpl_Float_Abs(m) <= tol || fb == 0.0F)
+            return b;
+
+        /*  Bisect if the previous step was too small, or did not decrease   *
+         *  the function value.                                               */
+        if (tmpl_Float_Abs(e) < tol ||
+            tmpl_Float_Abs(fa) <= tmpl_Float_Abs(fb))
+            d = e = m;
+
+        else
+        {
+            s = fb / fa;
+
+            /*  Only two distinct points, use the secant method.              */
+            if (a == c)
+            {
+                p = 2.0F*m*s;
+                q = 1.0F - s;
+            }
+
+            /*  Otherwise use inverse quadratic interpolation.                */
+            else
+            {
+                q = fa / fc;
+                r = fb / fc;
+                p = s*(2.0F*m*q*(q - r) - (b - a)*(r - 1.0F));
+                q = (q - 1.0F)*(r - 1.0F)*(s - 1.0F);
+            }
+
+            /*  The step is p / q. Choose the signs so that p >= 0.           */
+            if (p > 0.0F)
+                q = -q;
+            else
+                p = -p;
+
+            /*  Accept the interpolation if it lands inside the bracket and   *
+             *  the step is less than half of the step before the last one.   *
+             *  Otherwise bisect.                                             */
+            if (2.0F*p < 3.0F*m*q - tmpl_Float_Abs(tol*q) &&
+                p < tmpl_Float_Abs(0.5F*e*q))
+            {
+                e = d;
+                d = p / q;
+            }
+            else
+                d = e = m;
+        }
+
+        a = b;
+        fa = fb;
+
+        /*  Never step by less than the tolerance. This avoids wasting        *
+         *  evaluations on points that are indistinguishable from b.          */
+        if (tmpl_Float_Abs(d) > tol)
+            b += d;
+        else
+            b += (m > 0.0F ? tol : -tol);
+
+        /*  This is the only evaluation per iteration.                        */
+        fb = f(b);
+    }
+
+    return b;
+}
+/*  End of tmpl_Brents_Method_Float.                                          */
+
+/*  Brent's method for double precision.                                      */
+double
+tmpl_Brents_Method_Double(double a,
+                          double b,
+                          double (*f)(double),
+                          unsigned int max_iters,
+                          double eps)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    double c, d, e, fa, fb, fc, m, p, q, r, s, tol;
+    unsigned int n;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!f)
+        return TMPL_NAN;
+
+    /*  These are the only two evaluations outside of the main loop.          */
+    fa = f(a);
+    fb = f(b);
+
+    /*  Either endpoint may already be a root.                                */
+    if (fa == 0.0)
+        return a;
+
+    if (fb == 0.0)
+        return b;
+
+    /*  The function must change sign on [a, b]. This also catches NaN.       */
+    if (!((fa < 0.0 && fb > 0.0) || (fa > 0.0 && fb < 0.0)))
+        return TMPL_NAN;
+
+    /*  b is the best guess, a is the previous one, and [b, c] brackets the   *
+     *  root. d is the current step and e is the step before that.            */
+    c = a;
+    fc = fa;
+    d = e = b - a;
+
+    for (n = 0U; n < max_iters; ++n)
+    {
+        /*  Keep the root bracketed between b and c.                          */
+        if ((fb > 0.0 && fc > 0.0) || (fb < 0.0 && fc < 0.0))
+        {
+            c = a;
+            fc = fa;
+            d = e = b - a;
+        }
+
+        /*  Make b the endpoint with the smaller function value.              */
+        if (tmpl_Double_Abs(fc) < tmpl_Double_Abs(fb))
+        {
+            a = b;
+            b = c;
+            c = a;
+            fa = fb;
+            fb = fc;
+            fc = fa;
+        }
+
+        /*  The tolerance can not be smaller than the spacing of the numbers  *
+         *  near b, otherwise the steps below would not change b.             */
+        tol = 2.0*TMPL_DBL_EPS*tmpl_Double_Abs(b) + 0.5*eps;
+
+        /*  Half of the step to c. c - b may overflow for wide brackets, so   *
+         *  halve both first. The halving is exact unless they are subnormal. */
+        m = 0.5*c - 0.5*b;
+
+        if (tmpl_Double_Abs(m) <= tol || fb == 0.0)
+            return b;
+
+        /*  Bisect if the previous step was too small, or did not decrease   *
+         *  the function value.                                               */
+        if (tmpl_Double_Abs(e) < tol ||
+            tmpl_Double_Abs(fa) <= tmpl_Double_Abs(fb))
+            d = e = m;
+
+        else
+        {
+            s = fb / fa;
+
+            /*  Only two distinct points, use the secant method.              */
+            if (a == c)
+            {
+                p = 2.0*m*s;
+                q = 1.0 - s;
+            }
+
+            /*  Otherwise use inverse quadratic interpolation.                */
+            else
+            {
+                q = fa / fc;
+                r = fb / fc;
+                p = s*(2.0*m*q*(q - r) - (b - a)*(r - 1.0));
+                q = (q - 1.0)*(r - 1.0)*(s - 1.0);
+            }
+
+            /*  The step is p / q. Choose the signs so that p >= 0.           */
+            if (p > 0.0)
+                q = -q;
+            else
+                p = -p;
+
+            /*  Accept the interpolation if it lands inside the bracket and   *
+             *  the step is less than half of the step before the last one.   *
+             *  Otherwise bisect.                                             */
+            if (2.0*p < 3.0*m*q - tmpl_Double_Abs(tol*q) &&
+                p < tmpl_Double_Abs(0.5*e*q))
+            {
+                e = d;
+                d = p / q;
+            }
+            else
+                d = e = m;
+        }
+
+        a = b;
+        fa = fb;
+
+        /*  Never step by less than the tolerance. This avoids wasting        *
+         *  evaluations on points that are indistinguishable from b.          */
+        if (tmpl_Double_Abs(d) > tol)
+            b += d;
+        else
+            b += (m > 0.0 ? tol : -tol);
+
+        /*  This is the only evaluation per iteration.                        */
+        fb = f(b);
+    }
+
+    return b;
+}
+/*  End of tmpl_Brents_Method_Double.                                         */
+
+/*  Brent's method for long double precision.                                 */
+long double
+tmpl_Brents_Method_LDouble(long double a,
+                           long double b,
+                           long double (*f)(long double),
+                           unsigned int max_iters,
+                           long double eps)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    long double c, d, e, fa, fb, fc, m, p, q, r, s, tol;
+    unsigned int n;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!f)
+        return TMPL_NANL;
+
+    /*  These are the only two evaluations outside of the main loop.          */
+    fa = f(a);
+    fb = f(b);
+
+    /*  Either endpoint may already be a root.                                */
+    if (fa == 0.0L)
+        return a;
+
+    if (fb == 0.0L)
+        return b;
+
+    /*  The function must change sign on [a, b]. This also catches NaN.       */
+    if (!((fa < 0.0L && fb > 0.0L) || (fa > 0.0L && fb < 0.0L)))
+        return TMPL_NANL;
+
+    /*  b is the best guess, a is the previous one, and [b, c] brackets the   *
+     *  root. d is the current step and e is the step before that.            */
+    c = a;
+    fc = fa;
+    d = e = b - a;
+
+    for (n = 0U; n < max_iters; ++n)
+    {
+        /*  Keep the root bracketed between b and c.                          */
+        if ((fb > 0.0L && fc > 0.0L) || (fb < 0.0L && fc < 0.0L))
+        {
+            c = a;
+            fc = fa;
+            d = e = b - a;
+        }
+
+        /*  Make b the endpoint with the smaller function value.              */
+        if (tmpl_LDouble_Abs(fc) < tmpl_LDouble_Abs(fb))
+        {
+            a = b;
+            b = c;
+            c = a;
+            fa = fb;
+            fb = fc;
+            fc = fa;
+        }
+
+        /*  The tolerance can not be smaller than the spacing of the numbers  *
+         *  near b, otherwise the steps below would not change b.             */
+        tol = 2.0L*TMPL_LDBL_EPS*tmpl_LDouble_Abs(b) + 0.5L*eps;
+
+        /*  Half of the step to c. c - b may overflow for wide brackets, so   *
+         *  halve both first. The halving is exact unless they are subnormal. */
+        m = 0.5L*c - 0.5L*b;
+
+        if (tmpl_LDouble_Abs(m) <= tol || fb == 0.0L)
+            return b;
+
+        /*  Bisect if the previous step was too small, or did not decrease   *
+         *  the function value.                                               */
+        if (tmpl_LDouble_Abs(e) < tol ||
+            tmpl_LDouble_Abs(fa) <= tmpl_LDouble_Abs(fb))
+            d = e = m;
+
+        else
+        {
+            s = fb / fa;
+
+            /*  Only two distinct points, use the secant method.              */
+            if (a == c)
+            {
+                p = 2.0L*m*s;
+                q = 1.0L - s;
+            }
+
+            /*  Otherwise use inverse quadratic interpolation.                */
+            else
+            {
+                q = fa / fc;
+                r = fb / fc;
+                p = s*(2.0L*m*q*(q - r) - (b - a)*(r - 1.0L));
+                q = (q - 1.0L)*(r - 1.0L)*(s - 1.0L);
+            }
+
+            /*  The step is p / q. Choose the signs so that p >= 0.           */
+            if (p > 0.0L)
+                q = -q;
+            else
+                p = -p;
+
+            /*  Accept the interpolation if it lands inside the bracket and   *
+             *  the step is less than half of the step before the last one.   *
+             *  Otherwise bisect.                                             */
+            if (2.0L*p < 3.0L*m*q - tmpl_LDouble_Abs(tol*q) &&
+                p < tmpl_LDouble_Abs(0.5L*e*q))
+            {
+                e = d;
+                d = p / q;
+            }
+            else
+                d = e = m;
+        }
+
+        a = b;
+        fa = fb;
+
+        /*  Never step by less than the tolerance. This avoids wasting        *
+         *  evaluations on points that are indistinguishable from b.          */
+        if (tmpl_LDouble_Abs(d) > tol)
+            b += d;
+        else
+            b += (m > 0.0L ? tol : -tol);
+
+        /*  This is the only evaluation per iteration.                        */
+        fb = f(b);
+    }
+
+    return b;
+}
+/*  End of tmpl_Brents_Method_LDouble.                                        */
@@ -0,0 +1,359 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                         tmpl_halleys_method_array                          *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Runs Halley's method on a real function for an array of seeds.        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Halleys_Method_Double_Array                                      *
+ *  Purpose:                                                                  *
+ *      Computes roots[n] = tmpl_Halleys_Method_Double(                       *
+ *          x[n], f, f_prime, f_2prime, max_iters, eps                        *
+ *      ) for each n.                                                         *
+ *  Arguments:                                                                *
+ *      x (const double * const):                                             *
+ *          The starting points.                                              *
+ *      f (double (*)(double)):                                               *
+ *          The function whose roots are computed.                            *
+ *      f_prime (double (*)(double)):                                         *
+ *          The derivative of f.                                              *
+ *      f_2prime (double (*)(double)):                                        *
+ *          The second derivative of f.                                       *
+ *      roots (double * const):                                               *
+ *          The output array. This may be the same as x.                      *
+ *      len (size_t):                                                         *
+ *          The number of elements of x and roots.                            *
+ *      max_iters (unsigned int):                                             *
+ *          Each seed takes at most max_iters + 1 steps.                      *
+ *      eps (double):                                                         *
+ *          A seed stops when the Halley step is no larger than eps.          *
+ *  Output:                                                                   *
+ *      converged (size_t):                                                   *
+ *          The number of seeds for which the step fell below eps.            *
+ *  Called Functions:                                                         *
+ *      tmpl_math.h:                                                          *
+ *          tmpl_Double_Abs:                                                  *
+ *              Computes the absolute value of a real number.                 *
+ *  Method:                                                                   *
+ *      The seeds are split into blocks of 64 lanes, and each sweep takes one *
+ *      step for every active lane. Lanes that converge, or that hit a zero   *
+ *      denominator, are retired and the remaining lanes are compacted.       *
+ *  Notes:                                                                    *
+ *      1.) If any pointer is NULL, nothing is done.                          *
+ *                                                                            *
+ *      2.) Lanes where 2 f'^2 - f f'' = 0 return NaN, as for the scalar      *
+ *          function.                                                         *
+ *                                                                            *
+ *      3.) Float and long double versions are provided as well.              *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file with the absolute value function and NaN.             *
+ *  2.) tmpl_root_finding_real.h:                                             *
+ *          Header file where the function prototypes are given.              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  tmpl_Float_Abs, tmpl_Double_Abs, and the NaN macros found here.           */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Function prototypes given here.                                           */
+#include <libtmpl/include/tmpl_root_finding_real.h>
+
+/*  Number of lanes iterated together. The lane data lives on the stack.      */
+#define TMPL_HALLEY_BLOCK_SIZE (64)
+
+/*  Halley's method for float precision over an array of seeds.               */
+size_t
+tmpl_Halleys_Method_Float_Array(const float * const x,
+                                float (*f)(float),
+                                float (*f_prime)(float),
+                                float (*f_2prime)(float),
+                                float * const roots,
+                                size_t len,
+                                unsigned int max_iters,
+                                float eps)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    float lanes[TMPL_HALLEY_BLOCK_SIZE];
+    size_t lane[TMPL_HALLEY_BLOCK_SIZE];
+    size_t first, size, n, active, kept;
+    size_t converged = 0;
+    unsigned int iter;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!x || !f || !f_prime || !f_2prime || !roots)
+        return 0;
+
+    for (first = 0; first < len; first += size)
+    {
+        /*  Copy the next block of seeds into the lanes. The seeds are read   *
+         *  before any root is written, so x and roots may be the same array. */
+        size = (len - first > TMPL_HALLEY_BLOCK_SIZE ?
+                TMPL_HALLEY_BLOCK_SIZE : len - first);
+
+        for (n = 0; n < size; ++n)
+        {
+            lanes[n] = x[first + n];
+            lane[n] = first + n;
+        }
+
+        active = size;
+
+        /*  One step for every active lane per sweep, at most max_iters + 1   *
+         *  steps as for tmpl_Halleys_Method_Float.                         *
+         *  Lanes that are done are retired, and the remaining ones are moved *
+         *  down to fill the gaps.                                            */
+        for (iter = 0U; active > 0; ++iter)
+        {
+            kept = 0;
+
+            for (n = 0; n < active; ++n)
+            {
+                float dx, denom;
+                const float y = f(lanes[n]);
+                const float y_prime = f_prime(lanes[n]);
+                const float y_2prime = f_2prime(lanes[n]);
+
+                denom = 2.0F*y_prime*y_prime - y*y_2prime;
+
+                /*  Check that the denominator is non-zero.                   */
+                if (denom == 0.0F)
+                {
+                    roots[lane[n]] = TMPL_NANF;
+                    continue;
+                }
+
+                dx = 2.0F*y*y_prime/denom;
+
+                if (tmpl_Float_Abs(dx) <= eps)
+                {
+                    roots[lane[n]] = lanes[n] - dx;
+                    ++converged;
+                    continue;
+                }
+
+                lanes[kept] = lanes[n] - dx;
+                lane[kept] = lane[n];
+                ++kept;
+            }
+
+            active = kept;
+
+            if (iter == max_iters)
+                break;
+        }
+
+        /*  Lanes that ran out of iterations return their current value.      */
+        for (n = 0; n < active; ++n)
+            roots[lane[n]] = lanes[n];
+    }
+
+    return converged;
+}
+/*  End of tmpl_Halleys_Method_Float_Array.                                   */
+
+/*  Halley's method for double precision over an array of seeds.              */
+size_t
+tmpl_Halleys_Method_Double_Array(const double * const x,
+                                 double (*f)(double),
+                                 double (*f_prime)(double),
+                                 double (*f_2prime)(double),
+                                 double * const roots,
+                                 size_t len,
+                                 unsigned int max_iters,
+                                 double eps)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    double lanes[TMPL_HALLEY_BLOCK_SIZE];
+    size_t lane[TMPL_HALLEY_BLOCK_SIZE];
+    size_t first, size, n, active, kept;
+    size_t converged = 0;
+    unsigned int iter;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!x || !f || !f_prime || !f_2prime || !roots)
+        return 0;
+
+    for (first = 0; first < len; first += size)
+    {
+        /*  Copy the next block of seeds into the lanes. The seeds are read   *
+         *  before any root is written, so x and roots may be the same array. */
+        size = (len - first > TMPL_HALLEY_BLOCK_SIZE ?
+                TMPL_HALLEY_BLOCK_SIZE : len - first);
+
+        for (n = 0; n < size; ++n)
+        {
+            lanes[n] = x[first + n];
+            lane[n] = first + n;
+        }
+
+        active = size;
+
+        /*  One step for every active lane per sweep, at most max_iters + 1   *
+         *  steps as for tmpl_Halleys_Method_Double.                        *
+         *  Lanes that are done are retired, and the remaining ones are moved *
+         *  down to fill the gaps.                                            */
+        for (iter = 0U; active > 0; ++iter)
+        {
+            kept = 0;
+
+            for (n = 0; n < active; ++n)
+            {
+                double dx, denom;
+                const double y = f(lanes[n]);
+                const double y_prime = f_prime(lanes[n]);
+                const double y_2prime = f_2prime(lanes[n]);
+
+                denom = 2.0*y_prime*y_prime - y*y_2prime;
+
+                /*  Check that the denominator is non-zero.                   */
+                if (denom == 0.0)
+                {
+                    roots[lane[n]] = TMPL_NAN;
+                    continue;
+                }
+
+                dx = 2.0*y*y_prime/denom;
+
+                if (tmpl_Double_Abs(dx) <= eps)
+                {
+                    roots[lane[n]] = lanes[n] - dx;
+                    ++converged;
+                    continue;
+                }
+
+                lanes[kept] = lanes[n] - dx;
+                lane[kept] = lane[n];
+                ++kept;
+            }
+
+            active = kept;
+
+            if (iter == max_iters)
+                break;
+        }
+
+        /*  Lanes that ran out of iterations return their current value.      */
+        for (n = 0; n < active; ++n)
+            roots[lane[n]] = lanes[n];
+    }
+
+    return converged;
+}
+/*  End of tmpl_Halleys_Method_Double_Array.                                  */
+
+/*  Halley's method for long double precision over an array of seeds.         */
+size_t
+tmpl_Halleys_Method_LDouble_Array(const long double * const x,
+                                  long double (*f)(long double),
+                                  long double (*f_prime)(long double),
+                                  long double (*f_2prime)(long double),
+                                  long double * const roots,
+                                  size_t len,
+                                  unsigned int max_iters,
+                                  long double eps)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    long double lanes[TMPL_HALLEY_BLOCK_SIZE];
+    size_t lane[TMPL_HALLEY_BLOCK_SIZE];
+    size_t first, size, n, active, kept;
+    size_t converged = 0;
+    unsigned int iter;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!x || !f || !f_prime || !f_2prime || !roots)
+        return 0;
+
+    for (first = 0; first < len; first += size)
+    {
+        /*  Copy the next block of seeds into the lanes. The seeds are read   *
+         *  before any root is written, so x and roots may be the same array. */
+        size = (len - first > TMPL_HALLEY_BLOCK_SIZE ?
+                TMPL_HALLEY_BLOCK_SIZE : len - first);
+
+        for (n = 0; n < size; ++n)
+        {
+            lanes[n] = x[first + n];
+            lane[n] = first + n;
+        }
+
+        active = size;
+
+        /*  One step for every active lane per sweep, at most max_iters + 1   *
+         *  steps as for tmpl_Halleys_Method_LDouble.                       *
+         *  Lanes that are done are retired, and the remaining ones are moved *
+         *  down to fill the gaps.                                            */
+        for (iter = 0U; active > 0; ++iter)
+        {
+            kept = 0;
+
+            for (n = 0; n < active; ++n)
+            {
+                long double dx, denom;
+                const long double y = f(lanes[n]);
+                const long double y_prime = f_prime(lanes[n]);
+                const long double y_2prime = f_2prime(lanes[n]);
+
+                denom = 2.0L*y_prime*y_prime - y*y_2prime;
+
+                /*  Check that the denominator is non-zero.                   */
+                if (denom == 0.0L)
+                {
+                    roots[lane[n]] = TMPL_NANL;
+                    continue;
+                }
+
+                dx = 2.0L*y*y_prime/denom;
+
+                if (tmpl_LDouble_Abs(dx) <= eps)
+                {
+                    roots[lane[n]] = lanes[n] - dx;
+                    ++converged;
+                    continue;
+                }
+
+                lanes[kept] = lanes[n] - dx;
+                lane[kept] = lane[n];
+                ++kept;
+            }
+
+            active = kept;
+
+            if (iter == max_iters)
+                break;
+        }
+
+        /*  Lanes that ran out of iterations return their current value.      */
+        for (n = 0; n < active; ++n)
+            roots[lane[n]] = lanes[n];
+    }
+
+    return converged;
+}
+/*  End of tmpl_Halleys_Method_LDouble_Array.                                 */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef TMPL_HALLEY_BLOCK_SIZE
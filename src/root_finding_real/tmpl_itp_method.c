@@ -0,0 +1,487 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                              tmpl_itp_method                               *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes a root of a real function with the ITP method.               *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_ITP_Method_Double                                                *
+ *  Purpose:                                                                  *
+ *      Computes a root of f in [a, b] using only values of f.                *
+ *  Arguments:                                                                *
+ *      a (double):                                                           *
+ *          One endpoint of the bracket.                                      *
+ *      b (double):                                                           *
+ *          The other endpoint. f(a) and f(b) must have opposite signs.       *
+ *      f (double (*)(double)):                                               *
+ *          The function whose root is computed.                              *
+ *      max_iters (unsigned int):                                             *
+ *          The maximum number of iterations. Each uses one evaluation of f.  *
+ *      eps (double):                                                         *
+ *          The absolute tolerance for the root.                              *
+ *  Output:                                                                   *
+ *      root (double):                                                        *
+ *          A point within eps of a root of f in [a, b].                      *
+ *  Called Functions:                                                         *
+ *      tmpl_math.h:                                                          *
+ *          tmpl_Double_Abs:                                                  *
+ *              Computes the absolute value of a real number.                 *
+ *  Method:                                                                   *
+ *      Interpolate, Truncate, and Project. Each iteration starts from the    *
+ *      regula falsi point x_f of the bracket [a, b]:                         *
+ *                                                                            *
+ *          Interpolate:                                                      *
+ *              x_f = (b f(a) - a f(b)) / (f(a) - f(b)).                      *
+ *          Truncate:                                                         *
+ *              Move x_f towards the midpoint x_1/2 by k1 (b - a)^2, with     *
+ *              k1 = 0.2 / (b - a) for the initial bracket. This avoids the   *
+ *              one sided steps that make regula falsi slow.                  *
+ *          Project:                                                          *
+ *              Move the point into the interval around x_1/2 with radius     *
+ *              eps 2^(n_max - j) - (b - a) / 2, where j is the iteration     *
+ *              and n_max is one more than the number of bisection steps.     *
+ *                                                                            *
+ *      The bracket is then updated with the sign of f at the new point.      *
+ *      The method never takes more than one step more than bisection, and    *
+ *      converges superlinearly for smooth functions. See I. F. D. Oliveira   *
+ *      and R. H. C. Takahashi, An Enhancement of the Bisection Method        *
+ *      Average Performance Preserving Minmax Optimality, ACM Transactions    *
+ *      on Mathematical Software, 2020.                                       *
+ *  Notes:                                                                    *
+ *      1.) If f(a) and f(b) have the same sign, or either is NaN, then NaN   *
+ *          is returned. Only these two evaluations are made in this case.    *
+ *                                                                            *
+ *      2.) If f(a) or f(b) is zero, that endpoint is returned.               *
+ *                                                                            *
+ *      3.) a > b is allowed. The endpoints are swapped.                      *
+ *                                                                            *
+ *      4.) The iteration also stops once the bracket is smaller than         *
+ *          DBL_EPS max(|a|, |b|) for the current endpoints, since it can not *
+ *          be made smaller than this. For a root at zero this allows an      *
+ *          accurate answer even if the initial bracket is very wide.         *
+ *                                                                            *
+ *      5.) The total number of evaluations is at most max_iters + 2.         *
+ *                                                                            *
+ *      6.) Float and long double versions are provided as well.              *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file with the absolute value function and NaN.             *
+ *  2.) tmpl_float.h:                                                         *
+ *          Header file with the machine epsilon.                             *
+ *  3.) tmpl_root_finding_real.h:                                             *
+ *          Header file where the function prototypes are given.              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Absolute value functions and the NaN macros found here.                   */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Machine epsilon for float, double, and long double.                       */
+#include <libtmpl/include/tmpl_float.h>
+
+/*  Function prototypes given here.                                           */
+#include <libtmpl/include/tmpl_root_finding_real.h>
+
+/*  The ITP method for float precision.                                       */
+float
+tmpl_ITP_Method_Float(float a,
+                      float b,
+                      float (*f)(float),
+                      unsigned int max_iters,
+                      float eps)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    float fa, fb, fx, x, x_half, x_f, sigma, delta, dist;
+    float abs_a, abs_b, half, radius, budget, k1, tol;
+    unsigned int n;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!f)
+        return TMPL_NANF;
+
+    /*  The method works with a < b. Swap the endpoints if needed.            */
+    if (b < a)
+    {
+        x = a;
+        a = b;
+        b = x;
+    }
+
+    /*  These are the only two evaluations outside of the main loop.          */
+    fa = f(a);
+    fb = f(b);
+
+    /*  Either endpoint may already be a root.                                */
+    if (fa == 0.0F)
+        return a;
+
+    if (fb == 0.0F)
+        return b;
+
+    /*  The function must change sign on [a, b]. This also catches NaN.       */
+    if (!((fa < 0.0F && fb > 0.0F) || (fa > 0.0F && fb < 0.0F)))
+        return TMPL_NANF;
+
+    /*  Work with half of the width of the bracket. b - a overflows for wide  *
+     *  brackets, such as [-FLT_MAX, FLT_MAX], but b/2 - a/2 does not.        */
+    half = 0.5F*b - 0.5F*a;
+
+    /*  Bisection needs n_half = ceil(log2((b - a) / (2 eps))) steps. ITP     *
+     *  allows n_half + 1 steps, and eps 2^(n_half + 1) is the total slack.   *
+     *  budget is half of this, computed by doubling, which is exact. If eps  *
+     *  is not positive, the spacing of the numbers near a and b is used. The *
+     *  budget is zero only for brackets of subnormal width, and then every   *
+     *  step bisects.                                                         */
+    budget = (eps > 0.0F ? eps : TMPL_FLT_EPS*half);
+
+    while (budget < half && budget > 0.0F)
+        budget *= 2.0F;
+
+    /*  Truncation parameters k1 = 0.2 / (b - a) and k2 = 2. In terms of the  *
+     *  half width, k1 (b - a)^2 = 0.4 half^2 / half_0. Store 0.4 / half_0.   */
+    k1 = 0.4F / half;
+
+    for (n = 0U; n < max_iters; ++n)
+    {
+        /*  The bracket can not be made smaller than the spacing of the       *
+         *  numbers near its endpoints, so stop there even if eps is smaller. *
+         *  This depends on where the root is, so it is checked every step.   */
+        abs_a = tmpl_Float_Abs(a);
+        abs_b = tmpl_Float_Abs(b);
+        tol = TMPL_FLT_EPS*(abs_a > abs_b ? abs_a : abs_b);
+
+        if (half <= eps || half <= tol)
+            break;
+
+        /*  Interpolation: the regula falsi point, relative to the midpoint.  *
+         *  f(a) and f(b) have opposite signs, so |f(a) + f(b)| is at most    *
+         *  |f(a) - f(b)| and dist is at most half in magnitude.              */
+        x_half = 0.5F*a + 0.5F*b;
+        dist = half*((fa + fb) / (fb - fa));
+        x_f = x_half - dist;
+        sigma = (dist < 0.0F ? -1.0F : 1.0F);
+
+        /*  Truncation: move x_f towards the midpoint by k1 (b - a)^k2. The   *
+         *  product k1 half is at most 0.4, so this does not overflow.        */
+        delta = k1*half*half;
+
+        if (delta <= tmpl_Float_Abs(dist))
+            x = x_f + sigma*delta;
+        else
+            x = x_half;
+
+        /*  Projection: stay close enough to the midpoint that the number of  *
+         *  steps is at most one more than for bisection.                     */
+        radius = budget + (budget - half);
+        budget *= 0.5F;
+
+        if (tmpl_Float_Abs(x - x_half) > radius)
+            x = x_half - sigma*radius;
+
+        /*  Rounding may put x on an endpoint, or outside of (a, b). This     *
+         *  only happens when the interval is tiny, so bisect instead.        */
+        if (!(a < x && x < b))
+            x = x_half;
+
+        /*  This is the only evaluation per iteration.                        */
+        fx = f(x);
+
+        if (fx == 0.0F)
+            return x;
+
+        /*  Shrink the bracket, keeping the sign change inside.               */
+        if ((fx < 0.0F) == (fa < 0.0F))
+        {
+            a = x;
+            fa = fx;
+        }
+        else
+        {
+            b = x;
+            fb = fx;
+        }
+
+        half = 0.5F*b - 0.5F*a;
+    }
+
+    /*  Return the midpoint. It is within eps of the root.                    */
+    return 0.5F*a + 0.5F*b;
+}
+/*  End of tmpl_ITP_Method_Float.                                             */
+
+/*  The ITP method for double precision.                                      */
+double
+tmpl_ITP_Method_Double(double a,
+                       double b,
+                       double (*f)(double),
+                       unsigned int max_iters,
+                       double eps)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    double fa, fb, fx, x, x_half, x_f, sigma, delta, dist;
+    double abs_a, abs_b, half, radius, budget, k1, tol;
+    unsigned int n;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!f)
+        return TMPL_NAN;
+
+    /*  The method works with a < b. Swap the endpoints if needed.            */
+    if (b < a)
+    {
+        x = a;
+        a = b;
+        b = x;
+    }
+
+    /*  These are the only two evaluations outside of the main loop.          */
+    fa = f(a);
+    fb = f(b);
+
+    /*  Either endpoint may already be a root.                                */
+    if (fa == 0.0)
+        return a;
+
+    if (fb == 0.0)
+        return b;
+
+    /*  The function must change sign on [a, b]. This also catches NaN.       */
+    if (!((fa < 0.0 && fb > 0.0) || (fa > 0.0 && fb < 0.0)))
+        return TMPL_NAN;
+
+    /*  Work with half of the width of the bracket. b - a overflows for wide  *
+     *  brackets, such as [-DBL_MAX, DBL_MAX], but b/2 - a/2 does not.        */
+    half = 0.5*b - 0.5*a;
+
+    /*  Bisection needs n_half = ceil(log2((b - a) / (2 eps))) steps. ITP     *
+     *  allows n_half + 1 steps, and eps 2^(n_half + 1) is the total slack.   *
+     *  budget is half of this, computed by doubling, which is exact. If eps  *
+     *  is not positive, the spacing of the numbers near a and b is used. The *
+     *  budget is zero only for brackets of subnormal width, and then every   *
+     *  step bisects.                                                         */
+    budget = (eps > 0.0 ? eps : TMPL_DBL_EPS*half);
+
+    while (budget < half && budget > 0.0)
+        budget *= 2.0;
+
+    /*  Truncation parameters k1 = 0.2 / (b - a) and k2 = 2. In terms of the  *
+     *  half width, k1 (b - a)^2 = 0.4 half^2 / half_0. Store 0.4 / half_0.   */
+    k1 = 0.4 / half;
+
+    for (n = 0U; n < max_iters; ++n)
+    {
+        /*  The bracket can not be made smaller than the spacing of the       *
+         *  numbers near its endpoints, so stop there even if eps is smaller. *
+         *  This depends on where the root is, so it is checked every step.   */
+        abs_a = tmpl_Double_Abs(a);
+        abs_b = tmpl_Double_Abs(b);
+        tol = TMPL_DBL_EPS*(abs_a > abs_b ? abs_a : abs_b);
+
+        if (half <= eps || half <= tol)
+            break;
+
+        /*  Interpolation: the regula falsi point, relative to the midpoint.  *
+         *  f(a) and f(b) have opposite signs, so |f(a) + f(b)| is at most    *
+         *  |f(a) - f(b)| and dist is at most half in magnitude.              */
+        x_half = 0.5*a + 0.5*b;
+        dist = half*((fa + fb) / (fb - fa));
+        x_f = x_half - dist;
+        sigma = (dist < 0.0 ? -1.0 : 1.0);
+
+        /*  Truncation: move x_f towards the midpoint by k1 (b - a)^k2. The   *
+         *  product k1 half is at most 0.4, so this does not overflow.        */
+        delta = k1*half*half;
+
+        if (delta <= tmpl_Double_Abs(dist))
+            x = x_f + sigma*delta;
+        else
+            x = x_half;
+
+        /*  Projection: stay close enough to the midpoint that the number of  *
+         *  steps is at most one more than for bisection.                     */
+        radius = budget + (budget - half);
+        budget *= 0.5;
+
+        if (tmpl_Double_Abs(x - x_half) > radius)
+            x = x_half - sigma*radius;
+
+        /*  Rounding may put x on an endpoint, or outside of (a, b). This     *
+         *  only happens when the interval is tiny, so bisect instead.        */
+        if (!(a < x && x < b))
+            x = x_half;
+
+        /*  This is the only evaluation per iteration.                        */
+        fx = f(x);
+
+        if (fx == 0.0)
+            return x;
+
+        /*  Shrink the bracket, keeping the sign change inside.               */
+        if ((fx < 0.0) == (fa < 0.0))
+        {
+            a = x;
+            fa = fx;
+        }
+        else
+        {
+            b = x;
+            fb = fx;
+        }
+
+        half = 0.5*b - 0.5*a;
+    }
+
+    /*  Return the midpoint. It is within eps of the root.                    */
+    return 0.5*a + 0.5*b;
+}
+/*  End of tmpl_ITP_Method_Double.                                            */
+
+/*  The ITP method for long double precision.                                 */
+long double
+tmpl_ITP_Method_LDouble(long double a,
+                        long double b,
+                        long double (*f)(long double),
+                        unsigned int max_iters,
+                        long double eps)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    long double fa, fb, fx, x, x_half, x_f, sigma, delta, dist;
+    long double abs_a, abs_b, half, radius, budget, k1, tol;
+    unsigned int n;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!f)
+        return TMPL_NANL;
+
+    /*  The method works with a < b. Swap the endpoints if needed.            */
+    if (b < a)
+    {
+        x = a;
+        a = b;
+        b = x;
+    }
+
+    /*  These are the only two evaluations outside of the main loop.          */
+    fa = f(a);
+    fb = f(b);
+
+    /*  Either endpoint may already be a root.                                */
+    if (fa == 0.0L)
+        return a;
+
+    if (fb == 0.0L)
+        return b;
+
+    /*  The function must change sign on [a, b]. This also catches NaN.       */
+    if (!((fa < 0.0L && fb > 0.0L) || (fa > 0.0L && fb < 0.0L)))
+        return TMPL_NANL;
+
+    /*  Work with half of the width of the bracket. b - a overflows for wide  *
+     *  brackets, such as [-LDBL_MAX, LDBL_MAX], but b/2 - a/2 does not.      */
+    half = 0.5L*b - 0.5L*a;
+
+    /*  Bisection needs n_half = ceil(log2((b - a) / (2 eps))) steps. ITP     *
+     *  allows n_half + 1 steps, and eps 2^(n_half + 1) is the total slack.   *
+     *  budget is half of this, computed by doubling, which is exact. If eps  *
+     *  is not positive, the spacing of the numbers near a and b is used. The *
+     *  budget is zero only for brackets of subnormal width, and then every   *
+     *  step bisects.                                                         */
+    budget = (eps > 0.0L ? eps : TMPL_LDBL_EPS*half);
+
+    while (budget < half && budget > 0.0L)
+        budget *= 2.0L;
+
+    /*  Truncation parameters k1 = 0.2 / (b - a) and k2 = 2. In terms of the  *
+     *  half width, k1 (b - a)^2 = 0.4 half^2 / half_0. Store 0.4 / half_0.   */
+    k1 = 0.4L / half;
+
+    for (n = 0U; n < max_iters; ++n)
+    {
+        /*  The bracket can not be made smaller than the spacing of the       *
+         *  numbers near its endpoints, so stop there even if eps is smaller. *
+         *  This depends on where the root is, so it is checked every step.   */
+        abs_a = tmpl_LDouble_Abs(a);
+        abs_b = tmpl_LDouble_Abs(b);
+        tol = TMPL_LDBL_EPS*(abs_a > abs_b ? abs_a : abs_b);
+
+        if (half <= eps || half <= tol)
+            break;
+
+        /*  Interpolation: the regula falsi point, relative to the midpoint.  *
+         *  f(a) and f(b) have opposite signs, so |f(a) + f(b)| is at most    *
+         *  |f(a) - f(b)| and dist is at most half in magnitude.              */
+        x_half = 0.5L*a + 0.5L*b;
+        dist = half*((fa + fb) / (fb - fa));
+        x_f = x_half - dist;
+        sigma = (dist < 0.0L ? -1.0L : 1.0L);
+
+        /*  Truncation: move x_f towards the midpoint by k1 (b - a)^k2. The   *
+         *  product k1 half is at most 0.4, so this does not overflow.        */
+        delta = k1*half*half;
+
+        if (delta <= tmpl_LDouble_Abs(dist))
+            x = x_f + sigma*delta;
+        else
+            x = x_half;
+
+        /*  Projection: stay close enough to the midpoint that the number of  *
+         *  steps is at most one more than for bisection.                     */
+        radius = budget + (budget - half);
+        budget *= 0.5L;
+
+        if (tmpl_LDouble_Abs(x - x_half) > radius)
+            x = x_half - sigma*radius;
+
+        /*  Rounding may put x on an endpoint, or outside of (a, b). This     *
+         *  only happens when the interval is tiny, so bisect instead.        */
+        if (!(a < x && x < b))
+            x = x_half;
+
+        /*  This is the only evaluation per iteration.                        */
+        fx = f(x);
+
+        if (fx == 0.0L)
+            return x;
+
+        /*  Shrink the bracket, keeping the sign change inside.               */
+        if ((fx < 0.0L) == (fa < 0.0L))
+        {
+            a = x;
+            fa = fx;
+        }
+        else
+        {
+            b = x;
+            fb = fx;
+        }
+
+        half = 0.5L*b - 0.5L*a;
+    }
+
+    /*  Return the midpoint. It is within eps of the root.                    */
+    return 0.5L*a + 0.5L*b;
+}
+/*  End of tmpl_ITP_Method_LDouble.                                           */
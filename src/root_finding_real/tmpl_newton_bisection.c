@@ -0,0 +1,460 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                           tmpl_newton_bisection                            *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes a root of a real function with Newton's method, falling      *
+ *      back to bisection when Newton's method misbehaves.                    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Newton_Bisection_Double                                          *
+ *  Purpose:                                                                  *
+ *      Computes a root of f in [a, b].                                       *
+ *  Arguments:                                                                *
+ *      a (double):                                                           *
+ *          One endpoint of the bracket.                                      *
+ *      b (double):                                                           *
+ *          The other endpoint. f(a) and f(b) must have opposite signs.       *
+ *      f (double (*)(double)):                                               *
+ *          The function whose root is computed.                              *
+ *      f_prime (double (*)(double)):                                         *
+ *          The derivative of f. This may be NULL, in which case the slope    *
+ *          of the secant through the last two points is used instead.        *
+ *      max_iters (unsigned int):                                             *
+ *          The maximum number of iterations. Each uses one evaluation of f.  *
+ *      eps (double):                                                         *
+ *          The absolute tolerance for the root.                              *
+ *  Output:                                                                   *
+ *      root (double):                                                        *
+ *          A root of f in [a, b].                                            *
+ *  Called Functions:                                                         *
+ *      tmpl_math.h:                                                          *
+ *          tmpl_Double_Abs:                                                  *
+ *              Computes the absolute value of a real number.                 *
+ *  Method:                                                                   *
+ *      Keep a bracket [a, b] where f changes sign, and a current point x,    *
+ *      which is always one of the endpoints. Compute the Newton step         *
+ *      x - f(x) / s, where s is f'(x) or the secant slope. The step is       *
+ *      used if it lands strictly inside the bracket and is at most half      *
+ *      the size of the step before the previous one. Otherwise the next      *
+ *      point is the midpoint of the bracket. f is evaluated at the new       *
+ *      point and the bracket is updated with its sign.                       *
+ *                                                                            *
+ *      Unlike tmpl_Newton_Raphson_Double, this can not diverge, and it       *
+ *      needs at most about twice as many steps as bisection. Near a simple   *
+ *      root the Newton steps are always accepted, giving quadratic           *
+ *      convergence with f', and superlinear convergence with the secant.     *
+ *  Notes:                                                                    *
+ *      1.) If f(a) and f(b) have the same sign, or either is NaN, then NaN   *
+ *          is returned. Only these two evaluations are made in this case.    *
+ *                                                                            *
+ *      2.) If f(a) or f(b) is zero, that endpoint is returned.               *
+ *                                                                            *
+ *      3.) The iteration stops when the bracket is smaller than              *
+ *          2 (2 DBL_EPS |x| + eps / 2). Steps are never smaller than this    *
+ *          tolerance, so no evaluations are spent on points next to x.       *
+ *                                                                            *
+ *      4.) The total number of evaluations of f is at most max_iters + 2.    *
+ *          If f_prime is not NULL, it is evaluated once per iteration.       *
+ *                                                                            *
+ *      5.) Float and long double versions are provided as well.              *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file with the absolute value function and NaN.             *
+ *  2.) tmpl_float.h:                                                         *
+ *          Header file with the machine epsilon.                             *
+ *  3.) tmpl_root_finding_real.h:                                             *
+ *          Header file where the function prototypes are given.              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Absolute value functions and the NaN macros found here.                   */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Machine epsilon for float, double, and long double.                       */
+#include <libtmpl/include/tmpl_float.h>
+
+/*  Function prototypes given here.                                           */
+#include <libtmpl/include/tmpl_root_finding_real.h>
+
+/*  Safeguarded Newton's method for float precision.                          */
+float
+tmpl_Newton_Bisection_Float(float a,
+                            float b,
+                            float (*f)(float),
+                            float (*f_prime)(float),
+                            unsigned int max_iters,
+                            float eps)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    float fa, fb, x, fx, x_old, fx_old, slope, dx, dx_old, x_new, tol;
+    unsigned int n;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!f)
+        return TMPL_NANF;
+
+    /*  These are the only two evaluations outside of the main loop.          */
+    fa = f(a);
+    fb = f(b);
+
+    /*  Either endpoint may already be a root.                                */
+    if (fa == 0.0F)
+        return a;
+
+    if (fb == 0.0F)
+        return b;
+
+    /*  The function must change sign on [a, b]. This also catches NaN.       */
+    if (!((fa < 0.0F && fb > 0.0F) || (fa > 0.0F && fb < 0.0F)))
+        return TMPL_NANF;
+
+    /*  Start at the endpoint with the smaller function value. The other one  *
+     *  is the previous point for the secant slope. x is always one of the    *
+     *  endpoints of the bracket, so a step of tol towards the inside is safe *
+     *  while b - a > 2 tol.                                                  */
+    if (tmpl_Float_Abs(fa) < tmpl_Float_Abs(fb))
+    {
+        x = a;
+        fx = fa;
+        x_old = b;
+        fx_old = fb;
+    }
+    else
+    {
+        x = b;
+        fx = fb;
+        x_old = a;
+        fx_old = fa;
+    }
+
+    /*  The step before the last one. Start with the width of the bracket so  *
+     *  that the first Newton step is always tried.                           */
+    dx_old = tmpl_Float_Abs(b - a);
+
+    for (n = 0U; n < max_iters; ++n)
+    {
+        tol = 2.0F*TMPL_FLT_EPS*tmpl_Float_Abs(x) + 0.5F*eps;
+
+        /*  The bracket is already small enough.                              */
+        if (tmpl_Float_Abs(b - a) <= 2.0F*tol)
+            return 0.5F*a + 0.5F*b;
+
+        /*  Use f' if it is available, and the secant slope otherwise.        */
+        if (f_prime)
+            slope = f_prime(x);
+        else
+            slope = (fx - fx_old) / (x - x_old);
+
+        /*  Take the Newton step if it shrinks faster than bisection would.   *
+         *  Steps are never smaller than the tolerance, and are always taken  *
+         *  towards the inside of the bracket. This avoids wasting            *
+         *  evaluations on points that are indistinguishable from x.          */
+        if (slope != 0.0F &&
+            2.0F*tmpl_Float_Abs(fx) <= tmpl_Float_Abs(dx_old*slope))
+        {
+            dx = -fx / slope;
+
+            if (tmpl_Float_Abs(dx) < tol)
+                dx = (x == a ? tol : -tol);
+        }
+
+        /*  Otherwise use dx = 0. x is an endpoint of the bracket, so x + dx  *
+         *  is rejected below, the same as a step that leaves [a, b].         */
+        else
+            dx = 0.0F;
+
+        x_new = x + dx;
+
+        if (!(a < x_new && x_new < b))
+        {
+            x_new = 0.5F*a + 0.5F*b;
+            dx = x_new - x;
+        }
+
+        dx_old = dx;
+        x_old = x;
+        fx_old = fx;
+        x = x_new;
+
+        /*  This is the only evaluation of f per iteration.                   */
+        fx = f(x);
+
+        if (fx == 0.0F)
+            return x;
+
+        /*  Shrink the bracket, keeping the sign change inside.               */
+        if ((fx < 0.0F) == (fa < 0.0F))
+        {
+            a = x;
+            fa = fx;
+        }
+        else
+            b = x;
+    }
+
+    return x;
+}
+/*  End of tmpl_Newton_Bisection_Float.                                       */
+
+/*  Safeguarded Newton's method for double precision.                         */
+double
+tmpl_Newton_Bisection_Double(double a,
+                             double b,
+                             double (*f)(double),
+                             double (*f_prime)(double),
+                             unsigned int max_iters,
+                             double eps)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    double fa, fb, x, fx, x_old, fx_old, slope, dx, dx_old, x_new, tol;
+    unsigned int n;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!f)
+        return TMPL_NAN;
+
+    /*  These are the only two evaluations outside of the main loop.          */
+    fa = f(a);
+    fb = f(b);
+
+    /*  Either endpoint may already be a root.                                */
+    if (fa == 0.0)
+        return a;
+
+    if (fb == 0.0)
+        return b;
+
+    /*  The function must change sign on [a, b]. This also catches NaN.       */
+    if (!((fa < 0.0 && fb > 0.0) || (fa > 0.0 && fb < 0.0)))
+        return TMPL_NAN;
+
+    /*  Start at the endpoint with the smaller function value. The other one  *
+     *  is the previous point for the secant slope. x is always one of the    *
+     *  endpoints of the bracket, so a step of tol towards the inside is safe *
+     *  while b - a > 2 tol.                                                  */
+    if (tmpl_Double_Abs(fa) < tmpl_Double_Abs(fb))
+    {
+        x = a;
+        fx = fa;
+        x_old = b;
+        fx_old = fb;
+    }
+    else
+    {
+        x = b;
+        fx = fb;
+        x_old = a;
+        fx_old = fa;
+    }
+
+    /*  The step before the last one. Start with the width of the bracket so  *
+     *  that the first Newton step is always tried.                           */
+    dx_old = tmpl_Double_Abs(b - a);
+
+    for (n = 0U; n < max_iters; ++n)
+    {
+        tol = 2.0*TMPL_DBL_EPS*tmpl_Double_Abs(x) + 0.5*eps;
+
+        /*  The bracket is already small enough.                              */
+        if (tmpl_Double_Abs(b - a) <= 2.0*tol)
+            return 0.5*a + 0.5*b;
+
+        /*  Use f' if it is available, and the secant slope otherwise.        */
+        if (f_prime)
+            slope = f_prime(x);
+        else
+            slope = (fx - fx_old) / (x - x_old);
+
+        /*  Take the Newton step if it shrinks faster than bisection would.   *
+         *  Steps are never smaller than the tolerance, and are always taken  *
+         *  towards the inside of the bracket. This avoids wasting            *
+         *  evaluations on points that are indistinguishable from x.          */
+        if (slope != 0.0 &&
+            2.0*tmpl_Double_Abs(fx) <= tmpl_Double_Abs(dx_old*slope))
+        {
+            dx = -fx / slope;
+
+            if (tmpl_Double_Abs(dx) < tol)
+                dx = (x == a ? tol : -tol);
+        }
+
+        /*  Otherwise use dx = 0. x is an endpoint of the bracket, so x + dx  *
+         *  is rejected below, the same as a step that leaves [a, b].         */
+        else
+            dx = 0.0;
+
+        x_new = x + dx;
+
+        if (!(a < x_new && x_new < b))
+        {
+            x_new = 0.5*a + 0.5*b;
+            dx = x_new - x;
+        }
+
+        dx_old = dx;
+        x_old = x;
+        fx_old = fx;
+        x = x_new;
+
+        /*  This is the only evaluation of f per iteration.                   */
+        fx = f(x);
+
+        if (fx == 0.0)
+            return x;
+
+        /*  Shrink the bracket, keeping the sign change inside.               */
+        if ((fx < 0.0) == (fa < 0.0))
+        {
+            a = x;
+            fa = fx;
+        }
+        else
+            b = x;
+    }
+
+    return x;
+}
+/*  End of tmpl_Newton_Bisection_Double.                                      */
+
+/*  Safeguarded Newton's method for long double precision.                    */
+long double
+tmpl_Newton_Bisection_LDouble(long double a,
+                              long double b,
+                              long double (*f)(long double),
+                              long double (*f_prime)(long double),
+                              unsigned int max_iters,
+                              long double eps)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    long double fa, fb, x, fx, x_old, fx_old, slope, dx, dx_old, x_new, tol;
+    unsigned int n;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!f)
+        return TMPL_NANL;
+
+    /*  These are the only two evaluations outside of the main loop.          */
+    fa = f(a);
+    fb = f(b);
+
+    /*  Either endpoint may already be a root.                                */
+    if (fa == 0.0L)
+        return a;
+
+    if (fb == 0.0L)
+        return b;
+
+    /*  The function must change sign on [a, b]. This also catches NaN.       */
+    if (!((fa < 0.0L && fb > 0.0L) || (fa > 0.0L && fb < 0.0L)))
+        return TMPL_NANL;
+
+    /*  Start at the endpoint with the smaller function value. The other one  *
+     *  is the previous point for the secant slope. x is always one of the    *
+     *  endpoints of the bracket, so a step of tol towards the inside is safe *
+     *  while b - a > 2 tol.                                                  */
+    if (tmpl_LDouble_Abs(fa) < tmpl_LDouble_Abs(fb))
+    {
+        x = a;
+        fx = fa;
+        x_old = b;
+        fx_old = fb;
+    }
+    else
+    {
+        x = b;
+        fx = fb;
+        x_old = a;
+        fx_old = fa;
+    }
+
+    /*  The step before the last one. Start with the width of the bracket so  *
+     *  that the first Newton step is always tried.                           */
+    dx_old = tmpl_LDouble_Abs(b - a);
+
+    for (n = 0U; n < max_iters; ++n)
+    {
+        tol = 2.0L*TMPL_LDBL_EPS*tmpl_LDouble_Abs(x) + 0.5L*eps;
+
+        /*  The bracket is already small enough.                              */
+        if (tmpl_LDouble_Abs(b - a) <= 2.0L*tol)
+            return 0.5L*a + 0.5L*b;
+
+        /*  Use f' if it is available, and the secant slope otherwise.        */
+        if (f_prime)
+            slope = f_prime(x);
+        else
+            slope = (fx - fx_old) / (x - x_old);
+
+        /*  Take the Newton step if it shrinks faster than bisection would.   *
+         *  Steps are never smaller than the tolerance, and are always taken  *
+         *  towards the inside of the bracket. This avoids wasting            *
+         *  evaluations on points that are indistinguishable from x.          */
+        if (slope != 0.0L &&
+            2.0L*tmpl_LDouble_Abs(fx) <= tmpl_LDouble_Abs(dx_old*slope))
+        {
+            dx = -fx / slope;
+
+            if (tmpl_LDouble_Abs(dx) < tol)
+                dx = (x == a ? tol : -tol);
+        }
+
+        /*  Otherwise use dx = 0. x is an endpoint of the bracket, so x + dx  *
+         *  is rejected below, the same as a step that leaves [a, b].         */
+        else
+            dx = 0.0L;
+
+        x_new = x + dx;
+
+        if (!(a < x_new && x_new < b))
+        {
+            x_new = 0.5L*a + 0.5L*b;
+            dx = x_new - x;
+        }
+
+        dx_old = dx;
+        x_old = x;
+        fx_old = fx;
+        x = x_new;
+
+        /*  This is the only evaluation of f per iteration.                   */
+        fx = f(x);
+
+        if (fx == 0.0L)
+            return x;
+
+        /*  Shrink the bracket, keeping the sign change inside.               */
+        if ((fx < 0.0L) == (fa < 0.0L))
+        {
+            a = x;
+            fa = fx;
+        }
+        else
+            b = x;
+    }
+
+    return x;
+}
+/*  End of tmpl_Newton_Bisection_LDouble.                                     */
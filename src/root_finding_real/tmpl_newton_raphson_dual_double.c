@@ -0,0 +1,112 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                      tmpl_newton_raphson_dual_double                       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Newton's method with the derivative computed by dual numbers.         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Newton_Raphson_Dual_Double                                       *
+ *  Purpose:                                                                  *
+ *      Computes a root of f near x without a derivative callback.            *
+ *  Arguments:                                                                *
+ *      x (double):                                                           *
+ *          The starting point.                                               *
+ *      f (tmpl_DualDouble (*)(tmpl_DualDouble)):                             *
+ *          The function, written with the routines from tmpl_dual.h.         *
+ *      max_iters (unsigned int):                                             *
+ *          At most max_iters + 1 steps are taken.                            *
+ *      eps (double):                                                         *
+ *          The iteration stops when the Newton step is no larger than eps.   *
+ *  Output:                                                                   *
+ *      root (double):                                                        *
+ *          An approximate root of f.                                         *
+ *  Called Functions:                                                         *
+ *      tmpl_math.h:                                                          *
+ *          tmpl_Double_Abs:                                                  *
+ *              Computes the absolute value of a real number.                 *
+ *  Method:                                                                   *
+ *      Same as tmpl_Newton_Raphson_Double, x_{n+1} = x_n - f(x_n) / f'(x_n). *
+ *      Evaluating f at x_n + e gives f(x_n) + f'(x_n) e, so both values      *
+ *      come from a single call to f.                                         *
+ *  Notes:                                                                    *
+ *      1.) If f'(x_n) = 0 for some n, NaN is returned.                       *
+ *                                                                            *
+ *      2.) Like tmpl_Newton_Raphson_Double, this may diverge for a poor      *
+ *          starting point. See tmpl_Newton_Bisection_Double for a method     *
+ *          that is guaranteed to converge on a bracket.                      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file with the absolute value function and NaN.             *
+ *  2.) tmpl_dual_double.h:                                                   *
+ *          Header file with the tmpl_DualDouble typedef.                     *
+ *  3.) tmpl_root_finding_real.h:                                             *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  tmpl_Double_Abs and TMPL_NAN found here.                                  */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Dual number typedef provided here.                                        */
+#include <libtmpl/include/types/tmpl_dual_double.h>
+
+/*  Function prototype given here.                                            */
+#include <libtmpl/include/tmpl_root_finding_real.h>
+
+/*  Newton's method with f and f' from one evaluation of f.                   */
+double
+tmpl_Newton_Raphson_Dual_Double(double x,
+                                tmpl_DualDouble (*f)(tmpl_DualDouble),
+                                unsigned int max_iters, double eps)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    tmpl_DualDouble x_dual, y;
+    double dx;
+    unsigned int n;
+
+    /*  The dual part of the input is dx/dx = 1 for every iteration.          */
+    x_dual.dat[1] = 1.0;
+
+    for (n = 0U; n <= max_iters; ++n)
+    {
+        /*  y = f(x) + f'(x) e.                                               */
+        x_dual.dat[0] = x;
+        y = f(x_dual);
+
+        /*  If the derivative is zero, Newton-Raphson fails. Return NaN.      */
+        if (y.dat[1] == 0.0)
+            return TMPL_NAN;
+
+        dx = y.dat[0] / y.dat[1];
+        x -= dx;
+
+        if (tmpl_Double_Abs(dx) <= eps)
+            break;
+    }
+
+    return x;
+}
+/*  End of tmpl_Newton_Raphson_Dual_Double.                                   */
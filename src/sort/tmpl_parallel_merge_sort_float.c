@@ -0,0 +1,367 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                       tmpl_parallel_merge_sort_float                       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Sorts an array of floats using all available cores.                   *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *                       tmpl_Float_Parallel_Merge_Sort                       *
+ *  Purpose:                                                                  *
+ *      Sorts an array of real numbers in increasing order. With OpenMP       *
+ *      support the work is split across all threads.                         *
+ *  Arguments:                                                                *
+ *      arr (float *):                                                        *
+ *          An array of real numbers.                                         *
+ *      len (size_t):                                                         *
+ *          The number of elements in the array.                              *
+ *  Output:                                                                   *
+ *      success (int):                                                        *
+ *          0 if fail (malloc returns NULL), 1 if successful.                 *
+ *  Called Functions:                                                         *
+ *      tmpl_sort.h:                                                          *
+ *          tmpl_Float_Merge_Sort:                                            *
+ *              Serial merge sort, used for small arrays or without OpenMP.   *
+ *      omp.h:                                                                *
+ *          omp_get_max_threads:                                              *
+ *              Returns the number of threads a parallel region may use.      *
+ *  Method:                                                                   *
+ *      The array is cut into T contiguous runs of nearly equal length, T     *
+ *      being the number of threads. Each thread sorts its own run with a     *
+ *      bottom-up merge sort (insertion sort is used for tiny blocks). This   *
+ *      leaves T sorted runs that are merged together in ceil(log2(T))        *
+ *      rounds, each round merging adjacent pairs of runs.                    *
+ *                                                                            *
+ *      A naive pairwise merge would leave most threads idle in the final     *
+ *      rounds (the last round has only one pair). To avoid this, every pair  *
+ *      is itself merged by all T threads. The output of a pair is cut into T *
+ *      equal slices, and the start of each slice is located in the two input *
+ *      runs with a binary search (the "co-rank" or "merge path" search).     *
+ *      Each thread then performs an ordinary serial merge on its own slice.  *
+ *      Every round thus touches each element once, using all threads.        *
+ *                                                                            *
+ *      The total work is O(N log(N / T) / T + N log(T) / T) per thread.      *
+ *  Notes:                                                                    *
+ *      1.) The sort is stable. Ties are resolved in favor of the left run,   *
+ *          both in the co-rank search and in the serial merges.              *
+ *                                                                            *
+ *      2.) For arrays with fewer than TMPL_PARALLEL_SORT_MIN_LENGTH elements *
+ *          the overhead of starting threads outweighs the benefit and the    *
+ *          serial tmpl_Float_Merge_Sort is used instead. The serial routine  *
+ *          is also used when libtmpl is built without OpenMP (OMP=1).        *
+ *                                                                            *
+ *      3.) A temporary array of len elements is allocated. If malloc fails   *
+ *          the data is left untouched and 0 is returned.                     *
+ *                                                                            *
+ *      4.) As with the serial version, NaN does not compare and the output   *
+ *          is unspecified if the array contains NaNs.                        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          Standard library header file with malloc and free.                *
+ *  2.) tmpl_sort.h:                                                          *
+ *          Header file where the function prototype is given.                *
+ *  3.) omp.h:                                                                *
+ *          OpenMP header file. Only included if OpenMP is enabled.           *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  malloc, free, and size_t found here.                                      */
+#include <stdlib.h>
+
+/*  Function prototype found here.                                            */
+#include <libtmpl/include/tmpl_sort.h>
+
+/*  The parallel algorithm is only used if OpenMP support is available.       */
+#ifdef _OPENMP
+
+/*  omp_get_max_threads provided here.                                        */
+#include <omp.h>
+
+/*  Blocks smaller than this are sorted with insertion sort before merging.   */
+#define TMPL_INSERTION_BLOCK ((size_t)32)
+
+/*  Merges two sorted arrays, a and b, into out. Ties are taken from a.       */
+static void
+tmpl_float_merge(const float * const a, size_t a_len,
+                 const float * const b, size_t b_len,
+                 float * const out)
+{
+    /*  Indices for a, b, and the output, respectively.                       */
+    size_t m = 0, n = 0, k = 0;
+
+    /*  Take the smaller of the two heads until one of the arrays runs out.   */
+    while ((m < a_len) && (n < b_len))
+    {
+        if (a[m] <= b[n])
+            out[k++] = a[m++];
+        else
+            out[k++] = b[n++];
+    }
+
+    /*  Copy whatever is left over. Only one of these loops does any work.    */
+    while (m < a_len)
+        out[k++] = a[m++];
+
+    while (n < b_len)
+        out[k++] = b[n++];
+}
+/*  End of tmpl_float_merge.                                                  */
+
+/*  Given sorted arrays a and b, computes how many of the first k elements of *
+ *  their (stable) merge come from a. This is the "co-rank" of k.             */
+static size_t
+tmpl_float_co_rank(const float * const a, size_t a_len,
+                   const float * const b, size_t b_len,
+                   size_t k)
+{
+    /*  The answer lies in [low, high]. At most b_len elements come from b,   *
+     *  and at most a_len elements can come from a.                           */
+    size_t low = (k > b_len ? k - b_len : 0);
+    size_t high = (k < a_len ? k : a_len);
+
+    /*  Binary search for the smallest i with a[i] > b[k - i - 1].            */
+    while (low < high)
+    {
+        const size_t i = low + ((high - low) >> 1);
+
+        /*  a[i] belongs before b[k - i - 1], so more elements come from a.   */
+        if (a[i] <= b[k - i - 1])
+            low = i + 1;
+
+        /*  Otherwise a[i] is not among the first k elements of the merge.    */
+        else
+            high = i;
+    }
+
+    return low;
+}
+/*  End of tmpl_float_co_rank.                                                */
+
+/*  Sorts a single run serially. buf is scratch space with len elements.      */
+static void
+tmpl_float_sort_run(float * const arr, float * const buf, size_t len)
+{
+    /*  Variables for indexing and for the current width of sorted blocks.    */
+    size_t start, width, ind, k;
+
+    /*  The merges ping-pong between arr and buf to avoid needless copies.    */
+    float *src = arr;
+    float *dst = buf;
+    float *tmp;
+
+    /*  Start by insertion sorting small blocks. This is fast for tiny        *
+     *  arrays and removes the first few (expensive) merge passes.            */
+    for (start = 0; start < len; start += TMPL_INSERTION_BLOCK)
+    {
+        const size_t end = (len - start > TMPL_INSERTION_BLOCK ?
+                            start + TMPL_INSERTION_BLOCK : len);
+
+        for (ind = start + 1; ind < end; ++ind)
+        {
+            const float val = arr[ind];
+
+            /*  Shift larger elements to the right until val fits in place.   */
+            for (k = ind; (k > start) && (arr[k - 1] > val); --k)
+                arr[k] = arr[k - 1];
+
+            arr[k] = val;
+        }
+    }
+
+    /*  Bottom-up merge of the sorted blocks.                                 */
+    for (width = TMPL_INSERTION_BLOCK; width < len; width = 2 * width)
+    {
+        for (start = 0; start < len; start += 2 * width)
+        {
+            /*  Clip the two halves to the end of the array.                  */
+            const size_t mid = (len - start > width ? start + width : len);
+            const size_t end = (len - mid > width ? mid + width : len);
+
+            tmpl_float_merge(
+                src + start, mid - start, src + mid, end - mid, dst + start
+            );
+        }
+
+        /*  The destination now holds the data. Swap the roles of the arrays. */
+        tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    /*  If an odd number of passes were made, the data lives in buf.          */
+    if (src != arr)
+        for (ind = 0; ind < len; ++ind)
+            arr[ind] = src[ind];
+}
+/*  End of tmpl_float_sort_run.                                               */
+
+/*  Computes the start of the nth of "parts" nearly equal pieces of length.   *
+ *  This avoids the possible overflow in n * length / parts.                  */
+static size_t
+tmpl_float_split_index(size_t length, size_t parts, size_t n)
+{
+    const size_t quotient = length / parts;
+    const size_t remainder = length % parts;
+    return quotient * n + (n < remainder ? n : remainder);
+}
+/*  End of tmpl_float_split_index.                                            */
+
+#endif
+/*  End of #ifdef _OPENMP.                                                    */
+
+/*  Multi-threaded merge sort for an array arr of length len.                 */
+int tmpl_Float_Parallel_Merge_Sort(float *arr, size_t len)
+{
+#ifdef _OPENMP
+
+    /*  Declare all necessary variables. C89 requires this at the top.        */
+    size_t threads, runs, pairs, tasks, n;
+    float *buf, *src, *dst, *tmp;
+
+    /*  The boundaries of the sorted runs. runs + 1 elements are needed.      */
+    size_t *bounds;
+
+    /*  Nothing to sort for a NULL pointer. Treat this as an error.           */
+    if (!arr)
+        return 0;
+
+    /*  Small arrays, or a single thread, are handled by the serial sort.     */
+    threads = (size_t)omp_get_max_threads();
+
+    if ((len < TMPL_PARALLEL_SORT_MIN_LENGTH) || (threads < 2))
+        return tmpl_Float_Merge_Sort(arr, len);
+
+    /*  Scratch space for the merges, and the boundaries of the runs.         */
+    buf = malloc(sizeof(*buf) * len);
+    bounds = malloc(sizeof(*bounds) * (threads + 1));
+
+    /*  Check if malloc failed. The input is untouched if it did.             */
+    if ((!buf) || (!bounds))
+    {
+        free(buf);
+        free(bounds);
+        return 0;
+    }
+
+    /*  Cut the input into one run per thread.                                */
+    runs = threads;
+
+    for (n = 0; n <= runs; ++n)
+        bounds[n] = tmpl_float_split_index(len, runs, n);
+
+    /*  Each thread sorts its own run. The scratch space is shared but the    *
+     *  runs are disjoint, so each thread uses the matching part of buf.      */
+#pragma omp parallel for
+    for (n = 0; n < runs; ++n)
+        tmpl_float_sort_run(
+            arr + bounds[n], buf + bounds[n], bounds[n + 1] - bounds[n]
+        );
+
+    /*  The sorted runs live in arr. Merge adjacent pairs into buf next.      */
+    src = arr;
+    dst = buf;
+
+    /*  Merge adjacent runs until only one remains.                           */
+    while (runs > 1)
+    {
+        /*  If there are an odd number of runs, the last one has no partner.  *
+         *  It is merged with an empty run, which simply copies it over.      */
+        pairs = (runs + 1) >> 1;
+
+        /*  Every pair is merged by all of the threads.                       */
+        tasks = pairs * threads;
+
+#pragma omp parallel for
+        for (n = 0; n < tasks; ++n)
+        {
+            /*  The pair being merged, and which slice of it this task does.  */
+            const size_t pair = n / threads;
+            const size_t slice = n % threads;
+
+            /*  Index of the left run, and the right run (possibly empty).    */
+            const size_t left = 2 * pair;
+            const size_t right = (left + 1 < runs ? left + 1 : runs);
+            const size_t stop = (left + 2 < runs ? left + 2 : runs);
+
+            /*  Pointers to the two runs being merged, and their lengths.     */
+            const float * const a = src + bounds[left];
+            const float * const b = src + bounds[right];
+            const size_t a_len = bounds[right] - bounds[left];
+            const size_t b_len = bounds[stop] - bounds[right];
+            const size_t total = a_len + b_len;
+
+            /*  The portion of the merged output this task is responsible for.*/
+            const size_t k0 = tmpl_float_split_index(total, threads, slice);
+            const size_t k1 = tmpl_float_split_index(total, threads, slice+1);
+
+            /*  Find where these output positions start in a. The rest of the *
+             *  elements before the slice come from b.                        */
+            const size_t i0 = tmpl_float_co_rank(a, a_len, b, b_len, k0);
+            const size_t i1 = tmpl_float_co_rank(a, a_len, b, b_len, k1);
+
+            /*  Serially merge the elements that land in this slice.          */
+            tmpl_float_merge(
+                a + i0, i1 - i0, b + (k0 - i0), (k1 - i1) - (k0 - i0),
+                dst + bounds[left] + k0
+            );
+        }
+
+        /*  Pair p now occupies what used to be runs 2p and 2p + 1. Since     *
+         *  2p >= p, this can be done in place. The final boundary is len.    */
+        for (n = 0; n < pairs; ++n)
+            bounds[n] = bounds[2 * n];
+
+        bounds[pairs] = len;
+        runs = pairs;
+
+        /*  The merged data is now in dst. Swap the roles of the arrays.      */
+        tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    /*  If an odd number of rounds were made the sorted data is in buf.       */
+    if (src != arr)
+    {
+#pragma omp parallel for
+        for (n = 0; n < len; ++n)
+            arr[n] = src[n];
+    }
+
+    /*  Free the scratch space and return success.                            */
+    free(buf);
+    free(bounds);
+    return 1;
+
+#else
+/*  Else for #ifdef _OPENMP.                                                  */
+
+    /*  Without OpenMP there is nothing to gain. Use the serial algorithm.    */
+    return tmpl_Float_Merge_Sort(arr, len);
+
+#endif
+/*  End of #ifdef _OPENMP.                                                    */
+}
+/*  End of tmpl_Float_Parallel_Merge_Sort.                                    */
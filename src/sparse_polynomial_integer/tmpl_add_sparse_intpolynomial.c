@@ -0,0 +1,210 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                        tmpl_add_sparse_intpolynomial                       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Adds two sparse polynomials.                                          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_SparseIntPolynomial_Add                                          *
+ *  Purpose:                                                                  *
+ *      Computes sum = P + Q for sparse polynomials.                          *
+ *  Arguments:                                                                *
+ *      sum (tmpl_SparseIntPolynomial *):                                     *
+ *          The output polynomial. It may be the same as P or Q.              *
+ *      P (const tmpl_SparseIntPolynomial *):                                 *
+ *          The first polynomial.                                             *
+ *      Q (const tmpl_SparseIntPolynomial *):                                 *
+ *          The second polynomial.                                            *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates memory for the terms and degrees.                   *
+ *      tmpl_string.h:                                                        *
+ *          tmpl_strdup:                                                      *
+ *              Duplicates a string. Equivalent to the POSIX function strdup. *
+ *  Method:                                                                   *
+ *      Both inputs are sorted by degree, so the sum is a single merge of the *
+ *      two lists. Terms of equal degree are added, and dropped if they       *
+ *      cancel. This is O(t1 + t2) for t1 and t2 terms, independent of the    *
+ *      degree. The result is written to new arrays, and the old arrays of    *
+ *      sum are freed afterwards, so sum may be one of the inputs.            *
+ *  Notes:                                                                    *
+ *      1.) NULL polynomials are treated as zero.                             *
+ *                                                                            *
+ *      2.) If P or Q has its error_occurred Boolean set, so does sum.        *
+ *                                                                            *
+ *      3.) The coefficients are added with unsigned long arithmetic, so      *
+ *          overflow wraps around instead of being undefined behavior.        *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_malloc.h:                                                        *
+ *          Header file providing TMPL_MALLOC.                                *
+ *  3.) tmpl_free.h:                                                          *
+ *          Header file providing TMPL_FREE.                                  *
+ *  4.) tmpl_string.h:                                                        *
+ *          Header file where tmpl_strdup is declared.                        *
+ *  5.) tmpl_sparse_polynomial_integer.h:                                     *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_MALLOC and TMPL_FREE macros found here.                              */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  tmpl_strdup function declared here.                                       */
+#include <libtmpl/include/tmpl_string.h>
+
+/*  Polynomial typedefs and function prototype.                               */
+#include <libtmpl/include/tmpl_sparse_polynomial_integer.h>
+
+/*  Function for adding two sparse polynomials.                               */
+void
+tmpl_SparseIntPolynomial_Add(tmpl_SparseIntPolynomial *sum,
+                             const tmpl_SparseIntPolynomial *P,
+                             const tmpl_SparseIntPolynomial *Q)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    size_t m, n, count, length, p_length, q_length;
+    signed long int *terms;
+    size_t *degrees;
+
+    /*  If the output is NULL there is nothing to be done.                    */
+    if (!sum)
+        return;
+
+    /*  Similarly if an error occurred previously.                            */
+    if (sum->error_occurred)
+        return;
+
+    /*  If P or Q have an error, abort the computation.                       */
+    if ((P && P->error_occurred) || (Q && Q->error_occurred))
+    {
+        sum->error_occurred = tmpl_True;
+        sum->error_message = tmpl_strdup(
+            "\nError Encountered:\n"
+            "    tmpl_SparseIntPolynomial_Add\n\n"
+            "Input polynomial has error_occurred set to true.\n\n"
+        );
+
+        return;
+    }
+
+    /*  NULL polynomials have no terms.                                       */
+    p_length = (P ? P->number_of_terms : (size_t)0);
+    q_length = (Q ? Q->number_of_terms : (size_t)0);
+    length = p_length + q_length;
+
+    /*  The sum of two zero polynomials is zero.                              */
+    if (length == (size_t)0)
+    {
+        TMPL_FREE(sum->terms);
+        TMPL_FREE(sum->degree_of_term);
+        sum->number_of_terms = (size_t)0;
+        return;
+    }
+
+    /*  The sum has at most t1 + t2 terms.                                    */
+    terms = TMPL_MALLOC(signed long int, length);
+    degrees = TMPL_MALLOC(size_t, length);
+
+    /*  Check if malloc failed. Abort the computation if it did.              */
+    if (!terms || !degrees)
+    {
+        TMPL_FREE(terms);
+        TMPL_FREE(degrees);
+        sum->error_occurred = tmpl_True;
+        sum->error_message = tmpl_strdup(
+            "\nError Encountered:\n"
+            "    tmpl_SparseIntPolynomial_Add\n\n"
+            "malloc failed and returned NULL. Aborting.\n\n"
+        );
+
+        return;
+    }
+
+    /*  Merge the two sorted lists of terms.                                  */
+    m = n = count = 0;
+
+    while (m < p_length || n < q_length)
+    {
+        /*  Take the term of lower degree. Equal degrees are combined.        */
+        if (n == q_length ||
+            (m < p_length && P->degree_of_term[m] < Q->degree_of_term[n]))
+        {
+            terms[count] = P->terms[m];
+            degrees[count] = P->degree_of_term[m];
+            ++m;
+            ++count;
+        }
+
+        else if (m == p_length || Q->degree_of_term[n] < P->degree_of_term[m])
+        {
+            terms[count] = Q->terms[n];
+            degrees[count] = Q->degree_of_term[n];
+            ++n;
+            ++count;
+        }
+
+        else
+        {
+            const unsigned long int term = (unsigned long int)P->terms[m] +
+                                           (unsigned long int)Q->terms[n];
+
+            /*  Only keep the term if it did not cancel.                      */
+            if (term != 0UL)
+            {
+                terms[count] = (signed long int)term;
+                degrees[count] = P->degree_of_term[m];
+                ++count;
+            }
+
+            ++m;
+            ++n;
+        }
+    }
+
+    /*  The inputs have been read, the old terms of sum may be freed now.     */
+    TMPL_FREE(sum->terms);
+    TMPL_FREE(sum->degree_of_term);
+
+    /*  If every term cancelled the sum is zero.                              */
+    if (count == (size_t)0)
+    {
+        TMPL_FREE(terms);
+        TMPL_FREE(degrees);
+    }
+
+    sum->terms = terms;
+    sum->degree_of_term = degrees;
+    sum->number_of_terms = count;
+}
+/*  End of tmpl_SparseIntPolynomial_Add.                                      */
@@ -0,0 +1,252 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                 tmpl_create_from_data_sparse_intpolynomial                 *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Creates a sparse polynomial from a list of terms and degrees.         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_SparseIntPolynomial_Create_From_Data                             *
+ *  Purpose:                                                                  *
+ *      Given coefficients c_k and degrees d_k, creates the polynomial whose  *
+ *      terms are c_k x^d_k, in canonical form.                               *
+ *  Arguments:                                                                *
+ *      terms (const signed long int *):                                      *
+ *          The coefficients of the terms.                                    *
+ *      degrees (const size_t *):                                             *
+ *          The degrees of the terms. degrees[k] is the degree of terms[k].   *
+ *      len (size_t):                                                         *
+ *          The number of elements in terms and degrees.                      *
+ *  Output:                                                                   *
+ *      poly (tmpl_SparseIntPolynomial):                                      *
+ *          The sum of the terms.                                             *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates memory for the terms and degrees.                   *
+ *          realloc:                                                          *
+ *              Trims the arrays once duplicates and zeros are removed.       *
+ *      tmpl_string.h:                                                        *
+ *          tmpl_strdup:                                                      *
+ *              Duplicates a string. Equivalent to the POSIX function strdup. *
+ *  Method:                                                                   *
+ *      Copy the data and heap sort the pairs by degree, which is O(n log(n)) *
+ *      and needs no extra memory. Terms of equal degree are then adjacent.   *
+ *      Sum them, drop the terms that are zero, and trim the arrays.          *
+ *  Notes:                                                                    *
+ *      1.) The input may be in any order and may repeat degrees. The output  *
+ *          is in canonical form: degrees strictly increase, and no term is   *
+ *          zero. All sparse polynomial functions produce and expect this.    *
+ *                                                                            *
+ *      2.) If len is zero, or all terms cancel, the output is the zero       *
+ *          polynomial, which has no terms.                                   *
+ *                                                                            *
+ *      3.) NULL inputs, with positive len, are treated as an error.          *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_cast.h:                                                          *
+ *          Header file providing TMPL_CAST.                                  *
+ *  3.) tmpl_malloc.h:                                                        *
+ *          Header file providing TMPL_MALLOC.                                *
+ *  4.) tmpl_realloc.h:                                                       *
+ *          Header file providing TMPL_REALLOC.                               *
+ *  5.) tmpl_free.h:                                                          *
+ *          Header file providing TMPL_FREE.                                  *
+ *  6.) tmpl_string.h:                                                        *
+ *          Header file where tmpl_strdup is declared.                        *
+ *  7.) tmpl_sparse_polynomial_integer.h:                                     *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_CAST, TMPL_MALLOC, TMPL_REALLOC, and TMPL_FREE macros found here.    */
+#include <libtmpl/include/compat/tmpl_cast.h>
+#include <libtmpl/include/compat/tmpl_malloc.h>
+#include <libtmpl/include/compat/tmpl_realloc.h>
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  tmpl_strdup function declared here.                                       */
+#include <libtmpl/include/tmpl_string.h>
+
+/*  Polynomial typedefs and function prototype.                               */
+#include <libtmpl/include/tmpl_sparse_polynomial_integer.h>
+
+/*  Moves the pair at index "root" down the max-heap of the first "len" pairs.*/
+static void
+tmpl_sparse_sift_down(signed long int *terms,
+                      size_t *degrees,
+                      size_t root,
+                      size_t len)
+{
+    /*  Save the pair being moved, the children are shifted up in its place.  */
+    const signed long int term = terms[root];
+    const size_t degree = degrees[root];
+
+    /*  Loop until the pair has no children larger than itself.               */
+    while (2 * root + 1 < len)
+    {
+        size_t child = 2 * root + 1;
+
+        /*  Pick the larger of the two children, if there are two.            */
+        if (child + 1 < len && degrees[child + 1] > degrees[child])
+            ++child;
+
+        if (degrees[child] <= degree)
+            break;
+
+        terms[root] = terms[child];
+        degrees[root] = degrees[child];
+        root = child;
+    }
+
+    terms[root] = term;
+    degrees[root] = degree;
+}
+/*  End of tmpl_sparse_sift_down.                                             */
+
+/*  Function for creating a sparse polynomial from its terms.                 */
+tmpl_SparseIntPolynomial
+tmpl_SparseIntPolynomial_Create_From_Data(const signed long int *terms,
+                                          const size_t *degrees,
+                                          size_t len)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_SparseIntPolynomial poly;
+    size_t n, count;
+
+    /*  Start with the zero polynomial. This is returned for len = 0.         */
+    tmpl_SparseIntPolynomial_Init(&poly);
+
+    if (len == (size_t)0)
+        return poly;
+
+    /*  Check for invalid inputs. Treat these as an error.                    */
+    if (!terms || !degrees)
+    {
+        poly.error_occurred = tmpl_True;
+        poly.error_message = tmpl_strdup(
+            "\nError Encountered:\n"
+            "    tmpl_SparseIntPolynomial_Create_From_Data\n\n"
+            "Input arrays are NULL. Aborting.\n\n"
+        );
+
+        return poly;
+    }
+
+    poly.terms = TMPL_MALLOC(signed long int, len);
+    poly.degree_of_term = TMPL_MALLOC(size_t, len);
+
+    /*  Check if malloc failed. Abort the computation if it did.              */
+    if (!poly.terms || !poly.degree_of_term)
+    {
+        TMPL_FREE(poly.terms);
+        TMPL_FREE(poly.degree_of_term);
+        poly.error_occurred = tmpl_True;
+        poly.error_message = tmpl_strdup(
+            "\nError Encountered:\n"
+            "    tmpl_SparseIntPolynomial_Create_From_Data\n\n"
+            "malloc failed and returned NULL. Aborting.\n\n"
+        );
+
+        return poly;
+    }
+
+    for (n = 0; n < len; ++n)
+    {
+        poly.terms[n] = terms[n];
+        poly.degree_of_term[n] = degrees[n];
+    }
+
+    /*  Heap sort by degree. First build the heap, largest degree on top.     */
+    for (n = len / 2; n > 0; --n)
+        tmpl_sparse_sift_down(poly.terms, poly.degree_of_term, n - 1, len);
+
+    /*  Then repeatedly move the largest remaining pair to the end.           */
+    for (n = len - 1; n > 0; --n)
+    {
+        const signed long int term = poly.terms[n];
+        const size_t degree = poly.degree_of_term[n];
+
+        poly.terms[n] = poly.terms[0];
+        poly.degree_of_term[n] = poly.degree_of_term[0];
+        poly.terms[0] = term;
+        poly.degree_of_term[0] = degree;
+        tmpl_sparse_sift_down(poly.terms, poly.degree_of_term, 0, n);
+    }
+
+    /*  Combine terms of equal degree and drop the ones that are zero.        */
+    count = 0;
+    n = 0;
+
+    while (n < len)
+    {
+        const size_t degree = poly.degree_of_term[n];
+        unsigned long int sum = 0UL;
+
+        /*  Sum with unsigned arithmetic, overflow wraps around.              */
+        while (n < len && poly.degree_of_term[n] == degree)
+        {
+            sum += (unsigned long int)poly.terms[n];
+            ++n;
+        }
+
+        if (sum != 0UL)
+        {
+            poly.terms[count] = (signed long int)sum;
+            poly.degree_of_term[count] = degree;
+            ++count;
+        }
+    }
+
+    /*  If everything cancelled the result is the zero polynomial.            */
+    if (count == (size_t)0)
+    {
+        TMPL_FREE(poly.terms);
+        TMPL_FREE(poly.degree_of_term);
+        return poly;
+    }
+
+    /*  Give back the memory of the removed terms. If realloc fails the       *
+     *  larger arrays are still valid, so this is not treated as an error.    */
+    if (count < len)
+    {
+        void *tmp = TMPL_REALLOC(poly.terms, count);
+
+        if (tmp)
+            poly.terms = TMPL_CAST(tmp, signed long int *);
+
+        tmp = TMPL_REALLOC(poly.degree_of_term, count);
+
+        if (tmp)
+            poly.degree_of_term = TMPL_CAST(tmp, size_t *);
+    }
+
+    poly.number_of_terms = count;
+    return poly;
+}
+/*  End of tmpl_SparseIntPolynomial_Create_From_Data.                         */
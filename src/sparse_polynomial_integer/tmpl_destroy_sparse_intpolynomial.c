@@ -0,0 +1,82 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                     tmpl_destroy_sparse_intpolynomial                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Frees all of the memory in a sparse polynomial.                       *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_SparseIntPolynomial_Destroy                                      *
+ *  Purpose:                                                                  *
+ *      Frees the terms, the degrees, and the error message of a sparse       *
+ *      polynomial, and sets the pointers to NULL.                            *
+ *  Arguments:                                                                *
+ *      poly (tmpl_SparseIntPolynomial *):                                    *
+ *          A pointer to the polynomial that is to be destroyed.              *
+ *  Outputs:                                                                  *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          free:                                                             *
+ *              Frees memory allocated by malloc.                             *
+ *  Method:                                                                   *
+ *      Free each pointer and reset the variables to their zero values.       *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_free.h:                                                          *
+ *          Header providing TMPL_FREE.                                       *
+ *  3.) tmpl_sparse_polynomial_integer.h:                                     *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_FREE macro found here.                                               */
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Polynomial typedefs and function prototype.                               */
+#include <libtmpl/include/tmpl_sparse_polynomial_integer.h>
+
+/*  Function for freeing all memory in a sparse polynomial.                   */
+void tmpl_SparseIntPolynomial_Destroy(tmpl_SparseIntPolynomial *poly)
+{
+    /*  If the input is NULL there is nothing to be done.                     */
+    if (!poly)
+        return;
+
+    /*  Safely free the data and then set it to NULL to avoid double free's.  */
+    TMPL_FREE(poly->terms);
+    TMPL_FREE(poly->degree_of_term);
+
+    /*  Error messages for sparse polynomials are allocated with malloc.      */
+    TMPL_FREE(poly->error_message);
+
+    /*  Set the remaining variables to their default zero values.             */
+    poly->number_of_terms = (size_t)0;
+    poly->error_occurred = tmpl_False;
+}
+/*  End of tmpl_SparseIntPolynomial_Destroy.                                  */
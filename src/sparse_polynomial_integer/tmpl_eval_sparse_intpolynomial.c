@@ -0,0 +1,119 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                       tmpl_eval_sparse_intpolynomial                       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Evaluates a sparse polynomial at an integer.                          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_SparseIntPolynomial_Eval                                         *
+ *  Purpose:                                                                  *
+ *      Computes P(x) for a sparse polynomial P and an integer x.             *
+ *  Arguments:                                                                *
+ *      poly (const tmpl_SparseIntPolynomial *):                              *
+ *          The polynomial that is evaluated.                                 *
+ *      x (signed long int):                                                  *
+ *          The point P is evaluated at.                                      *
+ *  Output:                                                                   *
+ *      eval (signed long int):                                               *
+ *          The value P(x).                                                   *
+ *  Method:                                                                   *
+ *      Use Horner's method over the terms instead of over the degrees. With  *
+ *      terms c_k x^d_k sorted by degree, start with the leading coefficient  *
+ *      and for each lower term compute eval = eval * x^(d_{k+1} - d_k) + c_k.*
+ *      Finally multiply by x^d_0. The powers are computed by repeated        *
+ *      squaring, so the total cost is O(t log(deg)) rather than O(deg).      *
+ *  Notes:                                                                    *
+ *      1.) NULL polynomials, and polynomials with an error, are treated as   *
+ *          zero. This matches tmpl_IntPolynomial_Eval.                       *
+ *                                                                            *
+ *      2.) The arithmetic is done with unsigned long, so overflow wraps      *
+ *          around and the result is P(x) modulo 2^N, N the width of long.    *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_sparse_polynomial_integer.h:                                     *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Polynomial typedefs and function prototype.                               */
+#include <libtmpl/include/tmpl_sparse_polynomial_integer.h>
+
+/*  Computes x^n using repeated squaring. Overflow wraps around.              */
+static unsigned long int
+tmpl_sparse_pow(unsigned long int x, size_t n)
+{
+    unsigned long int out = 1UL;
+
+    while (n)
+    {
+        if (n & 1U)
+            out *= x;
+
+        x *= x;
+        n >>= 1;
+    }
+
+    return out;
+}
+/*  End of tmpl_sparse_pow.                                                   */
+
+/*  Function for evaluating a sparse polynomial at an integer.                */
+signed long int
+tmpl_SparseIntPolynomial_Eval(const tmpl_SparseIntPolynomial *poly,
+                              signed long int x)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    size_t n;
+    unsigned long int eval;
+    const unsigned long int ux = (unsigned long int)x;
+
+    /*  NULL polynomials are treated as zero.                                 */
+    if (!poly)
+        return 0L;
+
+    /*  Handle flawed polynomials in a similar manner. Return zero.           */
+    if (poly->error_occurred)
+        return 0L;
+
+    /*  The polynomial with no terms is zero.                                 */
+    if (poly->number_of_terms == (size_t)0)
+        return 0L;
+
+    /*  Horner's method over the terms, starting with the leading term.       */
+    n = poly->number_of_terms - 1;
+    eval = (unsigned long int)poly->terms[n];
+
+    while (n > 0)
+    {
+        const size_t gap = poly->degree_of_term[n] - poly->degree_of_term[n-1];
+        eval = eval * tmpl_sparse_pow(ux, gap);
+        eval += (unsigned long int)poly->terms[n - 1];
+        --n;
+    }
+
+    /*  The lowest term may have positive degree. Shift by this power.        */
+    eval *= tmpl_sparse_pow(ux, poly->degree_of_term[0]);
+    return (signed long int)eval;
+}
+/*  End of tmpl_SparseIntPolynomial_Eval.                                     */
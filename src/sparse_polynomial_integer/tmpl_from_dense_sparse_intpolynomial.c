@@ -0,0 +1,168 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                    tmpl_from_dense_sparse_intpolynomial                    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Converts a dense polynomial into a sparse one.                        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_SparseIntPolynomial_From_Dense                                   *
+ *  Purpose:                                                                  *
+ *      Stores the non-zero coefficients of a tmpl_IntPolynomial, and their   *
+ *      degrees, in a sparse polynomial.                                      *
+ *  Arguments:                                                                *
+ *      sparse (tmpl_SparseIntPolynomial *):                                  *
+ *          The output polynomial.                                            *
+ *      dense (const tmpl_IntPolynomial *):                                   *
+ *          The polynomial that is converted.                                 *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates memory for the terms and degrees.                   *
+ *      tmpl_string.h:                                                        *
+ *          tmpl_strdup:                                                      *
+ *              Duplicates a string. Equivalent to the POSIX function strdup. *
+ *  Method:                                                                   *
+ *      Count the non-zero coefficients, allocate exactly that many terms,    *
+ *      and copy them in order of increasing degree.                          *
+ *  Notes:                                                                    *
+ *      1.) NULL and empty polynomials are treated as zero.                   *
+ *                                                                            *
+ *      2.) If dense has its error_occurred Boolean set, so does sparse.      *
+ *                                                                            *
+ *      3.) Any previous terms of sparse are freed.                           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_malloc.h:                                                        *
+ *          Header file providing TMPL_MALLOC.                                *
+ *  3.) tmpl_free.h:                                                          *
+ *          Header file providing TMPL_FREE.                                  *
+ *  4.) tmpl_string.h:                                                        *
+ *          Header file where tmpl_strdup is declared.                        *
+ *  5.) tmpl_sparse_polynomial_integer.h:                                     *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_MALLOC and TMPL_FREE macros found here.                              */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  tmpl_strdup function declared here.                                       */
+#include <libtmpl/include/tmpl_string.h>
+
+/*  Polynomial typedefs and function prototype.                               */
+#include <libtmpl/include/tmpl_sparse_polynomial_integer.h>
+
+/*  Function for converting a dense polynomial into a sparse one.             */
+void
+tmpl_SparseIntPolynomial_From_Dense(tmpl_SparseIntPolynomial *sparse,
+                                    const tmpl_IntPolynomial *dense)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    size_t n, count;
+
+    /*  If the output is NULL there is nothing to be done.                    */
+    if (!sparse)
+        return;
+
+    /*  Similarly if an error occurred previously.                            */
+    if (sparse->error_occurred)
+        return;
+
+    /*  The old terms are replaced, free them.                                */
+    TMPL_FREE(sparse->terms);
+    TMPL_FREE(sparse->degree_of_term);
+    sparse->number_of_terms = (size_t)0;
+
+    /*  NULL and empty polynomials are zero, which has no terms.              */
+    if (!dense)
+        return;
+
+    /*  If the input has an error, abort the computation.                     */
+    if (dense->error_occurred)
+    {
+        sparse->error_occurred = tmpl_True;
+        sparse->error_message = tmpl_strdup(
+            "\nError Encountered:\n"
+            "    tmpl_SparseIntPolynomial_From_Dense\n\n"
+            "Input polynomial has error_occurred set to true.\n\n"
+        );
+
+        return;
+    }
+
+    if (!dense->coeffs)
+        return;
+
+    /*  Count the non-zero terms so the output can be allocated exactly.      */
+    count = 0;
+
+    for (n = 0; n <= dense->degree; ++n)
+        if (dense->coeffs[n] != 0)
+            ++count;
+
+    if (count == (size_t)0)
+        return;
+
+    sparse->terms = TMPL_MALLOC(signed long int, count);
+    sparse->degree_of_term = TMPL_MALLOC(size_t, count);
+
+    /*  Check if malloc failed. Abort the computation if it did.              */
+    if (!sparse->terms || !sparse->degree_of_term)
+    {
+        TMPL_FREE(sparse->terms);
+        TMPL_FREE(sparse->degree_of_term);
+        sparse->error_occurred = tmpl_True;
+        sparse->error_message = tmpl_strdup(
+            "\nError Encountered:\n"
+            "    tmpl_SparseIntPolynomial_From_Dense\n\n"
+            "malloc failed and returned NULL. Aborting.\n\n"
+        );
+
+        return;
+    }
+
+    /*  Copy the non-zero terms, in order of increasing degree.               */
+    count = 0;
+
+    for (n = 0; n <= dense->degree; ++n)
+    {
+        if (dense->coeffs[n] != 0)
+        {
+            sparse->terms[count] = (signed long int)dense->coeffs[n];
+            sparse->degree_of_term[count] = n;
+            ++count;
+        }
+    }
+
+    sparse->number_of_terms = count;
+}
+/*  End of tmpl_SparseIntPolynomial_From_Dense.                               */
@@ -0,0 +1,79 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                       tmpl_init_sparse_intpolynomial                       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Initialize a sparse polynomial by setting variables to zero values.   *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_SparseIntPolynomial_Init                                         *
+ *  Purpose:                                                                  *
+ *      Initialize a sparse polynomial by setting pointers to NULL and        *
+ *      variables to their default zero values.                               *
+ *  Arguments:                                                                *
+ *      poly (tmpl_SparseIntPolynomial *):                                    *
+ *          A pointer to the polynomial that is to be initialized.            *
+ *  Outputs:                                                                  *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Set all variables to their zero values. A sparse polynomial with no   *
+ *      terms is the zero polynomial.                                         *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) stddef.h:                                                             *
+ *          Standard library file where NULL is provided.                     *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_sparse_polynomial_integer.h:                                     *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  size_t data type and NULL are defined here.                               */
+#include <stddef.h>
+
+/*  Booleans declared here.                                                   */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Polynomial typedefs and function prototype.                               */
+#include <libtmpl/include/tmpl_sparse_polynomial_integer.h>
+
+/*  Function for initializing a sparse polynomial.                            */
+void tmpl_SparseIntPolynomial_Init(tmpl_SparseIntPolynomial *poly)
+{
+    /*  Check if the pointer is NULL before trying to access it.              */
+    if (!poly)
+        return;
+
+    /*  Set the pointers to NULL so that they may be safely freed.            */
+    poly->terms = NULL;
+    poly->degree_of_term = NULL;
+    poly->error_message = NULL;
+
+    /*  Set the remaining variables to their zero values.                     */
+    poly->number_of_terms = (size_t)0;
+    poly->error_occurred = tmpl_False;
+}
+/*  End of tmpl_SparseIntPolynomial_Init.                                     */
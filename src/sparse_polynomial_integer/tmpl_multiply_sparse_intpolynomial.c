@@ -0,0 +1,368 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                     tmpl_multiply_sparse_intpolynomial                     *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Multiplies two sparse polynomials.                                    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_SparseIntPolynomial_Multiply                                     *
+ *  Purpose:                                                                  *
+ *      Computes prod = P * Q for sparse polynomials.                         *
+ *  Arguments:                                                                *
+ *      prod (tmpl_SparseIntPolynomial *):                                    *
+ *          The output polynomial. It may be the same as P or Q.              *
+ *      P (const tmpl_SparseIntPolynomial *):                                 *
+ *          The first factor.                                                 *
+ *      Q (const tmpl_SparseIntPolynomial *):                                 *
+ *          The second factor.                                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates memory for the heap and the output.                 *
+ *          realloc:                                                          *
+ *              Grows and finally trims the output.                           *
+ *      tmpl_string.h:                                                        *
+ *          tmpl_strdup:                                                      *
+ *              Duplicates a string. Equivalent to the POSIX function strdup. *
+ *  Method:                                                                   *
+ *      Johnson's heap method. Let A be the factor with fewer terms, t1 of    *
+ *      them, and B the other, with t2 terms. For every term a_i x^e_i of A   *
+ *      the products a_i b_j x^(e_i + f_j), j = 0, 1, ..., t2 - 1, are        *
+ *      already sorted by degree since B is. The product P * Q is the merge   *
+ *      of these t1 sorted streams.                                           *
+ *                                                                            *
+ *      A min-heap holds the next unread product of every stream, keyed by    *
+ *      its degree. Pop the smallest, add it to the current coefficient, and  *
+ *      replace it by the next product of the same stream. When the degree on *
+ *      top of the heap changes, the coefficient is complete. It is appended  *
+ *      to the output if it is not zero. Terms come out in increasing order   *
+ *      of degree, so no sorting or combining is needed afterwards.           *
+ *                                                                            *
+ *      The cost is O(t1 t2 log(t1)) time and O(t1) working memory, plus the  *
+ *      output. The degrees of P and Q do not enter. The dense algorithms are *
+ *      O(deg^2) or O(deg log(deg)) with O(deg) memory, which is infeasible   *
+ *      for a few hundred terms of degree in the millions.                    *
+ *  Notes:                                                                    *
+ *      1.) NULL polynomials are treated as zero.                             *
+ *                                                                            *
+ *      2.) If P or Q has its error_occurred Boolean set, so does prod.       *
+ *                                                                            *
+ *      3.) If the degree of the product does not fit in a size_t, or malloc  *
+ *          fails, the error_occurred Boolean of prod is set.                 *
+ *                                                                            *
+ *      4.) The coefficients are computed with unsigned long arithmetic, so   *
+ *          overflow wraps around instead of being undefined behavior.        *
+ *  References:                                                               *
+ *      1.) Johnson, S. (1974).                                               *
+ *          Sparse polynomial arithmetic.                                     *
+ *          ACM SIGSAM Bulletin, Vol. 8, No. 3, pp. 63-71.                    *
+ *      2.) Monagan, M., Pearce, R. (2009).                                   *
+ *          Parallel sparse polynomial multiplication using heaps.            *
+ *          ISSAC '09, pp. 263-270.                                           *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_cast.h:                                                          *
+ *          Header file providing TMPL_CAST.                                  *
+ *  3.) tmpl_malloc.h:                                                        *
+ *          Header file providing TMPL_MALLOC.                                *
+ *  4.) tmpl_realloc.h:                                                       *
+ *          Header file providing TMPL_REALLOC.                               *
+ *  5.) tmpl_free.h:                                                          *
+ *          Header file providing TMPL_FREE.                                  *
+ *  6.) tmpl_string.h:                                                        *
+ *          Header file where tmpl_strdup is declared.                        *
+ *  7.) tmpl_sparse_polynomial_integer.h:                                     *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_CAST, TMPL_MALLOC, TMPL_REALLOC, and TMPL_FREE macros found here.    */
+#include <libtmpl/include/compat/tmpl_cast.h>
+#include <libtmpl/include/compat/tmpl_malloc.h>
+#include <libtmpl/include/compat/tmpl_realloc.h>
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  tmpl_strdup function declared here.                                       */
+#include <libtmpl/include/tmpl_string.h>
+
+/*  Polynomial typedefs and function prototype.                               */
+#include <libtmpl/include/tmpl_sparse_polynomial_integer.h>
+
+/*  The next unread product of one stream, a_i * b_j x^(e_i + f_j).           */
+typedef struct tmpl_SparseHeapEntry_Def {
+    size_t degree;
+    size_t i;
+    size_t j;
+} tmpl_SparseHeapEntry;
+
+/*  Moves the entry at the top of the min-heap down to its proper place.      */
+static void tmpl_sparse_sift_down(tmpl_SparseHeapEntry *heap, size_t len)
+{
+    const tmpl_SparseHeapEntry top = heap[0];
+    size_t root = 0;
+
+    while (2 * root + 1 < len)
+    {
+        size_t child = 2 * root + 1;
+
+        /*  Pick the smaller of the two children, if there are two.           */
+        if (child + 1 < len && heap[child + 1].degree < heap[child].degree)
+            ++child;
+
+        if (heap[child].degree >= top.degree)
+            break;
+
+        heap[root] = heap[child];
+        root = child;
+    }
+
+    heap[root] = top;
+}
+/*  End of tmpl_sparse_sift_down.                                             */
+
+/*  Sets an error message for prod. All errors here abort the computation.    */
+static void
+tmpl_sparse_multiply_error(tmpl_SparseIntPolynomial *prod, const char *reason)
+{
+    prod->error_occurred = tmpl_True;
+    prod->error_message = tmpl_strdup(reason);
+}
+/*  End of tmpl_sparse_multiply_error.                                        */
+
+/*  Function for multiplying two sparse polynomials.                          */
+void
+tmpl_SparseIntPolynomial_Multiply(tmpl_SparseIntPolynomial *prod,
+                                  const tmpl_SparseIntPolynomial *P,
+                                  const tmpl_SparseIntPolynomial *Q)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    const tmpl_SparseIntPolynomial *A, *B;
+    tmpl_SparseHeapEntry *heap;
+    signed long int *terms;
+    size_t *degrees;
+    size_t n, heap_length, count, capacity;
+
+    /*  If the output is NULL there is nothing to be done.                    */
+    if (!prod)
+        return;
+
+    /*  Similarly if an error occurred previously.                            */
+    if (prod->error_occurred)
+        return;
+
+    /*  If P or Q have an error, abort the computation.                       */
+    if ((P && P->error_occurred) || (Q && Q->error_occurred))
+    {
+        tmpl_sparse_multiply_error(
+            prod,
+            "\nError Encountered:\n"
+            "    tmpl_SparseIntPolynomial_Multiply\n\n"
+            "Input polynomial has error_occurred set to true.\n\n"
+        );
+
+        return;
+    }
+
+    /*  The product with a zero polynomial, or a NULL one, is zero.           */
+    if (!P || !Q || !P->number_of_terms || !Q->number_of_terms)
+    {
+        TMPL_FREE(prod->terms);
+        TMPL_FREE(prod->degree_of_term);
+        prod->number_of_terms = (size_t)0;
+        return;
+    }
+
+    /*  The heap has one entry per term of A. Use the shorter factor for A.   */
+    if (P->number_of_terms <= Q->number_of_terms)
+    {
+        A = P;
+        B = Q;
+    }
+    else
+    {
+        A = Q;
+        B = P;
+    }
+
+    /*  The largest degree is the sum of the leading degrees. Check overflow. */
+    if (A->degree_of_term[A->number_of_terms - 1] >
+        ((size_t)-1) - B->degree_of_term[B->number_of_terms - 1])
+    {
+        tmpl_sparse_multiply_error(
+            prod,
+            "\nError Encountered:\n"
+            "    tmpl_SparseIntPolynomial_Multiply\n\n"
+            "Degree of the product overflows size_t. Aborting.\n\n"
+        );
+
+        return;
+    }
+
+    /*  The output is grown as needed. Start with room for t1 + t2 terms.     */
+    capacity = A->number_of_terms + B->number_of_terms;
+    heap = TMPL_MALLOC(tmpl_SparseHeapEntry, A->number_of_terms);
+    terms = TMPL_MALLOC(signed long int, capacity);
+    degrees = TMPL_MALLOC(size_t, capacity);
+
+    /*  Check if malloc failed. Abort the computation if it did.              */
+    if (!heap || !terms || !degrees)
+    {
+        TMPL_FREE(heap);
+        TMPL_FREE(terms);
+        TMPL_FREE(degrees);
+        tmpl_sparse_multiply_error(
+            prod,
+            "\nError Encountered:\n"
+            "    tmpl_SparseIntPolynomial_Multiply\n\n"
+            "malloc failed and returned NULL. Aborting.\n\n"
+        );
+
+        return;
+    }
+
+    /*  The first product of every stream is a_i * b_0. The degrees of A are  *
+     *  increasing, so this sorted array is already a valid min-heap.         */
+    heap_length = A->number_of_terms;
+
+    for (n = 0; n < heap_length; ++n)
+    {
+        heap[n].degree = A->degree_of_term[n] + B->degree_of_term[0];
+        heap[n].i = n;
+        heap[n].j = 0;
+    }
+
+    count = 0;
+
+    /*  Pop the products in order of degree until every stream is empty.      */
+    while (heap_length)
+    {
+        const size_t degree = heap[0].degree;
+        unsigned long int coeff = 0UL;
+
+        /*  Sum every product with this degree.                               */
+        while (heap_length && heap[0].degree == degree)
+        {
+            const size_t i = heap[0].i;
+            const size_t j = heap[0].j;
+
+            coeff += (unsigned long int)A->terms[i] *
+                     (unsigned long int)B->terms[j];
+
+            /*  Replace the top by the next product of the same stream, or    *
+             *  by the last entry of the heap if this stream is finished.     */
+            if (j + 1 < B->number_of_terms)
+            {
+                heap[0].degree = A->degree_of_term[i] + B->degree_of_term[j+1];
+                heap[0].j = j + 1;
+            }
+            else
+            {
+                --heap_length;
+                heap[0] = heap[heap_length];
+            }
+
+            if (heap_length)
+                tmpl_sparse_sift_down(heap, heap_length);
+        }
+
+        /*  Terms that cancel are not stored.                                 */
+        if (coeff == 0UL)
+            continue;
+
+        /*  Grow the output geometrically if it is full.                      */
+        if (count == capacity)
+        {
+            void *tmp;
+            capacity *= 2;
+
+            tmp = TMPL_REALLOC(terms, capacity);
+
+            if (tmp)
+            {
+                terms = TMPL_CAST(tmp, signed long int *);
+                tmp = TMPL_REALLOC(degrees, capacity);
+            }
+
+            if (!tmp)
+            {
+                TMPL_FREE(heap);
+                TMPL_FREE(terms);
+                TMPL_FREE(degrees);
+                tmpl_sparse_multiply_error(
+                    prod,
+                    "\nError Encountered:\n"
+                    "    tmpl_SparseIntPolynomial_Multiply\n\n"
+                    "realloc failed. Aborting.\n\n"
+                );
+
+                return;
+            }
+
+            degrees = TMPL_CAST(tmp, size_t *);
+        }
+
+        terms[count] = (signed long int)coeff;
+        degrees[count] = degree;
+        ++count;
+    }
+
+    TMPL_FREE(heap);
+
+    /*  The inputs have been read, the old terms of prod may be freed now.    */
+    TMPL_FREE(prod->terms);
+    TMPL_FREE(prod->degree_of_term);
+
+    /*  If every term cancelled the product is zero.                          */
+    if (count == (size_t)0)
+    {
+        TMPL_FREE(terms);
+        TMPL_FREE(degrees);
+    }
+
+    /*  Give back any unused memory. If realloc fails the arrays are kept.    */
+    else if (count < capacity)
+    {
+        void *tmp = TMPL_REALLOC(terms, count);
+
+        if (tmp)
+            terms = TMPL_CAST(tmp, signed long int *);
+
+        tmp = TMPL_REALLOC(degrees, count);
+
+        if (tmp)
+            degrees = TMPL_CAST(tmp, size_t *);
+    }
+
+    prod->terms = terms;
+    prod->degree_of_term = degrees;
+    prod->number_of_terms = count;
+}
+/*  End of tmpl_SparseIntPolynomial_Multiply.                                 */
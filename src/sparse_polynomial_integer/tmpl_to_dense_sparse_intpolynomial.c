@@ -0,0 +1,192 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                     tmpl_to_dense_sparse_intpolynomial                     *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Converts a sparse polynomial into a dense one.                        *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_SparseIntPolynomial_To_Dense                                     *
+ *  Purpose:                                                                  *
+ *      Stores a sparse polynomial as a tmpl_IntPolynomial, writing every     *
+ *      coefficient up to the degree, including the zeros.                    *
+ *  Arguments:                                                                *
+ *      dense (tmpl_IntPolynomial *):                                         *
+ *          The output polynomial.                                            *
+ *      sparse (const tmpl_SparseIntPolynomial *):                            *
+ *          The polynomial that is converted.                                 *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          realloc:                                                          *
+ *              Resizes the coefficients of the output.                       *
+ *      tmpl_polynomial_integer.h:                                            *
+ *          tmpl_IntPolynomial_Make_Zero:                                     *
+ *              Sets the output to zero.                                      *
+ *      tmpl_string.h:                                                        *
+ *          tmpl_strdup:                                                      *
+ *              Duplicates a string. Equivalent to the POSIX function strdup. *
+ *  Method:                                                                   *
+ *      Check that every coefficient fits in an int, resize the output to     *
+ *      the degree of the last term, set it to zero, and scatter the terms.   *
+ *  Notes:                                                                    *
+ *      1.) NULL polynomials are treated as zero.                             *
+ *                                                                            *
+ *      2.) The coefficients of sparse polynomials are long, those of dense   *
+ *          polynomials are int. If a coefficient does not fit in an int, the *
+ *          error_occurred Boolean of the output is set.                      *
+ *                                                                            *
+ *      3.) The output has degree + 1 coefficients. For a sparse polynomial   *
+ *          of very large degree this may be too much memory, in which case   *
+ *          realloc fails and the error_occurred Boolean is set.              *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) limits.h:                                                             *
+ *          Standard library header file providing INT_MIN and INT_MAX.       *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_cast.h:                                                          *
+ *          Header file providing TMPL_CAST.                                  *
+ *  4.) tmpl_realloc.h:                                                       *
+ *          Header file providing TMPL_REALLOC.                               *
+ *  5.) tmpl_string.h:                                                        *
+ *          Header file where tmpl_strdup is declared.                        *
+ *  6.) tmpl_polynomial_integer.h:                                            *
+ *          Header file with tmpl_IntPolynomial_Make_Zero.                    *
+ *  7.) tmpl_sparse_polynomial_integer.h:                                     *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  INT_MIN and INT_MAX found here.                                           */
+#include <limits.h>
+
+/*  TMPL_CAST and TMPL_REALLOC macros found here.                             */
+#include <libtmpl/include/compat/tmpl_cast.h>
+#include <libtmpl/include/compat/tmpl_realloc.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  tmpl_strdup function declared here.                                       */
+#include <libtmpl/include/tmpl_string.h>
+
+/*  tmpl_IntPolynomial_Make_Zero declared here.                               */
+#include <libtmpl/include/tmpl_polynomial_integer.h>
+
+/*  Polynomial typedefs and function prototype.                               */
+#include <libtmpl/include/tmpl_sparse_polynomial_integer.h>
+
+/*  Function for converting a sparse polynomial into a dense one.             */
+void
+tmpl_SparseIntPolynomial_To_Dense(tmpl_IntPolynomial *dense,
+                                  const tmpl_SparseIntPolynomial *sparse)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    size_t n, degree;
+    void *tmp;
+
+    /*  If the output is NULL there is nothing to be done.                    */
+    if (!dense)
+        return;
+
+    /*  Similarly if an error occurred previously.                            */
+    if (dense->error_occurred)
+        return;
+
+    /*  NULL polynomials, and polynomials with no terms, are zero.            */
+    if (!sparse)
+    {
+        tmpl_IntPolynomial_Make_Zero(dense);
+        return;
+    }
+
+    /*  If the input has an error, abort the computation.                     */
+    if (sparse->error_occurred)
+    {
+        dense->error_occurred = tmpl_True;
+        dense->error_message = tmpl_strdup(
+            "\nError Encountered:\n"
+            "    tmpl_SparseIntPolynomial_To_Dense\n\n"
+            "Input polynomial has error_occurred set to true.\n\n"
+        );
+
+        return;
+    }
+
+    if (sparse->number_of_terms == (size_t)0)
+    {
+        tmpl_IntPolynomial_Make_Zero(dense);
+        return;
+    }
+
+    /*  The coefficients are narrowed from long to int. Check they fit.       */
+    for (n = 0; n < sparse->number_of_terms; ++n)
+    {
+        if (sparse->terms[n] > INT_MAX || sparse->terms[n] < INT_MIN)
+        {
+            dense->error_occurred = tmpl_True;
+            dense->error_message = tmpl_strdup(
+                "\nError Encountered:\n"
+                "    tmpl_SparseIntPolynomial_To_Dense\n\n"
+                "Coefficient does not fit in an int. Aborting.\n\n"
+            );
+
+            return;
+        }
+    }
+
+    /*  The terms are sorted, the degree is that of the last term.            */
+    degree = sparse->degree_of_term[sparse->number_of_terms - 1];
+
+    /*  degree + 1 coefficients are needed. Check the size doesn't overflow.  */
+    if (degree >= ((size_t)-1) / sizeof(*dense->coeffs))
+        tmp = NULL;
+    else
+        tmp = TMPL_REALLOC(dense->coeffs, degree + 1);
+
+    /*  Check if realloc failed. Abort the computation if it did.             */
+    if (!tmp)
+    {
+        dense->error_occurred = tmpl_True;
+        dense->error_message = tmpl_strdup(
+            "\nError Encountered:\n"
+            "    tmpl_SparseIntPolynomial_To_Dense\n\n"
+            "realloc failed. Aborting.\n\n"
+        );
+
+        return;
+    }
+
+    dense->coeffs = TMPL_CAST(tmp, signed int *);
+    dense->degree = degree;
+
+    /*  Zero out everything, then scatter the terms into place.               */
+    for (n = 0; n <= degree; ++n)
+        dense->coeffs[n] = 0;
+
+    for (n = 0; n < sparse->number_of_terms; ++n)
+        dense->coeffs[sparse->degree_of_term[n]] = (int)sparse->terms[n];
+}
+/*  End of tmpl_SparseIntPolynomial_To_Dense.                                 */
@@ -0,0 +1,116 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                   tmpl_split_complex_check_inputs_double                   *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Checks the inputs to element-wise operations on split complex         *
+ *      vectors.                                                              *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_SplitComplexDouble_Check_Inputs                                  *
+ *  Purpose:                                                                  *
+ *      Passes NULL, invalid, or mismatched inputs on to the output as an     *
+ *      error.                                                                *
+ *  Arguments:                                                                *
+ *      out (tmpl_SplitComplexDouble * const):                                *
+ *          The output vector. Must not be NULL.                              *
+ *      x (const tmpl_SplitComplexDouble * const):                            *
+ *          A split complex vector.                                           *
+ *      y (const tmpl_SplitComplexDouble * const):                            *
+ *          Another split complex vector.                                     *
+ *      message (const char * const):                                         *
+ *          The error message for NULL or mismatched inputs.                  *
+ *  Output:                                                                   *
+ *      is_valid (tmpl_Bool):                                                 *
+ *          True if x, y, and out may be used.                                *
+ *  Method:                                                                   *
+ *      If x or y has an error, its message is passed on to out. If either    *
+ *      is NULL, or if x, y, and out do not all have the same length, out     *
+ *      gets the given message.                                               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_config.h:                                                        *
+ *          Header file containing TMPL_STATIC_INLINE macro.                  *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_split_complex.h:                                                 *
+ *          Header file with the split complex typedefs.                      *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef TMPL_SPLIT_COMPLEX_CHECK_INPUTS_DOUBLE_H
+#define TMPL_SPLIT_COMPLEX_CHECK_INPUTS_DOUBLE_H
+
+/*  Location of the TMPL_STATIC_INLINE macro.                                 */
+#include <libtmpl/include/tmpl_config.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Split complex vector typedefs given here.                                 */
+#include <libtmpl/include/tmpl_split_complex.h>
+
+/*  Checks the inputs to a double precision binary operation.                 */
+TMPL_STATIC_INLINE
+tmpl_Bool
+tmpl_SplitComplexDouble_Check_Inputs(tmpl_SplitComplexDouble * const out,
+                                     const tmpl_SplitComplexDouble * const x,
+                                     const tmpl_SplitComplexDouble * const y,
+                                     const char * const message)
+{
+    if (!x || !y)
+    {
+        out->error_occurred = tmpl_True;
+        out->error_message = message;
+        return tmpl_False;
+    }
+
+    /*  Errors in the inputs are passed on to the output.                     */
+    if (x->error_occurred || y->error_occurred)
+    {
+        out->error_occurred = tmpl_True;
+
+        if (x->error_occurred)
+            out->error_message = x->error_message;
+        else
+            out->error_message = y->error_message;
+
+        return tmpl_False;
+    }
+
+    /*  The operations are element-wise, the lengths must agree.              */
+    if (x->length != out->length || y->length != out->length)
+    {
+        out->error_occurred = tmpl_True;
+        out->error_message = message;
+        return tmpl_False;
+    }
+
+    return tmpl_True;
+}
+/*  End of tmpl_SplitComplexDouble_Check_Inputs.                              */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,87 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                    tmpl_abs_squared_split_complex_float                    *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes |z[n]|^2 for each element of a split complex vector.         *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_SplitComplexFloat_Abs_Squared                                    *
+ *  Purpose:                                                                  *
+ *      Computes out[n] = |z[n]|^2 for each n.                                *
+ *  Arguments:                                                                *
+ *      z (const tmpl_SplitComplexFloat * const):                             *
+ *          A split complex vector.                                           *
+ *      out (float * const):                                                  *
+ *          An array with room for z->length real numbers.                    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      With z[n] = a + ib, |z[n]|^2 = a^2 + b^2. This needs no square root,  *
+ *      and the loop is two multiplies and an add per element.                *
+ *  Notes:                                                                    *
+ *      If z or out is NULL, or if z has an error, nothing is done.           *
+ *                                                                            *
+ *      No rescaling is done, so very large or very small elements overflow   *
+ *      or underflow. Use tmpl_SplitComplexFloat_Abs if this is a concern.    *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_split_complex.h:                                                 *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_split_complex.h>
+
+/*  Function for computing |z|^2 for each element of a vector.                */
+void
+tmpl_SplitComplexFloat_Abs_Squared(const tmpl_SplitComplexFloat * const z,
+                                   float * const out)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, len;
+    const float *re, *im;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!z || !out)
+        return;
+
+    if (z->error_occurred)
+        return;
+
+    len = z->length;
+    re = z->real;
+    im = z->imag;
+
+    /*  Branch-free and independent iterations, the compiler may vectorize.   */
+#ifdef _OPENMP
+#pragma omp parallel for if(len >= TMPL_SPLIT_COMPLEX_PARALLEL_MIN_LENGTH)
+#endif
+    for (n = 0; n < len; ++n)
+        out[n] = re[n]*re[n] + im[n]*im[n];
+}
+/*  End of tmpl_SplitComplexFloat_Abs_Squared.                                */
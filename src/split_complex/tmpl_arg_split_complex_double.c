@@ -0,0 +1,93 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                       tmpl_arg_split_complex_double                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the arguments of the elements of a split complex vector.     *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_SplitComplexDouble_Arg                                           *
+ *  Purpose:                                                                  *
+ *      Computes out[n] = arg(z[n]) for each n.                               *
+ *  Arguments:                                                                *
+ *      z (const tmpl_SplitComplexDouble * const):                            *
+ *          A split complex vector.                                           *
+ *      out (double * const):                                                 *
+ *          An array with room for z->length real numbers.                    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_math.h:                                                          *
+ *          tmpl_Double_Arctan2:                                              *
+ *              Computes the angle of the point (x, y) in the plane.          *
+ *  Method:                                                                   *
+ *      arg(a + ib) = atan2(b, a), the same as tmpl_CDouble_Argument.         *
+ *  Notes:                                                                    *
+ *      If z or out is NULL, or if z has an error, nothing is done.           *
+ *                                                                            *
+ *      The output is in the interval [-pi, pi].                              *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file with the tmpl_Double_Arctan2 function.                *
+ *  2.) tmpl_split_complex.h:                                                 *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  tmpl_Double_Arctan2 found here.                                           */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_split_complex.h>
+
+/*  Function for computing arg(z) for each element of a vector.               */
+void
+tmpl_SplitComplexDouble_Arg(const tmpl_SplitComplexDouble * const z,
+                            double * const out)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, len;
+    const double *re, *im;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!z || !out)
+        return;
+
+    if (z->error_occurred)
+        return;
+
+    len = z->length;
+    re = z->real;
+    im = z->imag;
+
+    /*  The elements are read from contiguous arrays, and with OpenMP support *
+     *  long vectors are split across threads.                                */
+#ifdef _OPENMP
+#pragma omp parallel for if(len >= TMPL_SPLIT_COMPLEX_PARALLEL_MIN_LENGTH)
+#endif
+    for (n = 0; n < len; ++n)
+        out[n] = tmpl_Double_Arctan2(im[n], re[n]);
+}
+/*  End of tmpl_SplitComplexDouble_Arg.                                       */
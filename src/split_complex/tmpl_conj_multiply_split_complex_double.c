@@ -0,0 +1,119 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                  tmpl_conj_multiply_split_complex_double                   *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the element-wise conjugate product of two split complex      *
+ *      vectors.
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_SplitComplexDouble_Conj_Multiply                                 *
+ *  Purpose:                                                                  *
+ *      Computes prod[n] = conj(x[n]) y[n] for each n.                        *
+ *  Arguments:                                                                *
+ *      x (const tmpl_SplitComplexDouble * const):                            *
+ *          A split complex vector.                                           *
+ *      y (const tmpl_SplitComplexDouble * const):                            *
+ *          Another split complex vector.                                     *
+ *      prod (tmpl_SplitComplexDouble * const):                               *
+ *          The product. This may be x or y.                                  *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      src/split_complex/auxiliary/                                          *
+ *          tmpl_SplitComplexDouble_Check_Inputs:                             *
+ *              Checks the vectors are valid and the same length.             *
+ *  Method:                                                                   *
+ *      With x[n] = a + ib and y[n] = c + id, we have:                        *
+ *                                                                            *
+ *          (a - ib)(c + id) = (ac + bd) + i(ad - bc)                         *
+ *                                                                            *
+ *      This is the product used for correlations and inner products. It is   *
+ *      done in one pass, without forming conj(x) first.                      *
+ *  Notes:                                                                    *
+ *      If x or y is NULL, has an error, or has a different length than       *
+ *      prod, the error_occurred Boolean of prod is set.                      *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_split_complex.h:                                                 *
+ *          Header file where the function prototype is given.                *
+ *  2.) tmpl_split_complex_check_inputs_double.h:                             *
+ *          Helper routine for checking the inputs.                           *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_split_complex.h>
+
+/*  tmpl_SplitComplexDouble_Check_Inputs found here.                          */
+#include "auxiliary/tmpl_split_complex_check_inputs_double.h"
+
+/*  Function for computing the element-wise conjugate product of two vectors. */
+void
+tmpl_SplitComplexDouble_Conj_Multiply(const tmpl_SplitComplexDouble * const x,
+                                      const tmpl_SplitComplexDouble * const y,
+                                      tmpl_SplitComplexDouble * const prod)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, len;
+    const double *x_re, *x_im, *y_re, *y_im;
+    double *prod_re, *prod_im;
+
+    /*  Nothing to do if there is nowhere to write.                           */
+    if (!prod)
+        return;
+
+    if (!tmpl_SplitComplexDouble_Check_Inputs(prod, x, y,
+                                              "\nError Encountered:\n"
+                                              "    tmpl_SplitComplexDouble_"
+                                              "Conj_Multiply\n\n"
+                                              "Input is NULL or has the wrong "
+                                              "length. Aborting.\n\n"))
+        return;
+
+    len = prod->length;
+    x_re = x->real;
+    x_im = x->imag;
+    y_re = y->real;
+    y_im = y->imag;
+    prod_re = prod->real;
+    prod_im = prod->imag;
+
+    /*  The iterations are independent and branch-free. With the real and     *
+     *  imaginary parts in separate arrays the compiler may vectorize this.   *
+     *  Read all four inputs first, since prod may be x or y.                 */
+#ifdef _OPENMP
+#pragma omp parallel for if(len >= TMPL_SPLIT_COMPLEX_PARALLEL_MIN_LENGTH)
+#endif
+    for (n = 0; n < len; ++n)
+    {
+        const double a = x_re[n];
+        const double b = x_im[n];
+        const double c = y_re[n];
+        const double d = y_im[n];
+        prod_re[n] = a*c + b*d;
+        prod_im[n] = a*d - b*c;
+    }
+}
+/*  End of tmpl_SplitComplexDouble_Conj_Multiply.                             */
@@ -0,0 +1,113 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                      tmpl_create_split_complex_float                       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Allocates memory for a split complex vector.                          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_SplitComplexFloat_Create                                         *
+ *  Purpose:                                                                  *
+ *      Creates a vector with room for len complex numbers.                   *
+ *  Arguments:                                                                *
+ *      len (size_t):                                                         *
+ *          The number of elements.                                           *
+ *  Output:                                                                   *
+ *      vec (tmpl_SplitComplexFloat):                                         *
+ *          The vector. The values are not initialized.                       *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates memory for the real and imaginary parts.            *
+ *      tmpl_split_complex.h:                                                 *
+ *          tmpl_SplitComplexFloat_Destroy:                                   *
+ *              Frees the memory if one of the allocations fails.             *
+ *  Method:                                                                   *
+ *      Allocate an array of len floats for the real parts, and another for   *
+ *      the imaginary parts.                                                  *
+ *  Notes:                                                                    *
+ *      1.) If malloc fails, the error_occurred Boolean is set.               *
+ *                                                                            *
+ *      2.) len = 0 gives an empty vector with NULL pointers. This is not an  *
+ *          error.                                                            *
+ *                                                                            *
+ *      3.) The output must be freed with tmpl_SplitComplexFloat_Destroy.     *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_malloc.h:                                                        *
+ *          Header file providing the TMPL_MALLOC macro.                      *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_split_complex.h:                                                 *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_MALLOC macro provided here.                                          */
+#include <libtmpl/include/compat/tmpl_malloc.h>
+
+/*  Booleans provided here.                                                   */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_split_complex.h>
+
+/*  Function for allocating memory for a split complex vector.                */
+tmpl_SplitComplexFloat tmpl_SplitComplexFloat_Create(size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    tmpl_SplitComplexFloat vec;
+
+    /*  Start with an empty vector. This is returned on error.                */
+    vec.real = NULL;
+    vec.imag = NULL;
+    vec.length = (size_t)0;
+    vec.error_occurred = tmpl_False;
+    vec.error_message = NULL;
+
+    /*  An empty vector needs no memory.                                      */
+    if (len == 0)
+        return vec;
+
+    /*  Allocate memory for the real and imaginary parts.                     */
+    vec.real = TMPL_MALLOC(float, len);
+    vec.imag = TMPL_MALLOC(float, len);
+
+    /*  Check if malloc failed. Abort the computation if it did.              */
+    if (!vec.real || !vec.imag)
+    {
+        tmpl_SplitComplexFloat_Destroy(&vec);
+        vec.error_occurred = tmpl_True;
+        vec.error_message =
+            "\nError Encountered:\n"
+            "    tmpl_SplitComplexFloat_Create\n\n"
+            "malloc failed. Aborting.\n\n";
+
+        return vec;
+    }
+
+    vec.length = len;
+    return vec;
+}
+/*  End of tmpl_SplitComplexFloat_Create.                                     */
@@ -0,0 +1,53 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                     tmpl_destroy_split_complex_double                      *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Frees the memory in a split complex vector.                           *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_FREE macro provided here.                                            */
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Booleans provided here.                                                   */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_split_complex.h>
+
+/*  Function for freeing the memory in a split complex vector.                */
+void tmpl_SplitComplexDouble_Destroy(tmpl_SplitComplexDouble * const vec)
+{
+    /*  Nothing to do for a NULL pointer.                                     */
+    if (!vec)
+        return;
+
+    /*  TMPL_FREE sets the pointers to NULL after freeing them.               */
+    TMPL_FREE(vec->real);
+    TMPL_FREE(vec->imag);
+
+    /*  Reset the remaining parameters to those of an empty vector.           */
+    vec->length = (size_t)0;
+    vec->error_occurred = tmpl_False;
+    vec->error_message = NULL;
+}
+/*  End of tmpl_SplitComplexDouble_Destroy.                                   */
@@ -0,0 +1,107 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                       tmpl_expi_split_complex_float                        *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes points on the unit circle from an array of angles.           *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_SplitComplexFloat_Expi                                           *
+ *  Purpose:                                                                  *
+ *      Computes out[n] = exp(i theta[n]) for each n.                         *
+ *  Arguments:                                                                *
+ *      theta (const float * const):                                          *
+ *          The angles, an array with out->length elements.                   *
+ *      out (tmpl_SplitComplexFloat * const):                                 *
+ *          The output vector.                                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      tmpl_math.h:                                                          *
+ *          tmpl_Float_SinCos:                                                *
+ *              Computes sin(t) and cos(t) simultaneously.                    *
+ *  Method:                                                                   *
+ *      exp(i t) = cos(t) + i sin(t). Compute sin and cos together, as done   *
+ *      by tmpl_CFloat_Expi.                                                  *
+ *  Notes:                                                                    *
+ *      If out is NULL nothing is done. If an input array is NULL, the        *
+ *      error_occurred Boolean of out is set.                                 *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_math.h:                                                          *
+ *          Header file with the tmpl_Float_SinCos function.                  *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_split_complex.h:                                                 *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  tmpl_Float_SinCos found here.                                             */
+#include <libtmpl/include/tmpl_math.h>
+
+/*  Booleans provided here.                                                   */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_split_complex.h>
+
+/*  Function for computing exp(i theta) for an array of angles.               */
+void
+tmpl_SplitComplexFloat_Expi(const float * const theta,
+                            tmpl_SplitComplexFloat * const out)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, len;
+    float *out_re, *out_im;
+
+    /*  Nothing to do if there is nowhere to write.                           */
+    if (!out)
+        return;
+
+    /*  Check for invalid inputs. Treat these as an error.                    */
+    if (!theta)
+    {
+        out->error_occurred = tmpl_True;
+        out->error_message =
+            "\nError Encountered:\n"
+            "    tmpl_SplitComplexFloat_Expi\n\n"
+            "Input is NULL. Aborting.\n\n";
+
+        return;
+    }
+
+    len = out->length;
+    out_re = out->real;
+    out_im = out->imag;
+
+    /*  SinCos writes directly to the split arrays. With OpenMP support long  *
+     *  vectors are split across threads.                                     */
+#ifdef _OPENMP
+#pragma omp parallel for if(len >= TMPL_SPLIT_COMPLEX_PARALLEL_MIN_LENGTH)
+#endif
+    for (n = 0; n < len; ++n)
+        tmpl_Float_SinCos(theta[n], &out_im[n], &out_re[n]);
+}
+/*  End of tmpl_SplitComplexFloat_Expi.                                       */
@@ -0,0 +1,107 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                 tmpl_from_interleaved_split_complex_double                 *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Converts an array of complex numbers to a split complex vector.       *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_SplitComplexDouble_From_Interleaved                              *
+ *  Purpose:                                                                  *
+ *      Creates a split complex vector with the values of z.                  *
+ *  Arguments:                                                                *
+ *      z (const tmpl_ComplexDouble * const):                                 *
+ *          An array of complex numbers.                                      *
+ *      len (size_t):                                                         *
+ *          The number of elements of z.                                      *
+ *  Output:                                                                   *
+ *      vec (tmpl_SplitComplexDouble):                                        *
+ *          The vector with real[n] = Re(z[n]) and imag[n] = Im(z[n]).        *
+ *  Called Functions:                                                         *
+ *      tmpl_split_complex.h:                                                 *
+ *          tmpl_SplitComplexDouble_Create:                                   *
+ *              Allocates memory for the vector.                              *
+ *  Method:                                                                   *
+ *      Create the vector and copy the values, splitting each pair.           *
+ *  Notes:                                                                    *
+ *      1.) If z is NULL and len > 0, or if malloc fails, the error_occurred  *
+ *          Boolean is set.                                                   *
+ *                                                                            *
+ *      2.) The output must be freed with tmpl_SplitComplexDouble_Destroy.    *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  2.) tmpl_split_complex.h:                                                 *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Booleans provided here.                                                   */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_split_complex.h>
+
+/*  Function for converting an interleaved array to a split vector.           */
+tmpl_SplitComplexDouble
+tmpl_SplitComplexDouble_From_Interleaved(const tmpl_ComplexDouble * const z,
+                                         size_t len)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n;
+    tmpl_SplitComplexDouble vec;
+
+    /*  Check for invalid inputs. Treat these as an error.                    */
+    if (!z && len > 0)
+    {
+        vec = tmpl_SplitComplexDouble_Create(0);
+        vec.error_occurred = tmpl_True;
+        vec.error_message =
+            "\nError Encountered:\n"
+            "    tmpl_SplitComplexDouble_From_Interleaved\n\n"
+            "Input is NULL. Aborting.\n\n";
+
+        return vec;
+    }
+
+    vec = tmpl_SplitComplexDouble_Create(len);
+
+    /*  If malloc failed, Create has already set the error message.           */
+    if (vec.error_occurred)
+        return vec;
+
+    /*  Split each pair into the real and imaginary arrays.                   */
+#ifdef _OPENMP
+#pragma omp parallel for if(len >= TMPL_SPLIT_COMPLEX_PARALLEL_MIN_LENGTH)
+#endif
+    for (n = 0; n < len; ++n)
+    {
+        vec.real[n] = z[n].dat[0];
+        vec.imag[n] = z[n].dat[1];
+    }
+
+    return vec;
+}
+/*  End of tmpl_SplitComplexDouble_From_Interleaved.                          */
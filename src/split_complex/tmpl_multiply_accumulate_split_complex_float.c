@@ -0,0 +1,122 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                tmpl_multiply_accumulate_split_complex_float                *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Adds the element-wise product of two split complex vectors to a       *
+ *      third.                                                                *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_SplitComplexFloat_Multiply_Accumulate                            *
+ *  Purpose:                                                                  *
+ *      Computes acc[n] += x[n] y[n] for each n.                              *
+ *  Arguments:                                                                *
+ *      acc (tmpl_SplitComplexFloat * const):                                 *
+ *          The accumulator.                                                  *
+ *      x (const tmpl_SplitComplexFloat * const):                             *
+ *          A split complex vector.                                           *
+ *      y (const tmpl_SplitComplexFloat * const):                             *
+ *          Another split complex vector.                                     *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      src/split_complex/auxiliary/                                          *
+ *          tmpl_SplitComplexFloat_Check_Inputs:                              *
+ *              Checks the vectors are valid and the same length.             *
+ *  Method:                                                                   *
+ *      With x[n] = a + ib and y[n] = c + id, add ac - bd to the real part    *
+ *      and ad + bc to the imaginary part of acc[n]. This is four multiplies  *
+ *      and four adds per element, which compilers turn into fused            *
+ *      multiply-adds where the hardware has them.                            *
+ *  Notes:                                                                    *
+ *      1.) If x or y is NULL, has an error, or has a different length than   *
+ *          acc, the error_occurred Boolean of acc is set. acc is unchanged.  *
+ *                                                                            *
+ *      2.) Summing many products, as done for diffraction integrals, is a    *
+ *          loop of calls to this function. Each call streams through the     *
+ *          arrays once, and no temporary vector is needed for the product.   *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_split_complex.h:                                                 *
+ *          Header file where the function prototype is given.                *
+ *  2.) tmpl_split_complex_check_inputs_float.h:                              *
+ *          Helper routine for checking the inputs.                           *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_split_complex.h>
+
+/*  tmpl_SplitComplexFloat_Check_Inputs found here.                           */
+#include "auxiliary/tmpl_split_complex_check_inputs_float.h"
+
+/*  Function for adding the element-wise product of two vectors to a third.   */
+void
+tmpl_SplitComplexFloat_Multiply_Accumulate(
+    tmpl_SplitComplexFloat * const acc,
+    const tmpl_SplitComplexFloat * const x,
+    const tmpl_SplitComplexFloat * const y
+)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, len;
+    const float *x_re, *x_im, *y_re, *y_im;
+    float *acc_re, *acc_im;
+
+    /*  Nothing to do if there is nowhere to write.                           */
+    if (!acc)
+        return;
+
+    if (!tmpl_SplitComplexFloat_Check_Inputs(acc, x, y,
+                                             "\nError Encountered:\n"
+                                             "    tmpl_SplitComplexFloat_"
+                                             "Multiply_Accumulate\n\n"
+                                             "Input is NULL or has the wrong "
+                                             "length. Aborting.\n\n"))
+        return;
+
+    len = acc->length;
+    x_re = x->real;
+    x_im = x->imag;
+    y_re = y->real;
+    y_im = y->imag;
+    acc_re = acc->real;
+    acc_im = acc->imag;
+
+    /*  The iterations are independent and branch-free, so the compiler may   *
+     *  vectorize the loop. Read the inputs first in case acc is x or y.      */
+#ifdef _OPENMP
+#pragma omp parallel for if(len >= TMPL_SPLIT_COMPLEX_PARALLEL_MIN_LENGTH)
+#endif
+    for (n = 0; n < len; ++n)
+    {
+        const float a = x_re[n];
+        const float b = x_im[n];
+        const float c = y_re[n];
+        const float d = y_im[n];
+        acc_re[n] += a*c - b*d;
+        acc_im[n] += a*d + b*c;
+    }
+}
+/*  End of tmpl_SplitComplexFloat_Multiply_Accumulate.                        */
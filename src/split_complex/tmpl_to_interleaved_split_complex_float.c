@@ -0,0 +1,88 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                  tmpl_to_interleaved_split_complex_float                   *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Converts a split complex vector to an array of complex numbers.       *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_SplitComplexFloat_To_Interleaved                                 *
+ *  Purpose:                                                                  *
+ *      Copies the values of vec to z.                                        *
+ *  Arguments:                                                                *
+ *      vec (const tmpl_SplitComplexFloat * const):                           *
+ *          A split complex vector.                                           *
+ *      z (tmpl_ComplexFloat * const):                                        *
+ *          An array with room for vec->length complex numbers.               *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      None.                                                                 *
+ *  Method:                                                                   *
+ *      Set z[n] = real[n] + i imag[n] for each n.                            *
+ *  Notes:                                                                    *
+ *      If vec or z is NULL, or if vec has an error, nothing is done.         *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_split_complex.h:                                                 *
+ *          Header file where the function prototype is given.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_split_complex.h>
+
+/*  Function for converting a split vector to an interleaved array.           */
+void
+tmpl_SplitComplexFloat_To_Interleaved(
+    const tmpl_SplitComplexFloat * const vec,
+    tmpl_ComplexFloat * const z
+)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t n, len;
+    const float *re, *im;
+
+    /*  Check for invalid inputs. Nothing can be done for these.              */
+    if (!vec || !z)
+        return;
+
+    if (vec->error_occurred)
+        return;
+
+    len = vec->length;
+    re = vec->real;
+    im = vec->imag;
+
+    /*  Interleave the real and imaginary parts.                              */
+#ifdef _OPENMP
+#pragma omp parallel for if(len >= TMPL_SPLIT_COMPLEX_PARALLEL_MIN_LENGTH)
+#endif
+    for (n = 0; n < len; ++n)
+    {
+        z[n].dat[0] = re[n];
+        z[n].dat[1] = im[n];
+    }
+}
+/*  End of tmpl_SplitComplexFloat_To_Interleaved.                             */
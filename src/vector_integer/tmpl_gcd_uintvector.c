@@ -20,13 +20,15 @@
  ******************************************************************************
  *  Author:     Ryan Maguire                                                  *
  *  Date:       2021/07/29                                                    *
+ ******************************************************************************
+ *                              Revision History                              *
+ ******************************************************************************
+ *  2026/10/18: Ryan Maguire                                                  *
+ *      Use tmpl_UInt_Array_GCD, which stops early once the GCD is one.       *
  ******************************************************************************/
 
-/*  size_t found here.                                                        */
-#include <stddef.h>
-
-/*  GCD function found here.                                                  */
-#include <libtmpl/include/tmpl_integer.h>
+/*  tmpl_UInt_Array_GCD found here.                                           */
+#include <libtmpl/include/tmpl_array_integer.h>
 
 /*  Function prototype given here.                                            */
 #include <libtmpl/include/tmpl_vector_integer.h>
@@ -34,28 +36,13 @@
 /*  Function for computing the GCD of a vector of non-negative integers.      */
 unsigned int tmpl_UIntVector_GCD(tmpl_UIntVector *arr)
 {
-    size_t n;
-    unsigned int gcd;
-
     if (!arr)
         return 0U;
 
     if (arr->error_occurred || !arr->data || arr->length == 0UL)
         return 0U;
 
-    /*  If there is only one element, the GCD is just that element.           */
-    if (arr->length == 1UL)
-        return arr->data[0];
-
-    /*  Otherwise the GCD is computed via GCD(a, b, ...) = GCD(GCD(a, b), ...).
-     *  Start the computation by computing the GCD of the first two elements. */
-    else
-        gcd = tmpl_UInt_GCD(arr->data[0], arr->data[1]);
-
-    /*  Loop over the remaining elements and iteratively compute the GCD.     */
-    for (n = (size_t)2; n < arr->length; ++n)
-        gcd = tmpl_UInt_GCD(gcd, arr->data[n]);
-
-    return gcd;
+    /*  The array routine handles the early exit and the parallel case.       */
+    return tmpl_UInt_Array_GCD(arr->data, arr->length);
 }
 /*  End of tmpl_UIntVector_GCD.                                               */
@@ -1,9 +1,9 @@
 /******************************************************************************
- *                                 LICENSE                                    *
+ *                                  LICENSE                                   *
  ******************************************************************************
  *  This file is part of libtmpl.                                             *
  *                                                                            *
- *  libtmpl is free software: you can redistribute it and/or modify it        *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
  *  it under the terms of the GNU General Public License as published by      *
  *  the Free Software Foundation, either version 3 of the License, or         *
  *  (at your option) any later version.                                       *
@@ -15,158 +15,161 @@
  *                                                                            *
  *  You should have received a copy of the GNU General Public License         *
  *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                         tmpl_sieve_of_eratosthenes                         *
  ******************************************************************************
- *  This file contains he Sieve of Eratosthenes, which is an algorithm for    *
- *  computing all prime numbers up to some fixed number N.                    *
+ *  Purpose:                                                                  *
+ *      Computes all primes less than N as a vector.                          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_ULong_Sieve_of_Eratosthenes                                      *
+ *  Purpose:                                                                  *
+ *      Computes the primes p < N, in increasing order.                       *
+ *  Arguments:                                                                *
+ *      N (unsigned long int):                                                *
+ *          The upper bound for the primes.                                   *
+ *  Output:                                                                   *
+ *      sieve (tmpl_ULongVector *):                                           *
+ *          The primes less than N.                                           *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates the output.                                         *
+ *          realloc:                                                          *
+ *              Grows the output as primes are found.                         *
+ *      tmpl_vector_integer.h:                                                *
+ *          tmpl_ULong_Prime_Sieve:                                           *
+ *              Segmented sieve producing the primes one at a time.           *
+ *      tmpl_string.h:                                                        *
+ *          tmpl_strdup:                                                      *
+ *              Duplicates a string. Equivalent to the POSIX function strdup. *
+ *  Method:                                                                   *
+ *      Run the segmented sieve with a callback that appends each prime to    *
+ *      the output, doubling the capacity when it is full. Once the sieve is  *
+ *      done the array is shrunk to the number of primes found. Only the      *
+ *      output itself is proportional to N; the sieve uses a fixed amount of  *
+ *      memory per thread.                                                    *
+ *  Notes:                                                                    *
+ *      1.) If malloc fails for the vector itself, NULL is returned. Other    *
+ *          failures set the error_occurred Boolean of the output.            *
+ *                                                                            *
+ *      2.) If N <= 2 the output is empty, with data NULL and length zero.    *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          Standard library header file with malloc, realloc, and free.      *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_string.h:                                                        *
+ *          Header file where tmpl_strdup is declared.                        *
+ *  4.) tmpl_vector_integer.h:                                                *
+ *          Header file where the function prototype is given.                *
  ******************************************************************************
  *  Author:     Ryan Maguire                                                  *
  *  Date:       2021/04/19                                                    *
+ ******************************************************************************
+ *                              Revision History                              *
+ ******************************************************************************
+ *  2026/10/18: Ryan Maguire                                                  *
+ *      Rewrote using the segmented sieve. The old version used two Boolean   *
+ *      arrays of length N, and did not initialize the error fields.          *
  ******************************************************************************/
 
-/*  malloc and size_t typedef given here.                                     */
+/*  malloc, realloc, and free found here.                                     */
 #include <stdlib.h>
 
 /*  Booleans found here.                                                      */
 #include <libtmpl/include/tmpl_bool.h>
 
-/*  Function prototype given here.                                            */
-#include <libtmpl/include/tmpl_vector_integer.h>
-
 /*  tmpl_strdup found here.                                                   */
 #include <libtmpl/include/tmpl_string.h>
 
-#if 0
+/*  Function prototype given here.                                            */
+#include <libtmpl/include/tmpl_vector_integer.h>
 
-/*  Function for computing all prime numbers less than N.                     */
-tmpl_ULongVector *tmpl_ULong_Sieve_of_Eratosthenes(unsigned long int N)
-{
-    tmpl_ULongVector *sieve = malloc(sizeof(*sieve));
-    tmpl_Bool *is_prime;
-    unsigned long int n, k;
+/*  State for the callback appending primes to the output vector.             */
+typedef struct tmpl_SieveAppend_Def {
+    tmpl_ULongVector *sieve;
+    size_t capacity;
+    tmpl_Bool failed;
+} tmpl_SieveAppend;
 
-    /*  Check if malloc failed. Return NULL if so.                            */
-    if (sieve == NULL)
-        return NULL;
-
-    /*  0 and 1 are not prime. In this case the out vector is empty.          */
-    if (N < 2)
-    {
-        sieve->data = NULL;
-        sieve->length = 0UL;
-        return sieve;
-    }
+/*  Callback for tmpl_ULong_Prime_Sieve, appends a prime to the vector.       */
+static tmpl_Bool tmpl_sieve_append(unsigned long int prime, void *data)
+{
+    tmpl_SieveAppend * const state = data;
+    tmpl_ULongVector * const sieve = state->sieve;
 
-    is_prime = malloc(sizeof(*is_prime) * (N - 1UL));
-    if (is_prime == NULL)
+    /*  Double the capacity when the array is full.                           */
+    if (sieve->length == state->capacity)
     {
-        sieve->data = NULL;
-        sieve->length = (size_t)0;
-        sieve->error_occurred = tmpl_True;
-        sieve->error_message = tmpl_strdup(
-            "Error Encountered: libtmpl\n"
-            "    tmpl_ULong_Sieve_of_Eratosthenes\n\n"
-            "malloc failed for is_prime and returned NULL."
-        );
-        return sieve;
-    }
-
-    for (n = 2UL; n <= N; ++n)
-        is_prime[N - 2UL] = tmpl_True;
+        const size_t capacity = (state->capacity ? 2 * state->capacity : 1024);
+        void *tmp = realloc(sieve->data, sizeof(*sieve->data) * capacity);
 
-    for (n = 2UL; n*n <= N; ++n)
-    {
-        if (is_prime[n - 2UL])
+        /*  On failure, stop the sieve. The caller sets the error.            */
+        if (!tmp)
         {
-            for (k = n*n; k <= N; k += n)
-                is_prime[k - 2UL] = tmpl_False;
+            state->failed = tmpl_True;
+            return tmpl_False;
         }
-    }
 
-    sieve->length = 0UL;
-    for (n = 0UL; n < N; ++n)
-    {
-        if (is_prime[n])
-            sieve->length++;
+        sieve->data = tmp;
+        state->capacity = capacity;
     }
 
-    sieve->data = malloc(sizeof(*sieve->data) * sieve->length);
-    k = 0U;
-    for (n = 0UL; n < sieve->length; ++n)
-    {
-        while (!is_prime[k - 2UL])
-            ++k;
-        sieve->data[n] = k;
-        ++k;
-    }
-
-    return sieve;
+    sieve->data[sieve->length] = prime;
+    ++sieve->length;
+    return tmpl_True;
 }
+/*  End of tmpl_sieve_append.                                                 */
 
-#else
-
-tmpl_ULongVector *tmpl_ULong_Sieve_of_Eratosthenes(unsigned long N)
+/*  Function for computing all prime numbers less than N.                     */
+tmpl_ULongVector *tmpl_ULong_Sieve_of_Eratosthenes(unsigned long int N)
 {
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    tmpl_SieveAppend state;
     tmpl_ULongVector *sieve = malloc(sizeof(*sieve));
-    tmpl_Bool *is_prime, *has_been_visited;
-    unsigned long n, k, factor;
 
-    if (sieve == NULL)
+    /*  Check if malloc failed. Return NULL if so.                            */
+    if (!sieve)
         return NULL;
 
-    if (N < 2)
-    {
-        sieve->data = NULL;
-        sieve->length = 0UL;
-        return sieve;
-    }
+    sieve->data = NULL;
+    sieve->length = (size_t)0;
+    sieve->error_occurred = tmpl_False;
+    sieve->error_message = NULL;
 
-    is_prime = malloc(sizeof(*is_prime) * N);
-    if (is_prime == NULL)
-    {
-        free(sieve);
-        return NULL;
-    }
+    state.sieve = sieve;
+    state.capacity = (size_t)0;
+    state.failed = tmpl_False;
 
-    has_been_visited = calloc(N, sizeof(*has_been_visited));
-    if (has_been_visited == NULL)
+    if (!tmpl_ULong_Prime_Sieve(N, tmpl_sieve_append, &state) || state.failed)
     {
-        free(sieve);
-        return NULL;
-    }
-
-    n = 2UL;
-    sieve->length = 0UL;
-    factor = 1UL;
+        free(sieve->data);
+        sieve->data = NULL;
+        sieve->length = (size_t)0;
+        sieve->error_occurred = tmpl_True;
+        sieve->error_message = tmpl_strdup(
+            "\nError Encountered:\n"
+            "    tmpl_ULong_Sieve_of_Eratosthenes\n\n"
+            "malloc failed and returned NULL. Aborting.\n\n"
+        );
 
-    while (n < N)
-    {
-        if (!has_been_visited[n])
-        {
-            is_prime[n] = tmpl_True;
-            sieve->length++;
-            k = n + factor*n;
-            while(k < N)
-            {
-                is_prime[k] = tmpl_False;
-                has_been_visited[k] = tmpl_True;
-                k += factor*n;
-            }
-        }
-        factor = n;
-        ++n;
+        return sieve;
     }
 
-    sieve->data = malloc(sizeof(*sieve->data) * sieve->length);
-    k = 0U;
-    for (n=0U; n<sieve->length; ++n)
+    /*  Shrink the array to the number of primes. If this fails the larger    *
+     *  array is still valid, so keep it.                                     */
+    if (sieve->length < state.capacity && sieve->length)
     {
-        while (!is_prime[k])
-            ++k;
-        sieve->data[n] = k;
-        ++k;
+        void *tmp = realloc(sieve->data, sizeof(*sieve->data) * sieve->length);
+
+        if (tmp)
+            sieve->data = tmp;
     }
 
     return sieve;
 }
-
-#endif
+/*  End of tmpl_ULong_Sieve_of_Eratosthenes.                                  */
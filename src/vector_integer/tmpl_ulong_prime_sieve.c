@@ -0,0 +1,349 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ *                           tmpl_ulong_prime_sieve                           *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Segmented Sieve of Eratosthenes with a callback interface.            *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_ULong_Prime_Sieve                                                *
+ *  Purpose:                                                                  *
+ *      Computes all primes p < N and passes them, in increasing order, to a  *
+ *      user-provided callback.                                               *
+ *  Arguments:                                                                *
+ *      N (unsigned long int):                                                *
+ *          The upper bound for the primes.                                   *
+ *      callback (tmpl_ULongPrimeCallback):                                   *
+ *          Called once per prime. Returning false stops the sieve.           *
+ *      data (void *):                                                        *
+ *          Pointer passed along to the callback.                             *
+ *  Output:                                                                   *
+ *      success (tmpl_Bool):                                                  *
+ *          False if an allocation failed, true otherwise.                    *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates the base primes and the segments.                   *
+ *      omp.h:                                                                *
+ *          omp_get_max_threads:                                              *
+ *              Returns the number of threads a parallel region may use.      *
+ *  Method:                                                                   *
+ *      Two is handled on its own. The odd numbers 1, 3, 5, ..., below N are  *
+ *      split into segments of TMPL_PRIME_SIEVE_SEGMENT_BYTES bytes, with bit *
+ *      j of a segment starting at lo representing lo + 2j. A segment is      *
+ *      small enough to stay in cache while it is sieved.                     *
+ *                                                                            *
+ *      Any composite c < N has an odd prime factor p with p^2 <= c, so only  *
+ *      the odd primes up to sqrt(N - 1) are needed to sieve. These "base"    *
+ *      primes are computed first with a small ordinary sieve. For each       *
+ *      segment and base prime p, the first odd multiple of p that is at      *
+ *      least max(lo, p^2) is found, and every p-th bit from there on is      *
+ *      cleared. The remaining bits are the primes in the segment.            *
+ *                                                                            *
+ *      With OpenMP the segments are processed in batches of one segment per  *
+ *      thread. The threads sieve the segments of a batch in parallel, each   *
+ *      in its own buffer. The calling thread then reads the batch in order   *
+ *      and calls the callback for each prime. So the callback sees primes in *
+ *      increasing order and never needs to be thread safe.                   *
+ *  Notes:                                                                    *
+ *      1.) Memory use is the segment buffers plus the base primes, about     *
+ *          sqrt(N) / ln(sqrt(N)) numbers, instead of memory linear in N.     *
+ *                                                                            *
+ *      2.) If N <= 2 there are no primes and the callback is never called.   *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          Standard library header file with malloc.                         *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_limits.h:                                                        *
+ *          Header file providing TMPL_ULONG_BIT.                             *
+ *  4.) tmpl_integer.h:                                                       *
+ *          Header file providing TMPL_ULONG_TRAILING_ZEROS.                  *
+ *  5.) tmpl_vector_integer.h:                                                *
+ *          Header file where the function prototype is given.                *
+ *  6.) omp.h:                                                                *
+ *          OpenMP header file. Only included if OpenMP is enabled.           *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  malloc and free found here.                                               */
+#include <stdlib.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  TMPL_ULONG_BIT, the number of bits in unsigned long, found here.          */
+#include <libtmpl/include/tmpl_limits.h>
+
+/*  TMPL_ULONG_TRAILING_ZEROS macro provided here.                            */
+#include <libtmpl/include/tmpl_integer.h>
+
+/*  Function prototype and callback typedef given here.                       */
+#include <libtmpl/include/tmpl_vector_integer.h>
+
+/*  omp_get_max_threads provided here.                                        */
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*  Number of words, and bits, in a segment.                                  */
+#define TMPL_SIEVE_WORDS \
+    (TMPL_PRIME_SIEVE_SEGMENT_BYTES / sizeof(unsigned long int))
+
+#define TMPL_SIEVE_BITS ((unsigned long int)TMPL_SIEVE_WORDS * TMPL_ULONG_BIT)
+
+/*  Largest integer r with r^2 <= n, using Newton's method.                   */
+static unsigned long int tmpl_sieve_isqrt(unsigned long int n)
+{
+    unsigned long int x, y;
+
+    if (n < 2UL)
+        return n;
+
+    /*  (n / 2 + 1)^2 > n, so this starts above the root. From there Newton's *
+     *  method decreases monotonically to the floor of the square root.       */
+    x = n / 2UL + 1UL;
+    y = (x + n / x) / 2UL;
+
+    while (y < x)
+    {
+        x = y;
+        y = (x + n / x) / 2UL;
+    }
+
+    return x;
+}
+/*  End of tmpl_sieve_isqrt.                                                  */
+
+/*  Computes the odd primes p <= limit. Returns NULL on failure.              */
+static unsigned long int *
+tmpl_sieve_base_primes(unsigned long int limit, size_t *count)
+{
+    /*  is_composite[n] corresponds to the odd number 2n + 1.                 */
+    const unsigned long int size = limit / 2UL + 1UL;
+    unsigned char *is_composite = calloc(size, sizeof(*is_composite));
+    unsigned long int *primes;
+    unsigned long int n, k;
+
+    *count = 0;
+
+    if (!is_composite)
+        return NULL;
+
+    /*  Mark odd multiples of odd p starting at p^2. Index of p^2 is          *
+     *  (p^2 - 1) / 2 = 2n(n + 1) for p = 2n + 1, and the step is p.          */
+    for (n = 1UL; 2UL * n * (n + 1UL) < size; ++n)
+        if (!is_composite[n])
+            for (k = 2UL * n * (n + 1UL); k < size; k += 2UL * n + 1UL)
+                is_composite[k] = 1;
+
+    for (n = 1UL; n < size; ++n)
+        if (!is_composite[n])
+            ++*count;
+
+    /*  One extra element avoids a zero sized allocation for small limits.    */
+    primes = malloc(sizeof(*primes) * (*count + 1));
+
+    if (primes)
+    {
+        k = 0;
+
+        for (n = 1UL; n < size; ++n)
+            if (!is_composite[n])
+                primes[k++] = 2UL * n + 1UL;
+    }
+
+    free(is_composite);
+    return primes;
+}
+/*  End of tmpl_sieve_base_primes.                                            */
+
+/*  Sieves the count odd numbers lo, lo + 2, ..., lo + 2(count - 1). Bit j of *
+ *  bits is set on return if and only if lo + 2j is prime.                    */
+static void
+tmpl_sieve_segment(unsigned long int *bits,
+                   unsigned long int lo,
+                   unsigned long int count,
+                   const unsigned long int *base,
+                   size_t base_count)
+{
+    size_t n;
+    unsigned long int j;
+    const unsigned long int last = lo + 2UL * (count - 1UL);
+
+    /*  Every number is a candidate until it is crossed off.                  */
+    for (n = 0; n < TMPL_SIEVE_WORDS; ++n)
+        bits[n] = ~0UL;
+
+    /*  One is not prime. It only lies in the first segment.                  */
+    if (lo == 1UL)
+        bits[0] &= ~1UL;
+
+    for (n = 0; n < base_count; ++n)
+    {
+        const unsigned long int p = base[n];
+
+        /*  The base primes are sorted. Once p^2 exceeds the segment, so does *
+         *  the square of every later base prime.                             */
+        if (p > last / p)
+            break;
+
+        /*  Composites below p^2 have a smaller factor, start at p^2.         */
+        if (p * p >= lo)
+            j = (p * p - lo) / 2UL;
+
+        /*  Otherwise find the first odd multiple of p that is at least lo.   *
+         *  lo is odd, so lo + d is odd exactly when d is even.               */
+        else
+        {
+            const unsigned long int r = lo % p;
+            unsigned long int d = (r ? p - r : 0UL);
+
+            if (d & 1UL)
+                d += p;
+
+            j = d / 2UL;
+        }
+
+        /*  Consecutive odd multiples of p are 2p apart, that is p bits.      */
+        for (; j < count; j += p)
+            bits[j / TMPL_ULONG_BIT] &= ~(1UL << (j % TMPL_ULONG_BIT));
+    }
+}
+/*  End of tmpl_sieve_segment.                                                */
+
+/*  Function for computing primes with a segmented sieve.                     */
+tmpl_Bool
+tmpl_ULong_Prime_Sieve(unsigned long int N,
+                       tmpl_ULongPrimeCallback callback,
+                       void *data)
+{
+    /*  Declare necessary variables. C89 requires declarations at the top.    */
+    unsigned long int *base, *buffers;
+    unsigned long int segments, odds, first;
+    size_t base_count, threads;
+
+    /*  There are no primes below 2.                                          */
+    if (N <= 2UL)
+        return tmpl_True;
+
+    /*  Two is the only even prime. The sieve below handles the odd numbers.  */
+    if (!callback(2UL, data))
+        return tmpl_True;
+
+    /*  The odd primes needed for sieving are those up to sqrt(N - 1).        */
+    base = tmpl_sieve_base_primes(tmpl_sieve_isqrt(N - 1UL), &base_count);
+
+    if (!base)
+        return tmpl_False;
+
+#ifdef _OPENMP
+    threads = (size_t)omp_get_max_threads();
+#else
+    threads = 1;
+#endif
+
+    /*  There are N / 2 odd numbers below N, split them into segments.        */
+    odds = N / 2UL;
+    segments = odds / TMPL_SIEVE_BITS + (odds % TMPL_SIEVE_BITS ? 1UL : 0UL);
+
+    if ((unsigned long int)threads > segments)
+        threads = (size_t)segments;
+
+    /*  One segment buffer for each thread.                                   */
+    buffers = malloc(sizeof(*buffers) * TMPL_SIEVE_WORDS * threads);
+
+    if (!buffers)
+    {
+        free(base);
+        return tmpl_False;
+    }
+
+    for (first = 0UL; first < segments; first += threads)
+    {
+        /*  Declare necessary variables. C89 requires declarations at the top.*/
+        long int t;
+        const unsigned long int left = segments - first;
+        const long int batch = (long int)(left < threads ? left : threads);
+
+        /*  Sieve the segments of this batch, one per thread.                 */
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(batch) if(batch > 1)
+#endif
+        for (t = 0; t < batch; ++t)
+        {
+            const unsigned long int s = first + (unsigned long int)t;
+            const unsigned long int done = s * TMPL_SIEVE_BITS;
+            const unsigned long int count = (odds - done < TMPL_SIEVE_BITS ?
+                                             odds - done : TMPL_SIEVE_BITS);
+
+            tmpl_sieve_segment(
+                buffers + (size_t)t * TMPL_SIEVE_WORDS,
+                2UL * done + 1UL, count, base, base_count
+            );
+        }
+
+        /*  Pass the primes along in order from the calling thread.           */
+        for (t = 0; t < batch; ++t)
+        {
+            size_t n;
+            const unsigned long int s = first + (unsigned long int)t;
+            const unsigned long int done = s * TMPL_SIEVE_BITS;
+            const unsigned long int lo = 2UL * done + 1UL;
+            const unsigned long int count = (odds - done < TMPL_SIEVE_BITS ?
+                                             odds - done : TMPL_SIEVE_BITS);
+            const unsigned long int *bits = buffers + (size_t)t *
+                                            TMPL_SIEVE_WORDS;
+
+            for (n = 0; n < TMPL_SIEVE_WORDS; ++n)
+            {
+                unsigned long int word = bits[n];
+                const unsigned long int offset = n * TMPL_ULONG_BIT;
+
+                /*  Visit the set bits from lowest to highest.                */
+                while (word)
+                {
+                    const int zeros = TMPL_ULONG_TRAILING_ZEROS(word);
+                    const unsigned long int j = offset + (unsigned long)zeros;
+
+                    /*  Bits past the end of the final segment are unused.    */
+                    if (j >= count)
+                        break;
+
+                    if (!callback(lo + 2UL * j, data))
+                        goto FINISHED;
+
+                    /*  Clear the lowest set bit.                             */
+                    word &= word - 1UL;
+                }
+            }
+        }
+    }
+
+FINISHED:
+    free(buffers);
+    free(base);
+    return tmpl_True;
+}
+/*  End of tmpl_ULong_Prime_Sieve.                                            */
@@ -0,0 +1,83 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                         tmpl_destroy_where_indices                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Free all memory associated with a list of indices.                    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_WhereIndices_Destroy                                             *
+ *  Purpose:                                                                  *
+ *      Free all memory in a tmpl_WhereIndices and set pointers to NULL.      *
+ *  Arguments:                                                                *
+ *      where (tmpl_WhereIndices * const):                                    *
+ *          A pointer to the list of indices that is to be destroyed.         *
+ *  Outputs:                                                                  *
+ *      None (void).                                                          *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          free:                                                             *
+ *              Free's data allocated by malloc, calloc, or realloc.          *
+ *  Method:                                                                   *
+ *      Free the data and set the pointer to NULL to prevent the possibility  *
+ *      of double-free's. The remaining variables are reset to zero.          *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_free.h:                                                          *
+ *          Header file with the TMPL_FREE macro for safely freeing data.     *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_where.h:                                                         *
+ *          Header where the function prototype is given.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  TMPL_FREE macro for safely freeing and nullifying a pointer found here.   */
+#include <libtmpl/include/compat/tmpl_free.h>
+
+/*  Booleans given here.                                                      */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Function prototype and typedefs provided here.                            */
+#include <libtmpl/include/tmpl_where.h>
+
+/*  Function for freeing all memory in a list of indices..                    */
+void tmpl_WhereIndices_Destroy(tmpl_WhereIndices * const where)
+{
+    /*  If the input is NULL there is nothing to be done.                     */
+    if (!where)
+        return;
+
+    /*  Safely free the data and then set it to NULL to avoid double free's.  */
+    TMPL_FREE(where->indices);
+
+    /*  The error_message variable is a const pointer, we do not need to free *
+     *  it, simply set it to NULL.                                            */
+    where->error_message = NULL;
+
+    /*  Set the remaining variables to their default zero values.             */
+    where->length = 0;
+    where->error_occurred = tmpl_False;
+}
+/*  End of tmpl_WhereIndices_Destroy.                                         */
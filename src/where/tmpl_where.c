@@ -11,37 +11,43 @@
 #define CreateWhereFunction(type, Type, ftype)                                 \
 size_t **tmpl_Where_Greater_##Type(type *data, size_t dim, ftype threshold)    \
 {                                                                              \
-    /*  Declare necessary variables.                                         */\
-    size_t i;                                                                  \
-    size_t *arr;                                                               \
+    /*  Declare a pointer to a pointer to containg all info to be returned.  */\
     size_t **where;                                                            \
-    size_t arr_size = 0;                                                       \
                                                                                \
-    /*  Create a dummy array to store the correct indices in for now.        */\
-    arr = malloc(sizeof(*arr) * dim);                                          \
+    /*  Compute the indices. The output is allocated exactly, avoiding the   *\
+     *  dim-sized temporary array this function previously required.         */\
+    tmpl_WhereIndices indices = tmpl_Where_Greater_##Type##_Indices(           \
+        data, dim, threshold                                                   \
+    );                                                                         \
                                                                                \
-    /*  Loop over the input array data to check which indices match.         */\
-    for (i=0; i<dim; ++i)                                                      \
-    {                                                                          \
-        if ((ftype)data[i] > threshold)                                        \
-        {                                                                      \
-            arr[arr_size] = i;                                                 \
-            arr_size += 1;                                                     \
-        }                                                                      \
-    }                                                                          \
+    /*  Errors in computing the indices are returned as NULL.                */\
+    if (indices.error_occurred)                                                \
+        return NULL;                                                           \
                                                                                \
-    /*  Resize the array dummy to avoid hogging extra memory.                */\
-    arr = realloc(arr, sizeof(*arr) * arr_size);                               \
-                                                                               \
-    /*  Declare a pointer to a pointer to containg all info to be returned.  */\
+    /*  Allocate memory for the two pointers.                                */\
     where = malloc(sizeof(*where) * 2);                                        \
                                                                                \
-    /*  The first index is the actual array of indices.                      */\
-    where[0] = arr;                                                            \
+    /*  If malloc failed, free the indices and abort.                        */\
+    if (!where)                                                                \
+    {                                                                          \
+        tmpl_WhereIndices_Destroy(&indices);                                   \
+        return NULL;                                                           \
+    }                                                                          \
                                                                                \
     /*  The second index is the size of the returning array.                 */\
     where[1] = malloc(sizeof(*where[1]));                                      \
-    *where[1] = arr_size;                                                      \
+                                                                               \
+    /*  Same check for malloc failing.                                       */\
+    if (!where[1])                                                             \
+    {                                                                          \
+        tmpl_WhereIndices_Destroy(&indices);                                   \
+        free(where);                                                           \
+        return NULL;                                                           \
+    }                                                                          \
+                                                                               \
+    /*  The first index is the actual array of indices.                      */\
+    where[0] = indices.indices;                                                \
+    *where[1] = indices.length;                                                \
     return where;                                                              \
 }
 
@@ -63,37 +69,43 @@ CreateWhereFunction(long double, LDouble, long double)
 #define CreateWhereFunction(type, Type, ftype)                                 \
 size_t **tmpl_Where_Lesser_##Type(type *data, size_t dim, ftype threshold)     \
 {                                                                              \
-    /*  Declare necessary variables.                                         */\
-    size_t i;                                                                  \
-    size_t *arr;                                                               \
+    /*  Declare a pointer to a pointer to containg all info to be returned.  */\
     size_t **where;                                                            \
-    size_t arr_size = 0;                                                       \
-                                                                               \
-    /*  Create a dummy array to store the correct indices in for now.        */\
-    arr = malloc(sizeof(*arr) * dim);                                          \
                                                                                \
-    /*  Loop over the input array data to check which indices match.         */\
-    for (i=0; i<dim; ++i)                                                      \
-    {                                                                          \
-        if ((ftype)data[i] < threshold)                                        \
-        {                                                                      \
-            arr[arr_size] = i;                                                 \
-            arr_size += 1;                                                     \
-        }                                                                      \
-    }                                                                          \
+    /*  Compute the indices. The output is allocated exactly, avoiding the   *\
+     *  dim-sized temporary array this function previously required.         */\
+    tmpl_WhereIndices indices = tmpl_Where_Lesser_##Type##_Indices(            \
+        data, dim, threshold                                                   \
+    );                                                                         \
                                                                                \
-    /*  Resize the array dummy to avoid hogging extra memory.                */\
-    arr = realloc(arr, sizeof(*arr) * arr_size);                               \
+    /*  Errors in computing the indices are returned as NULL.                */\
+    if (indices.error_occurred)                                                \
+        return NULL;                                                           \
                                                                                \
-    /*  Declare a pointer to a pointer to containg all info to be returned.  */\
+    /*  Allocate memory for the two pointers.                                */\
     where = malloc(sizeof(*where) * 2);                                        \
                                                                                \
-    /*  The first index is the actual array of indices.                      */\
-    where[0] = arr;                                                            \
+    /*  If malloc failed, free the indices and abort.                        */\
+    if (!where)                                                                \
+    {                                                                          \
+        tmpl_WhereIndices_Destroy(&indices);                                   \
+        return NULL;                                                           \
+    }                                                                          \
                                                                                \
     /*  The second index is the size of the returning array.                 */\
     where[1] = malloc(sizeof(*where[1]));                                      \
-    *where[1] = arr_size;                                                      \
+                                                                               \
+    /*  Same check for malloc failing.                                       */\
+    if (!where[1])                                                             \
+    {                                                                          \
+        tmpl_WhereIndices_Destroy(&indices);                                   \
+        free(where);                                                           \
+        return NULL;                                                           \
+    }                                                                          \
+                                                                               \
+    /*  The first index is the actual array of indices.                      */\
+    where[0] = indices.indices;                                                \
+    *where[1] = indices.length;                                                \
     return where;                                                              \
 }
 
@@ -115,37 +127,43 @@ CreateWhereFunction(long double, LDouble, long double)
 size_t **tmpl_Where_LesserGreater_##Type(type *data, size_t dim,               \
                                          ftype lower, ftype upper)             \
 {                                                                              \
-    /*  Declare necessary variables.                                         */\
-    size_t i;                                                                  \
-    size_t *arr;                                                               \
+    /*  Declare a pointer to a pointer to containg all info to be returned.  */\
     size_t **where;                                                            \
-    size_t arr_size = 0;                                                       \
-                                                                               \
-    /*  Create a dummy array to store the correct indices in for now.        */\
-    arr = malloc(sizeof(*arr) * dim);                                          \
                                                                                \
-    /*  Loop over the input array data to check which indices match.         */\
-    for (i=0; i<dim; ++i)                                                      \
-    {                                                                          \
-        if (((ftype)data[i] > lower) && ((ftype)data[i] < upper))              \
-        {                                                                      \
-            arr[arr_size] = i;                                                 \
-            arr_size += 1;                                                     \
-        }                                                                      \
-    }                                                                          \
+    /*  Compute the indices. The output is allocated exactly, avoiding the   *\
+     *  dim-sized temporary array this function previously required.         */\
+    tmpl_WhereIndices indices = tmpl_Where_LesserGreater_##Type##_Indices(     \
+        data, dim, lower, upper                                                \
+    );                                                                         \
                                                                                \
-    /*  Resize the array dummy to avoid hogging extra memory.                */\
-    arr = realloc(arr, sizeof(*arr) * arr_size);                               \
+    /*  Errors in computing the indices are returned as NULL.                */\
+    if (indices.error_occurred)                                                \
+        return NULL;                                                           \
                                                                                \
-    /*  Declare a pointer to a pointer to containg all info to be returned.  */\
+    /*  Allocate memory for the two pointers.                                */\
     where = malloc(sizeof(*where) * 2);                                        \
                                                                                \
-    /*  The first index is the actual array of indices.                      */\
-    where[0] = arr;                                                            \
+    /*  If malloc failed, free the indices and abort.                        */\
+    if (!where)                                                                \
+    {                                                                          \
+        tmpl_WhereIndices_Destroy(&indices);                                   \
+        return NULL;                                                           \
+    }                                                                          \
                                                                                \
     /*  The second index is the size of the returning array.                 */\
     where[1] = malloc(sizeof(*where[1]));                                      \
-    *where[1] = arr_size;                                                      \
+                                                                               \
+    /*  Same check for malloc failing.                                       */\
+    if (!where[1])                                                             \
+    {                                                                          \
+        tmpl_WhereIndices_Destroy(&indices);                                   \
+        free(where);                                                           \
+        return NULL;                                                           \
+    }                                                                          \
+                                                                               \
+    /*  The first index is the actual array of indices.                      */\
+    where[0] = indices.indices;                                                \
+    *where[1] = indices.length;                                                \
     return where;                                                              \
 }
 
@@ -0,0 +1,179 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                             tmpl_where_indices                             *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the indices of the elements of an array that lie above,      *
+ *      below, or strictly between given thresholds.                          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Where_Greater_Double_Indices                                     *
+ *      tmpl_Where_Lesser_Double_Indices                                      *
+ *      tmpl_Where_LesserGreater_Double_Indices                               *
+ *  Purpose:                                                                  *
+ *      Computes the indices n, in increasing order, with data[n] > threshold,*
+ *      data[n] < threshold, or lower < data[n] < upper, respectively. The    *
+ *      same functions are defined for char, unsigned char, short, unsigned   *
+ *      short, int, unsigned int, long, unsigned long, float, and long double.*
+ *  Arguments:                                                                *
+ *      data (const double *):                                                *
+ *          The array being searched.                                         *
+ *      dim (size_t):                                                         *
+ *          The number of elements in data.                                   *
+ *      threshold (double):                                                   *
+ *          The value data is compared against. For the LesserGreater         *
+ *          functions this is replaced by the two values lower and upper.     *
+ *  Output:                                                                   *
+ *      where (tmpl_WhereIndices):                                            *
+ *          The matching indices and the number of them.                      *
+ *  Called Functions:                                                         *
+ *      tmpl_where.h:                                                         *
+ *          tmpl_Where_Greater_Double_Mask:                                   *
+ *              Computes a bitmask for data > threshold. The other functions  *
+ *              call the corresponding Lesser and LesserGreater variants.     *
+ *          tmpl_WhereMask_To_Indices:                                        *
+ *              Expands a bitmask into a list of indices.                     *
+ *          tmpl_WhereMask_Destroy:                                           *
+ *              Frees the memory in a bitmask.                                *
+ *  Method:                                                                   *
+ *      Compute the packed bitmask of matching elements, which also counts    *
+ *      the matches. Allocate exactly that many indices and expand the mask   *
+ *      into them. The data is read once, and the only transient memory is    *
+ *      the mask itself, one bit per element.                                 *
+ *  Notes:                                                                    *
+ *      1.) Errors in computing the mask, or in allocating the indices, set   *
+ *          the error_occurred Boolean of the output.                         *
+ *                                                                            *
+ *      2.) The output must be freed with tmpl_WhereIndices_Destroy.          *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) tmpl_where.h:                                                         *
+ *          Header file where the function prototypes are given.              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  Prototypes for these functions declared here.                             */
+#include <libtmpl/include/tmpl_where.h>
+
+/*  Elements strictly greater than the threshold.                             */
+#define CreateWhereIndicesFunction(type, Type, ftype)                          \
+tmpl_WhereIndices                                                              \
+tmpl_Where_Greater_##Type##_Indices(const type *data, size_t dim,              \
+                                    ftype threshold)                           \
+{                                                                              \
+    /*  Compute the bitmask, which also counts the number of matches.        */\
+    tmpl_WhereMask mask = tmpl_Where_Greater_##Type##_Mask(                    \
+        data, dim, threshold                                                   \
+    );                                                                         \
+                                                                               \
+    /*  Allocate the indices exactly and expand the mask into them.          */\
+    tmpl_WhereIndices where = tmpl_WhereMask_To_Indices(&mask);                \
+                                                                               \
+    /*  The mask is no longer needed, free it and return.                    */\
+    tmpl_WhereMask_Destroy(&mask);                                             \
+    return where;                                                              \
+}
+
+CreateWhereIndicesFunction(char, Char, double)
+CreateWhereIndicesFunction(unsigned char, UChar, double)
+CreateWhereIndicesFunction(short, Short, double)
+CreateWhereIndicesFunction(unsigned short, UShort, double)
+CreateWhereIndicesFunction(int, Int, double)
+CreateWhereIndicesFunction(unsigned int, UInt, double)
+CreateWhereIndicesFunction(long, Long, double)
+CreateWhereIndicesFunction(unsigned long, ULong, double)
+CreateWhereIndicesFunction(float, Float, float)
+CreateWhereIndicesFunction(double, Double, double)
+CreateWhereIndicesFunction(long double, LDouble, long double)
+
+/*  Erase the CreateWhereIndicesFunction macro.                               */
+#undef CreateWhereIndicesFunction
+
+/*  Elements strictly less than the threshold.                                */
+#define CreateWhereIndicesFunction(type, Type, ftype)                          \
+tmpl_WhereIndices                                                              \
+tmpl_Where_Lesser_##Type##_Indices(const type *data, size_t dim,               \
+                                   ftype threshold)                            \
+{                                                                              \
+    /*  Compute the bitmask, which also counts the number of matches.        */\
+    tmpl_WhereMask mask = tmpl_Where_Lesser_##Type##_Mask(                     \
+        data, dim, threshold                                                   \
+    );                                                                         \
+                                                                               \
+    /*  Allocate the indices exactly and expand the mask into them.          */\
+    tmpl_WhereIndices where = tmpl_WhereMask_To_Indices(&mask);                \
+                                                                               \
+    /*  The mask is no longer needed, free it and return.                    */\
+    tmpl_WhereMask_Destroy(&mask);                                             \
+    return where;                                                              \
+}
+
+CreateWhereIndicesFunction(char, Char, double)
+CreateWhereIndicesFunction(unsigned char, UChar, double)
+CreateWhereIndicesFunction(short, Short, double)
+CreateWhereIndicesFunction(unsigned short, UShort, double)
+CreateWhereIndicesFunction(int, Int, double)
+CreateWhereIndicesFunction(unsigned int, UInt, double)
+CreateWhereIndicesFunction(long, Long, double)
+CreateWhereIndicesFunction(unsigned long, ULong, double)
+CreateWhereIndicesFunction(float, Float, float)
+CreateWhereIndicesFunction(double, Double, double)
+CreateWhereIndicesFunction(long double, LDouble, long double)
+
+/*  Erase the CreateWhereIndicesFunction macro.                               */
+#undef CreateWhereIndicesFunction
+
+/*  Elements strictly between the two thresholds.                             */
+#define CreateWhereIndicesFunction(type, Type, ftype)                          \
+tmpl_WhereIndices                                                              \
+tmpl_Where_LesserGreater_##Type##_Indices(const type *data, size_t dim,        \
+                                          ftype lower, ftype upper)            \
+{                                                                              \
+    /*  Compute the bitmask, which also counts the number of matches.        */\
+    tmpl_WhereMask mask = tmpl_Where_LesserGreater_##Type##_Mask(              \
+        data, dim, lower, upper                                                \
+    );                                                                         \
+                                                                               \
+    /*  Allocate the indices exactly and expand the mask into them.          */\
+    tmpl_WhereIndices where = tmpl_WhereMask_To_Indices(&mask);                \
+                                                                               \
+    /*  The mask is no longer needed, free it and return.                    */\
+    tmpl_WhereMask_Destroy(&mask);                                             \
+    return where;                                                              \
+}
+
+CreateWhereIndicesFunction(char, Char, double)
+CreateWhereIndicesFunction(unsigned char, UChar, double)
+CreateWhereIndicesFunction(short, Short, double)
+CreateWhereIndicesFunction(unsigned short, UShort, double)
+CreateWhereIndicesFunction(int, Int, double)
+CreateWhereIndicesFunction(unsigned int, UInt, double)
+CreateWhereIndicesFunction(long, Long, double)
+CreateWhereIndicesFunction(unsigned long, ULong, double)
+CreateWhereIndicesFunction(float, Float, float)
+CreateWhereIndicesFunction(double, Double, double)
+CreateWhereIndicesFunction(long double, LDouble, long double)
+
+/*  Erase the CreateWhereIndicesFunction macro.                               */
+#undef CreateWhereIndicesFunction
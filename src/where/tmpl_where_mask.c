@@ -0,0 +1,395 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                              tmpl_where_mask                               *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes packed bitmasks for the elements of an array that lie above, *
+ *      below, or strictly between given thresholds.                          *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_Where_Greater_Double_Mask                                        *
+ *      tmpl_Where_Lesser_Double_Mask                                         *
+ *      tmpl_Where_LesserGreater_Double_Mask                                  *
+ *  Purpose:                                                                  *
+ *      Computes a bitmask with bit n set if data[n] > threshold,             *
+ *      data[n] < threshold, or lower < data[n] < upper, respectively. The    *
+ *      same functions are defined for char, unsigned char, short, unsigned   *
+ *      short, int, unsigned int, long, unsigned long, float, and long double.*
+ *  Arguments:                                                                *
+ *      data (const double *):                                                *
+ *          The array being searched.                                         *
+ *      dim (size_t):                                                         *
+ *          The number of elements in data.                                   *
+ *      threshold (double):                                                   *
+ *          The value data is compared against. For the LesserGreater         *
+ *          functions this is replaced by the two values lower and upper.     *
+ *  Output:                                                                   *
+ *      mask (tmpl_WhereMask):                                                *
+ *          The packed bitmask and the number of set bits.                    *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates memory for the bits.                                *
+ *  Method:                                                                   *
+ *      Process the array eight elements at a time. Each comparison gives a   *
+ *      0 or 1, which is shifted into place and OR'd into a byte. There are   *
+ *      no branches in the main loop, so the comparisons compile to packed    *
+ *      SIMD compares and the shifts to a packed blend when vectorization is  *
+ *      enabled. The number of matches is accumulated in the same loop, so    *
+ *      the data is read exactly once.                                        *
+ *                                                                            *
+ *      With OpenMP support, arrays with at least                             *
+ *      TMPL_WHERE_PARALLEL_MIN_LENGTH elements are cut into blocks of        *
+ *      TMPL_WHERE_MASK_BLOCK bytes which are handed out to the threads.      *
+ *      Each block writes to its own bytes of the mask, and the counts are    *
+ *      summed with an OpenMP reduction, so the result does not depend on     *
+ *      the number of threads or on how the blocks were scheduled.            *
+ *  Notes:                                                                    *
+ *      1.) The mask uses 1 / 8 of a byte per element. For a 10^9 element     *
+ *          array this is 125 MB, compared to the 8 GB of size_t indices that *
+ *          the original tmpl_Where functions allocated up front.             *
+ *                                                                            *
+ *      2.) If data is NULL and dim is positive, or if malloc fails, the      *
+ *          error_occurred Boolean is set to true. An empty array (dim = 0)   *
+ *          gives an empty mask with bits set to NULL. This is not an error.  *
+ *                                                                            *
+ *      3.) As with the original tmpl_Where functions, the data is cast to    *
+ *          the type of the threshold before comparing. Comparisons with NaN  *
+ *          are always false, so NaN never matches.                           *
+ *                                                                            *
+ *      4.) The mask must be freed with tmpl_WhereMask_Destroy.               *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          Standard library header file with malloc.                         *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_cast.h:                                                          *
+ *          Header file providing TMPL_CAST for C vs. C++ compatibility.      *
+ *  4.) tmpl_where.h:                                                         *
+ *          Header file where the function prototypes are given.              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  malloc and size_t found here.                                             */
+#include <stdlib.h>
+
+/*  TMPL_CAST macro found here, providing C vs. C++ compatibility.            */
+#include <libtmpl/include/compat/tmpl_cast.h>
+
+/*  Booleans provided here.                                                   */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Prototypes for these functions declared here.                             */
+#include <libtmpl/include/tmpl_where.h>
+
+/*  Number of bytes of the mask (eight elements each) handed to a thread at a *
+ *  time in the parallel loop. 4096 bytes covers 32768 elements.              */
+#define TMPL_WHERE_MASK_BLOCK ((size_t)4096)
+
+/*  Function type for the kernels that fill bytes first <= q < last of the    *
+ *  mask. The bounds array holds the lower and upper thresholds. The number   *
+ *  of set bits is returned.                                                  */
+typedef size_t
+(*tmpl_WhereMaskKernel)(const void *data, const void *bounds, size_t dim,
+                        unsigned char *bits, size_t first, size_t last);
+
+/*  Fills the mask using the kernel, in parallel if OpenMP is available.      */
+static size_t
+tmpl_where_mask_fill(tmpl_WhereMaskKernel kernel,
+                     const void *data,
+                     const void *bounds,
+                     size_t dim,
+                     unsigned char *bits)
+{
+    /*  One bit per element, rounded up to a whole number of bytes.           */
+    const size_t bytes = (dim + (size_t)7) >> 3;
+
+#ifdef _OPENMP
+
+    /*  Large arrays are split into blocks which are shared among threads.    */
+    if (dim >= TMPL_WHERE_PARALLEL_MIN_LENGTH)
+    {
+        /*  Declare necessary variables. C89 requires this at the top.        */
+        size_t n;
+        size_t count = 0;
+
+        /*  Number of blocks, rounding up. The last block may be short.       */
+        const size_t blocks =
+            (bytes + TMPL_WHERE_MASK_BLOCK - 1) / TMPL_WHERE_MASK_BLOCK;
+
+        /*  The blocks are disjoint, so the threads never write to the same   *
+         *  byte. The sum of the counts does not depend on the scheduling.    */
+#pragma omp parallel for reduction(+: count)
+        for (n = 0; n < blocks; ++n)
+        {
+            const size_t first = n * TMPL_WHERE_MASK_BLOCK;
+            const size_t last = (bytes - first > TMPL_WHERE_MASK_BLOCK ?
+                                 first + TMPL_WHERE_MASK_BLOCK : bytes);
+
+            count += kernel(data, bounds, dim, bits, first, last);
+        }
+
+        return count;
+    }
+
+#endif
+/*  End of #ifdef _OPENMP.                                                    */
+
+    /*  Small arrays, or builds without OpenMP, do all bytes in one call.     */
+    return kernel(data, bounds, dim, bits, 0, bytes);
+}
+/*  End of tmpl_where_mask_fill.                                              */
+
+/*  The kernels are the same for every function, only the type and the        *
+ *  condition change. The condition is an expression in the variable x, which *
+ *  is the current element cast to ftype, and the thresholds lower and upper. *
+ *  It must evaluate to 0 or 1.                                               */
+#define TMPL_WHERE_MASK_KERNEL(type, ftype, cond, kernel_name)                 \
+static size_t                                                                  \
+kernel_name(const void *in, const void *bounds, size_t dim,                    \
+            unsigned char *bits, size_t first, size_t last)                    \
+{                                                                              \
+    /*  Declare necessary variables. C89 requires this at the top.           */\
+    size_t q, j;                                                               \
+    size_t count = 0;                                                          \
+                                                                               \
+    /*  Convert the void pointers back to their actual types.                */\
+    const type * const data = TMPL_CAST(in, const type *);                     \
+    const ftype * const thresholds = TMPL_CAST(bounds, const ftype *);         \
+    const ftype lower = thresholds[0];                                         \
+    const ftype upper = thresholds[1];                                         \
+                                                                               \
+    /*  Only the very last byte of the mask can be partial.                  */\
+    const size_t full = (dim >> 3 < last ? dim >> 3 : last);                   \
+                                                                               \
+    /*  Some conditions only use one of the thresholds. Avoid warnings.      */\
+    (void)lower;                                                               \
+    (void)upper;                                                               \
+                                                                               \
+    /*  Pack eight comparisons into each byte. The inner loop is branchless. */\
+    for (q = first; q < full; ++q)                                             \
+    {                                                                          \
+        const type * const block = data + (q << 3);                            \
+        unsigned int byte = 0U;                                                \
+        unsigned int hits = 0U;                                                \
+                                                                               \
+        for (j = 0; j < 8; ++j)                                                \
+        {                                                                      \
+            const ftype x = (ftype)block[j];                                   \
+            const unsigned int hit = (unsigned int)(cond);                     \
+            byte |= hit << j;                                                  \
+            hits += hit;                                                       \
+        }                                                                      \
+                                                                               \
+        bits[q] = (unsigned char)byte;                                         \
+        count += hits;                                                         \
+    }                                                                          \
+                                                                               \
+    /*  The last byte may be partial. Unused bits are left as zero.          */\
+    if (full < last)                                                           \
+    {                                                                          \
+        const type * const block = data + (full << 3);                         \
+        const size_t tail = dim - (full << 3);                                 \
+        unsigned int byte = 0U;                                                \
+        unsigned int hits = 0U;                                                \
+                                                                               \
+        for (j = 0; j < tail; ++j)                                             \
+        {                                                                      \
+            const ftype x = (ftype)block[j];                                   \
+            const unsigned int hit = (unsigned int)(cond);                     \
+            byte |= hit << j;                                                  \
+            hits += hit;                                                       \
+        }                                                                      \
+                                                                               \
+        bits[full] = (unsigned char)byte;                                      \
+        count += hits;                                                         \
+    }                                                                          \
+                                                                               \
+    return count;                                                              \
+}
+
+/*  The setup is also the same for every function. This checks the inputs,    *
+ *  allocates the mask, and passes the work to tmpl_where_mask_fill. The      *
+ *  calling function must declare the variables mask and bounds.              */
+#define TMPL_WHERE_MASK_BODY(kernel_name, func_name)                           \
+    /*  Start with an empty mask. This is returned for an empty array.       */\
+    mask.bits = NULL;                                                          \
+    mask.length = dim;                                                         \
+    mask.count = (size_t)0;                                                    \
+    mask.error_occurred = tmpl_False;                                          \
+    mask.error_message = NULL;                                                 \
+                                                                               \
+    /*  Nothing to do for an empty array.                                    */\
+    if (!dim)                                                                  \
+        return mask;                                                           \
+                                                                               \
+    /*  A NULL pointer with a positive length is treated as an error.        */\
+    if (!data)                                                                 \
+    {                                                                          \
+        mask.error_occurred = tmpl_True;                                       \
+        mask.error_message =                                                   \
+            "\nError Encountered:\n"                                           \
+            "    " func_name "\n\n"                                            \
+            "Input array is NULL. Aborting.\n\n";                              \
+                                                                               \
+        return mask;                                                           \
+    }                                                                          \
+                                                                               \
+    /*  One bit per element, rounded up to a whole number of bytes.          */\
+    mask.bits = malloc((dim + (size_t)7) >> 3);                                \
+                                                                               \
+    /*  Check if malloc failed. Abort the computation if it did.             */\
+    if (!mask.bits)                                                            \
+    {                                                                          \
+        mask.error_occurred = tmpl_True;                                       \
+        mask.error_message =                                                   \
+            "\nError Encountered:\n"                                           \
+            "    " func_name "\n\n"                                            \
+            "malloc failed. Aborting.\n\n";                                    \
+                                                                               \
+        return mask;                                                           \
+    }                                                                          \
+                                                                               \
+    /*  Compute the bits and count the number of matches.                    */\
+    mask.count =                                                               \
+        tmpl_where_mask_fill(kernel_name, data, bounds, dim, mask.bits);       \
+    return mask;
+
+/*  Elements strictly greater than the threshold.                             */
+#define CreateWhereMaskFunction(type, Type, ftype)                             \
+TMPL_WHERE_MASK_KERNEL(type, ftype, x > lower, tmpl_where_greater_##Type)      \
+                                                                               \
+tmpl_WhereMask                                                                 \
+tmpl_Where_Greater_##Type##_Mask(const type *data, size_t dim,                 \
+                                 ftype threshold)                              \
+{                                                                              \
+    /*  Declare necessary variables. C89 requires this at the top.           */\
+    tmpl_WhereMask mask;                                                       \
+    ftype bounds[2];                                                           \
+                                                                               \
+    /*  The thresholds are passed to the kernel as a two element array.      */\
+    bounds[0] = threshold;                                                     \
+    bounds[1] = threshold;                                                     \
+                                                                               \
+    TMPL_WHERE_MASK_BODY(                                                      \
+        tmpl_where_greater_##Type, "tmpl_Where_Greater_" #Type "_Mask"         \
+    )                                                                          \
+}
+
+CreateWhereMaskFunction(char, Char, double)
+CreateWhereMaskFunction(unsigned char, UChar, double)
+CreateWhereMaskFunction(short, Short, double)
+CreateWhereMaskFunction(unsigned short, UShort, double)
+CreateWhereMaskFunction(int, Int, double)
+CreateWhereMaskFunction(unsigned int, UInt, double)
+CreateWhereMaskFunction(long, Long, double)
+CreateWhereMaskFunction(unsigned long, ULong, double)
+CreateWhereMaskFunction(float, Float, float)
+CreateWhereMaskFunction(double, Double, double)
+CreateWhereMaskFunction(long double, LDouble, long double)
+
+/*  Erase the CreateWhereMaskFunction macro.                                  */
+#undef CreateWhereMaskFunction
+
+/*  Elements strictly less than the threshold.                                */
+#define CreateWhereMaskFunction(type, Type, ftype)                             \
+TMPL_WHERE_MASK_KERNEL(type, ftype, x < upper, tmpl_where_lesser_##Type)       \
+                                                                               \
+tmpl_WhereMask                                                                 \
+tmpl_Where_Lesser_##Type##_Mask(const type *data, size_t dim,                  \
+                                ftype threshold)                               \
+{                                                                              \
+    /*  Declare necessary variables. C89 requires this at the top.           */\
+    tmpl_WhereMask mask;                                                       \
+    ftype bounds[2];                                                           \
+                                                                               \
+    /*  The thresholds are passed to the kernel as a two element array.      */\
+    bounds[0] = threshold;                                                     \
+    bounds[1] = threshold;                                                     \
+                                                                               \
+    TMPL_WHERE_MASK_BODY(                                                      \
+        tmpl_where_lesser_##Type, "tmpl_Where_Lesser_" #Type "_Mask"           \
+    )                                                                          \
+}
+
+CreateWhereMaskFunction(char, Char, double)
+CreateWhereMaskFunction(unsigned char, UChar, double)
+CreateWhereMaskFunction(short, Short, double)
+CreateWhereMaskFunction(unsigned short, UShort, double)
+CreateWhereMaskFunction(int, Int, double)
+CreateWhereMaskFunction(unsigned int, UInt, double)
+CreateWhereMaskFunction(long, Long, double)
+CreateWhereMaskFunction(unsigned long, ULong, double)
+CreateWhereMaskFunction(float, Float, float)
+CreateWhereMaskFunction(double, Double, double)
+CreateWhereMaskFunction(long double, LDouble, long double)
+
+/*  Erase the CreateWhereMaskFunction macro.                                  */
+#undef CreateWhereMaskFunction
+
+/*  Elements strictly between the two thresholds. Bitwise and is used instead *
+ *  of logical and since the latter short-circuits, introducing a branch.     */
+#define CreateWhereMaskFunction(type, Type, ftype)                             \
+TMPL_WHERE_MASK_KERNEL(                                                        \
+    type, ftype, (x > lower) & (x < upper), tmpl_where_lessergreater_##Type    \
+)                                                                              \
+                                                                               \
+tmpl_WhereMask                                                                 \
+tmpl_Where_LesserGreater_##Type##_Mask(const type *data, size_t dim,           \
+                                       ftype lower, ftype upper)               \
+{                                                                              \
+    /*  Declare necessary variables. C89 requires this at the top.           */\
+    tmpl_WhereMask mask;                                                       \
+    ftype bounds[2];                                                           \
+                                                                               \
+    /*  The thresholds are passed to the kernel as a two element array.      */\
+    bounds[0] = lower;                                                         \
+    bounds[1] = upper;                                                         \
+                                                                               \
+    TMPL_WHERE_MASK_BODY(                                                      \
+        tmpl_where_lessergreater_##Type,                                       \
+        "tmpl_Where_LesserGreater_" #Type "_Mask"                              \
+    )                                                                          \
+}
+
+CreateWhereMaskFunction(char, Char, double)
+CreateWhereMaskFunction(unsigned char, UChar, double)
+CreateWhereMaskFunction(short, Short, double)
+CreateWhereMaskFunction(unsigned short, UShort, double)
+CreateWhereMaskFunction(int, Int, double)
+CreateWhereMaskFunction(unsigned int, UInt, double)
+CreateWhereMaskFunction(long, Long, double)
+CreateWhereMaskFunction(unsigned long, ULong, double)
+CreateWhereMaskFunction(float, Float, float)
+CreateWhereMaskFunction(double, Double, double)
+CreateWhereMaskFunction(long double, LDouble, long double)
+
+/*  Erase the CreateWhereMaskFunction macro.                                  */
+#undef CreateWhereMaskFunction
+
+/*  Erase the remaining macros.                                               */
+#undef TMPL_WHERE_MASK_KERNEL
+#undef TMPL_WHERE_MASK_BODY
+#undef TMPL_WHERE_MASK_BLOCK
@@ -0,0 +1,277 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of libtmpl.                                             *
+ *                                                                            *
+ *  libtmpl is free software: you can redistribute it and/or modify           *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  libtmpl is distributed in the hope that it will be useful,                *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with libtmpl.  If not, see <https://www.gnu.org/licenses/>.         *
+ ******************************************************************************
+ *                         tmpl_where_mask_to_indices                         *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Expands a packed bitmask into the list of indices of its set bits.    *
+ ******************************************************************************
+ *                             DEFINED FUNCTIONS                              *
+ ******************************************************************************
+ *  Function Name:                                                            *
+ *      tmpl_WhereMask_To_Indices                                             *
+ *  Purpose:                                                                  *
+ *      Computes the indices n, in increasing order, for which bit n of the   *
+ *      mask is set.                                                          *
+ *  Arguments:                                                                *
+ *      mask (const tmpl_WhereMask *):                                        *
+ *          A bitmask computed by one of the tmpl_Where_*_Mask functions.     *
+ *  Output:                                                                   *
+ *      where (tmpl_WhereIndices):                                            *
+ *          The indices of the set bits.                                      *
+ *  Called Functions:                                                         *
+ *      stdlib.h:                                                             *
+ *          malloc:                                                           *
+ *              Allocates memory for the indices.                             *
+ *      omp.h:                                                                *
+ *          omp_get_max_threads:                                              *
+ *              Returns the number of threads a parallel region may use.      *
+ *  Method:                                                                   *
+ *      The number of set bits is stored in the mask, so the output is        *
+ *      allocated exactly once with exactly the right size. The mask is then  *
+ *      scanned a byte at a time. Zero bytes are skipped, which is fast for   *
+ *      sparse selections. For non-zero bytes the eight candidate indices are *
+ *      written unconditionally and the output position is advanced by the    *
+ *      value of the bit (0 or 1). This is a branchless compress. Since the   *
+ *      final few writes of this scheme may land beyond the last match, the   *
+ *      branchless path is only taken when there are at least eight free      *
+ *      slots left in the output. The last bytes use an ordinary loop.        *
+ *                                                                            *
+ *      With OpenMP support, masks for at least TMPL_WHERE_PARALLEL_MIN_LENGTH*
+ *      elements are expanded in parallel. The bytes are cut into one chunk   *
+ *      per thread and each thread counts the set bits in its own chunk. An   *
+ *      exclusive prefix sum of these counts gives every chunk the offset in  *
+ *      the output where its indices begin. The threads then expand their     *
+ *      chunks independently. Since chunk t precedes chunk t + 1 both in the  *
+ *      mask and in the output, the indices are sorted and the result is the  *
+ *      same for any number of threads.                                       *
+ *  Notes:                                                                    *
+ *      1.) If mask is NULL, if its error_occurred Boolean is set, or if      *
+ *          malloc fails, the error_occurred Boolean of the output is set.    *
+ *                                                                            *
+ *      2.) If no bits are set, indices is NULL and length is zero. This is   *
+ *          not treated as an error.                                          *
+ *                                                                            *
+ *      3.) The output must be freed with tmpl_WhereIndices_Destroy.          *
+ ******************************************************************************
+ *                                DEPENDENCIES                                *
+ ******************************************************************************
+ *  1.) stdlib.h:                                                             *
+ *          Standard library header file with malloc.                         *
+ *  2.) tmpl_bool.h:                                                          *
+ *          Header file providing Booleans.                                   *
+ *  3.) tmpl_where.h:                                                         *
+ *          Header file where the function prototype is given.                *
+ *  4.) omp.h:                                                                *
+ *          OpenMP header file. Only included if OpenMP is enabled.           *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 18, 2026                                              *
+ ******************************************************************************/
+
+/*  malloc and size_t found here.                                             */
+#include <stdlib.h>
+
+/*  Booleans provided here.                                                   */
+#include <libtmpl/include/tmpl_bool.h>
+
+/*  Function prototype and typedefs given here.                               */
+#include <libtmpl/include/tmpl_where.h>
+
+/*  The parallel expansion is only available with OpenMP support.             */
+#ifdef _OPENMP
+
+/*  omp_get_max_threads provided here.                                        */
+#include <omp.h>
+
+/*  Counts the set bits in a byte using the standard SWAR bit-trick.          */
+static size_t tmpl_where_byte_popcount(unsigned int byte)
+{
+    byte = byte - ((byte >> 1) & 0x55U);
+    byte = (byte & 0x33U) + ((byte >> 2) & 0x33U);
+    return (size_t)((byte + (byte >> 4)) & 0x0FU);
+}
+/*  End of tmpl_where_byte_popcount.                                          */
+
+#endif
+/*  End of #ifdef _OPENMP.                                                    */
+
+/*  Expands bytes first <= q < last of the mask into out, which has exactly   *
+ *  as many elements as there are set bits in these bytes.                    */
+static void
+tmpl_where_expand(const unsigned char *bits,
+                  size_t first,
+                  size_t last,
+                  size_t *out,
+                  size_t out_length)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t q, j;
+    size_t k = 0;
+
+    /*  Expand each byte of the mask. Empty bytes are skipped.                */
+    for (q = first; q < last; ++q)
+    {
+        const unsigned int byte = (unsigned int)bits[q];
+        const size_t base = q << 3;
+
+        if (!byte)
+            continue;
+
+        /*  Branchless compress. Every candidate index is written, but the    *
+         *  output position only advances if the corresponding bit is set.    *
+         *  This may write up to eight slots ahead, so make sure they exist.  */
+        if (out_length - k >= (size_t)8)
+        {
+            for (j = 0; j < 8; ++j)
+            {
+                out[k] = base + j;
+                k += (byte >> j) & 1U;
+            }
+        }
+
+        /*  Near the end of the output, only write the matching indices.      */
+        else
+        {
+            for (j = 0; j < 8; ++j)
+                if ((byte >> j) & 1U)
+                    out[k++] = base + j;
+        }
+    }
+}
+/*  End of tmpl_where_expand.                                                 */
+
+/*  Function for converting a bitmask into a list of indices.                 */
+tmpl_WhereIndices tmpl_WhereMask_To_Indices(const tmpl_WhereMask *mask)
+{
+    /*  Declare necessary variables. C89 requires this at the top.            */
+    size_t bytes;
+    tmpl_WhereIndices where;
+
+    /*  Start with an empty list. This is returned if no bits are set.        */
+    where.indices = NULL;
+    where.length = (size_t)0;
+    where.error_occurred = tmpl_False;
+    where.error_message = NULL;
+
+    /*  Check for invalid inputs. Treat these as an error.                    */
+    if (!mask)
+    {
+        where.error_occurred = tmpl_True;
+        where.error_message =
+            "\nError Encountered:\n"
+            "    tmpl_WhereMask_To_Indices\n\n"
+            "Input mask is NULL. Aborting.\n\n";
+
+        return where;
+    }
+
+    /*  Errors from the computation of the mask are passed along.             */
+    if (mask->error_occurred)
+    {
+        where.error_occurred = tmpl_True;
+        where.error_message = mask->error_message;
+        return where;
+    }
+
+    /*  If nothing matched there is nothing to allocate.                      */
+    if (!mask->count)
+        return where;
+
+    /*  The count is known ahead of time, allocate the output exactly.        */
+    where.indices = malloc(sizeof(*where.indices) * mask->count);
+
+    /*  Check if malloc failed. Abort the computation if it did.              */
+    if (!where.indices)
+    {
+        where.error_occurred = tmpl_True;
+        where.error_message =
+            "\nError Encountered:\n"
+            "    tmpl_WhereMask_To_Indices\n\n"
+            "malloc failed. Aborting.\n\n";
+
+        return where;
+    }
+
+    where.length = mask->count;
+    bytes = (mask->length + (size_t)7) >> 3;
+
+#ifdef _OPENMP
+
+    /*  Large masks are expanded in parallel, one chunk per thread.           */
+    if (mask->length >= TMPL_WHERE_PARALLEL_MIN_LENGTH)
+    {
+        /*  Declare necessary variables. C89 requires this at the top.        */
+        size_t n;
+        const size_t threads = (size_t)omp_get_max_threads();
+
+        /*  offsets[t] is where the indices of chunk t begin in the output.   */
+        size_t * const offsets = malloc(sizeof(*offsets) * (threads + 1));
+
+        /*  If this small malloc fails, fall back to the serial expansion.    */
+        if (offsets)
+        {
+            /*  Count the set bits in each chunk. offsets[0] stays zero.      */
+            offsets[0] = 0;
+
+#pragma omp parallel for
+            for (n = 0; n < threads; ++n)
+            {
+                size_t q;
+                size_t count = 0;
+                const size_t first = (bytes / threads) * n;
+                const size_t last = (n + 1 == threads ?
+                                     bytes : (bytes / threads) * (n + 1));
+
+                for (q = first; q < last; ++q)
+                    count += tmpl_where_byte_popcount(mask->bits[q]);
+
+                offsets[n + 1] = count;
+            }
+
+            /*  The prefix sum turns the counts into starting offsets.        */
+            for (n = 0; n < threads; ++n)
+                offsets[n + 1] += offsets[n];
+
+            /*  Each thread expands its chunk into its slice of the output.   */
+#pragma omp parallel for
+            for (n = 0; n < threads; ++n)
+            {
+                const size_t first = (bytes / threads) * n;
+                const size_t last = (n + 1 == threads ?
+                                     bytes : (bytes / threads) * (n + 1));
+
+                tmpl_where_expand(
+                    mask->bits, first, last,
+                    where.indices + offsets[n], offsets[n + 1] - offsets[n]
+                );
+            }
+
+            free(offsets);
+            return where;
+        }
+    }
+
+#endif
+/*  End of #ifdef _OPENMP.                                                    */
+
+    /*  Serial expansion of the entire mask.                                  */
+    tmpl_where_expand(mask->bits, 0, bytes, where.indices, where.length);
+    return where;
+}
+/*  End of tmpl_WhereMask_To_Indices.                                         */